@@ -3,18 +3,34 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #include "domain/contracts/device/wifi.h"
 #include "domain/contracts/logger/leveled.h"
 #include "domain/contracts/network/interface.h"
 #include "domain/contracts/repository/preloaded.h"
 #include "domain/contracts/repository/wifi.h"
+#include "domain/contracts/system/clock.h"
+#include "domain/models/wifi.h"
+#include "domain/usecases/wifiman.h"
+#include "freertos/FreeRTOS.h"  // IWYU pragma: keep
+#include "freertos/semphr.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-#define APP_WIFIMAN_IMPL_DEFAULT_RECONNECT_MAX_TRIALS 5
+#define APP_WIFIMAN_IMPL_DEFAULT_RECONNECT_MAX_TRIALS  5
+#define APP_WIFIMAN_IMPL_DEFAULT_SCAN_ENTRY_MAX        32
+#define APP_WIFIMAN_IMPL_DEFAULT_SCAN_ENTRY_TTL_MS     60000
+#define APP_WIFIMAN_IMPL_DEFAULT_ROAM_RSSI_LOW         (-75)
+#define APP_WIFIMAN_IMPL_DEFAULT_ROAM_RSSI_HIGH        (-70)
+#define APP_WIFIMAN_IMPL_DEFAULT_ROAM_RSSI_GAIN        8
+#define APP_WIFIMAN_IMPL_DEFAULT_ROAM_EWMA_SHIFT       2
+#define APP_WIFIMAN_IMPL_DEFAULT_ROAM_WEAK_SAMPLES     3
+#define APP_WIFIMAN_IMPL_DEFAULT_ROAM_COOLDOWN_SAMPLES 24
+#define APP_WIFIMAN_IMPL_ROAM_SCAN_DWELL_MS            120
+#define APP_WIFIMAN_IMPL_SCAN_READ_LEN                 8
 
 typedef enum {
     APP_WIFIMAN_IMPL_STA_CONNECT_SOURCE_NONE = 0,
@@ -22,18 +38,90 @@ typedef enum {
     APP_WIFIMAN_IMPL_STA_CONNECT_SOURCE_RECONNECT,
 } app_wifiman_impl_sta_connect_source_t;
 
+typedef enum {
+    APP_WIFIMAN_IMPL_ROAM_STATE_IDLE = 0,
+    APP_WIFIMAN_IMPL_ROAM_STATE_SCANNING,
+    APP_WIFIMAN_IMPL_ROAM_STATE_ROAMING,
+} app_wifiman_impl_roam_state_t;
+
+/*
+ * Clock is optional. Without it max_age_ms never serves the cache and scan
+ * entries are dropped as soon as a scan misses them, instead of being kept
+ * for scan_entry_ttl_ms. Scan_entry_max sizes the cache allocated at
+ * creation, scan_dedup_by_ssid keeps one entry per SSID.
+ *
+ * The link monitor counts in samples, not time, so the roam settings scale
+ * with the rate monitor_link is called at. A link turns weak once its RSSI
+ * average drops below roam_rssi_low and strong again only at roam_rssi_high,
+ * roam_weak_samples weak samples in a row start a roam scan, and a BSSID
+ * must beat the average by roam_rssi_gain dB to be roamed to. The average
+ * moves by 1 / 2^roam_ewma_shift of each difference.
+ */
 typedef struct {
     dom_contracts_logger_leveled_t*       logger;
     dom_contracts_device_wifi_t*          wifi;
     dom_contracts_repository_wifi_t*      wifi_repository;
     dom_contracts_repository_preloaded_t* preloaded_repository;
     dom_contracts_network_interface_t*    network_interface;
+    dom_contracts_system_clock_t*         clock;
     size_t                                reconnect_max_trials;
     bool                                  ap_auto_manage_enabled;
+    size_t                                scan_entry_max;
+    uint32_t                              scan_entry_ttl_ms;
+    bool                                  scan_dedup_by_ssid;
+    int8_t                                roam_rssi_low;
+    int8_t                                roam_rssi_high;
+    uint8_t                               roam_rssi_gain;
+    uint8_t                               roam_ewma_shift;
+    uint32_t                              roam_weak_samples;
+    uint32_t                              roam_cooldown_samples;
 } app_wifiman_impl_cfg_t;
 
+/* Seen marks the entries matched by the scan being merged */
+typedef struct {
+    dom_usecases_wifiman_scan_entry_t* entries;
+    bool*                              seen;
+    size_t                             capacity;
+    size_t                             count;
+    bool                               truncated;
+} app_wifiman_impl_scan_cache_t;
+
+/* In_range and rssi come from the strongest scan entry with the profile SSID */
+typedef struct {
+    size_t slot;
+    bool   in_range;
+    int8_t rssi;
+} app_wifiman_impl_profile_rank_t;
+
+/*
+ * The average is kept in sixteenths of a dB so small steps are not lost to
+ * rounding. The target is the BSSID a roam in flight goes to, from_rssi the
+ * average that triggered it. Stats is the view get_status hands out.
+ */
+typedef struct {
+    int32_t                       rssi_avg_q4;
+    uint32_t                      weak_run;
+    uint32_t                      cooldown;
+    app_wifiman_impl_roam_state_t roam_state;
+    dom_models_wifi_scan_config_t roam_scan;
+    dom_models_wifi_ap_record_t   roam_target;
+    uint8_t                       roam_from_bssid[DOM_MODELS_WIFI_MAC_LEN];
+    int8_t                        roam_from_rssi;
+    dom_usecases_wifiman_link_t   stats;
+} app_wifiman_impl_link_monitor_t;
+
+/*
+ * Profiles are loaded once and kept, failure counts only reach the
+ * repository with the next write. Sta_profile_tried has a bit per profile
+ * slot tried since the last connection, so reconnects rotate through the
+ * profiles instead of retrying the best one forever.
+ *
+ * Every contract call holds lock, the HTTP, MQTT and task callers and the
+ * WiFi event callback all share this context.
+ */
 typedef struct {
     app_wifiman_impl_cfg_t                 cfg;
+    SemaphoreHandle_t                      lock;
     bool                                   started;
     bool                                   ap_started;
     bool                                   event_callback_registered;
@@ -42,6 +130,25 @@ typedef struct {
     bool                                   ap_enabled_by_reconnect_threshold;
     app_wifiman_impl_sta_connect_source_t sta_connect_source;
     size_t                                 reconnect_trial_count;
+    bool                                   last_ap_loaded;
+    bool                                   last_ap_available;
+    dom_models_wifi_sta_last_ap_t          last_ap;
+    bool                                   sta_connect_fast;
+    bool                                   sta_fast_connect_failed;
+    bool                                   profiles_loaded;
+    dom_models_wifi_sta_profiles_t         profiles;
+    uint32_t                               sta_profile_tried;
+    bool                                   sta_profile_attempt;
+    size_t                                 sta_profile_slot;
+    bool                                   scan_pending;
+    bool                                   scan_cache_valid;
+    int64_t                                scan_cache_updated_ms;
+    dom_models_wifi_scan_config_t          scan_config;
+    dom_models_wifi_scan_result_t          scan_status;
+    dom_usecases_wifiman_scan_stats_t      scan_stats;
+    app_wifiman_impl_scan_cache_t          scan_cache;
+    dom_models_wifi_ap_record_t            scan_read[APP_WIFIMAN_IMPL_SCAN_READ_LEN];
+    app_wifiman_impl_link_monitor_t        link;
 } app_wifiman_impl_ctx_t;
 
 #ifdef __cplusplus
@@ -1,7 +1,9 @@
 #ifndef APPLICATION_WIFIMAN_IMPL_UTILS_H
 #define APPLICATION_WIFIMAN_IMPL_UTILS_H
 
+#include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #include "application/wifiman/impl_types.h"
 #include "domain/models/error.h"
@@ -25,14 +27,74 @@ void app_wifiman_impl_credential_to_connect_config(
     const dom_models_wifi_sta_credential_t* credential
 );
 
+/* Directs the config at the last AP when it is the same network, returns whether it did */
+bool app_wifiman_impl_apply_last_ap(
+    dom_models_wifi_sta_connect_config_t* config,
+    const dom_models_wifi_sta_last_ap_t*  last_ap
+);
+
+/* False when the status does not name the AP with its BSSID and channel */
+bool app_wifiman_impl_last_ap_from_status(
+    dom_models_wifi_sta_last_ap_t*  out,
+    const dom_models_wifi_status_t* status
+);
+
+bool app_wifiman_impl_last_ap_from_record(
+    dom_models_wifi_sta_last_ap_t*     out,
+    const dom_models_wifi_ap_record_t* record
+);
+
 dom_models_error_t app_wifiman_impl_load_ap_config(
     app_wifiman_impl_ctx_t* ctx,
     dom_models_wifi_ap_config_t* out
 );
 
+/* A repository that never stored profiles reads as an empty store */
+dom_models_error_t app_wifiman_impl_load_profiles(
+    app_wifiman_impl_ctx_t* ctx
+);
+
+/*
+ * Orders the profiles the way reconnects try them. Profiles seen by the
+ * scan come first, then by priority, RSSI, latest success, fewest failures
+ * and slot. A NULL cache ranks every profile as out of range.
+ */
+size_t app_wifiman_impl_rank_profiles(
+    const dom_models_wifi_sta_profiles_t* profiles,
+    const app_wifiman_impl_scan_cache_t*  cache,
+    app_wifiman_impl_profile_rank_t       out[DOM_MODELS_WIFI_STA_PROFILE_MAX]
+);
+
+bool app_wifiman_impl_find_profile(
+    const dom_models_wifi_sta_profiles_t* profiles,
+    const char*                           ssid,
+    size_t*                               out_slot
+);
+
+/*
+ * Updating keeps the success history but not the failures, they may have
+ * come from the old password. A full store fails with BAD_STATE unless
+ * evict is set, then the lowest priority, least recently joined profile
+ * makes room.
+ */
+dom_models_error_t app_wifiman_impl_upsert_profile(
+    dom_models_wifi_sta_profiles_t*         profiles,
+    const dom_models_wifi_sta_credential_t* credential,
+    uint8_t                                 priority,
+    bool                                    evict,
+    size_t*                                 out_slot
+);
+
+void app_wifiman_impl_remove_profile(
+    dom_models_wifi_sta_profiles_t* profiles,
+    size_t                          slot
+);
+
+/* The best ranked profile not tried since the last connection, the best one once all were tried */
 dom_models_error_t app_wifiman_impl_load_stored_credential(
     app_wifiman_impl_ctx_t* ctx,
-    dom_models_wifi_sta_credential_t* out
+    dom_models_wifi_sta_credential_t* out,
+    size_t*                           out_slot
 );
 
 dom_models_error_t app_wifiman_impl_load_stored_sta(
@@ -40,6 +102,75 @@ dom_models_error_t app_wifiman_impl_load_stored_sta(
     dom_usecases_wifiman_stored_sta_t* out
 );
 
+/* Compares the ssid, bssid and channel filters, a NULL config has none */
+bool app_wifiman_impl_scan_filters_equal(
+    const dom_models_wifi_scan_config_t* a,
+    const dom_models_wifi_scan_config_t* b
+);
+
+dom_models_error_t app_wifiman_impl_scan_cache_init(
+    app_wifiman_impl_scan_cache_t* cache,
+    size_t                         capacity
+);
+
+void app_wifiman_impl_scan_cache_deinit(
+    app_wifiman_impl_scan_cache_t* cache
+);
+
+void app_wifiman_impl_scan_cache_clear(
+    app_wifiman_impl_scan_cache_t* cache
+);
+
+/*
+ * A finished driver scan is merged with begin, one merge per record and
+ * end. Records are matched by SSID when deduplicating, otherwise by BSSID,
+ * or by SSID and channel when the BSSID is unknown. A full cache makes
+ * room by evicting the stalest missed entry, then the weakest one. End
+ * drops the entries missed by the scan once entry_ttl_ms passed since they
+ * were last seen, right away when now_available is false, and sorts by RSSI.
+ */
+void app_wifiman_impl_scan_cache_begin(
+    app_wifiman_impl_scan_cache_t* cache
+);
+
+void app_wifiman_impl_scan_cache_merge(
+    app_wifiman_impl_scan_cache_t*     cache,
+    const dom_models_wifi_ap_record_t* record,
+    int64_t                            seen_ms,
+    bool                               dedup_by_ssid
+);
+
+void app_wifiman_impl_scan_cache_end(
+    app_wifiman_impl_scan_cache_t* cache,
+    bool                           now_available,
+    int64_t                        now_ms,
+    uint32_t                       entry_ttl_ms
+);
+
+/* Ends a merge cut short, nothing is aged out since the scan was not fully read */
+void app_wifiman_impl_scan_cache_abort(
+    app_wifiman_impl_scan_cache_t* cache
+);
+
+/*
+ * Folds one sample of the connected AP into the link average, the weak
+ * hysteresis and the BSSID stats. A NULL ap means the STA is not connected
+ * and ends tracking, a different BSSID restarts the average.
+ */
+void app_wifiman_impl_link_sample(
+    app_wifiman_impl_link_monitor_t*   link,
+    const app_wifiman_impl_cfg_t*      cfg,
+    const dom_models_wifi_ap_record_t* ap
+);
+
+/* The strongest other BSSID of the current SSID the latest scan saw at min_rssi or above */
+bool app_wifiman_impl_find_roam_candidate(
+    const app_wifiman_impl_scan_cache_t* cache,
+    const dom_models_wifi_ap_record_t*   current,
+    int                                  min_rssi,
+    dom_models_wifi_ap_record_t*         out
+);
+
 #ifdef __cplusplus
 }
 #endif
@@ -38,9 +38,11 @@
 
 /* Infrastructure Config Defines */
 
-#define COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_STDIO_ENABLE
+#define COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_ENABLE
+#define COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_USE_RING
 #define COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_MESSAGING_PUBLISH_ENABLE
 #define COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_MESSAGING_PUBLISH_USE_ESP_MQTT
+#define COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_MESSAGING_PUBLISH_USE_OUTBOX
 #define COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_MESSAGING_SUBSCRIBE_ENABLE
 #define COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_MESSAGING_SUBSCRIBE_USE_ESP_MQTT
 #define COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_DEVICE_WIFI_ENABLE
@@ -53,6 +55,8 @@
 #define COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_REPOSITORY_PRELOADED_USE_NVS
 #define COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_REPOSITORY_WIFI_ENABLE
 #define COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_REPOSITORY_WIFI_USE_NVS
+#define COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_SYSTEM_CLOCK_ENABLE
+#define COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_SYSTEM_CLOCK_USE_ESP
 #define COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_SYSTEM_INFO_ENABLE
 #define COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_SYSTEM_INFO_USE_ESP
 #define COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_SYSTEM_RESTART_ENABLE
@@ -72,7 +76,14 @@
 #define COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_NETIF_ENABLE
 #define COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_SETTINGS_ENABLE
 #define COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_WIFIMAN_ENABLE
+#define COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_EVENTS_ENABLE
+#define COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_METRICS_ENABLE
+#define COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_ASSETS_ENABLE
+#define COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_ADMISSION_ENABLE
 #define COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_WIFIMAN_STA_RECONNECT_ENABLE
+#define COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_WIFIMAN_LINK_MONITOR_ENABLE
+#define COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_LOG_SHIPPING_ENABLE
+#define COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_STATUS_PUBLISH_ENABLE
 #define COMPOSITION_MAIN_CONFIG_PRESENTATION_MQTT_ENABLE
 
 #ifdef __cplusplus
@@ -194,10 +205,22 @@ typedef struct {
     } driver;
 
     struct infrastructure {
-#ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_STDIO_ENABLE
+#ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_ENABLE
+#ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_USE_STDIO
         const dom_models_logger_level_t logger_leveled_stdio_level;
         const unsigned int              logger_leveled_stdio_callback_max_count;
-#endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_STDIO_ENABLE */
+#endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_USE_STDIO */
+#ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_USE_RING
+        const dom_models_logger_level_t logger_leveled_ring_level;
+        const unsigned int              logger_leveled_ring_callback_max_count;
+        const size_t                    logger_leveled_ring_slot_count;
+        const size_t                    logger_leveled_ring_msg_max_len;
+        const char*                     logger_leveled_ring_task_name;
+        const uint32_t                  logger_leveled_ring_task_stack_size;
+        const uint32_t                  logger_leveled_ring_task_priority;
+        const bool                      logger_leveled_ring_deferred_format;
+#endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_USE_RING */
+#endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_ENABLE */
 
 #ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_MESSAGING_PUBLISH_ENABLE
 #ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_MESSAGING_PUBLISH_USE_ESP_MQTT
@@ -206,6 +229,17 @@ typedef struct {
         const bool messaging_publish_esp_mqtt_status_retained;
         const bool messaging_publish_esp_mqtt_log_retained;
 #endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_MESSAGING_PUBLISH_USE_ESP_MQTT */
+#ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_MESSAGING_PUBLISH_USE_OUTBOX
+        const char*    messaging_publish_outbox_dir_path;
+        const size_t   messaging_publish_outbox_segment_max_bytes;
+        const size_t   messaging_publish_outbox_segment_max_count;
+        const size_t   messaging_publish_outbox_record_max_len;
+        const uint32_t messaging_publish_outbox_replay_interval_ms;
+        const size_t   messaging_publish_outbox_replay_burst_count;
+        const char*    messaging_publish_outbox_task_name;
+        const uint32_t messaging_publish_outbox_task_stack_size;
+        const uint32_t messaging_publish_outbox_task_priority;
+#endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_MESSAGING_PUBLISH_USE_OUTBOX */
 #endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_MESSAGING_PUBLISH_ENABLE */
 
 #ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_MESSAGING_SUBSCRIBE_ENABLE
@@ -216,9 +250,11 @@ typedef struct {
 
 #ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_DEVICE_WIFI_ENABLE
 #ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_DEVICE_WIFI_USE_ESP_WIFI
-        const char* wifi_esp_wifi_sta_if_key;
-        const char* wifi_esp_wifi_ap_if_key;
-        const bool  wifi_esp_wifi_register_event_handler;
+        const char*  wifi_esp_wifi_sta_if_key;
+        const char*  wifi_esp_wifi_ap_if_key;
+        const bool   wifi_esp_wifi_register_event_handler;
+        const bool   wifi_esp_wifi_register_ip_event_handler;
+        const size_t wifi_esp_wifi_scan_record_max;
 #endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_DEVICE_WIFI_USE_ESP_WIFI */
 #endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_DEVICE_WIFI_ENABLE */
 
@@ -264,18 +300,85 @@ typedef struct {
 
     struct application {
 #ifdef COMPOSITION_MAIN_CONFIG_APPLICATION_WIFIMAN_ENABLE
-        const size_t wifiman_reconnect_max_trials;
-        const bool   wifiman_ap_auto_manage_enabled;
+        const size_t   wifiman_reconnect_max_trials;
+        const bool     wifiman_ap_auto_manage_enabled;
+        const uint32_t wifiman_scan_entry_ttl_ms;
+        const size_t   wifiman_scan_entry_max;
+        const bool     wifiman_scan_dedup_by_ssid;
+        const int8_t   wifiman_roam_rssi_low;
+        const int8_t   wifiman_roam_rssi_high;
+        const uint8_t  wifiman_roam_rssi_gain;
+        const uint8_t  wifiman_roam_ewma_shift;
+        const uint32_t wifiman_roam_weak_samples;
+        const uint32_t wifiman_roam_cooldown_samples;
 #endif /* COMPOSITION_MAIN_CONFIG_APPLICATION_WIFIMAN_ENABLE */
     } application;
 
     struct presentation {
+#ifdef COMPOSITION_MAIN_CONFIG_DRIVER_HTTP_SERVER_ENABLE
+        const uint32_t http_etag_network_revalidate_ms;
+#endif /* COMPOSITION_MAIN_CONFIG_DRIVER_HTTP_SERVER_ENABLE */
+
+#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_EVENTS_ENABLE
+        const char*    event_stream_task_name;
+        const uint32_t event_stream_task_stack_size;
+        const uint32_t event_stream_task_priority;
+        const uint8_t  event_stream_task_client_max;
+        const uint32_t event_stream_task_tick_ms;
+        const uint32_t event_stream_task_keepalive_ms;
+#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_EVENTS_ENABLE */
+
+#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_ASSETS_ENABLE
+        const char* http_assets_base_path;
+#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_ASSETS_ENABLE */
+
+#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_ADMISSION_ENABLE
+        const uint16_t http_admission_read_burst;
+        const uint16_t http_admission_read_per_min;
+        const uint16_t http_admission_write_burst;
+        const uint16_t http_admission_write_per_min;
+        const uint16_t http_admission_expensive_burst;
+        const uint16_t http_admission_expensive_per_min;
+        const uint16_t http_admission_expensive_shared_burst;
+        const uint16_t http_admission_expensive_shared_per_min;
+#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_ADMISSION_ENABLE */
+
 #ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_WIFIMAN_STA_RECONNECT_ENABLE
         const char*    wifiman_sta_reconnect_task_name;
         const uint32_t wifiman_sta_reconnect_task_stack_size;
         const uint32_t wifiman_sta_reconnect_task_priority;
-        const uint32_t wifiman_sta_reconnect_task_interval_ms;
+        const uint32_t wifiman_sta_reconnect_task_backoff_base_ms;
+        const uint32_t wifiman_sta_reconnect_task_backoff_max_ms;
+        const uint8_t  wifiman_sta_reconnect_task_jitter_pct;
 #endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_WIFIMAN_STA_RECONNECT_ENABLE */
+
+#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_WIFIMAN_LINK_MONITOR_ENABLE
+        const char*    wifiman_link_monitor_task_name;
+        const uint32_t wifiman_link_monitor_task_stack_size;
+        const uint32_t wifiman_link_monitor_task_priority;
+        const uint32_t wifiman_link_monitor_task_sample_interval_ms;
+#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_WIFIMAN_LINK_MONITOR_ENABLE */
+
+#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_LOG_SHIPPING_ENABLE
+        const dom_models_logger_level_t log_shipping_task_level;
+        const char*                     log_shipping_task_name;
+        const uint32_t                  log_shipping_task_stack_size;
+        const uint32_t                  log_shipping_task_priority;
+        const size_t                    log_shipping_task_batch_max_bytes;
+        const size_t                    log_shipping_task_batch_max_count;
+        const size_t                    log_shipping_task_line_max_len;
+        const uint32_t                  log_shipping_task_max_latency_ms;
+        const bool                      log_shipping_task_binary;
+#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_LOG_SHIPPING_ENABLE */
+
+#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_STATUS_PUBLISH_ENABLE
+        const char*    status_publish_task_name;
+        const uint32_t status_publish_task_stack_size;
+        const uint32_t status_publish_task_priority;
+        const uint32_t status_publish_task_sample_interval_ms;
+        const uint32_t status_publish_task_debounce_ms;
+        const uint32_t status_publish_task_heartbeat_ms;
+#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_STATUS_PUBLISH_ENABLE */
     } presentation;
 
 } cmp_main_config_t;
@@ -10,6 +10,7 @@
 #include "domain/contracts/network/interface.h"             // IWYU pragma: keep
 #include "domain/contracts/repository/preloaded.h"          // IWYU pragma: keep
 #include "domain/contracts/repository/wifi.h"               // IWYU pragma: keep
+#include "domain/contracts/system/clock.h"                  // IWYU pragma: keep
 #include "domain/contracts/system/info.h"                   // IWYU pragma: keep
 #include "domain/contracts/system/restart.h"                // IWYU pragma: keep
 #include "domain/contracts/system/update.h"                 // IWYU pragma: keep
@@ -24,9 +25,20 @@
 #include "esp_http_server.h"                                // IWYU pragma: keep
 #include "mqtt_client.h"                                    // IWYU pragma: keep
 #include "nvs.h"                                            // IWYU pragma: keep
+#include "presentation/http/etag.h"                         // IWYU pragma: keep
+#include "presentation/http/admission.h"                    // IWYU pragma: keep
+#include "presentation/http/handler/assets_types.h"         // IWYU pragma: keep
+#include "presentation/http/handler/events_types.h"         // IWYU pragma: keep
+#include "presentation/http/handler/metrics_types.h"        // IWYU pragma: keep
 #include "presentation/http/handler/netif_types.h"          // IWYU pragma: keep
 #include "presentation/http/handler/settings_types.h"       // IWYU pragma: keep
 #include "presentation/http/handler/wifiman_types.h"        // IWYU pragma: keep
+#include "presentation/http/metrics.h"                      // IWYU pragma: keep
+#include "presentation/http/router.h"                       // IWYU pragma: keep
+#include "presentation/task/event_stream/types.h"           // IWYU pragma: keep
+#include "presentation/task/log_shipping/types.h"           // IWYU pragma: keep
+#include "presentation/task/status_publish/types.h"         // IWYU pragma: keep
+#include "presentation/task/wifiman_link_monitor/types.h"   // IWYU pragma: keep
 #include "presentation/task/wifiman_sta_reconnect/types.h"  // IWYU pragma: keep
 #include "presentation/mqtt/context.h"                      // IWYU pragma: keep
 #include "sdmmc_cmd.h"                                      // IWYU pragma: keep
@@ -63,7 +75,14 @@ typedef struct {
 #endif /* COMPOSITION_MAIN_CONFIG_DRIVER_ETHERNET_ENABLE */
 
 #ifdef COMPOSITION_MAIN_CONFIG_DRIVER_HTTP_SERVER_ENABLE
-    httpd_handle_t http_server_handle;
+    httpd_handle_t      http_server_handle;
+    pres_http_router_t* http_server_router;
+#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_METRICS_ENABLE
+    pres_http_metrics_t* http_server_metrics;
+#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_METRICS_ENABLE */
+#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_ADMISSION_ENABLE
+    pres_http_admission_t* http_server_admission;
+#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_ADMISSION_ENABLE */
 #endif /* COMPOSITION_MAIN_CONFIG_DRIVER_HTTP_SERVER_ENABLE */
 
 #ifdef COMPOSITION_MAIN_CONFIG_DRIVER_MQTT_CLIENT_ENABLE
@@ -75,12 +94,15 @@ typedef struct {
 } cmp_main_driver_t;
 
 typedef struct {
-#ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_STDIO_ENABLE
+#ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_ENABLE
     dom_contracts_logger_leveled_t* logger;
-#endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_STDIO_ENABLE */
+#endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_ENABLE */
 
 #ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_MESSAGING_PUBLISH_ENABLE
     dom_contracts_messaging_publish_t* messaging_publish;
+#ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_MESSAGING_PUBLISH_USE_OUTBOX
+    dom_contracts_messaging_publish_t* messaging_publish_inner;
+#endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_MESSAGING_PUBLISH_USE_OUTBOX */
 #endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_MESSAGING_PUBLISH_ENABLE */
 
 #ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_MESSAGING_SUBSCRIBE_ENABLE
@@ -107,6 +129,10 @@ typedef struct {
     dom_contracts_repository_wifi_t* wifi_repository;
 #endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_REPOSITORY_WIFI_ENABLE */
 
+#ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_SYSTEM_CLOCK_ENABLE
+    dom_contracts_system_clock_t* system_clock;
+#endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_SYSTEM_CLOCK_ENABLE */
+
 #ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_SYSTEM_INFO_ENABLE
     dom_contracts_system_info_t* system_info;
 #endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_SYSTEM_INFO_ENABLE */
@@ -139,6 +165,11 @@ typedef struct {
 } cmp_main_application_t;
 
 typedef struct {
+#ifdef COMPOSITION_MAIN_CONFIG_DRIVER_HTTP_SERVER_ENABLE
+    pres_http_etag_t network_etag;
+    pres_http_etag_t settings_etag;
+#endif /* COMPOSITION_MAIN_CONFIG_DRIVER_HTTP_SERVER_ENABLE */
+
 #ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_NETIF_ENABLE
     pres_http_handler_netif_t netif_http_handler;
 #endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_NETIF_ENABLE */
@@ -151,10 +182,35 @@ typedef struct {
     pres_http_handler_wifiman_t wifiman_http_handler;
 #endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_WIFIMAN_ENABLE */
 
+#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_EVENTS_ENABLE
+    pres_task_event_stream_t*  event_stream_task;
+    pres_http_handler_events_t events_http_handler;
+#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_EVENTS_ENABLE */
+
+#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_METRICS_ENABLE
+    pres_http_handler_metrics_t metrics_http_handler;
+#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_METRICS_ENABLE */
+
+#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_ASSETS_ENABLE
+    pres_http_handler_assets_t assets_http_handler;
+#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_ASSETS_ENABLE */
+
 #ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_WIFIMAN_STA_RECONNECT_ENABLE
     pres_task_wifiman_sta_reconnect_t* wifiman_sta_reconnect_task;
 #endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_WIFIMAN_STA_RECONNECT_ENABLE */
 
+#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_WIFIMAN_LINK_MONITOR_ENABLE
+    pres_task_wifiman_link_monitor_t* wifiman_link_monitor_task;
+#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_WIFIMAN_LINK_MONITOR_ENABLE */
+
+#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_LOG_SHIPPING_ENABLE
+    pres_task_log_shipping_t* log_shipping_task;
+#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_LOG_SHIPPING_ENABLE */
+
+#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_STATUS_PUBLISH_ENABLE
+    pres_task_status_publish_t* status_publish_task;
+#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_STATUS_PUBLISH_ENABLE */
+
 #ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_MQTT_ENABLE
     pres_mqtt_context_t* mqtt_context;
 #endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_MQTT_ENABLE */
@@ -24,10 +24,16 @@ struct dom_contracts_device_wifi_t {
         dom_contracts_device_wifi_t* self,
         dom_models_wifi_mode_t       mode
     );
+    /* Copies the latest status snapshot, the connected AP RSSI may be as old as the last refresh. */
     dom_models_error_t (*get_status)(
         dom_contracts_device_wifi_t* self,
         dom_models_wifi_status_t*    out
     );
+    /* Re-reads the status from the driver into the snapshot and copies it. */
+    dom_models_error_t (*refresh_status)(
+        dom_contracts_device_wifi_t* self,
+        dom_models_wifi_status_t*    out
+    );
     /* Starts a station connection attempt and returns after the driver accepts the request. */
     dom_models_error_t (*connect_sta)(
         dom_contracts_device_wifi_t*                self,
@@ -48,9 +54,18 @@ struct dom_contracts_device_wifi_t {
         dom_contracts_device_wifi_t*         self,
         const dom_models_wifi_scan_config_t* config
     );
+    /*
+     * Reports the latest scan and copies up to records_cap of its records,
+     * strongest first, from offset on. Records may be NULL to only read the
+     * status, records_cnt is optional.
+     */
     dom_models_error_t (*get_scanned)(
         dom_contracts_device_wifi_t*   self,
-        dom_models_wifi_scan_result_t* out
+        dom_models_wifi_scan_result_t* out,
+        size_t                         offset,
+        dom_models_wifi_ap_record_t*   records,
+        size_t                         records_cap,
+        size_t*                        records_cnt
     );
     dom_models_error_t (*add_event_callback)(
         dom_contracts_device_wifi_t*     self,
@@ -1,19 +1,33 @@
 #ifndef DOMAIN_CONTRACTS_LOGGER_LEVELED_H
 #define DOMAIN_CONTRACTS_LOGGER_LEVELED_H
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdlib.h>
 
+#include "domain/models/logger.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 typedef struct dom_contracts_logger_leveled_t dom_contracts_logger_leveled_t;
 
+/*
+ * Most verbose level compiled in. DOM_CONTRACTS_LOGGER_LEVELED_<LEVEL>()
+ * calls below this severity are removed at compile time together with
+ * their argument evaluation.
+ */
+#ifndef DOM_CONTRACTS_LOGGER_LEVELED_MIN_LEVEL
+#define DOM_CONTRACTS_LOGGER_LEVELED_MIN_LEVEL DOMAIN_MODELS_LOGGER_LEVEL_DEBUG
+#endif
+
 typedef void (*dom_contracts_logger_leveled_cb)(void* cb_ctx, const char* msg, size_t msg_len);
+typedef void (*dom_contracts_logger_leveled_record_cb)(void* cb_ctx, const dom_models_logger_record_t* record);
 
 struct dom_contracts_logger_leveled_t {
-    void* ctx;
+    void*                     ctx;
+    dom_models_logger_level_t level;
     void (*error)(
         dom_contracts_logger_leveled_t* self,
         const char*                     tag,
@@ -47,6 +61,20 @@ struct dom_contracts_logger_leveled_t {
         dom_contracts_logger_leveled_t* self,
         dom_contracts_logger_leveled_cb cb_func
     );
+    /*
+     * Optional, left NULL by backends that format in the caller. A record
+     * callback gets each call unformatted, for consumers that ship the
+     * record instead of the text line.
+     */
+    void (*add_record_callback)(
+        dom_contracts_logger_leveled_t*        self,
+        void*                                  cb_ctx,
+        dom_contracts_logger_leveled_record_cb cb_func
+    );
+    void (*remove_record_callback)(
+        dom_contracts_logger_leveled_t*        self,
+        dom_contracts_logger_leveled_record_cb cb_func
+    );
 };
 
 static inline dom_contracts_logger_leveled_t* dom_contracts_logger_leveled_new(void* ctx) {
@@ -54,7 +82,8 @@ static inline dom_contracts_logger_leveled_t* dom_contracts_logger_leveled_new(v
     if (!self) {
         return NULL;
     }
-    self->ctx = ctx;
+    self->ctx   = ctx;
+    self->level = DOMAIN_MODELS_LOGGER_LEVEL_DEBUG;
     return self;
 }
 
@@ -63,6 +92,27 @@ static inline void dom_contracts_logger_leveled_delete(dom_contracts_logger_leve
     free(self);
 }
 
+static inline bool dom_contracts_logger_leveled_enabled(const dom_contracts_logger_leveled_t* self, dom_models_logger_level_t level) {
+    return self && level != DOMAIN_MODELS_LOGGER_LEVEL_NONE && level <= self->level;
+}
+
+#define DOM_CONTRACTS_LOGGER_LEVELED_LOG(logger, log_level, log_func, tag, ...) \
+    do {                                                                        \
+        if ((log_level) <= DOM_CONTRACTS_LOGGER_LEVELED_MIN_LEVEL &&            \
+            dom_contracts_logger_leveled_enabled((logger), (log_level))) {      \
+            (logger)->log_func((logger), (tag), __VA_ARGS__);                   \
+        }                                                                       \
+    } while (0)
+
+#define DOM_CONTRACTS_LOGGER_LEVELED_ERROR(logger, tag, ...)                                            \
+    DOM_CONTRACTS_LOGGER_LEVELED_LOG(logger, DOMAIN_MODELS_LOGGER_LEVEL_ERROR, error, tag, __VA_ARGS__)
+#define DOM_CONTRACTS_LOGGER_LEVELED_WARN(logger, tag, ...)                                           \
+    DOM_CONTRACTS_LOGGER_LEVELED_LOG(logger, DOMAIN_MODELS_LOGGER_LEVEL_WARN, warn, tag, __VA_ARGS__)
+#define DOM_CONTRACTS_LOGGER_LEVELED_INFO(logger, tag, ...)                                           \
+    DOM_CONTRACTS_LOGGER_LEVELED_LOG(logger, DOMAIN_MODELS_LOGGER_LEVEL_INFO, info, tag, __VA_ARGS__)
+#define DOM_CONTRACTS_LOGGER_LEVELED_DEBUG(logger, tag, ...)                                            \
+    DOM_CONTRACTS_LOGGER_LEVELED_LOG(logger, DOMAIN_MODELS_LOGGER_LEVEL_DEBUG, debug, tag, __VA_ARGS__)
+
 #ifdef __cplusplus
 }
 #endif
@@ -27,6 +27,10 @@ struct dom_contracts_messaging_publish_t {
         dom_contracts_messaging_publish_t* self,
         const dom_models_messaging_log_t*  log
     );
+    dom_models_error_t (*send_log_batch)(
+        dom_contracts_messaging_publish_t*      self,
+        const dom_models_messaging_log_batch_t* batch
+    );
     dom_models_error_t (*is_connected)(
         dom_contracts_messaging_publish_t* self,
         bool*                              out
@@ -14,17 +14,27 @@ typedef struct dom_contracts_repository_wifi_t dom_contracts_repository_wifi_t;
 
 struct dom_contracts_repository_wifi_t {
     void* ctx;
-    dom_models_error_t (*get_sta_credential)(
-        dom_contracts_repository_wifi_t*  self,
-        dom_models_wifi_sta_credential_t* out
+    /* NOT_FOUND when nothing was ever stored, an emptied store reads as zero profiles */
+    dom_models_error_t (*get_sta_profiles)(
+        dom_contracts_repository_wifi_t* self,
+        dom_models_wifi_sta_profiles_t*  out
     );
-    dom_models_error_t (*set_sta_credential)(
-        dom_contracts_repository_wifi_t*        self,
-        const dom_models_wifi_sta_credential_t* credential
+    dom_models_error_t (*set_sta_profiles)(
+        dom_contracts_repository_wifi_t*      self,
+        const dom_models_wifi_sta_profiles_t* profiles
     );
+    /* Forgets every profile and the last AP */
     dom_models_error_t (*clear_sta_credential)(
         dom_contracts_repository_wifi_t* self
     );
+    dom_models_error_t (*get_sta_last_ap)(
+        dom_contracts_repository_wifi_t* self,
+        dom_models_wifi_sta_last_ap_t*   out
+    );
+    dom_models_error_t (*set_sta_last_ap)(
+        dom_contracts_repository_wifi_t*     self,
+        const dom_models_wifi_sta_last_ap_t* last_ap
+    );
 };
 
 static inline dom_contracts_repository_wifi_t* dom_contracts_repository_wifi_new(void* ctx) {
@@ -0,0 +1,48 @@
+#ifndef DOMAIN_CONTRACTS_SYSTEM_CLOCK_H
+#define DOMAIN_CONTRACTS_SYSTEM_CLOCK_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "domain/models/error.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct dom_contracts_system_clock_t dom_contracts_system_clock_t;
+
+/* Monotonic time since boot, unaffected by SNTP or manual time changes */
+struct dom_contracts_system_clock_t {
+    void* ctx;
+    dom_models_error_t (*get_uptime_ms)(
+        dom_contracts_system_clock_t* self,
+        int64_t*                      out
+    );
+};
+
+static inline dom_contracts_system_clock_t* dom_contracts_system_clock_new(void* ctx) {
+    dom_contracts_system_clock_t* self = (dom_contracts_system_clock_t*)calloc(1, sizeof(dom_contracts_system_clock_t));
+    if (!self) {
+        return NULL;
+    }
+
+    self->ctx = ctx;
+
+    return self;
+}
+
+static inline void dom_contracts_system_clock_delete(dom_contracts_system_clock_t* self) {
+    if (!self) {
+        return;
+    }
+
+    self->ctx = NULL;
+    free(self);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DOMAIN_CONTRACTS_SYSTEM_CLOCK_H */
@@ -24,6 +24,10 @@ struct dom_contracts_system_update_t {
     dom_models_error_t (*rollback)(
         dom_contracts_system_update_t* self
     );
+    dom_models_error_t (*get_progress)(
+        dom_contracts_system_update_t* self,
+        dom_models_update_progress_t*  out
+    );
 };
 
 static inline dom_contracts_system_update_t* dom_contracts_system_update_new(void* ctx) {
@@ -1,6 +1,8 @@
 #ifndef DOMAIN_MODELS_LOGGER_H
 #define DOMAIN_MODELS_LOGGER_H
 
+#include <stddef.h>
+#include <stdint.h>
 #include <string.h>
 
 #ifdef __cplusplus
@@ -20,6 +22,22 @@ typedef enum {
 #undef X
 } dom_models_logger_level_t;
 
+/*
+ * A log call before formatting. Tag and format are the pointers the caller
+ * passed, so both must be static strings (string literals). Args holds the
+ * argument bytes in format order at their native sizes, strings are copied
+ * inline with their terminating NUL. Timestamp_us is esp_timer time since
+ * boot.
+ */
+typedef struct {
+    dom_models_logger_level_t level;
+    const char*               tag;
+    const char*               format;
+    int64_t                   timestamp_us;
+    const uint8_t*            args;
+    size_t                    args_len;
+} dom_models_logger_record_t;
+
 static inline const char* dom_models_logger_level_str(dom_models_logger_level_t log_level) {
     switch (log_level) {
 #define X(cb_name, cb_string) \
@@ -1,6 +1,10 @@
 #ifndef DOMAIN_MODELS_MESSAGING_H
 #define DOMAIN_MODELS_MESSAGING_H
 
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
 #include "domain/models/system.h"
 #include "domain/models/update.h"
 
@@ -16,6 +20,7 @@ extern "C" {
 #define DOM_MODELS_MESSAGING_SIGNATURE_MAX_LEN   129
 #define DOM_MODELS_MESSAGING_STATUS_MAX_LEN      16
 #define DOM_MODELS_MESSAGING_LOG_MAX_LEN         256
+#define DOM_MODELS_MESSAGING_IP_MAX_LEN          16
 
 typedef enum {
     DOM_MODELS_MESSAGING_TOPIC_DIRECTION_PUB = 0,
@@ -31,8 +36,14 @@ typedef struct {
     char signature[DOM_MODELS_MESSAGING_SIGNATURE_MAX_LEN];
 } dom_models_messaging_registration_t;
 
+/* RSSI bucket is 0 without a STA link, then 1 (weak) up to 4 (excellent) */
 typedef struct {
-    char status[DOM_MODELS_MESSAGING_STATUS_MAX_LEN];
+    char    status[DOM_MODELS_MESSAGING_STATUS_MAX_LEN];
+    bool    wifi_connected;
+    bool    ethernet_connected;
+    char    ip[DOM_MODELS_MESSAGING_IP_MAX_LEN];
+    uint8_t rssi_bucket;
+    bool    ota_updating;
 } dom_models_messaging_status_t;
 
 typedef struct {
@@ -43,6 +54,18 @@ typedef struct {
     char message[DOM_MODELS_MESSAGING_LOG_MAX_LEN];
 } dom_models_messaging_log_t;
 
+/*
+ * Newline-delimited log lines, payload is not required to be NUL-terminated.
+ * A binary batch holds log records instead, laid out as described in
+ * presentation/task/log_shipping/types.h and read by tools/log_decode.py.
+ */
+typedef struct {
+    const char* payload;
+    size_t      payload_len;
+    size_t      record_cnt;
+    bool        binary;
+} dom_models_messaging_log_batch_t;
+
 typedef struct {
     dom_models_update_info_t update_info;
 } dom_models_messaging_update_t;
@@ -16,6 +16,11 @@ typedef struct {
     char   firmware_checksum[DOM_MODELS_UPDATE_CHECKSUM_MAX_LEN];
 } dom_models_update_info_t;
 
+typedef struct {
+    size_t written_size;
+    size_t total_size;
+} dom_models_update_progress_t;
+
 #ifdef __cplusplus
 }
 #endif
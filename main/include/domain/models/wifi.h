@@ -18,11 +18,12 @@ extern "C" {
 #define DOM_MODELS_WIFI_PASSWORD_BUF_LEN       (DOM_MODELS_WIFI_PASSWORD_MAX_LEN + 1)
 #define DOM_MODELS_WIFI_SSID_LEN               DOM_MODELS_WIFI_SSID_BUF_LEN
 #define DOM_MODELS_WIFI_PASSWORD_LEN           DOM_MODELS_WIFI_PASSWORD_BUF_LEN
-#define DOM_MODELS_WIFI_SCAN_RESULT_MAX        16
+#define DOM_MODELS_WIFI_SCAN_RECORD_MAX        32
 #define DOM_MODELS_WIFI_AP_CLIENT_MAX          8
 #define DOM_MODELS_WIFI_AP_DEFAULT_CHANNEL     1
 #define DOM_MODELS_WIFI_AP_DEFAULT_MAX_CLIENTS 4
 #define DOM_MODELS_WIFI_AP_DEFAULT_AUTH_MODE   DOM_MODELS_WIFI_AUTH_WPA2_PSK
+#define DOM_MODELS_WIFI_STA_PROFILE_MAX        8
 
 #define DOM_MODELS_WIFI_PHY_FLAG_11B           (1u << 0)
 #define DOM_MODELS_WIFI_PHY_FLAG_11G           (1u << 1)
@@ -37,6 +38,8 @@ extern "C" {
 
 #define DOM_MODELS_WIFI_STA_CREDENTIAL_SSID_KEY "wifi_sta_ssid"
 #define DOM_MODELS_WIFI_STA_CREDENTIAL_PASS_KEY "wifi_sta_pass"
+#define DOM_MODELS_WIFI_STA_LAST_AP_KEY         "wifi_sta_last"
+#define DOM_MODELS_WIFI_STA_PROFILES_KEY        "wifi_sta_prof"
 
 typedef enum {
     DOM_MODELS_WIFI_MODE_NULL = 0,
@@ -106,6 +109,33 @@ typedef struct {
     char password[DOM_MODELS_WIFI_PASSWORD_BUF_LEN];
 } dom_models_wifi_sta_credential_t;
 
+/*
+ * A known network. A higher priority is tried first. There is no wall clock
+ * to stamp the last success with, so last_success_seq orders the profiles by
+ * their latest success instead, 0 meaning never.
+ */
+typedef struct {
+    dom_models_wifi_sta_credential_t credential;
+    uint8_t                          priority;
+    uint32_t                         last_success_seq;
+    uint16_t                         failure_cnt;
+} dom_models_wifi_sta_profile_t;
+
+/* Success_seq is the latest last_success_seq handed out */
+typedef struct {
+    size_t                        count;
+    uint32_t                      success_seq;
+    dom_models_wifi_sta_profile_t profiles[DOM_MODELS_WIFI_STA_PROFILE_MAX];
+} dom_models_wifi_sta_profiles_t;
+
+/* Where the stored network was last joined, lets a reconnect skip the all channel scan */
+typedef struct {
+    char                        ssid[DOM_MODELS_WIFI_SSID_BUF_LEN];
+    uint8_t                     bssid[DOM_MODELS_WIFI_MAC_LEN];
+    uint8_t                     channel;
+    dom_models_wifi_auth_mode_t auth_mode;
+} dom_models_wifi_sta_last_ap_t;
+
 typedef struct {
     bool                             bssid_available;
     uint8_t                          bssid[DOM_MODELS_WIFI_MAC_LEN];
@@ -135,6 +165,9 @@ typedef struct {
 
     bool    channel_set;
     uint8_t channel;
+
+    bool                        auth_mode_set;
+    dom_models_wifi_auth_mode_t auth_mode;
 } dom_models_wifi_sta_connect_config_t;
 
 typedef struct {
@@ -164,6 +197,9 @@ typedef struct {
 
     bool     passive;
     uint32_t timeout_ms;
+
+    /* Only used by wifiman to accept a cached result, devices ignore it */
+    uint32_t max_age_ms;
 } dom_models_wifi_scan_config_t;
 
 typedef enum {
@@ -179,6 +215,9 @@ typedef enum {
     DOM_MODELS_WIFI_EVENT_STA_DISCONNECTED,
     DOM_MODELS_WIFI_EVENT_AP_STARTED,
     DOM_MODELS_WIFI_EVENT_AP_STOPPED,
+    DOM_MODELS_WIFI_EVENT_STA_GOT_IP,
+    DOM_MODELS_WIFI_EVENT_STA_LOST_IP,
+    DOM_MODELS_WIFI_EVENT_SCAN_DONE,
 } dom_models_wifi_event_type_t;
 
 typedef struct {
@@ -188,6 +227,10 @@ typedef struct {
 
 typedef void (*dom_models_wifi_event_callback_t)(void* cb_ctx, const dom_models_wifi_event_t* event);
 
+/*
+ * Total_count is what the driver found and count what the device kept, the
+ * records themselves are read in pages through get_scanned.
+ */
 typedef struct {
     dom_models_wifi_scan_status_t status;
     uint32_t                      scan_id;
@@ -195,7 +238,6 @@ typedef struct {
     size_t                        total_count;
     size_t                        count;
     bool                          truncated;
-    dom_models_wifi_ap_record_t   records[DOM_MODELS_WIFI_SCAN_RESULT_MAX];
 } dom_models_wifi_scan_result_t;
 
 typedef struct {
@@ -2,6 +2,7 @@
 #define DOMAIN_USECASES_OTA_H
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdlib.h>
 
 #include "domain/models/error.h"
@@ -13,8 +14,11 @@ extern "C" {
 
 typedef struct dom_usecases_ota_t dom_usecases_ota_t;
 
+/* Sizes are only meaningful while updating, total_size is 0 when unknown */
 typedef struct {
-    bool updating;
+    bool   updating;
+    size_t written_size;
+    size_t total_size;
 } dom_usecases_ota_status_t;
 
 struct dom_usecases_ota_t {
@@ -3,6 +3,7 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <stdlib.h>
 
 #include "domain/models/error.h"
@@ -13,6 +14,10 @@
 extern "C" {
 #endif
 
+#define DOM_USECASES_WIFIMAN_SCAN_RSSI_HISTORY_LEN 4
+#define DOM_USECASES_WIFIMAN_SCAN_PAGE_MAX         16
+#define DOM_USECASES_WIFIMAN_LINK_BSSID_MAX        4
+
 typedef struct dom_usecases_wifiman_t dom_usecases_wifiman_t;
 
 typedef struct {
@@ -20,6 +25,71 @@ typedef struct {
     char ssid[DOM_MODELS_WIFI_SSID_BUF_LEN];
 } dom_usecases_wifiman_stored_sta_t;
 
+/*
+ * A stored profile without its password. In_range and rssi come from the
+ * latest scan, the strongest BSSID of the profile SSID.
+ */
+typedef struct {
+    char     ssid[DOM_MODELS_WIFI_SSID_BUF_LEN];
+    uint8_t  priority;
+    uint32_t last_success_seq;
+    uint16_t failure_cnt;
+    bool     in_range;
+    int8_t   rssi;
+} dom_usecases_wifiman_sta_profile_t;
+
+/* Profiles in the order reconnects try them */
+typedef struct {
+    size_t                             count;
+    dom_usecases_wifiman_sta_profile_t profiles[DOM_MODELS_WIFI_STA_PROFILE_MAX];
+} dom_usecases_wifiman_sta_profiles_t;
+
+/*
+ * Link quality of one BSSID joined since boot, the average is the monitor
+ * EWMA. Weak_cnt counts the samples taken while the link was weak.
+ */
+typedef struct {
+    uint8_t  bssid[DOM_MODELS_WIFI_MAC_LEN];
+    uint8_t  channel;
+    uint32_t sample_cnt;
+    uint32_t weak_cnt;
+    int8_t   rssi_last;
+    int8_t   rssi_avg;
+    int8_t   rssi_min;
+    int8_t   rssi_max;
+} dom_usecases_wifiman_link_bssid_t;
+
+/* From_rssi is the link average that triggered the roam, to_rssi what the scan saw. At_ms stays zero without a clock */
+typedef struct {
+    bool    available;
+    bool    succeeded;
+    uint8_t from_bssid[DOM_MODELS_WIFI_MAC_LEN];
+    uint8_t to_bssid[DOM_MODELS_WIFI_MAC_LEN];
+    uint8_t channel;
+    int8_t  from_rssi;
+    int8_t  to_rssi;
+    int64_t at_ms;
+} dom_usecases_wifiman_roam_event_t;
+
+/*
+ * Link monitor view. Tracking is set while the STA link is sampled, the
+ * average and weak flag describe that link. BSSIDs are most recently
+ * sampled first, so the first one is the current AP while tracking.
+ */
+typedef struct {
+    bool                              tracking;
+    bool                              weak;
+    int8_t                            rssi_avg;
+    uint32_t                          sample_cnt;
+    uint32_t                          roam_scan_cnt;
+    uint32_t                          roam_attempt_cnt;
+    uint32_t                          roam_success_cnt;
+    uint32_t                          roam_failure_cnt;
+    dom_usecases_wifiman_roam_event_t last_roam;
+    size_t                            bssid_count;
+    dom_usecases_wifiman_link_bssid_t bssids[DOM_USECASES_WIFIMAN_LINK_BSSID_MAX];
+} dom_usecases_wifiman_link_t;
+
 typedef struct {
     dom_models_wifi_status_t              wifi;
     bool                                  sta_netif_available;
@@ -30,8 +100,58 @@ typedef struct {
     size_t                                reconnect_max_trials;
     bool                                  ap_auto_manage_enabled;
     bool                                  sta_connection_commit_required;
+    dom_usecases_wifiman_link_t           link;
 } dom_usecases_wifiman_status_t;
 
+/*
+ * Timestamps are uptime in ms and stay zero without a clock. The RSSI
+ * history is newest first, one sample per scan the record was seen in.
+ * When wifiman deduplicates by SSID an entry is a network and its record
+ * the strongest BSSID of the latest scan.
+ */
+typedef struct {
+    dom_models_wifi_ap_record_t record;
+    int64_t                     first_seen_ms;
+    int64_t                     last_seen_ms;
+    uint32_t                    seen_cnt;
+    uint8_t                     rssi_history_len;
+    int8_t                      rssi_history[DOM_USECASES_WIFIMAN_SCAN_RSSI_HISTORY_LEN];
+} dom_usecases_wifiman_scan_entry_t;
+
+typedef struct {
+    uint32_t started_cnt;
+    uint32_t coalesced_cnt;
+    uint32_t cached_cnt;
+} dom_usecases_wifiman_scan_stats_t;
+
+/* A zero limit, or one above DOM_USECASES_WIFIMAN_SCAN_PAGE_MAX, reads a full page */
+typedef struct {
+    size_t offset;
+    size_t limit;
+} dom_usecases_wifiman_scan_query_t;
+
+/*
+ * Status and driver fields describe the latest driver scan, entries are one
+ * page of the cache merged across scans with the same filters, strongest
+ * first. Entry_count is the size of the whole cache and truncated reports
+ * APs dropped by the device or the cache. Age is the time since the cache
+ * was last merged and is only available with a clock.
+ */
+typedef struct {
+    dom_models_wifi_scan_status_t     status;
+    uint32_t                          scan_id;
+    uint32_t                          driver_status;
+    bool                              age_available;
+    uint32_t                          age_ms;
+    size_t                            total_count;
+    bool                              truncated;
+    size_t                            entry_count;
+    size_t                            offset;
+    size_t                            count;
+    dom_usecases_wifiman_scan_stats_t stats;
+    dom_usecases_wifiman_scan_entry_t entries[DOM_USECASES_WIFIMAN_SCAN_PAGE_MAX];
+} dom_usecases_wifiman_scan_result_t;
+
 struct dom_usecases_wifiman_t {
     void* ctx;
     dom_models_error_t (*start)(
@@ -40,13 +160,19 @@ struct dom_usecases_wifiman_t {
     dom_models_error_t (*stop)(
         dom_usecases_wifiman_t* self
     );
+    /*
+     * Joins a running scan with the same filters and serves the cache when
+     * config->max_age_ms allows, so a request does not always start a scan.
+     */
     dom_models_error_t (*start_scan)(
         dom_usecases_wifiman_t*              self,
         const dom_models_wifi_scan_config_t* config
     );
+    /* A NULL query reads the first page */
     dom_models_error_t (*get_scan_result)(
-        dom_usecases_wifiman_t*        self,
-        dom_models_wifi_scan_result_t* out
+        dom_usecases_wifiman_t*                  self,
+        const dom_usecases_wifiman_scan_query_t* query,
+        dom_usecases_wifiman_scan_result_t*      out
     );
     dom_models_error_t (*get_status)(
         dom_usecases_wifiman_t*        self,
@@ -73,9 +199,24 @@ struct dom_usecases_wifiman_t {
         dom_usecases_wifiman_t*                  self,
         const dom_models_wifi_sta_credential_t* credential
     );
+    /* Forgets every profile */
     dom_models_error_t (*forget_sta_credential)(
         dom_usecases_wifiman_t* self
     );
+    dom_models_error_t (*get_sta_profiles)(
+        dom_usecases_wifiman_t*              self,
+        dom_usecases_wifiman_sta_profiles_t* out
+    );
+    /* Adds the profile or updates the one with the same SSID, BAD_STATE when the store is full */
+    dom_models_error_t (*set_sta_profile)(
+        dom_usecases_wifiman_t*                 self,
+        const dom_models_wifi_sta_credential_t* credential,
+        uint8_t                                 priority
+    );
+    dom_models_error_t (*delete_sta_profile)(
+        dom_usecases_wifiman_t* self,
+        const char*             ssid
+    );
     dom_models_error_t (*need_reconnect)(
         dom_usecases_wifiman_t* self,
         bool*                   out
@@ -84,6 +225,14 @@ struct dom_usecases_wifiman_t {
         dom_usecases_wifiman_t* self,
         bool*                   attempted
     );
+    /*
+     * Takes one link quality sample, meant to be called on a low rate timer.
+     * A link that stays weak gets a scan for its SSID and roams to a stronger
+     * BSSID when the scan found one.
+     */
+    dom_models_error_t (*monitor_link)(
+        dom_usecases_wifiman_t* self
+    );
 };
 
 static inline dom_usecases_wifiman_t* dom_usecases_wifiman_new(void* ctx) {
@@ -1,40 +1,66 @@
 #ifndef INFRASTRUCTURE_DEVICE_WIFI_ESP_WIFI_IMPL_TYPES_H
 #define INFRASTRUCTURE_DEVICE_WIFI_ESP_WIFI_IMPL_TYPES_H
 
+#include <stdatomic.h>
 #include <stdbool.h>
 #include <stddef.h>
 
 #include "domain/models/wifi.h"
 #include "esp_event_base.h"
+#include "freertos/FreeRTOS.h"  // IWYU pragma: keep
+#include "freertos/semphr.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/*
+ * Scan_record_max sizes the record pool allocated once at creation. Scans
+ * finding more APs keep the strongest ones and report truncated.
+ */
 typedef struct {
     const char* sta_if_key;
     const char* ap_if_key;
     bool        register_event_handler;
+    bool        register_ip_event_handler;
+    size_t      scan_record_max;
 } inf_device_wifi_esp_wifi_impl_cfg_t;
 
-#define INF_DEVICE_WIFI_ESP_WIFI_IMPL_EVENT_CALLBACK_MAX 4
+#define INF_DEVICE_WIFI_ESP_WIFI_IMPL_EVENT_CALLBACK_MAX   4
+#define INF_DEVICE_WIFI_ESP_WIFI_IMPL_STATUS_READ_ATTEMPTS 4
 
-#define INF_DEVICE_WIFI_ESP_WIFI_IMPL_CFG_DEFAULT() \
-    {                                               \
-        .sta_if_key             = "WIFI_STA_DEF",   \
-        .ap_if_key              = "WIFI_AP_DEF",    \
-        .register_event_handler = true,             \
+#define INF_DEVICE_WIFI_ESP_WIFI_IMPL_CFG_DEFAULT()                   \
+    {                                                                 \
+        .sta_if_key                = "WIFI_STA_DEF",                  \
+        .ap_if_key                 = "WIFI_AP_DEF",                   \
+        .register_event_handler    = true,                            \
+        .register_ip_event_handler = true,                            \
+        .scan_record_max           = DOM_MODELS_WIFI_SCAN_RECORD_MAX, \
     }
 
+/*
+ * Status is the snapshot served by get_status. Writers hold status_lock and
+ * keep status_seq odd while they change it, readers copy it without the lock
+ * and retry when the sequence moved under them. The scan result and its
+ * record pool are only touched under scan_lock.
+ */
 typedef struct {
     inf_device_wifi_esp_wifi_impl_cfg_t cfg;
     esp_event_handler_instance_t        wifi_event_handler;
+    esp_event_handler_instance_t        ip_got_event_handler;
+    esp_event_handler_instance_t        ip_lost_event_handler;
     bool                                initialized;
     bool                                wifi_event_handler_registered;
+    bool                                ip_got_event_handler_registered;
+    bool                                ip_lost_event_handler_registered;
     bool                                started;
-    bool                                sta_connected;
     bool                                ap_started;
+    SemaphoreHandle_t                   status_lock;
+    atomic_uint_least32_t               status_seq;
+    dom_models_wifi_status_t            status;
+    SemaphoreHandle_t                   scan_lock;
     dom_models_wifi_scan_result_t       scanned;
+    dom_models_wifi_ap_record_t*        scan_records;
     dom_models_wifi_event_callback_t    event_cb_funcs[INF_DEVICE_WIFI_ESP_WIFI_IMPL_EVENT_CALLBACK_MAX];
     void*                               event_cb_ctxs[INF_DEVICE_WIFI_ESP_WIFI_IMPL_EVENT_CALLBACK_MAX];
     size_t                              event_cb_cnt;
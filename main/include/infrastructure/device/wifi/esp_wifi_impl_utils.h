@@ -37,6 +37,14 @@ esp_err_t                        inf_device_wifi_esp_wifi_impl_ensure_sta_mode(v
 esp_err_t                        inf_device_wifi_esp_wifi_impl_ensure_ap_mode(void);
 void                             inf_device_wifi_esp_wifi_impl_clear_scan_records(dom_models_wifi_scan_result_t* out);
 void                             inf_device_wifi_esp_wifi_impl_load_scan_records(inf_device_wifi_esp_wifi_impl_ctx_t* ctx);
+esp_err_t                        inf_device_wifi_esp_wifi_impl_read_driver_status(const inf_device_wifi_esp_wifi_impl_ctx_t* ctx, dom_models_wifi_status_t* out);
+void                             inf_device_wifi_esp_wifi_impl_status_write_begin(inf_device_wifi_esp_wifi_impl_ctx_t* ctx);
+void                             inf_device_wifi_esp_wifi_impl_status_write_end(inf_device_wifi_esp_wifi_impl_ctx_t* ctx);
+void                             inf_device_wifi_esp_wifi_impl_status_read(inf_device_wifi_esp_wifi_impl_ctx_t* ctx, dom_models_wifi_status_t* out);
+void                             inf_device_wifi_esp_wifi_impl_clear_sta_link(dom_models_wifi_status_t* status);
+void                             inf_device_wifi_esp_wifi_impl_clear_ap_clients(dom_models_wifi_status_t* status);
+void                             inf_device_wifi_esp_wifi_impl_add_ap_client(dom_models_wifi_status_t* status, const uint8_t* mac);
+void                             inf_device_wifi_esp_wifi_impl_remove_ap_client(dom_models_wifi_status_t* status, const uint8_t* mac);
 
 #ifdef __cplusplus
 }
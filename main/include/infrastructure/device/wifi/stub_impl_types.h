@@ -34,6 +34,7 @@ typedef struct {
     dom_models_wifi_mode_t          mode;
     dom_models_wifi_ap_record_t     connected_ap;
     dom_models_wifi_scan_result_t   scanned;
+    dom_models_wifi_ap_record_t     scan_record;
     dom_models_wifi_event_callback_t event_cb_funcs[INF_DEVICE_WIFI_STUB_IMPL_EVENT_CALLBACK_MAX];
     void*                           event_cb_ctxs[INF_DEVICE_WIFI_STUB_IMPL_EVENT_CALLBACK_MAX];
     size_t                          event_cb_cnt;
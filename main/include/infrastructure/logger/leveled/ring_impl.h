@@ -0,0 +1,27 @@
+#ifndef INFRASTRUCTURE_LOGGER_LEVELED_RING_IMPL_H
+#define INFRASTRUCTURE_LOGGER_LEVELED_RING_IMPL_H
+
+#include <stddef.h>
+
+#include "domain/contracts/logger/leveled.h"
+#include "domain/models/error.h"
+#include "infrastructure/logger/leveled/ring_impl_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+dom_contracts_logger_leveled_t* inf_logger_leveled_ring_impl_new(const inf_logger_leveled_ring_impl_cfg_t* cfg);
+
+void inf_logger_leveled_ring_impl_delete(dom_contracts_logger_leveled_t* self);
+
+dom_models_error_t inf_logger_leveled_ring_impl_get_stats(
+    dom_contracts_logger_leveled_t*       self,
+    inf_logger_leveled_ring_impl_stats_t* out
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INFRASTRUCTURE_LOGGER_LEVELED_RING_IMPL_H */
@@ -0,0 +1,91 @@
+#ifndef INFRASTRUCTURE_LOGGER_LEVELED_RING_IMPL_TYPES_H
+#define INFRASTRUCTURE_LOGGER_LEVELED_RING_IMPL_TYPES_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "domain/contracts/logger/leveled.h"
+#include "domain/models/logger.h"
+#include "freertos/FreeRTOS.h"  // IWYU pragma: keep
+#include "freertos/task.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define INF_LOGGER_LEVELED_RING_IMPL_DEFAULT_SLOT_CNT         32
+#define INF_LOGGER_LEVELED_RING_IMPL_DEFAULT_MSG_MAX_LEN      256
+#define INF_LOGGER_LEVELED_RING_IMPL_DEFAULT_TASK_NAME        "logger_ring"
+#define INF_LOGGER_LEVELED_RING_IMPL_DEFAULT_TASK_STACK_SIZE  4096
+#define INF_LOGGER_LEVELED_RING_IMPL_DEFAULT_TASK_PRIORITY    1
+#define INF_LOGGER_LEVELED_RING_IMPL_DEFAULT_STOP_TIMEOUT_MS  100
+
+typedef struct {
+    dom_models_logger_level_t level;
+    unsigned int              cb_max_cnt;
+    size_t                    slot_cnt;
+    size_t                    msg_max_len;
+    const char*               task_name;
+    uint32_t                  task_stack_size;
+    UBaseType_t               task_priority;
+    bool                      deferred_format;
+} inf_logger_leveled_ring_impl_cfg_t;
+
+#define INF_LOGGER_LEVELED_RING_IMPL_CFG_DEFAULT()                               \
+    {                                                                            \
+        .level           = DOMAIN_MODELS_LOGGER_LEVEL_INFO,                      \
+        .cb_max_cnt      = 0,                                                    \
+        .slot_cnt        = INF_LOGGER_LEVELED_RING_IMPL_DEFAULT_SLOT_CNT,        \
+        .msg_max_len     = INF_LOGGER_LEVELED_RING_IMPL_DEFAULT_MSG_MAX_LEN,     \
+        .task_name       = INF_LOGGER_LEVELED_RING_IMPL_DEFAULT_TASK_NAME,       \
+        .task_stack_size = INF_LOGGER_LEVELED_RING_IMPL_DEFAULT_TASK_STACK_SIZE, \
+        .task_priority   = INF_LOGGER_LEVELED_RING_IMPL_DEFAULT_TASK_PRIORITY,   \
+        .deferred_format = false,                                                \
+    }
+
+typedef struct {
+    size_t   slot_cnt;
+    size_t   pending_cnt;
+    size_t   high_water_cnt;
+    uint32_t written_cnt;
+    uint32_t dropped_cnt;
+} inf_logger_leveled_ring_impl_stats_t;
+
+typedef struct {
+    atomic_size_t             seq;
+    dom_models_logger_level_t level;
+    bool                      deferred;
+    const char*               tag;
+    const char*               format;
+    int64_t                   timestamp_us;
+    size_t                    msg_len;
+    char*                     msg;
+} inf_logger_leveled_ring_impl_slot_t;
+
+typedef struct {
+    inf_logger_leveled_ring_impl_cfg_t     cfg;
+    inf_logger_leveled_ring_impl_slot_t*   slots;
+    char*                                  msg_pool;
+    char*                                  drain_buf;
+    size_t                                 slot_mask;
+    atomic_size_t                          enqueue_pos;
+    atomic_size_t                          dequeue_pos;
+    atomic_size_t                          high_water_cnt;
+    atomic_uint_least32_t                  written_cnt;
+    atomic_uint_least32_t                  dropped_cnt;
+    TaskHandle_t                           task_handle;
+    volatile bool                          stop_requested;
+    dom_contracts_logger_leveled_cb*       cb_funcs;
+    void**                                 cb_ctxs;
+    unsigned int                           cb_idx;
+    dom_contracts_logger_leveled_record_cb record_cb_func;
+    void*                                  record_cb_ctx;
+} inf_logger_leveled_ring_impl_ctx_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INFRASTRUCTURE_LOGGER_LEVELED_RING_IMPL_TYPES_H */
@@ -0,0 +1,86 @@
+#ifndef INFRASTRUCTURE_LOGGER_LEVELED_RING_IMPL_UTILS_H
+#define INFRASTRUCTURE_LOGGER_LEVELED_RING_IMPL_UTILS_H
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/time.h>
+
+#include "domain/models/logger.h"
+#include "infrastructure/logger/leveled/ring_impl_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void inf_logger_leveled_ring_impl_normalize_cfg(
+    inf_logger_leveled_ring_impl_cfg_t*       out,
+    const inf_logger_leveled_ring_impl_cfg_t* cfg
+);
+
+size_t inf_logger_leveled_ring_impl_format(
+    char*                     buf,
+    size_t                    buf_size,
+    dom_models_logger_level_t level,
+    const char*               tag,
+    const char*               format,
+    va_list                   args
+);
+
+size_t inf_logger_leveled_ring_impl_format_prefix(
+    char*                     buf,
+    size_t                    buf_size,
+    const struct timeval*     tv,
+    dom_models_logger_level_t level,
+    const char*               tag
+);
+
+size_t inf_logger_leveled_ring_impl_encode_args(
+    uint8_t*    buf,
+    size_t      buf_size,
+    const char* format,
+    va_list     args
+);
+
+size_t inf_logger_leveled_ring_impl_decode_args(
+    char*          buf,
+    size_t         buf_size,
+    const char*    format,
+    const uint8_t* args,
+    size_t         args_len
+);
+
+size_t inf_logger_leveled_ring_impl_decode_record(
+    char*                             buf,
+    size_t                            buf_size,
+    const dom_models_logger_record_t* record
+);
+
+inf_logger_leveled_ring_impl_slot_t* inf_logger_leveled_ring_impl_reserve(
+    inf_logger_leveled_ring_impl_ctx_t* ctx,
+    size_t*                             pos
+);
+
+void inf_logger_leveled_ring_impl_commit(
+    inf_logger_leveled_ring_impl_ctx_t*  ctx,
+    inf_logger_leveled_ring_impl_slot_t* slot,
+    size_t                               pos
+);
+
+inf_logger_leveled_ring_impl_slot_t* inf_logger_leveled_ring_impl_peek(
+    inf_logger_leveled_ring_impl_ctx_t* ctx,
+    size_t*                             pos
+);
+
+void inf_logger_leveled_ring_impl_release(
+    inf_logger_leveled_ring_impl_ctx_t*  ctx,
+    inf_logger_leveled_ring_impl_slot_t* slot,
+    size_t                               pos
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INFRASTRUCTURE_LOGGER_LEVELED_RING_IMPL_UTILS_H */
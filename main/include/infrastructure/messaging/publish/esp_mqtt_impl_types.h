@@ -3,12 +3,56 @@
 
 #include <stdbool.h>
 
+#include "domain/models/messaging.h"
+#include "domain/models/system.h"
 #include "mqtt_client.h"
+#include "utils/json/writer.h"
+#include "utils/mqtt/topic_table.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/* Keys, quotes, separators, literals and the NUL of the largest payload */
+#define INF_MESSAGING_PUBLISH_ESP_MQTT_IMPL_JSON_OVERHEAD 128
+
+/*
+ * Payloads are serialized on the stack. Each buffer holds its payload with
+ * every string byte escaped to the longest form, so a valid model is never
+ * rejected for size.
+ */
+#define INF_MESSAGING_PUBLISH_ESP_MQTT_IMPL_JSON_MAX_LEN \
+    (UTILS_JSON_WRITER_ESCAPE_MAX_LEN * DOM_MODELS_MESSAGING_LOG_MAX_LEN + INF_MESSAGING_PUBLISH_ESP_MQTT_IMPL_JSON_OVERHEAD)
+#define INF_MESSAGING_PUBLISH_ESP_MQTT_IMPL_REGISTRATION_JSON_MAX_LEN \
+    (UTILS_JSON_WRITER_ESCAPE_MAX_LEN * (DOM_MODELS_SYSTEM_HARDWARE_MAC_MAX_LEN + \
+                                         DOM_MODELS_MESSAGING_NAME_MAX_LEN + \
+                                         DOM_MODELS_MESSAGING_TYPE_MAX_LEN + \
+                                         DOM_MODELS_SYSTEM_FIRMWARE_VERSION_MAX_LEN + \
+                                         DOM_MODELS_MESSAGING_SESSION_KEY_MAX_LEN + \
+                                         DOM_MODELS_MESSAGING_SIGNATURE_MAX_LEN) + \
+     INF_MESSAGING_PUBLISH_ESP_MQTT_IMPL_JSON_OVERHEAD)
+
+_Static_assert(
+    INF_MESSAGING_PUBLISH_ESP_MQTT_IMPL_JSON_MAX_LEN >=
+        UTILS_JSON_WRITER_ESCAPE_MAX_LEN * (DOM_MODELS_MESSAGING_STATUS_MAX_LEN + DOM_MODELS_MESSAGING_IP_MAX_LEN) +
+            INF_MESSAGING_PUBLISH_ESP_MQTT_IMPL_JSON_OVERHEAD,
+    "status JSON does not fit the payload buffer when fully escaped"
+);
+_Static_assert(
+    INF_MESSAGING_PUBLISH_ESP_MQTT_IMPL_JSON_MAX_LEN >=
+        UTILS_JSON_WRITER_ESCAPE_MAX_LEN * DOM_MODELS_MESSAGING_LOG_MAX_LEN + INF_MESSAGING_PUBLISH_ESP_MQTT_IMPL_JSON_OVERHEAD,
+    "log JSON does not fit the payload buffer when fully escaped"
+);
+
+/* Device topics interned at construction, in this order */
+typedef enum {
+    INF_MESSAGING_PUBLISH_ESP_MQTT_IMPL_TOPIC_STATUS = 0,
+    INF_MESSAGING_PUBLISH_ESP_MQTT_IMPL_TOPIC_LOG,
+    INF_MESSAGING_PUBLISH_ESP_MQTT_IMPL_TOPIC_LOG_BATCH,
+    INF_MESSAGING_PUBLISH_ESP_MQTT_IMPL_TOPIC_LOG_BATCH_BINARY,
+    INF_MESSAGING_PUBLISH_ESP_MQTT_IMPL_TOPIC_CNT,
+} inf_messaging_publish_esp_mqtt_impl_topic_t;
+
 typedef struct {
     esp_mqtt_client_handle_t mqtt_client;
     const char*              device_id_str;
@@ -30,6 +74,7 @@ typedef struct {
 
 typedef struct {
     inf_messaging_publish_esp_mqtt_impl_cfg_t cfg;
+    utils_mqtt_topic_table_t                  topics;
     bool                                      connected;
 } inf_messaging_publish_esp_mqtt_impl_ctx_t;
 
@@ -16,11 +16,13 @@ dom_models_error_t inf_messaging_publish_esp_mqtt_impl_validate_cfg(
     const inf_messaging_publish_esp_mqtt_impl_cfg_t* cfg
 );
 
-dom_models_error_t inf_messaging_publish_esp_mqtt_impl_build_device_topic(
+dom_models_error_t inf_messaging_publish_esp_mqtt_impl_init_topics(
+    inf_messaging_publish_esp_mqtt_impl_ctx_t* ctx
+);
+
+const char* inf_messaging_publish_esp_mqtt_impl_device_topic(
     const inf_messaging_publish_esp_mqtt_impl_ctx_t* ctx,
-    const char*                                      suffix,
-    char*                                            out,
-    size_t                                           out_size
+    inf_messaging_publish_esp_mqtt_impl_topic_t      topic
 );
 
 bool inf_messaging_publish_esp_mqtt_impl_registration_valid(
@@ -35,22 +37,33 @@ bool inf_messaging_publish_esp_mqtt_impl_log_valid(
     const dom_models_messaging_log_t* log
 );
 
-char* inf_messaging_publish_esp_mqtt_impl_build_registration_json(
-    const dom_models_messaging_registration_t* registration
+bool inf_messaging_publish_esp_mqtt_impl_log_batch_valid(
+    const dom_models_messaging_log_batch_t* batch
 );
 
-char* inf_messaging_publish_esp_mqtt_impl_build_status_json(
-    const dom_models_messaging_status_t* status
+size_t inf_messaging_publish_esp_mqtt_impl_build_registration_json(
+    const dom_models_messaging_registration_t* registration,
+    char*                                      out,
+    size_t                                     out_size
 );
 
-char* inf_messaging_publish_esp_mqtt_impl_build_log_json(
-    const dom_models_messaging_log_t* log
+size_t inf_messaging_publish_esp_mqtt_impl_build_status_json(
+    const dom_models_messaging_status_t* status,
+    char*                                out,
+    size_t                               out_size
+);
+
+size_t inf_messaging_publish_esp_mqtt_impl_build_log_json(
+    const dom_models_messaging_log_t* log,
+    char*                             out,
+    size_t                            out_size
 );
 
-dom_models_error_t inf_messaging_publish_esp_mqtt_impl_publish_json(
+dom_models_error_t inf_messaging_publish_esp_mqtt_impl_publish_payload(
     const inf_messaging_publish_esp_mqtt_impl_ctx_t* ctx,
     const char*                                      topic,
-    char*                                            json,
+    const char*                                      payload,
+    size_t                                           payload_len,
     bool                                             retained
 );
 
@@ -0,0 +1,29 @@
+#ifndef INFRASTRUCTURE_MESSAGING_PUBLISH_OUTBOX_IMPL_H
+#define INFRASTRUCTURE_MESSAGING_PUBLISH_OUTBOX_IMPL_H
+
+#include "domain/contracts/messaging/publish.h"
+#include "domain/models/error.h"
+#include "infrastructure/messaging/publish/outbox_impl_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+dom_contracts_messaging_publish_t* inf_messaging_publish_outbox_impl_new(
+    const inf_messaging_publish_outbox_impl_cfg_t* cfg
+);
+
+void inf_messaging_publish_outbox_impl_delete(dom_contracts_messaging_publish_t* self);
+
+dom_models_error_t inf_messaging_publish_outbox_impl_replay_now(dom_contracts_messaging_publish_t* self);
+
+dom_models_error_t inf_messaging_publish_outbox_impl_get_stats(
+    dom_contracts_messaging_publish_t*         self,
+    inf_messaging_publish_outbox_impl_stats_t* out
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INFRASTRUCTURE_MESSAGING_PUBLISH_OUTBOX_IMPL_H */
@@ -0,0 +1,126 @@
+#ifndef INFRASTRUCTURE_MESSAGING_PUBLISH_OUTBOX_IMPL_TYPES_H
+#define INFRASTRUCTURE_MESSAGING_PUBLISH_OUTBOX_IMPL_TYPES_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "domain/contracts/messaging/publish.h"
+#include "freertos/FreeRTOS.h"  // IWYU pragma: keep
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define INF_MESSAGING_PUBLISH_OUTBOX_IMPL_DEFAULT_DIR_PATH           "/littlefs/outbox"
+#define INF_MESSAGING_PUBLISH_OUTBOX_IMPL_DEFAULT_SEGMENT_MAX_BYTES  16384
+#define INF_MESSAGING_PUBLISH_OUTBOX_IMPL_DEFAULT_SEGMENT_MAX_CNT    16
+#define INF_MESSAGING_PUBLISH_OUTBOX_IMPL_DEFAULT_RECORD_MAX_LEN     2560
+#define INF_MESSAGING_PUBLISH_OUTBOX_IMPL_DEFAULT_REPLAY_INTERVAL_MS 250
+#define INF_MESSAGING_PUBLISH_OUTBOX_IMPL_DEFAULT_REPLAY_BURST_CNT   4
+#define INF_MESSAGING_PUBLISH_OUTBOX_IMPL_DEFAULT_TASK_NAME          "publish_outbox"
+#define INF_MESSAGING_PUBLISH_OUTBOX_IMPL_DEFAULT_TASK_STACK_SIZE    4096
+#define INF_MESSAGING_PUBLISH_OUTBOX_IMPL_DEFAULT_TASK_PRIORITY      2
+#define INF_MESSAGING_PUBLISH_OUTBOX_IMPL_STOP_TIMEOUT_MS            500
+#define INF_MESSAGING_PUBLISH_OUTBOX_IMPL_PATH_MAX_LEN               96
+#define INF_MESSAGING_PUBLISH_OUTBOX_IMPL_CURSOR_NAME                "cursor"
+
+/*
+ * Registration and status records hold the raw model structs, so the low
+ * byte of each magic carries the format. Bump it whenever a stored struct
+ * changes layout, records of another format are dropped like corrupt ones.
+ */
+#define INF_MESSAGING_PUBLISH_OUTBOX_IMPL_FORMAT       1
+#define INF_MESSAGING_PUBLISH_OUTBOX_IMPL_RECORD_MAGIC ((uint16_t)(0x4F00 | INF_MESSAGING_PUBLISH_OUTBOX_IMPL_FORMAT))
+#define INF_MESSAGING_PUBLISH_OUTBOX_IMPL_CURSOR_MAGIC ((uint16_t)(0x4300 | INF_MESSAGING_PUBLISH_OUTBOX_IMPL_FORMAT))
+
+typedef enum {
+    INF_MESSAGING_PUBLISH_OUTBOX_IMPL_KIND_REGISTRATION = 1,
+    INF_MESSAGING_PUBLISH_OUTBOX_IMPL_KIND_STATUS,
+    INF_MESSAGING_PUBLISH_OUTBOX_IMPL_KIND_LOG,
+    INF_MESSAGING_PUBLISH_OUTBOX_IMPL_KIND_LOG_BATCH,
+    INF_MESSAGING_PUBLISH_OUTBOX_IMPL_KIND_LOG_BATCH_BINARY,
+} inf_messaging_publish_outbox_impl_kind_t;
+
+typedef struct {
+    dom_contracts_messaging_publish_t* inner;
+    const char*                        dir_path;
+    size_t                             segment_max_bytes;
+    size_t                             segment_max_cnt;
+    size_t                             record_max_len;
+    uint32_t                           replay_interval_ms;
+    size_t                             replay_burst_cnt;
+    const char*                        task_name;
+    uint32_t                           task_stack_size;
+    UBaseType_t                        task_priority;
+} inf_messaging_publish_outbox_impl_cfg_t;
+
+#define INF_MESSAGING_PUBLISH_OUTBOX_IMPL_CFG_DEFAULT()                                     \
+    {                                                                                       \
+        .inner              = NULL,                                                         \
+        .dir_path           = INF_MESSAGING_PUBLISH_OUTBOX_IMPL_DEFAULT_DIR_PATH,           \
+        .segment_max_bytes  = INF_MESSAGING_PUBLISH_OUTBOX_IMPL_DEFAULT_SEGMENT_MAX_BYTES,  \
+        .segment_max_cnt    = INF_MESSAGING_PUBLISH_OUTBOX_IMPL_DEFAULT_SEGMENT_MAX_CNT,    \
+        .record_max_len     = INF_MESSAGING_PUBLISH_OUTBOX_IMPL_DEFAULT_RECORD_MAX_LEN,     \
+        .replay_interval_ms = INF_MESSAGING_PUBLISH_OUTBOX_IMPL_DEFAULT_REPLAY_INTERVAL_MS, \
+        .replay_burst_cnt   = INF_MESSAGING_PUBLISH_OUTBOX_IMPL_DEFAULT_REPLAY_BURST_CNT,   \
+        .task_name          = INF_MESSAGING_PUBLISH_OUTBOX_IMPL_DEFAULT_TASK_NAME,          \
+        .task_stack_size    = INF_MESSAGING_PUBLISH_OUTBOX_IMPL_DEFAULT_TASK_STACK_SIZE,    \
+        .task_priority      = INF_MESSAGING_PUBLISH_OUTBOX_IMPL_DEFAULT_TASK_PRIORITY,      \
+    }
+
+typedef struct {
+    size_t   pending_segment_cnt;
+    uint32_t stored_cnt;
+    uint32_t replayed_cnt;
+    uint32_t evicted_segment_cnt;
+    uint32_t write_failed_cnt;
+} inf_messaging_publish_outbox_impl_stats_t;
+
+typedef struct {
+    uint16_t magic;
+    uint8_t  kind;
+    uint8_t  reserved;
+    uint32_t len;
+} inf_messaging_publish_outbox_impl_record_header_t;
+
+/* Replay position persisted after every burst */
+typedef struct {
+    uint16_t magic;
+    uint16_t reserved;
+    uint32_t seq;
+    uint32_t offset;
+} inf_messaging_publish_outbox_impl_cursor_t;
+
+/*
+ * Segments are files named by a monotonically increasing sequence number
+ * that is never reused while the outbox holds data. Records are appended
+ * to the tail segment and replayed from head_offset in the head segment.
+ * The head position is saved to the cursor file once per replay burst, so
+ * a reboot replays at most the last burst again.
+ */
+typedef struct {
+    inf_messaging_publish_outbox_impl_cfg_t cfg;
+    SemaphoreHandle_t                       lock;
+    uint8_t*                                record_buf;
+    uint32_t                                head_seq;
+    uint32_t                                tail_seq;
+    size_t                                  head_offset;
+    size_t                                  tail_size;
+    uint32_t                                cursor_seq;
+    size_t                                  cursor_offset;
+    uint32_t                                stored_cnt;
+    uint32_t                                replayed_cnt;
+    uint32_t                                evicted_segment_cnt;
+    uint32_t                                write_failed_cnt;
+    TaskHandle_t                            task_handle;
+    volatile bool                           stop_requested;
+} inf_messaging_publish_outbox_impl_ctx_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INFRASTRUCTURE_MESSAGING_PUBLISH_OUTBOX_IMPL_TYPES_H */
@@ -0,0 +1,60 @@
+#ifndef INFRASTRUCTURE_MESSAGING_PUBLISH_OUTBOX_IMPL_UTILS_H
+#define INFRASTRUCTURE_MESSAGING_PUBLISH_OUTBOX_IMPL_UTILS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "domain/models/error.h"
+#include "infrastructure/messaging/publish/outbox_impl_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+dom_models_error_t inf_messaging_publish_outbox_impl_validate_cfg(
+    const inf_messaging_publish_outbox_impl_cfg_t* cfg
+);
+
+void inf_messaging_publish_outbox_impl_normalize_cfg(
+    inf_messaging_publish_outbox_impl_cfg_t*       out,
+    const inf_messaging_publish_outbox_impl_cfg_t* cfg
+);
+
+dom_models_error_t inf_messaging_publish_outbox_impl_open_dir(
+    inf_messaging_publish_outbox_impl_ctx_t* ctx
+);
+
+bool inf_messaging_publish_outbox_impl_pending(
+    const inf_messaging_publish_outbox_impl_ctx_t* ctx
+);
+
+dom_models_error_t inf_messaging_publish_outbox_impl_append(
+    inf_messaging_publish_outbox_impl_ctx_t* ctx,
+    uint8_t                                  kind,
+    const void*                              head,
+    size_t                                   head_len,
+    const void*                              body,
+    size_t                                   body_len
+);
+
+dom_models_error_t inf_messaging_publish_outbox_impl_read(
+    inf_messaging_publish_outbox_impl_ctx_t*           ctx,
+    inf_messaging_publish_outbox_impl_record_header_t* out_header
+);
+
+void inf_messaging_publish_outbox_impl_advance(
+    inf_messaging_publish_outbox_impl_ctx_t*                 ctx,
+    const inf_messaging_publish_outbox_impl_record_header_t* header
+);
+
+/* Persists the head position when it moved since the last save */
+void inf_messaging_publish_outbox_impl_save_cursor(
+    inf_messaging_publish_outbox_impl_ctx_t* ctx
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INFRASTRUCTURE_MESSAGING_PUBLISH_OUTBOX_IMPL_UTILS_H */
@@ -10,6 +10,8 @@
 extern "C" {
 #endif
 
+#define INF_MESSAGING_PUBLISH_STUB_IMPL_LOG_BATCH_MAX_LEN 2048
+
 typedef struct {
     bool                                registration_available;
     bool                                status_available;
@@ -32,12 +34,19 @@ typedef struct {
     bool                                registration_available;
     bool                                status_available;
     bool                                log_available;
+    bool                                log_batch_available;
     dom_models_messaging_registration_t registration;
     dom_models_messaging_status_t       status;
     dom_models_messaging_log_t          log;
+    char                                log_batch[INF_MESSAGING_PUBLISH_STUB_IMPL_LOG_BATCH_MAX_LEN];
+    size_t                              log_batch_len;
+    size_t                              log_batch_record_cnt;
+    bool                                log_batch_binary;
     size_t                              registration_publish_cnt;
     size_t                              status_publish_cnt;
     size_t                              log_publish_cnt;
+    size_t                              log_batch_publish_cnt;
+    size_t                              log_batch_record_total_cnt;
     bool                                connected;
 } inf_messaging_publish_stub_impl_ctx_t;
 
@@ -29,6 +29,11 @@ dom_models_error_t inf_messaging_publish_stub_impl_set_log(
     const dom_models_messaging_log_t*      log
 );
 
+dom_models_error_t inf_messaging_publish_stub_impl_set_log_batch(
+    inf_messaging_publish_stub_impl_ctx_t*  ctx,
+    const dom_models_messaging_log_batch_t* batch
+);
+
 #ifdef __cplusplus
 }
 #endif
@@ -2,11 +2,20 @@
 #define INFRASTRUCTURE_MESSAGING_SUBSCRIBE_ESP_MQTT_IMPL_TYPES_H
 
 #include "mqtt_client.h"
+#include "utils/mqtt/topic_table.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/* Device topics interned at construction, in this order */
+typedef enum {
+    INF_MESSAGING_SUBSCRIBE_ESP_MQTT_IMPL_TOPIC_REGISTRATION_ACK = 0,
+    INF_MESSAGING_SUBSCRIBE_ESP_MQTT_IMPL_TOPIC_UPDATE,
+    INF_MESSAGING_SUBSCRIBE_ESP_MQTT_IMPL_TOPIC_RESTART,
+    INF_MESSAGING_SUBSCRIBE_ESP_MQTT_IMPL_TOPIC_CNT,
+} inf_messaging_subscribe_esp_mqtt_impl_topic_t;
+
 typedef struct {
     esp_mqtt_client_handle_t mqtt_client;
     const char*              device_id_str;
@@ -22,6 +31,7 @@ typedef struct {
 
 typedef struct {
     inf_messaging_subscribe_esp_mqtt_impl_cfg_t cfg;
+    utils_mqtt_topic_table_t                    topics;
 } inf_messaging_subscribe_esp_mqtt_impl_ctx_t;
 
 #ifdef __cplusplus
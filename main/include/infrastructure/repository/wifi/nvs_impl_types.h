@@ -1,12 +1,59 @@
 #ifndef INFRASTRUCTURE_REPOSITORY_WIFI_NVS_IMPL_TYPES_H
 #define INFRASTRUCTURE_REPOSITORY_WIFI_NVS_IMPL_TYPES_H
 
+#include <stdint.h>
+
+#include "domain/models/wifi.h"
 #include "nvs.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/*
+ * The profile store blob is a header followed by count records. The record
+ * layout is pinned here instead of dumping the model struct, bump the
+ * version whenever it changes and keep a read path for the one before.
+ * Blobs written before the header existed hold the raw
+ * dom_models_wifi_sta_profiles_t and are read as version 0, their leading
+ * count is never above DOM_MODELS_WIFI_STA_PROFILE_MAX so it cannot pass
+ * for the magic.
+ */
+#define INF_REPOSITORY_WIFI_NVS_IMPL_PROFILES_MAGIC    0x57535450u
+#define INF_REPOSITORY_WIFI_NVS_IMPL_PROFILES_VERSION  1
+#define INF_REPOSITORY_WIFI_NVS_IMPL_PROFILE_SSID_LEN  33
+#define INF_REPOSITORY_WIFI_NVS_IMPL_PROFILE_PASS_LEN  65
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count;
+    uint32_t success_seq;
+} inf_repository_wifi_nvs_impl_profiles_header_t;
+
+typedef struct {
+    uint32_t last_success_seq;
+    uint16_t failure_cnt;
+    uint8_t  priority;
+    uint8_t  reserved;
+    char     ssid[INF_REPOSITORY_WIFI_NVS_IMPL_PROFILE_SSID_LEN];
+    char     password[INF_REPOSITORY_WIFI_NVS_IMPL_PROFILE_PASS_LEN];
+    uint8_t  padding[2];
+} inf_repository_wifi_nvs_impl_profile_record_t;
+
+#define INF_REPOSITORY_WIFI_NVS_IMPL_PROFILES_MAX_LEN \
+    (sizeof(inf_repository_wifi_nvs_impl_profiles_header_t) + DOM_MODELS_WIFI_STA_PROFILE_MAX * sizeof(inf_repository_wifi_nvs_impl_profile_record_t))
+
+_Static_assert(
+    sizeof(inf_repository_wifi_nvs_impl_profiles_header_t) == 12 && sizeof(inf_repository_wifi_nvs_impl_profile_record_t) == 108,
+    "stored profile layout changed, bump INF_REPOSITORY_WIFI_NVS_IMPL_PROFILES_VERSION"
+);
+_Static_assert(
+    DOM_MODELS_WIFI_SSID_BUF_LEN == INF_REPOSITORY_WIFI_NVS_IMPL_PROFILE_SSID_LEN &&
+        DOM_MODELS_WIFI_PASSWORD_BUF_LEN == INF_REPOSITORY_WIFI_NVS_IMPL_PROFILE_PASS_LEN,
+    "credential lengths changed, bump INF_REPOSITORY_WIFI_NVS_IMPL_PROFILES_VERSION"
+);
+
 typedef struct {
     nvs_handle_t nvs;
 } inf_repository_wifi_nvs_impl_cfg_t;
@@ -16,10 +16,16 @@ dom_models_error_t inf_repository_wifi_nvs_impl_error_from_esp(esp_err_t err);
 
 dom_models_error_t inf_repository_wifi_nvs_impl_read_string(nvs_handle_t nvs, const char* key, char* out, size_t out_size);
 
-dom_models_error_t inf_repository_wifi_nvs_impl_set_credential(nvs_handle_t nvs, const dom_models_wifi_sta_credential_t* credential);
+dom_models_error_t inf_repository_wifi_nvs_impl_read_profiles(nvs_handle_t nvs, dom_models_wifi_sta_profiles_t* out);
+
+dom_models_error_t inf_repository_wifi_nvs_impl_set_profiles(nvs_handle_t nvs, const dom_models_wifi_sta_profiles_t* profiles);
 
 dom_models_error_t inf_repository_wifi_nvs_impl_clear_credential(nvs_handle_t nvs);
 
+dom_models_error_t inf_repository_wifi_nvs_impl_read_last_ap(nvs_handle_t nvs, dom_models_wifi_sta_last_ap_t* out);
+
+dom_models_error_t inf_repository_wifi_nvs_impl_set_last_ap(nvs_handle_t nvs, const dom_models_wifi_sta_last_ap_t* last_ap);
+
 #ifdef __cplusplus
 }
 #endif
@@ -19,9 +19,12 @@ typedef struct {
         .credential_available = false,              \
     }
 
+/* A configured credential seeds the store as its only profile */
 typedef struct {
-    bool                              credential_available;
-    dom_models_wifi_sta_credential_t credential;
+    bool                           profiles_available;
+    dom_models_wifi_sta_profiles_t profiles;
+    bool                           last_ap_available;
+    dom_models_wifi_sta_last_ap_t  last_ap;
 } inf_repository_wifi_stub_impl_ctx_t;
 
 #ifdef __cplusplus
@@ -11,9 +11,14 @@ extern "C" {
 
 dom_models_error_t inf_repository_wifi_stub_impl_validate_credential(const dom_models_wifi_sta_credential_t* credential);
 
-dom_models_error_t inf_repository_wifi_stub_impl_set_credential(
+dom_models_error_t inf_repository_wifi_stub_impl_set_profiles(
     inf_repository_wifi_stub_impl_ctx_t* ctx,
-    const dom_models_wifi_sta_credential_t* credential
+    const dom_models_wifi_sta_profiles_t* profiles
+);
+
+dom_models_error_t inf_repository_wifi_stub_impl_set_last_ap(
+    inf_repository_wifi_stub_impl_ctx_t* ctx,
+    const dom_models_wifi_sta_last_ap_t* last_ap
 );
 
 dom_models_error_t inf_repository_wifi_stub_impl_load_cfg(
@@ -0,0 +1,19 @@
+#ifndef INFRASTRUCTURE_SYSTEM_CLOCK_ESP_IMPL_H
+#define INFRASTRUCTURE_SYSTEM_CLOCK_ESP_IMPL_H
+
+#include "domain/contracts/system/clock.h"
+#include "infrastructure/system/clock/esp_impl_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+dom_contracts_system_clock_t* inf_system_clock_esp_impl_new(const inf_system_clock_esp_impl_cfg_t* cfg);
+
+void inf_system_clock_esp_impl_delete(dom_contracts_system_clock_t* self);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INFRASTRUCTURE_SYSTEM_CLOCK_ESP_IMPL_H */
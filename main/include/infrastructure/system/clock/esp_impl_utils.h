@@ -0,0 +1,19 @@
+#ifndef INFRASTRUCTURE_SYSTEM_CLOCK_ESP_IMPL_UTILS_H
+#define INFRASTRUCTURE_SYSTEM_CLOCK_ESP_IMPL_UTILS_H
+
+#include "domain/models/error.h"
+#include "infrastructure/system/clock/esp_impl_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+dom_models_error_t inf_system_clock_esp_impl_validate_cfg(
+    const inf_system_clock_esp_impl_cfg_t* cfg
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INFRASTRUCTURE_SYSTEM_CLOCK_ESP_IMPL_UTILS_H */
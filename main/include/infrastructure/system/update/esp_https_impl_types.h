@@ -2,6 +2,7 @@
 #define INFRASTRUCTURE_SYSTEM_UPDATE_ESP_HTTPS_IMPL_TYPES_H
 
 #include <stdbool.h>
+#include <stddef.h>
 
 #include "esp_ota_ops.h"
 #include "esp_partition.h"
@@ -33,11 +34,14 @@ typedef struct {
         .skip_cert_common_name_check = false,                                                          \
     }
 
+/* Progress is written by the updating task and read from any other */
 typedef struct {
     inf_system_update_esp_https_impl_cfg_t cfg;
     const esp_partition_t*                 update_partition;
     esp_ota_handle_t                       update_handle;
     bool                                   ota_started;
+    volatile size_t                        written_size;
+    volatile size_t                        total_size;
 } inf_system_update_esp_https_impl_ctx_t;
 
 #ifdef __cplusplus
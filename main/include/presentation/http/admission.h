@@ -0,0 +1,97 @@
+#ifndef PRESENTATION_HTTP_ADMISSION_H
+#define PRESENTATION_HTTP_ADMISSION_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_http_server.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PRES_HTTP_ADMISSION_CLIENT_MAX   16
+#define PRES_HTTP_ADMISSION_ADDR_LEN     16
+#define PRES_HTTP_ADMISSION_TOKEN_MILLIS 1000
+
+#define PRES_HTTP_ADMISSION_DEFAULT_READ_BURST               20
+#define PRES_HTTP_ADMISSION_DEFAULT_READ_PER_MIN             240
+#define PRES_HTTP_ADMISSION_DEFAULT_WRITE_BURST              5
+#define PRES_HTTP_ADMISSION_DEFAULT_WRITE_PER_MIN            30
+#define PRES_HTTP_ADMISSION_DEFAULT_EXPENSIVE_BURST          2
+#define PRES_HTTP_ADMISSION_DEFAULT_EXPENSIVE_PER_MIN        6
+#define PRES_HTTP_ADMISSION_DEFAULT_EXPENSIVE_SHARED_BURST   3
+#define PRES_HTTP_ADMISSION_DEFAULT_EXPENSIVE_SHARED_PER_MIN 12
+
+/*
+ * Cost class of a route. Read is a cheap GET, write changes state, and
+ * expensive starts radio or system work (scans, connects, restarts) that
+ * holds the server task or the driver long after the handler returns.
+ */
+typedef enum {
+    PRES_HTTP_ADMISSION_CLASS_READ = 0,
+    PRES_HTTP_ADMISSION_CLASS_WRITE,
+    PRES_HTTP_ADMISSION_CLASS_EXPENSIVE,
+    PRES_HTTP_ADMISSION_CLASS_CNT,
+} pres_http_admission_class_t;
+
+/* Burst tokens refilled at per_min a minute, a per_min of 0 never limits */
+typedef struct {
+    uint16_t burst;
+    uint16_t per_min;
+} pres_http_admission_limit_t;
+
+typedef struct {
+    pres_http_admission_limit_t client[PRES_HTTP_ADMISSION_CLASS_CNT];
+    pres_http_admission_limit_t shared[PRES_HTTP_ADMISSION_CLASS_CNT];
+} pres_http_admission_config_t;
+
+/* Tokens are kept in thousandths so slow refill rates do not round away */
+typedef struct {
+    uint32_t tokens;
+    uint32_t refilled_ms;
+} pres_http_admission_bucket_t;
+
+typedef struct {
+    uint8_t                      addr[PRES_HTTP_ADMISSION_ADDR_LEN];
+    uint32_t                     seen_ms;
+    bool                         used;
+    pres_http_admission_bucket_t buckets[PRES_HTTP_ADMISSION_CLASS_CNT];
+} pres_http_admission_client_t;
+
+/*
+ * Token buckets per client address and route class, plus one shared bucket
+ * per class that caps all clients together. The server runs handlers one
+ * at a time, so the shared bucket on expensive routes is what bounds how
+ * much slow work is queued behind the radio at once. The client table is
+ * fixed, the least recently seen address makes room for a new one. Only
+ * the server task touches it, so there is no lock.
+ */
+typedef struct {
+    pres_http_admission_config_t config;
+    pres_http_admission_client_t clients[PRES_HTTP_ADMISSION_CLIENT_MAX];
+    pres_http_admission_bucket_t shared[PRES_HTTP_ADMISSION_CLASS_CNT];
+} pres_http_admission_t;
+
+pres_http_admission_t* pres_http_admission_new(const pres_http_admission_config_t* config);
+
+void pres_http_admission_delete(pres_http_admission_t* admission);
+
+/*
+ * Takes a token from the client's and the shared bucket of the class, or
+ * from neither. When refused, retry_after_s is how long until both have
+ * one again, at least a second.
+ */
+bool pres_http_admission_admit(
+    pres_http_admission_t*      admission,
+    httpd_req_t*                req,
+    pres_http_admission_class_t cls,
+    uint32_t*                   retry_after_s
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRESENTATION_HTTP_ADMISSION_H */
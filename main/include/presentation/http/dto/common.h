@@ -1,27 +1,60 @@
 #ifndef PRESENTATION_HTTP_DTO_COMMON_H
 #define PRESENTATION_HTTP_DTO_COMMON_H
 
-#include "cJSON.h"
+#include <stdint.h>
+
 #include "domain/models/error.h"
 #include "esp_err.h"
 #include "esp_http_server.h"
+#include "utils/json/reader.h"
+#include "utils/json/writer.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-#define PRES_HTTP_DTO_COMMON_MAX_BODY_LEN 1024
+#define PRES_HTTP_DTO_COMMON_MAX_BODY_LEN      1024
+#define PRES_HTTP_DTO_COMMON_MAX_QUERY_LEN      128
+#define PRES_HTTP_DTO_COMMON_STREAM_SCRATCH_LEN 256
+
+/* Request body read into a fixed buffer and tokenized in place */
+typedef struct {
+    char                buf[PRES_HTTP_DTO_COMMON_MAX_BODY_LEN];
+    utils_json_reader_t reader;
+} pres_http_dto_common_body_t;
 
+/*
+ * Chunked JSON response. The writer fills scratch and sends it as one
+ * HTTP chunk whenever it is full, so response size does not depend on
+ * heap or scratch size. Lives on the handler stack.
+ */
+typedef struct {
+    httpd_req_t*        req;
+    utils_json_writer_t writer;
+    char                scratch[PRES_HTTP_DTO_COMMON_STREAM_SCRATCH_LEN];
+} pres_http_dto_common_stream_t;
+
+/* An empty body yields OK with an empty reader */
 dom_models_error_t pres_http_dto_common_recv_json(
-    httpd_req_t* req,
-    cJSON**      out
+    httpd_req_t*                 req,
+    pres_http_dto_common_body_t* body
 );
 
-esp_err_t pres_http_dto_common_send_json(
+/* A missing query parameter yields OK and leaves out untouched */
+dom_models_error_t pres_http_dto_common_query_u32(
     httpd_req_t* req,
-    cJSON*       json
+    const char*  key,
+    uint32_t*    out
 );
 
+utils_json_writer_t* pres_http_dto_common_stream_begin(
+    pres_http_dto_common_stream_t* stream,
+    httpd_req_t*                   req
+);
+
+/* Flushes the rest and terminates the chunked response */
+esp_err_t pres_http_dto_common_stream_end(pres_http_dto_common_stream_t* stream);
+
 esp_err_t pres_http_dto_common_send_domain_error(
     httpd_req_t*       req,
     dom_models_error_t err
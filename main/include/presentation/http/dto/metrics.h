@@ -0,0 +1,24 @@
+#ifndef PRESENTATION_HTTP_DTO_METRICS_H
+#define PRESENTATION_HTTP_DTO_METRICS_H
+
+#include "esp_err.h"
+#include "esp_http_server.h"
+#include "presentation/http/metrics.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PRES_HTTP_DTO_METRICS_SCRATCH_LEN 512
+
+/* Streams the table in the Prometheus text format, one family at a time */
+esp_err_t pres_http_dto_metrics_send(
+    httpd_req_t*               req,
+    const pres_http_metrics_t* metrics
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRESENTATION_HTTP_DTO_METRICS_H */
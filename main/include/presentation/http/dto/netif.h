@@ -1,16 +1,19 @@
 #ifndef PRESENTATION_HTTP_DTO_NETIF_H
 #define PRESENTATION_HTTP_DTO_NETIF_H
 
-#include "cJSON.h"
+#include <stdbool.h>
+
 #include "domain/models/network.h"
+#include "utils/json/writer.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-cJSON* pres_http_dto_netif_network_to_json(const dom_models_network_t* network);
+/* Writers return false once the document overflowed or its flush failed */
+bool pres_http_dto_netif_write_network(utils_json_writer_t* w, const dom_models_network_t* network);
 
-cJSON* pres_http_dto_netif_interface_to_json(const dom_models_network_interface_t* interface);
+bool pres_http_dto_netif_write_interface(utils_json_writer_t* w, const dom_models_network_interface_t* interface);
 
 #ifdef __cplusplus
 }
@@ -3,26 +3,27 @@
 
 #include <stdbool.h>
 
-#include "cJSON.h"
 #include "domain/models/error.h"
 #include "domain/usecases/settings.h"
+#include "utils/json/reader.h"
+#include "utils/json/writer.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 dom_models_error_t pres_http_dto_settings_parse_preloaded_update(
-    cJSON*                                    json,
+    const utils_json_reader_t*                json,
     dom_usecases_settings_preloaded_update_t* out
 );
 
-cJSON* pres_http_dto_settings_snapshot_to_json(const dom_usecases_settings_snapshot_t* snapshot);
+bool pres_http_dto_settings_write_snapshot(utils_json_writer_t* w, const dom_usecases_settings_snapshot_t* snapshot);
 
-cJSON* pres_http_dto_settings_preloaded_updated_to_json(bool restart_required);
+bool pres_http_dto_settings_write_preloaded_updated(utils_json_writer_t* w, bool restart_required);
 
-cJSON* pres_http_dto_settings_restart_required_to_json(bool restart_required);
+bool pres_http_dto_settings_write_restart_required(utils_json_writer_t* w, bool restart_required);
 
-cJSON* pres_http_dto_settings_accepted_to_json(void);
+bool pres_http_dto_settings_write_accepted(utils_json_writer_t* w);
 
 #ifdef __cplusplus
 }
@@ -2,39 +2,66 @@
 #define PRESENTATION_HTTP_DTO_WIFIMAN_H
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
-#include "cJSON.h"
 #include "domain/models/error.h"
 #include "domain/models/wifi.h"
 #include "domain/usecases/wifiman.h"
+#include "utils/json/reader.h"
+#include "utils/json/writer.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 dom_models_error_t pres_http_dto_wifiman_parse_sta_credential(
-    cJSON*                              json,
-    dom_models_wifi_sta_credential_t*   out
+    const utils_json_reader_t*        json,
+    dom_models_wifi_sta_credential_t* out
+);
+
+/* A credential plus an optional priority, 0 when absent */
+dom_models_error_t pres_http_dto_wifiman_parse_sta_profile(
+    const utils_json_reader_t*        json,
+    dom_models_wifi_sta_credential_t* out,
+    uint8_t*                          priority
+);
+
+dom_models_error_t pres_http_dto_wifiman_parse_sta_profile_ssid(
+    const utils_json_reader_t* json,
+    char*                      out,
+    size_t                     out_size
 );
 
 dom_models_error_t pres_http_dto_wifiman_parse_scan_config(
-    cJSON*                           json,
-    dom_models_wifi_scan_config_t*   out
+    const utils_json_reader_t*     json,
+    dom_models_wifi_scan_config_t* out
 );
 
-cJSON* pres_http_dto_wifiman_status_to_json(const dom_usecases_wifiman_status_t* status);
+/* Offset and limit select a page of the cached scan entries */
+dom_models_error_t pres_http_dto_wifiman_parse_scan_query(
+    const utils_json_reader_t*         json,
+    dom_usecases_wifiman_scan_query_t* out
+);
+
+/* Writers return false once the document overflowed or its flush failed */
+bool pres_http_dto_wifiman_write_status(utils_json_writer_t* w, const dom_usecases_wifiman_status_t* status);
+
+bool pres_http_dto_wifiman_write_scan_result(utils_json_writer_t* w, const dom_usecases_wifiman_scan_result_t* result);
+
+bool pres_http_dto_wifiman_write_stored_sta(utils_json_writer_t* w, const dom_usecases_wifiman_stored_sta_t* stored_sta);
 
-cJSON* pres_http_dto_wifiman_scan_result_to_json(const dom_models_wifi_scan_result_t* result);
+bool pres_http_dto_wifiman_write_sta_profiles(utils_json_writer_t* w, const dom_usecases_wifiman_sta_profiles_t* profiles);
 
-cJSON* pres_http_dto_wifiman_stored_sta_to_json(const dom_usecases_wifiman_stored_sta_t* stored_sta);
+bool pres_http_dto_wifiman_write_reconnect_need(utils_json_writer_t* w, bool needed);
 
-cJSON* pres_http_dto_wifiman_reconnect_need_to_json(bool needed);
+bool pres_http_dto_wifiman_write_reconnect_attempted(utils_json_writer_t* w, bool attempted);
 
-cJSON* pres_http_dto_wifiman_reconnect_attempted_to_json(bool attempted);
+bool pres_http_dto_wifiman_write_accepted(utils_json_writer_t* w);
 
-cJSON* pres_http_dto_wifiman_accepted_to_json(void);
+bool pres_http_dto_wifiman_write_forgotten(utils_json_writer_t* w);
 
-cJSON* pres_http_dto_wifiman_forgotten_to_json(void);
+bool pres_http_dto_wifiman_write_deleted(utils_json_writer_t* w);
 
 #ifdef __cplusplus
 }
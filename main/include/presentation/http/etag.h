@@ -0,0 +1,89 @@
+#ifndef PRESENTATION_HTTP_ETAG_H
+#define PRESENTATION_HTTP_ETAG_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "domain/models/ethernet.h"
+#include "domain/models/wifi.h"
+#include "esp_err.h"
+#include "esp_http_server.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PRES_HTTP_ETAG_MAX_LEN               32
+#define PRES_HTTP_ETAG_IF_NONE_MATCH_MAX_LEN 128
+#define PRES_HTTP_ETAG_DEFAULT_REVALIDATE_MS 10000
+
+/*
+ * Generation counter for one or more GET resources. Writers bump it after
+ * changing the state behind the resource, and handlers derive the ETag from
+ * it before reading that state, so a 304 never hides a finished change.
+ *
+ * Fields that drift without an event (RSSI, reconnect counters) are covered
+ * by revalidate_ms, which rolls the tag over at most that often; 0 disables
+ * it for resources that only change through bumps. The boot id keeps tags
+ * from a previous boot from matching after the counter restarts.
+ */
+typedef struct {
+    uint32_t         boot_id;
+    uint32_t         revalidate_ms;
+    _Atomic uint32_t generation;
+} pres_http_etag_t;
+
+void pres_http_etag_init(
+    pres_http_etag_t* etag,
+    uint32_t          revalidate_ms
+);
+
+void pres_http_etag_bump(pres_http_etag_t* etag);
+
+/* Lets other presentation code watch for bumps, 0 for a NULL etag */
+uint32_t pres_http_etag_generation(const pres_http_etag_t* etag);
+
+/* Device event callbacks, cb_ctx is the pres_http_etag_t to bump */
+void pres_http_etag_on_wifi_event(
+    void*                          cb_ctx,
+    const dom_models_wifi_event_t* event
+);
+
+void pres_http_etag_on_ethernet_event(
+    void*                              cb_ctx,
+    const dom_models_ethernet_event_t* event
+);
+
+/*
+ * Formats the current tag into out and reports whether If-None-Match
+ * already lists it. A NULL etag leaves out empty and never matches.
+ */
+bool pres_http_etag_match(
+    httpd_req_t*            req,
+    const pres_http_etag_t* etag,
+    char                    out[PRES_HTTP_ETAG_MAX_LEN]
+);
+
+/* Whether If-None-Match lists the given tag, for tags not derived from a pres_http_etag_t */
+bool pres_http_etag_requested(
+    httpd_req_t* req,
+    const char*  tag
+);
+
+/* Tag must stay valid until the response is sent, an empty tag is skipped */
+void pres_http_etag_set_header(
+    httpd_req_t* req,
+    const char*  tag
+);
+
+esp_err_t pres_http_etag_send_not_modified(
+    httpd_req_t* req,
+    const char*  tag
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRESENTATION_HTTP_ETAG_H */
@@ -0,0 +1,40 @@
+#ifndef PRESENTATION_HTTP_HANDLER_ASSETS_TYPES_H
+#define PRESENTATION_HTTP_HANDLER_ASSETS_TYPES_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PRES_HTTP_HANDLER_ASSETS_DEFAULT_BASE_PATH "/littlefs/www"
+#define PRES_HTTP_HANDLER_ASSETS_PATH_MAX_LEN      128
+#define PRES_HTTP_HANDLER_ASSETS_CHUNK_LEN         1024
+#define PRES_HTTP_HANDLER_ASSETS_ETAG_CACHE_LEN    8
+#define PRES_HTTP_HANDLER_ASSETS_ETAG_LEN          20
+
+typedef struct {
+    uint64_t path_hash;
+    uint32_t size;
+    char     tag[PRES_HTTP_HANDLER_ASSETS_ETAG_LEN];
+} pres_http_handler_assets_etag_t;
+
+/*
+ * Serves the files under base_path. A precompressed <file>.gz is preferred
+ * and sent as is with Content-Encoding: gzip, so nothing is inflated or
+ * deflated on the device. The strong ETag of a file is hashed from its
+ * bytes the first time it is asked for and kept in etags, keyed on path and
+ * size, the oldest entry making room. Only the server task touches it.
+ */
+typedef struct {
+    const char*                     base_path;
+    pres_http_handler_assets_etag_t etags[PRES_HTTP_HANDLER_ASSETS_ETAG_CACHE_LEN];
+    size_t                          etag_next;
+} pres_http_handler_assets_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRESENTATION_HTTP_HANDLER_ASSETS_TYPES_H */
@@ -0,0 +1,18 @@
+#ifndef PRESENTATION_HTTP_HANDLER_EVENTS_TYPES_H
+#define PRESENTATION_HTTP_HANDLER_EVENTS_TYPES_H
+
+#include "presentation/task/event_stream/types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    pres_task_event_stream_t* stream;
+} pres_http_handler_events_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRESENTATION_HTTP_HANDLER_EVENTS_TYPES_H */
@@ -0,0 +1,17 @@
+#ifndef PRESENTATION_HTTP_HANDLER_METRICS_H
+#define PRESENTATION_HTTP_HANDLER_METRICS_H
+
+#include "esp_err.h"
+#include "esp_http_server.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+esp_err_t pres_http_handler_metrics_get(httpd_req_t* req);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRESENTATION_HTTP_HANDLER_METRICS_H */
@@ -0,0 +1,18 @@
+#ifndef PRESENTATION_HTTP_HANDLER_METRICS_TYPES_H
+#define PRESENTATION_HTTP_HANDLER_METRICS_TYPES_H
+
+#include "presentation/http/metrics.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    const pres_http_metrics_t* metrics;
+} pres_http_handler_metrics_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRESENTATION_HTTP_HANDLER_METRICS_TYPES_H */
@@ -2,13 +2,16 @@
 #define PRESENTATION_HTTP_HANDLER_NETIF_TYPES_H
 
 #include "domain/usecases/netif.h"
+#include "presentation/http/etag.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/* Etag is optional, without it GET routes always send the full body */
 typedef struct {
     dom_usecases_netif_t* netif;
+    pres_http_etag_t*     etag;
 } pres_http_handler_netif_t;
 
 #ifdef __cplusplus
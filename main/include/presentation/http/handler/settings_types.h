@@ -2,13 +2,21 @@
 #define PRESENTATION_HTTP_HANDLER_SETTINGS_TYPES_H
 
 #include "domain/usecases/settings.h"
+#include "presentation/http/dto/common.h"
+#include "presentation/http/etag.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/*
+ * The httpd task runs one handler at a time, so routes share the body
+ * buffer. Etag is optional, without it GET routes always send the full body.
+ */
 typedef struct {
-    dom_usecases_settings_t* settings;
+    dom_usecases_settings_t*    settings;
+    pres_http_etag_t*           etag;
+    pres_http_dto_common_body_t body;
 } pres_http_handler_settings_t;
 
 #ifdef __cplusplus
@@ -28,6 +28,12 @@ esp_err_t pres_http_handler_wifiman_set_sta_credential(httpd_req_t* req);
 
 esp_err_t pres_http_handler_wifiman_forget_sta_credential(httpd_req_t* req);
 
+esp_err_t pres_http_handler_wifiman_get_sta_profiles(httpd_req_t* req);
+
+esp_err_t pres_http_handler_wifiman_set_sta_profile(httpd_req_t* req);
+
+esp_err_t pres_http_handler_wifiman_delete_sta_profile(httpd_req_t* req);
+
 esp_err_t pres_http_handler_wifiman_need_reconnect(httpd_req_t* req);
 
 esp_err_t pres_http_handler_wifiman_try_reconnect(httpd_req_t* req);
@@ -2,13 +2,23 @@
 #define PRESENTATION_HTTP_HANDLER_WIFIMAN_TYPES_H
 
 #include "domain/usecases/wifiman.h"
+#include "presentation/http/dto/common.h"
+#include "presentation/http/etag.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/*
+ * The httpd task runs one handler at a time, so routes share the body
+ * buffer and the scan result, which is too large for the httpd stack. Etag
+ * is optional, without it GET routes always send the full body.
+ */
 typedef struct {
-    dom_usecases_wifiman_t* wifiman;
+    dom_usecases_wifiman_t*            wifiman;
+    pres_http_etag_t*                  etag;
+    pres_http_dto_common_body_t        body;
+    dom_usecases_wifiman_scan_result_t scan_result;
 } pres_http_handler_wifiman_t;
 
 #ifdef __cplusplus
@@ -0,0 +1,118 @@
+#ifndef PRESENTATION_HTTP_METRICS_H
+#define PRESENTATION_HTTP_METRICS_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "esp_http_server.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PRES_HTTP_METRICS_ROUTE_MAX          48
+#define PRES_HTTP_METRICS_STATUS_CLASS_CNT   5
+#define PRES_HTTP_METRICS_LATENCY_BUCKET_CNT 12
+#define PRES_HTTP_METRICS_LATENCY_BASE_US    250
+
+/*
+ * Counters of one registered route. The first latency bucket ends at
+ * PRES_HTTP_METRICS_LATENCY_BASE_US and every next one doubles it, the
+ * last slot catches everything slower. Status counts are kept per class,
+ * 1xx to 5xx. Heap delta is the system wide free heap lost across the
+ * handler, so other tasks add noise, but a sum that keeps growing points at
+ * memory the route kept. The 32 bit counters wrap, which scrapers read as a
+ * counter reset. The latency sum is 64 bit, in 32 bits of microseconds it
+ * would wrap after 71 minutes of handler time.
+ */
+typedef struct {
+    const char*      uri;
+    httpd_method_t   method;
+    _Atomic uint32_t request_cnt;
+    _Atomic uint32_t failed_cnt;
+    _Atomic uint32_t status_cnt[PRES_HTTP_METRICS_STATUS_CLASS_CNT];
+    _Atomic uint32_t latency_cnt[PRES_HTTP_METRICS_LATENCY_BUCKET_CNT + 1];
+    _Atomic uint64_t latency_sum_us;
+    _Atomic uint32_t bytes_in;
+    _Atomic uint32_t bytes_out;
+    _Atomic int32_t  heap_delta_sum;
+    _Atomic int32_t  heap_delta_max;
+} pres_http_metrics_route_t;
+
+/* Bookkeeping of the request in flight, lives on the wrapper's stack */
+typedef struct {
+    pres_http_metrics_route_t* route;
+    httpd_req_t*               req;
+    int64_t                    started_us;
+    uint32_t                   free_heap;
+    uint16_t                   status;
+    uint32_t                   bytes_out;
+} pres_http_metrics_request_t;
+
+/*
+ * Fixed table of per-route counters. Slots are only added while routes
+ * register and published through route_cnt, after that every update is a
+ * relaxed atomic so /api/metrics can read it from any task without a lock.
+ * Active is only touched by the server task, which runs one handler at a
+ * time, and lets the send helpers, which reach the table through the
+ * server's router, attribute status and bytes to it.
+ */
+typedef struct {
+    pres_http_metrics_route_t    routes[PRES_HTTP_METRICS_ROUTE_MAX];
+    _Atomic uint32_t             route_cnt;
+    pres_http_metrics_request_t* active;
+} pres_http_metrics_t;
+
+pres_http_metrics_t* pres_http_metrics_new(void);
+
+void pres_http_metrics_delete(pres_http_metrics_t* metrics);
+
+/*
+ * Returns the slot for the route, reusing the one of an earlier
+ * registration with the same uri and method, or NULL once the table is full.
+ */
+pres_http_metrics_route_t* pres_http_metrics_add_route(
+    pres_http_metrics_t* metrics,
+    const char*          uri,
+    httpd_method_t       method
+);
+
+uint32_t pres_http_metrics_route_cnt(const pres_http_metrics_t* metrics);
+
+void pres_http_metrics_begin(
+    pres_http_metrics_t*         metrics,
+    pres_http_metrics_route_t*   route,
+    httpd_req_t*                 req,
+    pres_http_metrics_request_t* request
+);
+
+void pres_http_metrics_end(
+    pres_http_metrics_t*         metrics,
+    pres_http_metrics_request_t* request,
+    esp_err_t                    result
+);
+
+/*
+ * Response helpers that also feed the instrumented request, if any. A
+ * response that never sets a status is counted as 200.
+ */
+esp_err_t pres_http_metrics_set_status(
+    httpd_req_t* req,
+    const char*  status
+);
+
+void pres_http_metrics_count_sent(
+    httpd_req_t* req,
+    size_t       len
+);
+
+/* Upper bound of a latency bucket, 0 for the overflow bucket */
+uint32_t pres_http_metrics_latency_bound_us(size_t bucket);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRESENTATION_HTTP_METRICS_H */
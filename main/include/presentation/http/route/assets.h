@@ -0,0 +1,31 @@
+#ifndef PRESENTATION_HTTP_ROUTE_ASSETS_H
+#define PRESENTATION_HTTP_ROUTE_ASSETS_H
+
+#include <stddef.h>
+
+#include "esp_err.h"
+#include "esp_http_server.h"
+#include "presentation/http/handler/assets_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Catches every GET path, so it must be registered after the router's
+ * wildcard handlers, which the server tries first.
+ */
+esp_err_t pres_http_route_assets_register(
+    httpd_handle_t              server,
+    pres_http_handler_assets_t* handler
+);
+
+esp_err_t pres_http_route_assets_unregister(httpd_handle_t server);
+
+size_t pres_http_route_assets_route_cnt(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRESENTATION_HTTP_ROUTE_ASSETS_H */
@@ -0,0 +1,36 @@
+#ifndef PRESENTATION_HTTP_ROUTE_COMMON_H
+#define PRESENTATION_HTTP_ROUTE_COMMON_H
+
+#include "esp_err.h"
+#include "esp_http_server.h"
+#include "presentation/http/admission.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Every route module registers through here. When the server was started
+ * with a pres_http_router_t as global_user_ctx, /api/ routes go into its
+ * table, where they are dispatched and instrumented, and take no server
+ * handler slot. Other routes, and every route without a router, are
+ * registered with the server as is and take one slot each, and skip
+ * admission control.
+ */
+esp_err_t pres_http_route_common_register(
+    httpd_handle_t              server,
+    const httpd_uri_t*          uri,
+    pres_http_admission_class_t admission
+);
+
+esp_err_t pres_http_route_common_unregister(
+    httpd_handle_t server,
+    const char*    uri,
+    httpd_method_t method
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRESENTATION_HTTP_ROUTE_COMMON_H */
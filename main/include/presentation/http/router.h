@@ -0,0 +1,107 @@
+#ifndef PRESENTATION_HTTP_ROUTER_H
+#define PRESENTATION_HTTP_ROUTER_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "esp_http_server.h"
+#include "presentation/http/admission.h"
+#include "presentation/http/metrics.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PRES_HTTP_ROUTER_PREFIX      "/api/"
+#define PRES_HTTP_ROUTER_WILDCARD    "/api/*"
+#define PRES_HTTP_ROUTER_ROUTE_MAX   48
+#define PRES_HTTP_ROUTER_SLOT_CNT    128
+#define PRES_HTTP_ROUTER_HANDLER_CNT 5
+
+typedef enum {
+    PRES_HTTP_ROUTER_SLOT_EMPTY = 0,
+    PRES_HTTP_ROUTER_SLOT_USED,
+    PRES_HTTP_ROUTER_SLOT_REMOVED,
+} pres_http_router_slot_state_t;
+
+typedef struct {
+    _Atomic uint8_t             state;
+    uint32_t                    hash;
+    httpd_method_t              method;
+    const char*                 uri;
+    size_t                      uri_len;
+    esp_err_t                   (*handler)(httpd_req_t* req);
+    void*                       user_ctx;
+    pres_http_metrics_route_t*  metrics;
+    pres_http_admission_class_t admission;
+} pres_http_router_slot_t;
+
+/*
+ * Every /api/ route lives in one open addressed table hashed on method and
+ * path, and the server only holds one wildcard handler per method in
+ * front of it, so a lookup costs one hash and usually one compare however
+ * many routes there are. The table is sized at twice the route limit to
+ * keep probe chains short. Slots are published with a release store once
+ * filled, so routes can still be added while the server runs. Metrics is
+ * optional, with it every route is instrumented as it is added. Admission
+ * is optional too, with it every request passes its route's class limits
+ * before the handler runs and is answered 429 otherwise.
+ */
+typedef struct {
+    pres_http_router_slot_t slots[PRES_HTTP_ROUTER_SLOT_CNT];
+    size_t                  route_cnt;
+    pres_http_metrics_t*    metrics;
+    pres_http_admission_t*  admission;
+} pres_http_router_t;
+
+pres_http_router_t* pres_http_router_new(
+    pres_http_metrics_t*   metrics,
+    pres_http_admission_t* admission
+);
+
+void pres_http_router_delete(pres_http_router_t* router);
+
+/*
+ * For httpd_config_t.global_user_ctx_free_fn, the router outlives the
+ * server and is deleted by whoever created it.
+ */
+void pres_http_router_release(void* ctx);
+
+/* The router and its metrics as set as global_user_ctx, NULL without one */
+pres_http_router_t* pres_http_router_from_server(httpd_handle_t server);
+
+/* Registers the wildcard handlers, the server needs httpd_uri_match_wildcard */
+esp_err_t pres_http_router_register(
+    httpd_handle_t      server,
+    pres_http_router_t* router
+);
+
+esp_err_t pres_http_router_unregister(httpd_handle_t server);
+
+/* Uri must start with PRES_HTTP_ROUTER_PREFIX and stay valid while added */
+esp_err_t pres_http_router_add(
+    pres_http_router_t*         router,
+    const httpd_uri_t*          uri,
+    pres_http_admission_class_t admission
+);
+
+esp_err_t pres_http_router_remove(
+    pres_http_router_t* router,
+    const char*         uri,
+    httpd_method_t      method
+);
+
+/* Path may carry a query string, it is ignored */
+const pres_http_router_slot_t* pres_http_router_find(
+    const pres_http_router_t* router,
+    httpd_method_t            method,
+    const char*               path
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRESENTATION_HTTP_ROUTER_H */
@@ -3,26 +3,55 @@
 
 #include "domain/contracts/logger/leveled.h"
 #include "domain/contracts/repository/preloaded.h"
+#include "domain/usecases/netif.h"
 #include "domain/usecases/ota.h"
 #include "domain/usecases/settings.h"
+#include "domain/usecases/wifiman.h"
+#include "presentation/http/etag.h"
+#include "presentation/mqtt/reassembly.h"
+#include "presentation/mqtt/router.h"
+#include "utils/json/writer.h"
+#include "utils/mqtt/topic_table.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-typedef struct {
+#define PRES_MQTT_CONTEXT_REPLY_MAX_LEN  4096
+#define PRES_MQTT_CONTEXT_SCAN_PAGE_LEN 8
+
+/*
+ * Wifiman and netif are optional, their routes are only added when present.
+ * Handlers run one at a time on the MQTT task, so they share a single reply
+ * buffer instead of allocating a document per reply, and a scan result to
+ * keep it off the task stack. The optional etags are the HTTP generations
+ * bumped by MQTT writes, so polling UIs see them too.
+ */
+struct pres_mqtt_context_t {
     dom_contracts_logger_leveled_t*       logger;
     dom_contracts_repository_preloaded_t* preloaded_repository;
     dom_usecases_settings_t*              settings;
     dom_usecases_ota_t*                   ota;
+    dom_usecases_wifiman_t*               wifiman;
+    dom_usecases_netif_t*                 netif;
+    pres_http_etag_t*                     network_etag;
+    pres_http_etag_t*                     settings_etag;
     char                                  device_id_str[32];
-} pres_mqtt_context_t;
+    pres_mqtt_router_t                    router;
+    pres_mqtt_reassembly_t                reassembly;
+    utils_mqtt_topic_t                    reply_prefix;
+    utils_json_writer_t                   reply_writer;
+    char                                  reply_buf[PRES_MQTT_CONTEXT_REPLY_MAX_LEN];
+    dom_usecases_wifiman_scan_result_t    scan_result;
+};
 
 pres_mqtt_context_t* pres_mqtt_context_new(
     dom_contracts_logger_leveled_t*       logger,
     dom_contracts_repository_preloaded_t* preloaded_repository,
     dom_usecases_settings_t*              settings,
-    dom_usecases_ota_t*                   ota
+    dom_usecases_ota_t*                   ota,
+    dom_usecases_wifiman_t*               wifiman,
+    dom_usecases_netif_t*                 netif
 );
 
 void pres_mqtt_context_delete(pres_mqtt_context_t* self);
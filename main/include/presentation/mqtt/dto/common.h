@@ -0,0 +1,42 @@
+#ifndef PRESENTATION_MQTT_DTO_COMMON_H
+#define PRESENTATION_MQTT_DTO_COMMON_H
+
+#include "domain/models/error.h"
+#include "presentation/mqtt/context.h"
+#include "presentation/mqtt/router.h"
+#include "utils/json/reader.h"
+#include "utils/json/writer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Tokenizes the payload in place, an empty payload yields OK with an empty reader */
+dom_models_error_t pres_mqtt_dto_common_recv_json(
+    const pres_mqtt_message_t* msg,
+    utils_json_reader_t*       out
+);
+
+/* Resets the shared reply buffer and returns its writer */
+utils_json_writer_t* pres_mqtt_dto_common_reply_begin(pres_mqtt_context_t* ctx);
+
+/*
+ * Replies go to "/pub/<device_id>/<suffix>", mirroring the command topic.
+ * A reply that did not fit the buffer is answered with an error instead.
+ */
+dom_models_error_t pres_mqtt_dto_common_reply_end(
+    pres_mqtt_context_t*       ctx,
+    const pres_mqtt_message_t* msg
+);
+
+dom_models_error_t pres_mqtt_dto_common_send_domain_error(
+    pres_mqtt_context_t*       ctx,
+    const pres_mqtt_message_t* msg,
+    dom_models_error_t         err
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRESENTATION_MQTT_DTO_COMMON_H */
@@ -0,0 +1,20 @@
+#ifndef PRESENTATION_MQTT_HANDLER_NETIF_H
+#define PRESENTATION_MQTT_HANDLER_NETIF_H
+
+#include "presentation/mqtt/context.h"
+#include "presentation/mqtt/router.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void pres_mqtt_handler_netif_get_all(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg);
+
+/* Serves "netif/<name>" where name is "wifi_sta" or "ethernet" */
+void pres_mqtt_handler_netif_get_interface(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRESENTATION_MQTT_HANDLER_NETIF_H */
@@ -0,0 +1,23 @@
+#ifndef PRESENTATION_MQTT_HANDLER_SETTINGS_H
+#define PRESENTATION_MQTT_HANDLER_SETTINGS_H
+
+#include "presentation/mqtt/context.h"
+#include "presentation/mqtt/router.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void pres_mqtt_handler_settings_get_snapshot(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg);
+
+void pres_mqtt_handler_settings_set_preloaded(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg);
+
+void pres_mqtt_handler_settings_get_restart_required(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg);
+
+void pres_mqtt_handler_settings_restart(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRESENTATION_MQTT_HANDLER_SETTINGS_H */
@@ -0,0 +1,43 @@
+#ifndef PRESENTATION_MQTT_HANDLER_WIFIMAN_H
+#define PRESENTATION_MQTT_HANDLER_WIFIMAN_H
+
+#include "presentation/mqtt/context.h"
+#include "presentation/mqtt/router.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void pres_mqtt_handler_wifiman_get_status(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg);
+
+void pres_mqtt_handler_wifiman_start_scan(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg);
+
+void pres_mqtt_handler_wifiman_get_scan_result(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg);
+
+void pres_mqtt_handler_wifiman_connect_sta(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg);
+
+void pres_mqtt_handler_wifiman_connect_stored_sta(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg);
+
+void pres_mqtt_handler_wifiman_disconnect_sta(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg);
+
+void pres_mqtt_handler_wifiman_commit_sta_connection(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg);
+
+void pres_mqtt_handler_wifiman_get_stored_sta(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg);
+
+void pres_mqtt_handler_wifiman_set_sta_credential(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg);
+
+void pres_mqtt_handler_wifiman_forget_sta_credential(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg);
+
+void pres_mqtt_handler_wifiman_get_sta_profiles(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg);
+
+void pres_mqtt_handler_wifiman_set_sta_profile(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg);
+
+void pres_mqtt_handler_wifiman_delete_sta_profile(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg);
+
+void pres_mqtt_handler_wifiman_try_reconnect(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRESENTATION_MQTT_HANDLER_WIFIMAN_H */
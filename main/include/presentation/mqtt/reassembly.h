@@ -0,0 +1,83 @@
+#ifndef PRESENTATION_MQTT_REASSEMBLY_H
+#define PRESENTATION_MQTT_REASSEMBLY_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "domain/models/error.h"
+#include "presentation/mqtt/router.h"
+#include "utils/mqtt/topic_table.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PRES_MQTT_REASSEMBLY_SLOT_CNT 2
+#define PRES_MQTT_REASSEMBLY_SLOT_LEN 8192
+
+/* One fragment of a publish as reported by the MQTT client */
+typedef struct {
+    int         msg_id;
+    const char* data;
+    size_t      data_len;
+    size_t      offset;
+    size_t      total_len;
+    int64_t     received_ms;
+} pres_mqtt_reassembly_chunk_t;
+
+/*
+ * Only the first fragment carries the topic, so the matched route and the
+ * topic suffix are kept with the buffer until the last fragment arrives.
+ * Started_ms orders slots for eviction, a publish whose tail was lost
+ * would otherwise hold its slot until the connection drops.
+ */
+typedef struct {
+    bool                            used;
+    int                             msg_id;
+    int64_t                         started_ms;
+    const pres_mqtt_router_route_t* route;
+    utils_mqtt_topic_t              suffix;
+    size_t                          total_len;
+    size_t                          received_len;
+    char                            buf[PRES_MQTT_REASSEMBLY_SLOT_LEN];
+} pres_mqtt_reassembly_slot_t;
+
+typedef struct {
+    pres_mqtt_reassembly_slot_t slots[PRES_MQTT_REASSEMBLY_SLOT_CNT];
+} pres_mqtt_reassembly_t;
+
+/* Drops every partial payload, e.g. after the broker connection is lost */
+void pres_mqtt_reassembly_reset(pres_mqtt_reassembly_t* reassembly);
+
+/*
+ * Claims a slot for the first fragment, a restarted msg_id reuses its slot.
+ * With every slot busy the oldest partial payload is evicted and evicted
+ * is set, so a stalled publish cannot lock out the ones behind it.
+ */
+dom_models_error_t pres_mqtt_reassembly_begin(
+    pres_mqtt_reassembly_t*             reassembly,
+    const pres_mqtt_reassembly_chunk_t* chunk,
+    const pres_mqtt_router_route_t*     route,
+    const char*                         suffix,
+    size_t                              suffix_len,
+    bool*                               evicted
+);
+
+/*
+ * Appends a following fragment. Complete is set to the filled slot once
+ * the last fragment is in and must be handed back through release.
+ */
+dom_models_error_t pres_mqtt_reassembly_append(
+    pres_mqtt_reassembly_t*             reassembly,
+    const pres_mqtt_reassembly_chunk_t* chunk,
+    pres_mqtt_reassembly_slot_t**       complete
+);
+
+void pres_mqtt_reassembly_release(pres_mqtt_reassembly_slot_t* slot);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRESENTATION_MQTT_REASSEMBLY_H */
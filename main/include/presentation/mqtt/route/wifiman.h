@@ -0,0 +1,21 @@
+#ifndef PRESENTATION_MQTT_ROUTE_WIFIMAN_H
+#define PRESENTATION_MQTT_ROUTE_WIFIMAN_H
+
+#include <stddef.h>
+
+#include "domain/models/error.h"
+#include "presentation/mqtt/router.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+dom_models_error_t pres_mqtt_route_wifiman_register(pres_mqtt_router_t* router);
+
+size_t pres_mqtt_route_wifiman_route_cnt(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRESENTATION_MQTT_ROUTE_WIFIMAN_H */
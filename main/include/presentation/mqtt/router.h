@@ -0,0 +1,97 @@
+#ifndef PRESENTATION_MQTT_ROUTER_H
+#define PRESENTATION_MQTT_ROUTER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "domain/models/error.h"
+#include "mqtt_client.h"
+#include "utils/mqtt/topic_table.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PRES_MQTT_ROUTER_ROUTE_MAX_CNT    32
+#define PRES_MQTT_ROUTER_NODE_MAX_CNT     64
+#define PRES_MQTT_ROUTER_SEGMENT_POOL_LEN 384
+
+typedef struct pres_mqtt_context_t pres_mqtt_context_t;
+
+/* Suffix is the topic after "/sub/<device_id>/", data is not NUL-terminated */
+typedef struct {
+    esp_mqtt_client_handle_t client;
+    const char*              suffix;
+    size_t                   suffix_len;
+    const char*              data;
+    size_t                   data_len;
+} pres_mqtt_message_t;
+
+typedef void (*pres_mqtt_handler_t)(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg);
+
+typedef struct {
+    utils_mqtt_topic_t  filter;
+    int                 qos;
+    size_t              max_len;
+    pres_mqtt_handler_t handler;
+} pres_mqtt_router_route_t;
+
+/*
+ * One node per topic level. Literal children are chained through
+ * next_sibling, a '+' child is kept apart, and a trailing '#' is stored
+ * as the route of its parent level. Indices are -1 when unset.
+ */
+typedef struct {
+    uint16_t seg_off;
+    uint8_t  seg_len;
+    int8_t   route;
+    int8_t   hash_route;
+    int8_t   plus_child;
+    int8_t   first_child;
+    int8_t   next_sibling;
+} pres_mqtt_router_node_t;
+
+typedef struct {
+    utils_mqtt_topic_t       prefix;
+    pres_mqtt_router_route_t routes[PRES_MQTT_ROUTER_ROUTE_MAX_CNT];
+    size_t                   route_cnt;
+    pres_mqtt_router_node_t  nodes[PRES_MQTT_ROUTER_NODE_MAX_CNT];
+    size_t                   node_cnt;
+    char                     segments[PRES_MQTT_ROUTER_SEGMENT_POOL_LEN];
+    size_t                   segments_len;
+} pres_mqtt_router_t;
+
+dom_models_error_t pres_mqtt_router_init(
+    pres_mqtt_router_t* router,
+    const char*         device_id
+);
+
+/*
+ * Pattern is relative to the device prefix and may use '+' and a trailing
+ * '#'. Payloads longer than max_len are dropped before reaching the handler.
+ */
+dom_models_error_t pres_mqtt_router_add(
+    pres_mqtt_router_t* router,
+    const char*         pattern,
+    int                 qos,
+    size_t              max_len,
+    pres_mqtt_handler_t handler
+);
+
+const pres_mqtt_router_route_t* pres_mqtt_router_match(
+    const pres_mqtt_router_t* router,
+    const char*               topic,
+    size_t                    topic_len
+);
+
+/* Subscribes every route in one request, returns the msg_id or -1 */
+int pres_mqtt_router_subscribe(
+    const pres_mqtt_router_t* router,
+    esp_mqtt_client_handle_t  client
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRESENTATION_MQTT_ROUTER_H */
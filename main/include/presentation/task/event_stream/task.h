@@ -0,0 +1,67 @@
+#ifndef PRESENTATION_TASK_EVENT_STREAM_TASK_H
+#define PRESENTATION_TASK_EVENT_STREAM_TASK_H
+
+#include "domain/models/error.h"
+#include "domain/models/ethernet.h"
+#include "domain/models/wifi.h"
+#include "esp_http_server.h"
+#include "presentation/task/event_stream/types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+pres_task_event_stream_t* pres_task_event_stream_new(
+    const pres_task_event_stream_cfg_t* cfg
+);
+
+void pres_task_event_stream_delete(
+    pres_task_event_stream_t* self
+);
+
+dom_models_error_t pres_task_event_stream_start(
+    pres_task_event_stream_t* self
+);
+
+/* Stopping ends every subscribed response */
+dom_models_error_t pres_task_event_stream_stop(
+    pres_task_event_stream_t* self
+);
+
+dom_models_error_t pres_task_event_stream_get_stats(
+    pres_task_event_stream_t*       self,
+    pres_task_event_stream_stats_t* out
+);
+
+/*
+ * Takes ownership of an async request from httpd_req_async_handler_begin
+ * and completes it once the client goes away. BAD_STATE means the stream
+ * is stopped or every client slot is taken, the caller keeps the request.
+ */
+dom_models_error_t pres_task_event_stream_subscribe(
+    pres_task_event_stream_t* self,
+    httpd_req_t*              req
+);
+
+/* Queues the event for every subscriber, safe from any task */
+void pres_task_event_stream_publish(
+    pres_task_event_stream_t*             self,
+    const pres_task_event_stream_event_t* event
+);
+
+/* Device event callbacks, cb_ctx is the pres_task_event_stream_t */
+void pres_task_event_stream_on_wifi_event(
+    void*                          cb_ctx,
+    const dom_models_wifi_event_t* event
+);
+
+void pres_task_event_stream_on_ethernet_event(
+    void*                              cb_ctx,
+    const dom_models_ethernet_event_t* event
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRESENTATION_TASK_EVENT_STREAM_TASK_H */
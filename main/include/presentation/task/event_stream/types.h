@@ -0,0 +1,122 @@
+#ifndef PRESENTATION_TASK_EVENT_STREAM_TYPES_H
+#define PRESENTATION_TASK_EVENT_STREAM_TYPES_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "domain/usecases/ota.h"
+#include "esp_http_server.h"
+#include "freertos/FreeRTOS.h"  // IWYU pragma: keep
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "presentation/http/etag.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PRES_TASK_EVENT_STREAM_DEFAULT_TASK_NAME       "event_stream"
+#define PRES_TASK_EVENT_STREAM_DEFAULT_STACK_SIZE      4096
+#define PRES_TASK_EVENT_STREAM_DEFAULT_PRIORITY        3
+#define PRES_TASK_EVENT_STREAM_DEFAULT_CLIENT_MAX      2
+#define PRES_TASK_EVENT_STREAM_DEFAULT_TICK_MS         1000
+#define PRES_TASK_EVENT_STREAM_DEFAULT_KEEPALIVE_MS    15000
+#define PRES_TASK_EVENT_STREAM_DEFAULT_RETRY_MS        3000
+#define PRES_TASK_EVENT_STREAM_DEFAULT_STOP_TIMEOUT_MS 1000
+#define PRES_TASK_EVENT_STREAM_CLIENT_MAX              4
+#define PRES_TASK_EVENT_STREAM_RING_LEN                16
+#define PRES_TASK_EVENT_STREAM_SCRATCH_LEN             512
+
+typedef enum {
+    PRES_TASK_EVENT_STREAM_EVENT_RESYNC = 0,
+    PRES_TASK_EVENT_STREAM_EVENT_WIFI_STA_LINK,
+    PRES_TASK_EVENT_STREAM_EVENT_WIFI_STA_IP,
+    PRES_TASK_EVENT_STREAM_EVENT_WIFI_AP,
+    PRES_TASK_EVENT_STREAM_EVENT_WIFI_SCAN_DONE,
+    PRES_TASK_EVENT_STREAM_EVENT_ETHERNET_LINK,
+    PRES_TASK_EVENT_STREAM_EVENT_ETHERNET_IP,
+    PRES_TASK_EVENT_STREAM_EVENT_SETTINGS,
+    PRES_TASK_EVENT_STREAM_EVENT_OTA,
+} pres_task_event_stream_event_type_t;
+
+/*
+ * Events only carry what changed, clients read the full state through the
+ * regular GET routes. Up reports link, address or scan success and status
+ * the driver reason, OTA progress uses written_size and total_size.
+ */
+typedef struct {
+    pres_task_event_stream_event_type_t type;
+    bool                                up;
+    uint32_t                            status;
+    uint32_t                            written_size;
+    uint32_t                            total_size;
+} pres_task_event_stream_event_t;
+
+/* Ring of pending events for one subscriber, overrun makes it send a resync */
+typedef struct {
+    pres_task_event_stream_event_t events[PRES_TASK_EVENT_STREAM_RING_LEN];
+    uint8_t                        head;
+    uint8_t                        count;
+    bool                           overrun;
+} pres_task_event_stream_ring_t;
+
+typedef struct {
+    httpd_req_t*                  req;
+    pres_task_event_stream_ring_t ring;
+    int64_t                       last_send_ms;
+} pres_task_event_stream_client_t;
+
+/*
+ * Ota and settings_etag are optional sources sampled every tick while
+ * clients are subscribed. Every client holds an HTTP server socket for as
+ * long as it stays subscribed, so client_max must leave room for plain
+ * requests within the server's max_open_sockets.
+ */
+typedef struct {
+    dom_usecases_ota_t*     ota;
+    const pres_http_etag_t* settings_etag;
+    const char*             task_name;
+    uint32_t                stack_size;
+    UBaseType_t             priority;
+    uint8_t                 client_max;
+    uint32_t                tick_ms;
+    uint32_t                keepalive_ms;
+    uint32_t                retry_ms;
+} pres_task_event_stream_cfg_t;
+
+typedef struct {
+    uint32_t published_cnt;
+    uint32_t sent_cnt;
+    uint32_t overrun_cnt;
+    uint32_t subscribed_cnt;
+    uint32_t rejected_cnt;
+    uint32_t dropped_cnt;
+    uint8_t  client_cnt;
+} pres_task_event_stream_stats_t;
+
+/* Last values seen from the sampled sources */
+typedef struct {
+    bool     settings_seen;
+    uint32_t settings_generation;
+    bool     ota_updating;
+    uint32_t ota_written_size;
+} pres_task_event_stream_sampled_t;
+
+typedef struct pres_task_event_stream_t {
+    pres_task_event_stream_cfg_t     cfg;
+    pres_task_event_stream_client_t  clients[PRES_TASK_EVENT_STREAM_CLIENT_MAX];
+    pres_task_event_stream_sampled_t sampled;
+    pres_task_event_stream_stats_t   stats;
+    char                             scratch[PRES_TASK_EVENT_STREAM_SCRATCH_LEN];
+    SemaphoreHandle_t                lock;
+    TaskHandle_t                     task_handle;
+    bool                             started;
+    volatile bool                    stop_requested;
+} pres_task_event_stream_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRESENTATION_TASK_EVENT_STREAM_TYPES_H */
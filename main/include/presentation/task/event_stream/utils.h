@@ -0,0 +1,66 @@
+#ifndef PRESENTATION_TASK_EVENT_STREAM_UTILS_H
+#define PRESENTATION_TASK_EVENT_STREAM_UTILS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "domain/models/error.h"
+#include "domain/models/ethernet.h"
+#include "domain/models/wifi.h"
+#include "presentation/task/event_stream/types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+dom_models_error_t pres_task_event_stream_validate_cfg(
+    const pres_task_event_stream_cfg_t* cfg
+);
+
+void pres_task_event_stream_normalize_cfg(
+    pres_task_event_stream_cfg_t*       out,
+    const pres_task_event_stream_cfg_t* cfg
+);
+
+void pres_task_event_stream_ring_reset(
+    pres_task_event_stream_ring_t* ring
+);
+
+/* A full ring drops its oldest event and records the overrun */
+void pres_task_event_stream_ring_push(
+    pres_task_event_stream_ring_t*        ring,
+    const pres_task_event_stream_event_t* event
+);
+
+bool pres_task_event_stream_ring_pop(
+    pres_task_event_stream_ring_t*  ring,
+    pres_task_event_stream_event_t* out
+);
+
+/* Returns false for device events no subscriber cares about */
+bool pres_task_event_stream_from_wifi_event(
+    const dom_models_wifi_event_t*  event,
+    pres_task_event_stream_event_t* out
+);
+
+bool pres_task_event_stream_from_ethernet_event(
+    const dom_models_ethernet_event_t* event,
+    pres_task_event_stream_event_t*    out
+);
+
+const char* pres_task_event_stream_event_name(
+    pres_task_event_stream_event_type_t type
+);
+
+/* Formats one SSE message, returns 0 when it does not fit */
+size_t pres_task_event_stream_format_event(
+    char*                                 buf,
+    size_t                                buf_len,
+    const pres_task_event_stream_event_t* event
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRESENTATION_TASK_EVENT_STREAM_UTILS_H */
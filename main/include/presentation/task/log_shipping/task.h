@@ -0,0 +1,36 @@
+#ifndef PRESENTATION_TASK_LOG_SHIPPING_TASK_H
+#define PRESENTATION_TASK_LOG_SHIPPING_TASK_H
+
+#include "domain/models/error.h"
+#include "presentation/task/log_shipping/types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+pres_task_log_shipping_t* pres_task_log_shipping_new(
+    const pres_task_log_shipping_cfg_t* cfg
+);
+
+void pres_task_log_shipping_delete(
+    pres_task_log_shipping_t* self
+);
+
+dom_models_error_t pres_task_log_shipping_start(
+    pres_task_log_shipping_t* self
+);
+
+dom_models_error_t pres_task_log_shipping_stop(
+    pres_task_log_shipping_t* self
+);
+
+dom_models_error_t pres_task_log_shipping_get_stats(
+    pres_task_log_shipping_t*       self,
+    pres_task_log_shipping_stats_t* out
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRESENTATION_TASK_LOG_SHIPPING_TASK_H */
@@ -0,0 +1,116 @@
+#ifndef PRESENTATION_TASK_LOG_SHIPPING_TYPES_H
+#define PRESENTATION_TASK_LOG_SHIPPING_TYPES_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "domain/contracts/logger/leveled.h"
+#include "domain/contracts/messaging/publish.h"
+#include "domain/models/logger.h"
+#include "freertos/FreeRTOS.h"  // IWYU pragma: keep
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PRES_TASK_LOG_SHIPPING_DEFAULT_TASK_NAME       "log_shipping"
+#define PRES_TASK_LOG_SHIPPING_DEFAULT_STACK_SIZE      4096
+#define PRES_TASK_LOG_SHIPPING_DEFAULT_PRIORITY        2
+#define PRES_TASK_LOG_SHIPPING_DEFAULT_BATCH_MAX_BYTES 2048
+#define PRES_TASK_LOG_SHIPPING_DEFAULT_BATCH_MAX_CNT   32
+#define PRES_TASK_LOG_SHIPPING_DEFAULT_LINE_MAX_LEN    256
+#define PRES_TASK_LOG_SHIPPING_DEFAULT_MAX_LATENCY_MS  5000
+#define PRES_TASK_LOG_SHIPPING_DEFAULT_STOP_TIMEOUT_MS 100
+
+/*
+ * A binary batch starts with a header and carries one frame per record,
+ * integers in the device's little-endian order.
+ *
+ * Header, PRES_TASK_LOG_SHIPPING_BINARY_HEAD_LEN bytes:
+ * - magic "HLOG" and the version byte,
+ * - one byte each for the size of int, long, long long, size_t, intmax_t,
+ *   ptrdiff_t, void*, double and long double, so the decoder can walk the
+ *   args without knowing the target,
+ * - uptime in microseconds and Unix time in milliseconds, both int64 and
+ *   taken at publish. Unix time is whatever the device clock says, before
+ *   SNTP that is close to 0.
+ *
+ * Frame:
+ * - length of the rest of the frame as uint16,
+ * - level as uint8,
+ * - tag and format pointers at pointer size, resolved against the firmware
+ *   ELF by tools/log_decode.py,
+ * - timestamp in microseconds since boot as int64,
+ * - the argument bytes of dom_models_logger_record_t, cut at line_max_len.
+ */
+#define PRES_TASK_LOG_SHIPPING_BINARY_MAGIC     "HLOG"
+#define PRES_TASK_LOG_SHIPPING_BINARY_VERSION   1
+#define PRES_TASK_LOG_SHIPPING_BINARY_HEAD_LEN  30
+#define PRES_TASK_LOG_SHIPPING_BINARY_FRAME_LEN (sizeof(uint16_t) + sizeof(uint8_t) + (2 * sizeof(void*)) + sizeof(int64_t))
+
+typedef struct {
+    dom_contracts_logger_leveled_t*    logger;
+    dom_contracts_messaging_publish_t* publish;
+    dom_models_logger_level_t          level;
+    const char*                        task_name;
+    uint32_t                           stack_size;
+    UBaseType_t                        priority;
+    size_t                             batch_max_bytes;
+    size_t                             batch_max_cnt;
+    size_t                             line_max_len;
+    uint32_t                           max_latency_ms;
+    bool                               binary;
+} pres_task_log_shipping_cfg_t;
+
+typedef struct {
+    uint32_t publish_cnt;
+    uint32_t shipped_cnt;
+    uint32_t dropped_cnt;
+    uint32_t failed_cnt;
+} pres_task_log_shipping_stats_t;
+
+typedef struct {
+    dom_models_logger_level_t level;
+    size_t                    offset;
+    size_t                    len;
+} pres_task_log_shipping_record_t;
+
+/*
+ * Lines are stored back to back, each terminated by '\n', so the buffer
+ * is already the newline-delimited payload. The buffer holds one line
+ * beyond batch_max_bytes so the line crossing the flush threshold fits.
+ * A binary batch stores frames without a terminator after head_len bytes
+ * kept for the header.
+ */
+typedef struct {
+    char*                            buf;
+    size_t                           buf_size;
+    size_t                           buf_len;
+    size_t                           head_len;
+    bool                             binary;
+    pres_task_log_shipping_record_t* records;
+    size_t                           record_cnt;
+    int64_t                          first_us;
+} pres_task_log_shipping_batch_t;
+
+typedef struct pres_task_log_shipping_t {
+    pres_task_log_shipping_cfg_t   cfg;
+    pres_task_log_shipping_batch_t batches[2];
+    size_t                         fill_idx;
+    uint8_t*                       frame_buf;
+    SemaphoreHandle_t              lock;
+    pres_task_log_shipping_stats_t stats;
+    TaskHandle_t                   task_handle;
+    bool                           started;
+    bool                           callback_added;
+    volatile bool                  stop_requested;
+} pres_task_log_shipping_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRESENTATION_TASK_LOG_SHIPPING_TYPES_H */
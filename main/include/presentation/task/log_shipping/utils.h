@@ -0,0 +1,60 @@
+#ifndef PRESENTATION_TASK_LOG_SHIPPING_UTILS_H
+#define PRESENTATION_TASK_LOG_SHIPPING_UTILS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "domain/models/error.h"
+#include "domain/models/logger.h"
+#include "presentation/task/log_shipping/types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+dom_models_error_t pres_task_log_shipping_validate_cfg(
+    const pres_task_log_shipping_cfg_t* cfg
+);
+
+void pres_task_log_shipping_normalize_cfg(
+    pres_task_log_shipping_cfg_t*       out,
+    const pres_task_log_shipping_cfg_t* cfg
+);
+
+dom_models_logger_level_t pres_task_log_shipping_parse_level(
+    const char* msg,
+    size_t      msg_len
+);
+
+bool pres_task_log_shipping_batch_append(
+    pres_task_log_shipping_batch_t* batch,
+    size_t                          record_max_cnt,
+    dom_models_logger_level_t       level,
+    const char*                     msg,
+    size_t                          msg_len,
+    size_t*                         evicted_cnt
+);
+
+size_t pres_task_log_shipping_encode_head(
+    uint8_t* buf,
+    size_t   buf_size,
+    int64_t  uptime_us,
+    int64_t  unix_ms
+);
+
+size_t pres_task_log_shipping_encode_record(
+    uint8_t*                          buf,
+    size_t                            buf_size,
+    const dom_models_logger_record_t* record
+);
+
+void pres_task_log_shipping_batch_clear(
+    pres_task_log_shipping_batch_t* batch
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRESENTATION_TASK_LOG_SHIPPING_UTILS_H */
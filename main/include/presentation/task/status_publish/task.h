@@ -0,0 +1,36 @@
+#ifndef PRESENTATION_TASK_STATUS_PUBLISH_TASK_H
+#define PRESENTATION_TASK_STATUS_PUBLISH_TASK_H
+
+#include "domain/models/error.h"
+#include "presentation/task/status_publish/types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+pres_task_status_publish_t* pres_task_status_publish_new(
+    const pres_task_status_publish_cfg_t* cfg
+);
+
+void pres_task_status_publish_delete(
+    pres_task_status_publish_t* self
+);
+
+dom_models_error_t pres_task_status_publish_start(
+    pres_task_status_publish_t* self
+);
+
+dom_models_error_t pres_task_status_publish_stop(
+    pres_task_status_publish_t* self
+);
+
+dom_models_error_t pres_task_status_publish_get_stats(
+    pres_task_status_publish_t*       self,
+    pres_task_status_publish_stats_t* out
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRESENTATION_TASK_STATUS_PUBLISH_TASK_H */
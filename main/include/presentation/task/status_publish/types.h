@@ -0,0 +1,87 @@
+#ifndef PRESENTATION_TASK_STATUS_PUBLISH_TYPES_H
+#define PRESENTATION_TASK_STATUS_PUBLISH_TYPES_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "domain/contracts/messaging/publish.h"
+#include "domain/models/messaging.h"
+#include "domain/models/network.h"
+#include "domain/usecases/netif.h"
+#include "domain/usecases/ota.h"
+#include "domain/usecases/wifiman.h"
+#include "freertos/FreeRTOS.h"  // IWYU pragma: keep
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PRES_TASK_STATUS_PUBLISH_DEFAULT_TASK_NAME          "status_publish"
+#define PRES_TASK_STATUS_PUBLISH_DEFAULT_STACK_SIZE         4096
+#define PRES_TASK_STATUS_PUBLISH_DEFAULT_PRIORITY           3
+#define PRES_TASK_STATUS_PUBLISH_DEFAULT_SAMPLE_INTERVAL_MS 1000
+#define PRES_TASK_STATUS_PUBLISH_DEFAULT_DEBOUNCE_MS        2000
+#define PRES_TASK_STATUS_PUBLISH_DEFAULT_HEARTBEAT_MS       300000
+#define PRES_TASK_STATUS_PUBLISH_DEFAULT_STATUS             "online"
+#define PRES_TASK_STATUS_PUBLISH_DEFAULT_STOP_TIMEOUT_MS    1000
+
+/* Wifiman, netif and ota are optional, missing sources leave their fields unset */
+typedef struct {
+    dom_contracts_messaging_publish_t* publish;
+    dom_usecases_wifiman_t*            wifiman;
+    dom_usecases_netif_t*              netif;
+    dom_usecases_ota_t*                ota;
+    const char*                        task_name;
+    uint32_t                           stack_size;
+    UBaseType_t                        priority;
+    uint32_t                           sample_interval_ms;
+    uint32_t                           debounce_ms;
+    uint32_t                           heartbeat_ms;
+} pres_task_status_publish_cfg_t;
+
+typedef struct {
+    uint32_t sample_cnt;
+    uint32_t change_publish_cnt;
+    uint32_t heartbeat_publish_cnt;
+    uint32_t saved_cnt;
+    uint32_t failed_cnt;
+} pres_task_status_publish_stats_t;
+
+typedef enum {
+    PRES_TASK_STATUS_PUBLISH_DECISION_SKIP = 0,
+    PRES_TASK_STATUS_PUBLISH_DECISION_CHANGE,
+    PRES_TASK_STATUS_PUBLISH_DECISION_HEARTBEAT,
+} pres_task_status_publish_decision_t;
+
+/*
+ * Last snapshot accepted by the broker for the status topic. A change
+ * opens a debounce window, further changes inside it only replace the
+ * sample, and a sample that returns to the published state closes it.
+ */
+typedef struct {
+    bool                          published;
+    dom_models_messaging_status_t last;
+    int64_t                       last_publish_ms;
+    bool                          pending;
+    int64_t                       pending_since_ms;
+} pres_task_status_publish_delta_t;
+
+typedef struct pres_task_status_publish_t {
+    pres_task_status_publish_cfg_t   cfg;
+    pres_task_status_publish_delta_t delta;
+    pres_task_status_publish_stats_t stats;
+    SemaphoreHandle_t                lock;
+    dom_usecases_wifiman_status_t    wifiman_status;
+    dom_models_network_interface_t   ethernet;
+    TaskHandle_t                     task_handle;
+    bool                             started;
+    volatile bool                    stop_requested;
+} pres_task_status_publish_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRESENTATION_TASK_STATUS_PUBLISH_TYPES_H */
@@ -0,0 +1,59 @@
+#ifndef PRESENTATION_TASK_STATUS_PUBLISH_UTILS_H
+#define PRESENTATION_TASK_STATUS_PUBLISH_UTILS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "domain/models/error.h"
+#include "domain/models/messaging.h"
+#include "presentation/task/status_publish/types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+dom_models_error_t pres_task_status_publish_validate_cfg(
+    const pres_task_status_publish_cfg_t* cfg
+);
+
+void pres_task_status_publish_normalize_cfg(
+    pres_task_status_publish_cfg_t*       out,
+    const pres_task_status_publish_cfg_t* cfg
+);
+
+uint8_t pres_task_status_publish_rssi_bucket(
+    bool   connected,
+    int8_t rssi
+);
+
+/* Fills out from the configured usecases, scratch buffers live in self */
+void pres_task_status_publish_collect(
+    pres_task_status_publish_t*    self,
+    dom_models_messaging_status_t* out
+);
+
+bool pres_task_status_publish_status_equal(
+    const dom_models_messaging_status_t* a,
+    const dom_models_messaging_status_t* b
+);
+
+pres_task_status_publish_decision_t pres_task_status_publish_delta_evaluate(
+    pres_task_status_publish_delta_t*    delta,
+    const dom_models_messaging_status_t* sample,
+    int64_t                              now_ms,
+    uint32_t                             debounce_ms,
+    uint32_t                             heartbeat_ms
+);
+
+/* Records a sample the broker accepted */
+void pres_task_status_publish_delta_commit(
+    pres_task_status_publish_delta_t*    delta,
+    const dom_models_messaging_status_t* sample,
+    int64_t                              now_ms
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRESENTATION_TASK_STATUS_PUBLISH_UTILS_H */
@@ -0,0 +1,31 @@
+#ifndef PRESENTATION_TASK_WIFIMAN_LINK_MONITOR_TASK_H
+#define PRESENTATION_TASK_WIFIMAN_LINK_MONITOR_TASK_H
+
+#include "domain/models/error.h"
+#include "presentation/task/wifiman_link_monitor/types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+pres_task_wifiman_link_monitor_t* pres_task_wifiman_link_monitor_new(
+    const pres_task_wifiman_link_monitor_cfg_t* cfg
+);
+
+void pres_task_wifiman_link_monitor_delete(
+    pres_task_wifiman_link_monitor_t* self
+);
+
+dom_models_error_t pres_task_wifiman_link_monitor_start(
+    pres_task_wifiman_link_monitor_t* self
+);
+
+dom_models_error_t pres_task_wifiman_link_monitor_stop(
+    pres_task_wifiman_link_monitor_t* self
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRESENTATION_TASK_WIFIMAN_LINK_MONITOR_TASK_H */
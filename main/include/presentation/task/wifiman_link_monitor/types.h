@@ -0,0 +1,41 @@
+#ifndef PRESENTATION_TASK_WIFIMAN_LINK_MONITOR_TYPES_H
+#define PRESENTATION_TASK_WIFIMAN_LINK_MONITOR_TYPES_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "domain/usecases/wifiman.h"
+#include "freertos/FreeRTOS.h"  // IWYU pragma: keep
+#include "freertos/task.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PRES_TASK_WIFIMAN_LINK_MONITOR_DEFAULT_TASK_NAME          "wifiman_link_monitor"
+#define PRES_TASK_WIFIMAN_LINK_MONITOR_DEFAULT_STACK_SIZE         4096
+#define PRES_TASK_WIFIMAN_LINK_MONITOR_DEFAULT_PRIORITY           3
+#define PRES_TASK_WIFIMAN_LINK_MONITOR_DEFAULT_SAMPLE_INTERVAL_MS 5000
+#define PRES_TASK_WIFIMAN_LINK_MONITOR_DEFAULT_STOP_TIMEOUT_MS    1000
+
+/* The wifiman roam settings count samples, so they scale with sample_interval_ms */
+typedef struct {
+    dom_usecases_wifiman_t* wifiman;
+    const char*             task_name;
+    uint32_t                stack_size;
+    UBaseType_t             priority;
+    uint32_t                sample_interval_ms;
+} pres_task_wifiman_link_monitor_cfg_t;
+
+typedef struct pres_task_wifiman_link_monitor_t {
+    pres_task_wifiman_link_monitor_cfg_t cfg;
+    TaskHandle_t                         task_handle;
+    bool                                 started;
+    volatile bool                        stop_requested;
+} pres_task_wifiman_link_monitor_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRESENTATION_TASK_WIFIMAN_LINK_MONITOR_TYPES_H */
@@ -0,0 +1,24 @@
+#ifndef PRESENTATION_TASK_WIFIMAN_LINK_MONITOR_UTILS_H
+#define PRESENTATION_TASK_WIFIMAN_LINK_MONITOR_UTILS_H
+
+#include "domain/models/error.h"
+#include "presentation/task/wifiman_link_monitor/types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+dom_models_error_t pres_task_wifiman_link_monitor_validate_cfg(
+    const pres_task_wifiman_link_monitor_cfg_t* cfg
+);
+
+void pres_task_wifiman_link_monitor_normalize_cfg(
+    pres_task_wifiman_link_monitor_cfg_t*       out,
+    const pres_task_wifiman_link_monitor_cfg_t* cfg
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRESENTATION_TASK_WIFIMAN_LINK_MONITOR_UTILS_H */
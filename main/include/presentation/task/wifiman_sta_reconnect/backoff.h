@@ -0,0 +1,63 @@
+#ifndef PRESENTATION_TASK_WIFIMAN_STA_RECONNECT_BACKOFF_H
+#define PRESENTATION_TASK_WIFIMAN_STA_RECONNECT_BACKOFF_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    uint32_t base_ms;
+    uint32_t max_ms;
+    uint8_t  jitter_pct;
+} pres_task_wifiman_sta_reconnect_backoff_cfg_t;
+
+/*
+ * Reconnect schedule, free of RTOS calls so it can be driven with a fake
+ * clock. Idle while the link is up or there is nothing to reconnect,
+ * otherwise due_ms is the uptime of the next attempt and every failed
+ * attempt doubles the delay up to max_ms.
+ */
+typedef struct {
+    bool     pending;
+    uint32_t attempt_cnt;
+    int64_t  due_ms;
+    uint32_t rng;
+} pres_task_wifiman_sta_reconnect_backoff_t;
+
+void pres_task_wifiman_sta_reconnect_backoff_init(
+    pres_task_wifiman_sta_reconnect_backoff_t* backoff,
+    uint32_t                                   seed
+);
+
+/* Schedules the first attempt within base_ms, a link already pending keeps its schedule */
+void pres_task_wifiman_sta_reconnect_backoff_on_disconnected(
+    pres_task_wifiman_sta_reconnect_backoff_t*           backoff,
+    const pres_task_wifiman_sta_reconnect_backoff_cfg_t* cfg,
+    int64_t                                              now_ms
+);
+
+/* Parks the schedule until the next on_disconnected, the next drop starts over */
+void pres_task_wifiman_sta_reconnect_backoff_on_connected(
+    pres_task_wifiman_sta_reconnect_backoff_t* backoff
+);
+
+void pres_task_wifiman_sta_reconnect_backoff_on_attempt(
+    pres_task_wifiman_sta_reconnect_backoff_t*           backoff,
+    const pres_task_wifiman_sta_reconnect_backoff_cfg_t* cfg,
+    int64_t                                              now_ms
+);
+
+/* Milliseconds until the next attempt, 0 when due and -1 when idle */
+int64_t pres_task_wifiman_sta_reconnect_backoff_wait_ms(
+    const pres_task_wifiman_sta_reconnect_backoff_t* backoff,
+    int64_t                                          now_ms
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRESENTATION_TASK_WIFIMAN_STA_RECONNECT_BACKOFF_H */
@@ -2,6 +2,7 @@
 #define PRESENTATION_TASK_WIFIMAN_STA_RECONNECT_TASK_H
 
 #include "domain/models/error.h"
+#include "domain/models/wifi.h"
 #include "presentation/task/wifiman_sta_reconnect/types.h"
 
 #ifdef __cplusplus
@@ -24,6 +25,12 @@ dom_models_error_t pres_task_wifiman_sta_reconnect_stop(
     pres_task_wifiman_sta_reconnect_t* self
 );
 
+/* WiFi event callback, wakes the task on STA link changes with self as cb_ctx */
+void pres_task_wifiman_sta_reconnect_on_wifi_event(
+    void*                          cb_ctx,
+    const dom_models_wifi_event_t* event
+);
+
 #ifdef __cplusplus
 }
 #endif
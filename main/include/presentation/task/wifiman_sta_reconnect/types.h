@@ -4,32 +4,47 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "domain/contracts/system/clock.h"
 #include "domain/usecases/wifiman.h"
 #include "freertos/FreeRTOS.h"  // IWYU pragma: keep
 #include "freertos/task.h"
+#include "presentation/task/wifiman_sta_reconnect/backoff.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-#define PRES_TASK_WIFIMAN_STA_RECONNECT_DEFAULT_TASK_NAME   "wifiman_sta_reconnect"
-#define PRES_TASK_WIFIMAN_STA_RECONNECT_DEFAULT_STACK_SIZE  4096
-#define PRES_TASK_WIFIMAN_STA_RECONNECT_DEFAULT_PRIORITY    5
-#define PRES_TASK_WIFIMAN_STA_RECONNECT_DEFAULT_INTERVAL_MS 5000
+#define PRES_TASK_WIFIMAN_STA_RECONNECT_DEFAULT_TASK_NAME       "wifiman_sta_reconnect"
+#define PRES_TASK_WIFIMAN_STA_RECONNECT_DEFAULT_STACK_SIZE      4096
+#define PRES_TASK_WIFIMAN_STA_RECONNECT_DEFAULT_PRIORITY        5
+#define PRES_TASK_WIFIMAN_STA_RECONNECT_DEFAULT_BACKOFF_BASE_MS 1000
+#define PRES_TASK_WIFIMAN_STA_RECONNECT_DEFAULT_BACKOFF_MAX_MS  60000
+#define PRES_TASK_WIFIMAN_STA_RECONNECT_DEFAULT_JITTER_PCT      50
+#define PRES_TASK_WIFIMAN_STA_RECONNECT_DEFAULT_STOP_TIMEOUT_MS 1000
+
+/* Notification bits the WiFi event callback sets on the task */
+#define PRES_TASK_WIFIMAN_STA_RECONNECT_NOTIFY_CONNECTED    (1u << 0)
+#define PRES_TASK_WIFIMAN_STA_RECONNECT_NOTIFY_DISCONNECTED (1u << 1)
+#define PRES_TASK_WIFIMAN_STA_RECONNECT_NOTIFY_STOP         (1u << 2)
 
 typedef struct {
-    dom_usecases_wifiman_t* wifiman;
-    const char*             task_name;
-    uint32_t                stack_size;
-    UBaseType_t             priority;
-    uint32_t                interval_ms;
+    dom_usecases_wifiman_t*       wifiman;
+    dom_contracts_system_clock_t* clock;
+    const char*                   task_name;
+    uint32_t                      stack_size;
+    UBaseType_t                   priority;
+    uint32_t                      backoff_base_ms;
+    uint32_t                      backoff_max_ms;
+    uint8_t                       jitter_pct;
 } pres_task_wifiman_sta_reconnect_cfg_t;
 
 typedef struct pres_task_wifiman_sta_reconnect_t {
-    pres_task_wifiman_sta_reconnect_cfg_t cfg;
-    TaskHandle_t                          task_handle;
-    bool                                  started;
-    volatile bool                         stop_requested;
+    pres_task_wifiman_sta_reconnect_cfg_t         cfg;
+    pres_task_wifiman_sta_reconnect_backoff_cfg_t backoff_cfg;
+    pres_task_wifiman_sta_reconnect_backoff_t     backoff;
+    TaskHandle_t                                  task_handle;
+    bool                                          started;
+    volatile bool                                 stop_requested;
 } pres_task_wifiman_sta_reconnect_t;
 
 #ifdef __cplusplus
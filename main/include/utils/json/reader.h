@@ -0,0 +1,101 @@
+#ifndef UTILS_JSON_READER_H
+#define UTILS_JSON_READER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define UTILS_JSON_READER_TOKEN_MAX_CNT 32
+#define UTILS_JSON_READER_DEPTH_MAX     32
+#define UTILS_JSON_READER_NONE          (-1)
+
+typedef enum {
+    UTILS_JSON_READER_TYPE_UNDEFINED = 0,
+    UTILS_JSON_READER_TYPE_OBJECT,
+    UTILS_JSON_READER_TYPE_ARRAY,
+    UTILS_JSON_READER_TYPE_STRING,
+    UTILS_JSON_READER_TYPE_NUMBER,
+    UTILS_JSON_READER_TYPE_BOOL,
+    UTILS_JSON_READER_TYPE_NULL,
+} utils_json_reader_type_t;
+
+/* String tokens span the bytes between the quotes, still escaped */
+typedef struct {
+    uint8_t  type;
+    bool     escaped;
+    uint16_t start;
+    uint16_t end;
+} utils_json_reader_token_t;
+
+/*
+ * In-place JSON tokenizer for small request bodies. The whole document is
+ * validated, but only the root and its direct members are kept as tokens,
+ * so flat DTO schemas fit in a fixed token array and nothing is allocated.
+ * Token 0 is the root; for an object root, keys and values alternate
+ * after it. The source buffer must outlive the reader.
+ *
+ * Acceptance follows cJSON_ParseWithLength, which it replaces: bytes up to
+ * 0x20 count as whitespace, numbers are read by strtod, decoded strings end
+ * at the first NUL, and bytes after the root value are ignored.
+ */
+typedef struct {
+    const char*               json;
+    size_t                    json_len;
+    size_t                    token_cnt;
+    utils_json_reader_token_t tokens[UTILS_JSON_READER_TOKEN_MAX_CNT];
+} utils_json_reader_t;
+
+/* Leaves an empty reader, standing for a missing body */
+void utils_json_reader_reset(utils_json_reader_t* r);
+
+/* False on a syntax error, too deep nesting, or too many root members */
+bool utils_json_reader_parse(
+    utils_json_reader_t* r,
+    const char*          json,
+    size_t               json_len
+);
+
+bool utils_json_reader_empty(const utils_json_reader_t* r);
+
+bool utils_json_reader_is_object(const utils_json_reader_t* r);
+
+/* Returns the token of the first member named key, or UTILS_JSON_READER_NONE */
+int utils_json_reader_find(
+    const utils_json_reader_t* r,
+    const char*                key
+);
+
+utils_json_reader_type_t utils_json_reader_type(
+    const utils_json_reader_t* r,
+    int                        token
+);
+
+/* Decodes into out, false if the token is not a string or does not fit */
+bool utils_json_reader_get_string(
+    const utils_json_reader_t* r,
+    int                        token,
+    char*                      out,
+    size_t                     out_size
+);
+
+bool utils_json_reader_get_number(
+    const utils_json_reader_t* r,
+    int                        token,
+    double*                    out
+);
+
+bool utils_json_reader_get_bool(
+    const utils_json_reader_t* r,
+    int                        token,
+    bool*                      out
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* UTILS_JSON_READER_H */
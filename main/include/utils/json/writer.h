@@ -0,0 +1,130 @@
+#ifndef UTILS_JSON_WRITER_H
+#define UTILS_JSON_WRITER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Longest escape one input byte expands to, a control character written as \u00XX */
+#define UTILS_JSON_WRITER_ESCAPE_MAX_LEN 6
+
+/* Receives buffered output in stream mode, returning false aborts the document */
+typedef bool (*utils_json_writer_flush_t)(void* flush_ctx, const char* data, size_t data_len);
+
+/*
+ * Streaming JSON writer over a caller-provided buffer. Nothing is
+ * allocated. Once a write does not fit, the writer latches the overflow
+ * and ignores further writes, so callers may check the result once in
+ * utils_json_writer_finish(). String escaping follows cJSON's output.
+ *
+ * In stream mode the buffer is only scratch: whenever it fills up, its
+ * contents are handed to the flush callback and reused, so documents of
+ * any size are written in constant memory. Overflow then means the
+ * callback failed.
+ */
+typedef struct {
+    char*                     buf;
+    size_t                    buf_size;
+    size_t                    len;
+    bool                      need_comma;
+    bool                      overflow;
+    utils_json_writer_flush_t flush;
+    void*                     flush_ctx;
+    size_t                    flushed_len;
+} utils_json_writer_t;
+
+void utils_json_writer_init(
+    utils_json_writer_t* w,
+    char*                buf,
+    size_t               buf_size
+);
+
+void utils_json_writer_init_stream(
+    utils_json_writer_t*      w,
+    char*                     buf,
+    size_t                    buf_size,
+    utils_json_writer_flush_t flush,
+    void*                     flush_ctx
+);
+
+bool utils_json_writer_object_begin(utils_json_writer_t* w);
+
+bool utils_json_writer_object_end(utils_json_writer_t* w);
+
+bool utils_json_writer_array_begin(utils_json_writer_t* w);
+
+bool utils_json_writer_array_end(utils_json_writer_t* w);
+
+bool utils_json_writer_key(
+    utils_json_writer_t* w,
+    const char*          key
+);
+
+bool utils_json_writer_string(
+    utils_json_writer_t* w,
+    const char*          value
+);
+
+bool utils_json_writer_string_len(
+    utils_json_writer_t* w,
+    const char*          value,
+    size_t               value_len
+);
+
+bool utils_json_writer_int(
+    utils_json_writer_t* w,
+    int64_t              value
+);
+
+bool utils_json_writer_uint(
+    utils_json_writer_t* w,
+    uint64_t             value
+);
+
+bool utils_json_writer_bool(
+    utils_json_writer_t* w,
+    bool                 value
+);
+
+bool utils_json_writer_null(utils_json_writer_t* w);
+
+bool utils_json_writer_kv_string(
+    utils_json_writer_t* w,
+    const char*          key,
+    const char*          value
+);
+
+bool utils_json_writer_kv_int(
+    utils_json_writer_t* w,
+    const char*          key,
+    int64_t              value
+);
+
+bool utils_json_writer_kv_uint(
+    utils_json_writer_t* w,
+    const char*          key,
+    uint64_t             value
+);
+
+bool utils_json_writer_kv_bool(
+    utils_json_writer_t* w,
+    const char*          key,
+    bool                 value
+);
+
+/*
+ * Returns the NUL-terminated length, or 0 if anything overflowed. In
+ * stream mode the remaining output is flushed first and the total number
+ * of bytes handed to the callback is returned.
+ */
+size_t utils_json_writer_finish(utils_json_writer_t* w);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* UTILS_JSON_WRITER_H */
@@ -0,0 +1,60 @@
+#ifndef UTILS_MQTT_TOPIC_TABLE_H
+#define UTILS_MQTT_TOPIC_TABLE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define UTILS_MQTT_TOPIC_TABLE_MAX_CNT       16
+#define UTILS_MQTT_TOPIC_TABLE_TOPIC_MAX_LEN 96
+
+typedef struct {
+    uint16_t len;
+    char     str[UTILS_MQTT_TOPIC_TABLE_TOPIC_MAX_LEN];
+} utils_mqtt_topic_t;
+
+/*
+ * Per-device topics formatted once as "/<root>/<device_id>/<suffix>" and
+ * kept NUL-terminated with their length. Ids are table indices handed out
+ * in registration order. Lookups check the shared prefix once, then match
+ * entries by length and memcmp of the suffix bytes.
+ */
+typedef struct {
+    utils_mqtt_topic_t prefix;
+    utils_mqtt_topic_t topics[UTILS_MQTT_TOPIC_TABLE_MAX_CNT];
+    size_t             cnt;
+} utils_mqtt_topic_table_t;
+
+bool utils_mqtt_topic_table_init(
+    utils_mqtt_topic_table_t* table,
+    const char*               root,
+    const char*               device_id
+);
+
+/* Returns the topic id, the existing id for a known suffix, or -1 */
+int utils_mqtt_topic_table_add(
+    utils_mqtt_topic_table_t* table,
+    const char*               suffix
+);
+
+const utils_mqtt_topic_t* utils_mqtt_topic_table_get(
+    const utils_mqtt_topic_table_t* table,
+    int                             id
+);
+
+/* Topic does not need to be NUL-terminated, returns -1 when unknown */
+int utils_mqtt_topic_table_find(
+    const utils_mqtt_topic_table_t* table,
+    const char*                     topic,
+    size_t                          topic_len
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* UTILS_MQTT_TOPIC_TABLE_H */
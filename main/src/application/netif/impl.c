@@ -45,7 +45,7 @@ dom_usecases_netif_t* app_netif_impl_new(const app_netif_impl_cfg_t* cfg) {
 
     app_netif_impl_ctx_t* ctx = (app_netif_impl_ctx_t*)calloc(1, sizeof(app_netif_impl_ctx_t));
     if (!ctx) {
-        cfg->logger->error(cfg->logger, tag, "Failed to allocate Netif context: %s (%d)", dom_models_error_str(DOMAIN_MODELS_ERROR_MALLOC_FAILED), (int)DOMAIN_MODELS_ERROR_MALLOC_FAILED);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(cfg->logger, tag, "Failed to allocate Netif context: %s (%d)", dom_models_error_str(DOMAIN_MODELS_ERROR_MALLOC_FAILED), (int)DOMAIN_MODELS_ERROR_MALLOC_FAILED);
         return NULL;
     }
 
@@ -53,7 +53,7 @@ dom_usecases_netif_t* app_netif_impl_new(const app_netif_impl_cfg_t* cfg) {
 
     dom_usecases_netif_t* self = dom_usecases_netif_new(ctx);
     if (!self) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to allocate Netif usecase: %s (%d)", dom_models_error_str(DOMAIN_MODELS_ERROR_MALLOC_FAILED), (int)DOMAIN_MODELS_ERROR_MALLOC_FAILED);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to allocate Netif usecase: %s (%d)", dom_models_error_str(DOMAIN_MODELS_ERROR_MALLOC_FAILED), (int)DOMAIN_MODELS_ERROR_MALLOC_FAILED);
         free(ctx);
         return NULL;
     }
@@ -62,7 +62,7 @@ dom_usecases_netif_t* app_netif_impl_new(const app_netif_impl_cfg_t* cfg) {
     self->get_wifi_sta = get_wifi_sta_impl;
     self->get_ethernet = get_ethernet_impl;
 
-    ctx->cfg.logger->info(ctx->cfg.logger, tag, "Netif created successfully");
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "Netif created successfully");
 
     return self;
 }
@@ -76,7 +76,7 @@ void app_netif_impl_delete(dom_usecases_netif_t* self) {
 
     app_netif_impl_ctx_t* ctx = self->ctx;
     if (ctx) {
-        ctx->cfg.logger->info(ctx->cfg.logger, tag, "Netif deleted successfully");
+        DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "Netif deleted successfully");
         free(ctx);
     }
 
@@ -99,17 +99,17 @@ static dom_models_error_t get_all_impl(
 
     if (!out) {
         err = DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Missing network output: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Missing network output: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
     err = ctx->cfg.network_interface->get_all(ctx->cfg.network_interface, out);
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to get all network interfaces: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to get all network interfaces: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
-    ctx->cfg.logger->info(ctx->cfg.logger, tag, "Network interfaces retrieved successfully");
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "Network interfaces retrieved successfully");
 
     return DOMAIN_MODELS_ERROR_OK;
 }
@@ -128,17 +128,17 @@ static dom_models_error_t get_wifi_sta_impl(
 
     if (!out) {
         err = DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Missing WiFi STA network interface output: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Missing WiFi STA network interface output: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
     err = ctx->cfg.network_interface->get_wifi_sta(ctx->cfg.network_interface, out);
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to get WiFi STA network interface: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to get WiFi STA network interface: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
-    ctx->cfg.logger->info(ctx->cfg.logger, tag, "WiFi STA network interface retrieved successfully");
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "WiFi STA network interface retrieved successfully");
 
     return DOMAIN_MODELS_ERROR_OK;
 }
@@ -157,17 +157,17 @@ static dom_models_error_t get_ethernet_impl(
 
     if (!out) {
         err = DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Missing Ethernet network interface output: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Missing Ethernet network interface output: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
     err = ctx->cfg.network_interface->get_ethernet(ctx->cfg.network_interface, out);
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to get Ethernet network interface: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to get Ethernet network interface: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
-    ctx->cfg.logger->info(ctx->cfg.logger, tag, "Ethernet network interface retrieved successfully");
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "Ethernet network interface retrieved successfully");
 
     return DOMAIN_MODELS_ERROR_OK;
 }
@@ -6,6 +6,7 @@
 #include "application/ota/impl_types.h"
 #include "application/ota/impl_utils.h"
 #include "domain/models/error.h"
+#include "domain/models/update.h"
 #include "domain/usecases/ota.h"
 
 
@@ -47,7 +48,7 @@ dom_usecases_ota_t* app_ota_impl_new(const app_ota_impl_cfg_t* cfg) {
 
     app_ota_impl_ctx_t* ctx = (app_ota_impl_ctx_t*)calloc(1, sizeof(app_ota_impl_ctx_t));
     if (!ctx) {
-        cfg->logger->error(cfg->logger, tag, "Failed to allocate OTA context: %s (%d)", dom_models_error_str(DOMAIN_MODELS_ERROR_MALLOC_FAILED), (int)DOMAIN_MODELS_ERROR_MALLOC_FAILED);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(cfg->logger, tag, "Failed to allocate OTA context: %s (%d)", dom_models_error_str(DOMAIN_MODELS_ERROR_MALLOC_FAILED), (int)DOMAIN_MODELS_ERROR_MALLOC_FAILED);
         return NULL;
     }
 
@@ -56,7 +57,7 @@ dom_usecases_ota_t* app_ota_impl_new(const app_ota_impl_cfg_t* cfg) {
 
     dom_usecases_ota_t* self = dom_usecases_ota_new(ctx);
     if (!self) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to allocate OTA usecase: %s (%d)", dom_models_error_str(DOMAIN_MODELS_ERROR_MALLOC_FAILED), (int)DOMAIN_MODELS_ERROR_MALLOC_FAILED);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to allocate OTA usecase: %s (%d)", dom_models_error_str(DOMAIN_MODELS_ERROR_MALLOC_FAILED), (int)DOMAIN_MODELS_ERROR_MALLOC_FAILED);
         free(ctx);
         return NULL;
     }
@@ -66,7 +67,7 @@ dom_usecases_ota_t* app_ota_impl_new(const app_ota_impl_cfg_t* cfg) {
     self->rollback   = rollback_impl;
     self->get_status = get_status_impl;
 
-    ctx->cfg.logger->info(ctx->cfg.logger, tag, "OTA created successfully");
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "OTA created successfully");
 
     return self;
 }
@@ -80,7 +81,7 @@ void app_ota_impl_delete(dom_usecases_ota_t* self) {
 
     app_ota_impl_ctx_t* ctx = self->ctx;
     if (ctx) {
-        ctx->cfg.logger->info(ctx->cfg.logger, tag, "OTA deleted successfully");
+        DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "OTA deleted successfully");
         free(ctx);
     }
 
@@ -103,28 +104,28 @@ static dom_models_error_t update_impl(
 
     err = app_ota_impl_validate_update_info(update_info);
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Invalid update info: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Invalid update info: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
     if (ctx->updating) {
         err = DOMAIN_MODELS_ERROR_BAD_STATE;
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "OTA update already in progress: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "OTA update already in progress: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
     ctx->updating = true;
-    ctx->cfg.logger->info(ctx->cfg.logger, tag, "Starting OTA update from URL: %s", update_info->firmware_url);
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "Starting OTA update from URL: %s", update_info->firmware_url);
 
     err           = ctx->cfg.update->update(ctx->cfg.update, update_info);
     ctx->updating = false;
 
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "OTA update failed: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "OTA update failed: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
-    ctx->cfg.logger->info(ctx->cfg.logger, tag, "OTA update completed successfully. System will restart in 5 seconds...");
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "OTA update completed successfully. System will restart in 5 seconds...");
 
     (void)ctx->cfg.restart->restart(ctx->cfg.restart, 5000);
 
@@ -142,15 +143,15 @@ static dom_models_error_t validate_impl(
         return err;
     }
 
-    ctx->cfg.logger->info(ctx->cfg.logger, tag, "Validating running application partition");
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "Validating running application partition");
 
     err = ctx->cfg.update->validate(ctx->cfg.update);
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to validate running partition: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to validate running partition: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
-    ctx->cfg.logger->info(ctx->cfg.logger, tag, "Running partition validated successfully");
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "Running partition validated successfully");
     return DOMAIN_MODELS_ERROR_OK;
 }
 
@@ -165,15 +166,15 @@ static dom_models_error_t rollback_impl(
         return err;
     }
 
-    ctx->cfg.logger->info(ctx->cfg.logger, tag, "Requesting rollback to previous partition");
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "Requesting rollback to previous partition");
 
     err = ctx->cfg.update->rollback(ctx->cfg.update);
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to perform rollback: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to perform rollback: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
-    ctx->cfg.logger->info(ctx->cfg.logger, tag, "Rollback call finished");
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "Rollback call finished");
     return DOMAIN_MODELS_ERROR_OK;
 }
 
@@ -191,11 +192,20 @@ static dom_models_error_t get_status_impl(
 
     if (!out) {
         err = DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Missing OTA status output pointer: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Missing OTA status output pointer: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
-    out->updating = ctx->updating;
+    out->updating     = ctx->updating;
+    out->written_size = 0;
+    out->total_size   = 0;
+
+    dom_models_update_progress_t progress = {0};
+    if (out->updating && ctx->cfg.update->get_progress && ctx->cfg.update->get_progress(ctx->cfg.update, &progress) == DOMAIN_MODELS_ERROR_OK) {
+        out->written_size = progress.written_size;
+        out->total_size   = progress.total_size;
+    }
+
     return DOMAIN_MODELS_ERROR_OK;
 }
 
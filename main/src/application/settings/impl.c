@@ -49,7 +49,7 @@ dom_usecases_settings_t* app_settings_impl_new(const app_settings_impl_cfg_t* cf
 
     app_settings_impl_ctx_t* ctx = (app_settings_impl_ctx_t*)calloc(1, sizeof(app_settings_impl_ctx_t));
     if (!ctx) {
-        cfg->logger->error(cfg->logger, tag, "Failed to allocate Settings context: %s (%d)", dom_models_error_str(DOMAIN_MODELS_ERROR_MALLOC_FAILED), (int)DOMAIN_MODELS_ERROR_MALLOC_FAILED);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(cfg->logger, tag, "Failed to allocate Settings context: %s (%d)", dom_models_error_str(DOMAIN_MODELS_ERROR_MALLOC_FAILED), (int)DOMAIN_MODELS_ERROR_MALLOC_FAILED);
         return NULL;
     }
 
@@ -57,7 +57,7 @@ dom_usecases_settings_t* app_settings_impl_new(const app_settings_impl_cfg_t* cf
 
     dom_usecases_settings_t* self = dom_usecases_settings_new(ctx);
     if (!self) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to allocate Settings usecase: %s (%d)", dom_models_error_str(DOMAIN_MODELS_ERROR_MALLOC_FAILED), (int)DOMAIN_MODELS_ERROR_MALLOC_FAILED);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to allocate Settings usecase: %s (%d)", dom_models_error_str(DOMAIN_MODELS_ERROR_MALLOC_FAILED), (int)DOMAIN_MODELS_ERROR_MALLOC_FAILED);
         free(ctx);
         return NULL;
     }
@@ -67,7 +67,7 @@ dom_usecases_settings_t* app_settings_impl_new(const app_settings_impl_cfg_t* cf
     self->get_restart_required = get_restart_required_impl;
     self->restart              = restart_impl;
 
-    ctx->cfg.logger->info(ctx->cfg.logger, tag, "Settings created successfully");
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "Settings created successfully");
 
     return self;
 }
@@ -81,7 +81,7 @@ void app_settings_impl_delete(dom_usecases_settings_t* self) {
 
     app_settings_impl_ctx_t* ctx = self->ctx;
     if (ctx) {
-        ctx->cfg.logger->info(ctx->cfg.logger, tag, "Settings deleted successfully");
+        DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "Settings deleted successfully");
         free(ctx);
     }
 
@@ -104,17 +104,17 @@ static dom_models_error_t get_snapshot_impl(
 
     if (!out) {
         err = DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Missing settings snapshot output: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Missing settings snapshot output: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
     err = app_settings_impl_load_snapshot(ctx, out);
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to get settings snapshot: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to get settings snapshot: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
-    ctx->cfg.logger->info(ctx->cfg.logger, tag, "Settings snapshot retrieved successfully");
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "Settings snapshot retrieved successfully");
 
     return DOMAIN_MODELS_ERROR_OK;
 }
@@ -134,14 +134,14 @@ static dom_models_error_t set_preloaded_impl(
 
     if (!app_settings_impl_has_preloaded_update(update)) {
         err = DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Missing preloaded update values: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Missing preloaded update values: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
     if (update->wifi_ap_ssid_set) {
         err = ctx->cfg.preloaded_repository->set_wifi_ap_ssid(ctx->cfg.preloaded_repository, update->wifi_ap_ssid);
         if (err != DOMAIN_MODELS_ERROR_OK) {
-            ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to set WiFi AP SSID: %s (%d)", dom_models_error_str(err), (int)err);
+            DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to set WiFi AP SSID: %s (%d)", dom_models_error_str(err), (int)err);
             return err;
         }
         ctx->restart_required = true;
@@ -150,7 +150,7 @@ static dom_models_error_t set_preloaded_impl(
     if (update->wifi_ap_pass_set) {
         err = ctx->cfg.preloaded_repository->set_wifi_ap_pass(ctx->cfg.preloaded_repository, update->wifi_ap_pass);
         if (err != DOMAIN_MODELS_ERROR_OK) {
-            ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to set WiFi AP password: %s (%d)", dom_models_error_str(err), (int)err);
+            DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to set WiFi AP password: %s (%d)", dom_models_error_str(err), (int)err);
             return err;
         }
         ctx->restart_required = true;
@@ -159,7 +159,7 @@ static dom_models_error_t set_preloaded_impl(
     if (update->mqtt_proto_set) {
         err = ctx->cfg.preloaded_repository->set_mqtt_proto(ctx->cfg.preloaded_repository, update->mqtt_proto);
         if (err != DOMAIN_MODELS_ERROR_OK) {
-            ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to set MQTT protocol: %s (%d)", dom_models_error_str(err), (int)err);
+            DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to set MQTT protocol: %s (%d)", dom_models_error_str(err), (int)err);
             return err;
         }
         ctx->restart_required = true;
@@ -168,7 +168,7 @@ static dom_models_error_t set_preloaded_impl(
     if (update->mqtt_host_set) {
         err = ctx->cfg.preloaded_repository->set_mqtt_host(ctx->cfg.preloaded_repository, update->mqtt_host);
         if (err != DOMAIN_MODELS_ERROR_OK) {
-            ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to set MQTT host: %s (%d)", dom_models_error_str(err), (int)err);
+            DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to set MQTT host: %s (%d)", dom_models_error_str(err), (int)err);
             return err;
         }
         ctx->restart_required = true;
@@ -177,7 +177,7 @@ static dom_models_error_t set_preloaded_impl(
     if (update->mqtt_port_set) {
         err = ctx->cfg.preloaded_repository->set_mqtt_port(ctx->cfg.preloaded_repository, update->mqtt_port);
         if (err != DOMAIN_MODELS_ERROR_OK) {
-            ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to set MQTT port: %s (%d)", dom_models_error_str(err), (int)err);
+            DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to set MQTT port: %s (%d)", dom_models_error_str(err), (int)err);
             return err;
         }
         ctx->restart_required = true;
@@ -186,7 +186,7 @@ static dom_models_error_t set_preloaded_impl(
     if (update->mqtt_user_set) {
         err = ctx->cfg.preloaded_repository->set_mqtt_user(ctx->cfg.preloaded_repository, update->mqtt_user);
         if (err != DOMAIN_MODELS_ERROR_OK) {
-            ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to set MQTT user: %s (%d)", dom_models_error_str(err), (int)err);
+            DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to set MQTT user: %s (%d)", dom_models_error_str(err), (int)err);
             return err;
         }
         ctx->restart_required = true;
@@ -195,7 +195,7 @@ static dom_models_error_t set_preloaded_impl(
     if (update->mqtt_pass_set) {
         err = ctx->cfg.preloaded_repository->set_mqtt_pass(ctx->cfg.preloaded_repository, update->mqtt_pass);
         if (err != DOMAIN_MODELS_ERROR_OK) {
-            ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to set MQTT password: %s (%d)", dom_models_error_str(err), (int)err);
+            DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to set MQTT password: %s (%d)", dom_models_error_str(err), (int)err);
             return err;
         }
         ctx->restart_required = true;
@@ -204,7 +204,7 @@ static dom_models_error_t set_preloaded_impl(
     if (update->system_restart_after_ms_set) {
         err = ctx->cfg.preloaded_repository->set_system_restart_after_ms(ctx->cfg.preloaded_repository, update->system_restart_after_ms);
         if (err != DOMAIN_MODELS_ERROR_OK) {
-            ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to set system restart after ms: %s (%d)", dom_models_error_str(err), (int)err);
+            DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to set system restart after ms: %s (%d)", dom_models_error_str(err), (int)err);
             return err;
         }
         ctx->restart_required = true;
@@ -214,7 +214,7 @@ static dom_models_error_t set_preloaded_impl(
         *restart_required_out = ctx->restart_required;
     }
 
-    ctx->cfg.logger->info(ctx->cfg.logger, tag, "Preloaded settings updated successfully");
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "Preloaded settings updated successfully");
 
     return DOMAIN_MODELS_ERROR_OK;
 }
@@ -233,13 +233,13 @@ static dom_models_error_t get_restart_required_impl(
 
     if (!out) {
         err = DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Missing restart required output: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Missing restart required output: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
     *out = ctx->restart_required;
 
-    ctx->cfg.logger->info(ctx->cfg.logger, tag, "Restart required state retrieved successfully");
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "Restart required state retrieved successfully");
 
     return DOMAIN_MODELS_ERROR_OK;
 }
@@ -255,11 +255,11 @@ static dom_models_error_t restart_impl(dom_usecases_settings_t* self, uint32_t d
 
     err = ctx->cfg.system_restart->restart(ctx->cfg.system_restart, delay_ms);
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to restart system: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to restart system: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
-    ctx->cfg.logger->info(ctx->cfg.logger, tag, "System restart requested successfully");
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "System restart requested successfully");
 
     return DOMAIN_MODELS_ERROR_OK;
 }
@@ -1,5 +1,7 @@
 #include "application/wifiman/impl.h"
 
+#include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -8,6 +10,8 @@
 #include "domain/models/error.h"
 #include "domain/models/wifi.h"
 #include "domain/usecases/wifiman.h"
+#include "freertos/FreeRTOS.h"  // IWYU pragma: keep
+#include "freertos/semphr.h"
 
 #define BASE_TAG "wifiman"
 
@@ -20,6 +24,11 @@ static void on_wifi_event(
     const dom_models_wifi_event_t* event
 );
 
+static void handle_wifi_event(
+    app_wifiman_impl_ctx_t*        ctx,
+    const dom_models_wifi_event_t* event
+);
+
 static dom_models_error_t register_wifi_event_callback(
     app_wifiman_impl_ctx_t* ctx,
     const char*             tag
@@ -44,11 +53,109 @@ static dom_models_error_t stop_ap(
     const char*             tag
 );
 
+static bool get_now(
+    app_wifiman_impl_ctx_t* ctx,
+    int64_t*                out
+);
+
+static void prepare_fast_connect(
+    app_wifiman_impl_ctx_t*               ctx,
+    dom_models_wifi_sta_connect_config_t* config,
+    const char*                           tag
+);
+
+static void end_fast_connect(
+    app_wifiman_impl_ctx_t* ctx,
+    bool                    failed
+);
+
+static void remember_connected_ap(
+    app_wifiman_impl_ctx_t*         ctx,
+    const dom_models_wifi_status_t* status,
+    const char*                     tag
+);
+
+static void begin_profile_attempt(
+    app_wifiman_impl_ctx_t* ctx,
+    size_t                  slot
+);
+
+static void fail_profile_attempt(
+    app_wifiman_impl_ctx_t* ctx
+);
+
+static void reset_profile_attempts(
+    app_wifiman_impl_ctx_t* ctx
+);
+
+static void remember_connected_profile(
+    app_wifiman_impl_ctx_t*         ctx,
+    const dom_models_wifi_status_t* status,
+    const char*                     tag
+);
+
+static dom_models_error_t store_profiles(
+    app_wifiman_impl_ctx_t* ctx,
+    const char*             tag
+);
+
+static dom_models_error_t store_credential(
+    app_wifiman_impl_ctx_t*                 ctx,
+    const dom_models_wifi_sta_credential_t* credential,
+    size_t*                                 out_slot,
+    const char*                             tag
+);
+
+static dom_models_error_t refresh_scan_cache(
+    app_wifiman_impl_ctx_t* ctx,
+    const char*             tag
+);
+
+static dom_models_error_t load_scan(
+    app_wifiman_impl_ctx_t*              ctx,
+    const dom_models_wifi_scan_result_t* scan,
+    const char*                          tag
+);
+
+static dom_models_error_t start_roam_scan(
+    dom_usecases_wifiman_t*            self,
+    app_wifiman_impl_ctx_t*            ctx,
+    const dom_models_wifi_ap_record_t* ap,
+    const char*                        tag
+);
+
+static dom_models_error_t check_roam_scan(
+    app_wifiman_impl_ctx_t*            ctx,
+    const dom_models_wifi_ap_record_t* ap,
+    const char*                        tag
+);
+
+static dom_models_error_t roam(
+    app_wifiman_impl_ctx_t*            ctx,
+    const dom_models_wifi_ap_record_t* ap,
+    const dom_models_wifi_ap_record_t* target,
+    const char*                        tag
+);
+
+static void end_roam(
+    app_wifiman_impl_ctx_t* ctx,
+    bool                    succeeded,
+    const char*             tag
+);
+
 static dom_models_error_t get_ctx(
     dom_usecases_wifiman_t* self,
     app_wifiman_impl_ctx_t** out
 );
 
+static void lock(
+    app_wifiman_impl_ctx_t* ctx
+);
+
+static void unlock(
+    app_wifiman_impl_ctx_t* ctx
+);
+
 /* Contract Function Prototypes */
 
 static dom_models_error_t start_impl(
@@ -62,8 +169,9 @@ static dom_models_error_t start_scan_impl(
     const dom_models_wifi_scan_config_t* config
 );
 static dom_models_error_t get_scan_result_impl(
-    dom_usecases_wifiman_t*        self,
-    dom_models_wifi_scan_result_t* out
+    dom_usecases_wifiman_t*                  self,
+    const dom_usecases_wifiman_scan_query_t* query,
+    dom_usecases_wifiman_scan_result_t*      out
 );
 static dom_models_error_t get_status_impl(
     dom_usecases_wifiman_t*        self,
@@ -93,6 +201,19 @@ static dom_models_error_t set_sta_credential_impl(
 static dom_models_error_t forget_sta_credential_impl(
     dom_usecases_wifiman_t* self
 );
+static dom_models_error_t get_sta_profiles_impl(
+    dom_usecases_wifiman_t*              self,
+    dom_usecases_wifiman_sta_profiles_t* out
+);
+static dom_models_error_t set_sta_profile_impl(
+    dom_usecases_wifiman_t*                 self,
+    const dom_models_wifi_sta_credential_t* credential,
+    uint8_t                                 priority
+);
+static dom_models_error_t delete_sta_profile_impl(
+    dom_usecases_wifiman_t* self,
+    const char*             ssid
+);
 static dom_models_error_t need_reconnect_impl(
     dom_usecases_wifiman_t* self,
     bool*                   out
@@ -101,6 +222,79 @@ static dom_models_error_t try_reconnect_impl(
     dom_usecases_wifiman_t* self,
     bool*                   attempted
 );
+static dom_models_error_t monitor_link_impl(
+    dom_usecases_wifiman_t* self
+);
+
+/* Locked Function Prototypes */
+
+static dom_models_error_t start_locked(
+    dom_usecases_wifiman_t* self
+);
+static dom_models_error_t stop_locked(
+    dom_usecases_wifiman_t* self
+);
+static dom_models_error_t start_scan_locked(
+    dom_usecases_wifiman_t*              self,
+    const dom_models_wifi_scan_config_t* config
+);
+static dom_models_error_t get_scan_result_locked(
+    dom_usecases_wifiman_t*                  self,
+    const dom_usecases_wifiman_scan_query_t* query,
+    dom_usecases_wifiman_scan_result_t*      out
+);
+static dom_models_error_t get_status_locked(
+    dom_usecases_wifiman_t*        self,
+    dom_usecases_wifiman_status_t* out
+);
+static dom_models_error_t connect_sta_locked(
+    dom_usecases_wifiman_t*                  self,
+    const dom_models_wifi_sta_credential_t* credential
+);
+static dom_models_error_t connect_stored_sta_locked(
+    dom_usecases_wifiman_t* self
+);
+static dom_models_error_t disconnect_sta_locked(
+    dom_usecases_wifiman_t* self
+);
+static dom_models_error_t commit_sta_connection_locked(
+    dom_usecases_wifiman_t* self
+);
+static dom_models_error_t get_stored_sta_locked(
+    dom_usecases_wifiman_t*            self,
+    dom_usecases_wifiman_stored_sta_t* out
+);
+static dom_models_error_t set_sta_credential_locked(
+    dom_usecases_wifiman_t*                  self,
+    const dom_models_wifi_sta_credential_t* credential
+);
+static dom_models_error_t forget_sta_credential_locked(
+    dom_usecases_wifiman_t* self
+);
+static dom_models_error_t get_sta_profiles_locked(
+    dom_usecases_wifiman_t*              self,
+    dom_usecases_wifiman_sta_profiles_t* out
+);
+static dom_models_error_t set_sta_profile_locked(
+    dom_usecases_wifiman_t*                 self,
+    const dom_models_wifi_sta_credential_t* credential,
+    uint8_t                                 priority
+);
+static dom_models_error_t delete_sta_profile_locked(
+    dom_usecases_wifiman_t* self,
+    const char*             ssid
+);
+static dom_models_error_t need_reconnect_locked(
+    dom_usecases_wifiman_t* self,
+    bool*                   out
+);
+static dom_models_error_t try_reconnect_locked(
+    dom_usecases_wifiman_t* self,
+    bool*                   attempted
+);
+static dom_models_error_t monitor_link_locked(
+    dom_usecases_wifiman_t* self
+);
 
 /* Constructor and Destructor */
 
@@ -114,7 +308,7 @@ dom_usecases_wifiman_t* app_wifiman_impl_new(const app_wifiman_impl_cfg_t* cfg)
 
     app_wifiman_impl_ctx_t* ctx = (app_wifiman_impl_ctx_t*)calloc(1, sizeof(app_wifiman_impl_ctx_t));
     if (!ctx) {
-        cfg->logger->error(cfg->logger, tag, "Failed to allocate WiFiMan context: %s (%d)", dom_models_error_str(DOMAIN_MODELS_ERROR_MALLOC_FAILED), (int)DOMAIN_MODELS_ERROR_MALLOC_FAILED);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(cfg->logger, tag, "Failed to allocate WiFiMan context: %s (%d)", dom_models_error_str(DOMAIN_MODELS_ERROR_MALLOC_FAILED), (int)DOMAIN_MODELS_ERROR_MALLOC_FAILED);
         return NULL;
     }
 
@@ -122,10 +316,58 @@ dom_usecases_wifiman_t* app_wifiman_impl_new(const app_wifiman_impl_cfg_t* cfg)
     if (ctx->cfg.reconnect_max_trials == 0) {
         ctx->cfg.reconnect_max_trials = APP_WIFIMAN_IMPL_DEFAULT_RECONNECT_MAX_TRIALS;
     }
+    if (ctx->cfg.scan_entry_max == 0) {
+        ctx->cfg.scan_entry_max = APP_WIFIMAN_IMPL_DEFAULT_SCAN_ENTRY_MAX;
+    }
+    if (ctx->cfg.scan_entry_ttl_ms == 0) {
+        ctx->cfg.scan_entry_ttl_ms = APP_WIFIMAN_IMPL_DEFAULT_SCAN_ENTRY_TTL_MS;
+    }
+    if (ctx->cfg.roam_rssi_low == 0) {
+        ctx->cfg.roam_rssi_low = APP_WIFIMAN_IMPL_DEFAULT_ROAM_RSSI_LOW;
+    }
+    if (ctx->cfg.roam_rssi_high == 0) {
+        ctx->cfg.roam_rssi_high = APP_WIFIMAN_IMPL_DEFAULT_ROAM_RSSI_HIGH;
+    }
+    if (ctx->cfg.roam_rssi_high < ctx->cfg.roam_rssi_low) {
+        ctx->cfg.roam_rssi_high = ctx->cfg.roam_rssi_low;
+    }
+    if (ctx->cfg.roam_rssi_gain == 0) {
+        ctx->cfg.roam_rssi_gain = APP_WIFIMAN_IMPL_DEFAULT_ROAM_RSSI_GAIN;
+    }
+    if (ctx->cfg.roam_ewma_shift == 0) {
+        ctx->cfg.roam_ewma_shift = APP_WIFIMAN_IMPL_DEFAULT_ROAM_EWMA_SHIFT;
+    }
+    if (ctx->cfg.roam_ewma_shift > 8) {
+        ctx->cfg.roam_ewma_shift = 8;
+    }
+    if (ctx->cfg.roam_weak_samples == 0) {
+        ctx->cfg.roam_weak_samples = APP_WIFIMAN_IMPL_DEFAULT_ROAM_WEAK_SAMPLES;
+    }
+    if (ctx->cfg.roam_cooldown_samples == 0) {
+        ctx->cfg.roam_cooldown_samples = APP_WIFIMAN_IMPL_DEFAULT_ROAM_COOLDOWN_SAMPLES;
+    }
+
+    /* Recursive, the WiFi event callback can run inside a driver call made under the lock */
+    ctx->lock = xSemaphoreCreateRecursiveMutex();
+    if (!ctx->lock) {
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to create WiFiMan lock: %s (%d)", dom_models_error_str(DOMAIN_MODELS_ERROR_MALLOC_FAILED), (int)DOMAIN_MODELS_ERROR_MALLOC_FAILED);
+        free(ctx);
+        return NULL;
+    }
+
+    err = app_wifiman_impl_scan_cache_init(&ctx->scan_cache, ctx->cfg.scan_entry_max);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to allocate WiFi scan cache: %s (%d)", dom_models_error_str(err), (int)err);
+        vSemaphoreDelete(ctx->lock);
+        free(ctx);
+        return NULL;
+    }
 
     dom_usecases_wifiman_t* self = dom_usecases_wifiman_new(ctx);
     if (!self) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to allocate WiFiMan usecase: %s (%d)", dom_models_error_str(DOMAIN_MODELS_ERROR_MALLOC_FAILED), (int)DOMAIN_MODELS_ERROR_MALLOC_FAILED);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to allocate WiFiMan usecase: %s (%d)", dom_models_error_str(DOMAIN_MODELS_ERROR_MALLOC_FAILED), (int)DOMAIN_MODELS_ERROR_MALLOC_FAILED);
+        app_wifiman_impl_scan_cache_deinit(&ctx->scan_cache);
+        vSemaphoreDelete(ctx->lock);
         free(ctx);
         return NULL;
     }
@@ -142,10 +384,14 @@ dom_usecases_wifiman_t* app_wifiman_impl_new(const app_wifiman_impl_cfg_t* cfg)
     self->get_stored_sta        = get_stored_sta_impl;
     self->set_sta_credential    = set_sta_credential_impl;
     self->forget_sta_credential = forget_sta_credential_impl;
+    self->get_sta_profiles      = get_sta_profiles_impl;
+    self->set_sta_profile       = set_sta_profile_impl;
+    self->delete_sta_profile    = delete_sta_profile_impl;
     self->need_reconnect        = need_reconnect_impl;
     self->try_reconnect         = try_reconnect_impl;
+    self->monitor_link          = monitor_link_impl;
 
-    ctx->cfg.logger->info(ctx->cfg.logger, tag, "WiFiMan created successfully");
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "WiFiMan created successfully");
 
     return self;
 }
@@ -160,7 +406,9 @@ void app_wifiman_impl_delete(dom_usecases_wifiman_t* self) {
     app_wifiman_impl_ctx_t* ctx = self->ctx;
     if (ctx) {
         unregister_wifi_event_callback(ctx);
-        ctx->cfg.logger->info(ctx->cfg.logger, tag, "WiFiMan deleted successfully");
+        app_wifiman_impl_scan_cache_deinit(&ctx->scan_cache);
+        vSemaphoreDelete(ctx->lock);
+        DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "WiFiMan deleted successfully");
         free(ctx);
     }
 
@@ -171,6 +419,309 @@ void app_wifiman_impl_delete(dom_usecases_wifiman_t* self) {
 
 static dom_models_error_t start_impl(
     dom_usecases_wifiman_t* self
+) {
+    app_wifiman_impl_ctx_t* ctx = NULL;
+    dom_models_error_t      err = get_ctx(self, &ctx);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
+    lock(ctx);
+    err = start_locked(self);
+    unlock(ctx);
+
+    return err;
+}
+
+static dom_models_error_t stop_impl(
+    dom_usecases_wifiman_t* self
+) {
+    app_wifiman_impl_ctx_t* ctx = NULL;
+    dom_models_error_t      err = get_ctx(self, &ctx);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
+    lock(ctx);
+    err = stop_locked(self);
+    unlock(ctx);
+
+    return err;
+}
+
+static dom_models_error_t start_scan_impl(
+    dom_usecases_wifiman_t*              self,
+    const dom_models_wifi_scan_config_t* config
+) {
+    app_wifiman_impl_ctx_t* ctx = NULL;
+    dom_models_error_t      err = get_ctx(self, &ctx);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
+    lock(ctx);
+    err = start_scan_locked(self, config);
+    unlock(ctx);
+
+    return err;
+}
+
+static dom_models_error_t get_scan_result_impl(
+    dom_usecases_wifiman_t*                  self,
+    const dom_usecases_wifiman_scan_query_t* query,
+    dom_usecases_wifiman_scan_result_t*      out
+) {
+    app_wifiman_impl_ctx_t* ctx = NULL;
+    dom_models_error_t      err = get_ctx(self, &ctx);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
+    lock(ctx);
+    err = get_scan_result_locked(self, query, out);
+    unlock(ctx);
+
+    return err;
+}
+
+static dom_models_error_t get_status_impl(
+    dom_usecases_wifiman_t*        self,
+    dom_usecases_wifiman_status_t* out
+) {
+    app_wifiman_impl_ctx_t* ctx = NULL;
+    dom_models_error_t      err = get_ctx(self, &ctx);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
+    lock(ctx);
+    err = get_status_locked(self, out);
+    unlock(ctx);
+
+    return err;
+}
+
+static dom_models_error_t connect_sta_impl(
+    dom_usecases_wifiman_t*                  self,
+    const dom_models_wifi_sta_credential_t* credential
+) {
+    app_wifiman_impl_ctx_t* ctx = NULL;
+    dom_models_error_t      err = get_ctx(self, &ctx);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
+    lock(ctx);
+    err = connect_sta_locked(self, credential);
+    unlock(ctx);
+
+    return err;
+}
+
+static dom_models_error_t connect_stored_sta_impl(
+    dom_usecases_wifiman_t* self
+) {
+    app_wifiman_impl_ctx_t* ctx = NULL;
+    dom_models_error_t      err = get_ctx(self, &ctx);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
+    lock(ctx);
+    err = connect_stored_sta_locked(self);
+    unlock(ctx);
+
+    return err;
+}
+
+static dom_models_error_t disconnect_sta_impl(
+    dom_usecases_wifiman_t* self
+) {
+    app_wifiman_impl_ctx_t* ctx = NULL;
+    dom_models_error_t      err = get_ctx(self, &ctx);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
+    lock(ctx);
+    err = disconnect_sta_locked(self);
+    unlock(ctx);
+
+    return err;
+}
+
+static dom_models_error_t commit_sta_connection_impl(
+    dom_usecases_wifiman_t* self
+) {
+    app_wifiman_impl_ctx_t* ctx = NULL;
+    dom_models_error_t      err = get_ctx(self, &ctx);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
+    lock(ctx);
+    err = commit_sta_connection_locked(self);
+    unlock(ctx);
+
+    return err;
+}
+
+static dom_models_error_t get_stored_sta_impl(
+    dom_usecases_wifiman_t*            self,
+    dom_usecases_wifiman_stored_sta_t* out
+) {
+    app_wifiman_impl_ctx_t* ctx = NULL;
+    dom_models_error_t      err = get_ctx(self, &ctx);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
+    lock(ctx);
+    err = get_stored_sta_locked(self, out);
+    unlock(ctx);
+
+    return err;
+}
+
+static dom_models_error_t set_sta_credential_impl(
+    dom_usecases_wifiman_t*                  self,
+    const dom_models_wifi_sta_credential_t* credential
+) {
+    app_wifiman_impl_ctx_t* ctx = NULL;
+    dom_models_error_t      err = get_ctx(self, &ctx);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
+    lock(ctx);
+    err = set_sta_credential_locked(self, credential);
+    unlock(ctx);
+
+    return err;
+}
+
+static dom_models_error_t forget_sta_credential_impl(
+    dom_usecases_wifiman_t* self
+) {
+    app_wifiman_impl_ctx_t* ctx = NULL;
+    dom_models_error_t      err = get_ctx(self, &ctx);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
+    lock(ctx);
+    err = forget_sta_credential_locked(self);
+    unlock(ctx);
+
+    return err;
+}
+
+static dom_models_error_t get_sta_profiles_impl(
+    dom_usecases_wifiman_t*              self,
+    dom_usecases_wifiman_sta_profiles_t* out
+) {
+    app_wifiman_impl_ctx_t* ctx = NULL;
+    dom_models_error_t      err = get_ctx(self, &ctx);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
+    lock(ctx);
+    err = get_sta_profiles_locked(self, out);
+    unlock(ctx);
+
+    return err;
+}
+
+static dom_models_error_t set_sta_profile_impl(
+    dom_usecases_wifiman_t*                 self,
+    const dom_models_wifi_sta_credential_t* credential,
+    uint8_t                                 priority
+) {
+    app_wifiman_impl_ctx_t* ctx = NULL;
+    dom_models_error_t      err = get_ctx(self, &ctx);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
+    lock(ctx);
+    err = set_sta_profile_locked(self, credential, priority);
+    unlock(ctx);
+
+    return err;
+}
+
+static dom_models_error_t delete_sta_profile_impl(
+    dom_usecases_wifiman_t* self,
+    const char*             ssid
+) {
+    app_wifiman_impl_ctx_t* ctx = NULL;
+    dom_models_error_t      err = get_ctx(self, &ctx);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
+    lock(ctx);
+    err = delete_sta_profile_locked(self, ssid);
+    unlock(ctx);
+
+    return err;
+}
+
+static dom_models_error_t need_reconnect_impl(
+    dom_usecases_wifiman_t* self,
+    bool*                   out
+) {
+    app_wifiman_impl_ctx_t* ctx = NULL;
+    dom_models_error_t      err = get_ctx(self, &ctx);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
+    lock(ctx);
+    err = need_reconnect_locked(self, out);
+    unlock(ctx);
+
+    return err;
+}
+
+static dom_models_error_t try_reconnect_impl(
+    dom_usecases_wifiman_t* self,
+    bool*                   attempted
+) {
+    app_wifiman_impl_ctx_t* ctx = NULL;
+    dom_models_error_t      err = get_ctx(self, &ctx);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
+    lock(ctx);
+    err = try_reconnect_locked(self, attempted);
+    unlock(ctx);
+
+    return err;
+}
+
+static dom_models_error_t monitor_link_impl(
+    dom_usecases_wifiman_t* self
+) {
+    app_wifiman_impl_ctx_t* ctx = NULL;
+    dom_models_error_t      err = get_ctx(self, &ctx);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
+    lock(ctx);
+    err = monitor_link_locked(self);
+    unlock(ctx);
+
+    return err;
+}
+
+/* Locked Function Implementations */
+
+static dom_models_error_t start_locked(
+    dom_usecases_wifiman_t* self
 ) {
     const char* tag = BASE_TAG"/start";
 
@@ -186,7 +737,7 @@ static dom_models_error_t start_impl(
             return err;
         }
 
-        ctx->cfg.logger->info(ctx->cfg.logger, tag, "WiFiMan started successfully");
+        DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "WiFiMan started successfully");
 
         return DOMAIN_MODELS_ERROR_OK;
     }
@@ -197,7 +748,7 @@ static dom_models_error_t start_impl(
     }
 
     dom_models_wifi_sta_credential_t credential;
-    err = app_wifiman_impl_load_stored_credential(ctx, &credential);
+    err = app_wifiman_impl_load_stored_credential(ctx, &credential, NULL);
     if (err == DOMAIN_MODELS_ERROR_NOT_FOUND) {
         ctx->auto_reconnect_enabled          = false;
         ctx->sta_connection_commit_required = false;
@@ -207,12 +758,12 @@ static dom_models_error_t start_impl(
             return err;
         }
 
-        ctx->cfg.logger->info(ctx->cfg.logger, tag, "WiFiMan started with AP enabled because no stored STA credential is available");
+        DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "WiFiMan started with AP enabled because no stored STA credential is available");
 
         return DOMAIN_MODELS_ERROR_OK;
     }
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to load stored STA credential for startup: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to load stored STA credential for startup: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
@@ -228,7 +779,7 @@ static dom_models_error_t start_impl(
             return err;
         }
 
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Stored STA credential is invalid, AP enabled for configuration: %s (%d)", dom_models_error_str(validation_err), (int)validation_err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Stored STA credential is invalid, AP enabled for configuration: %s (%d)", dom_models_error_str(validation_err), (int)validation_err);
         return DOMAIN_MODELS_ERROR_OK;
     }
 
@@ -241,12 +792,12 @@ static dom_models_error_t start_impl(
     ctx->sta_connection_commit_required = false;
     ctx->sta_connect_source             = APP_WIFIMAN_IMPL_STA_CONNECT_SOURCE_NONE;
 
-    ctx->cfg.logger->info(ctx->cfg.logger, tag, "WiFiMan started successfully");
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "WiFiMan started successfully");
 
     return DOMAIN_MODELS_ERROR_OK;
 }
 
-static dom_models_error_t stop_impl(
+static dom_models_error_t stop_locked(
     dom_usecases_wifiman_t* self
 ) {
     const char* tag = BASE_TAG"/stop";
@@ -266,34 +817,34 @@ static dom_models_error_t stop_impl(
     if (!ctx->started) {
         ctx->ap_started            = false;
         ctx->reconnect_trial_count = 0;
-        ctx->cfg.logger->info(ctx->cfg.logger, tag, "WiFiMan stopped successfully");
+        DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "WiFiMan stopped successfully");
         return DOMAIN_MODELS_ERROR_OK;
     }
 
     dom_models_wifi_status_t status;
     err = ctx->cfg.wifi->get_status(ctx->cfg.wifi, &status);
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to get WiFi status before stop: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to get WiFi status before stop: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
     if (status.connected) {
         err = ctx->cfg.wifi->disconnect_sta(ctx->cfg.wifi);
         if (err != DOMAIN_MODELS_ERROR_OK) {
-            ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to disconnect STA: %s (%d)", dom_models_error_str(err), (int)err);
+            DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to disconnect STA: %s (%d)", dom_models_error_str(err), (int)err);
             return err;
         }
     }
 
     err = ctx->cfg.wifi->stop_ap(ctx->cfg.wifi);
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to stop AP: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to stop AP: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
     err = ctx->cfg.wifi->stop(ctx->cfg.wifi);
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to stop WiFi: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to stop WiFi: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
@@ -301,12 +852,12 @@ static dom_models_error_t stop_impl(
     ctx->ap_started            = false;
     ctx->reconnect_trial_count = 0;
 
-    ctx->cfg.logger->info(ctx->cfg.logger, tag, "WiFiMan stopped successfully");
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "WiFiMan stopped successfully");
 
     return DOMAIN_MODELS_ERROR_OK;
 }
 
-static dom_models_error_t start_scan_impl(
+static dom_models_error_t start_scan_locked(
     dom_usecases_wifiman_t*              self,
     const dom_models_wifi_scan_config_t* config
 ) {
@@ -318,6 +869,33 @@ static dom_models_error_t start_scan_impl(
         return err;
     }
 
+    err = refresh_scan_cache(ctx, tag);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
+    bool filters_equal = app_wifiman_impl_scan_filters_equal(&ctx->scan_config, config);
+
+    if (ctx->scan_status.status == DOM_MODELS_WIFI_SCAN_STATUS_RUNNING) {
+        if (!filters_equal) {
+            err = DOMAIN_MODELS_ERROR_BAD_STATE;
+            DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Another WiFi scan with different filters is running: %s (%d)", dom_models_error_str(err), (int)err);
+            return err;
+        }
+
+        ctx->scan_stats.coalesced_cnt++;
+        DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "WiFi scan joined the running scan");
+        return DOMAIN_MODELS_ERROR_OK;
+    }
+
+    int64_t now_ms = 0;
+    if (config && config->max_age_ms > 0 && filters_equal && ctx->scan_cache_valid && get_now(ctx, &now_ms) &&
+        now_ms - ctx->scan_cache_updated_ms <= (int64_t)config->max_age_ms) {
+        ctx->scan_stats.cached_cnt++;
+        DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "WiFi scan served from cache");
+        return DOMAIN_MODELS_ERROR_OK;
+    }
+
     err = ctx->cfg.ap_auto_manage_enabled ? ensure_sta(ctx, tag) : ensure_apsta(ctx, tag);
     if (err != DOMAIN_MODELS_ERROR_OK) {
         return err;
@@ -325,18 +903,31 @@ static dom_models_error_t start_scan_impl(
 
     err = ctx->cfg.wifi->start_scan(ctx->cfg.wifi, config);
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to start WiFi scan: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to start WiFi scan: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
-    ctx->cfg.logger->info(ctx->cfg.logger, tag, "WiFi scan started successfully");
+    if (!filters_equal) {
+        app_wifiman_impl_scan_cache_clear(&ctx->scan_cache);
+        ctx->scan_cache_valid = false;
+    }
+    if (config) {
+        memcpy(&ctx->scan_config, config, sizeof(dom_models_wifi_scan_config_t));
+    } else {
+        memset(&ctx->scan_config, 0, sizeof(dom_models_wifi_scan_config_t));
+    }
+    ctx->scan_pending = true;
+    ctx->scan_stats.started_cnt++;
+
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "WiFi scan started successfully");
 
     return DOMAIN_MODELS_ERROR_OK;
 }
 
-static dom_models_error_t get_scan_result_impl(
-    dom_usecases_wifiman_t*        self,
-    dom_models_wifi_scan_result_t* out
+static dom_models_error_t get_scan_result_locked(
+    dom_usecases_wifiman_t*                  self,
+    const dom_usecases_wifiman_scan_query_t* query,
+    dom_usecases_wifiman_scan_result_t*      out
 ) {
     const char* tag = BASE_TAG"/get_scan_result";
 
@@ -347,22 +938,54 @@ static dom_models_error_t get_scan_result_impl(
     }
     if (!out) {
         err = DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Missing scan result output: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Missing scan result output: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
-    err = ctx->cfg.wifi->get_scanned(ctx->cfg.wifi, out);
+    err = refresh_scan_cache(ctx, tag);
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to get WiFi scan result: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
-    ctx->cfg.logger->info(ctx->cfg.logger, tag, "WiFi scan result loaded successfully");
+    const app_wifiman_impl_scan_cache_t* cache = &ctx->scan_cache;
+
+    size_t offset = query ? query->offset : 0;
+    size_t limit  = query ? query->limit : 0;
+    if (limit == 0 || limit > DOM_USECASES_WIFIMAN_SCAN_PAGE_MAX) {
+        limit = DOM_USECASES_WIFIMAN_SCAN_PAGE_MAX;
+    }
+
+    out->status        = ctx->scan_status.status;
+    out->scan_id       = ctx->scan_status.scan_id;
+    out->driver_status = ctx->scan_status.driver_status;
+    out->age_available = false;
+    out->age_ms        = 0;
+    out->total_count   = ctx->scan_status.total_count;
+    out->truncated     = ctx->scan_status.truncated || cache->truncated;
+    out->entry_count   = cache->count;
+    out->offset        = offset;
+    out->count         = offset < cache->count ? cache->count - offset : 0;
+    out->stats         = ctx->scan_stats;
+    if (out->count > limit) {
+        out->count = limit;
+    }
+    if (out->count > 0) {
+        memcpy(out->entries, &cache->entries[offset], out->count * sizeof(dom_usecases_wifiman_scan_entry_t));
+    }
+
+    int64_t now_ms = 0;
+    if (ctx->scan_cache_valid && get_now(ctx, &now_ms)) {
+        int64_t age_ms     = now_ms - ctx->scan_cache_updated_ms;
+        out->age_available = true;
+        out->age_ms        = age_ms < 0 ? 0 : age_ms > UINT32_MAX ? UINT32_MAX : (uint32_t)age_ms;
+    }
+
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "WiFi scan result loaded successfully");
 
     return DOMAIN_MODELS_ERROR_OK;
 }
 
-static dom_models_error_t get_status_impl(
+static dom_models_error_t get_status_locked(
     dom_usecases_wifiman_t*        self,
     dom_usecases_wifiman_status_t* out
 ) {
@@ -375,7 +998,7 @@ static dom_models_error_t get_status_impl(
     }
     if (!out) {
         err = DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Missing status output: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Missing status output: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
@@ -383,7 +1006,7 @@ static dom_models_error_t get_status_impl(
 
     err = ctx->cfg.wifi->get_status(ctx->cfg.wifi, &out->wifi);
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to get WiFi status: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to get WiFi status: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
@@ -395,7 +1018,7 @@ static dom_models_error_t get_status_impl(
 
     err = app_wifiman_impl_load_stored_sta(ctx, &out->stored_sta);
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to load stored STA credential view: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to load stored STA credential view: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
@@ -406,7 +1029,7 @@ static dom_models_error_t get_status_impl(
         memset(&out->sta_netif, 0, sizeof(dom_models_network_interface_t));
         out->sta_netif_available = false;
     } else {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to load STA network interface status: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to load STA network interface status: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
@@ -415,13 +1038,14 @@ static dom_models_error_t get_status_impl(
     out->reconnect_max_trials            = ctx->cfg.reconnect_max_trials;
     out->ap_auto_manage_enabled          = ctx->cfg.ap_auto_manage_enabled;
     out->sta_connection_commit_required = ctx->sta_connection_commit_required;
+    memcpy(&out->link, &ctx->link.stats, sizeof(dom_usecases_wifiman_link_t));
 
-    ctx->cfg.logger->info(ctx->cfg.logger, tag, "WiFiMan status loaded successfully");
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "WiFiMan status loaded successfully");
 
     return DOMAIN_MODELS_ERROR_OK;
 }
 
-static dom_models_error_t connect_sta_impl(
+static dom_models_error_t connect_sta_locked(
     dom_usecases_wifiman_t*                  self,
     const dom_models_wifi_sta_credential_t* credential
 ) {
@@ -435,7 +1059,7 @@ static dom_models_error_t connect_sta_impl(
 
     err = app_wifiman_impl_validate_credential(credential);
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Invalid STA credential: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Invalid STA credential: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
@@ -450,29 +1074,33 @@ static dom_models_error_t connect_sta_impl(
     ctx->sta_connect_source                = APP_WIFIMAN_IMPL_STA_CONNECT_SOURCE_INITIAL;
     ctx->sta_connection_commit_required    = false;
     ctx->ap_enabled_by_reconnect_threshold = false;
+    ctx->sta_connect_fast                  = false;
+    ctx->sta_fast_connect_failed           = false;
+    ctx->link.roam_state                   = APP_WIFIMAN_IMPL_ROAM_STATE_IDLE;
 
     err = ctx->cfg.wifi->connect_sta(ctx->cfg.wifi, &config);
     if (err != DOMAIN_MODELS_ERROR_OK) {
         ctx->sta_connect_source = APP_WIFIMAN_IMPL_STA_CONNECT_SOURCE_NONE;
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to connect STA: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to connect STA: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
-    err = ctx->cfg.wifi_repository->set_sta_credential(ctx->cfg.wifi_repository, credential);
+    size_t slot = 0;
+    err = store_credential(ctx, credential, &slot, tag);
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to store STA credential: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
+    begin_profile_attempt(ctx, slot);
 
     ctx->auto_reconnect_enabled = true;
     ctx->reconnect_trial_count  = 0;
 
-    ctx->cfg.logger->info(ctx->cfg.logger, tag, "STA connection request accepted successfully");
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "STA connection request accepted successfully");
 
     return DOMAIN_MODELS_ERROR_OK;
 }
 
-static dom_models_error_t connect_stored_sta_impl(
+static dom_models_error_t connect_stored_sta_locked(
     dom_usecases_wifiman_t* self
 ) {
     const char* tag = BASE_TAG"/connect_stored_sta";
@@ -483,16 +1111,20 @@ static dom_models_error_t connect_stored_sta_impl(
         return err;
     }
 
+    /* A failed refresh only leaves the ranking on the older scan */
+    (void)refresh_scan_cache(ctx, tag);
+
     dom_models_wifi_sta_credential_t credential;
-    err = app_wifiman_impl_load_stored_credential(ctx, &credential);
+    size_t                           slot = 0;
+    err = app_wifiman_impl_load_stored_credential(ctx, &credential, &slot);
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to load stored STA credential: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to load stored STA credential: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
     err = app_wifiman_impl_validate_credential(&credential);
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Stored STA credential is invalid: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Stored STA credential is invalid: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
@@ -503,6 +1135,9 @@ static dom_models_error_t connect_stored_sta_impl(
 
     dom_models_wifi_sta_connect_config_t config;
     app_wifiman_impl_credential_to_connect_config(&config, &credential);
+    prepare_fast_connect(ctx, &config, tag);
+
+    begin_profile_attempt(ctx, slot);
 
     ctx->sta_connect_source                = APP_WIFIMAN_IMPL_STA_CONNECT_SOURCE_INITIAL;
     ctx->sta_connection_commit_required    = false;
@@ -511,19 +1146,21 @@ static dom_models_error_t connect_stored_sta_impl(
     err = ctx->cfg.wifi->connect_sta(ctx->cfg.wifi, &config);
     if (err != DOMAIN_MODELS_ERROR_OK) {
         ctx->sta_connect_source = APP_WIFIMAN_IMPL_STA_CONNECT_SOURCE_NONE;
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to connect stored STA: %s (%d)", dom_models_error_str(err), (int)err);
+        end_fast_connect(ctx, true);
+        fail_profile_attempt(ctx);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to connect stored STA: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
     ctx->auto_reconnect_enabled = true;
     ctx->reconnect_trial_count  = 0;
 
-    ctx->cfg.logger->info(ctx->cfg.logger, tag, "Stored STA connection request accepted successfully");
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "Stored STA connection request accepted successfully");
 
     return DOMAIN_MODELS_ERROR_OK;
 }
 
-static dom_models_error_t disconnect_sta_impl(
+static dom_models_error_t disconnect_sta_locked(
     dom_usecases_wifiman_t* self
 ) {
     const char* tag = BASE_TAG"/disconnect_sta";
@@ -534,6 +1171,8 @@ static dom_models_error_t disconnect_sta_impl(
         return err;
     }
 
+    ctx->link.roam_state = APP_WIFIMAN_IMPL_ROAM_STATE_IDLE;
+
     err = ctx->cfg.wifi->disconnect_sta(ctx->cfg.wifi);
     if (err != DOMAIN_MODELS_ERROR_OK) {
         dom_models_wifi_status_t status;
@@ -550,11 +1189,11 @@ static dom_models_error_t disconnect_sta_impl(
                     return err;
                 }
             }
-            ctx->cfg.logger->info(ctx->cfg.logger, tag, "STA disconnected successfully");
+            DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "STA disconnected successfully");
             return DOMAIN_MODELS_ERROR_OK;
         }
 
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to disconnect STA: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to disconnect STA: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
@@ -571,12 +1210,12 @@ static dom_models_error_t disconnect_sta_impl(
         }
     }
 
-    ctx->cfg.logger->info(ctx->cfg.logger, tag, "STA disconnected successfully");
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "STA disconnected successfully");
 
     return DOMAIN_MODELS_ERROR_OK;
 }
 
-static dom_models_error_t commit_sta_connection_impl(
+static dom_models_error_t commit_sta_connection_locked(
     dom_usecases_wifiman_t* self
 ) {
     const char* tag = BASE_TAG"/commit_sta_connection";
@@ -590,12 +1229,12 @@ static dom_models_error_t commit_sta_connection_impl(
     dom_models_wifi_status_t status;
     err = ctx->cfg.wifi->get_status(ctx->cfg.wifi, &status);
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to get WiFi status before STA commit: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to get WiFi status before STA commit: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
     if (!status.connected) {
         err = DOMAIN_MODELS_ERROR_BAD_STATE;
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Cannot commit STA connection because STA is not connected: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Cannot commit STA connection because STA is not connected: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
@@ -610,12 +1249,12 @@ static dom_models_error_t commit_sta_connection_impl(
     ctx->ap_enabled_by_reconnect_threshold = false;
     ctx->sta_connect_source                = APP_WIFIMAN_IMPL_STA_CONNECT_SOURCE_NONE;
 
-    ctx->cfg.logger->info(ctx->cfg.logger, tag, "STA connection committed successfully");
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "STA connection committed successfully");
 
     return DOMAIN_MODELS_ERROR_OK;
 }
 
-static dom_models_error_t get_stored_sta_impl(
+static dom_models_error_t get_stored_sta_locked(
     dom_usecases_wifiman_t*            self,
     dom_usecases_wifiman_stored_sta_t* out
 ) {
@@ -628,22 +1267,22 @@ static dom_models_error_t get_stored_sta_impl(
     }
     if (!out) {
         err = DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Missing stored STA output: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Missing stored STA output: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
     err = app_wifiman_impl_load_stored_sta(ctx, out);
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to load stored STA credential view: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to load stored STA credential view: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
-    ctx->cfg.logger->info(ctx->cfg.logger, tag, "Stored STA credential view loaded successfully");
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "Stored STA credential view loaded successfully");
 
     return DOMAIN_MODELS_ERROR_OK;
 }
 
-static dom_models_error_t set_sta_credential_impl(
+static dom_models_error_t set_sta_credential_locked(
     dom_usecases_wifiman_t*                  self,
     const dom_models_wifi_sta_credential_t* credential
 ) {
@@ -657,13 +1296,12 @@ static dom_models_error_t set_sta_credential_impl(
 
     err = app_wifiman_impl_validate_credential(credential);
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Invalid STA credential: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Invalid STA credential: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
-    err = ctx->cfg.wifi_repository->set_sta_credential(ctx->cfg.wifi_repository, credential);
+    err = store_credential(ctx, credential, NULL, tag);
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to store STA credential: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
@@ -673,12 +1311,12 @@ static dom_models_error_t set_sta_credential_impl(
     ctx->ap_enabled_by_reconnect_threshold = false;
     ctx->reconnect_trial_count             = 0;
 
-    ctx->cfg.logger->info(ctx->cfg.logger, tag, "STA credential stored successfully");
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "STA credential stored successfully");
 
     return DOMAIN_MODELS_ERROR_OK;
 }
 
-static dom_models_error_t forget_sta_credential_impl(
+static dom_models_error_t forget_sta_credential_locked(
     dom_usecases_wifiman_t* self
 ) {
     const char* tag = BASE_TAG"/forget_sta_credential";
@@ -691,7 +1329,7 @@ static dom_models_error_t forget_sta_credential_impl(
 
     err = ctx->cfg.wifi_repository->clear_sta_credential(ctx->cfg.wifi_repository);
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to forget STA credential: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to forget STA credential: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
@@ -700,6 +1338,12 @@ static dom_models_error_t forget_sta_credential_impl(
     ctx->ap_enabled_by_reconnect_threshold = false;
     ctx->sta_connect_source                = APP_WIFIMAN_IMPL_STA_CONNECT_SOURCE_NONE;
     ctx->reconnect_trial_count             = 0;
+    ctx->last_ap_loaded                    = true;
+    ctx->last_ap_available                 = false;
+    ctx->profiles_loaded                   = true;
+    memset(&ctx->profiles, 0, sizeof(dom_models_wifi_sta_profiles_t));
+    end_fast_connect(ctx, false);
+    reset_profile_attempts(ctx);
 
     if (ctx->cfg.ap_auto_manage_enabled) {
         err = ensure_apsta(ctx, tag);
@@ -708,12 +1352,149 @@ static dom_models_error_t forget_sta_credential_impl(
         }
     }
 
-    ctx->cfg.logger->info(ctx->cfg.logger, tag, "STA credential forgotten successfully");
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "STA credential forgotten successfully");
 
     return DOMAIN_MODELS_ERROR_OK;
 }
 
-static dom_models_error_t need_reconnect_impl(
+static dom_models_error_t get_sta_profiles_locked(
+    dom_usecases_wifiman_t*              self,
+    dom_usecases_wifiman_sta_profiles_t* out
+) {
+    const char* tag = BASE_TAG"/get_sta_profiles";
+
+    app_wifiman_impl_ctx_t* ctx = NULL;
+    dom_models_error_t      err = get_ctx(self, &ctx);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+    if (!out) {
+        err = DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Missing STA profiles output: %s (%d)", dom_models_error_str(err), (int)err);
+        return err;
+    }
+
+    memset(out, 0, sizeof(dom_usecases_wifiman_sta_profiles_t));
+
+    err = app_wifiman_impl_load_profiles(ctx);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to load STA profiles: %s (%d)", dom_models_error_str(err), (int)err);
+        return err;
+    }
+
+    err = refresh_scan_cache(ctx, tag);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
+    app_wifiman_impl_profile_rank_t ranks[DOM_MODELS_WIFI_STA_PROFILE_MAX];
+    out->count = app_wifiman_impl_rank_profiles(&ctx->profiles, ctx->scan_cache_valid ? &ctx->scan_cache : NULL, ranks);
+
+    for (size_t i = 0; i < out->count; i++) {
+        const dom_models_wifi_sta_profile_t* profile = &ctx->profiles.profiles[ranks[i].slot];
+        dom_usecases_wifiman_sta_profile_t*  view    = &out->profiles[i];
+
+        app_wifiman_impl_copy_cstr(view->ssid, sizeof(view->ssid), profile->credential.ssid);
+        view->priority         = profile->priority;
+        view->last_success_seq = profile->last_success_seq;
+        view->failure_cnt      = profile->failure_cnt;
+        view->in_range         = ranks[i].in_range;
+        view->rssi             = ranks[i].rssi;
+    }
+
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "STA profiles loaded successfully");
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+static dom_models_error_t set_sta_profile_locked(
+    dom_usecases_wifiman_t*                 self,
+    const dom_models_wifi_sta_credential_t* credential,
+    uint8_t                                 priority
+) {
+    const char* tag = BASE_TAG"/set_sta_profile";
+
+    app_wifiman_impl_ctx_t* ctx = NULL;
+    dom_models_error_t      err = get_ctx(self, &ctx);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
+    err = app_wifiman_impl_validate_credential(credential);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Invalid STA credential: %s (%d)", dom_models_error_str(err), (int)err);
+        return err;
+    }
+
+    err = app_wifiman_impl_load_profiles(ctx);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to load STA profiles: %s (%d)", dom_models_error_str(err), (int)err);
+        return err;
+    }
+
+    err = app_wifiman_impl_upsert_profile(&ctx->profiles, credential, priority, false, NULL);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to set STA profile: %s (%d)", dom_models_error_str(err), (int)err);
+        return err;
+    }
+    reset_profile_attempts(ctx);
+
+    err = store_profiles(ctx, tag);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
+    ctx->auto_reconnect_enabled = true;
+
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "STA profile stored successfully");
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+static dom_models_error_t delete_sta_profile_locked(
+    dom_usecases_wifiman_t* self,
+    const char*             ssid
+) {
+    const char* tag = BASE_TAG"/delete_sta_profile";
+
+    app_wifiman_impl_ctx_t* ctx = NULL;
+    dom_models_error_t      err = get_ctx(self, &ctx);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+    if (!ssid || ssid[0] == '\0') {
+        err = DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Missing STA profile SSID: %s (%d)", dom_models_error_str(err), (int)err);
+        return err;
+    }
+
+    err = app_wifiman_impl_load_profiles(ctx);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to load STA profiles: %s (%d)", dom_models_error_str(err), (int)err);
+        return err;
+    }
+
+    size_t slot = 0;
+    if (!app_wifiman_impl_find_profile(&ctx->profiles, ssid, &slot)) {
+        err = DOMAIN_MODELS_ERROR_NOT_FOUND;
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "STA profile not found: %s (%d)", dom_models_error_str(err), (int)err);
+        return err;
+    }
+
+    app_wifiman_impl_remove_profile(&ctx->profiles, slot);
+    reset_profile_attempts(ctx);
+
+    err = store_profiles(ctx, tag);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "STA profile deleted successfully");
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+static dom_models_error_t need_reconnect_locked(
     dom_usecases_wifiman_t* self,
     bool*                   out
 ) {
@@ -726,21 +1507,21 @@ static dom_models_error_t need_reconnect_impl(
     }
     if (!out) {
         err = DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Missing reconnect output: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Missing reconnect output: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
     *out = false;
 
     if (!ctx->auto_reconnect_enabled) {
-        ctx->cfg.logger->info(ctx->cfg.logger, tag, "Reconnect is not needed because auto reconnect is disabled");
+        DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "Reconnect is not needed because auto reconnect is disabled");
         return DOMAIN_MODELS_ERROR_OK;
     }
 
     dom_models_wifi_status_t status;
     err = ctx->cfg.wifi->get_status(ctx->cfg.wifi, &status);
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to get WiFi status for reconnect decision: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to get WiFi status for reconnect decision: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
@@ -757,7 +1538,7 @@ static dom_models_error_t need_reconnect_impl(
             }
         }
 
-        ctx->cfg.logger->info(ctx->cfg.logger, tag, "Reconnect is not needed because STA is connected");
+        DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "Reconnect is not needed because STA is connected");
         return DOMAIN_MODELS_ERROR_OK;
     }
 
@@ -769,11 +1550,11 @@ static dom_models_error_t need_reconnect_impl(
             }
             ctx->ap_enabled_by_reconnect_threshold = true;
         }
-        ctx->cfg.logger->info(ctx->cfg.logger, tag, "AP enabled because reconnect trial threshold is reached");
+        DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "AP enabled because reconnect trial threshold is reached");
     }
 
     dom_models_wifi_sta_credential_t credential;
-    err = app_wifiman_impl_load_stored_credential(ctx, &credential);
+    err = app_wifiman_impl_load_stored_credential(ctx, &credential, NULL);
     if (err == DOMAIN_MODELS_ERROR_NOT_FOUND) {
         if (ctx->cfg.ap_auto_manage_enabled) {
             err = ensure_apsta(ctx, tag);
@@ -781,28 +1562,28 @@ static dom_models_error_t need_reconnect_impl(
                 return err;
             }
         }
-        ctx->cfg.logger->info(ctx->cfg.logger, tag, "Reconnect is not needed because no stored credential is available");
+        DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "Reconnect is not needed because no stored credential is available");
         return DOMAIN_MODELS_ERROR_OK;
     }
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to load stored credential for reconnect decision: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to load stored credential for reconnect decision: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
     err = app_wifiman_impl_validate_credential(&credential);
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Stored credential is invalid for reconnect: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Stored credential is invalid for reconnect: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
     *out = true;
 
-    ctx->cfg.logger->info(ctx->cfg.logger, tag, "Reconnect is needed");
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "Reconnect is needed");
 
     return DOMAIN_MODELS_ERROR_OK;
 }
 
-static dom_models_error_t try_reconnect_impl(
+static dom_models_error_t try_reconnect_locked(
     dom_usecases_wifiman_t* self,
     bool*                   attempted
 ) {
@@ -815,28 +1596,31 @@ static dom_models_error_t try_reconnect_impl(
     }
     if (!attempted) {
         err = DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Missing reconnect attempted output: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Missing reconnect attempted output: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
     *attempted = false;
 
     bool needed = false;
-    err = need_reconnect_impl(self, &needed);
+    err = need_reconnect_locked(self, &needed);
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to evaluate reconnect need: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to evaluate reconnect need: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
     if (!needed) {
-        ctx->cfg.logger->info(ctx->cfg.logger, tag, "Reconnect was not attempted because it is not needed");
+        DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "Reconnect was not attempted because it is not needed");
         return DOMAIN_MODELS_ERROR_OK;
     }
 
+    (void)refresh_scan_cache(ctx, tag);
+
     dom_models_wifi_sta_credential_t credential;
-    err = app_wifiman_impl_load_stored_credential(ctx, &credential);
+    size_t                           slot = 0;
+    err = app_wifiman_impl_load_stored_credential(ctx, &credential, &slot);
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to load stored credential for reconnect: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to load stored credential for reconnect: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
@@ -847,27 +1631,84 @@ static dom_models_error_t try_reconnect_impl(
 
     dom_models_wifi_sta_connect_config_t config;
     app_wifiman_impl_credential_to_connect_config(&config, &credential);
+    prepare_fast_connect(ctx, &config, tag);
+    begin_profile_attempt(ctx, slot);
 
     ctx->reconnect_trial_count++;
     *attempted = true;
     ctx->sta_connect_source             = APP_WIFIMAN_IMPL_STA_CONNECT_SOURCE_RECONNECT;
     ctx->sta_connection_commit_required = false;
 
-    err = ctx->cfg.wifi->connect_sta(ctx->cfg.wifi, &config);
-    if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->sta_connect_source = APP_WIFIMAN_IMPL_STA_CONNECT_SOURCE_NONE;
-        if (ctx->cfg.ap_auto_manage_enabled && ctx->reconnect_trial_count >= ctx->cfg.reconnect_max_trials) {
-            dom_models_error_t ap_err = ensure_apsta(ctx, tag);
-            if (ap_err != DOMAIN_MODELS_ERROR_OK) {
-                return ap_err;
-            }
-            ctx->ap_enabled_by_reconnect_threshold = true;
+    err = ctx->cfg.wifi->connect_sta(ctx->cfg.wifi, &config);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        ctx->sta_connect_source = APP_WIFIMAN_IMPL_STA_CONNECT_SOURCE_NONE;
+        end_fast_connect(ctx, true);
+        fail_profile_attempt(ctx);
+        if (ctx->cfg.ap_auto_manage_enabled && ctx->reconnect_trial_count >= ctx->cfg.reconnect_max_trials) {
+            dom_models_error_t ap_err = ensure_apsta(ctx, tag);
+            if (ap_err != DOMAIN_MODELS_ERROR_OK) {
+                return ap_err;
+            }
+            ctx->ap_enabled_by_reconnect_threshold = true;
+        }
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to reconnect using stored STA credential: %s (%d)", dom_models_error_str(err), (int)err);
+        return err;
+    }
+
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "STA reconnect request accepted successfully");
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+static dom_models_error_t monitor_link_locked(
+    dom_usecases_wifiman_t* self
+) {
+    const char* tag = BASE_TAG"/monitor_link";
+
+    app_wifiman_impl_ctx_t* ctx = NULL;
+    dom_models_error_t      err = get_ctx(self, &ctx);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
+    /* The only reader that needs a live RSSI, the refresh also ages the snapshot everyone else reads */
+    dom_models_wifi_status_t status;
+    err = ctx->cfg.wifi->refresh_status(ctx->cfg.wifi, &status);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to refresh WiFi status for link sample: %s (%d)", dom_models_error_str(err), (int)err);
+        return err;
+    }
+
+    const dom_models_wifi_ap_record_t* ap = NULL;
+    if (status.connected && status.connected_ap_available && status.connected_ap.bssid_available) {
+        ap = &status.connected_ap;
+    }
+
+    app_wifiman_impl_link_monitor_t* link = &ctx->link;
+    app_wifiman_impl_link_sample(link, &ctx->cfg, ap);
+
+    if (!ap) {
+        /* A roam in flight is settled by the next connection, wherever the reconnect lands */
+        if (link->roam_state == APP_WIFIMAN_IMPL_ROAM_STATE_SCANNING) {
+            link->roam_state = APP_WIFIMAN_IMPL_ROAM_STATE_IDLE;
         }
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to reconnect using stored STA credential: %s (%d)", dom_models_error_str(err), (int)err);
-        return err;
+        return DOMAIN_MODELS_ERROR_OK;
     }
 
-    ctx->cfg.logger->info(ctx->cfg.logger, tag, "STA reconnect request accepted successfully");
+    if (link->roam_state == APP_WIFIMAN_IMPL_ROAM_STATE_ROAMING) {
+        end_roam(ctx, memcmp(ap->bssid, link->roam_target.bssid, DOM_MODELS_WIFI_MAC_LEN) == 0, tag);
+        return DOMAIN_MODELS_ERROR_OK;
+    }
+    if (link->roam_state == APP_WIFIMAN_IMPL_ROAM_STATE_SCANNING) {
+        return check_roam_scan(ctx, ap, tag);
+    }
+    if (link->cooldown > 0) {
+        link->cooldown--;
+        return DOMAIN_MODELS_ERROR_OK;
+    }
+    if (link->stats.weak && link->weak_run >= ctx->cfg.roam_weak_samples) {
+        return start_roam_scan(self, ctx, ap, tag);
+    }
 
     return DOMAIN_MODELS_ERROR_OK;
 }
@@ -883,18 +1724,38 @@ static void on_wifi_event(
     void*                          cb_ctx,
     const dom_models_wifi_event_t* event
 ) {
-    const char* tag = BASE_TAG"/on_wifi_event";
-
     if (!cb_ctx || !event) {
         return;
     }
 
     app_wifiman_impl_ctx_t* ctx = cb_ctx;
-    dom_models_error_t      err;
+
+    lock(ctx);
+    handle_wifi_event(ctx, event);
+    unlock(ctx);
+}
+
+static void handle_wifi_event(
+    app_wifiman_impl_ctx_t*        ctx,
+    const dom_models_wifi_event_t* event
+) {
+    const char* tag = BASE_TAG"/on_wifi_event";
+
+    dom_models_error_t err;
 
     switch (event->type) {
         case DOM_MODELS_WIFI_EVENT_STA_CONNECTED:
             ctx->reconnect_trial_count = 0;
+            end_fast_connect(ctx, false);
+
+            dom_models_wifi_status_t status;
+            err = ctx->cfg.wifi->get_status(ctx->cfg.wifi, &status);
+            if (err == DOMAIN_MODELS_ERROR_OK) {
+                remember_connected_ap(ctx, &status, tag);
+            } else {
+                DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to get WiFi status after STA connected event: %s (%d)", dom_models_error_str(err), (int)err);
+            }
+            remember_connected_profile(ctx, err == DOMAIN_MODELS_ERROR_OK ? &status : NULL, tag);
 
             if (ctx->cfg.ap_auto_manage_enabled && ctx->sta_connect_source == APP_WIFIMAN_IMPL_STA_CONNECT_SOURCE_INITIAL) {
                 ctx->sta_connection_commit_required    = true;
@@ -910,7 +1771,7 @@ static void on_wifi_event(
                 if (ctx->ap_started) {
                     err = stop_ap(ctx, tag);
                     if (err != DOMAIN_MODELS_ERROR_OK) {
-                        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to disable AP after STA reconnection: %s (%d)", dom_models_error_str(err), (int)err);
+                        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to disable AP after STA reconnection: %s (%d)", dom_models_error_str(err), (int)err);
                     }
                 }
             } else {
@@ -918,11 +1779,13 @@ static void on_wifi_event(
                 ctx->sta_connect_source                = APP_WIFIMAN_IMPL_STA_CONNECT_SOURCE_NONE;
             }
 
-            ctx->cfg.logger->info(ctx->cfg.logger, tag, "STA connected event handled successfully");
+            DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "STA connected event handled successfully");
             break;
 
         case DOM_MODELS_WIFI_EVENT_STA_DISCONNECTED:
             ctx->sta_connection_commit_required = false;
+            end_fast_connect(ctx, true);
+            fail_profile_attempt(ctx);
 
             bool reconnect_threshold_reached = ctx->reconnect_trial_count >= ctx->cfg.reconnect_max_trials;
             if (ctx->cfg.ap_auto_manage_enabled &&
@@ -931,31 +1794,40 @@ static void on_wifi_event(
                  reconnect_threshold_reached)) {
                 err = ensure_apsta(ctx, tag);
                 if (err != DOMAIN_MODELS_ERROR_OK) {
-                    ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to enable AP after STA disconnected event: %s (%d)", dom_models_error_str(err), (int)err);
+                    DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to enable AP after STA disconnected event: %s (%d)", dom_models_error_str(err), (int)err);
                 } else if (reconnect_threshold_reached) {
                     ctx->ap_enabled_by_reconnect_threshold = true;
                 }
             }
 
             ctx->sta_connect_source = APP_WIFIMAN_IMPL_STA_CONNECT_SOURCE_NONE;
-            ctx->cfg.logger->info(ctx->cfg.logger, tag, "STA disconnected event handled successfully with driver status %u", (unsigned int)event->driver_status);
+            DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "STA disconnected event handled successfully with driver status %u", (unsigned int)event->driver_status);
             break;
 
         case DOM_MODELS_WIFI_EVENT_AP_STARTED:
             ctx->ap_started = true;
             ctx->started    = true;
-            ctx->cfg.logger->info(ctx->cfg.logger, tag, "AP started event handled successfully");
+            DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "AP started event handled successfully");
             break;
 
         case DOM_MODELS_WIFI_EVENT_AP_STOPPED:
             ctx->ap_started                         = false;
             ctx->ap_enabled_by_reconnect_threshold = false;
-            ctx->cfg.logger->info(ctx->cfg.logger, tag, "AP stopped event handled successfully");
+            DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "AP stopped event handled successfully");
+            break;
+
+        case DOM_MODELS_WIFI_EVENT_STA_GOT_IP:
+        case DOM_MODELS_WIFI_EVENT_STA_LOST_IP:
+            /* Addressing is reported through the network interface, nothing to manage */
+            break;
+
+        case DOM_MODELS_WIFI_EVENT_SCAN_DONE:
+            /* Scan results are read on demand */
             break;
 
         case DOM_MODELS_WIFI_EVENT_UNKNOWN:
         default:
-            ctx->cfg.logger->info(ctx->cfg.logger, tag, "Unknown WiFi event ignored successfully");
+            DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "Unknown WiFi event ignored successfully");
             break;
     }
 }
@@ -973,12 +1845,12 @@ static dom_models_error_t register_wifi_event_callback(
 
     dom_models_error_t err = ctx->cfg.wifi->add_event_callback(ctx->cfg.wifi, ctx, on_wifi_event);
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to register WiFi event callback: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to register WiFi event callback: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
     ctx->event_callback_registered = true;
-    ctx->cfg.logger->info(ctx->cfg.logger, tag, "WiFi event callback registered successfully");
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "WiFi event callback registered successfully");
 
     return DOMAIN_MODELS_ERROR_OK;
 }
@@ -1010,7 +1882,7 @@ static dom_models_error_t ensure_sta(
     dom_models_wifi_status_t status;
     err = ctx->cfg.wifi->get_status(ctx->cfg.wifi, &status);
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to get WiFi status before STA ensure: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to get WiFi status before STA ensure: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
@@ -1022,14 +1894,14 @@ static dom_models_error_t ensure_sta(
 
     err = ctx->cfg.wifi->set_mode(ctx->cfg.wifi, DOM_MODELS_WIFI_MODE_STA);
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to set STA mode: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to set STA mode: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
     if (!status.started) {
         err = ctx->cfg.wifi->start(ctx->cfg.wifi);
         if (err != DOMAIN_MODELS_ERROR_OK) {
-            ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to start WiFi: %s (%d)", dom_models_error_str(err), (int)err);
+            DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to start WiFi: %s (%d)", dom_models_error_str(err), (int)err);
             return err;
         }
     }
@@ -1056,7 +1928,7 @@ static dom_models_error_t ensure_apsta(
     dom_models_wifi_status_t status;
     err = ctx->cfg.wifi->get_status(ctx->cfg.wifi, &status);
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to get WiFi status before APSTA ensure: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to get WiFi status before APSTA ensure: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
@@ -1067,14 +1939,14 @@ static dom_models_error_t ensure_apsta(
 
     err = ctx->cfg.wifi->set_mode(ctx->cfg.wifi, DOM_MODELS_WIFI_MODE_APSTA);
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to set APSTA mode: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to set APSTA mode: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
     if (!status.started) {
         err = ctx->cfg.wifi->start(ctx->cfg.wifi);
         if (err != DOMAIN_MODELS_ERROR_OK) {
-            ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to start WiFi: %s (%d)", dom_models_error_str(err), (int)err);
+            DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to start WiFi: %s (%d)", dom_models_error_str(err), (int)err);
             return err;
         }
     }
@@ -1082,13 +1954,13 @@ static dom_models_error_t ensure_apsta(
     dom_models_wifi_ap_config_t ap_config;
     err = app_wifiman_impl_load_ap_config(ctx, &ap_config);
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to load AP configuration: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to load AP configuration: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
     err = ctx->cfg.wifi->start_ap(ctx->cfg.wifi, &ap_config);
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to start AP: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to start AP: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
@@ -1108,17 +1980,494 @@ static dom_models_error_t stop_ap(
 
     dom_models_error_t err = ctx->cfg.wifi->stop_ap(ctx->cfg.wifi);
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->cfg.logger->error(ctx->cfg.logger, tag, "Failed to stop AP: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to stop AP: %s (%d)", dom_models_error_str(err), (int)err);
         return err;
     }
 
     ctx->ap_started = false;
     ctx->ap_enabled_by_reconnect_threshold = false;
-    ctx->cfg.logger->info(ctx->cfg.logger, tag, "AP stopped successfully");
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "AP stopped successfully");
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+static bool get_now(
+    app_wifiman_impl_ctx_t* ctx,
+    int64_t*                out
+) {
+    if (!ctx || !ctx->cfg.clock || !out) {
+        return false;
+    }
+
+    return ctx->cfg.clock->get_uptime_ms(ctx->cfg.clock, out) == DOMAIN_MODELS_ERROR_OK;
+}
+
+/*
+ * A reconnect to the stored network goes straight to the BSSID and channel
+ * it last joined, one channel instead of all of them. Once such an attempt
+ * fails, the attempts that follow scan every channel until one succeeds.
+ */
+static void prepare_fast_connect(
+    app_wifiman_impl_ctx_t*               ctx,
+    dom_models_wifi_sta_connect_config_t* config,
+    const char*                           tag
+) {
+    ctx->sta_connect_fast = false;
+    if (ctx->sta_fast_connect_failed) {
+        return;
+    }
+
+    /* A reconnect during a roam goes on to the roam target rather than back to the AP it left */
+    dom_models_wifi_sta_last_ap_t roam_target;
+    if (ctx->link.roam_state == APP_WIFIMAN_IMPL_ROAM_STATE_ROAMING &&
+        app_wifiman_impl_last_ap_from_record(&roam_target, &ctx->link.roam_target)) {
+        if (!app_wifiman_impl_apply_last_ap(config, &roam_target)) {
+            return;
+        }
+
+        ctx->sta_connect_fast = true;
+        DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "Fast STA connect to roam target on channel %u", (unsigned int)config->channel);
+        return;
+    }
+
+    if (!ctx->last_ap_loaded) {
+        dom_models_error_t err = ctx->cfg.wifi_repository->get_sta_last_ap(ctx->cfg.wifi_repository, &ctx->last_ap);
+        if (err != DOMAIN_MODELS_ERROR_OK && err != DOMAIN_MODELS_ERROR_NOT_FOUND) {
+            DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to load last STA AP: %s (%d)", dom_models_error_str(err), (int)err);
+            return;
+        }
+        ctx->last_ap_loaded    = true;
+        ctx->last_ap_available = err == DOMAIN_MODELS_ERROR_OK;
+    }
+
+    if (!ctx->last_ap_available || !app_wifiman_impl_apply_last_ap(config, &ctx->last_ap)) {
+        return;
+    }
+
+    ctx->sta_connect_fast = true;
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "Fast STA connect on channel %u", (unsigned int)config->channel);
+}
+
+static void end_fast_connect(
+    app_wifiman_impl_ctx_t* ctx,
+    bool                    failed
+) {
+    if (!failed) {
+        ctx->sta_fast_connect_failed = false;
+    } else if (ctx->sta_connect_fast) {
+        ctx->sta_fast_connect_failed = true;
+    }
+
+    ctx->sta_connect_fast = false;
+}
+
+/* Written only when the AP changed, a roam or a reconnect to the same AP costs no flash */
+static void remember_connected_ap(
+    app_wifiman_impl_ctx_t*         ctx,
+    const dom_models_wifi_status_t* status,
+    const char*                     tag
+) {
+    dom_models_wifi_sta_last_ap_t last_ap;
+    if (!app_wifiman_impl_last_ap_from_status(&last_ap, status)) {
+        return;
+    }
+    if (ctx->last_ap_loaded && ctx->last_ap_available && memcmp(&ctx->last_ap, &last_ap, sizeof(dom_models_wifi_sta_last_ap_t)) == 0) {
+        return;
+    }
+
+    dom_models_error_t err = ctx->cfg.wifi_repository->set_sta_last_ap(ctx->cfg.wifi_repository, &last_ap);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to store last STA AP: %s (%d)", dom_models_error_str(err), (int)err);
+        return;
+    }
+
+    memcpy(&ctx->last_ap, &last_ap, sizeof(dom_models_wifi_sta_last_ap_t));
+    ctx->last_ap_loaded    = true;
+    ctx->last_ap_available = true;
+}
+
+static void begin_profile_attempt(
+    app_wifiman_impl_ctx_t* ctx,
+    size_t                  slot
+) {
+    /* A round ends once every profile was tried, the ranking then starts over */
+    uint32_t all = (1u << ctx->profiles.count) - 1u;
+    if ((ctx->sta_profile_tried & all) == all) {
+        ctx->sta_profile_tried = 0;
+    }
+
+    ctx->sta_profile_tried |= 1u << slot;
+    ctx->sta_profile_attempt = true;
+    ctx->sta_profile_slot    = slot;
+}
+
+/* Counted in memory only, a failing link would otherwise write flash on every retry */
+static void fail_profile_attempt(
+    app_wifiman_impl_ctx_t* ctx
+) {
+    if (!ctx->sta_profile_attempt) {
+        return;
+    }
+
+    ctx->sta_profile_attempt = false;
+    if (ctx->sta_profile_slot < ctx->profiles.count) {
+        dom_models_wifi_sta_profile_t* profile = &ctx->profiles.profiles[ctx->sta_profile_slot];
+        if (profile->failure_cnt < UINT16_MAX) {
+            profile->failure_cnt++;
+        }
+    }
+}
+
+/* Slots move when profiles change, so a round in progress cannot be trusted afterwards */
+static void reset_profile_attempts(
+    app_wifiman_impl_ctx_t* ctx
+) {
+    ctx->sta_profile_tried   = 0;
+    ctx->sta_profile_attempt = false;
+    ctx->sta_profile_slot    = 0;
+}
+
+/*
+ * The joined SSID names the profile, the attempt slot stands in when the
+ * driver does not report it. Written only when another profile held the
+ * latest success, a reconnect to the same network costs no flash.
+ */
+static void remember_connected_profile(
+    app_wifiman_impl_ctx_t*         ctx,
+    const dom_models_wifi_status_t* status,
+    const char*                     tag
+) {
+    size_t slot  = ctx->sta_profile_slot;
+    bool   found = ctx->sta_profile_attempt && slot < ctx->profiles.count;
+    if (status && status->connected_ap_available && status->connected_ap.ssid[0] != '\0') {
+        found = app_wifiman_impl_find_profile(&ctx->profiles, status->connected_ap.ssid, &slot);
+    }
+
+    ctx->sta_profile_tried   = 0;
+    ctx->sta_profile_attempt = false;
+    if (!ctx->profiles_loaded || !found) {
+        return;
+    }
+
+    dom_models_wifi_sta_profile_t* profile = &ctx->profiles.profiles[slot];
+    profile->failure_cnt                   = 0;
+    if (profile->last_success_seq != 0 && profile->last_success_seq == ctx->profiles.success_seq) {
+        return;
+    }
+
+    ctx->profiles.success_seq++;
+    profile->last_success_seq = ctx->profiles.success_seq;
+    (void)store_profiles(ctx, tag);
+}
+
+static dom_models_error_t store_profiles(
+    app_wifiman_impl_ctx_t* ctx,
+    const char*             tag
+) {
+    dom_models_error_t err = ctx->cfg.wifi_repository->set_sta_profiles(ctx->cfg.wifi_repository, &ctx->profiles);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        /* Read back on next use rather than serve what never reached the repository */
+        ctx->profiles_loaded = false;
+        reset_profile_attempts(ctx);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to store STA profiles: %s (%d)", dom_models_error_str(err), (int)err);
+        return err;
+    }
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+/* The single credential API keeps a known network's priority and evicts when the store is full */
+static dom_models_error_t store_credential(
+    app_wifiman_impl_ctx_t*                 ctx,
+    const dom_models_wifi_sta_credential_t* credential,
+    size_t*                                 out_slot,
+    const char*                             tag
+) {
+    dom_models_error_t err = app_wifiman_impl_load_profiles(ctx);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to load STA profiles: %s (%d)", dom_models_error_str(err), (int)err);
+        return err;
+    }
+
+    uint8_t priority = 0;
+    size_t  slot     = 0;
+    if (app_wifiman_impl_find_profile(&ctx->profiles, credential->ssid, &slot)) {
+        priority = ctx->profiles.profiles[slot].priority;
+    }
+
+    err = app_wifiman_impl_upsert_profile(&ctx->profiles, credential, priority, true, &slot);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to add STA profile: %s (%d)", dom_models_error_str(err), (int)err);
+        return err;
+    }
+    reset_profile_attempts(ctx);
+
+    err = store_profiles(ctx, tag);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
+    if (out_slot) {
+        *out_slot = slot;
+    }
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+/*
+ * Polls the driver instead of relying on the scan done event, the event
+ * callback is only registered when the AP is auto managed.
+ */
+static dom_models_error_t refresh_scan_cache(
+    app_wifiman_impl_ctx_t* ctx,
+    const char*             tag
+) {
+    if (!ctx) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    dom_models_wifi_scan_result_t scan;
+    dom_models_error_t            err = ctx->cfg.wifi->get_scanned(ctx->cfg.wifi, &scan, 0, NULL, 0, NULL);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to get WiFi scan result: %s (%d)", dom_models_error_str(err), (int)err);
+        return err;
+    }
+
+    bool finished = scan.status == DOM_MODELS_WIFI_SCAN_STATUS_DONE &&
+                    (ctx->scan_pending || !ctx->scan_cache_valid || scan.scan_id != ctx->scan_status.scan_id);
+    if (finished) {
+        err = load_scan(ctx, &scan, tag);
+        if (err != DOMAIN_MODELS_ERROR_OK) {
+            return err;
+        }
+    }
+    if (scan.status != DOM_MODELS_WIFI_SCAN_STATUS_RUNNING) {
+        ctx->scan_pending = false;
+    }
+
+    memcpy(&ctx->scan_status, &scan, sizeof(dom_models_wifi_scan_result_t));
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+/*
+ * Reads the driver records in small pages straight into the cache merge,
+ * so no full copy of the scan exists outside the driver. Runs under
+ * ctx->lock, which also owns scan_read.
+ */
+static dom_models_error_t load_scan(
+    app_wifiman_impl_ctx_t*              ctx,
+    const dom_models_wifi_scan_result_t* scan,
+    const char*                          tag
+) {
+    int64_t now_ms        = 0;
+    bool    now_available = get_now(ctx, &now_ms);
+
+    app_wifiman_impl_scan_cache_begin(&ctx->scan_cache);
+
+    size_t offset = 0;
+    while (offset < scan->count) {
+        dom_models_wifi_scan_result_t page;
+        size_t                        read_cnt = 0;
+
+        dom_models_error_t err = ctx->cfg.wifi->get_scanned(ctx->cfg.wifi, &page, offset, ctx->scan_read, APP_WIFIMAN_IMPL_SCAN_READ_LEN, &read_cnt);
+        if (err != DOMAIN_MODELS_ERROR_OK) {
+            DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to read WiFi scan records: %s (%d)", dom_models_error_str(err), (int)err);
+            /* Pages merged so far are kept, but the cache must leave sorted */
+            app_wifiman_impl_scan_cache_abort(&ctx->scan_cache);
+            return err;
+        }
+        if (read_cnt == 0 || page.scan_id != scan->scan_id) {
+            break;
+        }
+
+        for (size_t i = 0; i < read_cnt; i++) {
+            app_wifiman_impl_scan_cache_merge(&ctx->scan_cache, &ctx->scan_read[i], now_available ? now_ms : 0, ctx->cfg.scan_dedup_by_ssid);
+        }
+        offset += read_cnt;
+    }
+
+    app_wifiman_impl_scan_cache_end(&ctx->scan_cache, now_available, now_ms, ctx->cfg.scan_entry_ttl_ms);
+    ctx->scan_cache_valid      = true;
+    ctx->scan_cache_updated_ms = now_ms;
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+/*
+ * The scan looks for the connected SSID only. The scan config holds a
+ * single channel, so a short dwell rather than a channel list keeps the
+ * time spent off the serving channel low.
+ */
+static dom_models_error_t start_roam_scan(
+    dom_usecases_wifiman_t*            self,
+    app_wifiman_impl_ctx_t*            ctx,
+    const dom_models_wifi_ap_record_t* ap,
+    const char*                        tag
+) {
+    app_wifiman_impl_link_monitor_t* link = &ctx->link;
+    if (ap->ssid[0] == '\0') {
+        return DOMAIN_MODELS_ERROR_OK;
+    }
+
+    memset(&link->roam_scan, 0, sizeof(dom_models_wifi_scan_config_t));
+    link->roam_scan.ssid_set = true;
+    app_wifiman_impl_copy_cstr(link->roam_scan.ssid, sizeof(link->roam_scan.ssid), ap->ssid);
+    link->roam_scan.timeout_ms = APP_WIFIMAN_IMPL_ROAM_SCAN_DWELL_MS;
+
+    dom_models_error_t err = start_scan_locked(self, &link->roam_scan);
+    if (err == DOMAIN_MODELS_ERROR_BAD_STATE) {
+        /* Another scan is running, the next sample tries again */
+        return DOMAIN_MODELS_ERROR_OK;
+    }
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        link->cooldown = ctx->cfg.roam_cooldown_samples;
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to start roam scan: %s (%d)", dom_models_error_str(err), (int)err);
+        return err;
+    }
+
+    link->roam_state = APP_WIFIMAN_IMPL_ROAM_STATE_SCANNING;
+    link->stats.roam_scan_cnt++;
+
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "Roam scan started at %d dBm", (int)link->stats.rssi_avg);
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+static dom_models_error_t check_roam_scan(
+    app_wifiman_impl_ctx_t*            ctx,
+    const dom_models_wifi_ap_record_t* ap,
+    const char*                        tag
+) {
+    app_wifiman_impl_link_monitor_t* link = &ctx->link;
+
+    dom_models_error_t err = refresh_scan_cache(ctx, tag);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+    if (ctx->scan_status.status == DOM_MODELS_WIFI_SCAN_STATUS_RUNNING) {
+        return DOMAIN_MODELS_ERROR_OK;
+    }
+
+    link->roam_state = APP_WIFIMAN_IMPL_ROAM_STATE_IDLE;
+    if (!link->stats.weak) {
+        DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "Roam dropped because the link recovered");
+        return DOMAIN_MODELS_ERROR_OK;
+    }
+
+    link->cooldown = ctx->cfg.roam_cooldown_samples;
+
+    /* Another scan may have replaced the cache since, its records are not a roam scan's */
+    if (ctx->scan_status.status != DOM_MODELS_WIFI_SCAN_STATUS_DONE ||
+        !ctx->scan_cache_valid ||
+        !app_wifiman_impl_scan_filters_equal(&ctx->scan_config, &link->roam_scan)) {
+        DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "Roam dropped because the roam scan result is unavailable");
+        return DOMAIN_MODELS_ERROR_OK;
+    }
+
+    dom_models_wifi_ap_record_t target;
+    if (!app_wifiman_impl_find_roam_candidate(&ctx->scan_cache, ap, link->stats.rssi_avg + ctx->cfg.roam_rssi_gain, &target)) {
+        DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "Roam dropped because no stronger BSSID was found");
+        return DOMAIN_MODELS_ERROR_OK;
+    }
+
+    return roam(ctx, ap, &target, tag);
+}
+
+/*
+ * The driver only joins another BSSID from a disconnected STA. Fast connect
+ * is left off for the roam itself, the disconnect event it causes would
+ * otherwise count as a failed fast connect.
+ */
+static dom_models_error_t roam(
+    app_wifiman_impl_ctx_t*            ctx,
+    const dom_models_wifi_ap_record_t* ap,
+    const dom_models_wifi_ap_record_t* target,
+    const char*                        tag
+) {
+    app_wifiman_impl_link_monitor_t* link = &ctx->link;
+
+    dom_models_error_t err = app_wifiman_impl_load_profiles(ctx);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to load STA profiles for roam: %s (%d)", dom_models_error_str(err), (int)err);
+        return err;
+    }
+
+    size_t slot = 0;
+    if (!app_wifiman_impl_find_profile(&ctx->profiles, ap->ssid, &slot)) {
+        err = DOMAIN_MODELS_ERROR_NOT_FOUND;
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "No STA profile for the roamed network: %s (%d)", dom_models_error_str(err), (int)err);
+        return err;
+    }
+
+    dom_models_wifi_sta_last_ap_t        hop;
+    dom_models_wifi_sta_connect_config_t config;
+    app_wifiman_impl_credential_to_connect_config(&config, &ctx->profiles.profiles[slot].credential);
+    if (!app_wifiman_impl_last_ap_from_record(&hop, target) || !app_wifiman_impl_apply_last_ap(&config, &hop)) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    memcpy(&link->roam_target, target, sizeof(dom_models_wifi_ap_record_t));
+    memcpy(link->roam_from_bssid, ap->bssid, DOM_MODELS_WIFI_MAC_LEN);
+    link->roam_from_rssi = link->stats.rssi_avg;
+    link->stats.roam_attempt_cnt++;
+
+    ctx->sta_connect_source             = APP_WIFIMAN_IMPL_STA_CONNECT_SOURCE_RECONNECT;
+    ctx->sta_connection_commit_required = false;
+    ctx->sta_connect_fast               = false;
+    ctx->sta_fast_connect_failed        = false;
+
+    err = ctx->cfg.wifi->disconnect_sta(ctx->cfg.wifi);
+    if (err == DOMAIN_MODELS_ERROR_OK) {
+        link->roam_state = APP_WIFIMAN_IMPL_ROAM_STATE_ROAMING;
+        err              = ctx->cfg.wifi->connect_sta(ctx->cfg.wifi, &config);
+    }
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        /* The reconnect path still takes the roam target while the roam is in flight */
+        ctx->sta_connect_source = APP_WIFIMAN_IMPL_STA_CONNECT_SOURCE_NONE;
+        if (link->roam_state != APP_WIFIMAN_IMPL_ROAM_STATE_ROAMING) {
+            end_roam(ctx, false, tag);
+        }
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->cfg.logger, tag, "Failed to roam: %s (%d)", dom_models_error_str(err), (int)err);
+        return err;
+    }
+
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, "Roaming from %d dBm to a BSSID at %d dBm on channel %u", (int)link->roam_from_rssi, (int)target->rssi, (unsigned int)target->primary_channel);
 
     return DOMAIN_MODELS_ERROR_OK;
 }
 
+static void end_roam(
+    app_wifiman_impl_ctx_t* ctx,
+    bool                    succeeded,
+    const char*             tag
+) {
+    app_wifiman_impl_link_monitor_t*   link  = &ctx->link;
+    dom_usecases_wifiman_roam_event_t* event = &link->stats.last_roam;
+
+    memset(event, 0, sizeof(dom_usecases_wifiman_roam_event_t));
+    event->available = true;
+    event->succeeded = succeeded;
+    memcpy(event->from_bssid, link->roam_from_bssid, DOM_MODELS_WIFI_MAC_LEN);
+    memcpy(event->to_bssid, link->roam_target.bssid, DOM_MODELS_WIFI_MAC_LEN);
+    event->channel   = link->roam_target.primary_channel;
+    event->from_rssi = link->roam_from_rssi;
+    event->to_rssi   = link->roam_target.rssi;
+    if (!get_now(ctx, &event->at_ms)) {
+        event->at_ms = 0;
+    }
+
+    if (succeeded) {
+        link->stats.roam_success_cnt++;
+    } else {
+        link->stats.roam_failure_cnt++;
+    }
+    link->roam_state = APP_WIFIMAN_IMPL_ROAM_STATE_IDLE;
+    link->cooldown   = ctx->cfg.roam_cooldown_samples;
+
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->cfg.logger, tag, succeeded ? "Roam succeeded" : "Roam failed");
+}
+
 static dom_models_error_t get_ctx(
     dom_usecases_wifiman_t* self,
     app_wifiman_impl_ctx_t** out
@@ -1131,3 +2480,15 @@ static dom_models_error_t get_ctx(
 
     return DOMAIN_MODELS_ERROR_OK;
 }
+
+static void lock(
+    app_wifiman_impl_ctx_t* ctx
+) {
+    (void)xSemaphoreTakeRecursive(ctx->lock, portMAX_DELAY);
+}
+
+static void unlock(
+    app_wifiman_impl_ctx_t* ctx
+) {
+    (void)xSemaphoreGiveRecursive(ctx->lock);
+}
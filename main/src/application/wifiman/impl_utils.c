@@ -1,11 +1,14 @@
 #include "application/wifiman/impl_utils.h"
 
 #include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "application/wifiman/impl_types.h"
 #include "domain/models/error.h"
 #include "domain/models/wifi.h"
+#include "domain/usecases/wifiman.h"
 
 /* Helper Function Prototypes */
 
@@ -13,6 +16,19 @@ static bool has_wifi_functions(dom_contracts_device_wifi_t* wifi, bool event_cal
 static bool has_wifi_repository_functions(dom_contracts_repository_wifi_t* repository);
 static bool has_preloaded_repository_functions(dom_contracts_repository_preloaded_t* repository);
 static bool has_network_interface_functions(dom_contracts_network_interface_t* network_interface);
+static bool has_clock_functions(dom_contracts_system_clock_t* clock);
+static bool ap_records_match(const dom_models_wifi_ap_record_t* a, const dom_models_wifi_ap_record_t* b, bool dedup_by_ssid);
+static size_t find_evictable(const app_wifiman_impl_scan_cache_t* cache, int8_t rssi);
+static void push_rssi(dom_usecases_wifiman_scan_entry_t* entry, int8_t rssi);
+static void sort_by_rssi(app_wifiman_impl_scan_cache_t* cache);
+static bool rank_before(
+    const dom_models_wifi_sta_profiles_t*  profiles,
+    const app_wifiman_impl_profile_rank_t* a,
+    const app_wifiman_impl_profile_rank_t* b
+);
+static size_t find_evictable_profile(const dom_models_wifi_sta_profiles_t* profiles);
+static int8_t q4_to_dbm(int32_t value);
+static dom_usecases_wifiman_link_bssid_t* touch_link_bssid(dom_usecases_wifiman_link_t* stats, const dom_models_wifi_ap_record_t* ap);
 
 dom_models_error_t app_wifiman_impl_validate_cfg(const app_wifiman_impl_cfg_t* cfg) {
     if (!cfg ||
@@ -22,7 +38,8 @@ dom_models_error_t app_wifiman_impl_validate_cfg(const app_wifiman_impl_cfg_t* c
         !has_wifi_functions(cfg->wifi, cfg->ap_auto_manage_enabled) ||
         !has_wifi_repository_functions(cfg->wifi_repository) ||
         !has_preloaded_repository_functions(cfg->preloaded_repository) ||
-        !has_network_interface_functions(cfg->network_interface)) {
+        !has_network_interface_functions(cfg->network_interface) ||
+        !has_clock_functions(cfg->clock)) {
         return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
@@ -91,6 +108,68 @@ void app_wifiman_impl_credential_to_connect_config(
     app_wifiman_impl_copy_cstr(out->password, sizeof(out->password), credential->password);
 }
 
+bool app_wifiman_impl_apply_last_ap(
+    dom_models_wifi_sta_connect_config_t* config,
+    const dom_models_wifi_sta_last_ap_t*  last_ap
+) {
+    if (!config || !last_ap || last_ap->channel == 0) {
+        return false;
+    }
+    if (strncmp(config->ssid, last_ap->ssid, sizeof(config->ssid)) != 0) {
+        return false;
+    }
+
+    config->bssid_set = true;
+    memcpy(config->bssid, last_ap->bssid, sizeof(config->bssid));
+    config->channel_set = true;
+    config->channel     = last_ap->channel;
+    if (last_ap->auth_mode != DOM_MODELS_WIFI_AUTH_UNKNOWN && last_ap->auth_mode != DOM_MODELS_WIFI_AUTH_OTHER) {
+        config->auth_mode_set = true;
+        config->auth_mode     = last_ap->auth_mode;
+    }
+
+    return true;
+}
+
+bool app_wifiman_impl_last_ap_from_status(
+    dom_models_wifi_sta_last_ap_t*  out,
+    const dom_models_wifi_status_t* status
+) {
+    if (!out || !status) {
+        return false;
+    }
+
+    memset(out, 0, sizeof(dom_models_wifi_sta_last_ap_t));
+
+    if (!status->connected || !status->connected_ap_available) {
+        return false;
+    }
+
+    return app_wifiman_impl_last_ap_from_record(out, &status->connected_ap);
+}
+
+bool app_wifiman_impl_last_ap_from_record(
+    dom_models_wifi_sta_last_ap_t*     out,
+    const dom_models_wifi_ap_record_t* record
+) {
+    if (!out || !record) {
+        return false;
+    }
+
+    memset(out, 0, sizeof(dom_models_wifi_sta_last_ap_t));
+
+    if (!record->bssid_available || record->primary_channel == 0 || record->ssid[0] == '\0') {
+        return false;
+    }
+
+    app_wifiman_impl_copy_cstr(out->ssid, sizeof(out->ssid), record->ssid);
+    memcpy(out->bssid, record->bssid, sizeof(out->bssid));
+    out->channel   = record->primary_channel;
+    out->auth_mode = record->auth_mode;
+
+    return true;
+}
+
 dom_models_error_t app_wifiman_impl_load_ap_config(
     app_wifiman_impl_ctx_t* ctx,
     dom_models_wifi_ap_config_t* out
@@ -131,15 +210,182 @@ dom_models_error_t app_wifiman_impl_load_ap_config(
     return DOMAIN_MODELS_ERROR_OK;
 }
 
+dom_models_error_t app_wifiman_impl_load_profiles(
+    app_wifiman_impl_ctx_t* ctx
+) {
+    if (!ctx) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+    if (ctx->profiles_loaded) {
+        return DOMAIN_MODELS_ERROR_OK;
+    }
+
+    dom_models_error_t err = ctx->cfg.wifi_repository->get_sta_profiles(ctx->cfg.wifi_repository, &ctx->profiles);
+    if (err == DOMAIN_MODELS_ERROR_NOT_FOUND) {
+        memset(&ctx->profiles, 0, sizeof(dom_models_wifi_sta_profiles_t));
+    } else if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
+    ctx->profiles_loaded = true;
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+size_t app_wifiman_impl_rank_profiles(
+    const dom_models_wifi_sta_profiles_t* profiles,
+    const app_wifiman_impl_scan_cache_t*  cache,
+    app_wifiman_impl_profile_rank_t       out[DOM_MODELS_WIFI_STA_PROFILE_MAX]
+) {
+    if (!profiles || !out) {
+        return 0;
+    }
+
+    size_t count = profiles->count < DOM_MODELS_WIFI_STA_PROFILE_MAX ? profiles->count : DOM_MODELS_WIFI_STA_PROFILE_MAX;
+
+    for (size_t i = 0; i < count; i++) {
+        app_wifiman_impl_profile_rank_t rank = {
+            .slot     = i,
+            .in_range = false,
+            .rssi     = 0,
+        };
+
+        /* The cache is sorted strongest first, the first match is the best BSSID */
+        const char* ssid = profiles->profiles[i].credential.ssid;
+        for (size_t j = 0; cache && j < cache->count; j++) {
+            if (strncmp(cache->entries[j].record.ssid, ssid, DOM_MODELS_WIFI_SSID_BUF_LEN) == 0) {
+                rank.in_range = true;
+                rank.rssi     = cache->entries[j].record.rssi;
+                break;
+            }
+        }
+
+        size_t k = i;
+        while (k > 0 && rank_before(profiles, &rank, &out[k - 1])) {
+            out[k] = out[k - 1];
+            k--;
+        }
+        out[k] = rank;
+    }
+
+    return count;
+}
+
+bool app_wifiman_impl_find_profile(
+    const dom_models_wifi_sta_profiles_t* profiles,
+    const char*                           ssid,
+    size_t*                               out_slot
+) {
+    if (!profiles || !ssid) {
+        return false;
+    }
+
+    for (size_t i = 0; i < profiles->count && i < DOM_MODELS_WIFI_STA_PROFILE_MAX; i++) {
+        if (strncmp(profiles->profiles[i].credential.ssid, ssid, DOM_MODELS_WIFI_SSID_BUF_LEN) == 0) {
+            if (out_slot) {
+                *out_slot = i;
+            }
+            return true;
+        }
+    }
+
+    return false;
+}
+
+dom_models_error_t app_wifiman_impl_upsert_profile(
+    dom_models_wifi_sta_profiles_t*         profiles,
+    const dom_models_wifi_sta_credential_t* credential,
+    uint8_t                                 priority,
+    bool                                    evict,
+    size_t*                                 out_slot
+) {
+    if (!profiles || profiles->count > DOM_MODELS_WIFI_STA_PROFILE_MAX) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    dom_models_error_t err = app_wifiman_impl_validate_credential(credential);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
+    size_t slot = 0;
+    if (!app_wifiman_impl_find_profile(profiles, credential->ssid, &slot)) {
+        if (profiles->count < DOM_MODELS_WIFI_STA_PROFILE_MAX) {
+            slot = profiles->count++;
+        } else if (evict) {
+            slot = find_evictable_profile(profiles);
+        } else {
+            return DOMAIN_MODELS_ERROR_BAD_STATE;
+        }
+
+        memset(&profiles->profiles[slot], 0, sizeof(dom_models_wifi_sta_profile_t));
+    }
+
+    dom_models_wifi_sta_profile_t* profile = &profiles->profiles[slot];
+    memcpy(&profile->credential, credential, sizeof(dom_models_wifi_sta_credential_t));
+    profile->priority    = priority;
+    profile->failure_cnt = 0;
+
+    if (out_slot) {
+        *out_slot = slot;
+    }
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+void app_wifiman_impl_remove_profile(
+    dom_models_wifi_sta_profiles_t* profiles,
+    size_t                          slot
+) {
+    if (!profiles || slot >= profiles->count || profiles->count > DOM_MODELS_WIFI_STA_PROFILE_MAX) {
+        return;
+    }
+
+    memmove(
+        &profiles->profiles[slot],
+        &profiles->profiles[slot + 1],
+        (profiles->count - slot - 1) * sizeof(dom_models_wifi_sta_profile_t)
+    );
+    profiles->count--;
+    memset(&profiles->profiles[profiles->count], 0, sizeof(dom_models_wifi_sta_profile_t));
+}
+
 dom_models_error_t app_wifiman_impl_load_stored_credential(
     app_wifiman_impl_ctx_t* ctx,
-    dom_models_wifi_sta_credential_t* out
+    dom_models_wifi_sta_credential_t* out,
+    size_t*                           out_slot
 ) {
     if (!ctx || !out) {
         return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
-    return ctx->cfg.wifi_repository->get_sta_credential(ctx->cfg.wifi_repository, out);
+    memset(out, 0, sizeof(dom_models_wifi_sta_credential_t));
+
+    dom_models_error_t err = app_wifiman_impl_load_profiles(ctx);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
+    app_wifiman_impl_profile_rank_t ranks[DOM_MODELS_WIFI_STA_PROFILE_MAX];
+    size_t                          count = app_wifiman_impl_rank_profiles(&ctx->profiles, ctx->scan_cache_valid ? &ctx->scan_cache : NULL, ranks);
+    if (count == 0) {
+        return DOMAIN_MODELS_ERROR_NOT_FOUND;
+    }
+
+    size_t pick = 0;
+    while (pick < count && (ctx->sta_profile_tried & (1u << ranks[pick].slot)) != 0) {
+        pick++;
+    }
+    if (pick == count) {
+        pick = 0;
+    }
+
+    memcpy(out, &ctx->profiles.profiles[ranks[pick].slot].credential, sizeof(dom_models_wifi_sta_credential_t));
+    if (out_slot) {
+        *out_slot = ranks[pick].slot;
+    }
+
+    return DOMAIN_MODELS_ERROR_OK;
 }
 
 dom_models_error_t app_wifiman_impl_load_stored_sta(
@@ -153,7 +399,7 @@ dom_models_error_t app_wifiman_impl_load_stored_sta(
     memset(out, 0, sizeof(dom_usecases_wifiman_stored_sta_t));
 
     dom_models_wifi_sta_credential_t credential;
-    dom_models_error_t               err = app_wifiman_impl_load_stored_credential(ctx, &credential);
+    dom_models_error_t               err = app_wifiman_impl_load_stored_credential(ctx, &credential, NULL);
     if (err == DOMAIN_MODELS_ERROR_NOT_FOUND) {
         return DOMAIN_MODELS_ERROR_OK;
     }
@@ -167,6 +413,262 @@ dom_models_error_t app_wifiman_impl_load_stored_sta(
     return DOMAIN_MODELS_ERROR_OK;
 }
 
+bool app_wifiman_impl_scan_filters_equal(
+    const dom_models_wifi_scan_config_t* a,
+    const dom_models_wifi_scan_config_t* b
+) {
+    dom_models_wifi_scan_config_t none;
+    memset(&none, 0, sizeof(dom_models_wifi_scan_config_t));
+
+    a = a ? a : &none;
+    b = b ? b : &none;
+
+    if (a->ssid_set != b->ssid_set || a->bssid_set != b->bssid_set || a->channel_set != b->channel_set) {
+        return false;
+    }
+    if (a->ssid_set && strncmp(a->ssid, b->ssid, sizeof(a->ssid)) != 0) {
+        return false;
+    }
+    if (a->bssid_set && memcmp(a->bssid, b->bssid, sizeof(a->bssid)) != 0) {
+        return false;
+    }
+
+    return !a->channel_set || a->channel == b->channel;
+}
+
+dom_models_error_t app_wifiman_impl_scan_cache_init(
+    app_wifiman_impl_scan_cache_t* cache,
+    size_t                         capacity
+) {
+    if (!cache || capacity == 0) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    memset(cache, 0, sizeof(app_wifiman_impl_scan_cache_t));
+
+    cache->entries = (dom_usecases_wifiman_scan_entry_t*)calloc(capacity, sizeof(dom_usecases_wifiman_scan_entry_t));
+    cache->seen    = (bool*)calloc(capacity, sizeof(bool));
+    if (!cache->entries || !cache->seen) {
+        app_wifiman_impl_scan_cache_deinit(cache);
+        return DOMAIN_MODELS_ERROR_MALLOC_FAILED;
+    }
+
+    cache->capacity = capacity;
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+void app_wifiman_impl_scan_cache_deinit(
+    app_wifiman_impl_scan_cache_t* cache
+) {
+    if (!cache) {
+        return;
+    }
+
+    free(cache->entries);
+    free(cache->seen);
+    memset(cache, 0, sizeof(app_wifiman_impl_scan_cache_t));
+}
+
+void app_wifiman_impl_scan_cache_clear(
+    app_wifiman_impl_scan_cache_t* cache
+) {
+    if (!cache) {
+        return;
+    }
+
+    cache->count     = 0;
+    cache->truncated = false;
+}
+
+void app_wifiman_impl_scan_cache_begin(
+    app_wifiman_impl_scan_cache_t* cache
+) {
+    if (!cache) {
+        return;
+    }
+
+    memset(cache->seen, 0, cache->capacity * sizeof(bool));
+    cache->truncated = false;
+}
+
+void app_wifiman_impl_scan_cache_merge(
+    app_wifiman_impl_scan_cache_t*     cache,
+    const dom_models_wifi_ap_record_t* record,
+    int64_t                            seen_ms,
+    bool                               dedup_by_ssid
+) {
+    if (!cache || !record) {
+        return;
+    }
+
+    size_t slot = cache->count;
+    for (size_t i = 0; i < cache->count; i++) {
+        if (ap_records_match(&cache->entries[i].record, record, dedup_by_ssid)) {
+            slot = i;
+            break;
+        }
+    }
+
+    /* Another BSSID of a network this scan already matched */
+    if (slot < cache->count && cache->seen[slot]) {
+        dom_usecases_wifiman_scan_entry_t* entry = &cache->entries[slot];
+        if (record->rssi > entry->record.rssi) {
+            memcpy(&entry->record, record, sizeof(dom_models_wifi_ap_record_t));
+            entry->rssi_history[0] = record->rssi;
+        }
+        return;
+    }
+
+    if (slot == cache->count) {
+        if (cache->count < cache->capacity) {
+            cache->count++;
+        } else {
+            slot = find_evictable(cache, record->rssi);
+            if (slot == cache->count || cache->seen[slot]) {
+                cache->truncated = true;
+            }
+            if (slot == cache->count) {
+                return;
+            }
+        }
+
+        memset(&cache->entries[slot], 0, sizeof(dom_usecases_wifiman_scan_entry_t));
+        cache->entries[slot].first_seen_ms = seen_ms;
+    }
+
+    dom_usecases_wifiman_scan_entry_t* entry = &cache->entries[slot];
+    memcpy(&entry->record, record, sizeof(dom_models_wifi_ap_record_t));
+    entry->last_seen_ms = seen_ms;
+    entry->seen_cnt++;
+    push_rssi(entry, record->rssi);
+    cache->seen[slot] = true;
+}
+
+void app_wifiman_impl_scan_cache_end(
+    app_wifiman_impl_scan_cache_t* cache,
+    bool                           now_available,
+    int64_t                        now_ms,
+    uint32_t                       entry_ttl_ms
+) {
+    if (!cache) {
+        return;
+    }
+
+    size_t kept = 0;
+    for (size_t i = 0; i < cache->count; i++) {
+        bool keep = cache->seen[i] || (now_available && now_ms - cache->entries[i].last_seen_ms <= (int64_t)entry_ttl_ms);
+        if (!keep) {
+            continue;
+        }
+        if (kept != i) {
+            memcpy(&cache->entries[kept], &cache->entries[i], sizeof(dom_usecases_wifiman_scan_entry_t));
+            cache->seen[kept] = cache->seen[i];
+        }
+        kept++;
+    }
+
+    cache->count = kept;
+    sort_by_rssi(cache);
+}
+
+void app_wifiman_impl_scan_cache_abort(
+    app_wifiman_impl_scan_cache_t* cache
+) {
+    if (!cache) {
+        return;
+    }
+
+    sort_by_rssi(cache);
+}
+
+void app_wifiman_impl_link_sample(
+    app_wifiman_impl_link_monitor_t*   link,
+    const app_wifiman_impl_cfg_t*      cfg,
+    const dom_models_wifi_ap_record_t* ap
+) {
+    if (!link || !cfg) {
+        return;
+    }
+
+    dom_usecases_wifiman_link_t* stats = &link->stats;
+    if (!ap) {
+        stats->tracking = false;
+        stats->weak     = false;
+        link->weak_run  = 0;
+        return;
+    }
+
+    int32_t sample_q4 = (int32_t)ap->rssi * 16;
+    bool    same_link = stats->tracking && stats->bssid_count > 0 &&
+                     memcmp(stats->bssids[0].bssid, ap->bssid, DOM_MODELS_WIFI_MAC_LEN) == 0;
+    if (same_link) {
+        link->rssi_avg_q4 += (sample_q4 - link->rssi_avg_q4) / (1 << cfg->roam_ewma_shift);
+    } else {
+        /* A new AP starts from its own first sample, not the average of the one left */
+        link->rssi_avg_q4 = sample_q4;
+        stats->weak       = false;
+        link->weak_run    = 0;
+    }
+
+    stats->tracking = true;
+    stats->rssi_avg = q4_to_dbm(link->rssi_avg_q4);
+    stats->sample_cnt++;
+
+    if (stats->weak && link->rssi_avg_q4 >= (int32_t)cfg->roam_rssi_high * 16) {
+        stats->weak = false;
+    } else if (!stats->weak && link->rssi_avg_q4 < (int32_t)cfg->roam_rssi_low * 16) {
+        stats->weak = true;
+    }
+    link->weak_run = stats->weak ? link->weak_run + 1 : 0;
+
+    dom_usecases_wifiman_link_bssid_t* entry = touch_link_bssid(stats, ap);
+    entry->channel   = ap->primary_channel;
+    entry->rssi_last = ap->rssi;
+    entry->rssi_avg  = stats->rssi_avg;
+    entry->sample_cnt++;
+    if (stats->weak) {
+        entry->weak_cnt++;
+    }
+    if (ap->rssi < entry->rssi_min) {
+        entry->rssi_min = ap->rssi;
+    }
+    if (ap->rssi > entry->rssi_max) {
+        entry->rssi_max = ap->rssi;
+    }
+}
+
+bool app_wifiman_impl_find_roam_candidate(
+    const app_wifiman_impl_scan_cache_t* cache,
+    const dom_models_wifi_ap_record_t*   current,
+    int                                  min_rssi,
+    dom_models_wifi_ap_record_t*         out
+) {
+    if (!cache || !current || !out) {
+        return false;
+    }
+
+    /* The cache is sorted strongest first, so the first match is the best one */
+    for (size_t i = 0; i < cache->count; i++) {
+        const dom_models_wifi_ap_record_t* record = &cache->entries[i].record;
+        if (!cache->seen[i] || !record->bssid_available || record->primary_channel == 0) {
+            continue;
+        }
+        if (strncmp(record->ssid, current->ssid, sizeof(record->ssid)) != 0 ||
+            memcmp(record->bssid, current->bssid, sizeof(record->bssid)) == 0) {
+            continue;
+        }
+        if (record->rssi < min_rssi) {
+            return false;
+        }
+
+        memcpy(out, record, sizeof(dom_models_wifi_ap_record_t));
+        return true;
+    }
+
+    return false;
+}
+
 /* Helper Function Implementations */
 
 static bool has_wifi_functions(dom_contracts_device_wifi_t* wifi, bool event_callback_required) {
@@ -193,9 +695,11 @@ static bool has_wifi_functions(dom_contracts_device_wifi_t* wifi, bool event_cal
 
 static bool has_wifi_repository_functions(dom_contracts_repository_wifi_t* repository) {
     return repository &&
-           repository->get_sta_credential &&
-           repository->set_sta_credential &&
-           repository->clear_sta_credential;
+           repository->get_sta_profiles &&
+           repository->set_sta_profiles &&
+           repository->clear_sta_credential &&
+           repository->get_sta_last_ap &&
+           repository->set_sta_last_ap;
 }
 
 static bool has_preloaded_repository_functions(dom_contracts_repository_preloaded_t* repository) {
@@ -207,3 +711,146 @@ static bool has_preloaded_repository_functions(dom_contracts_repository_preloade
 static bool has_network_interface_functions(dom_contracts_network_interface_t* network_interface) {
     return network_interface && network_interface->get_wifi_sta;
 }
+
+static bool has_clock_functions(dom_contracts_system_clock_t* clock) {
+    return !clock || clock->get_uptime_ms;
+}
+
+static bool ap_records_match(const dom_models_wifi_ap_record_t* a, const dom_models_wifi_ap_record_t* b, bool dedup_by_ssid) {
+    if (dedup_by_ssid && a->ssid[0] != '\0' && b->ssid[0] != '\0') {
+        return strncmp(a->ssid, b->ssid, sizeof(a->ssid)) == 0;
+    }
+    if (a->bssid_available && b->bssid_available) {
+        return memcmp(a->bssid, b->bssid, sizeof(a->bssid)) == 0;
+    }
+
+    return a->bssid_available == b->bssid_available &&
+           a->primary_channel == b->primary_channel &&
+           strncmp(a->ssid, b->ssid, sizeof(a->ssid)) == 0;
+}
+
+/* The stalest entry this scan missed, else the weakest one weaker than rssi */
+static size_t find_evictable(const app_wifiman_impl_scan_cache_t* cache, int8_t rssi) {
+    size_t stalest = cache->count;
+    size_t weakest = cache->count;
+
+    for (size_t i = 0; i < cache->count; i++) {
+        const dom_usecases_wifiman_scan_entry_t* entry = &cache->entries[i];
+        if (!cache->seen[i]) {
+            if (stalest == cache->count || entry->last_seen_ms < cache->entries[stalest].last_seen_ms) {
+                stalest = i;
+            }
+        } else if (entry->record.rssi < rssi && (weakest == cache->count || entry->record.rssi < cache->entries[weakest].record.rssi)) {
+            weakest = i;
+        }
+    }
+
+    return stalest != cache->count ? stalest : weakest;
+}
+
+static void push_rssi(dom_usecases_wifiman_scan_entry_t* entry, int8_t rssi) {
+    memmove(&entry->rssi_history[1], &entry->rssi_history[0], sizeof(entry->rssi_history) - sizeof(entry->rssi_history[0]));
+    entry->rssi_history[0] = rssi;
+    if (entry->rssi_history_len < DOM_USECASES_WIFIMAN_SCAN_RSSI_HISTORY_LEN) {
+        entry->rssi_history_len++;
+    }
+}
+
+/* Insertion sort, the cache is small and mostly sorted from the last scan */
+static void sort_by_rssi(app_wifiman_impl_scan_cache_t* cache) {
+    dom_usecases_wifiman_scan_entry_t entry;
+
+    for (size_t i = 1; i < cache->count; i++) {
+        if (cache->entries[i - 1].record.rssi >= cache->entries[i].record.rssi) {
+            continue;
+        }
+
+        memcpy(&entry, &cache->entries[i], sizeof(dom_usecases_wifiman_scan_entry_t));
+
+        size_t j = i;
+        while (j > 0 && cache->entries[j - 1].record.rssi < entry.record.rssi) {
+            memcpy(&cache->entries[j], &cache->entries[j - 1], sizeof(dom_usecases_wifiman_scan_entry_t));
+            j--;
+        }
+        memcpy(&cache->entries[j], &entry, sizeof(dom_usecases_wifiman_scan_entry_t));
+    }
+}
+
+static bool rank_before(
+    const dom_models_wifi_sta_profiles_t*  profiles,
+    const app_wifiman_impl_profile_rank_t* a,
+    const app_wifiman_impl_profile_rank_t* b
+) {
+    const dom_models_wifi_sta_profile_t* pa = &profiles->profiles[a->slot];
+    const dom_models_wifi_sta_profile_t* pb = &profiles->profiles[b->slot];
+
+    if (a->in_range != b->in_range) {
+        return a->in_range;
+    }
+    if (pa->priority != pb->priority) {
+        return pa->priority > pb->priority;
+    }
+    if (a->in_range && a->rssi != b->rssi) {
+        return a->rssi > b->rssi;
+    }
+    if (pa->last_success_seq != pb->last_success_seq) {
+        return pa->last_success_seq > pb->last_success_seq;
+    }
+    if (pa->failure_cnt != pb->failure_cnt) {
+        return pa->failure_cnt < pb->failure_cnt;
+    }
+
+    return a->slot < b->slot;
+}
+
+/* The lowest priority profile, the least recently joined among equals */
+static size_t find_evictable_profile(const dom_models_wifi_sta_profiles_t* profiles) {
+    size_t victim = 0;
+
+    for (size_t i = 1; i < profiles->count; i++) {
+        const dom_models_wifi_sta_profile_t* profile = &profiles->profiles[i];
+        const dom_models_wifi_sta_profile_t* current = &profiles->profiles[victim];
+        if (profile->priority < current->priority ||
+            (profile->priority == current->priority && profile->last_success_seq < current->last_success_seq)) {
+            victim = i;
+        }
+    }
+
+    return victim;
+}
+
+static int8_t q4_to_dbm(int32_t value) {
+    /* Rounds half away from zero */
+    int32_t dbm = (value >= 0 ? value + 8 : value - 8) / 16;
+
+    return (int8_t)(dbm < INT8_MIN ? INT8_MIN : dbm > INT8_MAX ? INT8_MAX : dbm);
+}
+
+/* Moves the AP's entry to the front, a new one evicts the least recently sampled */
+static dom_usecases_wifiman_link_bssid_t* touch_link_bssid(dom_usecases_wifiman_link_t* stats, const dom_models_wifi_ap_record_t* ap) {
+    dom_usecases_wifiman_link_bssid_t entry;
+
+    size_t slot = 0;
+    while (slot < stats->bssid_count && memcmp(stats->bssids[slot].bssid, ap->bssid, DOM_MODELS_WIFI_MAC_LEN) != 0) {
+        slot++;
+    }
+
+    if (slot < stats->bssid_count) {
+        memcpy(&entry, &stats->bssids[slot], sizeof(dom_usecases_wifiman_link_bssid_t));
+    } else {
+        if (stats->bssid_count < DOM_USECASES_WIFIMAN_LINK_BSSID_MAX) {
+            stats->bssid_count++;
+        }
+        slot = stats->bssid_count - 1;
+
+        memset(&entry, 0, sizeof(dom_usecases_wifiman_link_bssid_t));
+        memcpy(entry.bssid, ap->bssid, DOM_MODELS_WIFI_MAC_LEN);
+        entry.rssi_min = ap->rssi;
+        entry.rssi_max = ap->rssi;
+    }
+
+    memmove(&stats->bssids[1], &stats->bssids[0], slot * sizeof(dom_usecases_wifiman_link_bssid_t));
+    memcpy(&stats->bssids[0], &entry, sizeof(dom_usecases_wifiman_link_bssid_t));
+
+    return &stats->bssids[0];
+}
@@ -29,7 +29,7 @@ dom_models_error_t cmp_main_application_init(cmp_main_launcher_t* launcher) {
 
 #ifdef COMPOSITION_MAIN_CONFIG_APPLICATION_SETTINGS_ENABLE
 
-#if !defined(COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_STDIO_ENABLE) || \
+#if !defined(COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_ENABLE) ||       \
     !defined(COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_REPOSITORY_PRELOADED_ENABLE) || \
     !defined(COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_SYSTEM_INFO_ENABLE) ||          \
     !defined(COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_SYSTEM_RESTART_ENABLE)
@@ -67,7 +67,7 @@ dom_models_error_t cmp_main_application_init(cmp_main_launcher_t* launcher) {
 
 #ifdef COMPOSITION_MAIN_CONFIG_APPLICATION_NETIF_ENABLE
 
-#if !defined(COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_STDIO_ENABLE) || \
+#if !defined(COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_ENABLE) || \
     !defined(COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_NETWORK_INTERFACE_ENABLE)
     ESP_LOGE(tag, "Netif dependencies are disabled");
     cmp_main_application_deinit(launcher);
@@ -101,7 +101,7 @@ dom_models_error_t cmp_main_application_init(cmp_main_launcher_t* launcher) {
 
 #ifdef COMPOSITION_MAIN_CONFIG_APPLICATION_WIFIMAN_ENABLE
 
-#if !defined(COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_STDIO_ENABLE) || \
+#if !defined(COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_ENABLE) ||       \
     !defined(COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_DEVICE_WIFI_ENABLE) ||          \
     !defined(COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_NETWORK_INTERFACE_ENABLE) ||    \
     !defined(COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_REPOSITORY_PRELOADED_ENABLE) || \
@@ -128,7 +128,19 @@ dom_models_error_t cmp_main_application_init(cmp_main_launcher_t* launcher) {
         .network_interface      = launcher->infrastructure.network_interface,
         .reconnect_max_trials   = cmp_main_config.application.wifiman_reconnect_max_trials,
         .ap_auto_manage_enabled = cmp_main_config.application.wifiman_ap_auto_manage_enabled,
+        .scan_entry_ttl_ms      = cmp_main_config.application.wifiman_scan_entry_ttl_ms,
+        .scan_entry_max         = cmp_main_config.application.wifiman_scan_entry_max,
+        .scan_dedup_by_ssid     = cmp_main_config.application.wifiman_scan_dedup_by_ssid,
+        .roam_rssi_low          = cmp_main_config.application.wifiman_roam_rssi_low,
+        .roam_rssi_high         = cmp_main_config.application.wifiman_roam_rssi_high,
+        .roam_rssi_gain         = cmp_main_config.application.wifiman_roam_rssi_gain,
+        .roam_ewma_shift        = cmp_main_config.application.wifiman_roam_ewma_shift,
+        .roam_weak_samples      = cmp_main_config.application.wifiman_roam_weak_samples,
+        .roam_cooldown_samples  = cmp_main_config.application.wifiman_roam_cooldown_samples,
     };
+#ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_SYSTEM_CLOCK_ENABLE
+    wifiman_cfg.clock = launcher->infrastructure.system_clock;
+#endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_SYSTEM_CLOCK_ENABLE */
     launcher->application.wifiman = app_wifiman_impl_new(&wifiman_cfg);
     if (!launcher->application.wifiman) {
         ESP_LOGE(tag, "Failed to create WiFiMan");
@@ -153,8 +165,8 @@ dom_models_error_t cmp_main_application_init(cmp_main_launcher_t* launcher) {
 
 #ifdef COMPOSITION_MAIN_CONFIG_APPLICATION_OTA_ENABLE
 
-#if !defined(COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_STDIO_ENABLE) || \
-    !defined(COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_SYSTEM_UPDATE_ENABLE) || \
+#if !defined(COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_ENABLE) || \
+    !defined(COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_SYSTEM_UPDATE_ENABLE) ||  \
     !defined(COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_SYSTEM_RESTART_ENABLE)
     ESP_LOGE(tag, "OTA dependencies are disabled");
     cmp_main_application_deinit(launcher);
@@ -1,11 +1,21 @@
 #include "composition/main/config.h"
 
-#include "application/wifiman/impl_types.h"                     // IWYU pragma: keep
-#include "hal/gpio_types.h"                                     // IWYU pragma: keep
-#include "hal/spi_types.h"                                      // IWYU pragma: keep
-#include "infrastructure/system/update/esp_https_impl_types.h"  // IWYU pragma: keep
-#include "presentation/task/wifiman_sta_reconnect/types.h"      // IWYU pragma: keep
-#include "soc/gpio_num.h"                                       // IWYU pragma: keep
+#include "application/wifiman/impl_types.h"                      // IWYU pragma: keep
+#include "domain/models/wifi.h"                                  // IWYU pragma: keep
+#include "hal/gpio_types.h"                                      // IWYU pragma: keep
+#include "hal/spi_types.h"                                       // IWYU pragma: keep
+#include "infrastructure/logger/leveled/ring_impl_types.h"       // IWYU pragma: keep
+#include "infrastructure/messaging/publish/outbox_impl_types.h"  // IWYU pragma: keep
+#include "infrastructure/system/update/esp_https_impl_types.h"   // IWYU pragma: keep
+#include "presentation/http/admission.h"                         // IWYU pragma: keep
+#include "presentation/http/etag.h"                              // IWYU pragma: keep
+#include "presentation/http/handler/assets_types.h"              // IWYU pragma: keep
+#include "presentation/task/event_stream/types.h"                // IWYU pragma: keep
+#include "presentation/task/log_shipping/types.h"                // IWYU pragma: keep
+#include "presentation/task/status_publish/types.h"              // IWYU pragma: keep
+#include "presentation/task/wifiman_link_monitor/types.h"        // IWYU pragma: keep
+#include "presentation/task/wifiman_sta_reconnect/types.h"       // IWYU pragma: keep
+#include "soc/gpio_num.h"                                        // IWYU pragma: keep
 
 #ifndef PROJECT_NAME
 #define PROJECT_NAME "haya"
@@ -141,10 +151,22 @@ const cmp_main_config_t cmp_main_config = {
 #endif /* COMPOSITION_MAIN_CONFIG_DRIVER_SNTP_ENABLE */
     },
     .infrastructure = {
-#ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_STDIO_ENABLE
+#ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_ENABLE
+#ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_USE_STDIO
         .logger_leveled_stdio_level              = DOMAIN_MODELS_LOGGER_LEVEL_INFO,
-        .logger_leveled_stdio_callback_max_count = 0,
-#endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_STDIO_ENABLE */
+        .logger_leveled_stdio_callback_max_count = 1,
+#endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_USE_STDIO */
+#ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_USE_RING
+        .logger_leveled_ring_level               = DOMAIN_MODELS_LOGGER_LEVEL_INFO,
+        .logger_leveled_ring_callback_max_count  = 1,
+        .logger_leveled_ring_slot_count          = INF_LOGGER_LEVELED_RING_IMPL_DEFAULT_SLOT_CNT,
+        .logger_leveled_ring_msg_max_len         = INF_LOGGER_LEVELED_RING_IMPL_DEFAULT_MSG_MAX_LEN,
+        .logger_leveled_ring_task_name           = INF_LOGGER_LEVELED_RING_IMPL_DEFAULT_TASK_NAME,
+        .logger_leveled_ring_task_stack_size     = INF_LOGGER_LEVELED_RING_IMPL_DEFAULT_TASK_STACK_SIZE,
+        .logger_leveled_ring_task_priority       = INF_LOGGER_LEVELED_RING_IMPL_DEFAULT_TASK_PRIORITY,
+        .logger_leveled_ring_deferred_format     = true,
+#endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_USE_RING */
+#endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_ENABLE */
 
 #ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_MESSAGING_PUBLISH_ENABLE
 #ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_MESSAGING_PUBLISH_USE_ESP_MQTT
@@ -153,6 +175,17 @@ const cmp_main_config_t cmp_main_config = {
         .messaging_publish_esp_mqtt_status_retained       = true,
         .messaging_publish_esp_mqtt_log_retained          = false,
 #endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_MESSAGING_PUBLISH_USE_ESP_MQTT */
+#ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_MESSAGING_PUBLISH_USE_OUTBOX
+        .messaging_publish_outbox_dir_path           = "/littlefs/outbox",
+        .messaging_publish_outbox_segment_max_bytes  = INF_MESSAGING_PUBLISH_OUTBOX_IMPL_DEFAULT_SEGMENT_MAX_BYTES,
+        .messaging_publish_outbox_segment_max_count  = INF_MESSAGING_PUBLISH_OUTBOX_IMPL_DEFAULT_SEGMENT_MAX_CNT,
+        .messaging_publish_outbox_record_max_len     = INF_MESSAGING_PUBLISH_OUTBOX_IMPL_DEFAULT_RECORD_MAX_LEN,
+        .messaging_publish_outbox_replay_interval_ms = INF_MESSAGING_PUBLISH_OUTBOX_IMPL_DEFAULT_REPLAY_INTERVAL_MS,
+        .messaging_publish_outbox_replay_burst_count = INF_MESSAGING_PUBLISH_OUTBOX_IMPL_DEFAULT_REPLAY_BURST_CNT,
+        .messaging_publish_outbox_task_name          = INF_MESSAGING_PUBLISH_OUTBOX_IMPL_DEFAULT_TASK_NAME,
+        .messaging_publish_outbox_task_stack_size    = INF_MESSAGING_PUBLISH_OUTBOX_IMPL_DEFAULT_TASK_STACK_SIZE,
+        .messaging_publish_outbox_task_priority      = INF_MESSAGING_PUBLISH_OUTBOX_IMPL_DEFAULT_TASK_PRIORITY,
+#endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_MESSAGING_PUBLISH_USE_OUTBOX */
 #endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_MESSAGING_PUBLISH_ENABLE */
 
 #ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_MESSAGING_SUBSCRIBE_ENABLE
@@ -163,9 +196,11 @@ const cmp_main_config_t cmp_main_config = {
 
 #ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_DEVICE_WIFI_ENABLE
 #ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_DEVICE_WIFI_USE_ESP_WIFI
-        .wifi_esp_wifi_sta_if_key             = "WIFI_STA_DEF",
-        .wifi_esp_wifi_ap_if_key              = "WIFI_AP_DEF",
-        .wifi_esp_wifi_register_event_handler = true,
+        .wifi_esp_wifi_sta_if_key                = "WIFI_STA_DEF",
+        .wifi_esp_wifi_ap_if_key                 = "WIFI_AP_DEF",
+        .wifi_esp_wifi_register_event_handler    = true,
+        .wifi_esp_wifi_register_ip_event_handler = true,
+        .wifi_esp_wifi_scan_record_max           = DOM_MODELS_WIFI_SCAN_RECORD_MAX,
 #endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_DEVICE_WIFI_USE_ESP_WIFI */
 #endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_DEVICE_WIFI_ENABLE */
 
@@ -212,14 +247,81 @@ const cmp_main_config_t cmp_main_config = {
 #ifdef COMPOSITION_MAIN_CONFIG_APPLICATION_WIFIMAN_ENABLE
         .wifiman_reconnect_max_trials   = APP_WIFIMAN_IMPL_DEFAULT_RECONNECT_MAX_TRIALS,
         .wifiman_ap_auto_manage_enabled = true,
+        .wifiman_scan_entry_ttl_ms      = APP_WIFIMAN_IMPL_DEFAULT_SCAN_ENTRY_TTL_MS,
+        .wifiman_scan_entry_max         = APP_WIFIMAN_IMPL_DEFAULT_SCAN_ENTRY_MAX,
+        .wifiman_scan_dedup_by_ssid     = true,
+        .wifiman_roam_rssi_low          = APP_WIFIMAN_IMPL_DEFAULT_ROAM_RSSI_LOW,
+        .wifiman_roam_rssi_high         = APP_WIFIMAN_IMPL_DEFAULT_ROAM_RSSI_HIGH,
+        .wifiman_roam_rssi_gain         = APP_WIFIMAN_IMPL_DEFAULT_ROAM_RSSI_GAIN,
+        .wifiman_roam_ewma_shift        = APP_WIFIMAN_IMPL_DEFAULT_ROAM_EWMA_SHIFT,
+        .wifiman_roam_weak_samples      = APP_WIFIMAN_IMPL_DEFAULT_ROAM_WEAK_SAMPLES,
+        .wifiman_roam_cooldown_samples  = APP_WIFIMAN_IMPL_DEFAULT_ROAM_COOLDOWN_SAMPLES,
 #endif /* COMPOSITION_MAIN_CONFIG_APPLICATION_WIFIMAN_ENABLE */
     },
     .presentation = {
+#ifdef COMPOSITION_MAIN_CONFIG_DRIVER_HTTP_SERVER_ENABLE
+        .http_etag_network_revalidate_ms = PRES_HTTP_ETAG_DEFAULT_REVALIDATE_MS,
+#endif /* COMPOSITION_MAIN_CONFIG_DRIVER_HTTP_SERVER_ENABLE */
+
+#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_EVENTS_ENABLE
+        .event_stream_task_name         = PRES_TASK_EVENT_STREAM_DEFAULT_TASK_NAME,
+        .event_stream_task_stack_size   = PRES_TASK_EVENT_STREAM_DEFAULT_STACK_SIZE,
+        .event_stream_task_priority     = PRES_TASK_EVENT_STREAM_DEFAULT_PRIORITY,
+        .event_stream_task_client_max   = PRES_TASK_EVENT_STREAM_DEFAULT_CLIENT_MAX,
+        .event_stream_task_tick_ms      = PRES_TASK_EVENT_STREAM_DEFAULT_TICK_MS,
+        .event_stream_task_keepalive_ms = PRES_TASK_EVENT_STREAM_DEFAULT_KEEPALIVE_MS,
+#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_EVENTS_ENABLE */
+
+#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_ASSETS_ENABLE
+        .http_assets_base_path = PRES_HTTP_HANDLER_ASSETS_DEFAULT_BASE_PATH,
+#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_ASSETS_ENABLE */
+
+#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_ADMISSION_ENABLE
+        .http_admission_read_burst               = PRES_HTTP_ADMISSION_DEFAULT_READ_BURST,
+        .http_admission_read_per_min             = PRES_HTTP_ADMISSION_DEFAULT_READ_PER_MIN,
+        .http_admission_write_burst              = PRES_HTTP_ADMISSION_DEFAULT_WRITE_BURST,
+        .http_admission_write_per_min            = PRES_HTTP_ADMISSION_DEFAULT_WRITE_PER_MIN,
+        .http_admission_expensive_burst          = PRES_HTTP_ADMISSION_DEFAULT_EXPENSIVE_BURST,
+        .http_admission_expensive_per_min        = PRES_HTTP_ADMISSION_DEFAULT_EXPENSIVE_PER_MIN,
+        .http_admission_expensive_shared_burst   = PRES_HTTP_ADMISSION_DEFAULT_EXPENSIVE_SHARED_BURST,
+        .http_admission_expensive_shared_per_min = PRES_HTTP_ADMISSION_DEFAULT_EXPENSIVE_SHARED_PER_MIN,
+#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_ADMISSION_ENABLE */
+
 #ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_WIFIMAN_STA_RECONNECT_ENABLE
-        .wifiman_sta_reconnect_task_name        = PRES_TASK_WIFIMAN_STA_RECONNECT_DEFAULT_TASK_NAME,
-        .wifiman_sta_reconnect_task_stack_size  = PRES_TASK_WIFIMAN_STA_RECONNECT_DEFAULT_STACK_SIZE,
-        .wifiman_sta_reconnect_task_priority    = PRES_TASK_WIFIMAN_STA_RECONNECT_DEFAULT_PRIORITY,
-        .wifiman_sta_reconnect_task_interval_ms = PRES_TASK_WIFIMAN_STA_RECONNECT_DEFAULT_INTERVAL_MS,
+        .wifiman_sta_reconnect_task_name            = PRES_TASK_WIFIMAN_STA_RECONNECT_DEFAULT_TASK_NAME,
+        .wifiman_sta_reconnect_task_stack_size      = PRES_TASK_WIFIMAN_STA_RECONNECT_DEFAULT_STACK_SIZE,
+        .wifiman_sta_reconnect_task_priority        = PRES_TASK_WIFIMAN_STA_RECONNECT_DEFAULT_PRIORITY,
+        .wifiman_sta_reconnect_task_backoff_base_ms = PRES_TASK_WIFIMAN_STA_RECONNECT_DEFAULT_BACKOFF_BASE_MS,
+        .wifiman_sta_reconnect_task_backoff_max_ms  = PRES_TASK_WIFIMAN_STA_RECONNECT_DEFAULT_BACKOFF_MAX_MS,
+        .wifiman_sta_reconnect_task_jitter_pct      = PRES_TASK_WIFIMAN_STA_RECONNECT_DEFAULT_JITTER_PCT,
 #endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_WIFIMAN_STA_RECONNECT_ENABLE */
+
+#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_WIFIMAN_LINK_MONITOR_ENABLE
+        .wifiman_link_monitor_task_name               = PRES_TASK_WIFIMAN_LINK_MONITOR_DEFAULT_TASK_NAME,
+        .wifiman_link_monitor_task_stack_size         = PRES_TASK_WIFIMAN_LINK_MONITOR_DEFAULT_STACK_SIZE,
+        .wifiman_link_monitor_task_priority           = PRES_TASK_WIFIMAN_LINK_MONITOR_DEFAULT_PRIORITY,
+        .wifiman_link_monitor_task_sample_interval_ms = PRES_TASK_WIFIMAN_LINK_MONITOR_DEFAULT_SAMPLE_INTERVAL_MS,
+#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_WIFIMAN_LINK_MONITOR_ENABLE */
+
+#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_LOG_SHIPPING_ENABLE
+        .log_shipping_task_level           = DOMAIN_MODELS_LOGGER_LEVEL_INFO,
+        .log_shipping_task_name            = PRES_TASK_LOG_SHIPPING_DEFAULT_TASK_NAME,
+        .log_shipping_task_stack_size      = PRES_TASK_LOG_SHIPPING_DEFAULT_STACK_SIZE,
+        .log_shipping_task_priority        = PRES_TASK_LOG_SHIPPING_DEFAULT_PRIORITY,
+        .log_shipping_task_batch_max_bytes = PRES_TASK_LOG_SHIPPING_DEFAULT_BATCH_MAX_BYTES,
+        .log_shipping_task_batch_max_count = PRES_TASK_LOG_SHIPPING_DEFAULT_BATCH_MAX_CNT,
+        .log_shipping_task_line_max_len    = PRES_TASK_LOG_SHIPPING_DEFAULT_LINE_MAX_LEN,
+        .log_shipping_task_max_latency_ms  = PRES_TASK_LOG_SHIPPING_DEFAULT_MAX_LATENCY_MS,
+        .log_shipping_task_binary          = true,
+#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_LOG_SHIPPING_ENABLE */
+
+#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_STATUS_PUBLISH_ENABLE
+        .status_publish_task_name               = PRES_TASK_STATUS_PUBLISH_DEFAULT_TASK_NAME,
+        .status_publish_task_stack_size         = PRES_TASK_STATUS_PUBLISH_DEFAULT_STACK_SIZE,
+        .status_publish_task_priority           = PRES_TASK_STATUS_PUBLISH_DEFAULT_PRIORITY,
+        .status_publish_task_sample_interval_ms = PRES_TASK_STATUS_PUBLISH_DEFAULT_SAMPLE_INTERVAL_MS,
+        .status_publish_task_debounce_ms        = PRES_TASK_STATUS_PUBLISH_DEFAULT_DEBOUNCE_MS,
+        .status_publish_task_heartbeat_ms       = PRES_TASK_STATUS_PUBLISH_DEFAULT_HEARTBEAT_MS,
+#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_STATUS_PUBLISH_ENABLE */
     },
 };
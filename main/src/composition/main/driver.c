@@ -34,9 +34,10 @@
 #include "nimble/nimble_port.h"                // IWYU pragma: keep
 #include "nvs.h"                               // IWYU pragma: keep
 #include "nvs_flash.h"                         // IWYU pragma: keep
-#include "presentation/http/route/netif.h"     // IWYU pragma: keep
-#include "presentation/http/route/settings.h"  // IWYU pragma: keep
-#include "presentation/http/route/wifiman.h"   // IWYU pragma: keep
+#include "presentation/http/admission.h"       // IWYU pragma: keep
+#include "presentation/http/metrics.h"         // IWYU pragma: keep
+#include "presentation/http/route/assets.h"    // IWYU pragma: keep
+#include "presentation/http/router.h"          // IWYU pragma: keep
 #include "sdmmc_cmd.h"                         // IWYU pragma: keep
 #include "services/gap/ble_svc_gap.h"          // IWYU pragma: keep
 #include "services/gatt/ble_svc_gatt.h"        // IWYU pragma: keep
@@ -492,17 +493,69 @@ dom_models_error_t cmp_main_driver_init(cmp_main_launcher_t* launcher) {
 
 #ifdef COMPOSITION_MAIN_CONFIG_DRIVER_HTTP_SERVER_ENABLE
 
+    /* Every /api/ route lives in the router, the server only holds its wildcard handlers */
     httpd_config_t http_server_cfg   = HTTPD_DEFAULT_CONFIG();
-    http_server_cfg.max_uri_handlers = 0;
-#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_NETIF_ENABLE
-    http_server_cfg.max_uri_handlers += pres_http_route_netif_route_cnt();
-#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_NETIF_ENABLE */
-#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_SETTINGS_ENABLE
-    http_server_cfg.max_uri_handlers += pres_http_route_settings_route_cnt();
-#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_SETTINGS_ENABLE */
-#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_WIFIMAN_ENABLE
-    http_server_cfg.max_uri_handlers += pres_http_route_wifiman_route_cnt();
-#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_WIFIMAN_ENABLE */
+    http_server_cfg.max_uri_handlers = PRES_HTTP_ROUTER_HANDLER_CNT;
+    http_server_cfg.uri_match_fn     = httpd_uri_match_wildcard;
+#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_ASSETS_ENABLE
+    http_server_cfg.max_uri_handlers += pres_http_route_assets_route_cnt();
+#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_ASSETS_ENABLE */
+
+    pres_http_metrics_t* http_server_metrics = NULL;
+#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_METRICS_ENABLE
+    launcher->driver.http_server_metrics = pres_http_metrics_new();
+    if (!launcher->driver.http_server_metrics) {
+        ESP_LOGE(tag, "Failed to allocate HTTP server metrics");
+        cmp_main_driver_deinit(launcher);
+        return DOMAIN_MODELS_ERROR_MALLOC_FAILED;
+    }
+    http_server_metrics = launcher->driver.http_server_metrics;
+#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_METRICS_ENABLE */
+
+    pres_http_admission_t* http_server_admission = NULL;
+#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_ADMISSION_ENABLE
+    pres_http_admission_config_t http_admission_cfg = {
+        .client = {
+            [PRES_HTTP_ADMISSION_CLASS_READ] = {
+                .burst   = cmp_main_config.presentation.http_admission_read_burst,
+                .per_min = cmp_main_config.presentation.http_admission_read_per_min,
+            },
+            [PRES_HTTP_ADMISSION_CLASS_WRITE] = {
+                .burst   = cmp_main_config.presentation.http_admission_write_burst,
+                .per_min = cmp_main_config.presentation.http_admission_write_per_min,
+            },
+            [PRES_HTTP_ADMISSION_CLASS_EXPENSIVE] = {
+                .burst   = cmp_main_config.presentation.http_admission_expensive_burst,
+                .per_min = cmp_main_config.presentation.http_admission_expensive_per_min,
+            },
+        },
+        .shared = {
+            [PRES_HTTP_ADMISSION_CLASS_EXPENSIVE] = {
+                .burst   = cmp_main_config.presentation.http_admission_expensive_shared_burst,
+                .per_min = cmp_main_config.presentation.http_admission_expensive_shared_per_min,
+            },
+        },
+    };
+
+    launcher->driver.http_server_admission = pres_http_admission_new(&http_admission_cfg);
+    if (!launcher->driver.http_server_admission) {
+        ESP_LOGE(tag, "Failed to allocate HTTP server admission");
+        cmp_main_driver_deinit(launcher);
+        return DOMAIN_MODELS_ERROR_MALLOC_FAILED;
+    }
+    http_server_admission = launcher->driver.http_server_admission;
+#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_ADMISSION_ENABLE */
+
+    launcher->driver.http_server_router = pres_http_router_new(http_server_metrics, http_server_admission);
+    if (!launcher->driver.http_server_router) {
+        ESP_LOGE(tag, "Failed to allocate HTTP server router");
+        cmp_main_driver_deinit(launcher);
+        return DOMAIN_MODELS_ERROR_MALLOC_FAILED;
+    }
+
+    /* Routes registered through pres_http_route_common_register find the router here */
+    http_server_cfg.global_user_ctx         = launcher->driver.http_server_router;
+    http_server_cfg.global_user_ctx_free_fn = pres_http_router_release;
 
     err = httpd_start(&launcher->driver.http_server_handle, &http_server_cfg);
     if (err != ESP_OK) {
@@ -512,6 +565,14 @@ dom_models_error_t cmp_main_driver_init(cmp_main_launcher_t* launcher) {
     }
 
     init_http_server = true;
+
+    err = pres_http_router_register(launcher->driver.http_server_handle, launcher->driver.http_server_router);
+    if (err != ESP_OK) {
+        ESP_LOGE(tag, "Failed to register HTTP server router: %s", esp_err_to_name(err));
+        cmp_main_driver_deinit(launcher);
+        return DOMAIN_MODELS_ERROR_FAILURE;
+    }
+
     ESP_LOGI(tag, "HTTP server started");
 
 #endif /* COMPOSITION_MAIN_CONFIG_DRIVER_HTTP_SERVER_ENABLE */
@@ -606,6 +667,22 @@ void cmp_main_driver_deinit(cmp_main_launcher_t* launcher) {
         launcher->driver.http_server_handle = NULL;
         init_http_server                    = false;
     }
+    if (launcher->driver.http_server_router) {
+        pres_http_router_delete(launcher->driver.http_server_router);
+        launcher->driver.http_server_router = NULL;
+    }
+#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_METRICS_ENABLE
+    if (launcher->driver.http_server_metrics) {
+        pres_http_metrics_delete(launcher->driver.http_server_metrics);
+        launcher->driver.http_server_metrics = NULL;
+    }
+#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_METRICS_ENABLE */
+#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_ADMISSION_ENABLE
+    if (launcher->driver.http_server_admission) {
+        pres_http_admission_delete(launcher->driver.http_server_admission);
+        launcher->driver.http_server_admission = NULL;
+    }
+#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_ADMISSION_ENABLE */
 #endif /* COMPOSITION_MAIN_CONFIG_DRIVER_HTTP_SERVER_ENABLE */
 
 #ifdef COMPOSITION_MAIN_CONFIG_DRIVER_BLE_ENABLE
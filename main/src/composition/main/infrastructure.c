@@ -8,8 +8,10 @@
 #include "infrastructure/device/ethernet/stub_impl.h"          // IWYU pragma: keep
 #include "infrastructure/device/wifi/esp_wifi_impl.h"          // IWYU pragma: keep
 #include "infrastructure/device/wifi/stub_impl.h"              // IWYU pragma: keep
+#include "infrastructure/logger/leveled/ring_impl.h"           // IWYU pragma: keep
 #include "infrastructure/logger/leveled/stdio_impl.h"          // IWYU pragma: keep
 #include "infrastructure/messaging/publish/esp_mqtt_impl.h"    // IWYU pragma: keep
+#include "infrastructure/messaging/publish/outbox_impl.h"      // IWYU pragma: keep
 #include "infrastructure/messaging/publish/stub_impl.h"        // IWYU pragma: keep
 #include "infrastructure/messaging/subscribe/esp_mqtt_impl.h"  // IWYU pragma: keep
 #include "infrastructure/messaging/subscribe/stub_impl.h"      // IWYU pragma: keep
@@ -19,6 +21,7 @@
 #include "infrastructure/repository/preloaded/stub_impl.h"     // IWYU pragma: keep
 #include "infrastructure/repository/wifi/nvs_impl.h"           // IWYU pragma: keep
 #include "infrastructure/repository/wifi/stub_impl.h"          // IWYU pragma: keep
+#include "infrastructure/system/clock/esp_impl.h"              // IWYU pragma: keep
 #include "infrastructure/system/info/esp_impl.h"               // IWYU pragma: keep
 #include "infrastructure/system/restart/esp_impl.h"            // IWYU pragma: keep
 #include "infrastructure/system/update/esp_https_impl.h"       // IWYU pragma: keep
@@ -29,10 +32,12 @@
 /* Init Flags for Deinitizalization Sequence */
 
 static bool init_logger               = false;
+static bool init_system_clock         = false;
 static bool init_system_info          = false;
 static bool init_system_restart       = false;
 static bool init_system_update        = false;
 static bool init_messaging_publish    = false;
+static bool init_messaging_outbox     = false;
 static bool init_messaging_subscribe  = false;
 static bool init_wifi                 = false;
 static bool init_ethernet             = false;
@@ -50,23 +55,66 @@ dom_models_error_t cmp_main_infrastructure_init(cmp_main_launcher_t* launcher) {
 
     /* Logger */
 
-#ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_STDIO_ENABLE
-
+#ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_ENABLE
+
+#if defined(COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_USE_RING)
+    inf_logger_leveled_ring_impl_cfg_t logger_cfg = {
+        .level           = cmp_main_config.infrastructure.logger_leveled_ring_level,
+        .cb_max_cnt      = cmp_main_config.infrastructure.logger_leveled_ring_callback_max_count,
+        .slot_cnt        = cmp_main_config.infrastructure.logger_leveled_ring_slot_count,
+        .msg_max_len     = cmp_main_config.infrastructure.logger_leveled_ring_msg_max_len,
+        .task_name       = cmp_main_config.infrastructure.logger_leveled_ring_task_name,
+        .task_stack_size = cmp_main_config.infrastructure.logger_leveled_ring_task_stack_size,
+        .task_priority   = cmp_main_config.infrastructure.logger_leveled_ring_task_priority,
+        .deferred_format = cmp_main_config.infrastructure.logger_leveled_ring_deferred_format,
+    };
+    launcher->infrastructure.logger = inf_logger_leveled_ring_impl_new(&logger_cfg);
+#elif defined(COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_USE_STDIO)
     inf_logger_leveled_stdio_impl_cfg_t logger_cfg = {
         .level      = cmp_main_config.infrastructure.logger_leveled_stdio_level,
         .cb_max_cnt = cmp_main_config.infrastructure.logger_leveled_stdio_callback_max_count,
     };
     launcher->infrastructure.logger = inf_logger_leveled_stdio_impl_new(&logger_cfg);
+#else
+    ESP_LOGE(tag, "No leveled logger infrastructure backend configured");
+    cmp_main_infrastructure_deinit(launcher);
+    return DOMAIN_MODELS_ERROR_NOT_SUPPORTED;
+#endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_USE_RING */
+
     if (!launcher->infrastructure.logger) {
-        ESP_LOGE(tag, "Failed to create leveled stdio logger");
+        ESP_LOGE(tag, "Failed to create leveled logger");
         cmp_main_infrastructure_deinit(launcher);
         return DOMAIN_MODELS_ERROR_MALLOC_FAILED;
     }
 
     init_logger = true;
-    ESP_LOGI(tag, "Leveled stdio logger created");
+    ESP_LOGI(tag, "Leveled logger created");
+
+#endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_ENABLE */
+
+    /* System Clock */
+
+#ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_SYSTEM_CLOCK_ENABLE
+
+#ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_SYSTEM_CLOCK_USE_ESP
+    inf_system_clock_esp_impl_cfg_t system_clock_cfg = INF_SYSTEM_CLOCK_ESP_IMPL_CFG_DEFAULT();
+    launcher->infrastructure.system_clock            = inf_system_clock_esp_impl_new(&system_clock_cfg);
+#else
+    ESP_LOGE(tag, "No system clock infrastructure backend configured");
+    cmp_main_infrastructure_deinit(launcher);
+    return DOMAIN_MODELS_ERROR_NOT_SUPPORTED;
+#endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_SYSTEM_CLOCK_USE_ESP */
+
+    if (!launcher->infrastructure.system_clock) {
+        ESP_LOGE(tag, "Failed to create system clock");
+        cmp_main_infrastructure_deinit(launcher);
+        return DOMAIN_MODELS_ERROR_MALLOC_FAILED;
+    }
 
-#endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_STDIO_ENABLE */
+    init_system_clock = true;
+    ESP_LOGI(tag, "System clock created");
+
+#endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_SYSTEM_CLOCK_ENABLE */
 
     /* System Info */
 
@@ -187,6 +235,40 @@ dom_models_error_t cmp_main_infrastructure_init(cmp_main_launcher_t* launcher) {
     ESP_LOGI(tag, "Messaging publish created");
 #endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_MESSAGING_PUBLISH_USE_ESP_MQTT dependency */
 
+#ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_MESSAGING_PUBLISH_USE_OUTBOX
+#ifndef COMPOSITION_MAIN_CONFIG_DRIVER_LITTLEFS_ENABLE
+    ESP_LOGE(tag, "Messaging publish outbox requires LittleFS driver");
+    cmp_main_infrastructure_deinit(launcher);
+    return DOMAIN_MODELS_ERROR_BAD_STATE;
+#else
+    inf_messaging_publish_outbox_impl_cfg_t messaging_outbox_cfg = {
+        .inner              = launcher->infrastructure.messaging_publish,
+        .dir_path           = cmp_main_config.infrastructure.messaging_publish_outbox_dir_path,
+        .segment_max_bytes  = cmp_main_config.infrastructure.messaging_publish_outbox_segment_max_bytes,
+        .segment_max_cnt    = cmp_main_config.infrastructure.messaging_publish_outbox_segment_max_count,
+        .record_max_len     = cmp_main_config.infrastructure.messaging_publish_outbox_record_max_len,
+        .replay_interval_ms = cmp_main_config.infrastructure.messaging_publish_outbox_replay_interval_ms,
+        .replay_burst_cnt   = cmp_main_config.infrastructure.messaging_publish_outbox_replay_burst_count,
+        .task_name          = cmp_main_config.infrastructure.messaging_publish_outbox_task_name,
+        .task_stack_size    = cmp_main_config.infrastructure.messaging_publish_outbox_task_stack_size,
+        .task_priority      = cmp_main_config.infrastructure.messaging_publish_outbox_task_priority,
+    };
+    dom_contracts_messaging_publish_t* messaging_outbox = inf_messaging_publish_outbox_impl_new(&messaging_outbox_cfg);
+    if (!messaging_outbox) {
+        ESP_LOGE(tag, "Failed to create messaging publish outbox");
+        cmp_main_infrastructure_deinit(launcher);
+        return DOMAIN_MODELS_ERROR_FAILURE;
+    }
+
+    /* Consumers only see the outbox, the backend stays reachable for teardown */
+    launcher->infrastructure.messaging_publish_inner = launcher->infrastructure.messaging_publish;
+    launcher->infrastructure.messaging_publish       = messaging_outbox;
+
+    init_messaging_outbox = true;
+    ESP_LOGI(tag, "Messaging publish outbox created");
+#endif /* COMPOSITION_MAIN_CONFIG_DRIVER_LITTLEFS_ENABLE */
+#endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_MESSAGING_PUBLISH_USE_OUTBOX */
+
 #endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_MESSAGING_PUBLISH_ENABLE */
 
     /* Messaging Subscribe */
@@ -229,9 +311,11 @@ dom_models_error_t cmp_main_infrastructure_init(cmp_main_launcher_t* launcher) {
 
 #ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_DEVICE_WIFI_USE_ESP_WIFI
     inf_device_wifi_esp_wifi_impl_cfg_t wifi_cfg = {
-        .sta_if_key             = cmp_main_config.infrastructure.wifi_esp_wifi_sta_if_key,
-        .ap_if_key              = cmp_main_config.infrastructure.wifi_esp_wifi_ap_if_key,
-        .register_event_handler = cmp_main_config.infrastructure.wifi_esp_wifi_register_event_handler,
+        .sta_if_key                = cmp_main_config.infrastructure.wifi_esp_wifi_sta_if_key,
+        .ap_if_key                 = cmp_main_config.infrastructure.wifi_esp_wifi_ap_if_key,
+        .register_event_handler    = cmp_main_config.infrastructure.wifi_esp_wifi_register_event_handler,
+        .register_ip_event_handler = cmp_main_config.infrastructure.wifi_esp_wifi_register_ip_event_handler,
+        .scan_record_max           = cmp_main_config.infrastructure.wifi_esp_wifi_scan_record_max,
     };
     launcher->infrastructure.wifi = inf_device_wifi_esp_wifi_impl_new(&wifi_cfg);
 #else
@@ -491,6 +575,14 @@ void cmp_main_infrastructure_deinit(cmp_main_launcher_t* launcher) {
 #endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_MESSAGING_SUBSCRIBE_ENABLE */
 
 #ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_MESSAGING_PUBLISH_ENABLE
+#ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_MESSAGING_PUBLISH_USE_OUTBOX
+    if (init_messaging_outbox) {
+        inf_messaging_publish_outbox_impl_delete(launcher->infrastructure.messaging_publish);
+        launcher->infrastructure.messaging_publish       = launcher->infrastructure.messaging_publish_inner;
+        launcher->infrastructure.messaging_publish_inner = NULL;
+        init_messaging_outbox                            = false;
+    }
+#endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_MESSAGING_PUBLISH_USE_OUTBOX */
     if (init_messaging_publish) {
 #ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_MESSAGING_PUBLISH_USE_ESP_MQTT
         inf_messaging_publish_esp_mqtt_impl_delete(launcher->infrastructure.messaging_publish);
@@ -534,11 +626,25 @@ void cmp_main_infrastructure_deinit(cmp_main_launcher_t* launcher) {
     }
 #endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_SYSTEM_INFO_ENABLE */
 
-#ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_STDIO_ENABLE
+#ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_SYSTEM_CLOCK_ENABLE
+    if (init_system_clock) {
+#ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_SYSTEM_CLOCK_USE_ESP
+        inf_system_clock_esp_impl_delete(launcher->infrastructure.system_clock);
+#endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_SYSTEM_CLOCK_USE_ESP */
+        launcher->infrastructure.system_clock = NULL;
+        init_system_clock                     = false;
+    }
+#endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_SYSTEM_CLOCK_ENABLE */
+
+#ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_ENABLE
     if (init_logger) {
+#if defined(COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_USE_RING)
+        inf_logger_leveled_ring_impl_delete(launcher->infrastructure.logger);
+#elif defined(COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_USE_STDIO)
         inf_logger_leveled_stdio_impl_delete(launcher->infrastructure.logger);
+#endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_USE_RING */
         launcher->infrastructure.logger = NULL;
         init_logger                     = false;
     }
-#endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_STDIO_ENABLE */
+#endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_ENABLE */
 }
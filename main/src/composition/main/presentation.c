@@ -5,22 +5,42 @@
 #include "esp_err.h"                                       // IWYU pragma: keep
 #include "esp_log.h"                                       // IWYU pragma: keep
 #include "mqtt_client.h"                                   // IWYU pragma: keep
+#include "presentation/http/etag.h"                        // IWYU pragma: keep
+#include "presentation/http/route/assets.h"                // IWYU pragma: keep
+#include "presentation/http/route/events.h"                // IWYU pragma: keep
+#include "presentation/http/route/metrics.h"               // IWYU pragma: keep
 #include "presentation/http/route/netif.h"                 // IWYU pragma: keep
 #include "presentation/http/route/settings.h"              // IWYU pragma: keep
 #include "presentation/http/route/wifiman.h"               // IWYU pragma: keep
 #include "presentation/mqtt/context.h"                     // IWYU pragma: keep
 #include "presentation/mqtt/event/event_handler.h"         // IWYU pragma: keep
+#include "presentation/task/event_stream/task.h"           // IWYU pragma: keep
+#include "presentation/task/log_shipping/task.h"           // IWYU pragma: keep
+#include "presentation/task/status_publish/task.h"         // IWYU pragma: keep
+#include "presentation/task/wifiman_link_monitor/task.h"   // IWYU pragma: keep
 #include "presentation/task/wifiman_sta_reconnect/task.h"  // IWYU pragma: keep
 
 #define TAG_PATH "main/presentation"
 
 /* Init Flags for Deinitizalization Sequence */
 
-static bool init_netif_http_routes          = false;
-static bool init_settings_http_routes       = false;
-static bool init_wifiman_http_routes        = false;
-static bool init_wifiman_sta_reconnect_task = false;
-static bool init_mqtt_presentation          = false;
+static bool init_http_etag_wifi_callback             = false;
+static bool init_http_etag_ethernet_callback         = false;
+static bool init_netif_http_routes                   = false;
+static bool init_settings_http_routes                = false;
+static bool init_wifiman_http_routes                 = false;
+static bool init_event_stream_task                   = false;
+static bool init_event_stream_wifi_callback          = false;
+static bool init_event_stream_ethernet_callback      = false;
+static bool init_events_http_routes                  = false;
+static bool init_metrics_http_routes                 = false;
+static bool init_assets_http_routes                  = false;
+static bool init_wifiman_sta_reconnect_task          = false;
+static bool init_wifiman_sta_reconnect_wifi_callback = false;
+static bool init_wifiman_link_monitor_task           = false;
+static bool init_log_shipping_task                   = false;
+static bool init_status_publish_task                 = false;
+static bool init_mqtt_presentation                   = false;
 
 dom_models_error_t cmp_main_presentation_init(cmp_main_launcher_t* launcher) {
     const char* tag = TAG_PATH "/init";
@@ -30,6 +50,52 @@ dom_models_error_t cmp_main_presentation_init(cmp_main_launcher_t* launcher) {
         return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
+    /* HTTP ETags */
+
+#ifdef COMPOSITION_MAIN_CONFIG_DRIVER_HTTP_SERVER_ENABLE
+    pres_http_etag_init(
+        &launcher->presentation.network_etag,
+        cmp_main_config.presentation.http_etag_network_revalidate_ms
+    );
+    pres_http_etag_init(&launcher->presentation.settings_etag, 0);
+
+#ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_DEVICE_WIFI_ENABLE
+    if (launcher->infrastructure.wifi) {
+        dom_models_error_t etag_err = launcher->infrastructure.wifi->add_event_callback(
+            launcher->infrastructure.wifi,
+            &launcher->presentation.network_etag,
+            pres_http_etag_on_wifi_event
+        );
+        if (etag_err != DOMAIN_MODELS_ERROR_OK) {
+            ESP_LOGE(tag, "Failed to register HTTP ETag WiFi callback: %s", dom_models_error_str(etag_err));
+            cmp_main_presentation_deinit(launcher);
+            return etag_err;
+        }
+
+        init_http_etag_wifi_callback = true;
+    }
+#endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_DEVICE_WIFI_ENABLE */
+
+#ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_DEVICE_ETHERNET_ENABLE
+    if (launcher->infrastructure.ethernet) {
+        dom_models_error_t etag_err = launcher->infrastructure.ethernet->add_event_callback(
+            launcher->infrastructure.ethernet,
+            &launcher->presentation.network_etag,
+            pres_http_etag_on_ethernet_event
+        );
+        if (etag_err != DOMAIN_MODELS_ERROR_OK) {
+            ESP_LOGE(tag, "Failed to register HTTP ETag Ethernet callback: %s", dom_models_error_str(etag_err));
+            cmp_main_presentation_deinit(launcher);
+            return etag_err;
+        }
+
+        init_http_etag_ethernet_callback = true;
+    }
+#endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_DEVICE_ETHERNET_ENABLE */
+
+    ESP_LOGI(tag, "HTTP ETags initialized");
+#endif /* COMPOSITION_MAIN_CONFIG_DRIVER_HTTP_SERVER_ENABLE */
+
     /* Netif HTTP Routes */
 
 #ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_NETIF_ENABLE
@@ -46,6 +112,7 @@ dom_models_error_t cmp_main_presentation_init(cmp_main_launcher_t* launcher) {
     }
 
     launcher->presentation.netif_http_handler.netif = launcher->application.netif;
+    launcher->presentation.netif_http_handler.etag  = &launcher->presentation.network_etag;
 
     esp_err_t netif_http_err = pres_http_route_netif_register(
         launcher->driver.http_server_handle,
@@ -55,6 +122,7 @@ dom_models_error_t cmp_main_presentation_init(cmp_main_launcher_t* launcher) {
         ESP_LOGE(tag, "Failed to register Netif HTTP routes: %s", esp_err_to_name(netif_http_err));
         pres_http_route_netif_unregister(launcher->driver.http_server_handle);
         launcher->presentation.netif_http_handler.netif = NULL;
+        launcher->presentation.netif_http_handler.etag  = NULL;
         cmp_main_presentation_deinit(launcher);
         return DOMAIN_MODELS_ERROR_FAILURE;
     }
@@ -81,6 +149,7 @@ dom_models_error_t cmp_main_presentation_init(cmp_main_launcher_t* launcher) {
     }
 
     launcher->presentation.settings_http_handler.settings = launcher->application.settings;
+    launcher->presentation.settings_http_handler.etag     = &launcher->presentation.settings_etag;
 
     esp_err_t settings_http_err = pres_http_route_settings_register(
         launcher->driver.http_server_handle,
@@ -90,6 +159,7 @@ dom_models_error_t cmp_main_presentation_init(cmp_main_launcher_t* launcher) {
         ESP_LOGE(tag, "Failed to register Settings HTTP routes: %s", esp_err_to_name(settings_http_err));
         pres_http_route_settings_unregister(launcher->driver.http_server_handle);
         launcher->presentation.settings_http_handler.settings = NULL;
+        launcher->presentation.settings_http_handler.etag     = NULL;
         cmp_main_presentation_deinit(launcher);
         return DOMAIN_MODELS_ERROR_FAILURE;
     }
@@ -116,6 +186,7 @@ dom_models_error_t cmp_main_presentation_init(cmp_main_launcher_t* launcher) {
     }
 
     launcher->presentation.wifiman_http_handler.wifiman = launcher->application.wifiman;
+    launcher->presentation.wifiman_http_handler.etag    = &launcher->presentation.network_etag;
 
     esp_err_t http_err = pres_http_route_wifiman_register(
         launcher->driver.http_server_handle,
@@ -125,6 +196,7 @@ dom_models_error_t cmp_main_presentation_init(cmp_main_launcher_t* launcher) {
         ESP_LOGE(tag, "Failed to register WiFiMan HTTP routes: %s", esp_err_to_name(http_err));
         pres_http_route_wifiman_unregister(launcher->driver.http_server_handle);
         launcher->presentation.wifiman_http_handler.wifiman = NULL;
+        launcher->presentation.wifiman_http_handler.etag    = NULL;
         cmp_main_presentation_deinit(launcher);
         return DOMAIN_MODELS_ERROR_FAILURE;
     }
@@ -135,27 +207,204 @@ dom_models_error_t cmp_main_presentation_init(cmp_main_launcher_t* launcher) {
 
 #endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_WIFIMAN_ENABLE */
 
+    /* Events HTTP Route */
+
+#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_EVENTS_ENABLE
+
+#if !defined(COMPOSITION_MAIN_CONFIG_DRIVER_HTTP_SERVER_ENABLE)
+    ESP_LOGE(tag, "Events HTTP dependencies are disabled");
+    cmp_main_presentation_deinit(launcher);
+    return DOMAIN_MODELS_ERROR_BAD_STATE;
+#else
+    if (!launcher->driver.http_server_handle) {
+        ESP_LOGE(tag, "Events HTTP dependencies are not initialized");
+        cmp_main_presentation_deinit(launcher);
+        return DOMAIN_MODELS_ERROR_BAD_STATE;
+    }
+
+    pres_task_event_stream_cfg_t event_stream_task_cfg = {
+        .settings_etag = &launcher->presentation.settings_etag,
+        .task_name     = cmp_main_config.presentation.event_stream_task_name,
+        .stack_size    = cmp_main_config.presentation.event_stream_task_stack_size,
+        .priority      = (UBaseType_t)cmp_main_config.presentation.event_stream_task_priority,
+        .client_max    = cmp_main_config.presentation.event_stream_task_client_max,
+        .tick_ms       = cmp_main_config.presentation.event_stream_task_tick_ms,
+        .keepalive_ms  = cmp_main_config.presentation.event_stream_task_keepalive_ms,
+    };
+#ifdef COMPOSITION_MAIN_CONFIG_APPLICATION_OTA_ENABLE
+    event_stream_task_cfg.ota = launcher->application.ota;
+#endif /* COMPOSITION_MAIN_CONFIG_APPLICATION_OTA_ENABLE */
+
+    launcher->presentation.event_stream_task = pres_task_event_stream_new(&event_stream_task_cfg);
+    if (!launcher->presentation.event_stream_task) {
+        ESP_LOGE(tag, "Failed to create event stream task");
+        cmp_main_presentation_deinit(launcher);
+        return DOMAIN_MODELS_ERROR_MALLOC_FAILED;
+    }
+
+    dom_models_error_t event_stream_err = pres_task_event_stream_start(launcher->presentation.event_stream_task);
+    if (event_stream_err != DOMAIN_MODELS_ERROR_OK) {
+        ESP_LOGE(tag, "Failed to start event stream task: %s", dom_models_error_str(event_stream_err));
+        cmp_main_presentation_deinit(launcher);
+        return event_stream_err;
+    }
+
+    init_event_stream_task = true;
+
+#ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_DEVICE_WIFI_ENABLE
+    if (launcher->infrastructure.wifi) {
+        event_stream_err = launcher->infrastructure.wifi->add_event_callback(
+            launcher->infrastructure.wifi,
+            launcher->presentation.event_stream_task,
+            pres_task_event_stream_on_wifi_event
+        );
+        if (event_stream_err != DOMAIN_MODELS_ERROR_OK) {
+            ESP_LOGE(tag, "Failed to register event stream WiFi callback: %s", dom_models_error_str(event_stream_err));
+            cmp_main_presentation_deinit(launcher);
+            return event_stream_err;
+        }
+
+        init_event_stream_wifi_callback = true;
+    }
+#endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_DEVICE_WIFI_ENABLE */
+
+#ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_DEVICE_ETHERNET_ENABLE
+    if (launcher->infrastructure.ethernet) {
+        event_stream_err = launcher->infrastructure.ethernet->add_event_callback(
+            launcher->infrastructure.ethernet,
+            launcher->presentation.event_stream_task,
+            pres_task_event_stream_on_ethernet_event
+        );
+        if (event_stream_err != DOMAIN_MODELS_ERROR_OK) {
+            ESP_LOGE(tag, "Failed to register event stream Ethernet callback: %s", dom_models_error_str(event_stream_err));
+            cmp_main_presentation_deinit(launcher);
+            return event_stream_err;
+        }
+
+        init_event_stream_ethernet_callback = true;
+    }
+#endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_DEVICE_ETHERNET_ENABLE */
+
+    launcher->presentation.events_http_handler.stream = launcher->presentation.event_stream_task;
+
+    esp_err_t events_http_err = pres_http_route_events_register(
+        launcher->driver.http_server_handle,
+        &launcher->presentation.events_http_handler
+    );
+    if (events_http_err != ESP_OK) {
+        ESP_LOGE(tag, "Failed to register Events HTTP routes: %s", esp_err_to_name(events_http_err));
+        pres_http_route_events_unregister(launcher->driver.http_server_handle);
+        launcher->presentation.events_http_handler.stream = NULL;
+        cmp_main_presentation_deinit(launcher);
+        return DOMAIN_MODELS_ERROR_FAILURE;
+    }
+
+    init_events_http_routes = true;
+    ESP_LOGI(tag, "Events HTTP routes registered");
+#endif /* Events HTTP dependencies */
+
+#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_EVENTS_ENABLE */
+
+    /* Metrics HTTP Route */
+
+#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_METRICS_ENABLE
+
+#if !defined(COMPOSITION_MAIN_CONFIG_DRIVER_HTTP_SERVER_ENABLE)
+    ESP_LOGE(tag, "Metrics HTTP dependencies are disabled");
+    cmp_main_presentation_deinit(launcher);
+    return DOMAIN_MODELS_ERROR_BAD_STATE;
+#else
+    if (!launcher->driver.http_server_handle || !launcher->driver.http_server_metrics) {
+        ESP_LOGE(tag, "Metrics HTTP dependencies are not initialized");
+        cmp_main_presentation_deinit(launcher);
+        return DOMAIN_MODELS_ERROR_BAD_STATE;
+    }
+
+    launcher->presentation.metrics_http_handler.metrics = launcher->driver.http_server_metrics;
+
+    esp_err_t metrics_http_err = pres_http_route_metrics_register(
+        launcher->driver.http_server_handle,
+        &launcher->presentation.metrics_http_handler
+    );
+    if (metrics_http_err != ESP_OK) {
+        ESP_LOGE(tag, "Failed to register Metrics HTTP routes: %s", esp_err_to_name(metrics_http_err));
+        pres_http_route_metrics_unregister(launcher->driver.http_server_handle);
+        launcher->presentation.metrics_http_handler.metrics = NULL;
+        cmp_main_presentation_deinit(launcher);
+        return DOMAIN_MODELS_ERROR_FAILURE;
+    }
+
+    init_metrics_http_routes = true;
+    ESP_LOGI(tag, "Metrics HTTP routes registered");
+#endif /* Metrics HTTP dependencies */
+
+#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_METRICS_ENABLE */
+
+    /* Assets HTTP Route */
+
+#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_ASSETS_ENABLE
+
+#if !defined(COMPOSITION_MAIN_CONFIG_DRIVER_HTTP_SERVER_ENABLE) || \
+    !defined(COMPOSITION_MAIN_CONFIG_DRIVER_LITTLEFS_ENABLE)
+    ESP_LOGE(tag, "Assets HTTP dependencies are disabled");
+    cmp_main_presentation_deinit(launcher);
+    return DOMAIN_MODELS_ERROR_BAD_STATE;
+#else
+    if (!launcher->driver.http_server_handle) {
+        ESP_LOGE(tag, "Assets HTTP dependencies are not initialized");
+        cmp_main_presentation_deinit(launcher);
+        return DOMAIN_MODELS_ERROR_BAD_STATE;
+    }
+
+    launcher->presentation.assets_http_handler.base_path = cmp_main_config.presentation.http_assets_base_path;
+
+    /* Catches every GET path, so it goes last */
+    esp_err_t assets_http_err = pres_http_route_assets_register(
+        launcher->driver.http_server_handle,
+        &launcher->presentation.assets_http_handler
+    );
+    if (assets_http_err != ESP_OK) {
+        ESP_LOGE(tag, "Failed to register Assets HTTP routes: %s", esp_err_to_name(assets_http_err));
+        pres_http_route_assets_unregister(launcher->driver.http_server_handle);
+        launcher->presentation.assets_http_handler.base_path = NULL;
+        cmp_main_presentation_deinit(launcher);
+        return DOMAIN_MODELS_ERROR_FAILURE;
+    }
+
+    init_assets_http_routes = true;
+    ESP_LOGI(tag, "Assets HTTP routes registered");
+#endif /* Assets HTTP dependencies */
+
+#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_ASSETS_ENABLE */
+
     /* WiFiMan STA Reconnect Task */
 
 #ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_WIFIMAN_STA_RECONNECT_ENABLE
 
-#ifndef COMPOSITION_MAIN_CONFIG_APPLICATION_WIFIMAN_ENABLE
+#if !defined(COMPOSITION_MAIN_CONFIG_APPLICATION_WIFIMAN_ENABLE) || \
+    !defined(COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_SYSTEM_CLOCK_ENABLE) || \
+    !defined(COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_DEVICE_WIFI_ENABLE)
     ESP_LOGE(tag, "WiFiMan STA reconnect task dependency is disabled");
     cmp_main_presentation_deinit(launcher);
     return DOMAIN_MODELS_ERROR_BAD_STATE;
 #else
-    if (!launcher->application.wifiman) {
+    if (!launcher->application.wifiman ||
+        !launcher->infrastructure.system_clock ||
+        !launcher->infrastructure.wifi) {
         ESP_LOGE(tag, "WiFiMan STA reconnect task dependency is not initialized");
         cmp_main_presentation_deinit(launcher);
         return DOMAIN_MODELS_ERROR_BAD_STATE;
     }
 
     pres_task_wifiman_sta_reconnect_cfg_t wifiman_sta_reconnect_task_cfg = {
-        .wifiman     = launcher->application.wifiman,
-        .task_name   = cmp_main_config.presentation.wifiman_sta_reconnect_task_name,
-        .stack_size  = cmp_main_config.presentation.wifiman_sta_reconnect_task_stack_size,
-        .priority    = (UBaseType_t)cmp_main_config.presentation.wifiman_sta_reconnect_task_priority,
-        .interval_ms = cmp_main_config.presentation.wifiman_sta_reconnect_task_interval_ms,
+        .wifiman         = launcher->application.wifiman,
+        .clock           = launcher->infrastructure.system_clock,
+        .task_name       = cmp_main_config.presentation.wifiman_sta_reconnect_task_name,
+        .stack_size      = cmp_main_config.presentation.wifiman_sta_reconnect_task_stack_size,
+        .priority        = (UBaseType_t)cmp_main_config.presentation.wifiman_sta_reconnect_task_priority,
+        .backoff_base_ms = cmp_main_config.presentation.wifiman_sta_reconnect_task_backoff_base_ms,
+        .backoff_max_ms  = cmp_main_config.presentation.wifiman_sta_reconnect_task_backoff_max_ms,
+        .jitter_pct      = cmp_main_config.presentation.wifiman_sta_reconnect_task_jitter_pct,
     };
     launcher->presentation.wifiman_sta_reconnect_task = pres_task_wifiman_sta_reconnect_new(
         &wifiman_sta_reconnect_task_cfg
@@ -176,11 +425,173 @@ dom_models_error_t cmp_main_presentation_init(cmp_main_launcher_t* launcher) {
     }
 
     init_wifiman_sta_reconnect_task = true;
+
+    task_err = launcher->infrastructure.wifi->add_event_callback(
+        launcher->infrastructure.wifi,
+        launcher->presentation.wifiman_sta_reconnect_task,
+        pres_task_wifiman_sta_reconnect_on_wifi_event
+    );
+    if (task_err != DOMAIN_MODELS_ERROR_OK) {
+        ESP_LOGE(tag, "Failed to register WiFiMan STA reconnect WiFi callback: %s", dom_models_error_str(task_err));
+        cmp_main_presentation_deinit(launcher);
+        return task_err;
+    }
+
+    init_wifiman_sta_reconnect_wifi_callback = true;
     ESP_LOGI(tag, "WiFiMan STA reconnect task started");
-#endif /* COMPOSITION_MAIN_CONFIG_APPLICATION_WIFIMAN_ENABLE */
+#endif /* WiFiMan STA reconnect task dependencies */
 
 #endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_WIFIMAN_STA_RECONNECT_ENABLE */
 
+    /* WiFiMan Link Monitor Task */
+
+#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_WIFIMAN_LINK_MONITOR_ENABLE
+
+#if !defined(COMPOSITION_MAIN_CONFIG_APPLICATION_WIFIMAN_ENABLE)
+    ESP_LOGE(tag, "WiFiMan link monitor task dependency is disabled");
+    cmp_main_presentation_deinit(launcher);
+    return DOMAIN_MODELS_ERROR_BAD_STATE;
+#else
+    if (!launcher->application.wifiman) {
+        ESP_LOGE(tag, "WiFiMan link monitor task dependency is not initialized");
+        cmp_main_presentation_deinit(launcher);
+        return DOMAIN_MODELS_ERROR_BAD_STATE;
+    }
+
+    pres_task_wifiman_link_monitor_cfg_t wifiman_link_monitor_task_cfg = {
+        .wifiman            = launcher->application.wifiman,
+        .task_name          = cmp_main_config.presentation.wifiman_link_monitor_task_name,
+        .stack_size         = cmp_main_config.presentation.wifiman_link_monitor_task_stack_size,
+        .priority           = (UBaseType_t)cmp_main_config.presentation.wifiman_link_monitor_task_priority,
+        .sample_interval_ms = cmp_main_config.presentation.wifiman_link_monitor_task_sample_interval_ms,
+    };
+    launcher->presentation.wifiman_link_monitor_task = pres_task_wifiman_link_monitor_new(
+        &wifiman_link_monitor_task_cfg
+    );
+    if (!launcher->presentation.wifiman_link_monitor_task) {
+        ESP_LOGE(tag, "Failed to create WiFiMan link monitor task");
+        cmp_main_presentation_deinit(launcher);
+        return DOMAIN_MODELS_ERROR_MALLOC_FAILED;
+    }
+
+    dom_models_error_t link_monitor_err = pres_task_wifiman_link_monitor_start(
+        launcher->presentation.wifiman_link_monitor_task
+    );
+    if (link_monitor_err != DOMAIN_MODELS_ERROR_OK) {
+        ESP_LOGE(tag, "Failed to start WiFiMan link monitor task: %s", dom_models_error_str(link_monitor_err));
+        cmp_main_presentation_deinit(launcher);
+        return link_monitor_err;
+    }
+
+    init_wifiman_link_monitor_task = true;
+    ESP_LOGI(tag, "WiFiMan link monitor task started");
+#endif /* WiFiMan link monitor task dependencies */
+
+#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_WIFIMAN_LINK_MONITOR_ENABLE */
+
+    /* Log Shipping Task */
+
+#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_LOG_SHIPPING_ENABLE
+
+#if !defined(COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_LOGGER_LEVELED_ENABLE) || \
+    !defined(COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_MESSAGING_PUBLISH_ENABLE)
+    ESP_LOGE(tag, "Log shipping task dependencies are disabled");
+    cmp_main_presentation_deinit(launcher);
+    return DOMAIN_MODELS_ERROR_BAD_STATE;
+#else
+    if (!launcher->infrastructure.logger || !launcher->infrastructure.messaging_publish) {
+        ESP_LOGE(tag, "Log shipping task dependencies are not initialized");
+        cmp_main_presentation_deinit(launcher);
+        return DOMAIN_MODELS_ERROR_BAD_STATE;
+    }
+
+    pres_task_log_shipping_cfg_t log_shipping_task_cfg = {
+        .logger          = launcher->infrastructure.logger,
+        .publish         = launcher->infrastructure.messaging_publish,
+        .level           = cmp_main_config.presentation.log_shipping_task_level,
+        .task_name       = cmp_main_config.presentation.log_shipping_task_name,
+        .stack_size      = cmp_main_config.presentation.log_shipping_task_stack_size,
+        .priority        = (UBaseType_t)cmp_main_config.presentation.log_shipping_task_priority,
+        .batch_max_bytes = cmp_main_config.presentation.log_shipping_task_batch_max_bytes,
+        .batch_max_cnt   = cmp_main_config.presentation.log_shipping_task_batch_max_count,
+        .line_max_len    = cmp_main_config.presentation.log_shipping_task_line_max_len,
+        .max_latency_ms  = cmp_main_config.presentation.log_shipping_task_max_latency_ms,
+        .binary          = cmp_main_config.presentation.log_shipping_task_binary,
+    };
+    launcher->presentation.log_shipping_task = pres_task_log_shipping_new(&log_shipping_task_cfg);
+    if (!launcher->presentation.log_shipping_task) {
+        ESP_LOGE(tag, "Failed to create log shipping task");
+        cmp_main_presentation_deinit(launcher);
+        return DOMAIN_MODELS_ERROR_MALLOC_FAILED;
+    }
+
+    dom_models_error_t log_shipping_err = pres_task_log_shipping_start(launcher->presentation.log_shipping_task);
+    if (log_shipping_err != DOMAIN_MODELS_ERROR_OK) {
+        ESP_LOGE(tag, "Failed to start log shipping task: %s", dom_models_error_str(log_shipping_err));
+        cmp_main_presentation_deinit(launcher);
+        return log_shipping_err;
+    }
+
+    init_log_shipping_task = true;
+    ESP_LOGI(tag, "Log shipping task started");
+#endif /* Log shipping task dependencies */
+
+#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_LOG_SHIPPING_ENABLE */
+
+    /* Status Publish Task */
+
+#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_STATUS_PUBLISH_ENABLE
+
+#if !defined(COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_MESSAGING_PUBLISH_ENABLE)
+    ESP_LOGE(tag, "Status publish task dependencies are disabled");
+    cmp_main_presentation_deinit(launcher);
+    return DOMAIN_MODELS_ERROR_BAD_STATE;
+#else
+    if (!launcher->infrastructure.messaging_publish) {
+        ESP_LOGE(tag, "Status publish task dependencies are not initialized");
+        cmp_main_presentation_deinit(launcher);
+        return DOMAIN_MODELS_ERROR_BAD_STATE;
+    }
+
+    pres_task_status_publish_cfg_t status_publish_task_cfg = {
+        .publish            = launcher->infrastructure.messaging_publish,
+        .task_name          = cmp_main_config.presentation.status_publish_task_name,
+        .stack_size         = cmp_main_config.presentation.status_publish_task_stack_size,
+        .priority           = (UBaseType_t)cmp_main_config.presentation.status_publish_task_priority,
+        .sample_interval_ms = cmp_main_config.presentation.status_publish_task_sample_interval_ms,
+        .debounce_ms        = cmp_main_config.presentation.status_publish_task_debounce_ms,
+        .heartbeat_ms       = cmp_main_config.presentation.status_publish_task_heartbeat_ms,
+    };
+#ifdef COMPOSITION_MAIN_CONFIG_APPLICATION_WIFIMAN_ENABLE
+    status_publish_task_cfg.wifiman = launcher->application.wifiman;
+#endif /* COMPOSITION_MAIN_CONFIG_APPLICATION_WIFIMAN_ENABLE */
+#ifdef COMPOSITION_MAIN_CONFIG_APPLICATION_NETIF_ENABLE
+    status_publish_task_cfg.netif = launcher->application.netif;
+#endif /* COMPOSITION_MAIN_CONFIG_APPLICATION_NETIF_ENABLE */
+#ifdef COMPOSITION_MAIN_CONFIG_APPLICATION_OTA_ENABLE
+    status_publish_task_cfg.ota = launcher->application.ota;
+#endif /* COMPOSITION_MAIN_CONFIG_APPLICATION_OTA_ENABLE */
+
+    launcher->presentation.status_publish_task = pres_task_status_publish_new(&status_publish_task_cfg);
+    if (!launcher->presentation.status_publish_task) {
+        ESP_LOGE(tag, "Failed to create status publish task");
+        cmp_main_presentation_deinit(launcher);
+        return DOMAIN_MODELS_ERROR_MALLOC_FAILED;
+    }
+
+    dom_models_error_t status_publish_err = pres_task_status_publish_start(launcher->presentation.status_publish_task);
+    if (status_publish_err != DOMAIN_MODELS_ERROR_OK) {
+        ESP_LOGE(tag, "Failed to start status publish task: %s", dom_models_error_str(status_publish_err));
+        cmp_main_presentation_deinit(launcher);
+        return status_publish_err;
+    }
+
+    init_status_publish_task = true;
+    ESP_LOGI(tag, "Status publish task started");
+#endif /* Status publish task dependencies */
+
+#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_STATUS_PUBLISH_ENABLE */
+
     /* MQTT Presentation */
 
 #ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_MQTT_ENABLE
@@ -202,11 +613,22 @@ dom_models_error_t cmp_main_presentation_init(cmp_main_launcher_t* launcher) {
         return DOMAIN_MODELS_ERROR_BAD_STATE;
     }
 
+    dom_usecases_wifiman_t* mqtt_wifiman = NULL;
+    dom_usecases_netif_t*   mqtt_netif   = NULL;
+#ifdef COMPOSITION_MAIN_CONFIG_APPLICATION_WIFIMAN_ENABLE
+    mqtt_wifiman = launcher->application.wifiman;
+#endif
+#ifdef COMPOSITION_MAIN_CONFIG_APPLICATION_NETIF_ENABLE
+    mqtt_netif = launcher->application.netif;
+#endif
+
     launcher->presentation.mqtt_context = pres_mqtt_context_new(
         launcher->infrastructure.logger,
         launcher->infrastructure.preloaded_repository,
         launcher->application.settings,
-        launcher->application.ota
+        launcher->application.ota,
+        mqtt_wifiman,
+        mqtt_netif
     );
     if (!launcher->presentation.mqtt_context) {
         ESP_LOGE(tag, "Failed to create MQTT context");
@@ -214,6 +636,11 @@ dom_models_error_t cmp_main_presentation_init(cmp_main_launcher_t* launcher) {
         return DOMAIN_MODELS_ERROR_MALLOC_FAILED;
     }
 
+#ifdef COMPOSITION_MAIN_CONFIG_DRIVER_HTTP_SERVER_ENABLE
+    launcher->presentation.mqtt_context->network_etag  = &launcher->presentation.network_etag;
+    launcher->presentation.mqtt_context->settings_etag = &launcher->presentation.settings_etag;
+#endif /* COMPOSITION_MAIN_CONFIG_DRIVER_HTTP_SERVER_ENABLE */
+
     esp_err_t mqtt_handler_err = esp_mqtt_client_register_event(
         launcher->driver.mqtt_client_handle,
         ESP_EVENT_ANY_ID,
@@ -259,7 +686,62 @@ void cmp_main_presentation_deinit(cmp_main_launcher_t* launcher) {
     }
 #endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_MQTT_ENABLE */
 
+#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_STATUS_PUBLISH_ENABLE
+    if (init_status_publish_task) {
+        dom_models_error_t err = pres_task_status_publish_stop(launcher->presentation.status_publish_task);
+        if (err != DOMAIN_MODELS_ERROR_OK) {
+            ESP_LOGE(tag, "Failed to stop status publish task: %s", dom_models_error_str(err));
+        }
+        init_status_publish_task = false;
+    }
+    if (launcher->presentation.status_publish_task) {
+        pres_task_status_publish_delete(launcher->presentation.status_publish_task);
+        launcher->presentation.status_publish_task = NULL;
+    }
+#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_STATUS_PUBLISH_ENABLE */
+
+#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_LOG_SHIPPING_ENABLE
+    if (init_log_shipping_task) {
+        dom_models_error_t err = pres_task_log_shipping_stop(launcher->presentation.log_shipping_task);
+        if (err != DOMAIN_MODELS_ERROR_OK) {
+            ESP_LOGE(tag, "Failed to stop log shipping task: %s", dom_models_error_str(err));
+        }
+        init_log_shipping_task = false;
+    }
+    if (launcher->presentation.log_shipping_task) {
+        pres_task_log_shipping_delete(launcher->presentation.log_shipping_task);
+        launcher->presentation.log_shipping_task = NULL;
+    }
+#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_LOG_SHIPPING_ENABLE */
+
+#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_WIFIMAN_LINK_MONITOR_ENABLE
+    if (init_wifiman_link_monitor_task) {
+        dom_models_error_t err = pres_task_wifiman_link_monitor_stop(
+            launcher->presentation.wifiman_link_monitor_task
+        );
+        if (err != DOMAIN_MODELS_ERROR_OK) {
+            ESP_LOGE(tag, "Failed to stop WiFiMan link monitor task: %s", dom_models_error_str(err));
+        }
+        init_wifiman_link_monitor_task = false;
+    }
+    if (launcher->presentation.wifiman_link_monitor_task) {
+        pres_task_wifiman_link_monitor_delete(launcher->presentation.wifiman_link_monitor_task);
+        launcher->presentation.wifiman_link_monitor_task = NULL;
+    }
+#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_WIFIMAN_LINK_MONITOR_ENABLE */
+
 #ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_WIFIMAN_STA_RECONNECT_ENABLE
+#ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_DEVICE_WIFI_ENABLE
+    if (init_wifiman_sta_reconnect_wifi_callback) {
+        if (launcher->infrastructure.wifi) {
+            (void)launcher->infrastructure.wifi->remove_event_callback(
+                launcher->infrastructure.wifi,
+                pres_task_wifiman_sta_reconnect_on_wifi_event
+            );
+        }
+        init_wifiman_sta_reconnect_wifi_callback = false;
+    }
+#endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_DEVICE_WIFI_ENABLE */
     if (init_wifiman_sta_reconnect_task) {
         dom_models_error_t err = pres_task_wifiman_sta_reconnect_stop(
             launcher->presentation.wifiman_sta_reconnect_task
@@ -275,6 +757,78 @@ void cmp_main_presentation_deinit(cmp_main_launcher_t* launcher) {
     }
 #endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_TASK_WIFIMAN_STA_RECONNECT_ENABLE */
 
+#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_ASSETS_ENABLE
+    if (init_assets_http_routes) {
+#ifdef COMPOSITION_MAIN_CONFIG_DRIVER_HTTP_SERVER_ENABLE
+        esp_err_t err = pres_http_route_assets_unregister(launcher->driver.http_server_handle);
+        if (err != ESP_OK) {
+            ESP_LOGE(tag, "Failed to unregister Assets HTTP routes: %s", esp_err_to_name(err));
+        }
+#endif /* COMPOSITION_MAIN_CONFIG_DRIVER_HTTP_SERVER_ENABLE */
+        launcher->presentation.assets_http_handler.base_path = NULL;
+        init_assets_http_routes                              = false;
+    }
+#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_ASSETS_ENABLE */
+
+#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_METRICS_ENABLE
+    if (init_metrics_http_routes) {
+#ifdef COMPOSITION_MAIN_CONFIG_DRIVER_HTTP_SERVER_ENABLE
+        esp_err_t err = pres_http_route_metrics_unregister(launcher->driver.http_server_handle);
+        if (err != ESP_OK) {
+            ESP_LOGE(tag, "Failed to unregister Metrics HTTP routes: %s", esp_err_to_name(err));
+        }
+#endif /* COMPOSITION_MAIN_CONFIG_DRIVER_HTTP_SERVER_ENABLE */
+        launcher->presentation.metrics_http_handler.metrics = NULL;
+        init_metrics_http_routes                            = false;
+    }
+#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_METRICS_ENABLE */
+
+#ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_EVENTS_ENABLE
+    if (init_events_http_routes) {
+#ifdef COMPOSITION_MAIN_CONFIG_DRIVER_HTTP_SERVER_ENABLE
+        esp_err_t err = pres_http_route_events_unregister(launcher->driver.http_server_handle);
+        if (err != ESP_OK) {
+            ESP_LOGE(tag, "Failed to unregister Events HTTP routes: %s", esp_err_to_name(err));
+        }
+#endif /* COMPOSITION_MAIN_CONFIG_DRIVER_HTTP_SERVER_ENABLE */
+        launcher->presentation.events_http_handler.stream = NULL;
+        init_events_http_routes                           = false;
+    }
+#ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_DEVICE_ETHERNET_ENABLE
+    if (init_event_stream_ethernet_callback) {
+        if (launcher->infrastructure.ethernet) {
+            (void)launcher->infrastructure.ethernet->remove_event_callback(
+                launcher->infrastructure.ethernet,
+                pres_task_event_stream_on_ethernet_event
+            );
+        }
+        init_event_stream_ethernet_callback = false;
+    }
+#endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_DEVICE_ETHERNET_ENABLE */
+#ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_DEVICE_WIFI_ENABLE
+    if (init_event_stream_wifi_callback) {
+        if (launcher->infrastructure.wifi) {
+            (void)launcher->infrastructure.wifi->remove_event_callback(
+                launcher->infrastructure.wifi,
+                pres_task_event_stream_on_wifi_event
+            );
+        }
+        init_event_stream_wifi_callback = false;
+    }
+#endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_DEVICE_WIFI_ENABLE */
+    if (init_event_stream_task) {
+        dom_models_error_t err = pres_task_event_stream_stop(launcher->presentation.event_stream_task);
+        if (err != DOMAIN_MODELS_ERROR_OK) {
+            ESP_LOGE(tag, "Failed to stop event stream task: %s", dom_models_error_str(err));
+        }
+        init_event_stream_task = false;
+    }
+    if (launcher->presentation.event_stream_task) {
+        pres_task_event_stream_delete(launcher->presentation.event_stream_task);
+        launcher->presentation.event_stream_task = NULL;
+    }
+#endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_EVENTS_ENABLE */
+
 #ifdef COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_WIFIMAN_ENABLE
     if (init_wifiman_http_routes) {
 #ifdef COMPOSITION_MAIN_CONFIG_DRIVER_HTTP_SERVER_ENABLE
@@ -284,6 +838,7 @@ void cmp_main_presentation_deinit(cmp_main_launcher_t* launcher) {
         }
 #endif /* COMPOSITION_MAIN_CONFIG_DRIVER_HTTP_SERVER_ENABLE */
         launcher->presentation.wifiman_http_handler.wifiman = NULL;
+        launcher->presentation.wifiman_http_handler.etag    = NULL;
         init_wifiman_http_routes                            = false;
     }
 #endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_WIFIMAN_ENABLE */
@@ -297,6 +852,7 @@ void cmp_main_presentation_deinit(cmp_main_launcher_t* launcher) {
         }
 #endif /* COMPOSITION_MAIN_CONFIG_DRIVER_HTTP_SERVER_ENABLE */
         launcher->presentation.settings_http_handler.settings = NULL;
+        launcher->presentation.settings_http_handler.etag     = NULL;
         init_settings_http_routes                             = false;
     }
 #endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_SETTINGS_ENABLE */
@@ -310,7 +866,34 @@ void cmp_main_presentation_deinit(cmp_main_launcher_t* launcher) {
         }
 #endif /* COMPOSITION_MAIN_CONFIG_DRIVER_HTTP_SERVER_ENABLE */
         launcher->presentation.netif_http_handler.netif = NULL;
+        launcher->presentation.netif_http_handler.etag  = NULL;
         init_netif_http_routes                          = false;
     }
 #endif /* COMPOSITION_MAIN_CONFIG_PRESENTATION_HTTP_NETIF_ENABLE */
+
+#ifdef COMPOSITION_MAIN_CONFIG_DRIVER_HTTP_SERVER_ENABLE
+#ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_DEVICE_ETHERNET_ENABLE
+    if (init_http_etag_ethernet_callback) {
+        if (launcher->infrastructure.ethernet) {
+            (void)launcher->infrastructure.ethernet->remove_event_callback(
+                launcher->infrastructure.ethernet,
+                pres_http_etag_on_ethernet_event
+            );
+        }
+        init_http_etag_ethernet_callback = false;
+    }
+#endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_DEVICE_ETHERNET_ENABLE */
+
+#ifdef COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_DEVICE_WIFI_ENABLE
+    if (init_http_etag_wifi_callback) {
+        if (launcher->infrastructure.wifi) {
+            (void)launcher->infrastructure.wifi->remove_event_callback(
+                launcher->infrastructure.wifi,
+                pres_http_etag_on_wifi_event
+            );
+        }
+        init_http_etag_wifi_callback = false;
+    }
+#endif /* COMPOSITION_MAIN_CONFIG_INFRASTRUCTURE_DEVICE_WIFI_ENABLE */
+#endif /* COMPOSITION_MAIN_CONFIG_DRIVER_HTTP_SERVER_ENABLE */
 }
@@ -1,5 +1,7 @@
 #include "infrastructure/device/wifi/esp_wifi_impl.h"
 
+#include <stdatomic.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
@@ -9,17 +11,25 @@
 #include "domain/models/wifi.h"
 #include "esp_err.h"
 #include "esp_event.h"
+#include "esp_netif.h"
 #include "esp_wifi.h"
+#include "freertos/FreeRTOS.h"  // IWYU pragma: keep
+#include "freertos/semphr.h"
 #include "infrastructure/device/wifi/esp_wifi_impl_utils.h"
 
 /* Event Handler Function Prototypes */
 
 static void wifi_event_handler(void* arg, esp_event_base_t base, int32_t id, void* data);
+static void ip_event_handler(void* arg, esp_event_base_t base, int32_t id, void* data);
 static void on_scan_done(inf_device_wifi_esp_wifi_impl_ctx_t* ctx, const wifi_event_sta_scan_done_t* event);
-static void on_sta_connected(inf_device_wifi_esp_wifi_impl_ctx_t* ctx);
+static void on_sta_connected(inf_device_wifi_esp_wifi_impl_ctx_t* ctx, const wifi_event_sta_connected_t* event);
 static void on_sta_disconnected(inf_device_wifi_esp_wifi_impl_ctx_t* ctx, const wifi_event_sta_disconnected_t* event);
 static void on_ap_start(inf_device_wifi_esp_wifi_impl_ctx_t* ctx);
 static void on_ap_stop(inf_device_wifi_esp_wifi_impl_ctx_t* ctx);
+static void on_ap_sta_connected(inf_device_wifi_esp_wifi_impl_ctx_t* ctx, const wifi_event_ap_staconnected_t* event);
+static void on_ap_sta_disconnected(inf_device_wifi_esp_wifi_impl_ctx_t* ctx, const wifi_event_ap_stadisconnected_t* event);
+static void on_sta_got_ip(inf_device_wifi_esp_wifi_impl_ctx_t* ctx, const ip_event_got_ip_t* event);
+static void on_sta_lost_ip(inf_device_wifi_esp_wifi_impl_ctx_t* ctx);
 
 /* Helper Function Prototypes */
 
@@ -28,6 +38,20 @@ static void dispatch_event(
     dom_models_wifi_event_type_t         type,
     uint32_t                             driver_status
 );
+static esp_err_t refresh_snapshot(
+    inf_device_wifi_esp_wifi_impl_ctx_t* ctx,
+    dom_models_wifi_status_t*            out
+);
+static void sync_mode(
+    inf_device_wifi_esp_wifi_impl_ctx_t* ctx
+);
+static void reset_snapshot(
+    inf_device_wifi_esp_wifi_impl_ctx_t* ctx
+);
+static void reset_scanned(
+    inf_device_wifi_esp_wifi_impl_ctx_t* ctx,
+    dom_models_wifi_scan_status_t        status
+);
 
 /* Contract Function Prototypes */
 
@@ -45,6 +69,10 @@ static dom_models_error_t get_status_impl(
     dom_contracts_device_wifi_t* self,
     dom_models_wifi_status_t*    out
 );
+static dom_models_error_t refresh_status_impl(
+    dom_contracts_device_wifi_t* self,
+    dom_models_wifi_status_t*    out
+);
 static dom_models_error_t connect_sta_impl(
     dom_contracts_device_wifi_t*                self,
     const dom_models_wifi_sta_connect_config_t* config
@@ -65,7 +93,11 @@ static dom_models_error_t start_scan_impl(
 );
 static dom_models_error_t get_scanned_impl(
     dom_contracts_device_wifi_t*   self,
-    dom_models_wifi_scan_result_t* out
+    dom_models_wifi_scan_result_t* out,
+    size_t                         offset,
+    dom_models_wifi_ap_record_t*   records,
+    size_t                         records_cap,
+    size_t*                        records_cnt
 );
 static dom_models_error_t add_event_callback_impl(
     dom_contracts_device_wifi_t*     self,
@@ -92,10 +124,42 @@ dom_contracts_device_wifi_t* inf_device_wifi_esp_wifi_impl_new(const inf_device_
         memcpy(&ctx->cfg, cfg, sizeof(inf_device_wifi_esp_wifi_impl_cfg_t));
     }
 
+    if (ctx->cfg.scan_record_max == 0) {
+        ctx->cfg.scan_record_max = DOM_MODELS_WIFI_SCAN_RECORD_MAX;
+    }
+
+    ctx->scan_records = (dom_models_wifi_ap_record_t*)calloc(ctx->cfg.scan_record_max, sizeof(dom_models_wifi_ap_record_t));
+    if (!ctx->scan_records) {
+        free(ctx);
+        return NULL;
+    }
+
+    ctx->status_lock = xSemaphoreCreateMutex();
+    if (!ctx->status_lock) {
+        free(ctx->scan_records);
+        free(ctx);
+        return NULL;
+    }
+
+    ctx->scan_lock = xSemaphoreCreateMutex();
+    if (!ctx->scan_lock) {
+        vSemaphoreDelete(ctx->status_lock);
+        free(ctx->scan_records);
+        free(ctx);
+        return NULL;
+    }
+
+    atomic_init(&ctx->status_seq, 0);
+    inf_device_wifi_esp_wifi_impl_copy_if_key(&ctx->status.sta_if_key_available, ctx->status.sta_if_key, sizeof(ctx->status.sta_if_key), ctx->cfg.sta_if_key);
+    inf_device_wifi_esp_wifi_impl_copy_if_key(&ctx->status.ap_if_key_available, ctx->status.ap_if_key, sizeof(ctx->status.ap_if_key), ctx->cfg.ap_if_key);
+
     ctx->scanned.status = DOM_MODELS_WIFI_SCAN_STATUS_IDLE;
 
     dom_contracts_device_wifi_t* self = dom_contracts_device_wifi_new(ctx);
     if (!self) {
+        vSemaphoreDelete(ctx->scan_lock);
+        vSemaphoreDelete(ctx->status_lock);
+        free(ctx->scan_records);
         free(ctx);
         return NULL;
     }
@@ -104,6 +168,7 @@ dom_contracts_device_wifi_t* inf_device_wifi_esp_wifi_impl_new(const inf_device_
     self->stop                  = stop_impl;
     self->set_mode              = set_mode_impl;
     self->get_status            = get_status_impl;
+    self->refresh_status        = refresh_status_impl;
     self->connect_sta           = connect_sta_impl;
     self->disconnect_sta        = disconnect_sta_impl;
     self->start_ap              = start_ap_impl;
@@ -124,6 +189,9 @@ void inf_device_wifi_esp_wifi_impl_delete(dom_contracts_device_wifi_t* self) {
     inf_device_wifi_esp_wifi_impl_ctx_t* ctx = self->ctx;
     if (ctx) {
         (void)inf_device_wifi_esp_wifi_impl_deinit(self);
+        vSemaphoreDelete(ctx->scan_lock);
+        vSemaphoreDelete(ctx->status_lock);
+        free(ctx->scan_records);
         free(ctx);
     }
 
@@ -155,6 +223,38 @@ dom_models_error_t inf_device_wifi_esp_wifi_impl_init(dom_contracts_device_wifi_
         ctx->wifi_event_handler_registered = true;
     }
 
+    if (ctx->cfg.register_ip_event_handler) {
+        esp_err_t err = esp_event_handler_instance_register(
+            IP_EVENT,
+            IP_EVENT_STA_GOT_IP,
+            ip_event_handler,
+            ctx,
+            &ctx->ip_got_event_handler
+        );
+        if (err != ESP_OK) {
+            (void)inf_device_wifi_esp_wifi_impl_deinit(self);
+            return inf_device_wifi_esp_wifi_impl_error_from_esp(err);
+        }
+        ctx->ip_got_event_handler_registered = true;
+
+        err = esp_event_handler_instance_register(
+            IP_EVENT,
+            IP_EVENT_STA_LOST_IP,
+            ip_event_handler,
+            ctx,
+            &ctx->ip_lost_event_handler
+        );
+        if (err != ESP_OK) {
+            (void)inf_device_wifi_esp_wifi_impl_deinit(self);
+            return inf_device_wifi_esp_wifi_impl_error_from_esp(err);
+        }
+        ctx->ip_lost_event_handler_registered = true;
+    }
+
+    /* Seeds the snapshot the events keep up to date from here on */
+    dom_models_wifi_status_t status;
+    (void)refresh_snapshot(ctx, &status);
+
     ctx->initialized = true;
 
     return DOMAIN_MODELS_ERROR_OK;
@@ -175,6 +275,30 @@ dom_models_error_t inf_device_wifi_esp_wifi_impl_deinit(dom_contracts_device_wif
         }
     }
 
+    if (ctx->ip_lost_event_handler_registered) {
+        esp_err_t err = esp_event_handler_instance_unregister(IP_EVENT, IP_EVENT_STA_LOST_IP, ctx->ip_lost_event_handler);
+        if (err != ESP_OK) {
+            if (result == DOMAIN_MODELS_ERROR_OK) {
+                result = inf_device_wifi_esp_wifi_impl_error_from_esp(err);
+            }
+        } else {
+            ctx->ip_lost_event_handler_registered = false;
+            ctx->ip_lost_event_handler            = NULL;
+        }
+    }
+
+    if (ctx->ip_got_event_handler_registered) {
+        esp_err_t err = esp_event_handler_instance_unregister(IP_EVENT, IP_EVENT_STA_GOT_IP, ctx->ip_got_event_handler);
+        if (err != ESP_OK) {
+            if (result == DOMAIN_MODELS_ERROR_OK) {
+                result = inf_device_wifi_esp_wifi_impl_error_from_esp(err);
+            }
+        } else {
+            ctx->ip_got_event_handler_registered = false;
+            ctx->ip_got_event_handler            = NULL;
+        }
+    }
+
     if (ctx->wifi_event_handler_registered) {
         esp_err_t err = esp_event_handler_instance_unregister(WIFI_EVENT, ESP_EVENT_ANY_ID, ctx->wifi_event_handler);
         if (err != ESP_OK) {
@@ -187,12 +311,11 @@ dom_models_error_t inf_device_wifi_esp_wifi_impl_deinit(dom_contracts_device_wif
         }
     }
 
-    ctx->initialized   = false;
-    ctx->started       = false;
-    ctx->sta_connected = false;
-    ctx->ap_started    = false;
-    memset(&ctx->scanned, 0, sizeof(dom_models_wifi_scan_result_t));
-    ctx->scanned.status = DOM_MODELS_WIFI_SCAN_STATUS_IDLE;
+    ctx->initialized = false;
+    ctx->started     = false;
+    ctx->ap_started  = false;
+    reset_snapshot(ctx);
+    reset_scanned(ctx, DOM_MODELS_WIFI_SCAN_STATUS_IDLE);
 
     return result;
 }
@@ -215,6 +338,10 @@ static dom_models_error_t start_impl(
 
     ctx->started = true;
 
+    /* MACs are only readable once the driver runs */
+    dom_models_wifi_status_t status;
+    (void)refresh_snapshot(ctx, &status);
+
     return DOMAIN_MODELS_ERROR_OK;
 }
 
@@ -232,11 +359,10 @@ static dom_models_error_t stop_impl(
         return inf_device_wifi_esp_wifi_impl_error_from_esp(err);
     }
 
-    ctx->started       = false;
-    ctx->sta_connected = false;
-    ctx->ap_started    = false;
-    memset(&ctx->scanned, 0, sizeof(dom_models_wifi_scan_result_t));
-    ctx->scanned.status = DOM_MODELS_WIFI_SCAN_STATUS_IDLE;
+    ctx->started    = false;
+    ctx->ap_started = false;
+    reset_snapshot(ctx);
+    reset_scanned(ctx, DOM_MODELS_WIFI_SCAN_STATUS_IDLE);
 
     return DOMAIN_MODELS_ERROR_OK;
 }
@@ -259,6 +385,11 @@ static dom_models_error_t set_mode_impl(
         return inf_device_wifi_esp_wifi_impl_error_from_esp(err);
     }
 
+    inf_device_wifi_esp_wifi_impl_ctx_t* ctx = self->ctx;
+    inf_device_wifi_esp_wifi_impl_status_write_begin(ctx);
+    ctx->status.mode = mode;
+    inf_device_wifi_esp_wifi_impl_status_write_end(ctx);
+
     return DOMAIN_MODELS_ERROR_OK;
 }
 
@@ -270,56 +401,22 @@ static dom_models_error_t get_status_impl(
         return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
-    inf_device_wifi_esp_wifi_impl_ctx_t* ctx = self->ctx;
-
-    memset(out, 0, sizeof(dom_models_wifi_status_t));
-
-    wifi_mode_t mode;
-    esp_err_t   err = esp_wifi_get_mode(&mode);
-    if (err != ESP_OK) {
-        return inf_device_wifi_esp_wifi_impl_error_from_esp(err);
-    }
-
-    out->mode      = inf_device_wifi_esp_wifi_impl_wifi_mode_to_domain(mode);
-    out->started   = ctx->started;
-    out->connected = ctx->sta_connected;
-
-    inf_device_wifi_esp_wifi_impl_copy_if_key(&out->sta_if_key_available, out->sta_if_key, sizeof(out->sta_if_key), ctx->cfg.sta_if_key);
-    inf_device_wifi_esp_wifi_impl_copy_if_key(&out->ap_if_key_available, out->ap_if_key, sizeof(out->ap_if_key), ctx->cfg.ap_if_key);
+    inf_device_wifi_esp_wifi_impl_status_read(self->ctx, out);
 
-    err = esp_wifi_get_mac(WIFI_IF_STA, out->sta_mac);
-    if (err == ESP_OK) {
-        out->sta_mac_available = true;
-    }
+    return DOMAIN_MODELS_ERROR_OK;
+}
 
-    err = esp_wifi_get_mac(WIFI_IF_AP, out->ap_mac);
-    if (err == ESP_OK) {
-        out->ap_mac_available = true;
+static dom_models_error_t refresh_status_impl(
+    dom_contracts_device_wifi_t* self,
+    dom_models_wifi_status_t*    out
+) {
+    if (!self || !self->ctx || !out) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
-    wifi_ap_record_t ap_record;
-    memset(&ap_record, 0, sizeof(wifi_ap_record_t));
-    err = esp_wifi_sta_get_ap_info(&ap_record);
-    if (err == ESP_OK) {
-        out->connected              = true;
-        out->connected_ap_available = true;
-        inf_device_wifi_esp_wifi_impl_copy_ap_record(&out->connected_ap, &ap_record);
-    }
-
-    wifi_sta_list_t sta_list;
-    memset(&sta_list, 0, sizeof(wifi_sta_list_t));
-    err = esp_wifi_ap_get_sta_list(&sta_list);
-    if (err == ESP_OK) {
-        out->ap_client_total_count = (size_t)sta_list.num;
-        out->ap_client_count       = (size_t)sta_list.num;
-        if (out->ap_client_count > DOM_MODELS_WIFI_AP_CLIENT_MAX) {
-            out->ap_client_count      = DOM_MODELS_WIFI_AP_CLIENT_MAX;
-            out->ap_clients_truncated = true;
-        }
-
-        for (size_t i = 0; i < out->ap_client_count; i++) {
-            inf_device_wifi_esp_wifi_impl_copy_ap_client(&out->ap_clients[i], &sta_list.sta[i]);
-        }
+    esp_err_t err = refresh_snapshot(self->ctx, out);
+    if (err != ESP_OK) {
+        return inf_device_wifi_esp_wifi_impl_error_from_esp(err);
     }
 
     return DOMAIN_MODELS_ERROR_OK;
@@ -344,6 +441,7 @@ static dom_models_error_t connect_sta_impl(
     if (err != ESP_OK) {
         return inf_device_wifi_esp_wifi_impl_error_from_esp(err);
     }
+    sync_mode(self->ctx);
 
     wifi_config_t wifi_config;
     memset(&wifi_config, 0, sizeof(wifi_config_t));
@@ -357,6 +455,13 @@ static dom_models_error_t connect_sta_impl(
     if (config->channel_set) {
         wifi_config.sta.channel = config->channel;
     }
+    if (config->auth_mode_set) {
+        /* A minimum, an AP that upgraded its security is still joined */
+        wifi_auth_mode_t auth_mode;
+        if (inf_device_wifi_esp_wifi_impl_wifi_auth_from_domain(config->auth_mode, &auth_mode)) {
+            wifi_config.sta.threshold.authmode = auth_mode;
+        }
+    }
 
     err = esp_wifi_set_config(WIFI_IF_STA, &wifi_config);
     if (err != ESP_OK) {
@@ -384,7 +489,9 @@ static dom_models_error_t disconnect_sta_impl(
     }
 
     inf_device_wifi_esp_wifi_impl_ctx_t* ctx = self->ctx;
-    ctx->sta_connected                       = false;
+    inf_device_wifi_esp_wifi_impl_status_write_begin(ctx);
+    inf_device_wifi_esp_wifi_impl_clear_sta_link(&ctx->status);
+    inf_device_wifi_esp_wifi_impl_status_write_end(ctx);
 
     return DOMAIN_MODELS_ERROR_OK;
 }
@@ -417,6 +524,7 @@ static dom_models_error_t start_ap_impl(
     if (err != ESP_OK) {
         return inf_device_wifi_esp_wifi_impl_error_from_esp(err);
     }
+    sync_mode(self->ctx);
 
     wifi_config_t wifi_config;
     memset(&wifi_config, 0, sizeof(wifi_config_t));
@@ -441,6 +549,10 @@ static dom_models_error_t start_ap_impl(
             return inf_device_wifi_esp_wifi_impl_error_from_esp(err);
         }
         ctx->started = true;
+
+        inf_device_wifi_esp_wifi_impl_status_write_begin(ctx);
+        ctx->status.started = true;
+        inf_device_wifi_esp_wifi_impl_status_write_end(ctx);
     }
 
     return DOMAIN_MODELS_ERROR_OK;
@@ -467,6 +579,11 @@ static dom_models_error_t stop_ap_impl(
             return inf_device_wifi_esp_wifi_impl_error_from_esp(err);
         }
         ctx->ap_started = false;
+
+        inf_device_wifi_esp_wifi_impl_status_write_begin(ctx);
+        ctx->status.mode = DOM_MODELS_WIFI_MODE_STA;
+        inf_device_wifi_esp_wifi_impl_clear_ap_clients(&ctx->status);
+        inf_device_wifi_esp_wifi_impl_status_write_end(ctx);
         return DOMAIN_MODELS_ERROR_OK;
     }
 
@@ -477,6 +594,7 @@ static dom_models_error_t stop_ap_impl(
         }
         ctx->started    = false;
         ctx->ap_started = false;
+        reset_snapshot(ctx);
     }
 
     return DOMAIN_MODELS_ERROR_OK;
@@ -492,8 +610,7 @@ static dom_models_error_t start_scan_impl(
 
     inf_device_wifi_esp_wifi_impl_ctx_t* ctx = self->ctx;
 
-    memset(&ctx->scanned, 0, sizeof(dom_models_wifi_scan_result_t));
-    ctx->scanned.status = DOM_MODELS_WIFI_SCAN_STATUS_RUNNING;
+    reset_scanned(ctx, DOM_MODELS_WIFI_SCAN_STATUS_RUNNING);
 
     wifi_scan_config_t scan_config;
     memset(&scan_config, 0, sizeof(wifi_scan_config_t));
@@ -527,8 +644,10 @@ static dom_models_error_t start_scan_impl(
 
     esp_err_t err = esp_wifi_scan_start(&scan_config, false);
     if (err != ESP_OK) {
+        xSemaphoreTake(ctx->scan_lock, portMAX_DELAY);
         ctx->scanned.status        = DOM_MODELS_WIFI_SCAN_STATUS_FAILED;
         ctx->scanned.driver_status = (uint32_t)err;
+        xSemaphoreGive(ctx->scan_lock);
         return inf_device_wifi_esp_wifi_impl_error_from_esp(err);
     }
 
@@ -537,15 +656,36 @@ static dom_models_error_t start_scan_impl(
 
 static dom_models_error_t get_scanned_impl(
     dom_contracts_device_wifi_t*   self,
-    dom_models_wifi_scan_result_t* out
+    dom_models_wifi_scan_result_t* out,
+    size_t                         offset,
+    dom_models_wifi_ap_record_t*   records,
+    size_t                         records_cap,
+    size_t*                        records_cnt
 ) {
-    if (!self || !self->ctx || !out) {
+    if (!self || !self->ctx || !out || (!records && records_cap > 0)) {
         return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
     inf_device_wifi_esp_wifi_impl_ctx_t* ctx = self->ctx;
+
+    /* SCAN_DONE rebuilds the pool on the event task, header and records are copied as one */
+    xSemaphoreTake(ctx->scan_lock, portMAX_DELAY);
     memcpy(out, &ctx->scanned, sizeof(dom_models_wifi_scan_result_t));
 
+    size_t copied = 0;
+    if (records && offset < ctx->scanned.count) {
+        copied = ctx->scanned.count - offset;
+        if (copied > records_cap) {
+            copied = records_cap;
+        }
+        memcpy(records, &ctx->scan_records[offset], copied * sizeof(dom_models_wifi_ap_record_t));
+    }
+    xSemaphoreGive(ctx->scan_lock);
+
+    if (records_cnt) {
+        *records_cnt = copied;
+    }
+
     return DOMAIN_MODELS_ERROR_OK;
 }
 
@@ -627,7 +767,7 @@ static void wifi_event_handler(void* arg, esp_event_base_t base, int32_t id, voi
             on_scan_done(ctx, (const wifi_event_sta_scan_done_t*)data);
             break;
         case WIFI_EVENT_STA_CONNECTED:
-            on_sta_connected(ctx);
+            on_sta_connected(ctx, (const wifi_event_sta_connected_t*)data);
             break;
         case WIFI_EVENT_STA_DISCONNECTED:
             on_sta_disconnected(ctx, (const wifi_event_sta_disconnected_t*)data);
@@ -638,6 +778,29 @@ static void wifi_event_handler(void* arg, esp_event_base_t base, int32_t id, voi
         case WIFI_EVENT_AP_STOP:
             on_ap_stop(ctx);
             break;
+        case WIFI_EVENT_AP_STACONNECTED:
+            on_ap_sta_connected(ctx, (const wifi_event_ap_staconnected_t*)data);
+            break;
+        case WIFI_EVENT_AP_STADISCONNECTED:
+            on_ap_sta_disconnected(ctx, (const wifi_event_ap_stadisconnected_t*)data);
+            break;
+        default:
+            break;
+    }
+}
+
+static void ip_event_handler(void* arg, esp_event_base_t base, int32_t id, void* data) {
+    if (!arg || base != IP_EVENT) {
+        return;
+    }
+
+    switch (id) {
+        case IP_EVENT_STA_GOT_IP:
+            on_sta_got_ip(arg, data);
+            break;
+        case IP_EVENT_STA_LOST_IP:
+            on_sta_lost_ip(arg);
+            break;
         default:
             break;
     }
@@ -648,33 +811,59 @@ static void on_scan_done(inf_device_wifi_esp_wifi_impl_ctx_t* ctx, const wifi_ev
         return;
     }
 
+    /* Released before dispatch, callbacks read the result back through get_scanned */
+    xSemaphoreTake(ctx->scan_lock, portMAX_DELAY);
     inf_device_wifi_esp_wifi_impl_clear_scan_records(&ctx->scanned);
 
     if (!event) {
         ctx->scanned.status        = DOM_MODELS_WIFI_SCAN_STATUS_FAILED;
         ctx->scanned.driver_status = 1;
-        return;
-    }
-
-    ctx->scanned.scan_id       = event->scan_id;
-    ctx->scanned.driver_status = event->status;
+    } else {
+        ctx->scanned.scan_id       = event->scan_id;
+        ctx->scanned.driver_status = event->status;
 
-    if (event->status != 0) {
-        ctx->scanned.status = DOM_MODELS_WIFI_SCAN_STATUS_FAILED;
-        return;
+        if (event->status != 0) {
+            ctx->scanned.status = DOM_MODELS_WIFI_SCAN_STATUS_FAILED;
+        } else {
+            ctx->scanned.status      = DOM_MODELS_WIFI_SCAN_STATUS_DONE;
+            ctx->scanned.total_count = event->number;
+            inf_device_wifi_esp_wifi_impl_load_scan_records(ctx);
+        }
     }
 
-    ctx->scanned.status      = DOM_MODELS_WIFI_SCAN_STATUS_DONE;
-    ctx->scanned.total_count = event->number;
-    inf_device_wifi_esp_wifi_impl_load_scan_records(ctx);
+    uint32_t driver_status = ctx->scanned.status == DOM_MODELS_WIFI_SCAN_STATUS_DONE ? 0 : ctx->scanned.driver_status;
+    xSemaphoreGive(ctx->scan_lock);
+
+    dispatch_event(ctx, DOM_MODELS_WIFI_EVENT_SCAN_DONE, driver_status);
 }
 
-static void on_sta_connected(inf_device_wifi_esp_wifi_impl_ctx_t* ctx) {
+static void on_sta_connected(inf_device_wifi_esp_wifi_impl_ctx_t* ctx, const wifi_event_sta_connected_t* event) {
     if (!ctx) {
         return;
     }
 
-    ctx->sta_connected = true;
+    /* One driver read per association gives the full record with its RSSI */
+    wifi_ap_record_t ap_record;
+    memset(&ap_record, 0, sizeof(wifi_ap_record_t));
+    bool ap_info = esp_wifi_sta_get_ap_info(&ap_record) == ESP_OK;
+
+    inf_device_wifi_esp_wifi_impl_status_write_begin(ctx);
+    ctx->status.connected = true;
+    if (ap_info) {
+        ctx->status.connected_ap_available = true;
+        inf_device_wifi_esp_wifi_impl_copy_ap_record(&ctx->status.connected_ap, &ap_record);
+    } else if (event) {
+        dom_models_wifi_ap_record_t* ap = &ctx->status.connected_ap;
+        memset(ap, 0, sizeof(dom_models_wifi_ap_record_t));
+        ctx->status.connected_ap_available = true;
+        ap->bssid_available                = true;
+        memcpy(ap->bssid, event->bssid, sizeof(ap->bssid));
+        inf_device_wifi_esp_wifi_impl_copy_bytes_to_cstr(ap->ssid, sizeof(ap->ssid), event->ssid, event->ssid_len);
+        ap->primary_channel = event->channel;
+        ap->auth_mode       = inf_device_wifi_esp_wifi_impl_wifi_auth_to_domain(event->authmode);
+    }
+    inf_device_wifi_esp_wifi_impl_status_write_end(ctx);
+
     dispatch_event(ctx, DOM_MODELS_WIFI_EVENT_STA_CONNECTED, 0);
 }
 
@@ -683,7 +872,10 @@ static void on_sta_disconnected(inf_device_wifi_esp_wifi_impl_ctx_t* ctx, const
         return;
     }
 
-    ctx->sta_connected = false;
+    inf_device_wifi_esp_wifi_impl_status_write_begin(ctx);
+    inf_device_wifi_esp_wifi_impl_clear_sta_link(&ctx->status);
+    inf_device_wifi_esp_wifi_impl_status_write_end(ctx);
+
     dispatch_event(ctx, DOM_MODELS_WIFI_EVENT_STA_DISCONNECTED, event ? (uint32_t)event->reason : 0);
 }
 
@@ -694,6 +886,12 @@ static void on_ap_start(inf_device_wifi_esp_wifi_impl_ctx_t* ctx) {
 
     ctx->ap_started = true;
     ctx->started    = true;
+
+    inf_device_wifi_esp_wifi_impl_status_write_begin(ctx);
+    ctx->status.started = true;
+    inf_device_wifi_esp_wifi_impl_clear_ap_clients(&ctx->status);
+    inf_device_wifi_esp_wifi_impl_status_write_end(ctx);
+
     dispatch_event(ctx, DOM_MODELS_WIFI_EVENT_AP_STARTED, 0);
 }
 
@@ -703,9 +901,50 @@ static void on_ap_stop(inf_device_wifi_esp_wifi_impl_ctx_t* ctx) {
     }
 
     ctx->ap_started = false;
+
+    inf_device_wifi_esp_wifi_impl_status_write_begin(ctx);
+    inf_device_wifi_esp_wifi_impl_clear_ap_clients(&ctx->status);
+    inf_device_wifi_esp_wifi_impl_status_write_end(ctx);
+
     dispatch_event(ctx, DOM_MODELS_WIFI_EVENT_AP_STOPPED, 0);
 }
 
+static void on_ap_sta_connected(inf_device_wifi_esp_wifi_impl_ctx_t* ctx, const wifi_event_ap_staconnected_t* event) {
+    if (!ctx || !event) {
+        return;
+    }
+
+    inf_device_wifi_esp_wifi_impl_status_write_begin(ctx);
+    inf_device_wifi_esp_wifi_impl_add_ap_client(&ctx->status, event->mac);
+    inf_device_wifi_esp_wifi_impl_status_write_end(ctx);
+}
+
+static void on_ap_sta_disconnected(inf_device_wifi_esp_wifi_impl_ctx_t* ctx, const wifi_event_ap_stadisconnected_t* event) {
+    if (!ctx || !event) {
+        return;
+    }
+
+    inf_device_wifi_esp_wifi_impl_status_write_begin(ctx);
+    inf_device_wifi_esp_wifi_impl_remove_ap_client(&ctx->status, event->mac);
+    inf_device_wifi_esp_wifi_impl_status_write_end(ctx);
+}
+
+static void on_sta_got_ip(inf_device_wifi_esp_wifi_impl_ctx_t* ctx, const ip_event_got_ip_t* event) {
+    if (!ctx) {
+        return;
+    }
+
+    dispatch_event(ctx, DOM_MODELS_WIFI_EVENT_STA_GOT_IP, event ? (uint32_t)event->ip_changed : 0);
+}
+
+static void on_sta_lost_ip(inf_device_wifi_esp_wifi_impl_ctx_t* ctx) {
+    if (!ctx) {
+        return;
+    }
+
+    dispatch_event(ctx, DOM_MODELS_WIFI_EVENT_STA_LOST_IP, 0);
+}
+
 /* Helper Function Implementations */
 
 static void dispatch_event(
@@ -731,3 +970,62 @@ static void dispatch_event(
         ctx->event_cb_funcs[i](ctx->event_cb_ctxs[i], &event);
     }
 }
+
+static esp_err_t refresh_snapshot(
+    inf_device_wifi_esp_wifi_impl_ctx_t* ctx,
+    dom_models_wifi_status_t*            out
+) {
+    uint_least32_t seq = atomic_load_explicit(&ctx->status_seq, memory_order_acquire);
+
+    esp_err_t err = inf_device_wifi_esp_wifi_impl_read_driver_status(ctx, out);
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    /* write_begin moves seq by one, anything more is an event that landed during the driver read */
+    inf_device_wifi_esp_wifi_impl_status_write_begin(ctx);
+    bool stale = atomic_load_explicit(&ctx->status_seq, memory_order_relaxed) != seq + 1;
+    if (!stale) {
+        memcpy(&ctx->status, out, sizeof(dom_models_wifi_status_t));
+    }
+    inf_device_wifi_esp_wifi_impl_status_write_end(ctx);
+
+    if (stale) {
+        inf_device_wifi_esp_wifi_impl_status_read(ctx, out);
+    }
+
+    return ESP_OK;
+}
+
+static void sync_mode(
+    inf_device_wifi_esp_wifi_impl_ctx_t* ctx
+) {
+    wifi_mode_t mode;
+    if (esp_wifi_get_mode(&mode) != ESP_OK) {
+        return;
+    }
+
+    inf_device_wifi_esp_wifi_impl_status_write_begin(ctx);
+    ctx->status.mode = inf_device_wifi_esp_wifi_impl_wifi_mode_to_domain(mode);
+    inf_device_wifi_esp_wifi_impl_status_write_end(ctx);
+}
+
+static void reset_snapshot(
+    inf_device_wifi_esp_wifi_impl_ctx_t* ctx
+) {
+    inf_device_wifi_esp_wifi_impl_status_write_begin(ctx);
+    ctx->status.started = false;
+    inf_device_wifi_esp_wifi_impl_clear_sta_link(&ctx->status);
+    inf_device_wifi_esp_wifi_impl_clear_ap_clients(&ctx->status);
+    inf_device_wifi_esp_wifi_impl_status_write_end(ctx);
+}
+
+static void reset_scanned(
+    inf_device_wifi_esp_wifi_impl_ctx_t* ctx,
+    dom_models_wifi_scan_status_t        status
+) {
+    xSemaphoreTake(ctx->scan_lock, portMAX_DELAY);
+    memset(&ctx->scanned, 0, sizeof(dom_models_wifi_scan_result_t));
+    ctx->scanned.status = status;
+    xSemaphoreGive(ctx->scan_lock);
+}
@@ -1,8 +1,11 @@
 #include "infrastructure/device/wifi/esp_wifi_impl_utils.h"
 
+#include <stdatomic.h>
 #include <string.h>
 
 #include "esp_wifi.h"
+#include "freertos/FreeRTOS.h"  // IWYU pragma: keep
+#include "freertos/semphr.h"
 
 dom_models_error_t inf_device_wifi_esp_wifi_impl_error_from_esp(esp_err_t err) {
     switch (err) {
@@ -459,9 +462,9 @@ void inf_device_wifi_esp_wifi_impl_clear_scan_records(dom_models_wifi_scan_resul
     out->total_count = 0;
     out->count       = 0;
     out->truncated   = false;
-    memset(out->records, 0, sizeof(out->records));
 }
 
+/* Called from on_scan_done with scan_lock held */
 void inf_device_wifi_esp_wifi_impl_load_scan_records(inf_device_wifi_esp_wifi_impl_ctx_t* ctx) {
     if (!ctx) {
         return;
@@ -473,34 +476,201 @@ void inf_device_wifi_esp_wifi_impl_load_scan_records(inf_device_wifi_esp_wifi_im
         ctx->scanned.status        = DOM_MODELS_WIFI_SCAN_STATUS_FAILED;
         ctx->scanned.driver_status = (uint32_t)err;
         inf_device_wifi_esp_wifi_impl_clear_scan_records(&ctx->scanned);
+        (void)esp_wifi_clear_ap_list();
         return;
     }
 
     ctx->scanned.total_count = total;
-    ctx->scanned.count       = total;
-    if (ctx->scanned.count > DOM_MODELS_WIFI_SCAN_RESULT_MAX) {
-        ctx->scanned.count     = DOM_MODELS_WIFI_SCAN_RESULT_MAX;
-        ctx->scanned.truncated = true;
+
+    /* Records are popped one at a time and placed by RSSI straight into the pool */
+    size_t           cap = ctx->cfg.scan_record_max;
+    wifi_ap_record_t record;
+    for (uint16_t i = 0; i < total; i++) {
+        memset(&record, 0, sizeof(wifi_ap_record_t));
+        if (esp_wifi_scan_get_ap_record(&record) != ESP_OK) {
+            break;
+        }
+
+        size_t pos = ctx->scanned.count;
+        while (pos > 0 && ctx->scan_records[pos - 1].rssi < record.rssi) {
+            pos--;
+        }
+        if (pos == cap) {
+            ctx->scanned.truncated = true;
+            continue;
+        }
+
+        size_t kept = ctx->scanned.count < cap ? ctx->scanned.count : cap - 1;
+        memmove(&ctx->scan_records[pos + 1], &ctx->scan_records[pos], (kept - pos) * sizeof(dom_models_wifi_ap_record_t));
+        inf_device_wifi_esp_wifi_impl_copy_ap_record(&ctx->scan_records[pos], &record);
+
+        if (ctx->scanned.count < cap) {
+            ctx->scanned.count++;
+        } else {
+            ctx->scanned.truncated = true;
+        }
+    }
+
+    (void)esp_wifi_clear_ap_list();
+}
+
+esp_err_t inf_device_wifi_esp_wifi_impl_read_driver_status(const inf_device_wifi_esp_wifi_impl_ctx_t* ctx, dom_models_wifi_status_t* out) {
+    if (!ctx || !out) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    memset(out, 0, sizeof(dom_models_wifi_status_t));
+
+    wifi_mode_t mode;
+    esp_err_t   err = esp_wifi_get_mode(&mode);
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    out->mode    = inf_device_wifi_esp_wifi_impl_wifi_mode_to_domain(mode);
+    out->started = ctx->started;
+
+    inf_device_wifi_esp_wifi_impl_copy_if_key(&out->sta_if_key_available, out->sta_if_key, sizeof(out->sta_if_key), ctx->cfg.sta_if_key);
+    inf_device_wifi_esp_wifi_impl_copy_if_key(&out->ap_if_key_available, out->ap_if_key, sizeof(out->ap_if_key), ctx->cfg.ap_if_key);
+
+    err = esp_wifi_get_mac(WIFI_IF_STA, out->sta_mac);
+    if (err == ESP_OK) {
+        out->sta_mac_available = true;
+    }
+
+    err = esp_wifi_get_mac(WIFI_IF_AP, out->ap_mac);
+    if (err == ESP_OK) {
+        out->ap_mac_available = true;
+    }
+
+    wifi_ap_record_t ap_record;
+    memset(&ap_record, 0, sizeof(wifi_ap_record_t));
+    err = esp_wifi_sta_get_ap_info(&ap_record);
+    if (err == ESP_OK) {
+        out->connected              = true;
+        out->connected_ap_available = true;
+        inf_device_wifi_esp_wifi_impl_copy_ap_record(&out->connected_ap, &ap_record);
+    }
+
+    wifi_sta_list_t sta_list;
+    memset(&sta_list, 0, sizeof(wifi_sta_list_t));
+    err = esp_wifi_ap_get_sta_list(&sta_list);
+    if (err == ESP_OK) {
+        out->ap_client_total_count = (size_t)sta_list.num;
+        out->ap_client_count       = (size_t)sta_list.num;
+        if (out->ap_client_count > DOM_MODELS_WIFI_AP_CLIENT_MAX) {
+            out->ap_client_count      = DOM_MODELS_WIFI_AP_CLIENT_MAX;
+            out->ap_clients_truncated = true;
+        }
+
+        for (size_t i = 0; i < out->ap_client_count; i++) {
+            inf_device_wifi_esp_wifi_impl_copy_ap_client(&out->ap_clients[i], &sta_list.sta[i]);
+        }
+    }
+
+    return ESP_OK;
+}
+
+void inf_device_wifi_esp_wifi_impl_status_write_begin(inf_device_wifi_esp_wifi_impl_ctx_t* ctx) {
+    xSemaphoreTake(ctx->status_lock, portMAX_DELAY);
+
+    uint_least32_t seq = atomic_load_explicit(&ctx->status_seq, memory_order_relaxed);
+    atomic_store_explicit(&ctx->status_seq, seq + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+}
+
+void inf_device_wifi_esp_wifi_impl_status_write_end(inf_device_wifi_esp_wifi_impl_ctx_t* ctx) {
+    uint_least32_t seq = atomic_load_explicit(&ctx->status_seq, memory_order_relaxed);
+    atomic_store_explicit(&ctx->status_seq, seq + 1, memory_order_release);
+
+    xSemaphoreGive(ctx->status_lock);
+}
+
+void inf_device_wifi_esp_wifi_impl_status_read(inf_device_wifi_esp_wifi_impl_ctx_t* ctx, dom_models_wifi_status_t* out) {
+    for (size_t i = 0; i < INF_DEVICE_WIFI_ESP_WIFI_IMPL_STATUS_READ_ATTEMPTS; i++) {
+        uint_least32_t begin = atomic_load_explicit(&ctx->status_seq, memory_order_acquire);
+        if (begin & 1u) {
+            continue;
+        }
+
+        memcpy(out, &ctx->status, sizeof(dom_models_wifi_status_t));
+        atomic_thread_fence(memory_order_acquire);
+
+        if (atomic_load_explicit(&ctx->status_seq, memory_order_relaxed) == begin) {
+            return;
+        }
     }
 
-    if (ctx->scanned.count == 0) {
+    /* A writer preempted mid update would starve a higher priority reader, the lock hands it the CPU back */
+    xSemaphoreTake(ctx->status_lock, portMAX_DELAY);
+    memcpy(out, &ctx->status, sizeof(dom_models_wifi_status_t));
+    xSemaphoreGive(ctx->status_lock);
+}
+
+void inf_device_wifi_esp_wifi_impl_clear_sta_link(dom_models_wifi_status_t* status) {
+    if (!status) {
         return;
     }
 
-    wifi_ap_record_t records[DOM_MODELS_WIFI_SCAN_RESULT_MAX];
-    memset(records, 0, sizeof(records));
+    status->connected              = false;
+    status->connected_ap_available = false;
+    memset(&status->connected_ap, 0, sizeof(dom_models_wifi_ap_record_t));
+}
 
-    uint16_t count = (uint16_t)ctx->scanned.count;
-    err            = esp_wifi_scan_get_ap_records(&count, records);
-    if (err != ESP_OK) {
-        ctx->scanned.status        = DOM_MODELS_WIFI_SCAN_STATUS_FAILED;
-        ctx->scanned.driver_status = (uint32_t)err;
-        inf_device_wifi_esp_wifi_impl_clear_scan_records(&ctx->scanned);
+void inf_device_wifi_esp_wifi_impl_clear_ap_clients(dom_models_wifi_status_t* status) {
+    if (!status) {
+        return;
+    }
+
+    status->ap_client_total_count = 0;
+    status->ap_client_count       = 0;
+    status->ap_clients_truncated  = false;
+    memset(status->ap_clients, 0, sizeof(status->ap_clients));
+}
+
+void inf_device_wifi_esp_wifi_impl_add_ap_client(dom_models_wifi_status_t* status, const uint8_t* mac) {
+    if (!status || !mac) {
+        return;
+    }
+
+    for (size_t i = 0; i < status->ap_client_count; i++) {
+        if (memcmp(status->ap_clients[i].mac, mac, DOM_MODELS_WIFI_MAC_LEN) == 0) {
+            return;
+        }
+    }
+
+    /* RSSI and PHY flags of a joining client are only known after a refresh */
+    status->ap_client_total_count++;
+    if (status->ap_client_count < DOM_MODELS_WIFI_AP_CLIENT_MAX) {
+        dom_models_wifi_ap_client_t* client = &status->ap_clients[status->ap_client_count++];
+        memset(client, 0, sizeof(dom_models_wifi_ap_client_t));
+        memcpy(client->mac, mac, DOM_MODELS_WIFI_MAC_LEN);
+    }
+    status->ap_clients_truncated = status->ap_client_total_count > status->ap_client_count;
+}
+
+void inf_device_wifi_esp_wifi_impl_remove_ap_client(dom_models_wifi_status_t* status, const uint8_t* mac) {
+    if (!status || !mac) {
         return;
     }
 
-    ctx->scanned.count = count;
-    for (size_t i = 0; i < ctx->scanned.count; i++) {
-        inf_device_wifi_esp_wifi_impl_copy_ap_record(&ctx->scanned.records[i], &records[i]);
+    for (size_t i = 0; i < status->ap_client_count; i++) {
+        if (memcmp(status->ap_clients[i].mac, mac, DOM_MODELS_WIFI_MAC_LEN) != 0) {
+            continue;
+        }
+
+        size_t last_idx = status->ap_client_count - 1;
+        if (i != last_idx) {
+            memcpy(&status->ap_clients[i], &status->ap_clients[last_idx], sizeof(dom_models_wifi_ap_client_t));
+        }
+        memset(&status->ap_clients[last_idx], 0, sizeof(dom_models_wifi_ap_client_t));
+        status->ap_client_count--;
+        break;
+    }
+
+    /* A client past the truncated list may also leave, only the total drops then */
+    if (status->ap_client_total_count > status->ap_client_count) {
+        status->ap_client_total_count--;
     }
+    status->ap_clients_truncated = status->ap_client_total_count > status->ap_client_count;
 }
@@ -32,6 +32,10 @@ static dom_models_error_t get_status_impl(
     dom_contracts_device_wifi_t* self,
     dom_models_wifi_status_t*    out
 );
+static dom_models_error_t refresh_status_impl(
+    dom_contracts_device_wifi_t* self,
+    dom_models_wifi_status_t*    out
+);
 static dom_models_error_t connect_sta_impl(
     dom_contracts_device_wifi_t*                self,
     const dom_models_wifi_sta_connect_config_t* config
@@ -52,7 +56,11 @@ static dom_models_error_t start_scan_impl(
 );
 static dom_models_error_t get_scanned_impl(
     dom_contracts_device_wifi_t*   self,
-    dom_models_wifi_scan_result_t* out
+    dom_models_wifi_scan_result_t* out,
+    size_t                         offset,
+    dom_models_wifi_ap_record_t*   records,
+    size_t                         records_cap,
+    size_t*                        records_cnt
 );
 static dom_models_error_t add_event_callback_impl(
     dom_contracts_device_wifi_t*     self,
@@ -93,6 +101,7 @@ dom_contracts_device_wifi_t* inf_device_wifi_stub_impl_new(const inf_device_wifi
     self->stop                  = stop_impl;
     self->set_mode              = set_mode_impl;
     self->get_status            = get_status_impl;
+    self->refresh_status        = refresh_status_impl;
     self->connect_sta           = connect_sta_impl;
     self->disconnect_sta        = disconnect_sta_impl;
     self->start_ap              = start_ap_impl;
@@ -178,6 +187,7 @@ static dom_models_error_t stop_impl(
 
     if (was_connected) {
         dispatch_event(ctx, DOM_MODELS_WIFI_EVENT_STA_DISCONNECTED, 0);
+        dispatch_event(ctx, DOM_MODELS_WIFI_EVENT_STA_LOST_IP, 0);
     }
     if (was_ap_started) {
         dispatch_event(ctx, DOM_MODELS_WIFI_EVENT_AP_STOPPED, 0);
@@ -246,6 +256,14 @@ static dom_models_error_t get_status_impl(
     return DOMAIN_MODELS_ERROR_OK;
 }
 
+static dom_models_error_t refresh_status_impl(
+    dom_contracts_device_wifi_t* self,
+    dom_models_wifi_status_t*    out
+) {
+    /* The stub status is never cached */
+    return get_status_impl(self, out);
+}
+
 static dom_models_error_t connect_sta_impl(
     dom_contracts_device_wifi_t*                self,
     const dom_models_wifi_sta_connect_config_t* config
@@ -274,8 +292,12 @@ static dom_models_error_t connect_sta_impl(
         ctx->mode = DOM_MODELS_WIFI_MODE_STA;
     }
 
-    inf_device_wifi_stub_impl_fill_default_connected_ap(ctx, ssid, channel, DOM_MODELS_WIFI_AUTH_WPA2_PSK);
+    inf_device_wifi_stub_impl_fill_default_connected_ap(ctx, ssid, channel, config->auth_mode_set ? config->auth_mode : DOM_MODELS_WIFI_AUTH_WPA2_PSK);
+    if (config->bssid_set) {
+        inf_device_wifi_stub_impl_copy_mac(ctx->connected_ap.bssid, config->bssid);
+    }
     dispatch_event(ctx, DOM_MODELS_WIFI_EVENT_STA_CONNECTED, 0);
+    dispatch_event(ctx, DOM_MODELS_WIFI_EVENT_STA_GOT_IP, 0);
 
     return DOMAIN_MODELS_ERROR_OK;
 }
@@ -295,6 +317,7 @@ static dom_models_error_t disconnect_sta_impl(
     }
 
     dispatch_event(ctx, DOM_MODELS_WIFI_EVENT_STA_DISCONNECTED, 0);
+    dispatch_event(ctx, DOM_MODELS_WIFI_EVENT_STA_LOST_IP, 0);
 
     return DOMAIN_MODELS_ERROR_OK;
 }
@@ -386,21 +409,35 @@ static dom_models_error_t start_scan_impl(
 
     inf_device_wifi_stub_impl_fill_default_scan(ctx, ssid, channel);
     ctx->scanned.scan_id += 1;
+    dispatch_event(ctx, DOM_MODELS_WIFI_EVENT_SCAN_DONE, 0);
 
     return DOMAIN_MODELS_ERROR_OK;
 }
 
 static dom_models_error_t get_scanned_impl(
     dom_contracts_device_wifi_t*   self,
-    dom_models_wifi_scan_result_t* out
+    dom_models_wifi_scan_result_t* out,
+    size_t                         offset,
+    dom_models_wifi_ap_record_t*   records,
+    size_t                         records_cap,
+    size_t*                        records_cnt
 ) {
-    if (!self || !self->ctx || !out) {
+    if (!self || !self->ctx || !out || (!records && records_cap > 0)) {
         return inf_device_wifi_stub_impl_bad_argument_error();
     }
 
     inf_device_wifi_stub_impl_ctx_t* ctx = self->ctx;
     memcpy(out, &ctx->scanned, sizeof(dom_models_wifi_scan_result_t));
 
+    size_t copied = 0;
+    if (records && records_cap > 0 && offset < ctx->scanned.count) {
+        memcpy(records, &ctx->scan_record, sizeof(dom_models_wifi_ap_record_t));
+        copied = 1;
+    }
+    if (records_cnt) {
+        *records_cnt = copied;
+    }
+
     return DOMAIN_MODELS_ERROR_OK;
 }
 
@@ -129,7 +129,7 @@ void inf_device_wifi_stub_impl_fill_default_scan(inf_device_wifi_stub_impl_ctx_t
     ctx->scanned.count         = 1;
     ctx->scanned.truncated     = false;
 
-    inf_device_wifi_stub_impl_fill_ap_record(&ctx->scanned.records[0], ssid, bssid, channel, -42, DOM_MODELS_WIFI_AUTH_WPA2_PSK);
+    inf_device_wifi_stub_impl_fill_ap_record(&ctx->scan_record, ssid, bssid, channel, -42, DOM_MODELS_WIFI_AUTH_WPA2_PSK);
 }
 
 void inf_device_wifi_stub_impl_reset_runtime(inf_device_wifi_stub_impl_ctx_t* ctx) {
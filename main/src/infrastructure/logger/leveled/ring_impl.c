@@ -0,0 +1,488 @@
+#include "infrastructure/logger/leveled/ring_impl.h"
+
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "domain/contracts/logger/leveled.h"
+#include "domain/models/error.h"
+#include "domain/models/logger.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"  // IWYU pragma: keep
+#include "freertos/task.h"
+#include "infrastructure/logger/leveled/ring_impl_types.h"
+#include "infrastructure/logger/leveled/ring_impl_utils.h"
+
+/* Helper Function Prototypes */
+
+static void push_log(inf_logger_leveled_ring_impl_ctx_t* ctx, dom_models_logger_level_t level, const char* tag, const char* format, va_list args);
+static void drain_logs(inf_logger_leveled_ring_impl_ctx_t* ctx);
+static void run_callbacks(inf_logger_leveled_ring_impl_ctx_t* ctx, const char* msg, size_t msg_len);
+static void free_ctx(inf_logger_leveled_ring_impl_ctx_t* ctx);
+
+/* Task Function Prototypes */
+
+static void task_impl(void* arg);
+
+/* Contract Function Prototypes */
+
+static void error_impl(
+    dom_contracts_logger_leveled_t* self,
+    const char*                     tag,
+    const char*                     format,
+    ...
+);
+static void warn_impl(
+    dom_contracts_logger_leveled_t* self,
+    const char*                     tag,
+    const char*                     format,
+    ...
+);
+static void info_impl(
+    dom_contracts_logger_leveled_t* self,
+    const char*                     tag,
+    const char*                     format,
+    ...
+);
+static void debug_impl(
+    dom_contracts_logger_leveled_t* self,
+    const char*                     tag,
+    const char*                     format,
+    ...
+);
+static void add_callback_impl(
+    dom_contracts_logger_leveled_t* self,
+    void*                           cb_ctx,
+    dom_contracts_logger_leveled_cb cb_func
+);
+static void remove_callback_impl(
+    dom_contracts_logger_leveled_t* self,
+    dom_contracts_logger_leveled_cb cb_func
+);
+static void add_record_callback_impl(
+    dom_contracts_logger_leveled_t*        self,
+    void*                                  cb_ctx,
+    dom_contracts_logger_leveled_record_cb cb_func
+);
+static void remove_record_callback_impl(
+    dom_contracts_logger_leveled_t*        self,
+    dom_contracts_logger_leveled_record_cb cb_func
+);
+
+/* Constructor and Destructor */
+
+dom_contracts_logger_leveled_t* inf_logger_leveled_ring_impl_new(const inf_logger_leveled_ring_impl_cfg_t* cfg) {
+    inf_logger_leveled_ring_impl_ctx_t* ctx = (inf_logger_leveled_ring_impl_ctx_t*)calloc(1, sizeof(inf_logger_leveled_ring_impl_ctx_t));
+    if (!ctx) {
+        return NULL;
+    }
+
+    inf_logger_leveled_ring_impl_normalize_cfg(&ctx->cfg, cfg);
+
+    ctx->slot_mask = ctx->cfg.slot_cnt - 1;
+    ctx->slots     = (inf_logger_leveled_ring_impl_slot_t*)calloc(ctx->cfg.slot_cnt, sizeof(inf_logger_leveled_ring_impl_slot_t));
+    ctx->msg_pool  = (char*)calloc(ctx->cfg.slot_cnt, ctx->cfg.msg_max_len);
+    ctx->drain_buf = (char*)calloc(1, ctx->cfg.msg_max_len);
+    if (!ctx->slots || !ctx->msg_pool || !ctx->drain_buf) {
+        free_ctx(ctx);
+        return NULL;
+    }
+
+    for (size_t i = 0; i < ctx->cfg.slot_cnt; i++) {
+        ctx->slots[i].msg = ctx->msg_pool + (i * ctx->cfg.msg_max_len);
+        atomic_init(&ctx->slots[i].seq, i);
+    }
+
+    atomic_init(&ctx->enqueue_pos, 0);
+    atomic_init(&ctx->dequeue_pos, 0);
+    atomic_init(&ctx->high_water_cnt, 0);
+    atomic_init(&ctx->written_cnt, 0);
+    atomic_init(&ctx->dropped_cnt, 0);
+
+    if (ctx->cfg.cb_max_cnt > 0) {
+        ctx->cb_funcs = (dom_contracts_logger_leveled_cb*)calloc(ctx->cfg.cb_max_cnt, sizeof(dom_contracts_logger_leveled_cb));
+        ctx->cb_ctxs  = (void**)calloc(ctx->cfg.cb_max_cnt, sizeof(void*));
+        if (!ctx->cb_funcs || !ctx->cb_ctxs) {
+            free_ctx(ctx);
+            return NULL;
+        }
+    }
+
+    dom_contracts_logger_leveled_t* self = dom_contracts_logger_leveled_new(ctx);
+    if (!self) {
+        free_ctx(ctx);
+        return NULL;
+    }
+
+    BaseType_t result = xTaskCreate(
+        task_impl,
+        ctx->cfg.task_name,
+        ctx->cfg.task_stack_size,
+        ctx,
+        ctx->cfg.task_priority,
+        &ctx->task_handle
+    );
+    if (result != pdPASS) {
+        ctx->task_handle = NULL;
+        free_ctx(ctx);
+        dom_contracts_logger_leveled_delete(self);
+        return NULL;
+    }
+
+    self->level           = ctx->cfg.level;
+    self->error           = error_impl;
+    self->warn            = warn_impl;
+    self->info            = info_impl;
+    self->debug           = debug_impl;
+    self->add_callback    = add_callback_impl;
+    self->remove_callback = remove_callback_impl;
+
+    /* Only deferred slots hold a record, eager ones are text already */
+    if (ctx->cfg.deferred_format) {
+        self->add_record_callback    = add_record_callback_impl;
+        self->remove_record_callback = remove_record_callback_impl;
+    }
+
+    return self;
+}
+
+void inf_logger_leveled_ring_impl_delete(dom_contracts_logger_leveled_t* self) {
+    if (!self || !self->ctx) {
+        return;
+    }
+
+    inf_logger_leveled_ring_impl_ctx_t* ctx = self->ctx;
+
+    ctx->stop_requested = true;
+
+    if (ctx->task_handle) {
+        xTaskNotifyGive(ctx->task_handle);
+
+        TickType_t waited_ticks = 0;
+        TickType_t max_ticks    = pdMS_TO_TICKS(INF_LOGGER_LEVELED_RING_IMPL_DEFAULT_STOP_TIMEOUT_MS);
+        while (ctx->task_handle && waited_ticks < max_ticks) {
+            vTaskDelay(1);
+            waited_ticks++;
+        }
+
+        if (ctx->task_handle) {
+            TaskHandle_t task_handle = ctx->task_handle;
+            ctx->task_handle         = NULL;
+            vTaskDelete(task_handle);
+        }
+    }
+
+    drain_logs(ctx);
+    free_ctx(ctx);
+    dom_contracts_logger_leveled_delete(self);
+}
+
+/* Public Function Implementations */
+
+dom_models_error_t inf_logger_leveled_ring_impl_get_stats(
+    dom_contracts_logger_leveled_t*       self,
+    inf_logger_leveled_ring_impl_stats_t* out
+) {
+    if (!self || !self->ctx || !out) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    inf_logger_leveled_ring_impl_ctx_t* ctx = self->ctx;
+
+    size_t enqueue_pos = atomic_load_explicit(&ctx->enqueue_pos, memory_order_relaxed);
+    size_t dequeue_pos = atomic_load_explicit(&ctx->dequeue_pos, memory_order_relaxed);
+
+    out->slot_cnt       = ctx->cfg.slot_cnt;
+    out->pending_cnt    = enqueue_pos - dequeue_pos;
+    out->high_water_cnt = atomic_load_explicit(&ctx->high_water_cnt, memory_order_relaxed);
+    out->written_cnt    = atomic_load_explicit(&ctx->written_cnt, memory_order_relaxed);
+    out->dropped_cnt    = atomic_load_explicit(&ctx->dropped_cnt, memory_order_relaxed);
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+/* Contract Function Implementations */
+
+static void error_impl(
+    dom_contracts_logger_leveled_t* self,
+    const char*                     tag,
+    const char*                     format,
+    ...
+) {
+    if (!self || !self->ctx) {
+        return;
+    }
+
+    inf_logger_leveled_ring_impl_ctx_t* ctx = self->ctx;
+
+    va_list args;
+    va_start(args, format);
+    push_log(ctx, DOMAIN_MODELS_LOGGER_LEVEL_ERROR, tag, format, args);
+    va_end(args);
+}
+
+static void warn_impl(
+    dom_contracts_logger_leveled_t* self,
+    const char*                     tag,
+    const char*                     format,
+    ...
+) {
+    if (!self || !self->ctx) {
+        return;
+    }
+
+    inf_logger_leveled_ring_impl_ctx_t* ctx = self->ctx;
+
+    va_list args;
+    va_start(args, format);
+    push_log(ctx, DOMAIN_MODELS_LOGGER_LEVEL_WARN, tag, format, args);
+    va_end(args);
+}
+
+static void info_impl(
+    dom_contracts_logger_leveled_t* self,
+    const char*                     tag,
+    const char*                     format,
+    ...
+) {
+    if (!self || !self->ctx) {
+        return;
+    }
+
+    inf_logger_leveled_ring_impl_ctx_t* ctx = self->ctx;
+
+    va_list args;
+    va_start(args, format);
+    push_log(ctx, DOMAIN_MODELS_LOGGER_LEVEL_INFO, tag, format, args);
+    va_end(args);
+}
+
+static void debug_impl(
+    dom_contracts_logger_leveled_t* self,
+    const char*                     tag,
+    const char*                     format,
+    ...
+) {
+    if (!self || !self->ctx) {
+        return;
+    }
+
+    inf_logger_leveled_ring_impl_ctx_t* ctx = self->ctx;
+
+    va_list args;
+    va_start(args, format);
+    push_log(ctx, DOMAIN_MODELS_LOGGER_LEVEL_DEBUG, tag, format, args);
+    va_end(args);
+}
+
+static void add_callback_impl(
+    dom_contracts_logger_leveled_t* self,
+    void*                           cb_ctx,
+    dom_contracts_logger_leveled_cb cb_func
+) {
+    if (!self || !self->ctx) {
+        return;
+    }
+
+    inf_logger_leveled_ring_impl_ctx_t* ctx = self->ctx;
+
+    if (ctx->cb_idx >= ctx->cfg.cb_max_cnt) {
+        return;
+    }
+
+    if (!ctx->cb_funcs || !ctx->cb_ctxs || !cb_func) {
+        return;
+    }
+
+    ctx->cb_funcs[ctx->cb_idx] = cb_func;
+    ctx->cb_ctxs[ctx->cb_idx]  = cb_ctx;
+    ctx->cb_idx += 1;
+}
+
+static void remove_callback_impl(
+    dom_contracts_logger_leveled_t* self,
+    dom_contracts_logger_leveled_cb cb_func
+) {
+    if (!self || !self->ctx) {
+        return;
+    }
+
+    inf_logger_leveled_ring_impl_ctx_t* ctx = self->ctx;
+
+    if (!ctx->cb_funcs || !ctx->cb_ctxs || !cb_func || ctx->cb_idx == 0) {
+        return;
+    }
+
+    for (unsigned int i = 0; i < ctx->cb_idx; i++) {
+        if (ctx->cb_funcs[i] != cb_func) {
+            continue;
+        }
+
+        unsigned int last_idx = ctx->cb_idx - 1;
+
+        ctx->cb_funcs[i] = NULL;
+        ctx->cb_ctxs[i]  = NULL;
+
+        if (i != last_idx) {
+            ctx->cb_funcs[i] = ctx->cb_funcs[last_idx];
+            ctx->cb_ctxs[i]  = ctx->cb_ctxs[last_idx];
+
+            ctx->cb_funcs[last_idx] = NULL;
+            ctx->cb_ctxs[last_idx]  = NULL;
+        }
+
+        ctx->cb_idx -= 1;
+        return;
+    }
+}
+
+/* The ring holds a single record callback, a second one is ignored like a callback past cb_max_cnt */
+static void add_record_callback_impl(
+    dom_contracts_logger_leveled_t*        self,
+    void*                                  cb_ctx,
+    dom_contracts_logger_leveled_record_cb cb_func
+) {
+    if (!self || !self->ctx || !cb_func) {
+        return;
+    }
+
+    inf_logger_leveled_ring_impl_ctx_t* ctx = self->ctx;
+
+    if (ctx->record_cb_func) {
+        return;
+    }
+
+    ctx->record_cb_ctx  = cb_ctx;
+    ctx->record_cb_func = cb_func;
+}
+
+static void remove_record_callback_impl(
+    dom_contracts_logger_leveled_t*        self,
+    dom_contracts_logger_leveled_record_cb cb_func
+) {
+    if (!self || !self->ctx) {
+        return;
+    }
+
+    inf_logger_leveled_ring_impl_ctx_t* ctx = self->ctx;
+
+    if (!cb_func || ctx->record_cb_func != cb_func) {
+        return;
+    }
+
+    ctx->record_cb_func = NULL;
+    ctx->record_cb_ctx  = NULL;
+}
+
+/* Task Function Implementations */
+
+static void task_impl(void* arg) {
+    inf_logger_leveled_ring_impl_ctx_t* ctx = (inf_logger_leveled_ring_impl_ctx_t*)arg;
+    if (!ctx) {
+        vTaskDelete(NULL);
+        return;
+    }
+
+    while (!ctx->stop_requested) {
+        (void)ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        drain_logs(ctx);
+    }
+
+    ctx->task_handle = NULL;
+
+    vTaskDelete(NULL);
+}
+
+/* Helper Function Implementations */
+
+static void push_log(inf_logger_leveled_ring_impl_ctx_t* ctx, dom_models_logger_level_t level, const char* tag, const char* format, va_list args) {
+    if (ctx->cfg.level < level) {
+        return;
+    }
+
+    size_t                               pos  = 0;
+    inf_logger_leveled_ring_impl_slot_t* slot = inf_logger_leveled_ring_impl_reserve(ctx, &pos);
+    if (!slot) {
+        return;
+    }
+
+    slot->level    = level;
+    slot->deferred = ctx->cfg.deferred_format;
+
+    if (slot->deferred) {
+        slot->tag          = tag;
+        slot->format       = format;
+        slot->timestamp_us = esp_timer_get_time();
+        slot->msg_len      = inf_logger_leveled_ring_impl_encode_args((uint8_t*)slot->msg, ctx->cfg.msg_max_len, format, args);
+    } else {
+        slot->msg_len = inf_logger_leveled_ring_impl_format(slot->msg, ctx->cfg.msg_max_len, level, tag, format, args);
+    }
+
+    inf_logger_leveled_ring_impl_commit(ctx, slot, pos);
+
+    TaskHandle_t task_handle = ctx->task_handle;
+    if (task_handle) {
+        xTaskNotifyGive(task_handle);
+    }
+}
+
+static void drain_logs(inf_logger_leveled_ring_impl_ctx_t* ctx) {
+    size_t                               pos  = 0;
+    inf_logger_leveled_ring_impl_slot_t* slot = NULL;
+
+    while ((slot = inf_logger_leveled_ring_impl_peek(ctx, &pos)) != NULL) {
+        const char* msg     = slot->msg;
+        size_t      msg_len = slot->msg_len;
+
+        if (slot->deferred) {
+            dom_models_logger_record_t record = {
+                .level        = slot->level,
+                .tag          = slot->tag,
+                .format       = slot->format,
+                .timestamp_us = slot->timestamp_us,
+                .args         = (const uint8_t*)slot->msg,
+                .args_len     = slot->msg_len,
+            };
+
+            dom_contracts_logger_leveled_record_cb record_cb_func = ctx->record_cb_func;
+            if (record_cb_func) {
+                record_cb_func(ctx->record_cb_ctx, &record);
+            }
+
+            msg     = ctx->drain_buf;
+            msg_len = inf_logger_leveled_ring_impl_decode_record(ctx->drain_buf, ctx->cfg.msg_max_len, &record);
+        }
+
+        fputs(msg, stdout);
+        fputc('\n', stdout);
+        run_callbacks(ctx, msg, msg_len);
+        inf_logger_leveled_ring_impl_release(ctx, slot, pos);
+    }
+}
+
+static void run_callbacks(inf_logger_leveled_ring_impl_ctx_t* ctx, const char* msg, size_t msg_len) {
+    if (!ctx || !ctx->cb_funcs || !ctx->cb_ctxs || !msg) {
+        return;
+    }
+
+    for (unsigned int i = 0; i < ctx->cb_idx; i++) {
+        if (ctx->cb_funcs[i]) {
+            ctx->cb_funcs[i](ctx->cb_ctxs[i], msg, msg_len);
+        }
+    }
+}
+
+static void free_ctx(inf_logger_leveled_ring_impl_ctx_t* ctx) {
+    if (!ctx) {
+        return;
+    }
+
+    free(ctx->cb_funcs);
+    free(ctx->cb_ctxs);
+    free(ctx->drain_buf);
+    free(ctx->msg_pool);
+    free(ctx->slots);
+    free(ctx);
+}
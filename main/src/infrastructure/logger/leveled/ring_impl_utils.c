@@ -0,0 +1,719 @@
+#include "infrastructure/logger/leveled/ring_impl_utils.h"
+
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/time.h>
+#include <time.h>
+
+#include "domain/models/logger.h"
+#include "esp_timer.h"
+#include "infrastructure/logger/leveled/ring_impl_types.h"
+
+#define SPEC_MAX_LEN 24
+
+typedef enum {
+    SPEC_LENGTH_NONE = 0,
+    SPEC_LENGTH_HH,
+    SPEC_LENGTH_H,
+    SPEC_LENGTH_L,
+    SPEC_LENGTH_LL,
+    SPEC_LENGTH_Z,
+    SPEC_LENGTH_J,
+    SPEC_LENGTH_T,
+    SPEC_LENGTH_BIG_L,
+} spec_length_t;
+
+typedef enum {
+    SPEC_KIND_NONE = 0,
+    SPEC_KIND_SIGNED,
+    SPEC_KIND_UNSIGNED,
+    SPEC_KIND_DOUBLE,
+    SPEC_KIND_POINTER,
+    SPEC_KIND_STRING,
+    SPEC_KIND_UNSUPPORTED,
+} spec_kind_t;
+
+typedef struct {
+    size_t        len;
+    bool          width_star;
+    bool          precision_star;
+    spec_length_t length;
+    spec_kind_t   kind;
+} spec_t;
+
+/* Helper Function Prototypes */
+
+static size_t round_up_pow2(size_t value);
+static void   update_high_water(inf_logger_leveled_ring_impl_ctx_t* ctx, size_t pos);
+static size_t parse_spec(const char* spec, spec_t* out);
+static size_t arg_size(const spec_t* spec);
+static bool   put_bytes(uint8_t* buf, size_t buf_size, size_t* offset, const void* value, size_t value_len);
+static bool   get_bytes(const uint8_t* args, size_t args_len, size_t* offset, void* value, size_t value_len);
+static bool   append_spec(char* buf, size_t buf_size, size_t* len, const char* spec_str, const spec_t* spec, const int* stars, const uint8_t* args, size_t args_len, size_t* offset);
+
+void inf_logger_leveled_ring_impl_normalize_cfg(
+    inf_logger_leveled_ring_impl_cfg_t*       out,
+    const inf_logger_leveled_ring_impl_cfg_t* cfg
+) {
+    if (!out) {
+        return;
+    }
+
+    inf_logger_leveled_ring_impl_cfg_t default_cfg = INF_LOGGER_LEVELED_RING_IMPL_CFG_DEFAULT();
+    memcpy(out, cfg ? cfg : &default_cfg, sizeof(inf_logger_leveled_ring_impl_cfg_t));
+
+    if (out->slot_cnt < 2) {
+        out->slot_cnt = INF_LOGGER_LEVELED_RING_IMPL_DEFAULT_SLOT_CNT;
+    }
+    out->slot_cnt = round_up_pow2(out->slot_cnt);
+
+    if (out->msg_max_len < 2) {
+        out->msg_max_len = INF_LOGGER_LEVELED_RING_IMPL_DEFAULT_MSG_MAX_LEN;
+    }
+    if (!out->task_name || out->task_name[0] == '\0') {
+        out->task_name = INF_LOGGER_LEVELED_RING_IMPL_DEFAULT_TASK_NAME;
+    }
+    if (out->task_stack_size == 0) {
+        out->task_stack_size = INF_LOGGER_LEVELED_RING_IMPL_DEFAULT_TASK_STACK_SIZE;
+    }
+    if (out->task_priority == 0) {
+        out->task_priority = INF_LOGGER_LEVELED_RING_IMPL_DEFAULT_TASK_PRIORITY;
+    }
+}
+
+size_t inf_logger_leveled_ring_impl_format(
+    char*                     buf,
+    size_t                    buf_size,
+    dom_models_logger_level_t level,
+    const char*               tag,
+    const char*               format,
+    va_list                   args
+) {
+    if (!buf || buf_size == 0) {
+        return 0;
+    }
+
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+
+    size_t msg_len = inf_logger_leveled_ring_impl_format_prefix(buf, buf_size, &tv, level, tag);
+    if (msg_len >= buf_size - 1) {
+        return msg_len;
+    }
+
+    size_t remaining_len = buf_size - msg_len;
+
+    int body_len = vsnprintf(buf + msg_len, remaining_len, format ? format : "", args);
+    if (body_len < 0) {
+        buf[msg_len] = '\0';
+        return msg_len;
+    }
+    if ((size_t)body_len >= remaining_len) {
+        return buf_size - 1;
+    }
+
+    return msg_len + (size_t)body_len;
+}
+
+size_t inf_logger_leveled_ring_impl_format_prefix(
+    char*                     buf,
+    size_t                    buf_size,
+    const struct timeval*     tv,
+    dom_models_logger_level_t level,
+    const char*               tag
+) {
+    if (!buf || buf_size == 0 || !tv) {
+        return 0;
+    }
+
+    struct tm timeinfo;
+    localtime_r(&tv->tv_sec, &timeinfo);
+
+    int prefix_len = snprintf(
+        buf,
+        buf_size,
+        "%02d/%02d/%04d %02d:%02d:%02d.%03ld [%s] [%s] ",
+        timeinfo.tm_mday,
+        timeinfo.tm_mon + 1,
+        timeinfo.tm_year + 1900,
+        timeinfo.tm_hour,
+        timeinfo.tm_min,
+        timeinfo.tm_sec,
+        (long)(tv->tv_usec / 1000),
+        dom_models_logger_level_str(level),
+        tag ? tag : ""
+    );
+    if (prefix_len < 0) {
+        buf[0] = '\0';
+        return 0;
+    }
+    if ((size_t)prefix_len >= buf_size) {
+        return buf_size - 1;
+    }
+
+    return (size_t)prefix_len;
+}
+
+size_t inf_logger_leveled_ring_impl_encode_args(
+    uint8_t*    buf,
+    size_t      buf_size,
+    const char* format,
+    va_list     args
+) {
+    if (!buf || !format) {
+        return 0;
+    }
+
+    size_t      offset = 0;
+    const char* cursor = format;
+
+    while (*cursor != '\0') {
+        if (*cursor++ != '%') {
+            continue;
+        }
+
+        spec_t spec;
+        cursor += parse_spec(cursor, &spec);
+
+        if (spec.width_star) {
+            int width = va_arg(args, int);
+            if (!put_bytes(buf, buf_size, &offset, &width, sizeof(width))) {
+                return offset;
+            }
+        }
+        if (spec.precision_star) {
+            int precision = va_arg(args, int);
+            if (!put_bytes(buf, buf_size, &offset, &precision, sizeof(precision))) {
+                return offset;
+            }
+        }
+
+        bool stored = true;
+
+        switch (spec.kind) {
+            case SPEC_KIND_SIGNED:
+            case SPEC_KIND_UNSIGNED:
+                if (spec.length == SPEC_LENGTH_L) {
+                    long value = va_arg(args, long);
+                    stored     = put_bytes(buf, buf_size, &offset, &value, sizeof(value));
+                } else if (spec.length == SPEC_LENGTH_LL) {
+                    long long value = va_arg(args, long long);
+                    stored          = put_bytes(buf, buf_size, &offset, &value, sizeof(value));
+                } else if (spec.length == SPEC_LENGTH_Z) {
+                    size_t value = va_arg(args, size_t);
+                    stored       = put_bytes(buf, buf_size, &offset, &value, sizeof(value));
+                } else if (spec.length == SPEC_LENGTH_J) {
+                    intmax_t value = va_arg(args, intmax_t);
+                    stored         = put_bytes(buf, buf_size, &offset, &value, sizeof(value));
+                } else if (spec.length == SPEC_LENGTH_T) {
+                    ptrdiff_t value = va_arg(args, ptrdiff_t);
+                    stored          = put_bytes(buf, buf_size, &offset, &value, sizeof(value));
+                } else {
+                    int value = va_arg(args, int);
+                    stored    = put_bytes(buf, buf_size, &offset, &value, sizeof(value));
+                }
+                break;
+
+            case SPEC_KIND_DOUBLE:
+                if (spec.length == SPEC_LENGTH_BIG_L) {
+                    long double value = va_arg(args, long double);
+                    stored            = put_bytes(buf, buf_size, &offset, &value, sizeof(value));
+                } else {
+                    double value = va_arg(args, double);
+                    stored       = put_bytes(buf, buf_size, &offset, &value, sizeof(value));
+                }
+                break;
+
+            case SPEC_KIND_POINTER: {
+                void* value = va_arg(args, void*);
+                stored      = put_bytes(buf, buf_size, &offset, &value, sizeof(value));
+                break;
+            }
+
+            case SPEC_KIND_STRING: {
+                const char* value     = va_arg(args, const char*);
+                const char* safe_str  = value ? value : "(null)";
+                size_t      str_len   = strlen(safe_str);
+                size_t      available = buf_size > offset ? buf_size - offset : 0;
+                if (available == 0) {
+                    return offset;
+                }
+                if (str_len >= available) {
+                    str_len = available - 1;
+                    stored  = false;
+                }
+                memcpy(buf + offset, safe_str, str_len);
+                buf[offset + str_len] = '\0';
+                offset += str_len + 1;
+                break;
+            }
+
+            case SPEC_KIND_UNSUPPORTED:
+                (void)va_arg(args, void*);
+                break;
+
+            case SPEC_KIND_NONE:
+            default:
+                break;
+        }
+
+        if (!stored) {
+            return offset;
+        }
+    }
+
+    return offset;
+}
+
+size_t inf_logger_leveled_ring_impl_decode_args(
+    char*          buf,
+    size_t         buf_size,
+    const char*    format,
+    const uint8_t* args,
+    size_t         args_len
+) {
+    if (!buf || buf_size == 0) {
+        return 0;
+    }
+
+    buf[0] = '\0';
+    if (!format) {
+        return 0;
+    }
+
+    size_t      len    = 0;
+    size_t      offset = 0;
+    const char* cursor = format;
+
+    while (*cursor != '\0' && len < buf_size - 1) {
+        if (*cursor != '%') {
+            buf[len++] = *cursor++;
+            continue;
+        }
+
+        const char* spec_start = cursor++;
+
+        spec_t spec;
+        cursor += parse_spec(cursor, &spec);
+
+        size_t spec_len = (size_t)(cursor - spec_start);
+        if (spec_len >= SPEC_MAX_LEN) {
+            break;
+        }
+
+        char spec_str[SPEC_MAX_LEN];
+        memcpy(spec_str, spec_start, spec_len);
+        spec_str[spec_len] = '\0';
+
+        int stars[2] = {0, 0};
+        if (spec.width_star && !get_bytes(args, args_len, &offset, &stars[0], sizeof(int))) {
+            break;
+        }
+        if (spec.precision_star && !get_bytes(args, args_len, &offset, &stars[1], sizeof(int))) {
+            break;
+        }
+
+        if (!append_spec(buf, buf_size, &len, spec_str, &spec, stars, args, args_len, &offset)) {
+            break;
+        }
+    }
+
+    buf[len] = '\0';
+
+    return len;
+}
+
+size_t inf_logger_leveled_ring_impl_decode_record(
+    char*                             buf,
+    size_t                            buf_size,
+    const dom_models_logger_record_t* record
+) {
+    if (!buf || buf_size == 0 || !record) {
+        return 0;
+    }
+
+    struct timeval now;
+    gettimeofday(&now, NULL);
+
+    int64_t age_us  = esp_timer_get_time() - record->timestamp_us;
+    int64_t wall_us = ((int64_t)now.tv_sec * 1000000) + now.tv_usec - (age_us > 0 ? age_us : 0);
+
+    struct timeval tv = {
+        .tv_sec  = (time_t)(wall_us / 1000000),
+        .tv_usec = (suseconds_t)(wall_us % 1000000),
+    };
+
+    size_t len = inf_logger_leveled_ring_impl_format_prefix(buf, buf_size, &tv, record->level, record->tag);
+    if (len >= buf_size - 1) {
+        return len;
+    }
+
+    return len + inf_logger_leveled_ring_impl_decode_args(buf + len, buf_size - len, record->format, record->args, record->args_len);
+}
+
+inf_logger_leveled_ring_impl_slot_t* inf_logger_leveled_ring_impl_reserve(
+    inf_logger_leveled_ring_impl_ctx_t* ctx,
+    size_t*                             pos
+) {
+    if (!ctx || !ctx->slots || !pos) {
+        return NULL;
+    }
+
+    size_t current = atomic_load_explicit(&ctx->enqueue_pos, memory_order_relaxed);
+
+    for (;;) {
+        inf_logger_leveled_ring_impl_slot_t* slot = &ctx->slots[current & ctx->slot_mask];
+
+        size_t   seq  = atomic_load_explicit(&slot->seq, memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)current;
+
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(
+                    &ctx->enqueue_pos,
+                    &current,
+                    current + 1,
+                    memory_order_relaxed,
+                    memory_order_relaxed
+                )) {
+                *pos = current;
+                update_high_water(ctx, current);
+                return slot;
+            }
+        } else if (diff < 0) {
+            atomic_fetch_add_explicit(&ctx->dropped_cnt, 1, memory_order_relaxed);
+            return NULL;
+        } else {
+            current = atomic_load_explicit(&ctx->enqueue_pos, memory_order_relaxed);
+        }
+    }
+}
+
+void inf_logger_leveled_ring_impl_commit(
+    inf_logger_leveled_ring_impl_ctx_t*  ctx,
+    inf_logger_leveled_ring_impl_slot_t* slot,
+    size_t                               pos
+) {
+    if (!ctx || !slot) {
+        return;
+    }
+
+    atomic_store_explicit(&slot->seq, pos + 1, memory_order_release);
+}
+
+inf_logger_leveled_ring_impl_slot_t* inf_logger_leveled_ring_impl_peek(
+    inf_logger_leveled_ring_impl_ctx_t* ctx,
+    size_t*                             pos
+) {
+    if (!ctx || !ctx->slots || !pos) {
+        return NULL;
+    }
+
+    size_t                               current = atomic_load_explicit(&ctx->dequeue_pos, memory_order_relaxed);
+    inf_logger_leveled_ring_impl_slot_t* slot    = &ctx->slots[current & ctx->slot_mask];
+
+    size_t seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+    if (seq != current + 1) {
+        return NULL;
+    }
+
+    *pos = current;
+
+    return slot;
+}
+
+void inf_logger_leveled_ring_impl_release(
+    inf_logger_leveled_ring_impl_ctx_t*  ctx,
+    inf_logger_leveled_ring_impl_slot_t* slot,
+    size_t                               pos
+) {
+    if (!ctx || !slot) {
+        return;
+    }
+
+    atomic_store_explicit(&slot->seq, pos + ctx->cfg.slot_cnt, memory_order_release);
+    atomic_store_explicit(&ctx->dequeue_pos, pos + 1, memory_order_release);
+    atomic_fetch_add_explicit(&ctx->written_cnt, 1, memory_order_relaxed);
+}
+
+/* Helper Function Implementations */
+
+static size_t round_up_pow2(size_t value) {
+    size_t out = 1;
+
+    while (out < value) {
+        out <<= 1;
+    }
+
+    return out;
+}
+
+static void update_high_water(inf_logger_leveled_ring_impl_ctx_t* ctx, size_t pos) {
+    size_t depth   = pos + 1 - atomic_load_explicit(&ctx->dequeue_pos, memory_order_relaxed);
+    size_t current = atomic_load_explicit(&ctx->high_water_cnt, memory_order_relaxed);
+
+    while (depth > current) {
+        if (atomic_compare_exchange_weak_explicit(
+                &ctx->high_water_cnt,
+                &current,
+                depth,
+                memory_order_relaxed,
+                memory_order_relaxed
+            )) {
+            return;
+        }
+    }
+}
+
+static size_t parse_spec(const char* spec, spec_t* out) {
+    const char* cursor = spec;
+
+    memset(out, 0, sizeof(spec_t));
+
+    while (*cursor != '\0' && strchr("-+ #0", *cursor)) {
+        cursor++;
+    }
+
+    if (*cursor == '*') {
+        out->width_star = true;
+        cursor++;
+    } else {
+        while (*cursor >= '0' && *cursor <= '9') {
+            cursor++;
+        }
+    }
+
+    if (*cursor == '.') {
+        cursor++;
+        if (*cursor == '*') {
+            out->precision_star = true;
+            cursor++;
+        } else {
+            while (*cursor >= '0' && *cursor <= '9') {
+                cursor++;
+            }
+        }
+    }
+
+    switch (*cursor) {
+        case 'h':
+            cursor++;
+            out->length = SPEC_LENGTH_H;
+            if (*cursor == 'h') {
+                cursor++;
+                out->length = SPEC_LENGTH_HH;
+            }
+            break;
+        case 'l':
+            cursor++;
+            out->length = SPEC_LENGTH_L;
+            if (*cursor == 'l') {
+                cursor++;
+                out->length = SPEC_LENGTH_LL;
+            }
+            break;
+        case 'z':
+            cursor++;
+            out->length = SPEC_LENGTH_Z;
+            break;
+        case 'j':
+            cursor++;
+            out->length = SPEC_LENGTH_J;
+            break;
+        case 't':
+            cursor++;
+            out->length = SPEC_LENGTH_T;
+            break;
+        case 'L':
+            cursor++;
+            out->length = SPEC_LENGTH_BIG_L;
+            break;
+        default:
+            break;
+    }
+
+    switch (*cursor) {
+        case 'd':
+        case 'i':
+        case 'c':
+            out->kind = SPEC_KIND_SIGNED;
+            break;
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+            out->kind = SPEC_KIND_UNSIGNED;
+            break;
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+            out->kind = SPEC_KIND_DOUBLE;
+            break;
+        case 'p':
+            out->kind = SPEC_KIND_POINTER;
+            break;
+        case 's':
+            out->kind = out->length == SPEC_LENGTH_L ? SPEC_KIND_UNSUPPORTED : SPEC_KIND_STRING;
+            break;
+        case 'n':
+            out->kind = SPEC_KIND_UNSUPPORTED;
+            break;
+        case '%':
+        default:
+            out->kind = SPEC_KIND_NONE;
+            break;
+    }
+
+    if (*cursor != '\0') {
+        cursor++;
+    }
+
+    out->len = (size_t)(cursor - spec);
+
+    return out->len;
+}
+
+static size_t arg_size(const spec_t* spec) {
+    switch (spec->kind) {
+        case SPEC_KIND_SIGNED:
+        case SPEC_KIND_UNSIGNED:
+            switch (spec->length) {
+                case SPEC_LENGTH_L:
+                    return sizeof(long);
+                case SPEC_LENGTH_LL:
+                    return sizeof(long long);
+                case SPEC_LENGTH_Z:
+                    return sizeof(size_t);
+                case SPEC_LENGTH_J:
+                    return sizeof(intmax_t);
+                case SPEC_LENGTH_T:
+                    return sizeof(ptrdiff_t);
+                default:
+                    return sizeof(int);
+            }
+        case SPEC_KIND_DOUBLE:
+            return spec->length == SPEC_LENGTH_BIG_L ? sizeof(long double) : sizeof(double);
+        case SPEC_KIND_POINTER:
+            return sizeof(void*);
+        default:
+            return 0;
+    }
+}
+
+static bool put_bytes(uint8_t* buf, size_t buf_size, size_t* offset, const void* value, size_t value_len) {
+    if (*offset + value_len > buf_size) {
+        return false;
+    }
+
+    memcpy(buf + *offset, value, value_len);
+    *offset += value_len;
+
+    return true;
+}
+
+static bool get_bytes(const uint8_t* args, size_t args_len, size_t* offset, void* value, size_t value_len) {
+    if (!args || *offset + value_len > args_len) {
+        return false;
+    }
+
+    memcpy(value, args + *offset, value_len);
+    *offset += value_len;
+
+    return true;
+}
+
+#define APPEND_WITH_STARS(value)                                                                   \
+    do {                                                                                           \
+        if (spec->width_star && spec->precision_star) {                                            \
+            written = snprintf(buf + *len, remaining_len, spec_str, stars[0], stars[1], value);    \
+        } else if (spec->width_star) {                                                             \
+            written = snprintf(buf + *len, remaining_len, spec_str, stars[0], value);              \
+        } else if (spec->precision_star) {                                                         \
+            written = snprintf(buf + *len, remaining_len, spec_str, stars[1], value);              \
+        } else {                                                                                   \
+            written = snprintf(buf + *len, remaining_len, spec_str, value);                        \
+        }                                                                                          \
+    } while (0)
+
+static bool append_spec(char* buf, size_t buf_size, size_t* len, const char* spec_str, const spec_t* spec, const int* stars, const uint8_t* args, size_t args_len, size_t* offset) {
+    size_t remaining_len = buf_size - *len;
+    int    written       = 0;
+
+    if (spec->kind == SPEC_KIND_NONE) {
+        buf[(*len)++] = '%';
+        return true;
+    }
+    if (spec->kind == SPEC_KIND_UNSUPPORTED) {
+        return true;
+    }
+
+    if (spec->kind == SPEC_KIND_STRING) {
+        if (!args || *offset >= args_len) {
+            return false;
+        }
+
+        const char* value   = (const char*)(args + *offset);
+        size_t      str_len = strnlen(value, args_len - *offset);
+        if (*offset + str_len >= args_len) {
+            return false;
+        }
+        *offset += str_len + 1;
+
+        APPEND_WITH_STARS(value);
+    } else {
+        uint8_t raw[16];
+        size_t  raw_len = arg_size(spec);
+        if (raw_len == 0 || raw_len > sizeof(raw) || !get_bytes(args, args_len, offset, raw, raw_len)) {
+            return false;
+        }
+
+        if (spec->kind == SPEC_KIND_DOUBLE) {
+            if (spec->length == SPEC_LENGTH_BIG_L) {
+                long double value;
+                memcpy(&value, raw, sizeof(value));
+                APPEND_WITH_STARS(value);
+            } else {
+                double value;
+                memcpy(&value, raw, sizeof(value));
+                APPEND_WITH_STARS(value);
+            }
+        } else if (spec->kind == SPEC_KIND_POINTER) {
+            void* value;
+            memcpy(&value, raw, sizeof(value));
+            APPEND_WITH_STARS(value);
+        } else if (raw_len == sizeof(long long) && raw_len != sizeof(long)) {
+            long long value;
+            memcpy(&value, raw, sizeof(value));
+            APPEND_WITH_STARS(value);
+        } else if (raw_len == sizeof(long) && raw_len != sizeof(int)) {
+            long value;
+            memcpy(&value, raw, sizeof(value));
+            APPEND_WITH_STARS(value);
+        } else {
+            int value;
+            memcpy(&value, raw, sizeof(value));
+            APPEND_WITH_STARS(value);
+        }
+    }
+
+    if (written < 0) {
+        return false;
+    }
+    if ((size_t)written >= remaining_len) {
+        *len = buf_size - 1;
+        return false;
+    }
+
+    *len += (size_t)written;
+
+    return true;
+}
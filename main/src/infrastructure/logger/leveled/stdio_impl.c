@@ -88,6 +88,7 @@ dom_contracts_logger_leveled_t* inf_logger_leveled_stdio_impl_new(const inf_logg
         return NULL;
     }
 
+    self->level           = ctx->cfg.level;
     self->error           = error_impl;
     self->warn            = warn_impl;
     self->info            = info_impl;
@@ -22,6 +22,10 @@ static dom_models_error_t send_log_impl(
     dom_contracts_messaging_publish_t* self,
     const dom_models_messaging_log_t*  log
 );
+static dom_models_error_t send_log_batch_impl(
+    dom_contracts_messaging_publish_t*      self,
+    const dom_models_messaging_log_batch_t* batch
+);
 static dom_models_error_t is_connected_impl(
     dom_contracts_messaging_publish_t* self,
     bool*                              out
@@ -62,6 +66,12 @@ dom_contracts_messaging_publish_t* inf_messaging_publish_esp_mqtt_impl_new(
         return NULL;
     }
 
+    err = inf_messaging_publish_esp_mqtt_impl_init_topics(ctx);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        free(ctx);
+        return NULL;
+    }
+
     dom_contracts_messaging_publish_t* self = dom_contracts_messaging_publish_new(ctx);
     if (!self) {
         free(ctx);
@@ -71,6 +81,7 @@ dom_contracts_messaging_publish_t* inf_messaging_publish_esp_mqtt_impl_new(
     self->send_registration = send_registration_impl;
     self->send_status       = send_status_impl;
     self->send_log          = send_log_impl;
+    self->send_log_batch    = send_log_batch_impl;
     self->is_connected      = is_connected_impl;
 
     esp_err_t event_err = esp_mqtt_client_register_event(
@@ -122,10 +133,17 @@ static dom_models_error_t send_registration_impl(
 
     inf_messaging_publish_esp_mqtt_impl_ctx_t* ctx = self->ctx;
 
-    return inf_messaging_publish_esp_mqtt_impl_publish_json(
+    char   json[INF_MESSAGING_PUBLISH_ESP_MQTT_IMPL_REGISTRATION_JSON_MAX_LEN];
+    size_t json_len = inf_messaging_publish_esp_mqtt_impl_build_registration_json(registration, json, sizeof(json));
+    if (json_len == 0) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    return inf_messaging_publish_esp_mqtt_impl_publish_payload(
         ctx,
         "/pub/reg",
-        inf_messaging_publish_esp_mqtt_impl_build_registration_json(registration),
+        json,
+        json_len,
         ctx->cfg.registration_retained
     );
 }
@@ -143,16 +161,17 @@ static dom_models_error_t send_status_impl(
 
     inf_messaging_publish_esp_mqtt_impl_ctx_t* ctx = self->ctx;
 
-    char               topic[DOM_MODELS_MESSAGING_TOPIC_MAX_LEN];
-    dom_models_error_t err = inf_messaging_publish_esp_mqtt_impl_build_device_topic(ctx, "status", topic, sizeof(topic));
-    if (err != DOMAIN_MODELS_ERROR_OK) {
-        return err;
+    char   json[INF_MESSAGING_PUBLISH_ESP_MQTT_IMPL_JSON_MAX_LEN];
+    size_t json_len = inf_messaging_publish_esp_mqtt_impl_build_status_json(status, json, sizeof(json));
+    if (json_len == 0) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
-    return inf_messaging_publish_esp_mqtt_impl_publish_json(
+    return inf_messaging_publish_esp_mqtt_impl_publish_payload(
         ctx,
-        topic,
-        inf_messaging_publish_esp_mqtt_impl_build_status_json(status),
+        inf_messaging_publish_esp_mqtt_impl_device_topic(ctx, INF_MESSAGING_PUBLISH_ESP_MQTT_IMPL_TOPIC_STATUS),
+        json,
+        json_len,
         ctx->cfg.status_retained
     );
 }
@@ -170,16 +189,40 @@ static dom_models_error_t send_log_impl(
 
     inf_messaging_publish_esp_mqtt_impl_ctx_t* ctx = self->ctx;
 
-    char               topic[DOM_MODELS_MESSAGING_TOPIC_MAX_LEN];
-    dom_models_error_t err = inf_messaging_publish_esp_mqtt_impl_build_device_topic(ctx, "log", topic, sizeof(topic));
-    if (err != DOMAIN_MODELS_ERROR_OK) {
-        return err;
+    char   json[INF_MESSAGING_PUBLISH_ESP_MQTT_IMPL_JSON_MAX_LEN];
+    size_t json_len = inf_messaging_publish_esp_mqtt_impl_build_log_json(log, json, sizeof(json));
+    if (json_len == 0) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
-    return inf_messaging_publish_esp_mqtt_impl_publish_json(
+    return inf_messaging_publish_esp_mqtt_impl_publish_payload(
+        ctx,
+        inf_messaging_publish_esp_mqtt_impl_device_topic(ctx, INF_MESSAGING_PUBLISH_ESP_MQTT_IMPL_TOPIC_LOG),
+        json,
+        json_len,
+        ctx->cfg.log_retained
+    );
+}
+
+static dom_models_error_t send_log_batch_impl(
+    dom_contracts_messaging_publish_t*      self,
+    const dom_models_messaging_log_batch_t* batch
+) {
+    if (!self || !self->ctx || !batch) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+    if (!inf_messaging_publish_esp_mqtt_impl_log_batch_valid(batch)) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    inf_messaging_publish_esp_mqtt_impl_ctx_t*  ctx   = self->ctx;
+    inf_messaging_publish_esp_mqtt_impl_topic_t topic = batch->binary ? INF_MESSAGING_PUBLISH_ESP_MQTT_IMPL_TOPIC_LOG_BATCH_BINARY : INF_MESSAGING_PUBLISH_ESP_MQTT_IMPL_TOPIC_LOG_BATCH;
+
+    return inf_messaging_publish_esp_mqtt_impl_publish_payload(
         ctx,
-        topic,
-        inf_messaging_publish_esp_mqtt_impl_build_log_json(log),
+        inf_messaging_publish_esp_mqtt_impl_device_topic(ctx, topic),
+        batch->payload,
+        batch->payload_len,
         ctx->cfg.log_retained
     );
 }
@@ -1,12 +1,12 @@
 #include "infrastructure/messaging/publish/esp_mqtt_impl_utils.h"
 
-#include <stdio.h>
 #include <string.h>
 
-#include "cJSON.h"
 #include "domain/models/error.h"
 #include "domain/models/messaging.h"
 #include "mqtt_client.h"
+#include "utils/json/writer.h"
+#include "utils/mqtt/topic_table.h"
 
 /* Helper Function Prototypes */
 
@@ -22,24 +22,37 @@ dom_models_error_t inf_messaging_publish_esp_mqtt_impl_validate_cfg(
     return DOMAIN_MODELS_ERROR_OK;
 }
 
-dom_models_error_t inf_messaging_publish_esp_mqtt_impl_build_device_topic(
-    const inf_messaging_publish_esp_mqtt_impl_ctx_t* ctx,
-    const char*                                      suffix,
-    char*                                            out,
-    size_t                                           out_size
+dom_models_error_t inf_messaging_publish_esp_mqtt_impl_init_topics(
+    inf_messaging_publish_esp_mqtt_impl_ctx_t* ctx
 ) {
-    if (!ctx || !cstr_available(ctx->cfg.device_id_str) || !cstr_available(suffix) || !out || out_size == 0) {
+    static const char* const suffixes[INF_MESSAGING_PUBLISH_ESP_MQTT_IMPL_TOPIC_CNT] = {
+        [INF_MESSAGING_PUBLISH_ESP_MQTT_IMPL_TOPIC_STATUS]           = "status",
+        [INF_MESSAGING_PUBLISH_ESP_MQTT_IMPL_TOPIC_LOG]              = "log",
+        [INF_MESSAGING_PUBLISH_ESP_MQTT_IMPL_TOPIC_LOG_BATCH]        = "logs",
+        [INF_MESSAGING_PUBLISH_ESP_MQTT_IMPL_TOPIC_LOG_BATCH_BINARY] = "logs/bin",
+    };
+
+    if (!ctx || !utils_mqtt_topic_table_init(&ctx->topics, "pub", ctx->cfg.device_id_str)) {
         return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
-    int written = snprintf(out, out_size, "/pub/%s/%s", ctx->cfg.device_id_str, suffix);
-    if (written <= 0 || (size_t)written >= out_size) {
-        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    for (int i = 0; i < INF_MESSAGING_PUBLISH_ESP_MQTT_IMPL_TOPIC_CNT; i++) {
+        if (utils_mqtt_topic_table_add(&ctx->topics, suffixes[i]) != i) {
+            return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+        }
     }
 
     return DOMAIN_MODELS_ERROR_OK;
 }
 
+const char* inf_messaging_publish_esp_mqtt_impl_device_topic(
+    const inf_messaging_publish_esp_mqtt_impl_ctx_t* ctx,
+    inf_messaging_publish_esp_mqtt_impl_topic_t      topic
+) {
+    const utils_mqtt_topic_t* entry = ctx ? utils_mqtt_topic_table_get(&ctx->topics, (int)topic) : NULL;
+    return entry ? entry->str : NULL;
+}
+
 bool inf_messaging_publish_esp_mqtt_impl_registration_valid(
     const dom_models_messaging_registration_t* registration
 ) {
@@ -64,104 +77,91 @@ bool inf_messaging_publish_esp_mqtt_impl_log_valid(
     return log && cstr_available(log->message);
 }
 
-char* inf_messaging_publish_esp_mqtt_impl_build_registration_json(
-    const dom_models_messaging_registration_t* registration
+bool inf_messaging_publish_esp_mqtt_impl_log_batch_valid(
+    const dom_models_messaging_log_batch_t* batch
 ) {
-    if (!inf_messaging_publish_esp_mqtt_impl_registration_valid(registration)) {
-        return NULL;
-    }
+    return batch && batch->payload && batch->payload_len > 0 && batch->record_cnt > 0;
+}
 
-    cJSON* root = cJSON_CreateObject();
-    if (!root) {
-        return NULL;
+size_t inf_messaging_publish_esp_mqtt_impl_build_registration_json(
+    const dom_models_messaging_registration_t* registration,
+    char*                                      out,
+    size_t                                     out_size
+) {
+    if (!inf_messaging_publish_esp_mqtt_impl_registration_valid(registration)) {
+        return 0;
     }
 
-    if (!cJSON_AddStringToObject(root, "hardware_mac", registration->hardware_mac) ||
-        !cJSON_AddStringToObject(root, "name", registration->name) ||
-        !cJSON_AddStringToObject(root, "type", registration->type) ||
-        !cJSON_AddStringToObject(root, "firmware_version", registration->firmware_version) ||
-        !cJSON_AddStringToObject(root, "session_key", registration->session_key) ||
-        !cJSON_AddStringToObject(root, "signature", registration->signature)) {
-        cJSON_Delete(root);
-        return NULL;
-    }
+    utils_json_writer_t w;
+    utils_json_writer_init(&w, out, out_size);
 
-    char* json = cJSON_PrintUnformatted(root);
-    cJSON_Delete(root);
+    utils_json_writer_object_begin(&w);
+    utils_json_writer_kv_string(&w, "hardware_mac", registration->hardware_mac);
+    utils_json_writer_kv_string(&w, "name", registration->name);
+    utils_json_writer_kv_string(&w, "type", registration->type);
+    utils_json_writer_kv_string(&w, "firmware_version", registration->firmware_version);
+    utils_json_writer_kv_string(&w, "session_key", registration->session_key);
+    utils_json_writer_kv_string(&w, "signature", registration->signature);
+    utils_json_writer_object_end(&w);
 
-    return json;
+    return utils_json_writer_finish(&w);
 }
 
-char* inf_messaging_publish_esp_mqtt_impl_build_status_json(
-    const dom_models_messaging_status_t* status
+size_t inf_messaging_publish_esp_mqtt_impl_build_status_json(
+    const dom_models_messaging_status_t* status,
+    char*                                out,
+    size_t                               out_size
 ) {
     if (!inf_messaging_publish_esp_mqtt_impl_status_valid(status)) {
-        return NULL;
-    }
-
-    cJSON* root = cJSON_CreateObject();
-    if (!root) {
-        return NULL;
+        return 0;
     }
 
-    if (!cJSON_AddStringToObject(root, "status", status->status)) {
-        cJSON_Delete(root);
-        return NULL;
-    }
+    utils_json_writer_t w;
+    utils_json_writer_init(&w, out, out_size);
 
-    char* json = cJSON_PrintUnformatted(root);
-    cJSON_Delete(root);
+    utils_json_writer_object_begin(&w);
+    utils_json_writer_kv_string(&w, "status", status->status);
+    utils_json_writer_kv_bool(&w, "wifi_connected", status->wifi_connected);
+    utils_json_writer_kv_bool(&w, "ethernet_connected", status->ethernet_connected);
+    utils_json_writer_kv_string(&w, "ip", status->ip);
+    utils_json_writer_kv_uint(&w, "rssi_bucket", status->rssi_bucket);
+    utils_json_writer_kv_bool(&w, "ota_updating", status->ota_updating);
+    utils_json_writer_object_end(&w);
 
-    return json;
+    return utils_json_writer_finish(&w);
 }
 
-char* inf_messaging_publish_esp_mqtt_impl_build_log_json(
-    const dom_models_messaging_log_t* log
+size_t inf_messaging_publish_esp_mqtt_impl_build_log_json(
+    const dom_models_messaging_log_t* log,
+    char*                             out,
+    size_t                            out_size
 ) {
     if (!inf_messaging_publish_esp_mqtt_impl_log_valid(log)) {
-        return NULL;
+        return 0;
     }
 
-    cJSON* root = cJSON_CreateObject();
-    if (!root) {
-        return NULL;
-    }
+    utils_json_writer_t w;
+    utils_json_writer_init(&w, out, out_size);
 
-    if (!cJSON_AddStringToObject(root, "message", log->message)) {
-        cJSON_Delete(root);
-        return NULL;
-    }
+    utils_json_writer_object_begin(&w);
+    utils_json_writer_kv_string(&w, "message", log->message);
+    utils_json_writer_object_end(&w);
 
-    char* json = cJSON_PrintUnformatted(root);
-    cJSON_Delete(root);
-
-    return json;
+    return utils_json_writer_finish(&w);
 }
 
-dom_models_error_t inf_messaging_publish_esp_mqtt_impl_publish_json(
+dom_models_error_t inf_messaging_publish_esp_mqtt_impl_publish_payload(
     const inf_messaging_publish_esp_mqtt_impl_ctx_t* ctx,
     const char*                                      topic,
-    char*                                            json,
+    const char*                                      payload,
+    size_t                                           payload_len,
     bool                                             retained
 ) {
-    if (!ctx || !ctx->cfg.mqtt_client || !cstr_available(topic)) {
-        if (json) {
-            cJSON_free(json);
-        }
-        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
-    }
-    if (!json) {
-        return DOMAIN_MODELS_ERROR_MALLOC_FAILED;
-    }
-
-    size_t len = strlen(json);
-    if (len == 0) {
-        cJSON_free(json);
+    if (!ctx || !ctx->cfg.mqtt_client || !cstr_available(topic) || !payload || payload_len == 0) {
         return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
-    int msg_id = esp_mqtt_client_publish(ctx->cfg.mqtt_client, topic, json, (int)len, ctx->cfg.qos, retained ? 1 : 0);
-    cJSON_free(json);
+    int msg_id = esp_mqtt_client_publish(ctx->cfg.mqtt_client, topic, payload, (int)payload_len, ctx->cfg.qos, retained ? 1 : 0);
     if (msg_id < 0) {
         return DOMAIN_MODELS_ERROR_FAILURE;
     }
@@ -0,0 +1,435 @@
+#include "infrastructure/messaging/publish/outbox_impl.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "domain/contracts/messaging/publish.h"
+#include "domain/models/error.h"
+#include "domain/models/messaging.h"
+#include "freertos/FreeRTOS.h"  // IWYU pragma: keep
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "infrastructure/messaging/publish/outbox_impl_types.h"
+#include "infrastructure/messaging/publish/outbox_impl_utils.h"
+
+/* Helper Function Prototypes */
+
+static bool               should_store(inf_messaging_publish_outbox_impl_ctx_t* ctx);
+static dom_models_error_t store(inf_messaging_publish_outbox_impl_ctx_t* ctx, uint8_t kind, const void* head, size_t head_len, const void* body, size_t body_len);
+static void               replay_burst(inf_messaging_publish_outbox_impl_ctx_t* ctx);
+static void               replay_records(inf_messaging_publish_outbox_impl_ctx_t* ctx);
+static dom_models_error_t replay_record(inf_messaging_publish_outbox_impl_ctx_t* ctx, const inf_messaging_publish_outbox_impl_record_header_t* header);
+static void               free_ctx(inf_messaging_publish_outbox_impl_ctx_t* ctx);
+
+/* Task Function Prototypes */
+
+static void task_impl(void* arg);
+
+/* Contract Function Prototypes */
+
+static dom_models_error_t send_registration_impl(
+    dom_contracts_messaging_publish_t*         self,
+    const dom_models_messaging_registration_t* registration
+);
+static dom_models_error_t send_status_impl(
+    dom_contracts_messaging_publish_t*   self,
+    const dom_models_messaging_status_t* status
+);
+static dom_models_error_t send_log_impl(
+    dom_contracts_messaging_publish_t* self,
+    const dom_models_messaging_log_t*  log
+);
+static dom_models_error_t send_log_batch_impl(
+    dom_contracts_messaging_publish_t*      self,
+    const dom_models_messaging_log_batch_t* batch
+);
+static dom_models_error_t is_connected_impl(
+    dom_contracts_messaging_publish_t* self,
+    bool*                              out
+);
+
+/* Constructor and Destructor */
+
+dom_contracts_messaging_publish_t* inf_messaging_publish_outbox_impl_new(
+    const inf_messaging_publish_outbox_impl_cfg_t* cfg
+) {
+    inf_messaging_publish_outbox_impl_ctx_t* ctx = (inf_messaging_publish_outbox_impl_ctx_t*)calloc(1, sizeof(inf_messaging_publish_outbox_impl_ctx_t));
+    if (!ctx) {
+        return NULL;
+    }
+
+    inf_messaging_publish_outbox_impl_normalize_cfg(&ctx->cfg, cfg);
+
+    dom_models_error_t err = inf_messaging_publish_outbox_impl_validate_cfg(&ctx->cfg);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        free(ctx);
+        return NULL;
+    }
+
+    ctx->lock       = xSemaphoreCreateMutex();
+    ctx->record_buf = (uint8_t*)malloc(ctx->cfg.record_max_len);
+    if (!ctx->lock || !ctx->record_buf) {
+        free_ctx(ctx);
+        return NULL;
+    }
+
+    err = inf_messaging_publish_outbox_impl_open_dir(ctx);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        free_ctx(ctx);
+        return NULL;
+    }
+
+    dom_contracts_messaging_publish_t* self = dom_contracts_messaging_publish_new(ctx);
+    if (!self) {
+        free_ctx(ctx);
+        return NULL;
+    }
+
+    BaseType_t result = xTaskCreate(
+        task_impl,
+        ctx->cfg.task_name,
+        ctx->cfg.task_stack_size,
+        ctx,
+        ctx->cfg.task_priority,
+        &ctx->task_handle
+    );
+    if (result != pdPASS) {
+        ctx->task_handle = NULL;
+        free_ctx(ctx);
+        dom_contracts_messaging_publish_delete(self);
+        return NULL;
+    }
+
+    self->send_registration = send_registration_impl;
+    self->send_status       = send_status_impl;
+    self->send_log          = send_log_impl;
+    self->send_log_batch    = send_log_batch_impl;
+    self->is_connected      = is_connected_impl;
+
+    return self;
+}
+
+void inf_messaging_publish_outbox_impl_delete(dom_contracts_messaging_publish_t* self) {
+    if (!self || !self->ctx) {
+        return;
+    }
+
+    inf_messaging_publish_outbox_impl_ctx_t* ctx = self->ctx;
+
+    ctx->stop_requested = true;
+
+    if (ctx->task_handle) {
+        xTaskNotifyGive(ctx->task_handle);
+
+        TickType_t waited_ticks = 0;
+        TickType_t max_ticks    = pdMS_TO_TICKS(INF_MESSAGING_PUBLISH_OUTBOX_IMPL_STOP_TIMEOUT_MS);
+        while (ctx->task_handle && waited_ticks < max_ticks) {
+            vTaskDelay(1);
+            waited_ticks++;
+        }
+
+        if (ctx->task_handle) {
+            TaskHandle_t task_handle = ctx->task_handle;
+            ctx->task_handle         = NULL;
+            vTaskDelete(task_handle);
+        }
+    }
+
+    free_ctx(ctx);
+    dom_contracts_messaging_publish_delete(self);
+}
+
+/* Public Function Implementations */
+
+dom_models_error_t inf_messaging_publish_outbox_impl_replay_now(dom_contracts_messaging_publish_t* self) {
+    if (!self || !self->ctx) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    inf_messaging_publish_outbox_impl_ctx_t* ctx = self->ctx;
+    if (ctx->task_handle) {
+        xTaskNotifyGive(ctx->task_handle);
+    }
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+dom_models_error_t inf_messaging_publish_outbox_impl_get_stats(
+    dom_contracts_messaging_publish_t*         self,
+    inf_messaging_publish_outbox_impl_stats_t* out
+) {
+    if (!self || !self->ctx || !out) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    inf_messaging_publish_outbox_impl_ctx_t* ctx = self->ctx;
+
+    xSemaphoreTake(ctx->lock, portMAX_DELAY);
+    out->pending_segment_cnt = inf_messaging_publish_outbox_impl_pending(ctx) ? (size_t)(ctx->tail_seq - ctx->head_seq + 1) : 0;
+    out->stored_cnt          = ctx->stored_cnt;
+    out->replayed_cnt        = ctx->replayed_cnt;
+    out->evicted_segment_cnt = ctx->evicted_segment_cnt;
+    out->write_failed_cnt    = ctx->write_failed_cnt;
+    xSemaphoreGive(ctx->lock);
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+/* Contract Function Implementations */
+
+static dom_models_error_t send_registration_impl(
+    dom_contracts_messaging_publish_t*         self,
+    const dom_models_messaging_registration_t* registration
+) {
+    if (!self || !self->ctx || !registration) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    inf_messaging_publish_outbox_impl_ctx_t* ctx   = self->ctx;
+    dom_contracts_messaging_publish_t*       inner = ctx->cfg.inner;
+
+    if (!should_store(ctx)) {
+        dom_models_error_t err = inner->send_registration(inner, registration);
+        if (err != DOMAIN_MODELS_ERROR_FAILURE) {
+            return err;
+        }
+    }
+
+    return store(ctx, INF_MESSAGING_PUBLISH_OUTBOX_IMPL_KIND_REGISTRATION, registration, sizeof(*registration), NULL, 0);
+}
+
+static dom_models_error_t send_status_impl(
+    dom_contracts_messaging_publish_t*   self,
+    const dom_models_messaging_status_t* status
+) {
+    if (!self || !self->ctx || !status) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    inf_messaging_publish_outbox_impl_ctx_t* ctx   = self->ctx;
+    dom_contracts_messaging_publish_t*       inner = ctx->cfg.inner;
+
+    if (!should_store(ctx)) {
+        dom_models_error_t err = inner->send_status(inner, status);
+        if (err != DOMAIN_MODELS_ERROR_FAILURE) {
+            return err;
+        }
+    }
+
+    return store(ctx, INF_MESSAGING_PUBLISH_OUTBOX_IMPL_KIND_STATUS, status, sizeof(*status), NULL, 0);
+}
+
+static dom_models_error_t send_log_impl(
+    dom_contracts_messaging_publish_t* self,
+    const dom_models_messaging_log_t*  log
+) {
+    if (!self || !self->ctx || !log) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    inf_messaging_publish_outbox_impl_ctx_t* ctx   = self->ctx;
+    dom_contracts_messaging_publish_t*       inner = ctx->cfg.inner;
+
+    if (!should_store(ctx)) {
+        dom_models_error_t err = inner->send_log(inner, log);
+        if (err != DOMAIN_MODELS_ERROR_FAILURE) {
+            return err;
+        }
+    }
+
+    return store(ctx, INF_MESSAGING_PUBLISH_OUTBOX_IMPL_KIND_LOG, log->message, strnlen(log->message, sizeof(log->message) - 1), NULL, 0);
+}
+
+static dom_models_error_t send_log_batch_impl(
+    dom_contracts_messaging_publish_t*      self,
+    const dom_models_messaging_log_batch_t* batch
+) {
+    if (!self || !self->ctx || !batch || !batch->payload) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    inf_messaging_publish_outbox_impl_ctx_t* ctx   = self->ctx;
+    dom_contracts_messaging_publish_t*       inner = ctx->cfg.inner;
+
+    if (!should_store(ctx)) {
+        dom_models_error_t err = inner->send_log_batch(inner, batch);
+        if (err != DOMAIN_MODELS_ERROR_FAILURE) {
+            return err;
+        }
+    }
+
+    uint32_t record_cnt = (uint32_t)batch->record_cnt;
+    uint8_t  kind       = batch->binary ? INF_MESSAGING_PUBLISH_OUTBOX_IMPL_KIND_LOG_BATCH_BINARY : INF_MESSAGING_PUBLISH_OUTBOX_IMPL_KIND_LOG_BATCH;
+
+    return store(ctx, kind, &record_cnt, sizeof(record_cnt), batch->payload, batch->payload_len);
+}
+
+static dom_models_error_t is_connected_impl(
+    dom_contracts_messaging_publish_t* self,
+    bool*                              out
+) {
+    if (!self || !self->ctx || !out) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    inf_messaging_publish_outbox_impl_ctx_t* ctx   = self->ctx;
+    dom_contracts_messaging_publish_t*       inner = ctx->cfg.inner;
+
+    return inner->is_connected(inner, out);
+}
+
+/* Task Function Implementations */
+
+static void task_impl(void* arg) {
+    inf_messaging_publish_outbox_impl_ctx_t* ctx = (inf_messaging_publish_outbox_impl_ctx_t*)arg;
+    if (!ctx) {
+        vTaskDelete(NULL);
+        return;
+    }
+
+    while (!ctx->stop_requested) {
+        (void)ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(ctx->cfg.replay_interval_ms));
+        if (ctx->stop_requested) {
+            break;
+        }
+
+        replay_burst(ctx);
+    }
+
+    ctx->task_handle = NULL;
+
+    vTaskDelete(NULL);
+}
+
+/* Helper Function Implementations */
+
+static bool should_store(inf_messaging_publish_outbox_impl_ctx_t* ctx) {
+    xSemaphoreTake(ctx->lock, portMAX_DELAY);
+    bool pending = inf_messaging_publish_outbox_impl_pending(ctx);
+    xSemaphoreGive(ctx->lock);
+
+    /* Anything queued goes first, so new messages queue behind it */
+    if (pending) {
+        return true;
+    }
+
+    bool               connected = false;
+    dom_models_error_t err       = ctx->cfg.inner->is_connected(ctx->cfg.inner, &connected);
+
+    return err != DOMAIN_MODELS_ERROR_OK || !connected;
+}
+
+static dom_models_error_t store(inf_messaging_publish_outbox_impl_ctx_t* ctx, uint8_t kind, const void* head, size_t head_len, const void* body, size_t body_len) {
+    xSemaphoreTake(ctx->lock, portMAX_DELAY);
+    dom_models_error_t err = inf_messaging_publish_outbox_impl_append(ctx, kind, head, head_len, body, body_len);
+    xSemaphoreGive(ctx->lock);
+
+    return err;
+}
+
+static void replay_burst(inf_messaging_publish_outbox_impl_ctx_t* ctx) {
+    replay_records(ctx);
+
+    /* Once per burst keeps flash writes down, a reboot replays at most one burst twice */
+    xSemaphoreTake(ctx->lock, portMAX_DELAY);
+    inf_messaging_publish_outbox_impl_save_cursor(ctx);
+    xSemaphoreGive(ctx->lock);
+}
+
+static void replay_records(inf_messaging_publish_outbox_impl_ctx_t* ctx) {
+    bool               connected = false;
+    dom_models_error_t err       = ctx->cfg.inner->is_connected(ctx->cfg.inner, &connected);
+    if (err != DOMAIN_MODELS_ERROR_OK || !connected) {
+        return;
+    }
+
+    for (size_t i = 0; i < ctx->cfg.replay_burst_cnt && !ctx->stop_requested; i++) {
+        inf_messaging_publish_outbox_impl_record_header_t header;
+
+        xSemaphoreTake(ctx->lock, portMAX_DELAY);
+        err               = inf_messaging_publish_outbox_impl_read(ctx, &header);
+        uint32_t read_seq = ctx->head_seq;
+        size_t   read_off = ctx->head_offset;
+        xSemaphoreGive(ctx->lock);
+
+        if (err != DOMAIN_MODELS_ERROR_OK) {
+            return;
+        }
+
+        /* Only the transport failing keeps the record, anything else would fail again */
+        err = replay_record(ctx, &header);
+        if (err == DOMAIN_MODELS_ERROR_FAILURE) {
+            return;
+        }
+
+        xSemaphoreTake(ctx->lock, portMAX_DELAY);
+        if (ctx->head_seq == read_seq && ctx->head_offset == read_off) {
+            inf_messaging_publish_outbox_impl_advance(ctx, &header);
+            if (err == DOMAIN_MODELS_ERROR_OK) {
+                ctx->replayed_cnt++;
+            }
+        }
+        xSemaphoreGive(ctx->lock);
+    }
+}
+
+static dom_models_error_t replay_record(inf_messaging_publish_outbox_impl_ctx_t* ctx, const inf_messaging_publish_outbox_impl_record_header_t* header) {
+    dom_contracts_messaging_publish_t* inner = ctx->cfg.inner;
+
+    switch (header->kind) {
+        case INF_MESSAGING_PUBLISH_OUTBOX_IMPL_KIND_REGISTRATION: {
+            dom_models_messaging_registration_t registration;
+            if (header->len != sizeof(registration)) {
+                return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+            }
+            memcpy(&registration, ctx->record_buf, sizeof(registration));
+            return inner->send_registration(inner, &registration);
+        }
+        case INF_MESSAGING_PUBLISH_OUTBOX_IMPL_KIND_STATUS: {
+            dom_models_messaging_status_t status;
+            if (header->len != sizeof(status)) {
+                return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+            }
+            memcpy(&status, ctx->record_buf, sizeof(status));
+            return inner->send_status(inner, &status);
+        }
+        case INF_MESSAGING_PUBLISH_OUTBOX_IMPL_KIND_LOG: {
+            dom_models_messaging_log_t log = {0};
+            if (header->len >= sizeof(log.message)) {
+                return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+            }
+            memcpy(log.message, ctx->record_buf, header->len);
+            return inner->send_log(inner, &log);
+        }
+        case INF_MESSAGING_PUBLISH_OUTBOX_IMPL_KIND_LOG_BATCH:
+        case INF_MESSAGING_PUBLISH_OUTBOX_IMPL_KIND_LOG_BATCH_BINARY: {
+            uint32_t record_cnt = 0;
+            if (header->len <= sizeof(record_cnt)) {
+                return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+            }
+            memcpy(&record_cnt, ctx->record_buf, sizeof(record_cnt));
+
+            dom_models_messaging_log_batch_t batch = {
+                .payload     = (const char*)ctx->record_buf + sizeof(record_cnt),
+                .payload_len = header->len - sizeof(record_cnt),
+                .record_cnt  = record_cnt,
+                .binary      = header->kind == INF_MESSAGING_PUBLISH_OUTBOX_IMPL_KIND_LOG_BATCH_BINARY,
+            };
+            return inner->send_log_batch(inner, &batch);
+        }
+        default:
+            return DOMAIN_MODELS_ERROR_NOT_SUPPORTED;
+    }
+}
+
+static void free_ctx(inf_messaging_publish_outbox_impl_ctx_t* ctx) {
+    if (!ctx) {
+        return;
+    }
+
+    if (ctx->lock) {
+        vSemaphoreDelete(ctx->lock);
+    }
+    free(ctx->record_buf);
+    free(ctx);
+}
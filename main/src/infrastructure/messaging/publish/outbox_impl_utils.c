@@ -0,0 +1,386 @@
+#include "infrastructure/messaging/publish/outbox_impl_utils.h"
+
+#include <dirent.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "domain/models/error.h"
+#include "infrastructure/messaging/publish/outbox_impl_types.h"
+
+/* Helper Function Prototypes */
+
+static bool cstr_available(const char* value);
+static bool build_segment_path(const inf_messaging_publish_outbox_impl_ctx_t* ctx, uint32_t seq, char* out, size_t out_size);
+static bool build_file_path(const inf_messaging_publish_outbox_impl_ctx_t* ctx, const char* name, char* out, size_t out_size);
+static void load_cursor(inf_messaging_publish_outbox_impl_ctx_t* ctx);
+static bool parse_segment_name(const char* name, uint32_t* out_seq);
+static void drop_head_segment(inf_messaging_publish_outbox_impl_ctx_t* ctx);
+
+dom_models_error_t inf_messaging_publish_outbox_impl_validate_cfg(
+    const inf_messaging_publish_outbox_impl_cfg_t* cfg
+) {
+    if (!cfg ||
+        !cfg->inner ||
+        !cfg->inner->send_registration ||
+        !cfg->inner->send_status ||
+        !cfg->inner->send_log ||
+        !cfg->inner->send_log_batch ||
+        !cfg->inner->is_connected ||
+        !cstr_available(cfg->dir_path)) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+    if (cfg->record_max_len + sizeof(inf_messaging_publish_outbox_impl_record_header_t) > cfg->segment_max_bytes) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+void inf_messaging_publish_outbox_impl_normalize_cfg(
+    inf_messaging_publish_outbox_impl_cfg_t*       out,
+    const inf_messaging_publish_outbox_impl_cfg_t* cfg
+) {
+    inf_messaging_publish_outbox_impl_cfg_t default_cfg = INF_MESSAGING_PUBLISH_OUTBOX_IMPL_CFG_DEFAULT();
+    memcpy(out, cfg ? cfg : &default_cfg, sizeof(inf_messaging_publish_outbox_impl_cfg_t));
+
+    if (!cstr_available(out->dir_path)) {
+        out->dir_path = INF_MESSAGING_PUBLISH_OUTBOX_IMPL_DEFAULT_DIR_PATH;
+    }
+    if (out->segment_max_bytes == 0) {
+        out->segment_max_bytes = INF_MESSAGING_PUBLISH_OUTBOX_IMPL_DEFAULT_SEGMENT_MAX_BYTES;
+    }
+    if (out->segment_max_cnt < 2) {
+        out->segment_max_cnt = INF_MESSAGING_PUBLISH_OUTBOX_IMPL_DEFAULT_SEGMENT_MAX_CNT;
+    }
+    if (out->record_max_len == 0) {
+        out->record_max_len = INF_MESSAGING_PUBLISH_OUTBOX_IMPL_DEFAULT_RECORD_MAX_LEN;
+    }
+    if (out->replay_interval_ms == 0) {
+        out->replay_interval_ms = INF_MESSAGING_PUBLISH_OUTBOX_IMPL_DEFAULT_REPLAY_INTERVAL_MS;
+    }
+    if (out->replay_burst_cnt == 0) {
+        out->replay_burst_cnt = INF_MESSAGING_PUBLISH_OUTBOX_IMPL_DEFAULT_REPLAY_BURST_CNT;
+    }
+    if (!cstr_available(out->task_name)) {
+        out->task_name = INF_MESSAGING_PUBLISH_OUTBOX_IMPL_DEFAULT_TASK_NAME;
+    }
+    if (out->task_stack_size == 0) {
+        out->task_stack_size = INF_MESSAGING_PUBLISH_OUTBOX_IMPL_DEFAULT_TASK_STACK_SIZE;
+    }
+    if (out->task_priority == 0) {
+        out->task_priority = INF_MESSAGING_PUBLISH_OUTBOX_IMPL_DEFAULT_TASK_PRIORITY;
+    }
+}
+
+dom_models_error_t inf_messaging_publish_outbox_impl_open_dir(
+    inf_messaging_publish_outbox_impl_ctx_t* ctx
+) {
+    if (!ctx) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    if (mkdir(ctx->cfg.dir_path, 0775) != 0 && errno != EEXIST) {
+        return DOMAIN_MODELS_ERROR_FAILURE;
+    }
+
+    DIR* dir = opendir(ctx->cfg.dir_path);
+    if (!dir) {
+        return DOMAIN_MODELS_ERROR_FAILURE;
+    }
+
+    bool     found    = false;
+    uint32_t head_seq = 0;
+    uint32_t tail_seq = 0;
+
+    struct dirent* entry = NULL;
+    while ((entry = readdir(dir)) != NULL) {
+        uint32_t seq = 0;
+        if (!parse_segment_name(entry->d_name, &seq)) {
+            continue;
+        }
+
+        if (!found || seq < head_seq) {
+            head_seq = seq;
+        }
+        if (!found || seq > tail_seq) {
+            tail_seq = seq;
+        }
+        found = true;
+    }
+    closedir(dir);
+
+    ctx->head_seq    = head_seq;
+    ctx->tail_seq    = tail_seq;
+    ctx->head_offset = 0;
+    ctx->tail_size   = 0;
+
+    char path[INF_MESSAGING_PUBLISH_OUTBOX_IMPL_PATH_MAX_LEN];
+    if (found) {
+        struct stat st;
+        if (build_segment_path(ctx, tail_seq, path, sizeof(path)) && stat(path, &st) == 0) {
+            ctx->tail_size = (size_t)st.st_size;
+        }
+        load_cursor(ctx);
+    } else if (build_file_path(ctx, INF_MESSAGING_PUBLISH_OUTBOX_IMPL_CURSOR_NAME, path, sizeof(path))) {
+        /* Sequence numbers restart from 0, an old cursor could match a new segment */
+        unlink(path);
+    }
+
+    ctx->cursor_seq    = ctx->head_seq;
+    ctx->cursor_offset = ctx->head_offset;
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+bool inf_messaging_publish_outbox_impl_pending(
+    const inf_messaging_publish_outbox_impl_ctx_t* ctx
+) {
+    return ctx && (ctx->head_seq != ctx->tail_seq || ctx->head_offset < ctx->tail_size);
+}
+
+dom_models_error_t inf_messaging_publish_outbox_impl_append(
+    inf_messaging_publish_outbox_impl_ctx_t* ctx,
+    uint8_t                                  kind,
+    const void*                              head,
+    size_t                                   head_len,
+    const void*                              body,
+    size_t                                   body_len
+) {
+    if (!ctx || (!head && head_len > 0) || (!body && body_len > 0)) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+    if (head_len + body_len > ctx->cfg.record_max_len) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    inf_messaging_publish_outbox_impl_record_header_t header = {
+        .magic    = INF_MESSAGING_PUBLISH_OUTBOX_IMPL_RECORD_MAGIC,
+        .kind     = kind,
+        .reserved = 0,
+        .len      = (uint32_t)(head_len + body_len),
+    };
+    size_t record_len = sizeof(header) + header.len;
+
+    if (ctx->tail_size > 0 && ctx->tail_size + record_len > ctx->cfg.segment_max_bytes) {
+        ctx->tail_seq++;
+        ctx->tail_size = 0;
+    }
+    while (ctx->tail_seq - ctx->head_seq + 1 > ctx->cfg.segment_max_cnt) {
+        drop_head_segment(ctx);
+        ctx->evicted_segment_cnt++;
+    }
+
+    char path[INF_MESSAGING_PUBLISH_OUTBOX_IMPL_PATH_MAX_LEN];
+    if (!build_segment_path(ctx, ctx->tail_seq, path, sizeof(path))) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    FILE* file = fopen(path, "ab");
+    if (!file) {
+        ctx->write_failed_cnt++;
+        return DOMAIN_MODELS_ERROR_FAILURE;
+    }
+
+    bool written = fwrite(&header, sizeof(header), 1, file) == 1 &&
+                   (head_len == 0 || fwrite(head, head_len, 1, file) == 1) &&
+                   (body_len == 0 || fwrite(body, body_len, 1, file) == 1);
+    if (fclose(file) != 0) {
+        written = false;
+    }
+
+    if (!written) {
+        /* A torn record ends its segment for the reader, so continue in a new one */
+        ctx->tail_seq++;
+        ctx->tail_size = 0;
+        ctx->write_failed_cnt++;
+        return DOMAIN_MODELS_ERROR_FAILURE;
+    }
+
+    ctx->tail_size += record_len;
+    ctx->stored_cnt++;
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+dom_models_error_t inf_messaging_publish_outbox_impl_read(
+    inf_messaging_publish_outbox_impl_ctx_t*           ctx,
+    inf_messaging_publish_outbox_impl_record_header_t* out_header
+) {
+    if (!ctx || !ctx->record_buf || !out_header) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    while (inf_messaging_publish_outbox_impl_pending(ctx)) {
+        char path[INF_MESSAGING_PUBLISH_OUTBOX_IMPL_PATH_MAX_LEN];
+        if (!build_segment_path(ctx, ctx->head_seq, path, sizeof(path))) {
+            return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+        }
+
+        FILE* file = fopen(path, "rb");
+        if (!file) {
+            drop_head_segment(ctx);
+            continue;
+        }
+
+        bool valid = fseek(file, (long)ctx->head_offset, SEEK_SET) == 0 &&
+                     fread(out_header, sizeof(*out_header), 1, file) == 1 &&
+                     out_header->magic == INF_MESSAGING_PUBLISH_OUTBOX_IMPL_RECORD_MAGIC &&
+                     out_header->len <= ctx->cfg.record_max_len &&
+                     (out_header->len == 0 || fread(ctx->record_buf, out_header->len, 1, file) == 1);
+        fclose(file);
+
+        if (valid) {
+            return DOMAIN_MODELS_ERROR_OK;
+        }
+
+        /* End of segment, or a torn or corrupt record that ends it */
+        drop_head_segment(ctx);
+    }
+
+    return DOMAIN_MODELS_ERROR_NOT_FOUND;
+}
+
+void inf_messaging_publish_outbox_impl_advance(
+    inf_messaging_publish_outbox_impl_ctx_t*                 ctx,
+    const inf_messaging_publish_outbox_impl_record_header_t* header
+) {
+    if (!ctx || !header) {
+        return;
+    }
+
+    ctx->head_offset += sizeof(*header) + header->len;
+    if (ctx->head_seq == ctx->tail_seq && ctx->head_offset >= ctx->tail_size) {
+        drop_head_segment(ctx);
+    }
+}
+
+void inf_messaging_publish_outbox_impl_save_cursor(
+    inf_messaging_publish_outbox_impl_ctx_t* ctx
+) {
+    if (!ctx || (ctx->cursor_seq == ctx->head_seq && ctx->cursor_offset == ctx->head_offset)) {
+        return;
+    }
+
+    char path[INF_MESSAGING_PUBLISH_OUTBOX_IMPL_PATH_MAX_LEN];
+    char tmp_path[INF_MESSAGING_PUBLISH_OUTBOX_IMPL_PATH_MAX_LEN];
+    if (!build_file_path(ctx, INF_MESSAGING_PUBLISH_OUTBOX_IMPL_CURSOR_NAME, path, sizeof(path)) ||
+        !build_file_path(ctx, INF_MESSAGING_PUBLISH_OUTBOX_IMPL_CURSOR_NAME ".tmp", tmp_path, sizeof(tmp_path))) {
+        return;
+    }
+
+    inf_messaging_publish_outbox_impl_cursor_t cursor = {
+        .magic    = INF_MESSAGING_PUBLISH_OUTBOX_IMPL_CURSOR_MAGIC,
+        .reserved = 0,
+        .seq      = ctx->head_seq,
+        .offset   = (uint32_t)ctx->head_offset,
+    };
+
+    FILE* file = fopen(tmp_path, "wb");
+    if (!file) {
+        ctx->write_failed_cnt++;
+        return;
+    }
+
+    bool written = fwrite(&cursor, sizeof(cursor), 1, file) == 1;
+    if (fclose(file) != 0) {
+        written = false;
+    }
+
+    /* The rename swaps the cursor in whole, a torn write only loses the temporary file */
+    if (written && rename(tmp_path, path) != 0) {
+        unlink(path);
+        written = rename(tmp_path, path) == 0;
+    }
+    if (!written) {
+        unlink(tmp_path);
+        ctx->write_failed_cnt++;
+        return;
+    }
+
+    ctx->cursor_seq    = cursor.seq;
+    ctx->cursor_offset = cursor.offset;
+}
+
+/* Helper Function Implementations */
+
+static bool cstr_available(const char* value) {
+    return value && value[0] != '\0';
+}
+
+static bool build_segment_path(const inf_messaging_publish_outbox_impl_ctx_t* ctx, uint32_t seq, char* out, size_t out_size) {
+    int written = snprintf(out, out_size, "%s/%08" PRIu32 ".seg", ctx->cfg.dir_path, seq);
+    return written > 0 && (size_t)written < out_size;
+}
+
+static bool build_file_path(const inf_messaging_publish_outbox_impl_ctx_t* ctx, const char* name, char* out, size_t out_size) {
+    int written = snprintf(out, out_size, "%s/%s", ctx->cfg.dir_path, name);
+    return written > 0 && (size_t)written < out_size;
+}
+
+static void load_cursor(inf_messaging_publish_outbox_impl_ctx_t* ctx) {
+    char path[INF_MESSAGING_PUBLISH_OUTBOX_IMPL_PATH_MAX_LEN];
+    if (!build_file_path(ctx, INF_MESSAGING_PUBLISH_OUTBOX_IMPL_CURSOR_NAME, path, sizeof(path))) {
+        return;
+    }
+
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        return;
+    }
+
+    inf_messaging_publish_outbox_impl_cursor_t cursor;
+    bool                                       valid = fread(&cursor, sizeof(cursor), 1, file) == 1;
+    fclose(file);
+
+    /* A cursor for a segment already dropped means the head starts from 0 */
+    if (!valid || cursor.magic != INF_MESSAGING_PUBLISH_OUTBOX_IMPL_CURSOR_MAGIC || cursor.seq != ctx->head_seq) {
+        return;
+    }
+
+    struct stat st;
+    if (!build_segment_path(ctx, ctx->head_seq, path, sizeof(path)) || stat(path, &st) != 0 || cursor.offset > (size_t)st.st_size) {
+        return;
+    }
+
+    ctx->head_offset = cursor.offset;
+}
+
+static bool parse_segment_name(const char* name, uint32_t* out_seq) {
+    if (!name || strlen(name) != 12 || strcmp(name + 8, ".seg") != 0) {
+        return false;
+    }
+
+    uint32_t seq = 0;
+    for (size_t i = 0; i < 8; i++) {
+        if (name[i] < '0' || name[i] > '9') {
+            return false;
+        }
+        seq = (seq * 10) + (uint32_t)(name[i] - '0');
+    }
+
+    *out_seq = seq;
+
+    return true;
+}
+
+static void drop_head_segment(inf_messaging_publish_outbox_impl_ctx_t* ctx) {
+    char path[INF_MESSAGING_PUBLISH_OUTBOX_IMPL_PATH_MAX_LEN];
+    if (build_segment_path(ctx, ctx->head_seq, path, sizeof(path))) {
+        unlink(path);
+    }
+
+    ctx->head_offset = 0;
+
+    /* Draining moves on to a fresh number too, so a saved cursor never names a later segment */
+    if (ctx->head_seq == ctx->tail_seq) {
+        ctx->tail_seq++;
+        ctx->tail_size = 0;
+    }
+
+    ctx->head_seq++;
+}
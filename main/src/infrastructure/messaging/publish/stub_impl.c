@@ -21,6 +21,10 @@ static dom_models_error_t send_log_impl(
     dom_contracts_messaging_publish_t* self,
     const dom_models_messaging_log_t*  log
 );
+static dom_models_error_t send_log_batch_impl(
+    dom_contracts_messaging_publish_t*      self,
+    const dom_models_messaging_log_batch_t* batch
+);
 static dom_models_error_t is_connected_impl(
     dom_contracts_messaging_publish_t* self,
     bool*                              out
@@ -52,6 +56,7 @@ dom_contracts_messaging_publish_t* inf_messaging_publish_stub_impl_new(
     self->send_registration = send_registration_impl;
     self->send_status       = send_status_impl;
     self->send_log          = send_log_impl;
+    self->send_log_batch    = send_log_batch_impl;
     self->is_connected      = is_connected_impl;
 
     return self;
@@ -101,6 +106,17 @@ static dom_models_error_t send_log_impl(
     return inf_messaging_publish_stub_impl_set_log(self->ctx, log);
 }
 
+static dom_models_error_t send_log_batch_impl(
+    dom_contracts_messaging_publish_t*      self,
+    const dom_models_messaging_log_batch_t* batch
+) {
+    if (!self || !self->ctx) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    return inf_messaging_publish_stub_impl_set_log_batch(self->ctx, batch);
+}
+
 static dom_models_error_t is_connected_impl(
     dom_contracts_messaging_publish_t* self,
     bool*                              out
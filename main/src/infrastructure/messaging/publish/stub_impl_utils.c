@@ -37,10 +37,12 @@ dom_models_error_t inf_messaging_publish_stub_impl_load_cfg(
         }
     }
 
-    ctx->registration_publish_cnt = 0;
-    ctx->status_publish_cnt       = 0;
-    ctx->log_publish_cnt          = 0;
-    ctx->connected                = cfg->connected;
+    ctx->registration_publish_cnt   = 0;
+    ctx->status_publish_cnt         = 0;
+    ctx->log_publish_cnt            = 0;
+    ctx->log_batch_publish_cnt      = 0;
+    ctx->log_batch_record_total_cnt = 0;
+    ctx->connected                  = cfg->connected;
 
     return DOMAIN_MODELS_ERROR_OK;
 }
@@ -96,6 +98,31 @@ dom_models_error_t inf_messaging_publish_stub_impl_set_log(
     return DOMAIN_MODELS_ERROR_OK;
 }
 
+dom_models_error_t inf_messaging_publish_stub_impl_set_log_batch(
+    inf_messaging_publish_stub_impl_ctx_t*  ctx,
+    const dom_models_messaging_log_batch_t* batch
+) {
+    if (!ctx || !batch || !batch->payload || batch->payload_len == 0 || batch->record_cnt == 0) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    size_t copy_len = batch->payload_len;
+    if (copy_len >= sizeof(ctx->log_batch)) {
+        copy_len = sizeof(ctx->log_batch) - 1;
+    }
+
+    memcpy(ctx->log_batch, batch->payload, copy_len);
+    ctx->log_batch[copy_len]  = '\0';
+    ctx->log_batch_len        = batch->payload_len;
+    ctx->log_batch_record_cnt = batch->record_cnt;
+    ctx->log_batch_binary     = batch->binary;
+    ctx->log_batch_available  = true;
+    ctx->log_batch_publish_cnt++;
+    ctx->log_batch_record_total_cnt += batch->record_cnt;
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
 /* Helper Function Implementations */
 
 static bool cstr_available(const char* value) {
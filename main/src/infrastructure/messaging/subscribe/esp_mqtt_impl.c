@@ -38,6 +38,12 @@ dom_contracts_messaging_subscribe_t* inf_messaging_subscribe_esp_mqtt_impl_new(
         return NULL;
     }
 
+    err = inf_messaging_subscribe_esp_mqtt_impl_init_topics(ctx);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        free(ctx);
+        return NULL;
+    }
+
     dom_contracts_messaging_subscribe_t* self = dom_contracts_messaging_subscribe_new(ctx);
     if (!self) {
         free(ctx);
@@ -69,7 +75,7 @@ static dom_models_error_t subscribe_registration_ack_impl(
         return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
-    return inf_messaging_subscribe_esp_mqtt_impl_subscribe_suffix(self->ctx, "reg_ack");
+    return inf_messaging_subscribe_esp_mqtt_impl_subscribe_topic(self->ctx, INF_MESSAGING_SUBSCRIBE_ESP_MQTT_IMPL_TOPIC_REGISTRATION_ACK);
 }
 
 static dom_models_error_t subscribe_update_impl(
@@ -79,7 +85,7 @@ static dom_models_error_t subscribe_update_impl(
         return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
-    return inf_messaging_subscribe_esp_mqtt_impl_subscribe_suffix(self->ctx, "update");
+    return inf_messaging_subscribe_esp_mqtt_impl_subscribe_topic(self->ctx, INF_MESSAGING_SUBSCRIBE_ESP_MQTT_IMPL_TOPIC_UPDATE);
 }
 
 static dom_models_error_t subscribe_restart_impl(
@@ -89,5 +95,5 @@ static dom_models_error_t subscribe_restart_impl(
         return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
-    return inf_messaging_subscribe_esp_mqtt_impl_subscribe_suffix(self->ctx, "restart");
+    return inf_messaging_subscribe_esp_mqtt_impl_subscribe_topic(self->ctx, INF_MESSAGING_SUBSCRIBE_ESP_MQTT_IMPL_TOPIC_RESTART);
 }
@@ -1,11 +1,10 @@
 #include "infrastructure/messaging/subscribe/esp_mqtt_impl_utils.h"
 
 #include <stdbool.h>
-#include <stdio.h>
 
 #include "domain/models/error.h"
-#include "domain/models/messaging.h"
 #include "mqtt_client.h"
+#include "utils/mqtt/topic_table.h"
 
 /* Helper Function Prototypes */
 
@@ -21,39 +20,42 @@ dom_models_error_t inf_messaging_subscribe_esp_mqtt_impl_validate_cfg(
     return DOMAIN_MODELS_ERROR_OK;
 }
 
-dom_models_error_t inf_messaging_subscribe_esp_mqtt_impl_build_topic(
-    const inf_messaging_subscribe_esp_mqtt_impl_ctx_t* ctx,
-    const char*                                        suffix,
-    char*                                              out,
-    size_t                                             out_size
+dom_models_error_t inf_messaging_subscribe_esp_mqtt_impl_init_topics(
+    inf_messaging_subscribe_esp_mqtt_impl_ctx_t* ctx
 ) {
-    if (!ctx || !cstr_available(ctx->cfg.device_id_str) || !cstr_available(suffix) || !out || out_size == 0) {
+    static const char* const suffixes[INF_MESSAGING_SUBSCRIBE_ESP_MQTT_IMPL_TOPIC_CNT] = {
+        [INF_MESSAGING_SUBSCRIBE_ESP_MQTT_IMPL_TOPIC_REGISTRATION_ACK] = "reg_ack",
+        [INF_MESSAGING_SUBSCRIBE_ESP_MQTT_IMPL_TOPIC_UPDATE]           = "update",
+        [INF_MESSAGING_SUBSCRIBE_ESP_MQTT_IMPL_TOPIC_RESTART]          = "restart",
+    };
+
+    if (!ctx || !utils_mqtt_topic_table_init(&ctx->topics, "sub", ctx->cfg.device_id_str)) {
         return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
-    int written = snprintf(out, out_size, "/sub/%s/%s", ctx->cfg.device_id_str, suffix);
-    if (written <= 0 || (size_t)written >= out_size) {
-        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    for (int i = 0; i < INF_MESSAGING_SUBSCRIBE_ESP_MQTT_IMPL_TOPIC_CNT; i++) {
+        if (utils_mqtt_topic_table_add(&ctx->topics, suffixes[i]) != i) {
+            return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+        }
     }
 
     return DOMAIN_MODELS_ERROR_OK;
 }
 
-dom_models_error_t inf_messaging_subscribe_esp_mqtt_impl_subscribe_suffix(
+dom_models_error_t inf_messaging_subscribe_esp_mqtt_impl_subscribe_topic(
     const inf_messaging_subscribe_esp_mqtt_impl_ctx_t* ctx,
-    const char*                                        suffix
+    inf_messaging_subscribe_esp_mqtt_impl_topic_t      topic
 ) {
     if (!ctx || !ctx->cfg.mqtt_client) {
         return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
-    char               topic[DOM_MODELS_MESSAGING_TOPIC_MAX_LEN];
-    dom_models_error_t err = inf_messaging_subscribe_esp_mqtt_impl_build_topic(ctx, suffix, topic, sizeof(topic));
-    if (err != DOMAIN_MODELS_ERROR_OK) {
-        return err;
+    const utils_mqtt_topic_t* entry = utils_mqtt_topic_table_get(&ctx->topics, (int)topic);
+    if (!entry) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
-    int msg_id = esp_mqtt_client_subscribe_single(ctx->cfg.mqtt_client, topic, ctx->cfg.qos);
+    int msg_id = esp_mqtt_client_subscribe_single(ctx->cfg.mqtt_client, entry->str, ctx->cfg.qos);
     if (msg_id < 0) {
         return DOMAIN_MODELS_ERROR_FAILURE;
     }
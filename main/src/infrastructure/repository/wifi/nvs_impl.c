@@ -10,17 +10,25 @@
 
 /* Contract Function Prototypes */
 
-static dom_models_error_t get_sta_credential_impl(
+static dom_models_error_t get_sta_profiles_impl(
     dom_contracts_repository_wifi_t* self,
-    dom_models_wifi_sta_credential_t* out
+    dom_models_wifi_sta_profiles_t* out
 );
-static dom_models_error_t set_sta_credential_impl(
+static dom_models_error_t set_sta_profiles_impl(
     dom_contracts_repository_wifi_t* self,
-    const dom_models_wifi_sta_credential_t* credential
+    const dom_models_wifi_sta_profiles_t* profiles
 );
 static dom_models_error_t clear_sta_credential_impl(
     dom_contracts_repository_wifi_t* self
 );
+static dom_models_error_t get_sta_last_ap_impl(
+    dom_contracts_repository_wifi_t* self,
+    dom_models_wifi_sta_last_ap_t* out
+);
+static dom_models_error_t set_sta_last_ap_impl(
+    dom_contracts_repository_wifi_t* self,
+    const dom_models_wifi_sta_last_ap_t* last_ap
+);
 
 /* Constructor and Destructor */
 
@@ -42,9 +50,11 @@ dom_contracts_repository_wifi_t* inf_repository_wifi_nvs_impl_new(const inf_repo
         return NULL;
     }
 
-    self->get_sta_credential   = get_sta_credential_impl;
-    self->set_sta_credential   = set_sta_credential_impl;
+    self->get_sta_profiles     = get_sta_profiles_impl;
+    self->set_sta_profiles     = set_sta_profiles_impl;
     self->clear_sta_credential = clear_sta_credential_impl;
+    self->get_sta_last_ap      = get_sta_last_ap_impl;
+    self->set_sta_last_ap      = set_sta_last_ap_impl;
 
     return self;
 }
@@ -60,9 +70,9 @@ void inf_repository_wifi_nvs_impl_delete(dom_contracts_repository_wifi_t* self)
 
 /* Contract Function Implementations */
 
-static dom_models_error_t get_sta_credential_impl(
+static dom_models_error_t get_sta_profiles_impl(
     dom_contracts_repository_wifi_t* self,
-    dom_models_wifi_sta_credential_t* out
+    dom_models_wifi_sta_profiles_t* out
 ) {
     if (!self || !self->ctx || !out) {
         return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
@@ -70,36 +80,12 @@ static dom_models_error_t get_sta_credential_impl(
 
     inf_repository_wifi_nvs_impl_ctx_t* ctx = self->ctx;
 
-    memset(out, 0, sizeof(dom_models_wifi_sta_credential_t));
-
-    dom_models_error_t err = inf_repository_wifi_nvs_impl_read_string(
-        ctx->cfg.nvs,
-        DOM_MODELS_WIFI_STA_CREDENTIAL_SSID_KEY,
-        out->ssid,
-        sizeof(out->ssid)
-    );
-    if (err != DOMAIN_MODELS_ERROR_OK) {
-        memset(out, 0, sizeof(dom_models_wifi_sta_credential_t));
-        return err;
-    }
-
-    err = inf_repository_wifi_nvs_impl_read_string(
-        ctx->cfg.nvs,
-        DOM_MODELS_WIFI_STA_CREDENTIAL_PASS_KEY,
-        out->password,
-        sizeof(out->password)
-    );
-    if (err != DOMAIN_MODELS_ERROR_OK) {
-        memset(out, 0, sizeof(dom_models_wifi_sta_credential_t));
-        return err;
-    }
-
-    return DOMAIN_MODELS_ERROR_OK;
+    return inf_repository_wifi_nvs_impl_read_profiles(ctx->cfg.nvs, out);
 }
 
-static dom_models_error_t set_sta_credential_impl(
+static dom_models_error_t set_sta_profiles_impl(
     dom_contracts_repository_wifi_t* self,
-    const dom_models_wifi_sta_credential_t* credential
+    const dom_models_wifi_sta_profiles_t* profiles
 ) {
     if (!self || !self->ctx) {
         return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
@@ -107,7 +93,7 @@ static dom_models_error_t set_sta_credential_impl(
 
     inf_repository_wifi_nvs_impl_ctx_t* ctx = self->ctx;
 
-    return inf_repository_wifi_nvs_impl_set_credential(ctx->cfg.nvs, credential);
+    return inf_repository_wifi_nvs_impl_set_profiles(ctx->cfg.nvs, profiles);
 }
 
 static dom_models_error_t clear_sta_credential_impl(
@@ -121,3 +107,29 @@ static dom_models_error_t clear_sta_credential_impl(
 
     return inf_repository_wifi_nvs_impl_clear_credential(ctx->cfg.nvs);
 }
+
+static dom_models_error_t get_sta_last_ap_impl(
+    dom_contracts_repository_wifi_t* self,
+    dom_models_wifi_sta_last_ap_t* out
+) {
+    if (!self || !self->ctx || !out) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    inf_repository_wifi_nvs_impl_ctx_t* ctx = self->ctx;
+
+    return inf_repository_wifi_nvs_impl_read_last_ap(ctx->cfg.nvs, out);
+}
+
+static dom_models_error_t set_sta_last_ap_impl(
+    dom_contracts_repository_wifi_t* self,
+    const dom_models_wifi_sta_last_ap_t* last_ap
+) {
+    if (!self || !self->ctx) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    inf_repository_wifi_nvs_impl_ctx_t* ctx = self->ctx;
+
+    return inf_repository_wifi_nvs_impl_set_last_ap(ctx->cfg.nvs, last_ap);
+}
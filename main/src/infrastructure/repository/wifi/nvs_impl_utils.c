@@ -1,14 +1,22 @@
 #include "infrastructure/repository/wifi/nvs_impl_utils.h"
 
+#include <stdlib.h>
 #include <string.h>
 
 #include "domain/models/wifi.h"
+#include "infrastructure/repository/wifi/nvs_impl_types.h"
 #include "nvs.h"
 
 /* Helper Function Prototypes */
 
 static size_t bounded_strlen(const char* value, size_t max_len);
 static dom_models_error_t validate_credential(const dom_models_wifi_sta_credential_t* credential);
+static dom_models_error_t validate_profiles(const dom_models_wifi_sta_profiles_t* profiles);
+static dom_models_error_t validate_last_ap(const dom_models_wifi_sta_last_ap_t* last_ap);
+static dom_models_error_t read_legacy_credential(nvs_handle_t nvs, dom_models_wifi_sta_profiles_t* out);
+static dom_models_error_t decode_profiles(const uint8_t* blob, size_t len, dom_models_wifi_sta_profiles_t* out);
+static dom_models_error_t decode_profiles_v1(const uint8_t* blob, size_t len, dom_models_wifi_sta_profiles_t* out);
+static size_t encode_profiles(const dom_models_wifi_sta_profiles_t* profiles, uint8_t* out);
 static dom_models_error_t erase_key(nvs_handle_t nvs, const char* key);
 
 dom_models_error_t inf_repository_wifi_nvs_impl_error_from_esp(esp_err_t err) {
@@ -58,26 +66,83 @@ dom_models_error_t inf_repository_wifi_nvs_impl_read_string(nvs_handle_t nvs, co
     return DOMAIN_MODELS_ERROR_OK;
 }
 
-dom_models_error_t inf_repository_wifi_nvs_impl_set_credential(nvs_handle_t nvs, const dom_models_wifi_sta_credential_t* credential) {
+dom_models_error_t inf_repository_wifi_nvs_impl_read_profiles(nvs_handle_t nvs, dom_models_wifi_sta_profiles_t* out) {
+    if (!nvs || !out) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    memset(out, 0, sizeof(dom_models_wifi_sta_profiles_t));
+
+    size_t    len = 0;
+    esp_err_t err = nvs_get_blob(nvs, DOM_MODELS_WIFI_STA_PROFILES_KEY, NULL, &len);
+    if (err == ESP_ERR_NVS_NOT_FOUND) {
+        return read_legacy_credential(nvs, out);
+    }
+    if (err != ESP_OK) {
+        return inf_repository_wifi_nvs_impl_error_from_esp(err);
+    }
+
+    /* Neither the headed nor the version 0 layout gets any longer */
+    if (len == 0 || (len > sizeof(dom_models_wifi_sta_profiles_t) && len > INF_REPOSITORY_WIFI_NVS_IMPL_PROFILES_MAX_LEN)) {
+        return DOMAIN_MODELS_ERROR_NOT_FOUND;
+    }
+
+    uint8_t* blob = (uint8_t*)malloc(len);
+    if (!blob) {
+        return DOMAIN_MODELS_ERROR_MALLOC_FAILED;
+    }
+
+    err = nvs_get_blob(nvs, DOM_MODELS_WIFI_STA_PROFILES_KEY, blob, &len);
+    if (err != ESP_OK) {
+        free(blob);
+        return inf_repository_wifi_nvs_impl_error_from_esp(err);
+    }
+
+    dom_models_error_t result = decode_profiles(blob, len, out);
+    free(blob);
+
+    if (result != DOMAIN_MODELS_ERROR_OK || validate_profiles(out) != DOMAIN_MODELS_ERROR_OK) {
+        memset(out, 0, sizeof(dom_models_wifi_sta_profiles_t));
+        return DOMAIN_MODELS_ERROR_NOT_FOUND;
+    }
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+dom_models_error_t inf_repository_wifi_nvs_impl_set_profiles(nvs_handle_t nvs, const dom_models_wifi_sta_profiles_t* profiles) {
     if (!nvs) {
         return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
-    dom_models_error_t err = validate_credential(credential);
+    dom_models_error_t err = validate_profiles(profiles);
     if (err != DOMAIN_MODELS_ERROR_OK) {
         return err;
     }
 
-    esp_err_t esp_err = nvs_set_str(nvs, DOM_MODELS_WIFI_STA_CREDENTIAL_SSID_KEY, credential->ssid);
-    if (esp_err != ESP_OK) {
-        return inf_repository_wifi_nvs_impl_error_from_esp(esp_err);
+    uint8_t* blob = (uint8_t*)malloc(INF_REPOSITORY_WIFI_NVS_IMPL_PROFILES_MAX_LEN);
+    if (!blob) {
+        return DOMAIN_MODELS_ERROR_MALLOC_FAILED;
     }
 
-    esp_err = nvs_set_str(nvs, DOM_MODELS_WIFI_STA_CREDENTIAL_PASS_KEY, credential->password);
+    /* One blob for the whole store, so a power cut never leaves half of it written */
+    size_t    len     = encode_profiles(profiles, blob);
+    esp_err_t esp_err = nvs_set_blob(nvs, DOM_MODELS_WIFI_STA_PROFILES_KEY, blob, len);
+    free(blob);
     if (esp_err != ESP_OK) {
         return inf_repository_wifi_nvs_impl_error_from_esp(esp_err);
     }
 
+    /* The single credential keys were migrated into the blob, they would only shadow it */
+    err = erase_key(nvs, DOM_MODELS_WIFI_STA_CREDENTIAL_SSID_KEY);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
+    err = erase_key(nvs, DOM_MODELS_WIFI_STA_CREDENTIAL_PASS_KEY);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
     esp_err = nvs_commit(nvs);
     if (esp_err != ESP_OK) {
         return inf_repository_wifi_nvs_impl_error_from_esp(esp_err);
@@ -91,7 +156,12 @@ dom_models_error_t inf_repository_wifi_nvs_impl_clear_credential(nvs_handle_t nv
         return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
-    dom_models_error_t err = erase_key(nvs, DOM_MODELS_WIFI_STA_CREDENTIAL_SSID_KEY);
+    dom_models_error_t err = erase_key(nvs, DOM_MODELS_WIFI_STA_PROFILES_KEY);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
+    err = erase_key(nvs, DOM_MODELS_WIFI_STA_CREDENTIAL_SSID_KEY);
     if (err != DOMAIN_MODELS_ERROR_OK) {
         return err;
     }
@@ -101,6 +171,11 @@ dom_models_error_t inf_repository_wifi_nvs_impl_clear_credential(nvs_handle_t nv
         return err;
     }
 
+    err = erase_key(nvs, DOM_MODELS_WIFI_STA_LAST_AP_KEY);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
     esp_err_t esp_err = nvs_commit(nvs);
     if (esp_err != ESP_OK) {
         return inf_repository_wifi_nvs_impl_error_from_esp(esp_err);
@@ -109,6 +184,53 @@ dom_models_error_t inf_repository_wifi_nvs_impl_clear_credential(nvs_handle_t nv
     return DOMAIN_MODELS_ERROR_OK;
 }
 
+dom_models_error_t inf_repository_wifi_nvs_impl_read_last_ap(nvs_handle_t nvs, dom_models_wifi_sta_last_ap_t* out) {
+    if (!nvs || !out) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    memset(out, 0, sizeof(dom_models_wifi_sta_last_ap_t));
+
+    /* One blob, so the hint is never read half written */
+    size_t    len = sizeof(dom_models_wifi_sta_last_ap_t);
+    esp_err_t err = nvs_get_blob(nvs, DOM_MODELS_WIFI_STA_LAST_AP_KEY, out, &len);
+    if (err != ESP_OK) {
+        memset(out, 0, sizeof(dom_models_wifi_sta_last_ap_t));
+        return inf_repository_wifi_nvs_impl_error_from_esp(err);
+    }
+
+    /* A blob written by another layout of the struct is treated as absent */
+    if (len != sizeof(dom_models_wifi_sta_last_ap_t) || validate_last_ap(out) != DOMAIN_MODELS_ERROR_OK) {
+        memset(out, 0, sizeof(dom_models_wifi_sta_last_ap_t));
+        return DOMAIN_MODELS_ERROR_NOT_FOUND;
+    }
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+dom_models_error_t inf_repository_wifi_nvs_impl_set_last_ap(nvs_handle_t nvs, const dom_models_wifi_sta_last_ap_t* last_ap) {
+    if (!nvs) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    dom_models_error_t err = validate_last_ap(last_ap);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
+    esp_err_t esp_err = nvs_set_blob(nvs, DOM_MODELS_WIFI_STA_LAST_AP_KEY, last_ap, sizeof(dom_models_wifi_sta_last_ap_t));
+    if (esp_err != ESP_OK) {
+        return inf_repository_wifi_nvs_impl_error_from_esp(esp_err);
+    }
+
+    esp_err = nvs_commit(nvs);
+    if (esp_err != ESP_OK) {
+        return inf_repository_wifi_nvs_impl_error_from_esp(esp_err);
+    }
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
 /* Helper Function Implementations */
 
 static size_t bounded_strlen(const char* value, size_t max_len) {
@@ -143,6 +265,147 @@ static dom_models_error_t validate_credential(const dom_models_wifi_sta_credenti
     return DOMAIN_MODELS_ERROR_OK;
 }
 
+static dom_models_error_t validate_profiles(const dom_models_wifi_sta_profiles_t* profiles) {
+    if (!profiles || profiles->count > DOM_MODELS_WIFI_STA_PROFILE_MAX) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    for (size_t i = 0; i < profiles->count; i++) {
+        dom_models_error_t err = validate_credential(&profiles->profiles[i].credential);
+        if (err != DOMAIN_MODELS_ERROR_OK) {
+            return err;
+        }
+    }
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+static dom_models_error_t validate_last_ap(const dom_models_wifi_sta_last_ap_t* last_ap) {
+    if (!last_ap) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    size_t ssid_len = bounded_strlen(last_ap->ssid, sizeof(last_ap->ssid));
+    if (ssid_len == 0 || ssid_len >= sizeof(last_ap->ssid) || last_ap->channel == 0) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+/* A device provisioned before the profile store comes up with its one credential as the only profile */
+static dom_models_error_t read_legacy_credential(nvs_handle_t nvs, dom_models_wifi_sta_profiles_t* out) {
+    dom_models_wifi_sta_credential_t* credential = &out->profiles[0].credential;
+
+    dom_models_error_t err = inf_repository_wifi_nvs_impl_read_string(
+        nvs,
+        DOM_MODELS_WIFI_STA_CREDENTIAL_SSID_KEY,
+        credential->ssid,
+        sizeof(credential->ssid)
+    );
+    if (err == DOMAIN_MODELS_ERROR_OK) {
+        err = inf_repository_wifi_nvs_impl_read_string(
+            nvs,
+            DOM_MODELS_WIFI_STA_CREDENTIAL_PASS_KEY,
+            credential->password,
+            sizeof(credential->password)
+        );
+    }
+    if (err == DOMAIN_MODELS_ERROR_OK) {
+        err = validate_credential(credential);
+    }
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        memset(out, 0, sizeof(dom_models_wifi_sta_profiles_t));
+        return err == DOMAIN_MODELS_ERROR_BAD_ARGUMENT ? DOMAIN_MODELS_ERROR_NOT_FOUND : err;
+    }
+
+    out->count = 1;
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+static dom_models_error_t decode_profiles(const uint8_t* blob, size_t len, dom_models_wifi_sta_profiles_t* out) {
+    inf_repository_wifi_nvs_impl_profiles_header_t header;
+    memset(&header, 0, sizeof(header));
+    if (len >= sizeof(header)) {
+        memcpy(&header, blob, sizeof(header));
+    }
+
+    if (header.magic != INF_REPOSITORY_WIFI_NVS_IMPL_PROFILES_MAGIC) {
+        /* Version 0 is the raw model struct of the firmware that wrote it */
+        if (len != sizeof(dom_models_wifi_sta_profiles_t)) {
+            return DOMAIN_MODELS_ERROR_NOT_FOUND;
+        }
+        memcpy(out, blob, len);
+        return DOMAIN_MODELS_ERROR_OK;
+    }
+
+    switch (header.version) {
+        case 1:
+            return decode_profiles_v1(blob, len, out);
+        default:
+            return DOMAIN_MODELS_ERROR_NOT_FOUND;
+    }
+}
+
+static dom_models_error_t decode_profiles_v1(const uint8_t* blob, size_t len, dom_models_wifi_sta_profiles_t* out) {
+    inf_repository_wifi_nvs_impl_profiles_header_t header;
+    memcpy(&header, blob, sizeof(header));
+
+    if (header.count > DOM_MODELS_WIFI_STA_PROFILE_MAX ||
+        len != sizeof(header) + header.count * sizeof(inf_repository_wifi_nvs_impl_profile_record_t)) {
+        return DOMAIN_MODELS_ERROR_NOT_FOUND;
+    }
+
+    out->count       = header.count;
+    out->success_seq = header.success_seq;
+
+    const uint8_t* cursor = blob + sizeof(header);
+    for (size_t i = 0; i < out->count; i++) {
+        inf_repository_wifi_nvs_impl_profile_record_t record;
+        memcpy(&record, cursor, sizeof(record));
+        cursor += sizeof(record);
+
+        dom_models_wifi_sta_profile_t* profile = &out->profiles[i];
+        memcpy(profile->credential.ssid, record.ssid, sizeof(profile->credential.ssid));
+        memcpy(profile->credential.password, record.password, sizeof(profile->credential.password));
+        profile->priority         = record.priority;
+        profile->last_success_seq = record.last_success_seq;
+        profile->failure_cnt      = record.failure_cnt;
+    }
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+/* Writes the current version into out, which holds INF_REPOSITORY_WIFI_NVS_IMPL_PROFILES_MAX_LEN bytes */
+static size_t encode_profiles(const dom_models_wifi_sta_profiles_t* profiles, uint8_t* out) {
+    inf_repository_wifi_nvs_impl_profiles_header_t header = {
+        .magic       = INF_REPOSITORY_WIFI_NVS_IMPL_PROFILES_MAGIC,
+        .version     = INF_REPOSITORY_WIFI_NVS_IMPL_PROFILES_VERSION,
+        .count       = (uint16_t)profiles->count,
+        .success_seq = profiles->success_seq,
+    };
+    memcpy(out, &header, sizeof(header));
+
+    uint8_t* cursor = out + sizeof(header);
+    for (size_t i = 0; i < profiles->count; i++) {
+        const dom_models_wifi_sta_profile_t*          profile = &profiles->profiles[i];
+        inf_repository_wifi_nvs_impl_profile_record_t record;
+        memset(&record, 0, sizeof(record));
+
+        memcpy(record.ssid, profile->credential.ssid, sizeof(record.ssid));
+        memcpy(record.password, profile->credential.password, sizeof(record.password));
+        record.priority         = profile->priority;
+        record.last_success_seq = profile->last_success_seq;
+        record.failure_cnt      = profile->failure_cnt;
+
+        memcpy(cursor, &record, sizeof(record));
+        cursor += sizeof(record);
+    }
+
+    return (size_t)(cursor - out);
+}
+
 static dom_models_error_t erase_key(nvs_handle_t nvs, const char* key) {
     esp_err_t err = nvs_erase_key(nvs, key);
     if (err == ESP_ERR_NVS_NOT_FOUND) {
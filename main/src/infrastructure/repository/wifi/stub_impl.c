@@ -10,17 +10,25 @@
 
 /* Contract Function Prototypes */
 
-static dom_models_error_t get_sta_credential_impl(
+static dom_models_error_t get_sta_profiles_impl(
     dom_contracts_repository_wifi_t* self,
-    dom_models_wifi_sta_credential_t* out
+    dom_models_wifi_sta_profiles_t* out
 );
-static dom_models_error_t set_sta_credential_impl(
+static dom_models_error_t set_sta_profiles_impl(
     dom_contracts_repository_wifi_t* self,
-    const dom_models_wifi_sta_credential_t* credential
+    const dom_models_wifi_sta_profiles_t* profiles
 );
 static dom_models_error_t clear_sta_credential_impl(
     dom_contracts_repository_wifi_t* self
 );
+static dom_models_error_t get_sta_last_ap_impl(
+    dom_contracts_repository_wifi_t* self,
+    dom_models_wifi_sta_last_ap_t* out
+);
+static dom_models_error_t set_sta_last_ap_impl(
+    dom_contracts_repository_wifi_t* self,
+    const dom_models_wifi_sta_last_ap_t* last_ap
+);
 
 /* Constructor and Destructor */
 
@@ -44,9 +52,11 @@ dom_contracts_repository_wifi_t* inf_repository_wifi_stub_impl_new(const inf_rep
         return NULL;
     }
 
-    self->get_sta_credential   = get_sta_credential_impl;
-    self->set_sta_credential   = set_sta_credential_impl;
+    self->get_sta_profiles     = get_sta_profiles_impl;
+    self->set_sta_profiles     = set_sta_profiles_impl;
     self->clear_sta_credential = clear_sta_credential_impl;
+    self->get_sta_last_ap      = get_sta_last_ap_impl;
+    self->set_sta_last_ap      = set_sta_last_ap_impl;
 
     return self;
 }
@@ -67,28 +77,28 @@ void inf_repository_wifi_stub_impl_delete(dom_contracts_repository_wifi_t* self)
 
 /* Contract Function Implementations */
 
-static dom_models_error_t get_sta_credential_impl(
+static dom_models_error_t get_sta_profiles_impl(
     dom_contracts_repository_wifi_t* self,
-    dom_models_wifi_sta_credential_t* out
+    dom_models_wifi_sta_profiles_t* out
 ) {
     if (!self || !self->ctx || !out) {
         return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
     inf_repository_wifi_stub_impl_ctx_t* ctx = self->ctx;
-    if (!ctx->credential_available) {
-        memset(out, 0, sizeof(dom_models_wifi_sta_credential_t));
+    if (!ctx->profiles_available) {
+        memset(out, 0, sizeof(dom_models_wifi_sta_profiles_t));
         return DOMAIN_MODELS_ERROR_NOT_FOUND;
     }
 
-    memcpy(out, &ctx->credential, sizeof(dom_models_wifi_sta_credential_t));
+    memcpy(out, &ctx->profiles, sizeof(dom_models_wifi_sta_profiles_t));
 
     return DOMAIN_MODELS_ERROR_OK;
 }
 
-static dom_models_error_t set_sta_credential_impl(
+static dom_models_error_t set_sta_profiles_impl(
     dom_contracts_repository_wifi_t* self,
-    const dom_models_wifi_sta_credential_t* credential
+    const dom_models_wifi_sta_profiles_t* profiles
 ) {
     if (!self || !self->ctx) {
         return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
@@ -96,7 +106,7 @@ static dom_models_error_t set_sta_credential_impl(
 
     inf_repository_wifi_stub_impl_ctx_t* ctx = self->ctx;
 
-    return inf_repository_wifi_stub_impl_set_credential(ctx, credential);
+    return inf_repository_wifi_stub_impl_set_profiles(ctx, profiles);
 }
 
 static dom_models_error_t clear_sta_credential_impl(
@@ -112,3 +122,35 @@ static dom_models_error_t clear_sta_credential_impl(
 
     return DOMAIN_MODELS_ERROR_OK;
 }
+
+static dom_models_error_t get_sta_last_ap_impl(
+    dom_contracts_repository_wifi_t* self,
+    dom_models_wifi_sta_last_ap_t* out
+) {
+    if (!self || !self->ctx || !out) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    inf_repository_wifi_stub_impl_ctx_t* ctx = self->ctx;
+    if (!ctx->last_ap_available) {
+        memset(out, 0, sizeof(dom_models_wifi_sta_last_ap_t));
+        return DOMAIN_MODELS_ERROR_NOT_FOUND;
+    }
+
+    memcpy(out, &ctx->last_ap, sizeof(dom_models_wifi_sta_last_ap_t));
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+static dom_models_error_t set_sta_last_ap_impl(
+    dom_contracts_repository_wifi_t* self,
+    const dom_models_wifi_sta_last_ap_t* last_ap
+) {
+    if (!self || !self->ctx) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    inf_repository_wifi_stub_impl_ctx_t* ctx = self->ctx;
+
+    return inf_repository_wifi_stub_impl_set_last_ap(ctx, last_ap);
+}
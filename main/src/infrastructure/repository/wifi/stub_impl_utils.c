@@ -24,21 +24,42 @@ dom_models_error_t inf_repository_wifi_stub_impl_validate_credential(const dom_m
     return DOMAIN_MODELS_ERROR_OK;
 }
 
-dom_models_error_t inf_repository_wifi_stub_impl_set_credential(
+dom_models_error_t inf_repository_wifi_stub_impl_set_profiles(
     inf_repository_wifi_stub_impl_ctx_t* ctx,
-    const dom_models_wifi_sta_credential_t* credential
+    const dom_models_wifi_sta_profiles_t* profiles
 ) {
-    if (!ctx) {
+    if (!ctx || !profiles || profiles->count > DOM_MODELS_WIFI_STA_PROFILE_MAX) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    for (size_t i = 0; i < profiles->count; i++) {
+        dom_models_error_t err = inf_repository_wifi_stub_impl_validate_credential(&profiles->profiles[i].credential);
+        if (err != DOMAIN_MODELS_ERROR_OK) {
+            return err;
+        }
+    }
+
+    memcpy(&ctx->profiles, profiles, sizeof(dom_models_wifi_sta_profiles_t));
+    ctx->profiles_available = true;
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+dom_models_error_t inf_repository_wifi_stub_impl_set_last_ap(
+    inf_repository_wifi_stub_impl_ctx_t* ctx,
+    const dom_models_wifi_sta_last_ap_t* last_ap
+) {
+    if (!ctx || !last_ap) {
         return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
-    dom_models_error_t err = inf_repository_wifi_stub_impl_validate_credential(credential);
-    if (err != DOMAIN_MODELS_ERROR_OK) {
-        return err;
+    size_t ssid_len = bounded_strlen(last_ap->ssid, sizeof(last_ap->ssid));
+    if (ssid_len == 0 || ssid_len >= sizeof(last_ap->ssid) || last_ap->channel == 0) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
-    memcpy(&ctx->credential, credential, sizeof(dom_models_wifi_sta_credential_t));
-    ctx->credential_available = true;
+    memcpy(&ctx->last_ap, last_ap, sizeof(dom_models_wifi_sta_last_ap_t));
+    ctx->last_ap_available = true;
 
     return DOMAIN_MODELS_ERROR_OK;
 }
@@ -57,7 +78,12 @@ dom_models_error_t inf_repository_wifi_stub_impl_load_cfg(
         return DOMAIN_MODELS_ERROR_OK;
     }
 
-    return inf_repository_wifi_stub_impl_set_credential(ctx, &cfg->credential);
+    dom_models_wifi_sta_profiles_t profiles;
+    memset(&profiles, 0, sizeof(dom_models_wifi_sta_profiles_t));
+    memcpy(&profiles.profiles[0].credential, &cfg->credential, sizeof(dom_models_wifi_sta_credential_t));
+    profiles.count = 1;
+
+    return inf_repository_wifi_stub_impl_set_profiles(ctx, &profiles);
 }
 
 void inf_repository_wifi_stub_impl_clear(inf_repository_wifi_stub_impl_ctx_t* ctx) {
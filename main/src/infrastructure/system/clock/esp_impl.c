@@ -0,0 +1,67 @@
+#include "infrastructure/system/clock/esp_impl.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "domain/contracts/system/clock.h"
+#include "domain/models/error.h"
+#include "esp_timer.h"
+#include "infrastructure/system/clock/esp_impl_utils.h"
+
+/* Contract Function Prototypes */
+
+static dom_models_error_t get_uptime_ms_impl(
+    dom_contracts_system_clock_t* self,
+    int64_t*                      out
+);
+
+/* Constructor and Destructor */
+
+dom_contracts_system_clock_t* inf_system_clock_esp_impl_new(const inf_system_clock_esp_impl_cfg_t* cfg) {
+    inf_system_clock_esp_impl_ctx_t* ctx = (inf_system_clock_esp_impl_ctx_t*)calloc(1, sizeof(inf_system_clock_esp_impl_ctx_t));
+    if (!ctx) {
+        return NULL;
+    }
+
+    inf_system_clock_esp_impl_cfg_t default_cfg = INF_SYSTEM_CLOCK_ESP_IMPL_CFG_DEFAULT();
+    memcpy(&ctx->cfg, cfg ? cfg : &default_cfg, sizeof(inf_system_clock_esp_impl_cfg_t));
+    if (inf_system_clock_esp_impl_validate_cfg(&ctx->cfg) != DOMAIN_MODELS_ERROR_OK) {
+        free(ctx);
+        return NULL;
+    }
+
+    dom_contracts_system_clock_t* self = dom_contracts_system_clock_new(ctx);
+    if (!self) {
+        free(ctx);
+        return NULL;
+    }
+
+    self->get_uptime_ms = get_uptime_ms_impl;
+
+    return self;
+}
+
+void inf_system_clock_esp_impl_delete(dom_contracts_system_clock_t* self) {
+    if (!self) {
+        return;
+    }
+
+    free(self->ctx);
+    dom_contracts_system_clock_delete(self);
+}
+
+/* Contract Function Implementations */
+
+static dom_models_error_t get_uptime_ms_impl(
+    dom_contracts_system_clock_t* self,
+    int64_t*                      out
+) {
+    if (!self || !self->ctx || !out) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    *out = esp_timer_get_time() / 1000;
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
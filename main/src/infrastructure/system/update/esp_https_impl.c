@@ -38,6 +38,10 @@ static dom_models_error_t validate_impl(
 static dom_models_error_t rollback_impl(
     dom_contracts_system_update_t* self
 );
+static dom_models_error_t get_progress_impl(
+    dom_contracts_system_update_t* self,
+    dom_models_update_progress_t*  out
+);
 
 /* Constructor and Destructor */
 
@@ -59,9 +63,10 @@ dom_contracts_system_update_t* inf_system_update_esp_https_impl_new(
         return NULL;
     }
 
-    self->update   = update_impl;
-    self->validate = validate_impl;
-    self->rollback = rollback_impl;
+    self->update       = update_impl;
+    self->validate     = validate_impl;
+    self->rollback     = rollback_impl;
+    self->get_progress = get_progress_impl;
 
     return self;
 }
@@ -95,6 +100,9 @@ static dom_models_error_t update_impl(
         return DOMAIN_MODELS_ERROR_BAD_STATE;
     }
 
+    ctx->written_size = 0;
+    ctx->total_size   = update_info->firmware_size;
+
     return perform_update(ctx, update_info);
 }
 
@@ -143,6 +151,21 @@ static dom_models_error_t rollback_impl(
 #endif
 }
 
+static dom_models_error_t get_progress_impl(
+    dom_contracts_system_update_t* self,
+    dom_models_update_progress_t*  out
+) {
+    if (!self || !self->ctx || !out) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    inf_system_update_esp_https_impl_ctx_t* ctx = self->ctx;
+    out->written_size                           = ctx->written_size;
+    out->total_size                             = ctx->total_size;
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
 /* Helper Function Implementations */
 
 static void abort_ota(inf_system_update_esp_https_impl_ctx_t* ctx) {
@@ -321,7 +344,8 @@ static dom_models_error_t perform_update(
             goto cleanup;
         }
 
-        total_read += chunk_size;
+        total_read        += chunk_size;
+        ctx->written_size  = total_read;
     }
 
     if (!esp_http_client_is_complete_data_received(client)) {
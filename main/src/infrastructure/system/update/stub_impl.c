@@ -19,6 +19,10 @@ static dom_models_error_t validate_impl(
 static dom_models_error_t rollback_impl(
     dom_contracts_system_update_t* self
 );
+static dom_models_error_t get_progress_impl(
+    dom_contracts_system_update_t* self,
+    dom_models_update_progress_t*  out
+);
 
 /* Constructor and Destructor */
 
@@ -43,9 +47,10 @@ dom_contracts_system_update_t* inf_system_update_stub_impl_new(
         return NULL;
     }
 
-    self->update   = update_impl;
-    self->validate = validate_impl;
-    self->rollback = rollback_impl;
+    self->update       = update_impl;
+    self->validate     = validate_impl;
+    self->rollback     = rollback_impl;
+    self->get_progress = get_progress_impl;
 
     return self;
 }
@@ -103,3 +108,19 @@ static dom_models_error_t rollback_impl(
 
     return ctx->rollback_result;
 }
+
+static dom_models_error_t get_progress_impl(
+    dom_contracts_system_update_t* self,
+    dom_models_update_progress_t*  out
+) {
+    if (!self || !self->ctx || !out) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    /* Stub updates finish inside the call, so the last one is always complete */
+    inf_system_update_stub_impl_ctx_t* ctx = self->ctx;
+    out->total_size                        = ctx->update_cnt > 0 ? ctx->update_info.firmware_size : 0;
+    out->written_size                      = out->total_size;
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
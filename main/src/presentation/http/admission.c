@@ -0,0 +1,203 @@
+#include "presentation/http/admission.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#include "esp_http_server.h"
+#include "esp_timer.h"
+
+/* Helper Function Prototypes */
+
+static void client_addr(httpd_req_t* req, uint8_t out[PRES_HTTP_ADMISSION_ADDR_LEN]);
+static pres_http_admission_client_t* find_client(
+    pres_http_admission_t* admission,
+    const uint8_t          addr[PRES_HTTP_ADMISSION_ADDR_LEN],
+    uint32_t               now_ms
+);
+static void fill(pres_http_admission_bucket_t* bucket, const pres_http_admission_limit_t* limit, uint32_t now_ms);
+static void refill(pres_http_admission_bucket_t* bucket, const pres_http_admission_limit_t* limit, uint32_t now_ms);
+static uint32_t wait_ms(const pres_http_admission_bucket_t* bucket, const pres_http_admission_limit_t* limit);
+static void take(pres_http_admission_bucket_t* bucket, const pres_http_admission_limit_t* limit);
+static uint32_t burst_of(const pres_http_admission_limit_t* limit);
+
+/* Public Function Implementations */
+
+pres_http_admission_t* pres_http_admission_new(const pres_http_admission_config_t* config) {
+    if (!config) {
+        return NULL;
+    }
+
+    pres_http_admission_t* admission = (pres_http_admission_t*)calloc(1, sizeof(pres_http_admission_t));
+    if (!admission) {
+        return NULL;
+    }
+
+    admission->config = *config;
+
+    uint32_t now_ms = (uint32_t)(esp_timer_get_time() / 1000);
+    for (size_t i = 0; i < PRES_HTTP_ADMISSION_CLASS_CNT; i++) {
+        fill(&admission->shared[i], &admission->config.shared[i], now_ms);
+    }
+
+    return admission;
+}
+
+void pres_http_admission_delete(pres_http_admission_t* admission) {
+    free(admission);
+}
+
+bool pres_http_admission_admit(
+    pres_http_admission_t*      admission,
+    httpd_req_t*                req,
+    pres_http_admission_class_t cls,
+    uint32_t*                   retry_after_s
+) {
+    if (!admission || !req || cls >= PRES_HTTP_ADMISSION_CLASS_CNT) {
+        return true;
+    }
+
+    uint8_t addr[PRES_HTTP_ADMISSION_ADDR_LEN];
+    client_addr(req, addr);
+
+    uint32_t                           now_ms       = (uint32_t)(esp_timer_get_time() / 1000);
+    pres_http_admission_client_t*      client       = find_client(admission, addr, now_ms);
+    const pres_http_admission_limit_t* client_limit = &admission->config.client[cls];
+    const pres_http_admission_limit_t* shared_limit = &admission->config.shared[cls];
+    pres_http_admission_bucket_t*      client_bkt   = &client->buckets[cls];
+    pres_http_admission_bucket_t*      shared_bkt   = &admission->shared[cls];
+
+    refill(client_bkt, client_limit, now_ms);
+    refill(shared_bkt, shared_limit, now_ms);
+
+    uint32_t client_wait_ms = wait_ms(client_bkt, client_limit);
+    uint32_t shared_wait_ms = wait_ms(shared_bkt, shared_limit);
+    uint32_t wait           = client_wait_ms > shared_wait_ms ? client_wait_ms : shared_wait_ms;
+    if (wait > 0) {
+        if (retry_after_s) {
+            *retry_after_s = (wait + 999) / 1000;
+        }
+        return false;
+    }
+
+    take(client_bkt, client_limit);
+    take(shared_bkt, shared_limit);
+
+    return true;
+}
+
+/* Helper Function Implementations */
+
+static void client_addr(httpd_req_t* req, uint8_t out[PRES_HTTP_ADMISSION_ADDR_LEN]) {
+    memset(out, 0, PRES_HTTP_ADMISSION_ADDR_LEN);
+
+    /* Clients whose address cannot be read all share the all zero entry */
+    struct sockaddr_storage peer;
+    socklen_t               peer_len = sizeof(peer);
+    int                     sockfd   = httpd_req_to_sockfd(req);
+    if (sockfd < 0 || getpeername(sockfd, (struct sockaddr*)&peer, &peer_len) != 0) {
+        return;
+    }
+
+    if (peer.ss_family == AF_INET6) {
+        memcpy(out, &((const struct sockaddr_in6*)&peer)->sin6_addr, PRES_HTTP_ADMISSION_ADDR_LEN);
+    } else if (peer.ss_family == AF_INET) {
+        /* Stored IPv4 mapped, the way a dual stack socket reports it */
+        out[10] = 0xff;
+        out[11] = 0xff;
+        memcpy(&out[12], &((const struct sockaddr_in*)&peer)->sin_addr, 4);
+    }
+}
+
+static pres_http_admission_client_t* find_client(
+    pres_http_admission_t* admission,
+    const uint8_t          addr[PRES_HTTP_ADMISSION_ADDR_LEN],
+    uint32_t               now_ms
+) {
+    pres_http_admission_client_t* victim = &admission->clients[0];
+    for (size_t i = 0; i < PRES_HTTP_ADMISSION_CLIENT_MAX; i++) {
+        pres_http_admission_client_t* client = &admission->clients[i];
+        if (client->used && memcmp(client->addr, addr, PRES_HTTP_ADMISSION_ADDR_LEN) == 0) {
+            client->seen_ms = now_ms;
+            return client;
+        }
+
+        if (!victim->used) {
+            continue;
+        }
+        if (!client->used || now_ms - client->seen_ms > now_ms - victim->seen_ms) {
+            victim = client;
+        }
+    }
+
+    /* A new or evicted address starts with full buckets */
+    memcpy(victim->addr, addr, PRES_HTTP_ADMISSION_ADDR_LEN);
+    victim->seen_ms = now_ms;
+    victim->used    = true;
+    for (size_t i = 0; i < PRES_HTTP_ADMISSION_CLASS_CNT; i++) {
+        fill(&victim->buckets[i], &admission->config.client[i], now_ms);
+    }
+
+    return victim;
+}
+
+static void fill(pres_http_admission_bucket_t* bucket, const pres_http_admission_limit_t* limit, uint32_t now_ms) {
+    bucket->tokens      = burst_of(limit) * PRES_HTTP_ADMISSION_TOKEN_MILLIS;
+    bucket->refilled_ms = now_ms;
+}
+
+static void refill(pres_http_admission_bucket_t* bucket, const pres_http_admission_limit_t* limit, uint32_t now_ms) {
+    if (limit->per_min == 0) {
+        return;
+    }
+
+    uint32_t cap = burst_of(limit) * PRES_HTTP_ADMISSION_TOKEN_MILLIS;
+    if (bucket->tokens >= cap) {
+        bucket->refilled_ms = now_ms;
+        return;
+    }
+
+    /* Only the time that turned into whole thousandths is used up, the rest carries over */
+    uint64_t elapsed_ms = now_ms - bucket->refilled_ms;
+    uint64_t added      = elapsed_ms * limit->per_min / 60;
+    if (added == 0) {
+        return;
+    }
+
+    if (added >= cap - bucket->tokens) {
+        bucket->tokens      = cap;
+        bucket->refilled_ms = now_ms;
+        return;
+    }
+
+    bucket->tokens += (uint32_t)added;
+    bucket->refilled_ms += (uint32_t)(added * 60 / limit->per_min);
+}
+
+static uint32_t wait_ms(const pres_http_admission_bucket_t* bucket, const pres_http_admission_limit_t* limit) {
+    if (limit->per_min == 0 || bucket->tokens >= PRES_HTTP_ADMISSION_TOKEN_MILLIS) {
+        return 0;
+    }
+
+    uint64_t missing = PRES_HTTP_ADMISSION_TOKEN_MILLIS - bucket->tokens;
+
+    return (uint32_t)((missing * 60 + limit->per_min - 1) / limit->per_min);
+}
+
+static void take(pres_http_admission_bucket_t* bucket, const pres_http_admission_limit_t* limit) {
+    if (limit->per_min == 0) {
+        return;
+    }
+
+    bucket->tokens -= PRES_HTTP_ADMISSION_TOKEN_MILLIS;
+}
+
+static uint32_t burst_of(const pres_http_admission_limit_t* limit) {
+    /* A burst below one token would refuse everything forever */
+    return limit->burst > 0 ? limit->burst : 1;
+}
@@ -1,81 +1,133 @@
 #include "presentation/http/dto/common.h"
 
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
-#include <stdlib.h>
+#include <string.h>
 
-#include "cJSON.h"
 #include "domain/models/error.h"
 #include "esp_err.h"
 #include "esp_http_server.h"
+#include "presentation/http/metrics.h"
+#include "utils/json/reader.h"
+#include "utils/json/writer.h"
+
+/* Helper Function Prototypes */
+
+static bool send_chunk(void* flush_ctx, const char* data, size_t data_len);
 
 dom_models_error_t pres_http_dto_common_recv_json(
-    httpd_req_t* req,
-    cJSON**      out
+    httpd_req_t*                 req,
+    pres_http_dto_common_body_t* body
 ) {
-    if (!req || !out) {
+    if (!req || !body) {
         return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
-    *out = NULL;
+    utils_json_reader_reset(&body->reader);
 
     if (req->content_len == 0) {
         return DOMAIN_MODELS_ERROR_OK;
     }
-    if (req->content_len > PRES_HTTP_DTO_COMMON_MAX_BODY_LEN) {
+    if (req->content_len > sizeof(body->buf)) {
         return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
-    char* body = (char*)calloc(1, req->content_len + 1);
-    if (!body) {
-        return DOMAIN_MODELS_ERROR_MALLOC_FAILED;
-    }
-
     size_t received = 0;
     while (received < req->content_len) {
-        int ret = httpd_req_recv(req, body + received, req->content_len - received);
+        int ret = httpd_req_recv(req, body->buf + received, req->content_len - received);
         if (ret == HTTPD_SOCK_ERR_TIMEOUT) {
-            free(body);
             return DOMAIN_MODELS_ERROR_TIMEOUT;
         }
         if (ret <= 0) {
-            free(body);
             return DOMAIN_MODELS_ERROR_FAILURE;
         }
 
         received += (size_t)ret;
     }
 
-    cJSON* json = cJSON_ParseWithLength(body, received);
-    free(body);
-    if (!json) {
+    if (!utils_json_reader_parse(&body->reader, body->buf, received)) {
         return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
-    *out = json;
-
     return DOMAIN_MODELS_ERROR_OK;
 }
 
-esp_err_t pres_http_dto_common_send_json(
+dom_models_error_t pres_http_dto_common_query_u32(
     httpd_req_t* req,
-    cJSON*       json
+    const char*  key,
+    uint32_t*    out
 ) {
-    if (!req || !json) {
-        return ESP_ERR_INVALID_ARG;
+    if (!req || !key || !out) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    size_t query_len = httpd_req_get_url_query_len(req);
+    if (query_len == 0) {
+        return DOMAIN_MODELS_ERROR_OK;
+    }
+    if (query_len >= PRES_HTTP_DTO_COMMON_MAX_QUERY_LEN) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    char query[PRES_HTTP_DTO_COMMON_MAX_QUERY_LEN];
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) != ESP_OK) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    char      value[11];
+    esp_err_t err = httpd_query_key_value(query, key, value, sizeof(value));
+    if (err == ESP_ERR_NOT_FOUND) {
+        return DOMAIN_MODELS_ERROR_OK;
+    }
+    if (err != ESP_OK || value[0] == '\0') {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
-    char* body = cJSON_PrintUnformatted(json);
-    if (!body) {
-        httpd_resp_set_status(req, pres_http_dto_common_status_from_error(DOMAIN_MODELS_ERROR_MALLOC_FAILED));
-        httpd_resp_set_type(req, "application/json");
-        return httpd_resp_send(req, "{\"error\":\"MALLOC_FAILED\"}", HTTPD_RESP_USE_STRLEN);
+    uint64_t parsed = 0;
+    for (const char* c = value; *c != '\0'; c++) {
+        if (*c < '0' || *c > '9') {
+            return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+        }
+        parsed = parsed * 10 + (uint64_t)(*c - '0');
+    }
+    if (parsed > UINT32_MAX) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
+    *out = (uint32_t)parsed;
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+utils_json_writer_t* pres_http_dto_common_stream_begin(
+    pres_http_dto_common_stream_t* stream,
+    httpd_req_t*                   req
+) {
+    if (!stream || !req) {
+        return NULL;
+    }
+
+    stream->req = req;
     httpd_resp_set_type(req, "application/json");
-    esp_err_t err = httpd_resp_send(req, body, HTTPD_RESP_USE_STRLEN);
-    cJSON_free(body);
+    utils_json_writer_init_stream(&stream->writer, stream->scratch, sizeof(stream->scratch), send_chunk, req);
 
-    return err;
+    return &stream->writer;
+}
+
+esp_err_t pres_http_dto_common_stream_end(pres_http_dto_common_stream_t* stream) {
+    if (!stream || !stream->req) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (utils_json_writer_finish(&stream->writer) == 0) {
+        /* Headers are already out, so all that is left is to cut the response short */
+        httpd_resp_send_chunk(stream->req, NULL, 0);
+        return ESP_FAIL;
+    }
+
+    return httpd_resp_send_chunk(stream->req, NULL, 0);
 }
 
 esp_err_t pres_http_dto_common_send_domain_error(
@@ -89,8 +141,9 @@ esp_err_t pres_http_dto_common_send_domain_error(
     char body[64];
     snprintf(body, sizeof(body), "{\"error\":\"%s\"}", dom_models_error_str(err));
 
-    httpd_resp_set_status(req, pres_http_dto_common_status_from_error(err));
+    pres_http_metrics_set_status(req, pres_http_dto_common_status_from_error(err));
     httpd_resp_set_type(req, "application/json");
+    pres_http_metrics_count_sent(req, strlen(body));
 
     return httpd_resp_send(req, body, HTTPD_RESP_USE_STRLEN);
 }
@@ -117,3 +170,11 @@ const char* pres_http_dto_common_status_from_error(dom_models_error_t err) {
             return "500 Internal Server Error";
     }
 }
+
+/* Helper Function Implementations */
+
+static bool send_chunk(void* flush_ctx, const char* data, size_t data_len) {
+    pres_http_metrics_count_sent((httpd_req_t*)flush_ctx, data_len);
+
+    return httpd_resp_send_chunk((httpd_req_t*)flush_ctx, data, (ssize_t)data_len) == ESP_OK;
+}
@@ -0,0 +1,212 @@
+#include "presentation/http/dto/metrics.h"
+
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "esp_err.h"
+#include "esp_http_server.h"
+#include "presentation/http/metrics.h"
+
+typedef struct {
+    httpd_req_t* req;
+    char         scratch[PRES_HTTP_DTO_METRICS_SCRATCH_LEN];
+    size_t       len;
+    bool         failed;
+} pres_http_dto_metrics_stream_t;
+
+typedef enum {
+    PRES_HTTP_DTO_METRICS_COUNTER_REQUESTS = 0,
+    PRES_HTTP_DTO_METRICS_COUNTER_FAILED,
+    PRES_HTTP_DTO_METRICS_COUNTER_BYTES_IN,
+    PRES_HTTP_DTO_METRICS_COUNTER_BYTES_OUT,
+} pres_http_dto_metrics_counter_t;
+
+/* Helper Function Prototypes */
+
+static void emit(pres_http_dto_metrics_stream_t* stream, const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+static bool flush(pres_http_dto_metrics_stream_t* stream);
+static void write_counter(pres_http_dto_metrics_stream_t* stream, const pres_http_metrics_t* metrics, uint32_t route_cnt, const char* name, const char* help, pres_http_dto_metrics_counter_t counter);
+static void write_status(pres_http_dto_metrics_stream_t* stream, const pres_http_metrics_t* metrics, uint32_t route_cnt);
+static void write_latency(pres_http_dto_metrics_stream_t* stream, const pres_http_metrics_t* metrics, uint32_t route_cnt);
+static void write_heap(pres_http_dto_metrics_stream_t* stream, const pres_http_metrics_t* metrics, uint32_t route_cnt);
+static uint32_t load_counter(const pres_http_metrics_route_t* route, pres_http_dto_metrics_counter_t counter);
+static const char* method_to_string(httpd_method_t method);
+
+esp_err_t pres_http_dto_metrics_send(
+    httpd_req_t*               req,
+    const pres_http_metrics_t* metrics
+) {
+    if (!req || !metrics) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    pres_http_dto_metrics_stream_t stream = {
+        .req    = req,
+        .len    = 0,
+        .failed = false,
+    };
+    uint32_t route_cnt = pres_http_metrics_route_cnt(metrics);
+
+    httpd_resp_set_type(req, "text/plain; version=0.0.4");
+
+    write_counter(&stream, metrics, route_cnt, "http_requests_total", "Requests handled per route.", PRES_HTTP_DTO_METRICS_COUNTER_REQUESTS);
+    write_counter(&stream, metrics, route_cnt, "http_request_failures_total", "Requests whose handler failed to respond.", PRES_HTTP_DTO_METRICS_COUNTER_FAILED);
+    write_status(&stream, metrics, route_cnt);
+    write_latency(&stream, metrics, route_cnt);
+    write_counter(&stream, metrics, route_cnt, "http_request_bytes_total", "Request body bytes received per route.", PRES_HTTP_DTO_METRICS_COUNTER_BYTES_IN);
+    write_counter(&stream, metrics, route_cnt, "http_response_bytes_total", "Response body bytes sent per route.", PRES_HTTP_DTO_METRICS_COUNTER_BYTES_OUT);
+    write_heap(&stream, metrics, route_cnt);
+
+    if (!flush(&stream)) {
+        /* Headers are already out, so all that is left is to cut the response short */
+        httpd_resp_send_chunk(req, NULL, 0);
+        return ESP_FAIL;
+    }
+
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+/* Helper Function Implementations */
+
+static void emit(pres_http_dto_metrics_stream_t* stream, const char* fmt, ...) {
+    if (stream->failed) {
+        return;
+    }
+
+    for (int attempt = 0; attempt < 2; attempt++) {
+        size_t  room = sizeof(stream->scratch) - stream->len;
+        va_list args;
+        va_start(args, fmt);
+        int written = vsnprintf(stream->scratch + stream->len, room, fmt, args);
+        va_end(args);
+
+        if (written < 0) {
+            stream->failed = true;
+            return;
+        }
+        if ((size_t)written < room) {
+            stream->len += (size_t)written;
+            return;
+        }
+        if (stream->len == 0 || !flush(stream)) {
+            /* A single line longer than the scratch buffer */
+            stream->failed = true;
+            return;
+        }
+    }
+}
+
+static bool flush(pres_http_dto_metrics_stream_t* stream) {
+    if (stream->failed) {
+        return false;
+    }
+    if (stream->len == 0) {
+        return true;
+    }
+
+    pres_http_metrics_count_sent(stream->req, stream->len);
+    if (httpd_resp_send_chunk(stream->req, stream->scratch, (ssize_t)stream->len) != ESP_OK) {
+        stream->failed = true;
+        return false;
+    }
+
+    stream->len = 0;
+
+    return true;
+}
+
+static void write_counter(pres_http_dto_metrics_stream_t* stream, const pres_http_metrics_t* metrics, uint32_t route_cnt, const char* name, const char* help, pres_http_dto_metrics_counter_t counter) {
+    emit(stream, "# HELP %s %s\n# TYPE %s counter\n", name, help, name);
+    for (uint32_t i = 0; i < route_cnt; i++) {
+        const pres_http_metrics_route_t* route = &metrics->routes[i];
+        emit(stream, "%s{method=\"%s\",route=\"%s\"} %" PRIu32 "\n", name, method_to_string(route->method), route->uri, load_counter(route, counter));
+    }
+}
+
+static void write_status(pres_http_dto_metrics_stream_t* stream, const pres_http_metrics_t* metrics, uint32_t route_cnt) {
+    emit(stream, "# HELP http_responses_total Responses per route and status class.\n# TYPE http_responses_total counter\n");
+    for (uint32_t i = 0; i < route_cnt; i++) {
+        const pres_http_metrics_route_t* route = &metrics->routes[i];
+        for (size_t c = 0; c < PRES_HTTP_METRICS_STATUS_CLASS_CNT; c++) {
+            uint32_t cnt = atomic_load_explicit(&route->status_cnt[c], memory_order_relaxed);
+            if (cnt == 0) {
+                continue;
+            }
+            emit(stream, "http_responses_total{method=\"%s\",route=\"%s\",code=\"%zuxx\"} %" PRIu32 "\n", method_to_string(route->method), route->uri, c + 1, cnt);
+        }
+    }
+}
+
+static void write_latency(pres_http_dto_metrics_stream_t* stream, const pres_http_metrics_t* metrics, uint32_t route_cnt) {
+    emit(stream, "# HELP http_request_duration_seconds Handler latency per route.\n# TYPE http_request_duration_seconds histogram\n");
+    for (uint32_t i = 0; i < route_cnt; i++) {
+        const pres_http_metrics_route_t* route  = &metrics->routes[i];
+        const char*                      method = method_to_string(route->method);
+
+        uint32_t cumulative = 0;
+        for (size_t b = 0; b <= PRES_HTTP_METRICS_LATENCY_BUCKET_CNT; b++) {
+            cumulative += atomic_load_explicit(&route->latency_cnt[b], memory_order_relaxed);
+
+            uint32_t bound_us = pres_http_metrics_latency_bound_us(b);
+            if (bound_us == 0) {
+                emit(stream, "http_request_duration_seconds_bucket{method=\"%s\",route=\"%s\",le=\"+Inf\"} %" PRIu32 "\n", method, route->uri, cumulative);
+            } else {
+                emit(stream, "http_request_duration_seconds_bucket{method=\"%s\",route=\"%s\",le=\"%" PRIu32 ".%06" PRIu32 "\"} %" PRIu32 "\n", method, route->uri, bound_us / 1000000, bound_us % 1000000, cumulative);
+            }
+        }
+
+        uint64_t sum_us = atomic_load_explicit(&route->latency_sum_us, memory_order_relaxed);
+        emit(stream, "http_request_duration_seconds_sum{method=\"%s\",route=\"%s\"} %" PRIu64 ".%06" PRIu64 "\n", method, route->uri, sum_us / 1000000, sum_us % 1000000);
+        emit(stream, "http_request_duration_seconds_count{method=\"%s\",route=\"%s\"} %" PRIu32 "\n", method, route->uri, cumulative);
+    }
+}
+
+static void write_heap(pres_http_dto_metrics_stream_t* stream, const pres_http_metrics_t* metrics, uint32_t route_cnt) {
+    emit(stream, "# HELP http_request_heap_delta_bytes Free heap lost across the handler per route.\n# TYPE http_request_heap_delta_bytes gauge\n");
+    for (uint32_t i = 0; i < route_cnt; i++) {
+        const pres_http_metrics_route_t* route  = &metrics->routes[i];
+        const char*                      method = method_to_string(route->method);
+        int32_t                          sum    = atomic_load_explicit(&route->heap_delta_sum, memory_order_relaxed);
+        int32_t                          max    = atomic_load_explicit(&route->heap_delta_max, memory_order_relaxed);
+
+        emit(stream, "http_request_heap_delta_bytes{method=\"%s\",route=\"%s\",stat=\"sum\"} %" PRId32 "\n", method, route->uri, sum);
+        emit(stream, "http_request_heap_delta_bytes{method=\"%s\",route=\"%s\",stat=\"max\"} %" PRId32 "\n", method, route->uri, max);
+    }
+}
+
+static uint32_t load_counter(const pres_http_metrics_route_t* route, pres_http_dto_metrics_counter_t counter) {
+    switch (counter) {
+        case PRES_HTTP_DTO_METRICS_COUNTER_REQUESTS:
+            return atomic_load_explicit(&route->request_cnt, memory_order_relaxed);
+        case PRES_HTTP_DTO_METRICS_COUNTER_FAILED:
+            return atomic_load_explicit(&route->failed_cnt, memory_order_relaxed);
+        case PRES_HTTP_DTO_METRICS_COUNTER_BYTES_IN:
+            return atomic_load_explicit(&route->bytes_in, memory_order_relaxed);
+        case PRES_HTTP_DTO_METRICS_COUNTER_BYTES_OUT:
+            return atomic_load_explicit(&route->bytes_out, memory_order_relaxed);
+        default:
+            return 0;
+    }
+}
+
+static const char* method_to_string(httpd_method_t method) {
+    switch (method) {
+        case HTTP_GET:
+            return "GET";
+        case HTTP_POST:
+            return "POST";
+        case HTTP_PUT:
+            return "PUT";
+        case HTTP_DELETE:
+            return "DELETE";
+        case HTTP_PATCH:
+            return "PATCH";
+        default:
+            return "OTHER";
+    }
+}
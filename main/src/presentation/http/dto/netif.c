@@ -1,11 +1,12 @@
 #include "presentation/http/dto/netif.h"
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
 
-#include "cJSON.h"
 #include "domain/models/network.h"
+#include "utils/json/writer.h"
 
 /* Helper Function Prototypes */
 
@@ -14,98 +15,91 @@ static void ipv4_to_string(const uint8_t value[DOM_MODELS_NETWORK_IPV4_LEN], cha
 static void ipv6_to_string(const uint8_t value[DOM_MODELS_NETWORK_IPV6_LEN], char out[40]);
 static const char* network_interface_type_to_string(dom_models_network_interface_type_t type);
 static const char* network_dhcp_status_to_string(dom_models_network_dhcp_status_t status);
-static cJSON* ipv4_info_to_json(const dom_models_network_ipv4_info_t* info);
-static cJSON* ipv6_addr_to_json(const dom_models_network_ipv6_addr_t* info);
-static cJSON* dns_info_to_json(const dom_models_network_dns_info_t* info);
+static void write_ipv4_info(utils_json_writer_t* w, const char* key, const dom_models_network_ipv4_info_t* info);
+static void write_ipv6_addr(utils_json_writer_t* w, const char* key, const dom_models_network_ipv6_addr_t* info);
+static void write_dns_info(utils_json_writer_t* w, const dom_models_network_dns_info_t* info);
 
-cJSON* pres_http_dto_netif_network_to_json(const dom_models_network_t* network) {
-    if (!network) {
-        return NULL;
+bool pres_http_dto_netif_write_network(utils_json_writer_t* w, const dom_models_network_t* network) {
+    if (!w || !network) {
+        return false;
     }
 
-    cJSON* root = cJSON_CreateObject();
-    if (!root) {
-        return NULL;
-    }
-
-    cJSON_AddNumberToObject(root, "total_count", (double)network->total_count);
-    cJSON_AddNumberToObject(root, "count", (double)network->count);
-    cJSON_AddBoolToObject(root, "truncated", network->truncated);
+    utils_json_writer_object_begin(w);
+    utils_json_writer_kv_uint(w, "total_count", network->total_count);
+    utils_json_writer_kv_uint(w, "count", network->count);
+    utils_json_writer_kv_bool(w, "truncated", network->truncated);
 
-    cJSON* interfaces = cJSON_AddArrayToObject(root, "interfaces");
-    if (interfaces) {
-        for (size_t i = 0; i < network->count; i++) {
-            cJSON_AddItemToArray(interfaces, pres_http_dto_netif_interface_to_json(&network->interfaces[i]));
-        }
+    utils_json_writer_key(w, "interfaces");
+    utils_json_writer_array_begin(w);
+    for (size_t i = 0; i < network->count; i++) {
+        pres_http_dto_netif_write_interface(w, &network->interfaces[i]);
     }
+    utils_json_writer_array_end(w);
 
-    return root;
+    return utils_json_writer_object_end(w);
 }
 
-cJSON* pres_http_dto_netif_interface_to_json(const dom_models_network_interface_t* interface) {
-    if (!interface) {
-        return NULL;
+bool pres_http_dto_netif_write_interface(utils_json_writer_t* w, const dom_models_network_interface_t* interface) {
+    if (!w || !interface) {
+        return false;
     }
 
     char mac[18];
-    cJSON* root = cJSON_CreateObject();
-    if (!root) {
-        return NULL;
-    }
 
-    cJSON_AddStringToObject(root, "if_key", interface->if_key);
-    cJSON_AddStringToObject(root, "desc", interface->desc);
-    cJSON_AddBoolToObject(root, "hostname_available", interface->hostname_available);
+    utils_json_writer_object_begin(w);
+    utils_json_writer_kv_string(w, "if_key", interface->if_key);
+    utils_json_writer_kv_string(w, "desc", interface->desc);
+    utils_json_writer_kv_bool(w, "hostname_available", interface->hostname_available);
     if (interface->hostname_available) {
-        cJSON_AddStringToObject(root, "hostname", interface->hostname);
+        utils_json_writer_kv_string(w, "hostname", interface->hostname);
     }
-    cJSON_AddBoolToObject(root, "impl_name_available", interface->impl_name_available);
+    utils_json_writer_kv_bool(w, "impl_name_available", interface->impl_name_available);
     if (interface->impl_name_available) {
-        cJSON_AddStringToObject(root, "impl_name", interface->impl_name);
-    }
-    cJSON_AddStringToObject(root, "type", network_interface_type_to_string(interface->type));
-    cJSON_AddNumberToObject(root, "type_code", (double)interface->type);
-    cJSON_AddNumberToObject(root, "flags", (double)interface->flags);
-    cJSON_AddBoolToObject(root, "is_default", interface->is_default);
-    cJSON_AddBoolToObject(root, "is_up", interface->is_up);
-    cJSON_AddBoolToObject(root, "mac_available", interface->mac_available);
+        utils_json_writer_kv_string(w, "impl_name", interface->impl_name);
+    }
+    utils_json_writer_kv_string(w, "type", network_interface_type_to_string(interface->type));
+    utils_json_writer_kv_int(w, "type_code", interface->type);
+    utils_json_writer_kv_uint(w, "flags", interface->flags);
+    utils_json_writer_kv_bool(w, "is_default", interface->is_default);
+    utils_json_writer_kv_bool(w, "is_up", interface->is_up);
+    utils_json_writer_kv_bool(w, "mac_available", interface->mac_available);
     if (interface->mac_available) {
         mac_to_string(interface->mac, mac);
-        cJSON_AddStringToObject(root, "mac", mac);
+        utils_json_writer_kv_string(w, "mac", mac);
     }
-    cJSON_AddBoolToObject(root, "impl_index_available", interface->impl_index_available);
+    utils_json_writer_kv_bool(w, "impl_index_available", interface->impl_index_available);
     if (interface->impl_index_available) {
-        cJSON_AddNumberToObject(root, "impl_index", interface->impl_index);
+        utils_json_writer_kv_int(w, "impl_index", interface->impl_index);
     }
-    cJSON_AddBoolToObject(root, "route_prio_available", interface->route_prio_available);
+    utils_json_writer_kv_bool(w, "route_prio_available", interface->route_prio_available);
     if (interface->route_prio_available) {
-        cJSON_AddNumberToObject(root, "route_prio", interface->route_prio);
+        utils_json_writer_kv_int(w, "route_prio", interface->route_prio);
     }
-    cJSON_AddBoolToObject(root, "mtu_available", interface->mtu_available);
+    utils_json_writer_kv_bool(w, "mtu_available", interface->mtu_available);
     if (interface->mtu_available) {
-        cJSON_AddNumberToObject(root, "mtu", interface->mtu);
+        utils_json_writer_kv_uint(w, "mtu", interface->mtu);
     }
-    cJSON_AddBoolToObject(root, "dhcp_client_status_available", interface->dhcp_client_status_available);
+    utils_json_writer_kv_bool(w, "dhcp_client_status_available", interface->dhcp_client_status_available);
     if (interface->dhcp_client_status_available) {
-        cJSON_AddStringToObject(root, "dhcp_client_status", network_dhcp_status_to_string(interface->dhcp_client_status));
+        utils_json_writer_kv_string(w, "dhcp_client_status", network_dhcp_status_to_string(interface->dhcp_client_status));
     }
-    cJSON_AddBoolToObject(root, "dhcp_server_status_available", interface->dhcp_server_status_available);
+    utils_json_writer_kv_bool(w, "dhcp_server_status_available", interface->dhcp_server_status_available);
     if (interface->dhcp_server_status_available) {
-        cJSON_AddStringToObject(root, "dhcp_server_status", network_dhcp_status_to_string(interface->dhcp_server_status));
+        utils_json_writer_kv_string(w, "dhcp_server_status", network_dhcp_status_to_string(interface->dhcp_server_status));
     }
-    cJSON_AddItemToObject(root, "ipv4", ipv4_info_to_json(&interface->ipv4));
-    cJSON_AddItemToObject(root, "old_ipv4", ipv4_info_to_json(&interface->old_ipv4));
-    cJSON_AddItemToObject(root, "ipv6_linklocal", ipv6_addr_to_json(&interface->ipv6_linklocal));
-    cJSON_AddItemToObject(root, "ipv6_global", ipv6_addr_to_json(&interface->ipv6_global));
+    write_ipv4_info(w, "ipv4", &interface->ipv4);
+    write_ipv4_info(w, "old_ipv4", &interface->old_ipv4);
+    write_ipv6_addr(w, "ipv6_linklocal", &interface->ipv6_linklocal);
+    write_ipv6_addr(w, "ipv6_global", &interface->ipv6_global);
 
-    cJSON* dns = cJSON_AddArrayToObject(root, "dns");
-    if (dns) {
-        for (size_t i = 0; i < DOM_MODELS_NETWORK_DNS_MAX; i++) {
-            cJSON_AddItemToArray(dns, dns_info_to_json(&interface->dns[i]));
-        }
+    utils_json_writer_key(w, "dns");
+    utils_json_writer_array_begin(w);
+    for (size_t i = 0; i < DOM_MODELS_NETWORK_DNS_MAX; i++) {
+        write_dns_info(w, &interface->dns[i]);
     }
+    utils_json_writer_array_end(w);
 
-    return root;
+    return utils_json_writer_object_end(w);
 }
 
 /* Helper Function Implementations */
@@ -186,62 +180,52 @@ static const char* network_dhcp_status_to_string(dom_models_network_dhcp_status_
     }
 }
 
-static cJSON* ipv4_info_to_json(const dom_models_network_ipv4_info_t* info) {
+static void write_ipv4_info(utils_json_writer_t* w, const char* key, const dom_models_network_ipv4_info_t* info) {
     char value[16];
-    cJSON* root = cJSON_CreateObject();
-    if (!root) {
-        return NULL;
-    }
 
-    cJSON_AddBoolToObject(root, "available", info->available);
+    utils_json_writer_key(w, key);
+    utils_json_writer_object_begin(w);
+    utils_json_writer_kv_bool(w, "available", info->available);
     if (info->available) {
         ipv4_to_string(info->ip, value);
-        cJSON_AddStringToObject(root, "ip", value);
+        utils_json_writer_kv_string(w, "ip", value);
         ipv4_to_string(info->netmask, value);
-        cJSON_AddStringToObject(root, "netmask", value);
+        utils_json_writer_kv_string(w, "netmask", value);
         ipv4_to_string(info->gateway, value);
-        cJSON_AddStringToObject(root, "gateway", value);
+        utils_json_writer_kv_string(w, "gateway", value);
     }
-
-    return root;
+    utils_json_writer_object_end(w);
 }
 
-static cJSON* ipv6_addr_to_json(const dom_models_network_ipv6_addr_t* info) {
+static void write_ipv6_addr(utils_json_writer_t* w, const char* key, const dom_models_network_ipv6_addr_t* info) {
     char value[40];
-    cJSON* root = cJSON_CreateObject();
-    if (!root) {
-        return NULL;
-    }
 
-    cJSON_AddBoolToObject(root, "available", info->available);
+    utils_json_writer_key(w, key);
+    utils_json_writer_object_begin(w);
+    utils_json_writer_kv_bool(w, "available", info->available);
     if (info->available) {
         ipv6_to_string(info->addr, value);
-        cJSON_AddStringToObject(root, "addr", value);
-        cJSON_AddNumberToObject(root, "zone", info->zone);
+        utils_json_writer_kv_string(w, "addr", value);
+        utils_json_writer_kv_uint(w, "zone", info->zone);
     }
-
-    return root;
+    utils_json_writer_object_end(w);
 }
 
-static cJSON* dns_info_to_json(const dom_models_network_dns_info_t* info) {
+static void write_dns_info(utils_json_writer_t* w, const dom_models_network_dns_info_t* info) {
     char value[40];
-    cJSON* root = cJSON_CreateObject();
-    if (!root) {
-        return NULL;
-    }
 
-    cJSON_AddBoolToObject(root, "available", info->available);
+    utils_json_writer_object_begin(w);
+    utils_json_writer_kv_bool(w, "available", info->available);
     if (info->available) {
-        cJSON_AddNumberToObject(root, "family", (double)info->addr.family);
-        cJSON_AddNumberToObject(root, "zone", info->addr.zone);
+        utils_json_writer_kv_int(w, "family", info->addr.family);
+        utils_json_writer_kv_uint(w, "zone", info->addr.zone);
         if (info->addr.family == DOM_MODELS_NETWORK_IP_FAMILY_IPV4) {
             ipv4_to_string(info->addr.bytes, value);
-            cJSON_AddStringToObject(root, "addr", value);
+            utils_json_writer_kv_string(w, "addr", value);
         } else if (info->addr.family == DOM_MODELS_NETWORK_IP_FAMILY_IPV6) {
             ipv6_to_string(info->addr.bytes, value);
-            cJSON_AddStringToObject(root, "addr", value);
+            utils_json_writer_kv_string(w, "addr", value);
         }
     }
-
-    return root;
+    utils_json_writer_object_end(w);
 }
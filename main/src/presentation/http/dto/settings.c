@@ -5,27 +5,27 @@
 #include <stdint.h>
 #include <string.h>
 
-#include "cJSON.h"
 #include "domain/models/error.h"
 #include "domain/models/system.h"
 #include "domain/usecases/settings.h"
+#include "utils/json/reader.h"
+#include "utils/json/writer.h"
 
 /* Helper Function Prototypes */
 
-static size_t bounded_strlen(const char* value, size_t max_len);
-static dom_models_error_t copy_optional_json_string(cJSON* json, const char* key, char* out, size_t out_size, bool* set);
-static dom_models_error_t copy_optional_json_uint32(cJSON* json, const char* key, uint32_t* out, bool* set);
-static cJSON* preloaded_to_json(const dom_usecases_settings_snapshot_t* snapshot);
-static cJSON* project_to_json(const dom_models_system_project_info_t* project);
-static cJSON* chip_to_json(const dom_models_system_chip_info_t* chip);
+static dom_models_error_t copy_optional_json_string(const utils_json_reader_t* json, const char* key, char* out, size_t out_size, bool* set);
+static dom_models_error_t copy_optional_json_uint32(const utils_json_reader_t* json, const char* key, uint32_t* out, bool* set);
+static void write_preloaded(utils_json_writer_t* w, const dom_usecases_settings_snapshot_t* snapshot);
+static void write_project(utils_json_writer_t* w, const dom_models_system_project_info_t* project);
+static void write_chip(utils_json_writer_t* w, const dom_models_system_chip_info_t* chip);
 
 dom_models_error_t pres_http_dto_settings_parse_preloaded_update(
-    cJSON*                                    json,
+    const utils_json_reader_t*                json,
     dom_usecases_settings_preloaded_update_t* out
 ) {
     dom_models_error_t err = DOMAIN_MODELS_ERROR_OK;
 
-    if (!json || !out || !cJSON_IsObject(json)) {
+    if (!json || !out || !utils_json_reader_is_object(json)) {
         return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
@@ -69,162 +69,127 @@ dom_models_error_t pres_http_dto_settings_parse_preloaded_update(
     return copy_optional_json_uint32(json, "system_restart_after_ms", &out->system_restart_after_ms, &out->system_restart_after_ms_set);
 }
 
-cJSON* pres_http_dto_settings_snapshot_to_json(const dom_usecases_settings_snapshot_t* snapshot) {
-    if (!snapshot) {
-        return NULL;
+bool pres_http_dto_settings_write_snapshot(utils_json_writer_t* w, const dom_usecases_settings_snapshot_t* snapshot) {
+    if (!w || !snapshot) {
+        return false;
     }
 
-    cJSON* root = cJSON_CreateObject();
-    if (!root) {
-        return NULL;
-    }
-
-    cJSON_AddNumberToObject(root, "device_id", (double)snapshot->device_id);
-    cJSON_AddStringToObject(root, "device_id_str", snapshot->device_id_str);
-    cJSON_AddItemToObject(root, "preloaded", preloaded_to_json(snapshot));
-    cJSON_AddItemToObject(root, "project", project_to_json(&snapshot->project));
-    cJSON_AddItemToObject(root, "chip", chip_to_json(&snapshot->chip));
-    cJSON_AddBoolToObject(root, "restart_required", snapshot->restart_required);
+    utils_json_writer_object_begin(w);
+    utils_json_writer_kv_uint(w, "device_id", snapshot->device_id);
+    utils_json_writer_kv_string(w, "device_id_str", snapshot->device_id_str);
+    write_preloaded(w, snapshot);
+    write_project(w, &snapshot->project);
+    write_chip(w, &snapshot->chip);
+    utils_json_writer_kv_bool(w, "restart_required", snapshot->restart_required);
 
-    return root;
+    return utils_json_writer_object_end(w);
 }
 
-cJSON* pres_http_dto_settings_preloaded_updated_to_json(bool restart_required) {
-    cJSON* root = cJSON_CreateObject();
-    if (!root) {
-        return NULL;
+bool pres_http_dto_settings_write_preloaded_updated(utils_json_writer_t* w, bool restart_required) {
+    if (!w) {
+        return false;
     }
 
-    cJSON_AddBoolToObject(root, "updated", true);
-    cJSON_AddBoolToObject(root, "restart_required", restart_required);
+    utils_json_writer_object_begin(w);
+    utils_json_writer_kv_bool(w, "updated", true);
+    utils_json_writer_kv_bool(w, "restart_required", restart_required);
 
-    return root;
+    return utils_json_writer_object_end(w);
 }
 
-cJSON* pres_http_dto_settings_restart_required_to_json(bool restart_required) {
-    cJSON* root = cJSON_CreateObject();
-    if (!root) {
-        return NULL;
+bool pres_http_dto_settings_write_restart_required(utils_json_writer_t* w, bool restart_required) {
+    if (!w) {
+        return false;
     }
 
-    cJSON_AddBoolToObject(root, "restart_required", restart_required);
+    utils_json_writer_object_begin(w);
+    utils_json_writer_kv_bool(w, "restart_required", restart_required);
 
-    return root;
+    return utils_json_writer_object_end(w);
 }
 
-cJSON* pres_http_dto_settings_accepted_to_json(void) {
-    cJSON* root = cJSON_CreateObject();
-    if (!root) {
-        return NULL;
+bool pres_http_dto_settings_write_accepted(utils_json_writer_t* w) {
+    if (!w) {
+        return false;
     }
 
-    cJSON_AddBoolToObject(root, "accepted", true);
+    utils_json_writer_object_begin(w);
+    utils_json_writer_kv_bool(w, "accepted", true);
 
-    return root;
+    return utils_json_writer_object_end(w);
 }
 
 /* Helper Function Implementations */
 
-static size_t bounded_strlen(const char* value, size_t max_len) {
-    size_t len = 0;
-
-    if (!value) {
-        return 0;
-    }
-
-    while (len < max_len && value[len] != '\0') {
-        len++;
-    }
-
-    return len;
-}
-
-static dom_models_error_t copy_optional_json_string(cJSON* json, const char* key, char* out, size_t out_size, bool* set) {
+static dom_models_error_t copy_optional_json_string(const utils_json_reader_t* json, const char* key, char* out, size_t out_size, bool* set) {
     if (!json || !key || !out || out_size == 0 || !set) {
         return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
-    cJSON* value = cJSON_GetObjectItemCaseSensitive(json, key);
-    if (!value) {
+    int value = utils_json_reader_find(json, key);
+    if (value == UTILS_JSON_READER_NONE) {
         return DOMAIN_MODELS_ERROR_OK;
     }
-    if (!cJSON_IsString(value) || !value->valuestring) {
-        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
-    }
-
-    size_t len = bounded_strlen(value->valuestring, out_size);
-    if (len >= out_size) {
+    if (!utils_json_reader_get_string(json, value, out, out_size)) {
         return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
-    memcpy(out, value->valuestring, len);
-    out[len] = '\0';
-    *set     = true;
+    *set = true;
 
     return DOMAIN_MODELS_ERROR_OK;
 }
 
-static cJSON* preloaded_to_json(const dom_usecases_settings_snapshot_t* snapshot) {
-    cJSON* root = cJSON_CreateObject();
-    if (!root) {
-        return NULL;
-    }
-
-    cJSON_AddStringToObject(root, "wifi_ap_ssid", snapshot->wifi_ap_ssid);
-    cJSON_AddStringToObject(root, "wifi_ap_pass", snapshot->wifi_ap_pass);
-    cJSON_AddStringToObject(root, "mqtt_proto", snapshot->mqtt_proto);
-    cJSON_AddStringToObject(root, "mqtt_host", snapshot->mqtt_host);
-    cJSON_AddStringToObject(root, "mqtt_port", snapshot->mqtt_port);
-    cJSON_AddStringToObject(root, "mqtt_user", snapshot->mqtt_user);
-    cJSON_AddStringToObject(root, "mqtt_pass", snapshot->mqtt_pass);
-    cJSON_AddNumberToObject(root, "system_restart_after_ms", snapshot->system_restart_after_ms);
-
-    return root;
+static void write_preloaded(utils_json_writer_t* w, const dom_usecases_settings_snapshot_t* snapshot) {
+    utils_json_writer_key(w, "preloaded");
+    utils_json_writer_object_begin(w);
+    utils_json_writer_kv_string(w, "wifi_ap_ssid", snapshot->wifi_ap_ssid);
+    utils_json_writer_kv_string(w, "wifi_ap_pass", snapshot->wifi_ap_pass);
+    utils_json_writer_kv_string(w, "mqtt_proto", snapshot->mqtt_proto);
+    utils_json_writer_kv_string(w, "mqtt_host", snapshot->mqtt_host);
+    utils_json_writer_kv_string(w, "mqtt_port", snapshot->mqtt_port);
+    utils_json_writer_kv_string(w, "mqtt_user", snapshot->mqtt_user);
+    utils_json_writer_kv_string(w, "mqtt_pass", snapshot->mqtt_pass);
+    utils_json_writer_kv_uint(w, "system_restart_after_ms", snapshot->system_restart_after_ms);
+    utils_json_writer_object_end(w);
 }
 
-static cJSON* project_to_json(const dom_models_system_project_info_t* project) {
-    cJSON* root = cJSON_CreateObject();
-    if (!root) {
-        return NULL;
-    }
-
-    cJSON_AddStringToObject(root, "project_name", project->project_name);
-    cJSON_AddStringToObject(root, "project_version", project->project_version);
-    cJSON_AddStringToObject(root, "name", project->name);
-    cJSON_AddStringToObject(root, "type", project->type);
-    cJSON_AddStringToObject(root, "firmware_version", project->firmware_version);
-
-    return root;
+static void write_project(utils_json_writer_t* w, const dom_models_system_project_info_t* project) {
+    utils_json_writer_key(w, "project");
+    utils_json_writer_object_begin(w);
+    utils_json_writer_kv_string(w, "project_name", project->project_name);
+    utils_json_writer_kv_string(w, "project_version", project->project_version);
+    utils_json_writer_kv_string(w, "name", project->name);
+    utils_json_writer_kv_string(w, "type", project->type);
+    utils_json_writer_kv_string(w, "firmware_version", project->firmware_version);
+    utils_json_writer_object_end(w);
 }
 
-static cJSON* chip_to_json(const dom_models_system_chip_info_t* chip) {
-    cJSON* root = cJSON_CreateObject();
-    if (!root) {
-        return NULL;
-    }
-
-    cJSON_AddStringToObject(root, "hardware_mac", chip->hardware_mac);
-    cJSON_AddStringToObject(root, "model", chip->model);
-    cJSON_AddNumberToObject(root, "revision", chip->revision);
-    cJSON_AddNumberToObject(root, "cores", chip->cores);
-
-    return root;
+static void write_chip(utils_json_writer_t* w, const dom_models_system_chip_info_t* chip) {
+    utils_json_writer_key(w, "chip");
+    utils_json_writer_object_begin(w);
+    utils_json_writer_kv_string(w, "hardware_mac", chip->hardware_mac);
+    utils_json_writer_kv_string(w, "model", chip->model);
+    utils_json_writer_kv_int(w, "revision", chip->revision);
+    utils_json_writer_kv_int(w, "cores", chip->cores);
+    utils_json_writer_object_end(w);
 }
 
-static dom_models_error_t copy_optional_json_uint32(cJSON* json, const char* key, uint32_t* out, bool* set) {
+static dom_models_error_t copy_optional_json_uint32(const utils_json_reader_t* json, const char* key, uint32_t* out, bool* set) {
     if (!json || !key || !out || !set) {
         return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
-    cJSON* value = cJSON_GetObjectItemCaseSensitive(json, key);
-    if (!value) {
+    int value = utils_json_reader_find(json, key);
+    if (value == UTILS_JSON_READER_NONE) {
         return DOMAIN_MODELS_ERROR_OK;
     }
-    if (!cJSON_IsNumber(value)) {
+
+    double number = 0.0;
+    if (!utils_json_reader_get_number(json, value, &number)) {
         return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
-    *out = (uint32_t)value->valuedouble;
+    *out = (uint32_t)number;
     *set = true;
 
     return DOMAIN_MODELS_ERROR_OK;
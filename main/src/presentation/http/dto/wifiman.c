@@ -1,49 +1,49 @@
 #include "presentation/http/dto/wifiman.h"
 
+#include <limits.h>
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
 
-#include "cJSON.h"
 #include "domain/models/error.h"
-#include "domain/models/network.h"
 #include "domain/models/wifi.h"
 #include "domain/usecases/wifiman.h"
+#include "presentation/http/dto/netif.h"
+#include "utils/json/reader.h"
+#include "utils/json/writer.h"
 
 /* Helper Function Prototypes */
 
 static size_t bounded_strlen(const char* value, size_t max_len);
-static dom_models_error_t copy_json_string(cJSON* json, const char* key, char* out, size_t out_size, bool required);
-static dom_models_error_t copy_optional_bool(cJSON* json, const char* key, bool* out);
-static dom_models_error_t copy_optional_u8(cJSON* json, const char* key, uint8_t* out, bool* set, uint8_t min, uint8_t max);
-static dom_models_error_t copy_optional_u32(cJSON* json, const char* key, uint32_t* out);
+static dom_models_error_t copy_json_string(const utils_json_reader_t* json, const char* key, char* out, size_t out_size, bool required);
+static dom_models_error_t copy_optional_bool(const utils_json_reader_t* json, const char* key, bool* out);
+static dom_models_error_t copy_optional_u8(const utils_json_reader_t* json, const char* key, uint8_t* out, bool* set, uint8_t min, uint8_t max);
+static dom_models_error_t copy_optional_u32(const utils_json_reader_t* json, const char* key, uint32_t* out);
+static int number_to_int(double value);
 static bool parse_mac(const char* value, uint8_t out[DOM_MODELS_WIFI_MAC_LEN]);
 static void mac_to_string(const uint8_t mac[DOM_MODELS_WIFI_MAC_LEN], char out[18]);
-static void ipv4_to_string(const uint8_t value[DOM_MODELS_NETWORK_IPV4_LEN], char out[16]);
-static void ipv6_to_string(const uint8_t value[DOM_MODELS_NETWORK_IPV6_LEN], char out[40]);
 static const char* wifi_mode_to_string(dom_models_wifi_mode_t mode);
 static const char* wifi_auth_to_string(dom_models_wifi_auth_mode_t auth_mode);
 static const char* wifi_cipher_to_string(dom_models_wifi_cipher_t cipher);
 static const char* wifi_bandwidth_to_string(dom_models_wifi_bandwidth_t bandwidth);
 static const char* wifi_second_channel_to_string(dom_models_wifi_second_channel_t second_channel);
 static const char* wifi_scan_status_to_string(dom_models_wifi_scan_status_t status);
-static const char* network_interface_type_to_string(dom_models_network_interface_type_t type);
-static const char* network_dhcp_status_to_string(dom_models_network_dhcp_status_t status);
-static cJSON* ap_record_to_json(const dom_models_wifi_ap_record_t* record);
-static cJSON* ap_client_to_json(const dom_models_wifi_ap_client_t* client);
-static cJSON* wifi_status_to_json(const dom_models_wifi_status_t* status);
-static cJSON* ipv4_info_to_json(const dom_models_network_ipv4_info_t* info);
-static cJSON* ipv6_addr_to_json(const dom_models_network_ipv6_addr_t* info);
-static cJSON* dns_info_to_json(const dom_models_network_dns_info_t* info);
-static cJSON* network_interface_to_json(const dom_models_network_interface_t* interface);
+static bool write_flag(utils_json_writer_t* w, const char* key, bool value);
+static void write_ap_record_fields(utils_json_writer_t* w, const dom_models_wifi_ap_record_t* record);
+static void write_ap_record(utils_json_writer_t* w, const dom_models_wifi_ap_record_t* record);
+static void write_scan_entry(utils_json_writer_t* w, const dom_usecases_wifiman_scan_entry_t* entry);
+static void write_ap_client(utils_json_writer_t* w, const dom_models_wifi_ap_client_t* client);
+static void write_wifi_status(utils_json_writer_t* w, const dom_models_wifi_status_t* status);
+static void write_roam_event(utils_json_writer_t* w, const dom_usecases_wifiman_roam_event_t* event);
+static void write_link(utils_json_writer_t* w, const dom_usecases_wifiman_link_t* link);
 
 dom_models_error_t pres_http_dto_wifiman_parse_sta_credential(
-    cJSON*                            json,
+    const utils_json_reader_t*        json,
     dom_models_wifi_sta_credential_t* out
 ) {
-    if (!json || !out || !cJSON_IsObject(json)) {
+    if (!json || !out || !utils_json_reader_is_object(json)) {
         return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
@@ -57,8 +57,42 @@ dom_models_error_t pres_http_dto_wifiman_parse_sta_credential(
     return copy_json_string(json, "password", out->password, sizeof(out->password), false);
 }
 
+dom_models_error_t pres_http_dto_wifiman_parse_sta_profile(
+    const utils_json_reader_t*        json,
+    dom_models_wifi_sta_credential_t* out,
+    uint8_t*                          priority
+) {
+    if (!priority) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    dom_models_error_t err = pres_http_dto_wifiman_parse_sta_credential(json, out);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
+    bool priority_set = false;
+    *priority         = 0;
+
+    return copy_optional_u8(json, "priority", priority, &priority_set, 0, UINT8_MAX);
+}
+
+dom_models_error_t pres_http_dto_wifiman_parse_sta_profile_ssid(
+    const utils_json_reader_t* json,
+    char*                      out,
+    size_t                     out_size
+) {
+    if (!json || !out || out_size == 0 || !utils_json_reader_is_object(json)) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    out[0] = '\0';
+
+    return copy_json_string(json, "ssid", out, out_size, true);
+}
+
 dom_models_error_t pres_http_dto_wifiman_parse_scan_config(
-    cJSON*                         json,
+    const utils_json_reader_t*     json,
     dom_models_wifi_scan_config_t* out
 ) {
     if (!out) {
@@ -67,10 +101,10 @@ dom_models_error_t pres_http_dto_wifiman_parse_scan_config(
 
     memset(out, 0, sizeof(dom_models_wifi_scan_config_t));
 
-    if (!json) {
+    if (utils_json_reader_empty(json)) {
         return DOMAIN_MODELS_ERROR_OK;
     }
-    if (!cJSON_IsObject(json)) {
+    if (!utils_json_reader_is_object(json)) {
         return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
@@ -80,9 +114,10 @@ dom_models_error_t pres_http_dto_wifiman_parse_scan_config(
     }
     out->ssid_set = out->ssid[0] != '\0';
 
-    cJSON* bssid = cJSON_GetObjectItemCaseSensitive(json, "bssid");
-    if (bssid) {
-        if (!cJSON_IsString(bssid) || !parse_mac(bssid->valuestring, out->bssid)) {
+    int bssid = utils_json_reader_find(json, "bssid");
+    if (bssid != UTILS_JSON_READER_NONE) {
+        char value[18];
+        if (!utils_json_reader_get_string(json, bssid, value, sizeof(value)) || !parse_mac(value, out->bssid)) {
             return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
         }
         out->bssid_set = true;
@@ -98,122 +133,176 @@ dom_models_error_t pres_http_dto_wifiman_parse_scan_config(
         return err;
     }
 
-    return copy_optional_u32(json, "timeout_ms", &out->timeout_ms);
+    err = copy_optional_u32(json, "timeout_ms", &out->timeout_ms);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
+    return copy_optional_u32(json, "max_age_ms", &out->max_age_ms);
 }
 
-cJSON* pres_http_dto_wifiman_status_to_json(const dom_usecases_wifiman_status_t* status) {
-    if (!status) {
-        return NULL;
+dom_models_error_t pres_http_dto_wifiman_parse_scan_query(
+    const utils_json_reader_t*         json,
+    dom_usecases_wifiman_scan_query_t* out
+) {
+    if (!out) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
-    cJSON* root = cJSON_CreateObject();
-    if (!root) {
-        return NULL;
-    }
+    memset(out, 0, sizeof(dom_usecases_wifiman_scan_query_t));
 
-    cJSON_AddItemToObject(root, "wifi", wifi_status_to_json(&status->wifi));
-    cJSON_AddBoolToObject(root, "sta_netif_available", status->sta_netif_available);
-    if (status->sta_netif_available) {
-        cJSON_AddItemToObject(root, "sta_netif", network_interface_to_json(&status->sta_netif));
+    if (utils_json_reader_empty(json)) {
+        return DOMAIN_MODELS_ERROR_OK;
+    }
+    if (!utils_json_reader_is_object(json)) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
-    cJSON_AddItemToObject(root, "stored_sta", pres_http_dto_wifiman_stored_sta_to_json(&status->stored_sta));
-    cJSON_AddBoolToObject(root, "auto_reconnect_enabled", status->auto_reconnect_enabled);
-    cJSON_AddNumberToObject(root, "reconnect_trial_count", (double)status->reconnect_trial_count);
-    cJSON_AddNumberToObject(root, "reconnect_max_trials", (double)status->reconnect_max_trials);
-    cJSON_AddBoolToObject(root, "ap_auto_manage_enabled", status->ap_auto_manage_enabled);
-    cJSON_AddBoolToObject(root, "sta_connection_commit_required", status->sta_connection_commit_required);
-
-    return root;
-}
 
-cJSON* pres_http_dto_wifiman_scan_result_to_json(const dom_models_wifi_scan_result_t* result) {
-    if (!result) {
-        return NULL;
+    uint32_t           offset = 0;
+    dom_models_error_t err    = copy_optional_u32(json, "offset", &offset);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
     }
 
-    cJSON* root = cJSON_CreateObject();
-    if (!root) {
-        return NULL;
+    uint32_t limit = 0;
+    err            = copy_optional_u32(json, "limit", &limit);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
     }
 
-    cJSON_AddStringToObject(root, "status", wifi_scan_status_to_string(result->status));
-    cJSON_AddNumberToObject(root, "status_code", (double)result->status);
-    cJSON_AddNumberToObject(root, "scan_id", (double)result->scan_id);
-    cJSON_AddNumberToObject(root, "driver_status", (double)result->driver_status);
-    cJSON_AddNumberToObject(root, "total_count", (double)result->total_count);
-    cJSON_AddNumberToObject(root, "count", (double)result->count);
-    cJSON_AddBoolToObject(root, "truncated", result->truncated);
+    out->offset = offset;
+    out->limit  = limit;
 
-    cJSON* records = cJSON_AddArrayToObject(root, "records");
-    if (records) {
-        for (size_t i = 0; i < result->count; i++) {
-            cJSON_AddItemToArray(records, ap_record_to_json(&result->records[i]));
-        }
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+bool pres_http_dto_wifiman_write_status(utils_json_writer_t* w, const dom_usecases_wifiman_status_t* status) {
+    if (!w || !status) {
+        return false;
     }
 
-    return root;
+    utils_json_writer_object_begin(w);
+    utils_json_writer_key(w, "wifi");
+    write_wifi_status(w, &status->wifi);
+    utils_json_writer_kv_bool(w, "sta_netif_available", status->sta_netif_available);
+    if (status->sta_netif_available) {
+        utils_json_writer_key(w, "sta_netif");
+        pres_http_dto_netif_write_interface(w, &status->sta_netif);
+    }
+    utils_json_writer_key(w, "stored_sta");
+    pres_http_dto_wifiman_write_stored_sta(w, &status->stored_sta);
+    utils_json_writer_kv_bool(w, "auto_reconnect_enabled", status->auto_reconnect_enabled);
+    utils_json_writer_kv_uint(w, "reconnect_trial_count", status->reconnect_trial_count);
+    utils_json_writer_kv_uint(w, "reconnect_max_trials", status->reconnect_max_trials);
+    utils_json_writer_kv_bool(w, "ap_auto_manage_enabled", status->ap_auto_manage_enabled);
+    utils_json_writer_kv_bool(w, "sta_connection_commit_required", status->sta_connection_commit_required);
+    utils_json_writer_key(w, "link");
+    write_link(w, &status->link);
+
+    return utils_json_writer_object_end(w);
 }
 
-cJSON* pres_http_dto_wifiman_stored_sta_to_json(const dom_usecases_wifiman_stored_sta_t* stored_sta) {
-    if (!stored_sta) {
-        return NULL;
+bool pres_http_dto_wifiman_write_scan_result(utils_json_writer_t* w, const dom_usecases_wifiman_scan_result_t* result) {
+    if (!w || !result) {
+        return false;
     }
 
-    cJSON* root = cJSON_CreateObject();
-    if (!root) {
-        return NULL;
+    utils_json_writer_object_begin(w);
+    utils_json_writer_kv_string(w, "status", wifi_scan_status_to_string(result->status));
+    utils_json_writer_kv_int(w, "status_code", result->status);
+    utils_json_writer_kv_uint(w, "scan_id", result->scan_id);
+    utils_json_writer_kv_uint(w, "driver_status", result->driver_status);
+    if (result->age_available) {
+        utils_json_writer_kv_uint(w, "age_ms", result->age_ms);
     }
+    utils_json_writer_kv_uint(w, "total_count", result->total_count);
+    utils_json_writer_kv_uint(w, "entry_count", result->entry_count);
+    utils_json_writer_kv_uint(w, "offset", result->offset);
+    utils_json_writer_kv_uint(w, "count", result->count);
+    if (result->offset + result->count < result->entry_count) {
+        utils_json_writer_kv_uint(w, "next_offset", result->offset + result->count);
+    }
+    utils_json_writer_kv_bool(w, "truncated", result->truncated);
 
-    cJSON_AddBoolToObject(root, "available", stored_sta->available);
-    if (stored_sta->available) {
-        cJSON_AddStringToObject(root, "ssid", stored_sta->ssid);
+    utils_json_writer_key(w, "stats");
+    utils_json_writer_object_begin(w);
+    utils_json_writer_kv_uint(w, "started", result->stats.started_cnt);
+    utils_json_writer_kv_uint(w, "coalesced", result->stats.coalesced_cnt);
+    utils_json_writer_kv_uint(w, "cached", result->stats.cached_cnt);
+    utils_json_writer_object_end(w);
+
+    utils_json_writer_key(w, "records");
+    utils_json_writer_array_begin(w);
+    for (size_t i = 0; i < result->count; i++) {
+        write_scan_entry(w, &result->entries[i]);
     }
+    utils_json_writer_array_end(w);
 
-    return root;
+    return utils_json_writer_object_end(w);
 }
 
-cJSON* pres_http_dto_wifiman_reconnect_need_to_json(bool needed) {
-    cJSON* root = cJSON_CreateObject();
-    if (!root) {
-        return NULL;
+bool pres_http_dto_wifiman_write_stored_sta(utils_json_writer_t* w, const dom_usecases_wifiman_stored_sta_t* stored_sta) {
+    if (!w || !stored_sta) {
+        return false;
     }
 
-    cJSON_AddBoolToObject(root, "needed", needed);
+    utils_json_writer_object_begin(w);
+    utils_json_writer_kv_bool(w, "available", stored_sta->available);
+    if (stored_sta->available) {
+        utils_json_writer_kv_string(w, "ssid", stored_sta->ssid);
+    }
 
-    return root;
+    return utils_json_writer_object_end(w);
 }
 
-cJSON* pres_http_dto_wifiman_reconnect_attempted_to_json(bool attempted) {
-    cJSON* root = cJSON_CreateObject();
-    if (!root) {
-        return NULL;
+bool pres_http_dto_wifiman_write_sta_profiles(utils_json_writer_t* w, const dom_usecases_wifiman_sta_profiles_t* profiles) {
+    if (!w || !profiles) {
+        return false;
     }
 
-    cJSON_AddBoolToObject(root, "attempted", attempted);
+    utils_json_writer_object_begin(w);
+    utils_json_writer_kv_uint(w, "count", profiles->count);
+    utils_json_writer_kv_uint(w, "capacity", DOM_MODELS_WIFI_STA_PROFILE_MAX);
 
-    return root;
-}
+    utils_json_writer_key(w, "profiles");
+    utils_json_writer_array_begin(w);
+    for (size_t i = 0; i < profiles->count; i++) {
+        const dom_usecases_wifiman_sta_profile_t* profile = &profiles->profiles[i];
 
-cJSON* pres_http_dto_wifiman_accepted_to_json(void) {
-    cJSON* root = cJSON_CreateObject();
-    if (!root) {
-        return NULL;
+        utils_json_writer_object_begin(w);
+        utils_json_writer_kv_string(w, "ssid", profile->ssid);
+        utils_json_writer_kv_uint(w, "priority", profile->priority);
+        utils_json_writer_kv_uint(w, "last_success_seq", profile->last_success_seq);
+        utils_json_writer_kv_uint(w, "failure_cnt", profile->failure_cnt);
+        utils_json_writer_kv_bool(w, "in_range", profile->in_range);
+        if (profile->in_range) {
+            utils_json_writer_kv_int(w, "rssi", profile->rssi);
+        }
+        utils_json_writer_object_end(w);
     }
+    utils_json_writer_array_end(w);
 
-    cJSON_AddBoolToObject(root, "accepted", true);
+    return utils_json_writer_object_end(w);
+}
 
-    return root;
+bool pres_http_dto_wifiman_write_reconnect_need(utils_json_writer_t* w, bool needed) {
+    return write_flag(w, "needed", needed);
 }
 
-cJSON* pres_http_dto_wifiman_forgotten_to_json(void) {
-    cJSON* root = cJSON_CreateObject();
-    if (!root) {
-        return NULL;
-    }
+bool pres_http_dto_wifiman_write_reconnect_attempted(utils_json_writer_t* w, bool attempted) {
+    return write_flag(w, "attempted", attempted);
+}
 
-    cJSON_AddBoolToObject(root, "forgotten", true);
+bool pres_http_dto_wifiman_write_accepted(utils_json_writer_t* w) {
+    return write_flag(w, "accepted", true);
+}
+
+bool pres_http_dto_wifiman_write_forgotten(utils_json_writer_t* w) {
+    return write_flag(w, "forgotten", true);
+}
 
-    return root;
+bool pres_http_dto_wifiman_write_deleted(utils_json_writer_t* w) {
+    return write_flag(w, "deleted", true);
 }
 
 /* Helper Function Implementations */
@@ -232,78 +321,88 @@ static size_t bounded_strlen(const char* value, size_t max_len) {
     return len;
 }
 
-static dom_models_error_t copy_json_string(cJSON* json, const char* key, char* out, size_t out_size, bool required) {
+static dom_models_error_t copy_json_string(const utils_json_reader_t* json, const char* key, char* out, size_t out_size, bool required) {
     if (!json || !key || !out || out_size == 0) {
         return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
-    cJSON* value = cJSON_GetObjectItemCaseSensitive(json, key);
-    if (!value) {
+    int value = utils_json_reader_find(json, key);
+    if (value == UTILS_JSON_READER_NONE) {
         if (required) {
             return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
         }
-
         out[0] = '\0';
         return DOMAIN_MODELS_ERROR_OK;
     }
-    if (!cJSON_IsString(value) || !value->valuestring) {
-        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
-    }
-
-    size_t len = bounded_strlen(value->valuestring, out_size);
-    if (len >= out_size) {
+    if (!utils_json_reader_get_string(json, value, out, out_size)) {
         return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
-    memcpy(out, value->valuestring, len);
-    out[len] = '\0';
-
     return DOMAIN_MODELS_ERROR_OK;
 }
 
-static dom_models_error_t copy_optional_bool(cJSON* json, const char* key, bool* out) {
-    cJSON* value = cJSON_GetObjectItemCaseSensitive(json, key);
-    if (!value) {
+static dom_models_error_t copy_optional_bool(const utils_json_reader_t* json, const char* key, bool* out) {
+    int value = utils_json_reader_find(json, key);
+    if (value == UTILS_JSON_READER_NONE) {
         return DOMAIN_MODELS_ERROR_OK;
     }
-    if (!cJSON_IsBool(value)) {
+    if (!utils_json_reader_get_bool(json, value, out)) {
         return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
-    *out = cJSON_IsTrue(value);
-
     return DOMAIN_MODELS_ERROR_OK;
 }
 
-static dom_models_error_t copy_optional_u8(cJSON* json, const char* key, uint8_t* out, bool* set, uint8_t min, uint8_t max) {
-    cJSON* value = cJSON_GetObjectItemCaseSensitive(json, key);
-    if (!value) {
+static dom_models_error_t copy_optional_u8(const utils_json_reader_t* json, const char* key, uint8_t* out, bool* set, uint8_t min, uint8_t max) {
+    int value = utils_json_reader_find(json, key);
+    if (value == UTILS_JSON_READER_NONE) {
         return DOMAIN_MODELS_ERROR_OK;
     }
-    if (!cJSON_IsNumber(value) || value->valueint < min || value->valueint > max) {
+
+    double number = 0.0;
+    if (!utils_json_reader_get_number(json, value, &number)) {
         return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
-    *out = (uint8_t)value->valueint;
+    int integer = number_to_int(number);
+    if (integer < min || integer > max) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    *out = (uint8_t)integer;
     *set = true;
 
     return DOMAIN_MODELS_ERROR_OK;
 }
 
-static dom_models_error_t copy_optional_u32(cJSON* json, const char* key, uint32_t* out) {
-    cJSON* value = cJSON_GetObjectItemCaseSensitive(json, key);
-    if (!value) {
+static dom_models_error_t copy_optional_u32(const utils_json_reader_t* json, const char* key, uint32_t* out) {
+    int value = utils_json_reader_find(json, key);
+    if (value == UTILS_JSON_READER_NONE) {
         return DOMAIN_MODELS_ERROR_OK;
     }
-    if (!cJSON_IsNumber(value) || value->valuedouble < 0.0 || value->valuedouble > 4294967295.0) {
+
+    double number = 0.0;
+    if (!utils_json_reader_get_number(json, value, &number) || number < 0.0 || number > 4294967295.0) {
         return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
-    *out = (uint32_t)value->valuedouble;
+    *out = (uint32_t)number;
 
     return DOMAIN_MODELS_ERROR_OK;
 }
 
+/* Saturates like cJSON's valueint, which the range checks were written against */
+static int number_to_int(double value) {
+    if (value >= INT_MAX) {
+        return INT_MAX;
+    }
+    if (value <= (double)INT_MIN) {
+        return INT_MIN;
+    }
+
+    return (int)value;
+}
+
 static bool parse_mac(const char* value, uint8_t out[DOM_MODELS_WIFI_MAC_LEN]) {
     unsigned int bytes[DOM_MODELS_WIFI_MAC_LEN];
 
@@ -354,34 +453,6 @@ static void mac_to_string(const uint8_t mac[DOM_MODELS_WIFI_MAC_LEN], char out[1
     );
 }
 
-static void ipv4_to_string(const uint8_t value[DOM_MODELS_NETWORK_IPV4_LEN], char out[16]) {
-    snprintf(out, 16, "%u.%u.%u.%u", value[0], value[1], value[2], value[3]);
-}
-
-static void ipv6_to_string(const uint8_t value[DOM_MODELS_NETWORK_IPV6_LEN], char out[40]) {
-    snprintf(
-        out,
-        40,
-        "%02X%02X:%02X%02X:%02X%02X:%02X%02X:%02X%02X:%02X%02X:%02X%02X:%02X%02X",
-        value[0],
-        value[1],
-        value[2],
-        value[3],
-        value[4],
-        value[5],
-        value[6],
-        value[7],
-        value[8],
-        value[9],
-        value[10],
-        value[11],
-        value[12],
-        value[13],
-        value[14],
-        value[15]
-    );
-}
-
 static const char* wifi_mode_to_string(dom_models_wifi_mode_t mode) {
     switch (mode) {
         case DOM_MODELS_WIFI_MODE_NULL:
@@ -523,250 +594,172 @@ static const char* wifi_scan_status_to_string(dom_models_wifi_scan_status_t stat
     }
 }
 
-static const char* network_interface_type_to_string(dom_models_network_interface_type_t type) {
-    switch (type) {
-        case DOM_MODELS_NETWORK_INTERFACE_TYPE_WIFI_STA:
-            return "WIFI_STA";
-        case DOM_MODELS_NETWORK_INTERFACE_TYPE_WIFI_AP:
-            return "WIFI_AP";
-        case DOM_MODELS_NETWORK_INTERFACE_TYPE_ETHERNET:
-            return "ETHERNET";
-        case DOM_MODELS_NETWORK_INTERFACE_TYPE_PPP:
-            return "PPP";
-        case DOM_MODELS_NETWORK_INTERFACE_TYPE_BRIDGE:
-            return "BRIDGE";
-        case DOM_MODELS_NETWORK_INTERFACE_TYPE_LOOPBACK:
-            return "LOOPBACK";
-        case DOM_MODELS_NETWORK_INTERFACE_TYPE_UNKNOWN:
-        default:
-            return "UNKNOWN";
+static bool write_flag(utils_json_writer_t* w, const char* key, bool value) {
+    if (!w) {
+        return false;
     }
-}
 
-static const char* network_dhcp_status_to_string(dom_models_network_dhcp_status_t status) {
-    switch (status) {
-        case DOM_MODELS_NETWORK_DHCP_STATUS_INIT:
-            return "INIT";
-        case DOM_MODELS_NETWORK_DHCP_STATUS_STARTED:
-            return "STARTED";
-        case DOM_MODELS_NETWORK_DHCP_STATUS_STOPPED:
-            return "STOPPED";
-        case DOM_MODELS_NETWORK_DHCP_STATUS_UNKNOWN:
-        default:
-            return "UNKNOWN";
-    }
+    utils_json_writer_object_begin(w);
+    utils_json_writer_kv_bool(w, key, value);
+
+    return utils_json_writer_object_end(w);
 }
 
-static cJSON* ap_record_to_json(const dom_models_wifi_ap_record_t* record) {
+static void write_ap_record_fields(utils_json_writer_t* w, const dom_models_wifi_ap_record_t* record) {
     char mac[18];
-    cJSON* root = cJSON_CreateObject();
-    if (!root) {
-        return NULL;
-    }
 
-    cJSON_AddBoolToObject(root, "bssid_available", record->bssid_available);
+    utils_json_writer_kv_bool(w, "bssid_available", record->bssid_available);
     if (record->bssid_available) {
         mac_to_string(record->bssid, mac);
-        cJSON_AddStringToObject(root, "bssid", mac);
-    }
-    cJSON_AddStringToObject(root, "ssid", record->ssid);
-    cJSON_AddNumberToObject(root, "primary_channel", record->primary_channel);
-    cJSON_AddStringToObject(root, "second_channel", wifi_second_channel_to_string(record->second_channel));
-    cJSON_AddNumberToObject(root, "second_channel_code", (double)record->second_channel);
-    cJSON_AddNumberToObject(root, "rssi", record->rssi);
-    cJSON_AddStringToObject(root, "auth_mode", wifi_auth_to_string(record->auth_mode));
-    cJSON_AddNumberToObject(root, "auth_mode_code", (double)record->auth_mode);
-    cJSON_AddStringToObject(root, "pairwise_cipher", wifi_cipher_to_string(record->pairwise_cipher));
-    cJSON_AddNumberToObject(root, "pairwise_cipher_code", (double)record->pairwise_cipher);
-    cJSON_AddStringToObject(root, "group_cipher", wifi_cipher_to_string(record->group_cipher));
-    cJSON_AddNumberToObject(root, "group_cipher_code", (double)record->group_cipher);
-    cJSON_AddStringToObject(root, "bandwidth", wifi_bandwidth_to_string(record->bandwidth));
-    cJSON_AddNumberToObject(root, "bandwidth_code", (double)record->bandwidth);
-    cJSON_AddNumberToObject(root, "phy_flags", (double)record->phy_flags);
-
-    return root;
-}
-
-static cJSON* ap_client_to_json(const dom_models_wifi_ap_client_t* client) {
+        utils_json_writer_kv_string(w, "bssid", mac);
+    }
+    utils_json_writer_kv_string(w, "ssid", record->ssid);
+    utils_json_writer_kv_uint(w, "primary_channel", record->primary_channel);
+    utils_json_writer_kv_string(w, "second_channel", wifi_second_channel_to_string(record->second_channel));
+    utils_json_writer_kv_int(w, "second_channel_code", record->second_channel);
+    utils_json_writer_kv_int(w, "rssi", record->rssi);
+    utils_json_writer_kv_string(w, "auth_mode", wifi_auth_to_string(record->auth_mode));
+    utils_json_writer_kv_int(w, "auth_mode_code", record->auth_mode);
+    utils_json_writer_kv_string(w, "pairwise_cipher", wifi_cipher_to_string(record->pairwise_cipher));
+    utils_json_writer_kv_int(w, "pairwise_cipher_code", record->pairwise_cipher);
+    utils_json_writer_kv_string(w, "group_cipher", wifi_cipher_to_string(record->group_cipher));
+    utils_json_writer_kv_int(w, "group_cipher_code", record->group_cipher);
+    utils_json_writer_kv_string(w, "bandwidth", wifi_bandwidth_to_string(record->bandwidth));
+    utils_json_writer_kv_int(w, "bandwidth_code", record->bandwidth);
+    utils_json_writer_kv_uint(w, "phy_flags", record->phy_flags);
+}
+
+static void write_ap_record(utils_json_writer_t* w, const dom_models_wifi_ap_record_t* record) {
+    utils_json_writer_object_begin(w);
+    write_ap_record_fields(w, record);
+    utils_json_writer_object_end(w);
+}
+
+static void write_scan_entry(utils_json_writer_t* w, const dom_usecases_wifiman_scan_entry_t* entry) {
+    utils_json_writer_object_begin(w);
+    write_ap_record_fields(w, &entry->record);
+    utils_json_writer_kv_int(w, "first_seen_ms", entry->first_seen_ms);
+    utils_json_writer_kv_int(w, "last_seen_ms", entry->last_seen_ms);
+    utils_json_writer_kv_uint(w, "seen_count", entry->seen_cnt);
+
+    utils_json_writer_key(w, "rssi_history");
+    utils_json_writer_array_begin(w);
+    for (size_t i = 0; i < entry->rssi_history_len; i++) {
+        utils_json_writer_int(w, entry->rssi_history[i]);
+    }
+    utils_json_writer_array_end(w);
+    utils_json_writer_object_end(w);
+}
+
+static void write_ap_client(utils_json_writer_t* w, const dom_models_wifi_ap_client_t* client) {
     char mac[18];
-    cJSON* root = cJSON_CreateObject();
-    if (!root) {
-        return NULL;
-    }
 
+    utils_json_writer_object_begin(w);
     mac_to_string(client->mac, mac);
-    cJSON_AddStringToObject(root, "mac", mac);
-    cJSON_AddNumberToObject(root, "rssi", client->rssi);
-    cJSON_AddNumberToObject(root, "phy_flags", (double)client->phy_flags);
-
-    return root;
+    utils_json_writer_kv_string(w, "mac", mac);
+    utils_json_writer_kv_int(w, "rssi", client->rssi);
+    utils_json_writer_kv_uint(w, "phy_flags", client->phy_flags);
+    utils_json_writer_object_end(w);
 }
 
-static cJSON* wifi_status_to_json(const dom_models_wifi_status_t* status) {
+static void write_wifi_status(utils_json_writer_t* w, const dom_models_wifi_status_t* status) {
     char mac[18];
-    cJSON* root = cJSON_CreateObject();
-    if (!root) {
-        return NULL;
-    }
 
-    cJSON_AddStringToObject(root, "mode", wifi_mode_to_string(status->mode));
-    cJSON_AddNumberToObject(root, "mode_code", (double)status->mode);
-    cJSON_AddBoolToObject(root, "started", status->started);
-    cJSON_AddBoolToObject(root, "sta_if_key_available", status->sta_if_key_available);
+    utils_json_writer_object_begin(w);
+    utils_json_writer_kv_string(w, "mode", wifi_mode_to_string(status->mode));
+    utils_json_writer_kv_int(w, "mode_code", status->mode);
+    utils_json_writer_kv_bool(w, "started", status->started);
+    utils_json_writer_kv_bool(w, "sta_if_key_available", status->sta_if_key_available);
     if (status->sta_if_key_available) {
-        cJSON_AddStringToObject(root, "sta_if_key", status->sta_if_key);
+        utils_json_writer_kv_string(w, "sta_if_key", status->sta_if_key);
     }
-    cJSON_AddBoolToObject(root, "ap_if_key_available", status->ap_if_key_available);
+    utils_json_writer_kv_bool(w, "ap_if_key_available", status->ap_if_key_available);
     if (status->ap_if_key_available) {
-        cJSON_AddStringToObject(root, "ap_if_key", status->ap_if_key);
+        utils_json_writer_kv_string(w, "ap_if_key", status->ap_if_key);
     }
-    cJSON_AddBoolToObject(root, "sta_mac_available", status->sta_mac_available);
+    utils_json_writer_kv_bool(w, "sta_mac_available", status->sta_mac_available);
     if (status->sta_mac_available) {
         mac_to_string(status->sta_mac, mac);
-        cJSON_AddStringToObject(root, "sta_mac", mac);
+        utils_json_writer_kv_string(w, "sta_mac", mac);
     }
-    cJSON_AddBoolToObject(root, "ap_mac_available", status->ap_mac_available);
+    utils_json_writer_kv_bool(w, "ap_mac_available", status->ap_mac_available);
     if (status->ap_mac_available) {
         mac_to_string(status->ap_mac, mac);
-        cJSON_AddStringToObject(root, "ap_mac", mac);
+        utils_json_writer_kv_string(w, "ap_mac", mac);
     }
-    cJSON_AddBoolToObject(root, "connected", status->connected);
-    cJSON_AddBoolToObject(root, "connected_ap_available", status->connected_ap_available);
+    utils_json_writer_kv_bool(w, "connected", status->connected);
+    utils_json_writer_kv_bool(w, "connected_ap_available", status->connected_ap_available);
     if (status->connected_ap_available) {
-        cJSON_AddItemToObject(root, "connected_ap", ap_record_to_json(&status->connected_ap));
-    }
-    cJSON_AddNumberToObject(root, "ap_client_total_count", (double)status->ap_client_total_count);
-    cJSON_AddNumberToObject(root, "ap_client_count", (double)status->ap_client_count);
-    cJSON_AddBoolToObject(root, "ap_clients_truncated", status->ap_clients_truncated);
-
-    cJSON* clients = cJSON_AddArrayToObject(root, "ap_clients");
-    if (clients) {
-        for (size_t i = 0; i < status->ap_client_count; i++) {
-            cJSON_AddItemToArray(clients, ap_client_to_json(&status->ap_clients[i]));
-        }
-    }
-
-    return root;
-}
-
-static cJSON* ipv4_info_to_json(const dom_models_network_ipv4_info_t* info) {
-    char value[16];
-    cJSON* root = cJSON_CreateObject();
-    if (!root) {
-        return NULL;
-    }
-
-    cJSON_AddBoolToObject(root, "available", info->available);
-    if (info->available) {
-        ipv4_to_string(info->ip, value);
-        cJSON_AddStringToObject(root, "ip", value);
-        ipv4_to_string(info->netmask, value);
-        cJSON_AddStringToObject(root, "netmask", value);
-        ipv4_to_string(info->gateway, value);
-        cJSON_AddStringToObject(root, "gateway", value);
-    }
-
-    return root;
-}
-
-static cJSON* ipv6_addr_to_json(const dom_models_network_ipv6_addr_t* info) {
-    char value[40];
-    cJSON* root = cJSON_CreateObject();
-    if (!root) {
-        return NULL;
+        utils_json_writer_key(w, "connected_ap");
+        write_ap_record(w, &status->connected_ap);
     }
+    utils_json_writer_kv_uint(w, "ap_client_total_count", status->ap_client_total_count);
+    utils_json_writer_kv_uint(w, "ap_client_count", status->ap_client_count);
+    utils_json_writer_kv_bool(w, "ap_clients_truncated", status->ap_clients_truncated);
 
-    cJSON_AddBoolToObject(root, "available", info->available);
-    if (info->available) {
-        ipv6_to_string(info->addr, value);
-        cJSON_AddStringToObject(root, "addr", value);
-        cJSON_AddNumberToObject(root, "zone", info->zone);
+    utils_json_writer_key(w, "ap_clients");
+    utils_json_writer_array_begin(w);
+    for (size_t i = 0; i < status->ap_client_count; i++) {
+        write_ap_client(w, &status->ap_clients[i]);
     }
+    utils_json_writer_array_end(w);
 
-    return root;
+    utils_json_writer_object_end(w);
 }
 
-static cJSON* dns_info_to_json(const dom_models_network_dns_info_t* info) {
-    char value[40];
-    cJSON* root = cJSON_CreateObject();
-    if (!root) {
-        return NULL;
-    }
-
-    cJSON_AddBoolToObject(root, "available", info->available);
-    if (info->available) {
-        cJSON_AddNumberToObject(root, "family", (double)info->addr.family);
-        cJSON_AddNumberToObject(root, "zone", info->addr.zone);
-        if (info->addr.family == DOM_MODELS_NETWORK_IP_FAMILY_IPV4) {
-            ipv4_to_string(info->addr.bytes, value);
-            cJSON_AddStringToObject(root, "addr", value);
-        } else if (info->addr.family == DOM_MODELS_NETWORK_IP_FAMILY_IPV6) {
-            ipv6_to_string(info->addr.bytes, value);
-            cJSON_AddStringToObject(root, "addr", value);
-        }
-    }
+static void write_roam_event(utils_json_writer_t* w, const dom_usecases_wifiman_roam_event_t* event) {
+    char mac[18];
 
-    return root;
+    utils_json_writer_object_begin(w);
+    utils_json_writer_kv_bool(w, "succeeded", event->succeeded);
+    mac_to_string(event->from_bssid, mac);
+    utils_json_writer_kv_string(w, "from_bssid", mac);
+    mac_to_string(event->to_bssid, mac);
+    utils_json_writer_kv_string(w, "to_bssid", mac);
+    utils_json_writer_kv_uint(w, "channel", event->channel);
+    utils_json_writer_kv_int(w, "from_rssi", event->from_rssi);
+    utils_json_writer_kv_int(w, "to_rssi", event->to_rssi);
+    utils_json_writer_kv_int(w, "at_ms", event->at_ms);
+    utils_json_writer_object_end(w);
 }
 
-static cJSON* network_interface_to_json(const dom_models_network_interface_t* interface) {
+static void write_link(utils_json_writer_t* w, const dom_usecases_wifiman_link_t* link) {
     char mac[18];
-    cJSON* root = cJSON_CreateObject();
-    if (!root) {
-        return NULL;
-    }
-
-    cJSON_AddStringToObject(root, "if_key", interface->if_key);
-    cJSON_AddStringToObject(root, "desc", interface->desc);
-    cJSON_AddBoolToObject(root, "hostname_available", interface->hostname_available);
-    if (interface->hostname_available) {
-        cJSON_AddStringToObject(root, "hostname", interface->hostname);
-    }
-    cJSON_AddBoolToObject(root, "impl_name_available", interface->impl_name_available);
-    if (interface->impl_name_available) {
-        cJSON_AddStringToObject(root, "impl_name", interface->impl_name);
-    }
-    cJSON_AddStringToObject(root, "type", network_interface_type_to_string(interface->type));
-    cJSON_AddNumberToObject(root, "type_code", (double)interface->type);
-    cJSON_AddNumberToObject(root, "flags", (double)interface->flags);
-    cJSON_AddBoolToObject(root, "is_default", interface->is_default);
-    cJSON_AddBoolToObject(root, "is_up", interface->is_up);
-    cJSON_AddBoolToObject(root, "mac_available", interface->mac_available);
-    if (interface->mac_available) {
-        mac_to_string(interface->mac, mac);
-        cJSON_AddStringToObject(root, "mac", mac);
-    }
-    cJSON_AddBoolToObject(root, "impl_index_available", interface->impl_index_available);
-    if (interface->impl_index_available) {
-        cJSON_AddNumberToObject(root, "impl_index", interface->impl_index);
-    }
-    cJSON_AddBoolToObject(root, "route_prio_available", interface->route_prio_available);
-    if (interface->route_prio_available) {
-        cJSON_AddNumberToObject(root, "route_prio", interface->route_prio);
-    }
-    cJSON_AddBoolToObject(root, "mtu_available", interface->mtu_available);
-    if (interface->mtu_available) {
-        cJSON_AddNumberToObject(root, "mtu", interface->mtu);
-    }
-    cJSON_AddBoolToObject(root, "dhcp_client_status_available", interface->dhcp_client_status_available);
-    if (interface->dhcp_client_status_available) {
-        cJSON_AddStringToObject(root, "dhcp_client_status", network_dhcp_status_to_string(interface->dhcp_client_status));
-    }
-    cJSON_AddBoolToObject(root, "dhcp_server_status_available", interface->dhcp_server_status_available);
-    if (interface->dhcp_server_status_available) {
-        cJSON_AddStringToObject(root, "dhcp_server_status", network_dhcp_status_to_string(interface->dhcp_server_status));
-    }
-    cJSON_AddItemToObject(root, "ipv4", ipv4_info_to_json(&interface->ipv4));
-    cJSON_AddItemToObject(root, "old_ipv4", ipv4_info_to_json(&interface->old_ipv4));
-    cJSON_AddItemToObject(root, "ipv6_linklocal", ipv6_addr_to_json(&interface->ipv6_linklocal));
-    cJSON_AddItemToObject(root, "ipv6_global", ipv6_addr_to_json(&interface->ipv6_global));
-
-    cJSON* dns = cJSON_AddArrayToObject(root, "dns");
-    if (dns) {
-        for (size_t i = 0; i < DOM_MODELS_NETWORK_DNS_MAX; i++) {
-            cJSON_AddItemToArray(dns, dns_info_to_json(&interface->dns[i]));
-        }
-    }
 
-    return root;
+    utils_json_writer_object_begin(w);
+    utils_json_writer_kv_bool(w, "tracking", link->tracking);
+    if (link->tracking) {
+        utils_json_writer_kv_int(w, "rssi_avg", link->rssi_avg);
+        utils_json_writer_kv_bool(w, "weak", link->weak);
+    }
+    utils_json_writer_kv_uint(w, "sample_cnt", link->sample_cnt);
+    utils_json_writer_kv_uint(w, "roam_scan_cnt", link->roam_scan_cnt);
+    utils_json_writer_kv_uint(w, "roam_attempt_cnt", link->roam_attempt_cnt);
+    utils_json_writer_kv_uint(w, "roam_success_cnt", link->roam_success_cnt);
+    utils_json_writer_kv_uint(w, "roam_failure_cnt", link->roam_failure_cnt);
+    if (link->last_roam.available) {
+        utils_json_writer_key(w, "last_roam");
+        write_roam_event(w, &link->last_roam);
+    }
+
+    utils_json_writer_key(w, "bssids");
+    utils_json_writer_array_begin(w);
+    for (size_t i = 0; i < link->bssid_count; i++) {
+        const dom_usecases_wifiman_link_bssid_t* bssid = &link->bssids[i];
+
+        utils_json_writer_object_begin(w);
+        mac_to_string(bssid->bssid, mac);
+        utils_json_writer_kv_string(w, "bssid", mac);
+        utils_json_writer_kv_uint(w, "channel", bssid->channel);
+        utils_json_writer_kv_uint(w, "sample_cnt", bssid->sample_cnt);
+        utils_json_writer_kv_uint(w, "weak_cnt", bssid->weak_cnt);
+        utils_json_writer_kv_int(w, "rssi_last", bssid->rssi_last);
+        utils_json_writer_kv_int(w, "rssi_avg", bssid->rssi_avg);
+        utils_json_writer_kv_int(w, "rssi_min", bssid->rssi_min);
+        utils_json_writer_kv_int(w, "rssi_max", bssid->rssi_max);
+        utils_json_writer_object_end(w);
+    }
+    utils_json_writer_array_end(w);
+
+    utils_json_writer_object_end(w);
 }
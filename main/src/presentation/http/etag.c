@@ -0,0 +1,188 @@
+#include "presentation/http/etag.h"
+
+#include <inttypes.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "domain/models/ethernet.h"
+#include "domain/models/wifi.h"
+#include "esp_err.h"
+#include "esp_http_server.h"
+#include "esp_random.h"
+#include "esp_timer.h"
+#include "presentation/http/metrics.h"
+
+/* Helper Function Prototypes */
+
+static bool tag_listed(const char* list, const char* tag, size_t tag_len);
+
+/* Public Function Implementations */
+
+void pres_http_etag_init(
+    pres_http_etag_t* etag,
+    uint32_t          revalidate_ms
+) {
+    if (!etag) {
+        return;
+    }
+
+    etag->boot_id       = esp_random();
+    etag->revalidate_ms = revalidate_ms;
+    atomic_init(&etag->generation, 0);
+}
+
+void pres_http_etag_bump(pres_http_etag_t* etag) {
+    if (!etag) {
+        return;
+    }
+
+    atomic_fetch_add_explicit(&etag->generation, 1, memory_order_release);
+}
+
+uint32_t pres_http_etag_generation(const pres_http_etag_t* etag) {
+    if (!etag) {
+        return 0;
+    }
+
+    return atomic_load_explicit(&etag->generation, memory_order_acquire);
+}
+
+void pres_http_etag_on_wifi_event(
+    void*                          cb_ctx,
+    const dom_models_wifi_event_t* event
+) {
+    (void)event;
+    pres_http_etag_bump(cb_ctx);
+}
+
+void pres_http_etag_on_ethernet_event(
+    void*                              cb_ctx,
+    const dom_models_ethernet_event_t* event
+) {
+    (void)event;
+    pres_http_etag_bump(cb_ctx);
+}
+
+bool pres_http_etag_match(
+    httpd_req_t*            req,
+    const pres_http_etag_t* etag,
+    char                    out[PRES_HTTP_ETAG_MAX_LEN]
+) {
+    if (!out) {
+        return false;
+    }
+
+    out[0] = '\0';
+
+    if (!req || !etag) {
+        return false;
+    }
+
+    uint32_t generation = atomic_load_explicit(&etag->generation, memory_order_acquire);
+    uint32_t epoch      = 0;
+    if (etag->revalidate_ms > 0) {
+        epoch = (uint32_t)(esp_timer_get_time() / 1000 / etag->revalidate_ms);
+    }
+
+    int written = snprintf(
+        out,
+        PRES_HTTP_ETAG_MAX_LEN,
+        "\"%08" PRIx32 "-%" PRIx32 "-%" PRIx32 "\"",
+        etag->boot_id,
+        generation,
+        epoch
+    );
+    if (written <= 0 || written >= PRES_HTTP_ETAG_MAX_LEN) {
+        out[0] = '\0';
+        return false;
+    }
+
+    return pres_http_etag_requested(req, out);
+}
+
+bool pres_http_etag_requested(
+    httpd_req_t* req,
+    const char*  tag
+) {
+    if (!req || !tag || tag[0] == '\0') {
+        return false;
+    }
+
+    /* Lists too long for the buffer only cost a full response */
+    size_t list_len = httpd_req_get_hdr_value_len(req, "If-None-Match");
+    if (list_len == 0 || list_len >= PRES_HTTP_ETAG_IF_NONE_MATCH_MAX_LEN) {
+        return false;
+    }
+
+    char list[PRES_HTTP_ETAG_IF_NONE_MATCH_MAX_LEN];
+    if (httpd_req_get_hdr_value_str(req, "If-None-Match", list, sizeof(list)) != ESP_OK) {
+        return false;
+    }
+
+    return tag_listed(list, tag, strlen(tag));
+}
+
+void pres_http_etag_set_header(
+    httpd_req_t* req,
+    const char*  tag
+) {
+    if (!req || !tag || tag[0] == '\0') {
+        return;
+    }
+
+    httpd_resp_set_hdr(req, "ETag", tag);
+    httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+}
+
+esp_err_t pres_http_etag_send_not_modified(
+    httpd_req_t* req,
+    const char*  tag
+) {
+    pres_http_etag_set_header(req, tag);
+    pres_http_metrics_set_status(req, "304 Not Modified");
+
+    return httpd_resp_send(req, NULL, 0);
+}
+
+/* Helper Function Implementations */
+
+static bool tag_listed(const char* list, const char* tag, size_t tag_len) {
+    const char* pos = list;
+    while (*pos != '\0') {
+        while (*pos == ' ' || *pos == '\t' || *pos == ',') {
+            pos++;
+        }
+        if (*pos == '\0') {
+            break;
+        }
+        if (*pos == '*') {
+            return true;
+        }
+
+        /* If-None-Match uses weak comparison, so a W/ prefix is ignored */
+        if (pos[0] == 'W' && pos[1] == '/') {
+            pos += 2;
+        }
+
+        if (*pos == '"') {
+            const char* close = strchr(pos + 1, '"');
+            if (!close) {
+                return false;
+            }
+
+            size_t entry_len = (size_t)(close - pos) + 1;
+            if (entry_len == tag_len && memcmp(pos, tag, tag_len) == 0) {
+                return true;
+            }
+            pos = close + 1;
+        }
+
+        while (*pos != '\0' && *pos != ',') {
+            pos++;
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,352 @@
+#include "presentation/http/handler/assets.h"
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/stat.h>
+
+#include "domain/models/error.h"
+#include "esp_err.h"
+#include "esp_http_server.h"
+#include "presentation/http/dto/common.h"
+#include "presentation/http/etag.h"
+#include "presentation/http/handler/assets_types.h"
+#include "presentation/http/metrics.h"
+
+#define PRES_HTTP_HANDLER_ASSETS_INDEX            "index.html"
+#define PRES_HTTP_HANDLER_ASSETS_GZIP_SUFFIX      ".gz"
+#define PRES_HTTP_HANDLER_ASSETS_ACCEPT_MAX_LEN   64
+#define PRES_HTTP_HANDLER_ASSETS_HASHED_MIN_LEN   8
+#define PRES_HTTP_HANDLER_ASSETS_CACHE_IMMUTABLE  "public, max-age=31536000, immutable"
+#define PRES_HTTP_HANDLER_ASSETS_CACHE_REVALIDATE "no-cache"
+#define PRES_HTTP_HANDLER_ASSETS_FNV_OFFSET       14695981039346656037ull
+#define PRES_HTTP_HANDLER_ASSETS_FNV_PRIME        1099511628211ull
+
+typedef struct {
+    const char* ext;
+    const char* type;
+} pres_http_handler_assets_type_t;
+
+static const pres_http_handler_assets_type_t types[] = {
+    {.ext = ".html", .type = "text/html"},
+    {.ext = ".js", .type = "text/javascript"},
+    {.ext = ".mjs", .type = "text/javascript"},
+    {.ext = ".css", .type = "text/css"},
+    {.ext = ".json", .type = "application/json"},
+    {.ext = ".map", .type = "application/json"},
+    {.ext = ".webmanifest", .type = "application/manifest+json"},
+    {.ext = ".svg", .type = "image/svg+xml"},
+    {.ext = ".png", .type = "image/png"},
+    {.ext = ".jpg", .type = "image/jpeg"},
+    {.ext = ".jpeg", .type = "image/jpeg"},
+    {.ext = ".gif", .type = "image/gif"},
+    {.ext = ".webp", .type = "image/webp"},
+    {.ext = ".ico", .type = "image/x-icon"},
+    {.ext = ".woff", .type = "font/woff"},
+    {.ext = ".woff2", .type = "font/woff2"},
+    {.ext = ".wasm", .type = "application/wasm"},
+    {.ext = ".txt", .type = "text/plain"},
+};
+
+/* Helper Function Prototypes */
+
+static dom_models_error_t get_handler(
+    httpd_req_t*                 req,
+    pres_http_handler_assets_t** out
+);
+static dom_models_error_t resolve(
+    httpd_req_t*                      req,
+    const pres_http_handler_assets_t* handler,
+    char                              path[PRES_HTTP_HANDLER_ASSETS_PATH_MAX_LEN],
+    bool*                             gzip,
+    uint32_t*                         size
+);
+static bool accepts_gzip(httpd_req_t* req);
+static bool is_file(const char* path, uint32_t* size);
+static const char* find_etag(
+    pres_http_handler_assets_t* handler,
+    const char*                 path,
+    uint32_t                    size,
+    char*                       buf
+);
+static const char* content_type(const char* path, size_t len);
+static bool is_hashed(const char* path, size_t len);
+static uint64_t hash_bytes(uint64_t hash, const void* data, size_t len);
+static esp_err_t send_file(httpd_req_t* req, const char* path, char* buf);
+
+/* Handler Implementations */
+
+esp_err_t pres_http_handler_assets_get(httpd_req_t* req) {
+    pres_http_handler_assets_t* handler = NULL;
+    dom_models_error_t          err     = get_handler(req, &handler);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return pres_http_dto_common_send_domain_error(req, err);
+    }
+
+    char     path[PRES_HTTP_HANDLER_ASSETS_PATH_MAX_LEN];
+    bool     gzip = false;
+    uint32_t size = 0;
+    err           = resolve(req, handler, path, &gzip, &size);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return pres_http_dto_common_send_domain_error(req, err);
+    }
+
+    char* buf = (char*)malloc(PRES_HTTP_HANDLER_ASSETS_CHUNK_LEN);
+    if (!buf) {
+        return pres_http_dto_common_send_domain_error(req, DOMAIN_MODELS_ERROR_MALLOC_FAILED);
+    }
+
+    /* Type and caching follow the name the client asked for, not the .gz */
+    size_t name_len = strlen(path) - (gzip ? sizeof(PRES_HTTP_HANDLER_ASSETS_GZIP_SUFFIX) - 1 : 0);
+    httpd_resp_set_type(req, content_type(path, name_len));
+    if (gzip) {
+        httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
+    }
+    httpd_resp_set_hdr(req, "Vary", "Accept-Encoding");
+    httpd_resp_set_hdr(
+        req,
+        "Cache-Control",
+        is_hashed(path, name_len) ? PRES_HTTP_HANDLER_ASSETS_CACHE_IMMUTABLE : PRES_HTTP_HANDLER_ASSETS_CACHE_REVALIDATE
+    );
+
+    /* Without a tag the file is still served, just never revalidated */
+    const char* tag = find_etag(handler, path, size, buf);
+    if (tag) {
+        httpd_resp_set_hdr(req, "ETag", tag);
+        if (pres_http_etag_requested(req, tag)) {
+            free(buf);
+            pres_http_metrics_set_status(req, "304 Not Modified");
+            return httpd_resp_send(req, NULL, 0);
+        }
+    }
+
+    esp_err_t result = send_file(req, path, buf);
+    free(buf);
+
+    return result;
+}
+
+/* Helper Function Implementations */
+
+static dom_models_error_t get_handler(
+    httpd_req_t*                 req,
+    pres_http_handler_assets_t** out
+) {
+    if (!req || !out) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    pres_http_handler_assets_t* handler = (pres_http_handler_assets_t*)req->user_ctx;
+    if (!handler || !handler->base_path) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    *out = handler;
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+static dom_models_error_t resolve(
+    httpd_req_t*                      req,
+    const pres_http_handler_assets_t* handler,
+    char                              path[PRES_HTTP_HANDLER_ASSETS_PATH_MAX_LEN],
+    bool*                             gzip,
+    uint32_t*                         size
+) {
+    const char* uri = req->uri;
+    size_t      len = strcspn(uri, "?#");
+    if (len == 0 || uri[0] != '/') {
+        return DOMAIN_MODELS_ERROR_NOT_FOUND;
+    }
+
+    /* Dot segments would walk out of base_path, hidden files are not served either */
+    for (size_t i = 0; i + 1 < len; i++) {
+        if (uri[i] == '/' && uri[i + 1] == '.') {
+            return DOMAIN_MODELS_ERROR_NOT_FOUND;
+        }
+    }
+
+    const char* index   = uri[len - 1] == '/' ? PRES_HTTP_HANDLER_ASSETS_INDEX : "";
+    int         written = snprintf(path, PRES_HTTP_HANDLER_ASSETS_PATH_MAX_LEN, "%s%.*s%s", handler->base_path, (int)len, uri, index);
+    if (written <= 0 || (size_t)written + sizeof(PRES_HTTP_HANDLER_ASSETS_GZIP_SUFFIX) > PRES_HTTP_HANDLER_ASSETS_PATH_MAX_LEN) {
+        return DOMAIN_MODELS_ERROR_NOT_FOUND;
+    }
+
+    memcpy(path + written, PRES_HTTP_HANDLER_ASSETS_GZIP_SUFFIX, sizeof(PRES_HTTP_HANDLER_ASSETS_GZIP_SUFFIX));
+
+    uint32_t gzip_size  = 0;
+    bool     gzip_found = is_file(path, &gzip_size);
+    bool     gzip_ok    = accepts_gzip(req);
+    if (gzip_found && gzip_ok) {
+        *gzip = true;
+        *size = gzip_size;
+        return DOMAIN_MODELS_ERROR_OK;
+    }
+
+    path[written] = '\0';
+    if (is_file(path, size)) {
+        *gzip = false;
+        return DOMAIN_MODELS_ERROR_OK;
+    }
+
+    /* A client that never said gzip still gets the only copy there is */
+    if (gzip_found) {
+        memcpy(path + written, PRES_HTTP_HANDLER_ASSETS_GZIP_SUFFIX, sizeof(PRES_HTTP_HANDLER_ASSETS_GZIP_SUFFIX));
+        *gzip = true;
+        *size = gzip_size;
+        return DOMAIN_MODELS_ERROR_OK;
+    }
+
+    return DOMAIN_MODELS_ERROR_NOT_FOUND;
+}
+
+static bool accepts_gzip(httpd_req_t* req) {
+    char      value[PRES_HTTP_HANDLER_ASSETS_ACCEPT_MAX_LEN];
+    esp_err_t err = httpd_req_get_hdr_value_str(req, "Accept-Encoding", value, sizeof(value));
+    if (err != ESP_OK && err != ESP_ERR_HTTPD_RESULT_TRUNC) {
+        return false;
+    }
+
+    /* A truncated list is still searched, browsers put gzip first */
+    return strstr(value, "gzip") != NULL;
+}
+
+static bool is_file(const char* path, uint32_t* size) {
+    struct stat st;
+    if (stat(path, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size < 0 || (uint64_t)st.st_size > UINT32_MAX) {
+        return false;
+    }
+
+    *size = (uint32_t)st.st_size;
+
+    return true;
+}
+
+static const char* find_etag(
+    pres_http_handler_assets_t* handler,
+    const char*                 path,
+    uint32_t                    size,
+    char*                       buf
+) {
+    uint64_t path_hash = hash_bytes(PRES_HTTP_HANDLER_ASSETS_FNV_OFFSET, path, strlen(path));
+    for (size_t i = 0; i < PRES_HTTP_HANDLER_ASSETS_ETAG_CACHE_LEN; i++) {
+        pres_http_handler_assets_etag_t* etag = &handler->etags[i];
+        if (etag->tag[0] != '\0' && etag->path_hash == path_hash && etag->size == size) {
+            return etag->tag;
+        }
+    }
+
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        return NULL;
+    }
+    setvbuf(file, NULL, _IONBF, 0);
+
+    uint64_t hash = PRES_HTTP_HANDLER_ASSETS_FNV_OFFSET;
+    size_t   read = 0;
+    while ((read = fread(buf, 1, PRES_HTTP_HANDLER_ASSETS_CHUNK_LEN, file)) > 0) {
+        hash = hash_bytes(hash, buf, read);
+    }
+    bool failed = ferror(file) != 0;
+    fclose(file);
+    if (failed) {
+        return NULL;
+    }
+
+    pres_http_handler_assets_etag_t* etag = &handler->etags[handler->etag_next];
+    handler->etag_next                    = (handler->etag_next + 1) % PRES_HTTP_HANDLER_ASSETS_ETAG_CACHE_LEN;
+
+    etag->path_hash = path_hash;
+    etag->size      = size;
+    snprintf(etag->tag, sizeof(etag->tag), "\"%016" PRIx64 "\"", hash);
+
+    return etag->tag;
+}
+
+static const char* content_type(const char* path, size_t len) {
+    for (size_t i = 0; i < sizeof(types) / sizeof(types[0]); i++) {
+        size_t ext_len = strlen(types[i].ext);
+        if (len >= ext_len && strncasecmp(path + len - ext_len, types[i].ext, ext_len) == 0) {
+            return types[i].type;
+        }
+    }
+
+    return "application/octet-stream";
+}
+
+/*
+ * Bundlers name build output like app.3f2a1b9c.js or index-BXk2f9aQ.js,
+ * so a file whose last name part before the extension is long enough and
+ * carries a digit changes name whenever it changes content.
+ */
+static bool is_hashed(const char* path, size_t len) {
+    size_t end = len;
+    while (end > 0 && path[end - 1] != '.' && path[end - 1] != '/') {
+        end--;
+    }
+    if (end == 0 || path[end - 1] != '.') {
+        return false;
+    }
+    end--;
+
+    size_t start  = end;
+    bool   digits = false;
+    while (start > 0 && path[start - 1] != '.' && path[start - 1] != '-' && path[start - 1] != '/') {
+        char c = path[start - 1];
+        if (c >= '0' && c <= '9') {
+            digits = true;
+        } else if (!((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_')) {
+            return false;
+        }
+        start--;
+    }
+    if (start == 0 || path[start - 1] == '/') {
+        return false;
+    }
+
+    return digits && end - start >= PRES_HTTP_HANDLER_ASSETS_HASHED_MIN_LEN;
+}
+
+static uint64_t hash_bytes(uint64_t hash, const void* data, size_t len) {
+    const uint8_t* bytes = (const uint8_t*)data;
+    for (size_t i = 0; i < len; i++) {
+        hash ^= bytes[i];
+        hash *= PRES_HTTP_HANDLER_ASSETS_FNV_PRIME;
+    }
+
+    return hash;
+}
+
+static esp_err_t send_file(httpd_req_t* req, const char* path, char* buf) {
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        return pres_http_dto_common_send_domain_error(req, DOMAIN_MODELS_ERROR_NOT_FOUND);
+    }
+
+    /* Chunks already match the read size, stdio buffering would only copy them twice */
+    setvbuf(file, NULL, _IONBF, 0);
+
+    esp_err_t err  = ESP_OK;
+    size_t    read = 0;
+    while ((read = fread(buf, 1, PRES_HTTP_HANDLER_ASSETS_CHUNK_LEN, file)) > 0) {
+        pres_http_metrics_count_sent(req, read);
+        err = httpd_resp_send_chunk(req, buf, (ssize_t)read);
+        if (err != ESP_OK) {
+            break;
+        }
+    }
+    if (err == ESP_OK && ferror(file)) {
+        err = ESP_FAIL;
+    }
+    fclose(file);
+
+    /* Headers are already out, so on failure all that is left is to cut the response short */
+    esp_err_t end_err = httpd_resp_send_chunk(req, NULL, 0);
+
+    return err != ESP_OK ? err : end_err;
+}
@@ -0,0 +1,77 @@
+#include "presentation/http/handler/events.h"
+
+#include "domain/models/error.h"
+#include "esp_err.h"
+#include "esp_http_server.h"
+#include "presentation/http/dto/common.h"
+#include "presentation/http/handler/events_types.h"
+#include "presentation/http/metrics.h"
+#include "presentation/task/event_stream/task.h"
+
+/* Helper Function Prototypes */
+
+static dom_models_error_t get_handler(
+    httpd_req_t*                 req,
+    pres_http_handler_events_t** out
+);
+static esp_err_t send_unavailable(httpd_req_t* req);
+
+/* Handler Implementations */
+
+esp_err_t pres_http_handler_events_subscribe(httpd_req_t* req) {
+    pres_http_handler_events_t* handler = NULL;
+    dom_models_error_t          err     = get_handler(req, &handler);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return pres_http_dto_common_send_domain_error(req, err);
+    }
+
+    /* The stream outlives this handler, so it gets a request copy of its own */
+    httpd_req_t* async_req = NULL;
+    if (httpd_req_async_handler_begin(req, &async_req) != ESP_OK) {
+        return pres_http_dto_common_send_domain_error(req, DOMAIN_MODELS_ERROR_FAILURE);
+    }
+
+    /* Headers go out with the first chunk the stream task sends */
+    httpd_resp_set_type(async_req, "text/event-stream");
+    httpd_resp_set_hdr(async_req, "Cache-Control", "no-cache");
+
+    err = pres_task_event_stream_subscribe(handler->stream, async_req);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        esp_err_t ret = err == DOMAIN_MODELS_ERROR_BAD_STATE ? send_unavailable(async_req) : pres_http_dto_common_send_domain_error(async_req, err);
+        (void)httpd_req_async_handler_complete(async_req);
+        return ret;
+    }
+
+    return ESP_OK;
+}
+
+/* Helper Function Implementations */
+
+static dom_models_error_t get_handler(
+    httpd_req_t*                 req,
+    pres_http_handler_events_t** out
+) {
+    if (!req || !out) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    pres_http_handler_events_t* handler = (pres_http_handler_events_t*)req->user_ctx;
+    if (!handler || !handler->stream) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    *out = handler;
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+static esp_err_t send_unavailable(httpd_req_t* req) {
+    static const char body[] = "{\"error\":\"BAD_STATE\"}";
+
+    pres_http_metrics_set_status(req, "503 Service Unavailable");
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Retry-After", "5");
+    pres_http_metrics_count_sent(req, sizeof(body) - 1);
+
+    return httpd_resp_send(req, body, HTTPD_RESP_USE_STRLEN);
+}
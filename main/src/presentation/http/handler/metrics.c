@@ -0,0 +1,49 @@
+#include "presentation/http/handler/metrics.h"
+
+#include "domain/models/error.h"
+#include "esp_err.h"
+#include "esp_http_server.h"
+#include "presentation/http/dto/common.h"
+#include "presentation/http/dto/metrics.h"
+#include "presentation/http/handler/metrics_types.h"
+
+/* Helper Function Prototypes */
+
+static dom_models_error_t get_handler(
+    httpd_req_t*                  req,
+    pres_http_handler_metrics_t** out
+);
+
+/* Handler Implementations */
+
+esp_err_t pres_http_handler_metrics_get(httpd_req_t* req) {
+    pres_http_handler_metrics_t* handler = NULL;
+    dom_models_error_t           err     = get_handler(req, &handler);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return pres_http_dto_common_send_domain_error(req, err);
+    }
+
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+
+    return pres_http_dto_metrics_send(req, handler->metrics);
+}
+
+/* Helper Function Implementations */
+
+static dom_models_error_t get_handler(
+    httpd_req_t*                  req,
+    pres_http_handler_metrics_t** out
+) {
+    if (!req || !out) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    pres_http_handler_metrics_t* handler = (pres_http_handler_metrics_t*)req->user_ctx;
+    if (!handler || !handler->metrics) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    *out = handler;
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
@@ -1,6 +1,5 @@
 #include "presentation/http/handler/netif.h"
 
-#include "cJSON.h"
 #include "domain/models/error.h"
 #include "domain/models/network.h"
 #include "domain/usecases/netif.h"
@@ -8,6 +7,7 @@
 #include "esp_http_server.h"
 #include "presentation/http/dto/common.h"
 #include "presentation/http/dto/netif.h"
+#include "presentation/http/etag.h"
 #include "presentation/http/handler/netif_types.h"
 
 /* Helper Function Prototypes */
@@ -17,11 +17,6 @@ static dom_models_error_t get_handler(
     pres_http_handler_netif_t** out
 );
 
-static esp_err_t send_json_and_delete(
-    httpd_req_t* req,
-    cJSON*       json
-);
-
 /* Handler Implementations */
 
 esp_err_t pres_http_handler_netif_get_all(httpd_req_t* req) {
@@ -34,13 +29,23 @@ esp_err_t pres_http_handler_netif_get_all(httpd_req_t* req) {
         return pres_http_dto_common_send_domain_error(req, DOMAIN_MODELS_ERROR_BAD_ARGUMENT);
     }
 
+    char etag[PRES_HTTP_ETAG_MAX_LEN];
+    if (pres_http_etag_match(req, handler->etag, etag)) {
+        return pres_http_etag_send_not_modified(req, etag);
+    }
+
     dom_models_network_t network;
     err = handler->netif->get_all(handler->netif, &network);
     if (err != DOMAIN_MODELS_ERROR_OK) {
         return pres_http_dto_common_send_domain_error(req, err);
     }
 
-    return send_json_and_delete(req, pres_http_dto_netif_network_to_json(&network));
+    pres_http_etag_set_header(req, etag);
+
+    pres_http_dto_common_stream_t stream;
+    pres_http_dto_netif_write_network(pres_http_dto_common_stream_begin(&stream, req), &network);
+
+    return pres_http_dto_common_stream_end(&stream);
 }
 
 esp_err_t pres_http_handler_netif_get_wifi_sta(httpd_req_t* req) {
@@ -53,13 +58,23 @@ esp_err_t pres_http_handler_netif_get_wifi_sta(httpd_req_t* req) {
         return pres_http_dto_common_send_domain_error(req, DOMAIN_MODELS_ERROR_BAD_ARGUMENT);
     }
 
+    char etag[PRES_HTTP_ETAG_MAX_LEN];
+    if (pres_http_etag_match(req, handler->etag, etag)) {
+        return pres_http_etag_send_not_modified(req, etag);
+    }
+
     dom_models_network_interface_t interface;
     err = handler->netif->get_wifi_sta(handler->netif, &interface);
     if (err != DOMAIN_MODELS_ERROR_OK) {
         return pres_http_dto_common_send_domain_error(req, err);
     }
 
-    return send_json_and_delete(req, pres_http_dto_netif_interface_to_json(&interface));
+    pres_http_etag_set_header(req, etag);
+
+    pres_http_dto_common_stream_t stream;
+    pres_http_dto_netif_write_interface(pres_http_dto_common_stream_begin(&stream, req), &interface);
+
+    return pres_http_dto_common_stream_end(&stream);
 }
 
 esp_err_t pres_http_handler_netif_get_ethernet(httpd_req_t* req) {
@@ -72,13 +87,23 @@ esp_err_t pres_http_handler_netif_get_ethernet(httpd_req_t* req) {
         return pres_http_dto_common_send_domain_error(req, DOMAIN_MODELS_ERROR_BAD_ARGUMENT);
     }
 
+    char etag[PRES_HTTP_ETAG_MAX_LEN];
+    if (pres_http_etag_match(req, handler->etag, etag)) {
+        return pres_http_etag_send_not_modified(req, etag);
+    }
+
     dom_models_network_interface_t interface;
     err = handler->netif->get_ethernet(handler->netif, &interface);
     if (err != DOMAIN_MODELS_ERROR_OK) {
         return pres_http_dto_common_send_domain_error(req, err);
     }
 
-    return send_json_and_delete(req, pres_http_dto_netif_interface_to_json(&interface));
+    pres_http_etag_set_header(req, etag);
+
+    pres_http_dto_common_stream_t stream;
+    pres_http_dto_netif_write_interface(pres_http_dto_common_stream_begin(&stream, req), &interface);
+
+    return pres_http_dto_common_stream_end(&stream);
 }
 
 /* Helper Function Implementations */
@@ -100,17 +125,3 @@ static dom_models_error_t get_handler(
 
     return DOMAIN_MODELS_ERROR_OK;
 }
-
-static esp_err_t send_json_and_delete(
-    httpd_req_t* req,
-    cJSON*       json
-) {
-    if (!json) {
-        return pres_http_dto_common_send_domain_error(req, DOMAIN_MODELS_ERROR_MALLOC_FAILED);
-    }
-
-    esp_err_t err = pres_http_dto_common_send_json(req, json);
-    cJSON_Delete(json);
-
-    return err;
-}
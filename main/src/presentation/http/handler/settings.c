@@ -1,13 +1,14 @@
 #include "presentation/http/handler/settings.h"
 
-#include "cJSON.h"
 #include "domain/models/error.h"
 #include "domain/usecases/settings.h"
 #include "esp_err.h"
 #include "esp_http_server.h"
 #include "presentation/http/dto/common.h"
 #include "presentation/http/dto/settings.h"
+#include "presentation/http/etag.h"
 #include "presentation/http/handler/settings_types.h"
+#include "presentation/http/metrics.h"
 
 /* Helper Function Prototypes */
 
@@ -16,11 +17,6 @@ static dom_models_error_t get_handler(
     pres_http_handler_settings_t** out
 );
 
-static esp_err_t send_json_and_delete(
-    httpd_req_t* req,
-    cJSON*       json
-);
-
 static esp_err_t send_accepted(httpd_req_t* req);
 
 /* Handler Implementations */
@@ -32,33 +28,39 @@ esp_err_t pres_http_handler_settings_get_snapshot(httpd_req_t* req) {
         return pres_http_dto_common_send_domain_error(req, err);
     }
 
+    char etag[PRES_HTTP_ETAG_MAX_LEN];
+    if (pres_http_etag_match(req, handler->etag, etag)) {
+        return pres_http_etag_send_not_modified(req, etag);
+    }
+
     dom_usecases_settings_snapshot_t snapshot;
     err = handler->settings->get_snapshot(handler->settings, &snapshot);
     if (err != DOMAIN_MODELS_ERROR_OK) {
         return pres_http_dto_common_send_domain_error(req, err);
     }
 
-    return send_json_and_delete(req, pres_http_dto_settings_snapshot_to_json(&snapshot));
+    pres_http_etag_set_header(req, etag);
+
+    pres_http_dto_common_stream_t stream;
+    pres_http_dto_settings_write_snapshot(pres_http_dto_common_stream_begin(&stream, req), &snapshot);
+
+    return pres_http_dto_common_stream_end(&stream);
 }
 
 esp_err_t pres_http_handler_settings_set_preloaded(httpd_req_t* req) {
     pres_http_handler_settings_t* handler = NULL;
-    cJSON*                        json    = NULL;
     dom_models_error_t            err     = get_handler(req, &handler);
     if (err != DOMAIN_MODELS_ERROR_OK) {
         return pres_http_dto_common_send_domain_error(req, err);
     }
 
-    err = pres_http_dto_common_recv_json(req, &json);
+    err = pres_http_dto_common_recv_json(req, &handler->body);
     if (err != DOMAIN_MODELS_ERROR_OK) {
         return pres_http_dto_common_send_domain_error(req, err);
     }
 
     dom_usecases_settings_preloaded_update_t update;
-    err = pres_http_dto_settings_parse_preloaded_update(json, &update);
-    if (json) {
-        cJSON_Delete(json);
-    }
+    err = pres_http_dto_settings_parse_preloaded_update(&handler->body.reader, &update);
     if (err != DOMAIN_MODELS_ERROR_OK) {
         return pres_http_dto_common_send_domain_error(req, err);
     }
@@ -69,7 +71,12 @@ esp_err_t pres_http_handler_settings_set_preloaded(httpd_req_t* req) {
         return pres_http_dto_common_send_domain_error(req, err);
     }
 
-    return send_json_and_delete(req, pres_http_dto_settings_preloaded_updated_to_json(restart_required));
+    pres_http_etag_bump(handler->etag);
+
+    pres_http_dto_common_stream_t stream;
+    pres_http_dto_settings_write_preloaded_updated(pres_http_dto_common_stream_begin(&stream, req), restart_required);
+
+    return pres_http_dto_common_stream_end(&stream);
 }
 
 esp_err_t pres_http_handler_settings_get_restart_required(httpd_req_t* req) {
@@ -85,7 +92,10 @@ esp_err_t pres_http_handler_settings_get_restart_required(httpd_req_t* req) {
         return pres_http_dto_common_send_domain_error(req, err);
     }
 
-    return send_json_and_delete(req, pres_http_dto_settings_restart_required_to_json(restart_required));
+    pres_http_dto_common_stream_t stream;
+    pres_http_dto_settings_write_restart_required(pres_http_dto_common_stream_begin(&stream, req), restart_required);
+
+    return pres_http_dto_common_stream_end(&stream);
 }
 
 esp_err_t pres_http_handler_settings_restart(httpd_req_t* req) {
@@ -130,21 +140,11 @@ static dom_models_error_t get_handler(
     return DOMAIN_MODELS_ERROR_OK;
 }
 
-static esp_err_t send_json_and_delete(
-    httpd_req_t* req,
-    cJSON*       json
-) {
-    if (!json) {
-        return pres_http_dto_common_send_domain_error(req, DOMAIN_MODELS_ERROR_MALLOC_FAILED);
-    }
-
-    esp_err_t err = pres_http_dto_common_send_json(req, json);
-    cJSON_Delete(json);
+static esp_err_t send_accepted(httpd_req_t* req) {
+    pres_http_metrics_set_status(req, "202 Accepted");
 
-    return err;
-}
+    pres_http_dto_common_stream_t stream;
+    pres_http_dto_settings_write_accepted(pres_http_dto_common_stream_begin(&stream, req));
 
-static esp_err_t send_accepted(httpd_req_t* req) {
-    httpd_resp_set_status(req, "202 Accepted");
-    return send_json_and_delete(req, pres_http_dto_settings_accepted_to_json());
+    return pres_http_dto_common_stream_end(&stream);
 }
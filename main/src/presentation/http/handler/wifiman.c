@@ -1,6 +1,7 @@
 #include "presentation/http/handler/wifiman.h"
 
-#include "cJSON.h"
+#include <stdint.h>
+
 #include "domain/models/error.h"
 #include "domain/models/wifi.h"
 #include "domain/usecases/wifiman.h"
@@ -8,7 +9,9 @@
 #include "esp_http_server.h"
 #include "presentation/http/dto/common.h"
 #include "presentation/http/dto/wifiman.h"
+#include "presentation/http/etag.h"
 #include "presentation/http/handler/wifiman_types.h"
+#include "presentation/http/metrics.h"
 
 /* Helper Function Prototypes */
 
@@ -17,11 +20,6 @@ static dom_models_error_t get_handler(
     pres_http_handler_wifiman_t** out
 );
 
-static esp_err_t send_json_and_delete(
-    httpd_req_t* req,
-    cJSON*       json
-);
-
 static esp_err_t send_accepted(httpd_req_t* req);
 
 static esp_err_t send_forgotten(httpd_req_t* req);
@@ -35,33 +33,39 @@ esp_err_t pres_http_handler_wifiman_get_status(httpd_req_t* req) {
         return pres_http_dto_common_send_domain_error(req, err);
     }
 
+    char etag[PRES_HTTP_ETAG_MAX_LEN];
+    if (pres_http_etag_match(req, handler->etag, etag)) {
+        return pres_http_etag_send_not_modified(req, etag);
+    }
+
     dom_usecases_wifiman_status_t status;
     err = handler->wifiman->get_status(handler->wifiman, &status);
     if (err != DOMAIN_MODELS_ERROR_OK) {
         return pres_http_dto_common_send_domain_error(req, err);
     }
 
-    return send_json_and_delete(req, pres_http_dto_wifiman_status_to_json(&status));
+    pres_http_etag_set_header(req, etag);
+
+    pres_http_dto_common_stream_t stream;
+    pres_http_dto_wifiman_write_status(pres_http_dto_common_stream_begin(&stream, req), &status);
+
+    return pres_http_dto_common_stream_end(&stream);
 }
 
 esp_err_t pres_http_handler_wifiman_start_scan(httpd_req_t* req) {
     pres_http_handler_wifiman_t* handler = NULL;
-    cJSON*                       json    = NULL;
     dom_models_error_t           err     = get_handler(req, &handler);
     if (err != DOMAIN_MODELS_ERROR_OK) {
         return pres_http_dto_common_send_domain_error(req, err);
     }
 
-    err = pres_http_dto_common_recv_json(req, &json);
+    err = pres_http_dto_common_recv_json(req, &handler->body);
     if (err != DOMAIN_MODELS_ERROR_OK) {
         return pres_http_dto_common_send_domain_error(req, err);
     }
 
     dom_models_wifi_scan_config_t config;
-    err = pres_http_dto_wifiman_parse_scan_config(json, &config);
-    if (json) {
-        cJSON_Delete(json);
-    }
+    err = pres_http_dto_wifiman_parse_scan_config(&handler->body.reader, &config);
     if (err != DOMAIN_MODELS_ERROR_OK) {
         return pres_http_dto_common_send_domain_error(req, err);
     }
@@ -81,33 +85,47 @@ esp_err_t pres_http_handler_wifiman_get_scan_result(httpd_req_t* req) {
         return pres_http_dto_common_send_domain_error(req, err);
     }
 
-    dom_models_wifi_scan_result_t result;
-    err = handler->wifiman->get_scan_result(handler->wifiman, &result);
+    uint32_t offset = 0;
+    err             = pres_http_dto_common_query_u32(req, "offset", &offset);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return pres_http_dto_common_send_domain_error(req, err);
+    }
+
+    uint32_t limit = 0;
+    err            = pres_http_dto_common_query_u32(req, "limit", &limit);
     if (err != DOMAIN_MODELS_ERROR_OK) {
         return pres_http_dto_common_send_domain_error(req, err);
     }
 
-    return send_json_and_delete(req, pres_http_dto_wifiman_scan_result_to_json(&result));
+    dom_usecases_wifiman_scan_query_t query = {
+        .offset = offset,
+        .limit  = limit,
+    };
+    err = handler->wifiman->get_scan_result(handler->wifiman, &query, &handler->scan_result);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return pres_http_dto_common_send_domain_error(req, err);
+    }
+
+    pres_http_dto_common_stream_t stream;
+    pres_http_dto_wifiman_write_scan_result(pres_http_dto_common_stream_begin(&stream, req), &handler->scan_result);
+
+    return pres_http_dto_common_stream_end(&stream);
 }
 
 esp_err_t pres_http_handler_wifiman_connect_sta(httpd_req_t* req) {
     pres_http_handler_wifiman_t* handler = NULL;
-    cJSON*                       json    = NULL;
     dom_models_error_t           err     = get_handler(req, &handler);
     if (err != DOMAIN_MODELS_ERROR_OK) {
         return pres_http_dto_common_send_domain_error(req, err);
     }
 
-    err = pres_http_dto_common_recv_json(req, &json);
+    err = pres_http_dto_common_recv_json(req, &handler->body);
     if (err != DOMAIN_MODELS_ERROR_OK) {
         return pres_http_dto_common_send_domain_error(req, err);
     }
 
     dom_models_wifi_sta_credential_t credential;
-    err = pres_http_dto_wifiman_parse_sta_credential(json, &credential);
-    if (json) {
-        cJSON_Delete(json);
-    }
+    err = pres_http_dto_wifiman_parse_sta_credential(&handler->body.reader, &credential);
     if (err != DOMAIN_MODELS_ERROR_OK) {
         return pres_http_dto_common_send_domain_error(req, err);
     }
@@ -117,6 +135,8 @@ esp_err_t pres_http_handler_wifiman_connect_sta(httpd_req_t* req) {
         return pres_http_dto_common_send_domain_error(req, err);
     }
 
+    pres_http_etag_bump(handler->etag);
+
     esp_err_t http_err = send_accepted(req);
     if (http_err != ESP_OK) {
         return http_err;
@@ -166,6 +186,7 @@ esp_err_t pres_http_handler_wifiman_disconnect_sta(httpd_req_t* req) {
     }
 
     (void)handler->wifiman->disconnect_sta(handler->wifiman);
+    pres_http_etag_bump(handler->etag);
 
     return ESP_OK;
 }
@@ -192,6 +213,7 @@ esp_err_t pres_http_handler_wifiman_commit_sta_connection(httpd_req_t* req) {
     }
 
     (void)handler->wifiman->commit_sta_connection(handler->wifiman);
+    pres_http_etag_bump(handler->etag);
 
     return ESP_OK;
 }
@@ -209,27 +231,26 @@ esp_err_t pres_http_handler_wifiman_get_stored_sta(httpd_req_t* req) {
         return pres_http_dto_common_send_domain_error(req, err);
     }
 
-    return send_json_and_delete(req, pres_http_dto_wifiman_stored_sta_to_json(&stored_sta));
+    pres_http_dto_common_stream_t stream;
+    pres_http_dto_wifiman_write_stored_sta(pres_http_dto_common_stream_begin(&stream, req), &stored_sta);
+
+    return pres_http_dto_common_stream_end(&stream);
 }
 
 esp_err_t pres_http_handler_wifiman_set_sta_credential(httpd_req_t* req) {
     pres_http_handler_wifiman_t* handler = NULL;
-    cJSON*                       json    = NULL;
     dom_models_error_t           err     = get_handler(req, &handler);
     if (err != DOMAIN_MODELS_ERROR_OK) {
         return pres_http_dto_common_send_domain_error(req, err);
     }
 
-    err = pres_http_dto_common_recv_json(req, &json);
+    err = pres_http_dto_common_recv_json(req, &handler->body);
     if (err != DOMAIN_MODELS_ERROR_OK) {
         return pres_http_dto_common_send_domain_error(req, err);
     }
 
     dom_models_wifi_sta_credential_t credential;
-    err = pres_http_dto_wifiman_parse_sta_credential(json, &credential);
-    if (json) {
-        cJSON_Delete(json);
-    }
+    err = pres_http_dto_wifiman_parse_sta_credential(&handler->body.reader, &credential);
     if (err != DOMAIN_MODELS_ERROR_OK) {
         return pres_http_dto_common_send_domain_error(req, err);
     }
@@ -239,13 +260,18 @@ esp_err_t pres_http_handler_wifiman_set_sta_credential(httpd_req_t* req) {
         return pres_http_dto_common_send_domain_error(req, err);
     }
 
+    pres_http_etag_bump(handler->etag);
+
     dom_usecases_wifiman_stored_sta_t stored_sta;
     err = handler->wifiman->get_stored_sta(handler->wifiman, &stored_sta);
     if (err != DOMAIN_MODELS_ERROR_OK) {
         return pres_http_dto_common_send_domain_error(req, err);
     }
 
-    return send_json_and_delete(req, pres_http_dto_wifiman_stored_sta_to_json(&stored_sta));
+    pres_http_dto_common_stream_t stream;
+    pres_http_dto_wifiman_write_stored_sta(pres_http_dto_common_stream_begin(&stream, req), &stored_sta);
+
+    return pres_http_dto_common_stream_end(&stream);
 }
 
 esp_err_t pres_http_handler_wifiman_forget_sta_credential(httpd_req_t* req) {
@@ -260,9 +286,99 @@ esp_err_t pres_http_handler_wifiman_forget_sta_credential(httpd_req_t* req) {
         return pres_http_dto_common_send_domain_error(req, err);
     }
 
+    pres_http_etag_bump(handler->etag);
+
     return send_forgotten(req);
 }
 
+esp_err_t pres_http_handler_wifiman_get_sta_profiles(httpd_req_t* req) {
+    pres_http_handler_wifiman_t* handler = NULL;
+    dom_models_error_t           err     = get_handler(req, &handler);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return pres_http_dto_common_send_domain_error(req, err);
+    }
+
+    dom_usecases_wifiman_sta_profiles_t profiles;
+    err = handler->wifiman->get_sta_profiles(handler->wifiman, &profiles);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return pres_http_dto_common_send_domain_error(req, err);
+    }
+
+    pres_http_dto_common_stream_t stream;
+    pres_http_dto_wifiman_write_sta_profiles(pres_http_dto_common_stream_begin(&stream, req), &profiles);
+
+    return pres_http_dto_common_stream_end(&stream);
+}
+
+esp_err_t pres_http_handler_wifiman_set_sta_profile(httpd_req_t* req) {
+    pres_http_handler_wifiman_t* handler = NULL;
+    dom_models_error_t           err     = get_handler(req, &handler);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return pres_http_dto_common_send_domain_error(req, err);
+    }
+
+    err = pres_http_dto_common_recv_json(req, &handler->body);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return pres_http_dto_common_send_domain_error(req, err);
+    }
+
+    dom_models_wifi_sta_credential_t credential;
+    uint8_t                          priority = 0;
+    err = pres_http_dto_wifiman_parse_sta_profile(&handler->body.reader, &credential, &priority);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return pres_http_dto_common_send_domain_error(req, err);
+    }
+
+    err = handler->wifiman->set_sta_profile(handler->wifiman, &credential, priority);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return pres_http_dto_common_send_domain_error(req, err);
+    }
+
+    pres_http_etag_bump(handler->etag);
+
+    dom_usecases_wifiman_sta_profiles_t profiles;
+    err = handler->wifiman->get_sta_profiles(handler->wifiman, &profiles);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return pres_http_dto_common_send_domain_error(req, err);
+    }
+
+    pres_http_dto_common_stream_t stream;
+    pres_http_dto_wifiman_write_sta_profiles(pres_http_dto_common_stream_begin(&stream, req), &profiles);
+
+    return pres_http_dto_common_stream_end(&stream);
+}
+
+esp_err_t pres_http_handler_wifiman_delete_sta_profile(httpd_req_t* req) {
+    pres_http_handler_wifiman_t* handler = NULL;
+    dom_models_error_t           err     = get_handler(req, &handler);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return pres_http_dto_common_send_domain_error(req, err);
+    }
+
+    err = pres_http_dto_common_recv_json(req, &handler->body);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return pres_http_dto_common_send_domain_error(req, err);
+    }
+
+    char ssid[DOM_MODELS_WIFI_SSID_BUF_LEN];
+    err = pres_http_dto_wifiman_parse_sta_profile_ssid(&handler->body.reader, ssid, sizeof(ssid));
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return pres_http_dto_common_send_domain_error(req, err);
+    }
+
+    err = handler->wifiman->delete_sta_profile(handler->wifiman, ssid);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return pres_http_dto_common_send_domain_error(req, err);
+    }
+
+    pres_http_etag_bump(handler->etag);
+
+    pres_http_dto_common_stream_t stream;
+    pres_http_dto_wifiman_write_deleted(pres_http_dto_common_stream_begin(&stream, req));
+
+    return pres_http_dto_common_stream_end(&stream);
+}
+
 esp_err_t pres_http_handler_wifiman_need_reconnect(httpd_req_t* req) {
     pres_http_handler_wifiman_t* handler = NULL;
     dom_models_error_t           err     = get_handler(req, &handler);
@@ -276,7 +392,10 @@ esp_err_t pres_http_handler_wifiman_need_reconnect(httpd_req_t* req) {
         return pres_http_dto_common_send_domain_error(req, err);
     }
 
-    return send_json_and_delete(req, pres_http_dto_wifiman_reconnect_need_to_json(needed));
+    pres_http_dto_common_stream_t stream;
+    pres_http_dto_wifiman_write_reconnect_need(pres_http_dto_common_stream_begin(&stream, req), needed);
+
+    return pres_http_dto_common_stream_end(&stream);
 }
 
 esp_err_t pres_http_handler_wifiman_try_reconnect(httpd_req_t* req) {
@@ -293,6 +412,7 @@ esp_err_t pres_http_handler_wifiman_try_reconnect(httpd_req_t* req) {
 
     bool attempted = false;
     (void)handler->wifiman->try_reconnect(handler->wifiman, &attempted);
+    pres_http_etag_bump(handler->etag);
 
     return ESP_OK;
 }
@@ -317,25 +437,18 @@ static dom_models_error_t get_handler(
     return DOMAIN_MODELS_ERROR_OK;
 }
 
-static esp_err_t send_json_and_delete(
-    httpd_req_t* req,
-    cJSON*       json
-) {
-    if (!json) {
-        return pres_http_dto_common_send_domain_error(req, DOMAIN_MODELS_ERROR_MALLOC_FAILED);
-    }
+static esp_err_t send_accepted(httpd_req_t* req) {
+    pres_http_metrics_set_status(req, "202 Accepted");
 
-    esp_err_t err = pres_http_dto_common_send_json(req, json);
-    cJSON_Delete(json);
+    pres_http_dto_common_stream_t stream;
+    pres_http_dto_wifiman_write_accepted(pres_http_dto_common_stream_begin(&stream, req));
 
-    return err;
-}
-
-static esp_err_t send_accepted(httpd_req_t* req) {
-    httpd_resp_set_status(req, "202 Accepted");
-    return send_json_and_delete(req, pres_http_dto_wifiman_accepted_to_json());
+    return pres_http_dto_common_stream_end(&stream);
 }
 
 static esp_err_t send_forgotten(httpd_req_t* req) {
-    return send_json_and_delete(req, pres_http_dto_wifiman_forgotten_to_json());
+    pres_http_dto_common_stream_t stream;
+    pres_http_dto_wifiman_write_forgotten(pres_http_dto_common_stream_begin(&stream, req));
+
+    return pres_http_dto_common_stream_end(&stream);
 }
@@ -0,0 +1,209 @@
+#include "presentation/http/metrics.h"
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_err.h"
+#include "esp_http_server.h"
+#include "esp_system.h"
+#include "esp_timer.h"
+#include "presentation/http/router.h"
+
+/* Helper Function Prototypes */
+
+static pres_http_metrics_request_t* active_request(httpd_req_t* req);
+static uint16_t parse_status(const char* status);
+static size_t latency_bucket(uint32_t elapsed_us);
+static void store_max(_Atomic int32_t* max, int32_t value);
+
+/* Public Function Implementations */
+
+pres_http_metrics_t* pres_http_metrics_new(void) {
+    pres_http_metrics_t* metrics = (pres_http_metrics_t*)calloc(1, sizeof(pres_http_metrics_t));
+    if (!metrics) {
+        return NULL;
+    }
+
+    atomic_init(&metrics->route_cnt, 0);
+
+    return metrics;
+}
+
+void pres_http_metrics_delete(pres_http_metrics_t* metrics) {
+    free(metrics);
+}
+
+pres_http_metrics_route_t* pres_http_metrics_add_route(
+    pres_http_metrics_t* metrics,
+    const char*          uri,
+    httpd_method_t       method
+) {
+    if (!metrics || !uri) {
+        return NULL;
+    }
+
+    uint32_t route_cnt = atomic_load_explicit(&metrics->route_cnt, memory_order_acquire);
+    for (uint32_t i = 0; i < route_cnt; i++) {
+        if (metrics->routes[i].method == method && strcmp(metrics->routes[i].uri, uri) == 0) {
+            return &metrics->routes[i];
+        }
+    }
+
+    if (route_cnt >= PRES_HTTP_METRICS_ROUTE_MAX) {
+        return NULL;
+    }
+
+    pres_http_metrics_route_t* route = &metrics->routes[route_cnt];
+    route->uri                       = uri;
+    route->method                    = method;
+    atomic_store_explicit(&metrics->route_cnt, route_cnt + 1, memory_order_release);
+
+    return route;
+}
+
+uint32_t pres_http_metrics_route_cnt(const pres_http_metrics_t* metrics) {
+    if (!metrics) {
+        return 0;
+    }
+
+    return atomic_load_explicit(&metrics->route_cnt, memory_order_acquire);
+}
+
+void pres_http_metrics_begin(
+    pres_http_metrics_t*         metrics,
+    pres_http_metrics_route_t*   route,
+    httpd_req_t*                 req,
+    pres_http_metrics_request_t* request
+) {
+    if (!metrics || !route || !req || !request) {
+        return;
+    }
+
+    request->route      = route;
+    request->req        = req;
+    request->status     = 200;
+    request->bytes_out  = 0;
+    request->free_heap  = esp_get_free_heap_size();
+    request->started_us = esp_timer_get_time();
+
+    metrics->active = request;
+}
+
+void pres_http_metrics_end(
+    pres_http_metrics_t*         metrics,
+    pres_http_metrics_request_t* request,
+    esp_err_t                    result
+) {
+    if (!metrics || !request || !request->route) {
+        return;
+    }
+
+    int64_t  elapsed_us = esp_timer_get_time() - request->started_us;
+    uint32_t free_heap  = esp_get_free_heap_size();
+    metrics->active     = NULL;
+
+    if (elapsed_us < 0) {
+        elapsed_us = 0;
+    } else if (elapsed_us > UINT32_MAX) {
+        elapsed_us = UINT32_MAX;
+    }
+
+    pres_http_metrics_route_t* route      = request->route;
+    int32_t                    heap_delta = (int32_t)(request->free_heap - free_heap);
+
+    atomic_fetch_add_explicit(&route->request_cnt, 1, memory_order_relaxed);
+    if (result != ESP_OK) {
+        atomic_fetch_add_explicit(&route->failed_cnt, 1, memory_order_relaxed);
+    }
+    if (request->status >= 100 && request->status < 600) {
+        atomic_fetch_add_explicit(&route->status_cnt[request->status / 100 - 1], 1, memory_order_relaxed);
+    }
+    atomic_fetch_add_explicit(&route->latency_cnt[latency_bucket((uint32_t)elapsed_us)], 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&route->latency_sum_us, (uint64_t)elapsed_us, memory_order_relaxed);
+    atomic_fetch_add_explicit(&route->bytes_in, (uint32_t)request->req->content_len, memory_order_relaxed);
+    atomic_fetch_add_explicit(&route->bytes_out, request->bytes_out, memory_order_relaxed);
+    atomic_fetch_add_explicit(&route->heap_delta_sum, heap_delta, memory_order_relaxed);
+    store_max(&route->heap_delta_max, heap_delta);
+}
+
+esp_err_t pres_http_metrics_set_status(
+    httpd_req_t* req,
+    const char*  status
+) {
+    pres_http_metrics_request_t* request = active_request(req);
+    if (request) {
+        request->status = parse_status(status);
+    }
+
+    return httpd_resp_set_status(req, status);
+}
+
+void pres_http_metrics_count_sent(
+    httpd_req_t* req,
+    size_t       len
+) {
+    pres_http_metrics_request_t* request = active_request(req);
+    if (request) {
+        request->bytes_out += (uint32_t)len;
+    }
+}
+
+uint32_t pres_http_metrics_latency_bound_us(size_t bucket) {
+    if (bucket >= PRES_HTTP_METRICS_LATENCY_BUCKET_CNT) {
+        return 0;
+    }
+
+    return (uint32_t)PRES_HTTP_METRICS_LATENCY_BASE_US << bucket;
+}
+
+/* Helper Function Implementations */
+
+static pres_http_metrics_request_t* active_request(httpd_req_t* req) {
+    if (!req) {
+        return NULL;
+    }
+
+    /* Async request copies never match, their handler already returned */
+    pres_http_router_t*  router  = pres_http_router_from_server(req->handle);
+    pres_http_metrics_t* metrics = router ? router->metrics : NULL;
+    if (!metrics || !metrics->active || metrics->active->req != req) {
+        return NULL;
+    }
+
+    return metrics->active;
+}
+
+static uint16_t parse_status(const char* status) {
+    if (!status) {
+        return 0;
+    }
+
+    uint16_t code = 0;
+    for (size_t i = 0; i < 3; i++) {
+        if (status[i] < '0' || status[i] > '9') {
+            return 0;
+        }
+        code = (uint16_t)(code * 10 + (uint16_t)(status[i] - '0'));
+    }
+
+    return code;
+}
+
+static size_t latency_bucket(uint32_t elapsed_us) {
+    size_t bucket = 0;
+    while (bucket < PRES_HTTP_METRICS_LATENCY_BUCKET_CNT && elapsed_us > pres_http_metrics_latency_bound_us(bucket)) {
+        bucket++;
+    }
+
+    return bucket;
+}
+
+static void store_max(_Atomic int32_t* max, int32_t value) {
+    int32_t current = atomic_load_explicit(max, memory_order_relaxed);
+    while (value > current && !atomic_compare_exchange_weak_explicit(max, &current, value, memory_order_relaxed, memory_order_relaxed)) {
+    }
+}
@@ -0,0 +1,55 @@
+#include "presentation/http/route/common.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "esp_err.h"
+#include "esp_http_server.h"
+#include "presentation/http/admission.h"
+#include "presentation/http/router.h"
+
+/* Helper Function Prototypes */
+
+static bool routed(const char* uri);
+
+/* Public Function Implementations */
+
+esp_err_t pres_http_route_common_register(
+    httpd_handle_t              server,
+    const httpd_uri_t*          uri,
+    pres_http_admission_class_t admission
+) {
+    if (!server || !uri) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    pres_http_router_t* router = pres_http_router_from_server(server);
+    if (!router || !routed(uri->uri)) {
+        return httpd_register_uri_handler(server, uri);
+    }
+
+    return pres_http_router_add(router, uri, admission);
+}
+
+esp_err_t pres_http_route_common_unregister(
+    httpd_handle_t server,
+    const char*    uri,
+    httpd_method_t method
+) {
+    if (!server || !uri) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    pres_http_router_t* router = pres_http_router_from_server(server);
+    if (!router || !routed(uri)) {
+        return httpd_unregister_uri_handler(server, uri, method);
+    }
+
+    return pres_http_router_remove(router, uri, method);
+}
+
+/* Helper Function Implementations */
+
+static bool routed(const char* uri) {
+    return uri && strncmp(uri, PRES_HTTP_ROUTER_PREFIX, sizeof(PRES_HTTP_ROUTER_PREFIX) - 1) == 0;
+}
@@ -0,0 +1,72 @@
+#include "presentation/http/route/metrics.h"
+
+#include <stddef.h>
+
+#include "esp_err.h"
+#include "esp_http_server.h"
+#include "presentation/http/admission.h"
+#include "presentation/http/handler/metrics.h"
+#include "presentation/http/handler/metrics_types.h"
+#include "presentation/http/route/common.h"
+
+typedef struct {
+    const char* uri;
+    httpd_method_t method;
+    esp_err_t (*handler)(httpd_req_t* req);
+    pres_http_admission_class_t admission;
+} pres_http_route_metrics_route_t;
+
+static const pres_http_route_metrics_route_t routes[] = {
+    {
+        .uri       = "/api/metrics",
+        .method    = HTTP_GET,
+        .handler   = pres_http_handler_metrics_get,
+        .admission = PRES_HTTP_ADMISSION_CLASS_READ,
+    },
+};
+
+esp_err_t pres_http_route_metrics_register(
+    httpd_handle_t               server,
+    pres_http_handler_metrics_t* handler
+) {
+    if (!server || !handler) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    for (size_t i = 0; i < pres_http_route_metrics_route_cnt(); i++) {
+        httpd_uri_t route = {
+            .uri      = routes[i].uri,
+            .method   = routes[i].method,
+            .handler  = routes[i].handler,
+            .user_ctx = handler,
+        };
+
+        esp_err_t err = pres_http_route_common_register(server, &route, routes[i].admission);
+        if (err != ESP_OK) {
+            return err;
+        }
+    }
+
+    return ESP_OK;
+}
+
+esp_err_t pres_http_route_metrics_unregister(httpd_handle_t server) {
+    if (!server) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_err_t result = ESP_OK;
+
+    for (size_t i = 0; i < pres_http_route_metrics_route_cnt(); i++) {
+        esp_err_t err = pres_http_route_common_unregister(server, routes[i].uri, routes[i].method);
+        if (err != ESP_OK && result == ESP_OK) {
+            result = err;
+        }
+    }
+
+    return result;
+}
+
+size_t pres_http_route_metrics_route_cnt(void) {
+    return sizeof(routes) / sizeof(routes[0]);
+}
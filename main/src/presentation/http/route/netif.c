@@ -4,30 +4,36 @@
 
 #include "esp_err.h"
 #include "esp_http_server.h"
+#include "presentation/http/admission.h"
 #include "presentation/http/handler/netif.h"
 #include "presentation/http/handler/netif_types.h"
+#include "presentation/http/route/common.h"
 
 typedef struct {
     const char* uri;
     httpd_method_t method;
     esp_err_t (*handler)(httpd_req_t* req);
+    pres_http_admission_class_t admission;
 } pres_http_route_netif_route_t;
 
 static const pres_http_route_netif_route_t routes[] = {
     {
-        .uri     = "/api/netif",
-        .method  = HTTP_GET,
-        .handler = pres_http_handler_netif_get_all,
+        .uri       = "/api/netif",
+        .method    = HTTP_GET,
+        .handler   = pres_http_handler_netif_get_all,
+        .admission = PRES_HTTP_ADMISSION_CLASS_READ,
     },
     {
-        .uri     = "/api/netif/wifi/sta",
-        .method  = HTTP_GET,
-        .handler = pres_http_handler_netif_get_wifi_sta,
+        .uri       = "/api/netif/wifi/sta",
+        .method    = HTTP_GET,
+        .handler   = pres_http_handler_netif_get_wifi_sta,
+        .admission = PRES_HTTP_ADMISSION_CLASS_READ,
     },
     {
-        .uri     = "/api/netif/ethernet",
-        .method  = HTTP_GET,
-        .handler = pres_http_handler_netif_get_ethernet,
+        .uri       = "/api/netif/ethernet",
+        .method    = HTTP_GET,
+        .handler   = pres_http_handler_netif_get_ethernet,
+        .admission = PRES_HTTP_ADMISSION_CLASS_READ,
     },
 };
 
@@ -47,7 +53,7 @@ esp_err_t pres_http_route_netif_register(
             .user_ctx = handler,
         };
 
-        esp_err_t err = httpd_register_uri_handler(server, &route);
+        esp_err_t err = pres_http_route_common_register(server, &route, routes[i].admission);
         if (err != ESP_OK) {
             return err;
         }
@@ -64,7 +70,7 @@ esp_err_t pres_http_route_netif_unregister(httpd_handle_t server) {
     esp_err_t result = ESP_OK;
 
     for (size_t i = 0; i < pres_http_route_netif_route_cnt(); i++) {
-        esp_err_t err = httpd_unregister_uri_handler(server, routes[i].uri, routes[i].method);
+        esp_err_t err = pres_http_route_common_unregister(server, routes[i].uri, routes[i].method);
         if (err != ESP_OK && result == ESP_OK) {
             result = err;
         }
@@ -4,35 +4,42 @@
 
 #include "esp_err.h"
 #include "esp_http_server.h"
+#include "presentation/http/admission.h"
 #include "presentation/http/handler/settings.h"
 #include "presentation/http/handler/settings_types.h"
+#include "presentation/http/route/common.h"
 
 typedef struct {
     const char* uri;
     httpd_method_t method;
     esp_err_t (*handler)(httpd_req_t* req);
+    pres_http_admission_class_t admission;
 } pres_http_route_settings_route_t;
 
 static const pres_http_route_settings_route_t routes[] = {
     {
-        .uri     = "/api/settings",
-        .method  = HTTP_GET,
-        .handler = pres_http_handler_settings_get_snapshot,
+        .uri       = "/api/settings",
+        .method    = HTTP_GET,
+        .handler   = pres_http_handler_settings_get_snapshot,
+        .admission = PRES_HTTP_ADMISSION_CLASS_READ,
     },
     {
-        .uri     = "/api/settings/preloaded",
-        .method  = HTTP_PATCH,
-        .handler = pres_http_handler_settings_set_preloaded,
+        .uri       = "/api/settings/preloaded",
+        .method    = HTTP_PATCH,
+        .handler   = pres_http_handler_settings_set_preloaded,
+        .admission = PRES_HTTP_ADMISSION_CLASS_WRITE,
     },
     {
-        .uri     = "/api/settings/restart-required",
-        .method  = HTTP_GET,
-        .handler = pres_http_handler_settings_get_restart_required,
+        .uri       = "/api/settings/restart-required",
+        .method    = HTTP_GET,
+        .handler   = pres_http_handler_settings_get_restart_required,
+        .admission = PRES_HTTP_ADMISSION_CLASS_READ,
     },
     {
-        .uri     = "/api/settings/restart",
-        .method  = HTTP_POST,
-        .handler = pres_http_handler_settings_restart,
+        .uri       = "/api/settings/restart",
+        .method    = HTTP_POST,
+        .handler   = pres_http_handler_settings_restart,
+        .admission = PRES_HTTP_ADMISSION_CLASS_EXPENSIVE,
     },
 };
 
@@ -52,7 +59,7 @@ esp_err_t pres_http_route_settings_register(
             .user_ctx = handler,
         };
 
-        esp_err_t err = httpd_register_uri_handler(server, &route);
+        esp_err_t err = pres_http_route_common_register(server, &route, routes[i].admission);
         if (err != ESP_OK) {
             return err;
         }
@@ -69,7 +76,7 @@ esp_err_t pres_http_route_settings_unregister(httpd_handle_t server) {
     esp_err_t result = ESP_OK;
 
     for (size_t i = 0; i < pres_http_route_settings_route_cnt(); i++) {
-        esp_err_t err = httpd_unregister_uri_handler(server, routes[i].uri, routes[i].method);
+        esp_err_t err = pres_http_route_common_unregister(server, routes[i].uri, routes[i].method);
         if (err != ESP_OK && result == ESP_OK) {
             result = err;
         }
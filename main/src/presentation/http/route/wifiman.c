@@ -4,75 +4,108 @@
 
 #include "esp_err.h"
 #include "esp_http_server.h"
+#include "presentation/http/admission.h"
 #include "presentation/http/handler/wifiman.h"
 #include "presentation/http/handler/wifiman_types.h"
+#include "presentation/http/route/common.h"
 
 typedef struct {
     const char* uri;
     httpd_method_t method;
     esp_err_t (*handler)(httpd_req_t* req);
+    pres_http_admission_class_t admission;
 } pres_http_route_wifiman_route_t;
 
 static const pres_http_route_wifiman_route_t routes[] = {
     {
-        .uri     = "/api/wifi/status",
-        .method  = HTTP_GET,
-        .handler = pres_http_handler_wifiman_get_status,
+        .uri       = "/api/wifi/status",
+        .method    = HTTP_GET,
+        .handler   = pres_http_handler_wifiman_get_status,
+        .admission = PRES_HTTP_ADMISSION_CLASS_READ,
     },
     {
-        .uri     = "/api/wifi/scan",
-        .method  = HTTP_POST,
-        .handler = pres_http_handler_wifiman_start_scan,
+        .uri       = "/api/wifi/scan",
+        .method    = HTTP_POST,
+        .handler   = pres_http_handler_wifiman_start_scan,
+        .admission = PRES_HTTP_ADMISSION_CLASS_EXPENSIVE,
     },
     {
-        .uri     = "/api/wifi/scan",
-        .method  = HTTP_GET,
-        .handler = pres_http_handler_wifiman_get_scan_result,
+        .uri       = "/api/wifi/scan",
+        .method    = HTTP_GET,
+        .handler   = pres_http_handler_wifiman_get_scan_result,
+        .admission = PRES_HTTP_ADMISSION_CLASS_READ,
     },
     {
-        .uri     = "/api/wifi/sta",
-        .method  = HTTP_POST,
-        .handler = pres_http_handler_wifiman_connect_sta,
+        .uri       = "/api/wifi/sta",
+        .method    = HTTP_POST,
+        .handler   = pres_http_handler_wifiman_connect_sta,
+        .admission = PRES_HTTP_ADMISSION_CLASS_EXPENSIVE,
     },
     {
-        .uri     = "/api/wifi/sta/stored",
-        .method  = HTTP_POST,
-        .handler = pres_http_handler_wifiman_connect_stored_sta,
+        .uri       = "/api/wifi/sta/stored",
+        .method    = HTTP_POST,
+        .handler   = pres_http_handler_wifiman_connect_stored_sta,
+        .admission = PRES_HTTP_ADMISSION_CLASS_EXPENSIVE,
     },
     {
-        .uri     = "/api/wifi/sta",
-        .method  = HTTP_DELETE,
-        .handler = pres_http_handler_wifiman_disconnect_sta,
+        .uri       = "/api/wifi/sta",
+        .method    = HTTP_DELETE,
+        .handler   = pres_http_handler_wifiman_disconnect_sta,
+        .admission = PRES_HTTP_ADMISSION_CLASS_WRITE,
     },
     {
-        .uri     = "/api/wifi/sta/commit",
-        .method  = HTTP_POST,
-        .handler = pres_http_handler_wifiman_commit_sta_connection,
+        .uri       = "/api/wifi/sta/commit",
+        .method    = HTTP_POST,
+        .handler   = pres_http_handler_wifiman_commit_sta_connection,
+        .admission = PRES_HTTP_ADMISSION_CLASS_WRITE,
     },
     {
-        .uri     = "/api/wifi/sta/credential",
-        .method  = HTTP_GET,
-        .handler = pres_http_handler_wifiman_get_stored_sta,
+        .uri       = "/api/wifi/sta/credential",
+        .method    = HTTP_GET,
+        .handler   = pres_http_handler_wifiman_get_stored_sta,
+        .admission = PRES_HTTP_ADMISSION_CLASS_READ,
     },
     {
-        .uri     = "/api/wifi/sta/credential",
-        .method  = HTTP_POST,
-        .handler = pres_http_handler_wifiman_set_sta_credential,
+        .uri       = "/api/wifi/sta/credential",
+        .method    = HTTP_POST,
+        .handler   = pres_http_handler_wifiman_set_sta_credential,
+        .admission = PRES_HTTP_ADMISSION_CLASS_WRITE,
     },
     {
-        .uri     = "/api/wifi/sta/credential",
-        .method  = HTTP_DELETE,
-        .handler = pres_http_handler_wifiman_forget_sta_credential,
+        .uri       = "/api/wifi/sta/credential",
+        .method    = HTTP_DELETE,
+        .handler   = pres_http_handler_wifiman_forget_sta_credential,
+        .admission = PRES_HTTP_ADMISSION_CLASS_WRITE,
     },
     {
-        .uri     = "/api/wifi/reconnect/need",
-        .method  = HTTP_GET,
-        .handler = pres_http_handler_wifiman_need_reconnect,
+        .uri       = "/api/wifi/sta/profiles",
+        .method    = HTTP_GET,
+        .handler   = pres_http_handler_wifiman_get_sta_profiles,
+        .admission = PRES_HTTP_ADMISSION_CLASS_READ,
     },
     {
-        .uri     = "/api/wifi/reconnect",
-        .method  = HTTP_POST,
-        .handler = pres_http_handler_wifiman_try_reconnect,
+        .uri       = "/api/wifi/sta/profiles",
+        .method    = HTTP_POST,
+        .handler   = pres_http_handler_wifiman_set_sta_profile,
+        .admission = PRES_HTTP_ADMISSION_CLASS_WRITE,
+    },
+    {
+        .uri       = "/api/wifi/sta/profiles",
+        .method    = HTTP_DELETE,
+        .handler   = pres_http_handler_wifiman_delete_sta_profile,
+        .admission = PRES_HTTP_ADMISSION_CLASS_WRITE,
+    },
+    {
+        .uri       = "/api/wifi/reconnect/need",
+        .method    = HTTP_GET,
+        .handler   = pres_http_handler_wifiman_need_reconnect,
+        .admission = PRES_HTTP_ADMISSION_CLASS_READ,
+    },
+    {
+        .uri       = "/api/wifi/reconnect",
+        .method    = HTTP_POST,
+        .handler   = pres_http_handler_wifiman_try_reconnect,
+        .admission = PRES_HTTP_ADMISSION_CLASS_EXPENSIVE,
     },
 };
 
@@ -92,7 +125,7 @@ esp_err_t pres_http_route_wifiman_register(
             .user_ctx = handler,
         };
 
-        esp_err_t err = httpd_register_uri_handler(server, &route);
+        esp_err_t err = pres_http_route_common_register(server, &route, routes[i].admission);
         if (err != ESP_OK) {
             return err;
         }
@@ -109,7 +142,7 @@ esp_err_t pres_http_route_wifiman_unregister(httpd_handle_t server) {
     esp_err_t result = ESP_OK;
 
     for (size_t i = 0; i < pres_http_route_wifiman_route_cnt(); i++) {
-        esp_err_t err = httpd_unregister_uri_handler(server, routes[i].uri, routes[i].method);
+        esp_err_t err = pres_http_route_common_unregister(server, routes[i].uri, routes[i].method);
         if (err != ESP_OK && result == ESP_OK) {
             result = err;
         }
@@ -0,0 +1,320 @@
+#include "presentation/http/router.h"
+
+#include <inttypes.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "domain/models/error.h"
+#include "esp_err.h"
+#include "esp_http_server.h"
+#include "presentation/http/admission.h"
+#include "presentation/http/dto/common.h"
+#include "presentation/http/metrics.h"
+
+#define PRES_HTTP_ROUTER_FNV_OFFSET 2166136261u
+#define PRES_HTTP_ROUTER_FNV_PRIME  16777619u
+
+static const httpd_method_t methods[PRES_HTTP_ROUTER_HANDLER_CNT] = {
+    HTTP_GET,
+    HTTP_POST,
+    HTTP_PUT,
+    HTTP_PATCH,
+    HTTP_DELETE,
+};
+
+/* Helper Function Prototypes */
+
+static esp_err_t dispatch(httpd_req_t* req);
+static esp_err_t admit(
+    pres_http_router_t*         router,
+    httpd_req_t*                req,
+    esp_err_t                   (*handler)(httpd_req_t* req),
+    pres_http_admission_class_t cls
+);
+static esp_err_t send_method_not_allowed(httpd_req_t* req);
+static esp_err_t send_too_many_requests(httpd_req_t* req, uint32_t retry_after_s);
+static size_t path_len(const char* path);
+static uint32_t hash_route(httpd_method_t method, const char* path, size_t len);
+static pres_http_router_slot_t* find_slot(const pres_http_router_t* router, httpd_method_t method, const char* path, size_t len);
+
+/* Public Function Implementations */
+
+pres_http_router_t* pres_http_router_new(
+    pres_http_metrics_t*   metrics,
+    pres_http_admission_t* admission
+) {
+    pres_http_router_t* router = (pres_http_router_t*)calloc(1, sizeof(pres_http_router_t));
+    if (!router) {
+        return NULL;
+    }
+
+    for (size_t i = 0; i < PRES_HTTP_ROUTER_SLOT_CNT; i++) {
+        atomic_init(&router->slots[i].state, PRES_HTTP_ROUTER_SLOT_EMPTY);
+    }
+    router->metrics   = metrics;
+    router->admission = admission;
+
+    return router;
+}
+
+void pres_http_router_delete(pres_http_router_t* router) {
+    free(router);
+}
+
+void pres_http_router_release(void* ctx) {
+    (void)ctx;
+}
+
+pres_http_router_t* pres_http_router_from_server(httpd_handle_t server) {
+    if (!server) {
+        return NULL;
+    }
+
+    return (pres_http_router_t*)httpd_get_global_user_ctx(server);
+}
+
+esp_err_t pres_http_router_register(
+    httpd_handle_t      server,
+    pres_http_router_t* router
+) {
+    if (!server || !router) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    for (size_t i = 0; i < PRES_HTTP_ROUTER_HANDLER_CNT; i++) {
+        httpd_uri_t route = {
+            .uri      = PRES_HTTP_ROUTER_WILDCARD,
+            .method   = methods[i],
+            .handler  = dispatch,
+            .user_ctx = router,
+        };
+
+        esp_err_t err = httpd_register_uri_handler(server, &route);
+        if (err != ESP_OK) {
+            return err;
+        }
+    }
+
+    return ESP_OK;
+}
+
+esp_err_t pres_http_router_unregister(httpd_handle_t server) {
+    if (!server) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_err_t result = ESP_OK;
+
+    for (size_t i = 0; i < PRES_HTTP_ROUTER_HANDLER_CNT; i++) {
+        esp_err_t err = httpd_unregister_uri_handler(server, PRES_HTTP_ROUTER_WILDCARD, methods[i]);
+        if (err != ESP_OK && result == ESP_OK) {
+            result = err;
+        }
+    }
+
+    return result;
+}
+
+esp_err_t pres_http_router_add(
+    pres_http_router_t*         router,
+    const httpd_uri_t*          uri,
+    pres_http_admission_class_t admission
+) {
+    if (!router || !uri || !uri->uri || !uri->handler || admission >= PRES_HTTP_ADMISSION_CLASS_CNT ||
+        strncmp(uri->uri, PRES_HTTP_ROUTER_PREFIX, sizeof(PRES_HTTP_ROUTER_PREFIX) - 1) != 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    size_t len = strlen(uri->uri);
+    if (find_slot(router, uri->method, uri->uri, len)) {
+        return ESP_ERR_HTTPD_HANDLER_EXISTS;
+    }
+    if (router->route_cnt >= PRES_HTTP_ROUTER_ROUTE_MAX) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    pres_http_metrics_route_t* metrics = NULL;
+    if (router->metrics) {
+        metrics = pres_http_metrics_add_route(router->metrics, uri->uri, uri->method);
+        if (!metrics) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+    /* Less than half the slots are ever used, so a free one always turns up */
+    uint32_t hash = hash_route(uri->method, uri->uri, len);
+    size_t   idx  = hash & (PRES_HTTP_ROUTER_SLOT_CNT - 1);
+    while (atomic_load_explicit(&router->slots[idx].state, memory_order_relaxed) == PRES_HTTP_ROUTER_SLOT_USED) {
+        idx = (idx + 1) & (PRES_HTTP_ROUTER_SLOT_CNT - 1);
+    }
+
+    pres_http_router_slot_t* slot = &router->slots[idx];
+    slot->hash                    = hash;
+    slot->method                  = uri->method;
+    slot->uri                     = uri->uri;
+    slot->uri_len                 = len;
+    slot->handler                 = uri->handler;
+    slot->user_ctx                = uri->user_ctx;
+    slot->metrics                 = metrics;
+    slot->admission               = admission;
+    atomic_store_explicit(&slot->state, PRES_HTTP_ROUTER_SLOT_USED, memory_order_release);
+
+    router->route_cnt++;
+
+    return ESP_OK;
+}
+
+esp_err_t pres_http_router_remove(
+    pres_http_router_t* router,
+    const char*         uri,
+    httpd_method_t      method
+) {
+    if (!router || !uri) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    pres_http_router_slot_t* slot = find_slot(router, method, uri, strlen(uri));
+    if (!slot) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    /* Removed rather than empty, so probe chains running through it stay intact */
+    atomic_store_explicit(&slot->state, PRES_HTTP_ROUTER_SLOT_REMOVED, memory_order_release);
+    router->route_cnt--;
+
+    return ESP_OK;
+}
+
+const pres_http_router_slot_t* pres_http_router_find(
+    const pres_http_router_t* router,
+    httpd_method_t            method,
+    const char*               path
+) {
+    if (!router || !path) {
+        return NULL;
+    }
+
+    return find_slot(router, method, path, path_len(path));
+}
+
+/* Helper Function Implementations */
+
+static esp_err_t dispatch(httpd_req_t* req) {
+    pres_http_router_t* router = (pres_http_router_t*)req->user_ctx;
+    if (!router) {
+        return pres_http_dto_common_send_domain_error(req, DOMAIN_MODELS_ERROR_BAD_ARGUMENT);
+    }
+
+    size_t                         len  = path_len(req->uri);
+    const pres_http_router_slot_t* slot = find_slot(router, (httpd_method_t)req->method, req->uri, len);
+    if (!slot) {
+        for (size_t i = 0; i < PRES_HTTP_ROUTER_HANDLER_CNT; i++) {
+            if (methods[i] != (httpd_method_t)req->method && find_slot(router, methods[i], req->uri, len)) {
+                return send_method_not_allowed(req);
+            }
+        }
+
+        return pres_http_dto_common_send_domain_error(req, DOMAIN_MODELS_ERROR_NOT_FOUND);
+    }
+
+    /* Copied out so a route removed meanwhile still finishes this request */
+    esp_err_t (*handler)(httpd_req_t* req) = slot->handler;
+    pres_http_metrics_route_t*  metrics    = slot->metrics;
+    pres_http_admission_class_t admission  = slot->admission;
+    req->user_ctx                          = slot->user_ctx;
+
+    if (!metrics) {
+        return admit(router, req, handler, admission);
+    }
+
+    /* Refused requests are still counted, as 429s */
+    pres_http_metrics_request_t request;
+    pres_http_metrics_begin(router->metrics, metrics, req, &request);
+    esp_err_t err = admit(router, req, handler, admission);
+    pres_http_metrics_end(router->metrics, &request, err);
+
+    return err;
+}
+
+static esp_err_t admit(
+    pres_http_router_t*         router,
+    httpd_req_t*                req,
+    esp_err_t                   (*handler)(httpd_req_t* req),
+    pres_http_admission_class_t cls
+) {
+    uint32_t retry_after_s = 0;
+    if (!pres_http_admission_admit(router->admission, req, cls, &retry_after_s)) {
+        return send_too_many_requests(req, retry_after_s);
+    }
+
+    return handler(req);
+}
+
+static esp_err_t send_method_not_allowed(httpd_req_t* req) {
+    static const char body[] = "{\"error\":\"METHOD_NOT_ALLOWED\"}";
+
+    pres_http_metrics_set_status(req, "405 Method Not Allowed");
+    httpd_resp_set_type(req, "application/json");
+
+    return httpd_resp_send(req, body, HTTPD_RESP_USE_STRLEN);
+}
+
+static esp_err_t send_too_many_requests(httpd_req_t* req, uint32_t retry_after_s) {
+    static const char body[] = "{\"error\":\"TOO_MANY_REQUESTS\"}";
+
+    char retry_after[12];
+    snprintf(retry_after, sizeof(retry_after), "%" PRIu32, retry_after_s);
+
+    pres_http_metrics_set_status(req, "429 Too Many Requests");
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Retry-After", retry_after);
+    pres_http_metrics_count_sent(req, sizeof(body) - 1);
+
+    return httpd_resp_send(req, body, HTTPD_RESP_USE_STRLEN);
+}
+
+static size_t path_len(const char* path) {
+    size_t len = 0;
+    while (path[len] != '\0' && path[len] != '?' && path[len] != '#') {
+        len++;
+    }
+
+    return len;
+}
+
+static uint32_t hash_route(httpd_method_t method, const char* path, size_t len) {
+    uint32_t hash = PRES_HTTP_ROUTER_FNV_OFFSET;
+    for (size_t i = 0; i < len; i++) {
+        hash ^= (uint8_t)path[i];
+        hash *= PRES_HTTP_ROUTER_FNV_PRIME;
+    }
+    hash ^= (uint32_t)method;
+    hash *= PRES_HTTP_ROUTER_FNV_PRIME;
+
+    return hash;
+}
+
+static pres_http_router_slot_t* find_slot(const pres_http_router_t* router, httpd_method_t method, const char* path, size_t len) {
+    uint32_t hash = hash_route(method, path, len);
+    size_t   idx  = hash & (PRES_HTTP_ROUTER_SLOT_CNT - 1);
+
+    for (size_t probe = 0; probe < PRES_HTTP_ROUTER_SLOT_CNT; probe++) {
+        pres_http_router_slot_t* slot  = (pres_http_router_slot_t*)&router->slots[idx];
+        uint8_t                  state = atomic_load_explicit(&slot->state, memory_order_acquire);
+        if (state == PRES_HTTP_ROUTER_SLOT_EMPTY) {
+            return NULL;
+        }
+        if (state == PRES_HTTP_ROUTER_SLOT_USED && slot->hash == hash && slot->method == method &&
+            slot->uri_len == len && memcmp(slot->uri, path, len) == 0) {
+            return slot;
+        }
+        idx = (idx + 1) & (PRES_HTTP_ROUTER_SLOT_CNT - 1);
+    }
+
+    return NULL;
+}
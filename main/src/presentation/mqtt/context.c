@@ -1,12 +1,25 @@
 #include "presentation/mqtt/context.h"
 
+#include <stdio.h>
 #include <stdlib.h>
 
+#include "presentation/mqtt/route/netif.h"
+#include "presentation/mqtt/route/settings.h"
+#include "presentation/mqtt/route/system.h"
+#include "presentation/mqtt/route/wifiman.h"
+#include "presentation/mqtt/router.h"
+
+/* Helper Function Prototypes */
+
+static dom_models_error_t register_routes(pres_mqtt_context_t* self);
+
 pres_mqtt_context_t* pres_mqtt_context_new(
     dom_contracts_logger_leveled_t*       logger,
     dom_contracts_repository_preloaded_t* preloaded_repository,
     dom_usecases_settings_t*              settings,
-    dom_usecases_ota_t*                   ota
+    dom_usecases_ota_t*                   ota,
+    dom_usecases_wifiman_t*               wifiman,
+    dom_usecases_netif_t*                 netif
 ) {
     if (!logger || !preloaded_repository || !settings || !ota) {
         return NULL;
@@ -21,6 +34,8 @@ pres_mqtt_context_t* pres_mqtt_context_new(
     self->preloaded_repository = preloaded_repository;
     self->settings             = settings;
     self->ota                  = ota;
+    self->wifiman              = wifiman;
+    self->netif                = netif;
 
     dom_models_error_t err = preloaded_repository->get_device_id_str(
         preloaded_repository,
@@ -32,6 +47,19 @@ pres_mqtt_context_t* pres_mqtt_context_new(
         return NULL;
     }
 
+    int written = snprintf(self->reply_prefix.str, sizeof(self->reply_prefix.str), "/pub/%s/", self->device_id_str);
+    if (written <= 0 || (size_t)written >= sizeof(self->reply_prefix.str)) {
+        free(self);
+        return NULL;
+    }
+    self->reply_prefix.len = (uint16_t)written;
+
+    err = register_routes(self);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        free(self);
+        return NULL;
+    }
+
     return self;
 }
 
@@ -41,3 +69,38 @@ void pres_mqtt_context_delete(pres_mqtt_context_t* self) {
     }
     free(self);
 }
+
+/* Helper Function Implementations */
+
+static dom_models_error_t register_routes(pres_mqtt_context_t* self) {
+    dom_models_error_t err = pres_mqtt_router_init(&self->router, self->device_id_str);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
+    err = pres_mqtt_route_system_register(&self->router);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
+    err = pres_mqtt_route_settings_register(&self->router);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
+    if (self->wifiman) {
+        err = pres_mqtt_route_wifiman_register(&self->router);
+        if (err != DOMAIN_MODELS_ERROR_OK) {
+            return err;
+        }
+    }
+
+    if (self->netif) {
+        err = pres_mqtt_route_netif_register(&self->router);
+        if (err != DOMAIN_MODELS_ERROR_OK) {
+            return err;
+        }
+    }
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
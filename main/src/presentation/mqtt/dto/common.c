@@ -0,0 +1,101 @@
+#include "presentation/mqtt/dto/common.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "mqtt_client.h"
+#include "utils/json/reader.h"
+#include "utils/json/writer.h"
+#include "utils/mqtt/topic_table.h"
+
+/* Helper Function Prototypes */
+
+static dom_models_error_t publish(
+    pres_mqtt_context_t*       ctx,
+    const pres_mqtt_message_t* msg,
+    const char*                body
+);
+
+dom_models_error_t pres_mqtt_dto_common_recv_json(
+    const pres_mqtt_message_t* msg,
+    utils_json_reader_t*       out
+) {
+    if (!msg || !out) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    utils_json_reader_reset(out);
+    if (!msg->data || msg->data_len == 0) {
+        return DOMAIN_MODELS_ERROR_OK;
+    }
+
+    if (!utils_json_reader_parse(out, msg->data, msg->data_len)) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+utils_json_writer_t* pres_mqtt_dto_common_reply_begin(pres_mqtt_context_t* ctx) {
+    if (!ctx) {
+        return NULL;
+    }
+
+    utils_json_writer_init(&ctx->reply_writer, ctx->reply_buf, sizeof(ctx->reply_buf));
+
+    return &ctx->reply_writer;
+}
+
+dom_models_error_t pres_mqtt_dto_common_reply_end(
+    pres_mqtt_context_t*       ctx,
+    const pres_mqtt_message_t* msg
+) {
+    if (!ctx) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    if (utils_json_writer_finish(&ctx->reply_writer) == 0) {
+        return pres_mqtt_dto_common_send_domain_error(ctx, msg, DOMAIN_MODELS_ERROR_FAILURE);
+    }
+
+    return publish(ctx, msg, ctx->reply_buf);
+}
+
+dom_models_error_t pres_mqtt_dto_common_send_domain_error(
+    pres_mqtt_context_t*       ctx,
+    const pres_mqtt_message_t* msg,
+    dom_models_error_t         err
+) {
+    char body[64];
+    snprintf(body, sizeof(body), "{\"error\":\"%s\"}", dom_models_error_str(err));
+
+    return publish(ctx, msg, body);
+}
+
+/* Helper Function Implementations */
+
+static dom_models_error_t publish(
+    pres_mqtt_context_t*       ctx,
+    const pres_mqtt_message_t* msg,
+    const char*                body
+) {
+    if (!ctx || !msg || !msg->client || !body) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    utils_mqtt_topic_t topic;
+    if (ctx->reply_prefix.len + msg->suffix_len >= sizeof(topic.str)) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    memcpy(topic.str, ctx->reply_prefix.str, ctx->reply_prefix.len);
+    memcpy(topic.str + ctx->reply_prefix.len, msg->suffix, msg->suffix_len);
+    topic.str[ctx->reply_prefix.len + msg->suffix_len] = '\0';
+
+    int msg_id = esp_mqtt_client_publish(msg->client, topic.str, body, 0, 0, 0);
+    if (msg_id < 0) {
+        return DOMAIN_MODELS_ERROR_FAILURE;
+    }
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
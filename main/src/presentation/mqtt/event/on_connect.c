@@ -1,21 +1,17 @@
 #include "presentation/mqtt/event/on_connect.h"
-#include <stdio.h>
 #include "mqtt_client.h"
+#include "presentation/mqtt/router.h"
 
 #define TAG "pres_mqtt_on_connect"
 
 void pres_mqtt_event_on_connect(pres_mqtt_context_t* ctx, esp_mqtt_event_handle_t event) {
-    ctx->logger->info(ctx->logger, TAG, "Connected to MQTT broker");
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->logger, TAG, "Connected to MQTT broker");
 
-    char topic[128];
+    int msg_id = pres_mqtt_router_subscribe(&ctx->router, event->client);
+    if (msg_id < 0) {
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->logger, TAG, "Failed to subscribe %u routes", (unsigned)ctx->router.route_cnt);
+        return;
+    }
 
-    // Reset Subscription
-    snprintf(topic, sizeof(topic), "/sub/%s/reset", ctx->device_id_str);
-    int msg_id = esp_mqtt_client_subscribe(event->client, topic, 1);
-    ctx->logger->info(ctx->logger, TAG, "Subscribed to reset: %s (msg_id=%d)", topic, msg_id);
-
-    // OTA Subscription
-    snprintf(topic, sizeof(topic), "/sub/%s/ota", ctx->device_id_str);
-    msg_id = esp_mqtt_client_subscribe(event->client, topic, 1);
-    ctx->logger->info(ctx->logger, TAG, "Subscribed to ota: %s (msg_id=%d)", topic, msg_id);
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->logger, TAG, "Subscribed to %u routes (msg_id=%d)", (unsigned)ctx->router.route_cnt, msg_id);
 }
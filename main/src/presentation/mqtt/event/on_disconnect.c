@@ -1,7 +1,11 @@
 #include "presentation/mqtt/event/on_disconnect.h"
+#include "presentation/mqtt/reassembly.h"
 
 #define TAG "pres_mqtt_on_disconnect"
 
 void pres_mqtt_event_on_disconnect(pres_mqtt_context_t* ctx, esp_mqtt_event_handle_t event) {
-    ctx->logger->warn(ctx->logger, TAG, "Disconnected from MQTT broker");
+    DOM_CONTRACTS_LOGGER_LEVELED_WARN(ctx->logger, TAG, "Disconnected from MQTT broker");
+
+    /* The broker resends unacknowledged publishes from the first fragment */
+    pres_mqtt_reassembly_reset(&ctx->reassembly);
 }
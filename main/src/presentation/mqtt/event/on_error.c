@@ -3,5 +3,5 @@
 #define TAG "pres_mqtt_on_error"
 
 void pres_mqtt_event_on_error(pres_mqtt_context_t* ctx, esp_mqtt_event_handle_t event) {
-    ctx->logger->error(ctx->logger, TAG, "MQTT error event type: %d", event->error_handle->error_type);
+    DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->logger, TAG, "MQTT error event type: %d", event->error_handle->error_type);
 }
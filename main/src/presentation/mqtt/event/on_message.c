@@ -1,34 +1,103 @@
 #include "presentation/mqtt/event/on_message.h"
-#include <stdio.h>
-#include <string.h>
-#include "presentation/mqtt/handler/reset.h"
-#include "presentation/mqtt/handler/ota.h"
+#include "esp_timer.h"
+#include "presentation/mqtt/reassembly.h"
+#include "presentation/mqtt/router.h"
 
 #define TAG "pres_mqtt_on_message"
 
+/* Helper Function Prototypes */
+
+static void dispatch(
+    pres_mqtt_context_t*            ctx,
+    esp_mqtt_event_handle_t         event,
+    const pres_mqtt_router_route_t* route,
+    const char*                     suffix,
+    size_t                          suffix_len,
+    const char*                     data,
+    size_t                          data_len
+);
+
 void pres_mqtt_event_on_message(pres_mqtt_context_t* ctx, esp_mqtt_event_handle_t event) {
-    if (event->topic_len <= 0 || event->data_len < 0) {
+    if (event->data_len < 0 || event->current_data_offset < 0 || event->total_data_len < event->data_len) {
+        return;
+    }
+
+    pres_mqtt_reassembly_chunk_t chunk = {
+        .msg_id      = event->msg_id,
+        .data        = event->data,
+        .data_len    = (size_t)event->data_len,
+        .offset      = (size_t)event->current_data_offset,
+        .total_len   = (size_t)event->total_data_len,
+        .received_ms = esp_timer_get_time() / 1000,
+    };
+
+    /* Only the first fragment carries the topic */
+    if (chunk.offset > 0) {
+        pres_mqtt_reassembly_slot_t* slot = NULL;
+        dom_models_error_t           err  = pres_mqtt_reassembly_append(&ctx->reassembly, &chunk, &slot);
+        if (err == DOMAIN_MODELS_ERROR_BAD_STATE) {
+            DOM_CONTRACTS_LOGGER_LEVELED_WARN(ctx->logger, TAG, "Dropped out-of-order fragment (msg_id=%d)", chunk.msg_id);
+        }
+        if (!slot) {
+            return;
+        }
+
+        dispatch(ctx, event, slot->route, slot->suffix.str, slot->suffix.len, slot->buf, slot->total_len);
+        pres_mqtt_reassembly_release(slot);
+        return;
+    }
+
+    if (event->topic_len <= 0) {
+        return;
+    }
+
+    const pres_mqtt_router_route_t* route = pres_mqtt_router_match(&ctx->router, event->topic, (size_t)event->topic_len);
+    if (!route) {
         return;
     }
 
-    char topic[128];
-    if (event->topic_len >= sizeof(topic)) {
-        ctx->logger->error(ctx->logger, TAG, "Topic too long");
+    const char* suffix     = event->topic + ctx->router.prefix.len;
+    size_t      suffix_len = (size_t)event->topic_len - ctx->router.prefix.len;
+
+    if (chunk.total_len > route->max_len) {
+        DOM_CONTRACTS_LOGGER_LEVELED_WARN(ctx->logger, TAG, "Dropped %u byte payload on %s", (unsigned)chunk.total_len, route->filter.str);
         return;
     }
-    memcpy(topic, event->topic, event->topic_len);
-    topic[event->topic_len] = '\0';
 
-    char reset_expected[64];
-    char ota_expected[64];
-    snprintf(reset_expected, sizeof(reset_expected), "/sub/%s/reset", ctx->device_id_str);
-    snprintf(ota_expected, sizeof(ota_expected), "/sub/%s/ota", ctx->device_id_str);
+    if (chunk.data_len == chunk.total_len) {
+        dispatch(ctx, event, route, suffix, suffix_len, chunk.data, chunk.data_len);
+        return;
+    }
 
-    if (strcmp(topic, reset_expected) == 0) {
-        pres_mqtt_handler_reset(ctx, event->data, event->data_len);
-    } else if (strcmp(topic, ota_expected) == 0) {
-        pres_mqtt_handler_ota(ctx, event->data, event->data_len);
-    } else {
-        ctx->logger->debug(ctx->logger, TAG, "Unhandled topic: %s", topic);
+    bool               evicted = false;
+    dom_models_error_t err     = pres_mqtt_reassembly_begin(&ctx->reassembly, &chunk, route, suffix, suffix_len, &evicted);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        DOM_CONTRACTS_LOGGER_LEVELED_WARN(ctx->logger, TAG, "Cannot reassemble %u bytes on %s: %s", (unsigned)chunk.total_len, route->filter.str, dom_models_error_str(err));
+        return;
     }
+    if (evicted) {
+        DOM_CONTRACTS_LOGGER_LEVELED_WARN(ctx->logger, TAG, "Evicted a stalled partial payload for msg_id=%d", chunk.msg_id);
+    }
+}
+
+/* Helper Function Implementations */
+
+static void dispatch(
+    pres_mqtt_context_t*            ctx,
+    esp_mqtt_event_handle_t         event,
+    const pres_mqtt_router_route_t* route,
+    const char*                     suffix,
+    size_t                          suffix_len,
+    const char*                     data,
+    size_t                          data_len
+) {
+    pres_mqtt_message_t msg = {
+        .client     = event->client,
+        .suffix     = suffix,
+        .suffix_len = suffix_len,
+        .data       = data,
+        .data_len   = data_len,
+    };
+
+    route->handler(ctx, &msg);
 }
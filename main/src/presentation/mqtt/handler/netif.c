@@ -0,0 +1,68 @@
+#include "presentation/mqtt/handler/netif.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "domain/models/error.h"
+#include "domain/models/network.h"
+#include "domain/usecases/netif.h"
+#include "presentation/http/dto/netif.h"
+#include "presentation/mqtt/dto/common.h"
+
+/* Helper Function Prototypes */
+
+static bool last_level_is(const pres_mqtt_message_t* msg, const char* name);
+
+/* Handler Implementations */
+
+void pres_mqtt_handler_netif_get_all(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg) {
+    if (!ctx->netif->get_all) {
+        pres_mqtt_dto_common_send_domain_error(ctx, msg, DOMAIN_MODELS_ERROR_BAD_ARGUMENT);
+        return;
+    }
+
+    dom_models_network_t network;
+    dom_models_error_t   err = ctx->netif->get_all(ctx->netif, &network);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        pres_mqtt_dto_common_send_domain_error(ctx, msg, err);
+        return;
+    }
+
+    pres_http_dto_netif_write_network(pres_mqtt_dto_common_reply_begin(ctx), &network);
+    pres_mqtt_dto_common_reply_end(ctx, msg);
+}
+
+void pres_mqtt_handler_netif_get_interface(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg) {
+    dom_models_error_t (*get)(dom_usecases_netif_t* self, dom_models_network_interface_t* out) = NULL;
+    if (last_level_is(msg, "wifi_sta")) {
+        get = ctx->netif->get_wifi_sta;
+    } else if (last_level_is(msg, "ethernet")) {
+        get = ctx->netif->get_ethernet;
+    } else {
+        pres_mqtt_dto_common_send_domain_error(ctx, msg, DOMAIN_MODELS_ERROR_NOT_FOUND);
+        return;
+    }
+    if (!get) {
+        pres_mqtt_dto_common_send_domain_error(ctx, msg, DOMAIN_MODELS_ERROR_BAD_ARGUMENT);
+        return;
+    }
+
+    dom_models_network_interface_t interface;
+    dom_models_error_t             err = get(ctx->netif, &interface);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        pres_mqtt_dto_common_send_domain_error(ctx, msg, err);
+        return;
+    }
+
+    pres_http_dto_netif_write_interface(pres_mqtt_dto_common_reply_begin(ctx), &interface);
+    pres_mqtt_dto_common_reply_end(ctx, msg);
+}
+
+/* Helper Function Implementations */
+
+static bool last_level_is(const pres_mqtt_message_t* msg, const char* name) {
+    size_t name_len = strlen(name);
+    return msg->suffix_len > name_len &&
+           msg->suffix[msg->suffix_len - name_len - 1] == '/' &&
+           memcmp(msg->suffix + msg->suffix_len - name_len, name, name_len) == 0;
+}
@@ -21,17 +21,17 @@ static void ota_update_task(void* pvParameters);
 
 /* Handler Implementation */
 
-void pres_mqtt_handler_ota(pres_mqtt_context_t* ctx, const char* data, int data_len) {
-    ctx->logger->info(ctx->logger, TAG, "Received OTA update trigger via MQTT");
+void pres_mqtt_handler_ota(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg) {
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->logger, TAG, "Received OTA update trigger via MQTT");
 
-    if (!data || data_len <= 0) {
-        ctx->logger->error(ctx->logger, TAG, "Empty payload received");
+    if (!msg->data || msg->data_len == 0) {
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->logger, TAG, "Empty payload received");
         return;
     }
 
-    cJSON* json = cJSON_ParseWithLength(data, data_len);
+    cJSON* json = cJSON_ParseWithLength(msg->data, msg->data_len);
     if (!json) {
-        ctx->logger->error(ctx->logger, TAG, "Failed to parse JSON payload");
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->logger, TAG, "Failed to parse JSON payload");
         return;
     }
 
@@ -40,14 +40,14 @@ void pres_mqtt_handler_ota(pres_mqtt_context_t* ctx, const char* data, int data_
     cJSON* checksum_item = cJSON_GetObjectItemCaseSensitive(json, "checksum");
 
     if (!cJSON_IsString(url_item) || !cJSON_IsNumber(size_item) || !cJSON_IsString(checksum_item)) {
-        ctx->logger->error(ctx->logger, TAG, "Invalid OTA payload fields");
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->logger, TAG, "Invalid OTA payload fields");
         cJSON_Delete(json);
         return;
     }
 
     ota_task_args_t* task_args = (ota_task_args_t*)calloc(1, sizeof(ota_task_args_t));
     if (!task_args) {
-        ctx->logger->error(ctx->logger, TAG, "Failed to allocate memory for task args");
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->logger, TAG, "Failed to allocate memory for task args");
         cJSON_Delete(json);
         return;
     }
@@ -59,7 +59,7 @@ void pres_mqtt_handler_ota(pres_mqtt_context_t* ctx, const char* data, int data_
 
     cJSON_Delete(json);
 
-    ctx->logger->info(ctx->logger, TAG, "Spawning background OTA task for URL: %s", task_args->update_info.firmware_url);
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->logger, TAG, "Spawning background OTA task for URL: %s", task_args->update_info.firmware_url);
 
     // Spawn a FreeRTOS task to run the update asynchronously to avoid blocking the MQTT client event loop thread.
     BaseType_t ret = xTaskCreate(
@@ -72,7 +72,7 @@ void pres_mqtt_handler_ota(pres_mqtt_context_t* ctx, const char* data, int data_
     );
 
     if (ret != pdPASS) {
-        ctx->logger->error(ctx->logger, TAG, "Failed to create background OTA task");
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->logger, TAG, "Failed to create background OTA task");
         free(task_args);
     }
 }
@@ -83,13 +83,13 @@ static void ota_update_task(void* pvParameters) {
     ota_task_args_t*     args = (ota_task_args_t*)pvParameters;
     pres_mqtt_context_t* ctx  = args->ctx;
 
-    ctx->logger->info(ctx->logger, TAG, "OTA background task started");
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->logger, TAG, "OTA background task started");
 
     dom_models_error_t err = ctx->ota->update(ctx->ota, &args->update_info);
     if (err != DOMAIN_MODELS_ERROR_OK) {
-        ctx->logger->error(ctx->logger, TAG, "OTA update failed in background: %s (%d)", dom_models_error_str(err), (int)err);
+        DOM_CONTRACTS_LOGGER_LEVELED_ERROR(ctx->logger, TAG, "OTA update failed in background: %s (%d)", dom_models_error_str(err), (int)err);
     } else {
-        ctx->logger->info(ctx->logger, TAG, "OTA update succeeded, system will reboot");
+        DOM_CONTRACTS_LOGGER_LEVELED_INFO(ctx->logger, TAG, "OTA update succeeded, system will reboot");
     }
 
     free(args);
@@ -0,0 +1,71 @@
+#include "presentation/mqtt/handler/settings.h"
+
+#include <stdbool.h>
+
+#include "domain/models/error.h"
+#include "domain/usecases/settings.h"
+#include "presentation/http/dto/settings.h"
+#include "presentation/http/etag.h"
+#include "presentation/mqtt/dto/common.h"
+#include "utils/json/reader.h"
+
+/* Handler Implementations */
+
+void pres_mqtt_handler_settings_get_snapshot(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg) {
+    dom_usecases_settings_snapshot_t snapshot;
+    dom_models_error_t               err = ctx->settings->get_snapshot(ctx->settings, &snapshot);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        pres_mqtt_dto_common_send_domain_error(ctx, msg, err);
+        return;
+    }
+
+    pres_http_dto_settings_write_snapshot(pres_mqtt_dto_common_reply_begin(ctx), &snapshot);
+    pres_mqtt_dto_common_reply_end(ctx, msg);
+}
+
+void pres_mqtt_handler_settings_set_preloaded(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg) {
+    utils_json_reader_t json;
+    dom_models_error_t  err = pres_mqtt_dto_common_recv_json(msg, &json);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        pres_mqtt_dto_common_send_domain_error(ctx, msg, err);
+        return;
+    }
+
+    dom_usecases_settings_preloaded_update_t update;
+    err = pres_http_dto_settings_parse_preloaded_update(&json, &update);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        pres_mqtt_dto_common_send_domain_error(ctx, msg, err);
+        return;
+    }
+
+    bool restart_required = false;
+    err = ctx->settings->set_preloaded(ctx->settings, &update, &restart_required);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        pres_mqtt_dto_common_send_domain_error(ctx, msg, err);
+        return;
+    }
+
+    pres_http_etag_bump(ctx->settings_etag);
+
+    pres_http_dto_settings_write_preloaded_updated(pres_mqtt_dto_common_reply_begin(ctx), restart_required);
+    pres_mqtt_dto_common_reply_end(ctx, msg);
+}
+
+void pres_mqtt_handler_settings_get_restart_required(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg) {
+    bool               restart_required = false;
+    dom_models_error_t err              = ctx->settings->get_restart_required(ctx->settings, &restart_required);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        pres_mqtt_dto_common_send_domain_error(ctx, msg, err);
+        return;
+    }
+
+    pres_http_dto_settings_write_restart_required(pres_mqtt_dto_common_reply_begin(ctx), restart_required);
+    pres_mqtt_dto_common_reply_end(ctx, msg);
+}
+
+void pres_mqtt_handler_settings_restart(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg) {
+    pres_http_dto_settings_write_accepted(pres_mqtt_dto_common_reply_begin(ctx));
+    pres_mqtt_dto_common_reply_end(ctx, msg);
+
+    (void)ctx->settings->restart(ctx->settings, 0);
+}
@@ -0,0 +1,289 @@
+#include "presentation/mqtt/handler/wifiman.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "domain/models/error.h"
+#include "domain/models/wifi.h"
+#include "domain/usecases/wifiman.h"
+#include "presentation/http/dto/wifiman.h"
+#include "presentation/http/etag.h"
+#include "presentation/mqtt/dto/common.h"
+#include "utils/json/reader.h"
+
+/* Helper Function Prototypes */
+
+static dom_models_error_t recv_sta_credential(
+    const pres_mqtt_message_t*        msg,
+    dom_models_wifi_sta_credential_t* out
+);
+
+/* Handler Implementations */
+
+void pres_mqtt_handler_wifiman_get_status(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg) {
+    dom_usecases_wifiman_status_t status;
+    dom_models_error_t            err = ctx->wifiman->get_status(ctx->wifiman, &status);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        pres_mqtt_dto_common_send_domain_error(ctx, msg, err);
+        return;
+    }
+
+    pres_http_dto_wifiman_write_status(pres_mqtt_dto_common_reply_begin(ctx), &status);
+    pres_mqtt_dto_common_reply_end(ctx, msg);
+}
+
+void pres_mqtt_handler_wifiman_start_scan(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg) {
+    utils_json_reader_t json;
+    dom_models_error_t  err = pres_mqtt_dto_common_recv_json(msg, &json);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        pres_mqtt_dto_common_send_domain_error(ctx, msg, err);
+        return;
+    }
+
+    dom_models_wifi_scan_config_t config;
+    err = pres_http_dto_wifiman_parse_scan_config(&json, &config);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        pres_mqtt_dto_common_send_domain_error(ctx, msg, err);
+        return;
+    }
+
+    err = ctx->wifiman->start_scan(ctx->wifiman, &config);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        pres_mqtt_dto_common_send_domain_error(ctx, msg, err);
+        return;
+    }
+
+    pres_http_dto_wifiman_write_accepted(pres_mqtt_dto_common_reply_begin(ctx));
+    pres_mqtt_dto_common_reply_end(ctx, msg);
+}
+
+void pres_mqtt_handler_wifiman_get_scan_result(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg) {
+    utils_json_reader_t json;
+    dom_models_error_t  err = pres_mqtt_dto_common_recv_json(msg, &json);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        pres_mqtt_dto_common_send_domain_error(ctx, msg, err);
+        return;
+    }
+
+    dom_usecases_wifiman_scan_query_t query;
+    err = pres_http_dto_wifiman_parse_scan_query(&json, &query);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        pres_mqtt_dto_common_send_domain_error(ctx, msg, err);
+        return;
+    }
+    if (query.limit == 0 || query.limit > PRES_MQTT_CONTEXT_SCAN_PAGE_LEN) {
+        query.limit = PRES_MQTT_CONTEXT_SCAN_PAGE_LEN;
+    }
+
+    err = ctx->wifiman->get_scan_result(ctx->wifiman, &query, &ctx->scan_result);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        pres_mqtt_dto_common_send_domain_error(ctx, msg, err);
+        return;
+    }
+
+    pres_http_dto_wifiman_write_scan_result(pres_mqtt_dto_common_reply_begin(ctx), &ctx->scan_result);
+    pres_mqtt_dto_common_reply_end(ctx, msg);
+}
+
+void pres_mqtt_handler_wifiman_connect_sta(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg) {
+    dom_models_wifi_sta_credential_t credential;
+    dom_models_error_t               err = recv_sta_credential(msg, &credential);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        pres_mqtt_dto_common_send_domain_error(ctx, msg, err);
+        return;
+    }
+
+    err = ctx->wifiman->set_sta_credential(ctx->wifiman, &credential);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        pres_mqtt_dto_common_send_domain_error(ctx, msg, err);
+        return;
+    }
+
+    pres_http_etag_bump(ctx->network_etag);
+
+    pres_http_dto_wifiman_write_accepted(pres_mqtt_dto_common_reply_begin(ctx));
+    pres_mqtt_dto_common_reply_end(ctx, msg);
+
+    (void)ctx->wifiman->connect_stored_sta(ctx->wifiman);
+}
+
+void pres_mqtt_handler_wifiman_connect_stored_sta(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg) {
+    dom_usecases_wifiman_stored_sta_t stored_sta;
+    dom_models_error_t                err = ctx->wifiman->get_stored_sta(ctx->wifiman, &stored_sta);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        pres_mqtt_dto_common_send_domain_error(ctx, msg, err);
+        return;
+    }
+    if (!stored_sta.available) {
+        pres_mqtt_dto_common_send_domain_error(ctx, msg, DOMAIN_MODELS_ERROR_NOT_FOUND);
+        return;
+    }
+
+    pres_http_dto_wifiman_write_accepted(pres_mqtt_dto_common_reply_begin(ctx));
+    pres_mqtt_dto_common_reply_end(ctx, msg);
+
+    (void)ctx->wifiman->connect_stored_sta(ctx->wifiman);
+}
+
+void pres_mqtt_handler_wifiman_disconnect_sta(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg) {
+    pres_http_dto_wifiman_write_accepted(pres_mqtt_dto_common_reply_begin(ctx));
+    pres_mqtt_dto_common_reply_end(ctx, msg);
+
+    (void)ctx->wifiman->disconnect_sta(ctx->wifiman);
+    pres_http_etag_bump(ctx->network_etag);
+}
+
+void pres_mqtt_handler_wifiman_commit_sta_connection(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg) {
+    dom_usecases_wifiman_status_t status;
+    dom_models_error_t            err = ctx->wifiman->get_status(ctx->wifiman, &status);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        pres_mqtt_dto_common_send_domain_error(ctx, msg, err);
+        return;
+    }
+    if (!status.wifi.connected) {
+        pres_mqtt_dto_common_send_domain_error(ctx, msg, DOMAIN_MODELS_ERROR_BAD_STATE);
+        return;
+    }
+
+    pres_http_dto_wifiman_write_accepted(pres_mqtt_dto_common_reply_begin(ctx));
+    pres_mqtt_dto_common_reply_end(ctx, msg);
+
+    (void)ctx->wifiman->commit_sta_connection(ctx->wifiman);
+    pres_http_etag_bump(ctx->network_etag);
+}
+
+void pres_mqtt_handler_wifiman_get_stored_sta(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg) {
+    dom_usecases_wifiman_stored_sta_t stored_sta;
+    dom_models_error_t                err = ctx->wifiman->get_stored_sta(ctx->wifiman, &stored_sta);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        pres_mqtt_dto_common_send_domain_error(ctx, msg, err);
+        return;
+    }
+
+    pres_http_dto_wifiman_write_stored_sta(pres_mqtt_dto_common_reply_begin(ctx), &stored_sta);
+    pres_mqtt_dto_common_reply_end(ctx, msg);
+}
+
+void pres_mqtt_handler_wifiman_set_sta_credential(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg) {
+    dom_models_wifi_sta_credential_t credential;
+    dom_models_error_t               err = recv_sta_credential(msg, &credential);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        pres_mqtt_dto_common_send_domain_error(ctx, msg, err);
+        return;
+    }
+
+    err = ctx->wifiman->set_sta_credential(ctx->wifiman, &credential);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        pres_mqtt_dto_common_send_domain_error(ctx, msg, err);
+        return;
+    }
+
+    pres_http_etag_bump(ctx->network_etag);
+
+    pres_mqtt_handler_wifiman_get_stored_sta(ctx, msg);
+}
+
+void pres_mqtt_handler_wifiman_forget_sta_credential(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg) {
+    dom_models_error_t err = ctx->wifiman->forget_sta_credential(ctx->wifiman);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        pres_mqtt_dto_common_send_domain_error(ctx, msg, err);
+        return;
+    }
+
+    pres_http_etag_bump(ctx->network_etag);
+
+    pres_http_dto_wifiman_write_forgotten(pres_mqtt_dto_common_reply_begin(ctx));
+    pres_mqtt_dto_common_reply_end(ctx, msg);
+}
+
+void pres_mqtt_handler_wifiman_get_sta_profiles(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg) {
+    dom_usecases_wifiman_sta_profiles_t profiles;
+    dom_models_error_t                  err = ctx->wifiman->get_sta_profiles(ctx->wifiman, &profiles);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        pres_mqtt_dto_common_send_domain_error(ctx, msg, err);
+        return;
+    }
+
+    pres_http_dto_wifiman_write_sta_profiles(pres_mqtt_dto_common_reply_begin(ctx), &profiles);
+    pres_mqtt_dto_common_reply_end(ctx, msg);
+}
+
+void pres_mqtt_handler_wifiman_set_sta_profile(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg) {
+    utils_json_reader_t json;
+    dom_models_error_t  err = pres_mqtt_dto_common_recv_json(msg, &json);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        pres_mqtt_dto_common_send_domain_error(ctx, msg, err);
+        return;
+    }
+
+    dom_models_wifi_sta_credential_t credential;
+    uint8_t                          priority = 0;
+    err = pres_http_dto_wifiman_parse_sta_profile(&json, &credential, &priority);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        pres_mqtt_dto_common_send_domain_error(ctx, msg, err);
+        return;
+    }
+
+    err = ctx->wifiman->set_sta_profile(ctx->wifiman, &credential, priority);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        pres_mqtt_dto_common_send_domain_error(ctx, msg, err);
+        return;
+    }
+
+    pres_http_etag_bump(ctx->network_etag);
+
+    pres_mqtt_handler_wifiman_get_sta_profiles(ctx, msg);
+}
+
+void pres_mqtt_handler_wifiman_delete_sta_profile(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg) {
+    utils_json_reader_t json;
+    dom_models_error_t  err = pres_mqtt_dto_common_recv_json(msg, &json);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        pres_mqtt_dto_common_send_domain_error(ctx, msg, err);
+        return;
+    }
+
+    char ssid[DOM_MODELS_WIFI_SSID_BUF_LEN];
+    err = pres_http_dto_wifiman_parse_sta_profile_ssid(&json, ssid, sizeof(ssid));
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        pres_mqtt_dto_common_send_domain_error(ctx, msg, err);
+        return;
+    }
+
+    err = ctx->wifiman->delete_sta_profile(ctx->wifiman, ssid);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        pres_mqtt_dto_common_send_domain_error(ctx, msg, err);
+        return;
+    }
+
+    pres_http_etag_bump(ctx->network_etag);
+
+    pres_http_dto_wifiman_write_deleted(pres_mqtt_dto_common_reply_begin(ctx));
+    pres_mqtt_dto_common_reply_end(ctx, msg);
+}
+
+void pres_mqtt_handler_wifiman_try_reconnect(pres_mqtt_context_t* ctx, const pres_mqtt_message_t* msg) {
+    pres_http_dto_wifiman_write_accepted(pres_mqtt_dto_common_reply_begin(ctx));
+    pres_mqtt_dto_common_reply_end(ctx, msg);
+
+    bool attempted = false;
+    (void)ctx->wifiman->try_reconnect(ctx->wifiman, &attempted);
+    pres_http_etag_bump(ctx->network_etag);
+}
+
+/* Helper Function Implementations */
+
+static dom_models_error_t recv_sta_credential(
+    const pres_mqtt_message_t*        msg,
+    dom_models_wifi_sta_credential_t* out
+) {
+    utils_json_reader_t json;
+    dom_models_error_t  err = pres_mqtt_dto_common_recv_json(msg, &json);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return err;
+    }
+
+    err = pres_http_dto_wifiman_parse_sta_credential(&json, out);
+
+    return err;
+}
@@ -0,0 +1,145 @@
+#include "presentation/mqtt/reassembly.h"
+
+#include <string.h>
+
+#include "domain/models/error.h"
+
+/* Helper Function Prototypes */
+
+static pres_mqtt_reassembly_slot_t* slot_find(pres_mqtt_reassembly_t* reassembly, int msg_id);
+static pres_mqtt_reassembly_slot_t* slot_free(pres_mqtt_reassembly_t* reassembly);
+static pres_mqtt_reassembly_slot_t* slot_oldest(pres_mqtt_reassembly_t* reassembly);
+
+void pres_mqtt_reassembly_reset(pres_mqtt_reassembly_t* reassembly) {
+    if (!reassembly) {
+        return;
+    }
+
+    for (size_t i = 0; i < PRES_MQTT_REASSEMBLY_SLOT_CNT; i++) {
+        pres_mqtt_reassembly_release(&reassembly->slots[i]);
+    }
+}
+
+dom_models_error_t pres_mqtt_reassembly_begin(
+    pres_mqtt_reassembly_t*             reassembly,
+    const pres_mqtt_reassembly_chunk_t* chunk,
+    const pres_mqtt_router_route_t*     route,
+    const char*                         suffix,
+    size_t                              suffix_len,
+    bool*                               evicted
+) {
+    if (!reassembly || !chunk || !route || !suffix || !evicted || chunk->offset != 0 || (!chunk->data && chunk->data_len > 0)) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    *evicted = false;
+
+    if (chunk->data_len >= chunk->total_len ||
+        chunk->total_len > route->max_len ||
+        chunk->total_len > PRES_MQTT_REASSEMBLY_SLOT_LEN ||
+        suffix_len >= sizeof(reassembly->slots[0].suffix.str)) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    pres_mqtt_reassembly_slot_t* slot = slot_find(reassembly, chunk->msg_id);
+    if (!slot) {
+        slot = slot_free(reassembly);
+    }
+    if (!slot) {
+        slot     = slot_oldest(reassembly);
+        *evicted = true;
+    }
+
+    slot->used         = true;
+    slot->msg_id       = chunk->msg_id;
+    slot->started_ms   = chunk->received_ms;
+    slot->route        = route;
+    slot->total_len    = chunk->total_len;
+    slot->received_len = chunk->data_len;
+    slot->suffix.len   = (uint16_t)suffix_len;
+    memcpy(slot->suffix.str, suffix, suffix_len);
+    slot->suffix.str[suffix_len] = '\0';
+    if (chunk->data_len > 0) {
+        memcpy(slot->buf, chunk->data, chunk->data_len);
+    }
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+dom_models_error_t pres_mqtt_reassembly_append(
+    pres_mqtt_reassembly_t*             reassembly,
+    const pres_mqtt_reassembly_chunk_t* chunk,
+    pres_mqtt_reassembly_slot_t**       complete
+) {
+    if (!reassembly || !chunk || !complete || chunk->offset == 0 || (!chunk->data && chunk->data_len > 0)) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    *complete = NULL;
+
+    /* Fragments of payloads that were never admitted land here */
+    pres_mqtt_reassembly_slot_t* slot = slot_find(reassembly, chunk->msg_id);
+    if (!slot) {
+        return DOMAIN_MODELS_ERROR_NOT_FOUND;
+    }
+
+    if (chunk->offset != slot->received_len ||
+        chunk->total_len != slot->total_len ||
+        chunk->data_len > slot->total_len - slot->received_len) {
+        pres_mqtt_reassembly_release(slot);
+        return DOMAIN_MODELS_ERROR_BAD_STATE;
+    }
+
+    memcpy(slot->buf + slot->received_len, chunk->data, chunk->data_len);
+    slot->received_len += chunk->data_len;
+
+    if (slot->received_len == slot->total_len) {
+        *complete = slot;
+    }
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+void pres_mqtt_reassembly_release(pres_mqtt_reassembly_slot_t* slot) {
+    if (!slot) {
+        return;
+    }
+
+    slot->used         = false;
+    slot->route        = NULL;
+    slot->received_len = 0;
+    slot->total_len    = 0;
+}
+
+/* Helper Function Implementations */
+
+static pres_mqtt_reassembly_slot_t* slot_find(pres_mqtt_reassembly_t* reassembly, int msg_id) {
+    for (size_t i = 0; i < PRES_MQTT_REASSEMBLY_SLOT_CNT; i++) {
+        if (reassembly->slots[i].used && reassembly->slots[i].msg_id == msg_id) {
+            return &reassembly->slots[i];
+        }
+    }
+
+    return NULL;
+}
+
+static pres_mqtt_reassembly_slot_t* slot_free(pres_mqtt_reassembly_t* reassembly) {
+    for (size_t i = 0; i < PRES_MQTT_REASSEMBLY_SLOT_CNT; i++) {
+        if (!reassembly->slots[i].used) {
+            return &reassembly->slots[i];
+        }
+    }
+
+    return NULL;
+}
+
+static pres_mqtt_reassembly_slot_t* slot_oldest(pres_mqtt_reassembly_t* reassembly) {
+    pres_mqtt_reassembly_slot_t* oldest = &reassembly->slots[0];
+    for (size_t i = 1; i < PRES_MQTT_REASSEMBLY_SLOT_CNT; i++) {
+        if (reassembly->slots[i].started_ms < oldest->started_ms) {
+            oldest = &reassembly->slots[i];
+        }
+    }
+
+    return oldest;
+}
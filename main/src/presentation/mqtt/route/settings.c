@@ -0,0 +1,60 @@
+#include "presentation/mqtt/route/settings.h"
+
+#include <stddef.h>
+
+#include "domain/models/error.h"
+#include "presentation/mqtt/handler/settings.h"
+#include "presentation/mqtt/router.h"
+
+typedef struct {
+    const char*         pattern;
+    int                 qos;
+    size_t              max_len;
+    pres_mqtt_handler_t handler;
+} pres_mqtt_route_settings_route_t;
+
+static const pres_mqtt_route_settings_route_t routes[] = {
+    {
+        .pattern = "settings",
+        .qos     = 0,
+        .max_len = 256,
+        .handler = pres_mqtt_handler_settings_get_snapshot,
+    },
+    {
+        .pattern = "settings/preloaded",
+        .qos     = 1,
+        .max_len = 8192,
+        .handler = pres_mqtt_handler_settings_set_preloaded,
+    },
+    {
+        .pattern = "settings/restart-required",
+        .qos     = 0,
+        .max_len = 256,
+        .handler = pres_mqtt_handler_settings_get_restart_required,
+    },
+    {
+        .pattern = "settings/restart",
+        .qos     = 1,
+        .max_len = 256,
+        .handler = pres_mqtt_handler_settings_restart,
+    },
+};
+
+dom_models_error_t pres_mqtt_route_settings_register(pres_mqtt_router_t* router) {
+    if (!router) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    for (size_t i = 0; i < pres_mqtt_route_settings_route_cnt(); i++) {
+        dom_models_error_t err = pres_mqtt_router_add(router, routes[i].pattern, routes[i].qos, routes[i].max_len, routes[i].handler);
+        if (err != DOMAIN_MODELS_ERROR_OK) {
+            return err;
+        }
+    }
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+size_t pres_mqtt_route_settings_route_cnt(void) {
+    return sizeof(routes) / sizeof(routes[0]);
+}
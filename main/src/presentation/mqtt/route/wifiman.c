@@ -0,0 +1,120 @@
+#include "presentation/mqtt/route/wifiman.h"
+
+#include <stddef.h>
+
+#include "domain/models/error.h"
+#include "presentation/mqtt/handler/wifiman.h"
+#include "presentation/mqtt/router.h"
+
+typedef struct {
+    const char*         pattern;
+    int                 qos;
+    size_t              max_len;
+    pres_mqtt_handler_t handler;
+} pres_mqtt_route_wifiman_route_t;
+
+static const pres_mqtt_route_wifiman_route_t routes[] = {
+    {
+        .pattern = "wifi/status",
+        .qos     = 0,
+        .max_len = 256,
+        .handler = pres_mqtt_handler_wifiman_get_status,
+    },
+    {
+        .pattern = "wifi/scan",
+        .qos     = 1,
+        .max_len = 256,
+        .handler = pres_mqtt_handler_wifiman_start_scan,
+    },
+    {
+        .pattern = "wifi/scan/result",
+        .qos     = 0,
+        .max_len = 256,
+        .handler = pres_mqtt_handler_wifiman_get_scan_result,
+    },
+    {
+        .pattern = "wifi/sta/connect",
+        .qos     = 1,
+        .max_len = 512,
+        .handler = pres_mqtt_handler_wifiman_connect_sta,
+    },
+    {
+        .pattern = "wifi/sta/stored",
+        .qos     = 1,
+        .max_len = 256,
+        .handler = pres_mqtt_handler_wifiman_connect_stored_sta,
+    },
+    {
+        .pattern = "wifi/sta/disconnect",
+        .qos     = 1,
+        .max_len = 256,
+        .handler = pres_mqtt_handler_wifiman_disconnect_sta,
+    },
+    {
+        .pattern = "wifi/sta/commit",
+        .qos     = 1,
+        .max_len = 256,
+        .handler = pres_mqtt_handler_wifiman_commit_sta_connection,
+    },
+    {
+        .pattern = "wifi/sta/credential",
+        .qos     = 0,
+        .max_len = 256,
+        .handler = pres_mqtt_handler_wifiman_get_stored_sta,
+    },
+    {
+        .pattern = "wifi/sta/credential/set",
+        .qos     = 1,
+        .max_len = 512,
+        .handler = pres_mqtt_handler_wifiman_set_sta_credential,
+    },
+    {
+        .pattern = "wifi/sta/credential/forget",
+        .qos     = 1,
+        .max_len = 512,
+        .handler = pres_mqtt_handler_wifiman_forget_sta_credential,
+    },
+    {
+        .pattern = "wifi/sta/profiles",
+        .qos     = 0,
+        .max_len = 256,
+        .handler = pres_mqtt_handler_wifiman_get_sta_profiles,
+    },
+    {
+        .pattern = "wifi/sta/profiles/set",
+        .qos     = 1,
+        .max_len = 512,
+        .handler = pres_mqtt_handler_wifiman_set_sta_profile,
+    },
+    {
+        .pattern = "wifi/sta/profiles/delete",
+        .qos     = 1,
+        .max_len = 256,
+        .handler = pres_mqtt_handler_wifiman_delete_sta_profile,
+    },
+    {
+        .pattern = "wifi/reconnect",
+        .qos     = 1,
+        .max_len = 256,
+        .handler = pres_mqtt_handler_wifiman_try_reconnect,
+    },
+};
+
+dom_models_error_t pres_mqtt_route_wifiman_register(pres_mqtt_router_t* router) {
+    if (!router) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    for (size_t i = 0; i < pres_mqtt_route_wifiman_route_cnt(); i++) {
+        dom_models_error_t err = pres_mqtt_router_add(router, routes[i].pattern, routes[i].qos, routes[i].max_len, routes[i].handler);
+        if (err != DOMAIN_MODELS_ERROR_OK) {
+            return err;
+        }
+    }
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+size_t pres_mqtt_route_wifiman_route_cnt(void) {
+    return sizeof(routes) / sizeof(routes[0]);
+}
@@ -0,0 +1,240 @@
+#include "presentation/mqtt/router.h"
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "domain/models/error.h"
+#include "mqtt_client.h"
+#include "utils/mqtt/topic_table.h"
+
+#define NONE (-1)
+
+/* Helper Function Prototypes */
+
+static bool pattern_valid(const char* pattern, size_t pattern_len);
+static int  node_new(pres_mqtt_router_t* router, const char* seg, size_t seg_len);
+static int  literal_child(const pres_mqtt_router_t* router, int node, const char* seg, size_t seg_len);
+static int  terminal_route(const pres_mqtt_router_t* router, int node);
+static int  match_level(const pres_mqtt_router_t* router, int node, const char* level, const char* end);
+
+dom_models_error_t pres_mqtt_router_init(
+    pres_mqtt_router_t* router,
+    const char*         device_id
+) {
+    if (!router || !device_id || device_id[0] == '\0') {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    memset(router, 0, sizeof(*router));
+
+    int written = snprintf(router->prefix.str, sizeof(router->prefix.str), "/sub/%s/", device_id);
+    if (written <= 0 || (size_t)written >= sizeof(router->prefix.str)) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+    router->prefix.len = (uint16_t)written;
+
+    if (node_new(router, "", 0) != 0) {
+        return DOMAIN_MODELS_ERROR_FAILURE;
+    }
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+dom_models_error_t pres_mqtt_router_add(
+    pres_mqtt_router_t* router,
+    const char*         pattern,
+    int                 qos,
+    size_t              max_len,
+    pres_mqtt_handler_t handler
+) {
+    if (!router || router->node_cnt == 0 || !pattern || !handler || qos < 0 || qos > 2 || max_len == 0) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    size_t pattern_len = strlen(pattern);
+    if (!pattern_valid(pattern, pattern_len) ||
+        router->prefix.len + pattern_len >= sizeof(router->routes[0].filter.str)) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+    if (router->route_cnt >= PRES_MQTT_ROUTER_ROUTE_MAX_CNT) {
+        return DOMAIN_MODELS_ERROR_BAD_STATE;
+    }
+
+    int         node  = 0;
+    bool        hash  = false;
+    const char* level = pattern;
+    const char* end   = pattern + pattern_len;
+    while (level <= end) {
+        const char* sep     = memchr(level, '/', (size_t)(end - level));
+        const char* seg_end = sep ? sep : end;
+        size_t      seg_len = (size_t)(seg_end - level);
+
+        if (seg_len == 1 && level[0] == '#') {
+            hash = true;
+            break;
+        }
+
+        int child = NONE;
+        if (seg_len == 1 && level[0] == '+') {
+            child = router->nodes[node].plus_child;
+            if (child == NONE) {
+                child = node_new(router, level, seg_len);
+                if (child == NONE) {
+                    return DOMAIN_MODELS_ERROR_BAD_STATE;
+                }
+                router->nodes[node].plus_child = (int8_t)child;
+            }
+        } else {
+            child = literal_child(router, node, level, seg_len);
+            if (child == NONE) {
+                child = node_new(router, level, seg_len);
+                if (child == NONE) {
+                    return DOMAIN_MODELS_ERROR_BAD_STATE;
+                }
+                router->nodes[child].next_sibling = router->nodes[node].first_child;
+                router->nodes[node].first_child   = (int8_t)child;
+            }
+        }
+
+        node  = child;
+        level = seg_end + 1;
+    }
+
+    int8_t* slot = hash ? &router->nodes[node].hash_route : &router->nodes[node].route;
+    if (*slot != NONE) {
+        return DOMAIN_MODELS_ERROR_BAD_STATE;
+    }
+
+    pres_mqtt_router_route_t* route = &router->routes[router->route_cnt];
+    memcpy(route->filter.str, router->prefix.str, router->prefix.len);
+    memcpy(route->filter.str + router->prefix.len, pattern, pattern_len + 1);
+    route->filter.len = (uint16_t)(router->prefix.len + pattern_len);
+    route->qos        = qos;
+    route->max_len    = max_len;
+    route->handler    = handler;
+
+    *slot = (int8_t)router->route_cnt++;
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+const pres_mqtt_router_route_t* pres_mqtt_router_match(
+    const pres_mqtt_router_t* router,
+    const char*               topic,
+    size_t                    topic_len
+) {
+    if (!router || router->node_cnt == 0 || !topic || topic_len < router->prefix.len) {
+        return NULL;
+    }
+    if (memcmp(topic, router->prefix.str, router->prefix.len) != 0) {
+        return NULL;
+    }
+
+    int route = match_level(router, 0, topic + router->prefix.len, topic + topic_len);
+
+    return route == NONE ? NULL : &router->routes[route];
+}
+
+int pres_mqtt_router_subscribe(
+    const pres_mqtt_router_t* router,
+    esp_mqtt_client_handle_t  client
+) {
+    if (!router || !client || router->route_cnt == 0) {
+        return -1;
+    }
+
+    esp_mqtt_topic_t topics[PRES_MQTT_ROUTER_ROUTE_MAX_CNT];
+    for (size_t i = 0; i < router->route_cnt; i++) {
+        topics[i].filter = router->routes[i].filter.str;
+        topics[i].qos    = router->routes[i].qos;
+    }
+
+    return esp_mqtt_client_subscribe_multiple(client, topics, (int)router->route_cnt);
+}
+
+/* Helper Function Implementations */
+
+static bool pattern_valid(const char* pattern, size_t pattern_len) {
+    if (pattern_len == 0) {
+        return false;
+    }
+
+    for (size_t i = 0; i < pattern_len; i++) {
+        if (pattern[i] != '+' && pattern[i] != '#') {
+            continue;
+        }
+
+        /* Wildcards must fill a whole level, and '#' must be the last one */
+        bool level_start = i == 0 || pattern[i - 1] == '/';
+        bool level_end   = i + 1 == pattern_len || pattern[i + 1] == '/';
+        if (!level_start || !level_end || (pattern[i] == '#' && i + 1 != pattern_len)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static int node_new(pres_mqtt_router_t* router, const char* seg, size_t seg_len) {
+    if (router->node_cnt >= PRES_MQTT_ROUTER_NODE_MAX_CNT ||
+        seg_len > UINT8_MAX ||
+        router->segments_len + seg_len > sizeof(router->segments)) {
+        return NONE;
+    }
+
+    pres_mqtt_router_node_t* node = &router->nodes[router->node_cnt];
+    node->seg_off                 = (uint16_t)router->segments_len;
+    node->seg_len                 = (uint8_t)seg_len;
+    node->route                   = NONE;
+    node->hash_route              = NONE;
+    node->plus_child              = NONE;
+    node->first_child             = NONE;
+    node->next_sibling            = NONE;
+
+    memcpy(router->segments + router->segments_len, seg, seg_len);
+    router->segments_len += seg_len;
+
+    return (int)router->node_cnt++;
+}
+
+static int literal_child(const pres_mqtt_router_t* router, int node, const char* seg, size_t seg_len) {
+    for (int child = router->nodes[node].first_child; child != NONE; child = router->nodes[child].next_sibling) {
+        const pres_mqtt_router_node_t* entry = &router->nodes[child];
+        if (entry->seg_len == seg_len && memcmp(router->segments + entry->seg_off, seg, seg_len) == 0) {
+            return child;
+        }
+    }
+
+    return NONE;
+}
+
+static int terminal_route(const pres_mqtt_router_t* router, int node) {
+    /* "a/#" also matches "a" itself */
+    return router->nodes[node].route != NONE ? router->nodes[node].route : router->nodes[node].hash_route;
+}
+
+static int match_level(const pres_mqtt_router_t* router, int node, const char* level, const char* end) {
+    const char* sep     = memchr(level, '/', (size_t)(end - level));
+    const char* seg_end = sep ? sep : end;
+    bool        last    = !sep;
+
+    /* Literal levels win over '+', which wins over '#' */
+    int child = literal_child(router, node, level, (size_t)(seg_end - level));
+    if (child != NONE) {
+        int route = last ? terminal_route(router, child) : match_level(router, child, seg_end + 1, end);
+        if (route != NONE) {
+            return route;
+        }
+    }
+
+    child = router->nodes[node].plus_child;
+    if (child != NONE) {
+        int route = last ? terminal_route(router, child) : match_level(router, child, seg_end + 1, end);
+        if (route != NONE) {
+            return route;
+        }
+    }
+
+    return router->nodes[node].hash_route;
+}
@@ -0,0 +1,422 @@
+#include "presentation/task/event_stream/task.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "domain/models/error.h"
+#include "domain/models/ethernet.h"
+#include "domain/models/wifi.h"
+#include "domain/usecases/ota.h"
+#include "esp_err.h"
+#include "esp_http_server.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"  // IWYU pragma: keep
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "presentation/http/etag.h"
+#include "presentation/task/event_stream/types.h"
+#include "presentation/task/event_stream/utils.h"
+
+/* Longest formatted event plus the retry field sent with a resync */
+#define EVENT_MAX_LEN 128
+#define KEEPALIVE     ": ping\n\n"
+
+/* Task Function Prototypes */
+
+static void task_impl(void* arg);
+
+/* Helper Function Prototypes */
+
+static void   sample_sources(pres_task_event_stream_t* self);
+static void   flush_client(pres_task_event_stream_t* self, size_t index, int64_t now_ms);
+static size_t drain_locked(pres_task_event_stream_t* self, pres_task_event_stream_client_t* client, uint32_t* sent);
+static void   drop_client(pres_task_event_stream_t* self, size_t index, httpd_req_t* req);
+static void   close_clients(pres_task_event_stream_t* self);
+
+/* Constructor and Destructor */
+
+pres_task_event_stream_t* pres_task_event_stream_new(
+    const pres_task_event_stream_cfg_t* cfg
+) {
+    dom_models_error_t err = pres_task_event_stream_validate_cfg(cfg);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return NULL;
+    }
+
+    pres_task_event_stream_t* self = (pres_task_event_stream_t*)calloc(1, sizeof(pres_task_event_stream_t));
+    if (!self) {
+        return NULL;
+    }
+
+    pres_task_event_stream_normalize_cfg(&self->cfg, cfg);
+
+    self->lock = xSemaphoreCreateMutex();
+    if (!self->lock) {
+        free(self);
+        return NULL;
+    }
+
+    return self;
+}
+
+void pres_task_event_stream_delete(
+    pres_task_event_stream_t* self
+) {
+    if (!self) {
+        return;
+    }
+
+    (void)pres_task_event_stream_stop(self);
+    vSemaphoreDelete(self->lock);
+    free(self);
+}
+
+/* Public Function Implementations */
+
+dom_models_error_t pres_task_event_stream_start(
+    pres_task_event_stream_t* self
+) {
+    if (!self) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+    if (self->started) {
+        return DOMAIN_MODELS_ERROR_OK;
+    }
+
+    self->stop_requested = false;
+
+    BaseType_t result = xTaskCreate(
+        task_impl,
+        self->cfg.task_name,
+        self->cfg.stack_size,
+        self,
+        self->cfg.priority,
+        &self->task_handle
+    );
+    if (result != pdPASS) {
+        self->task_handle    = NULL;
+        self->stop_requested = false;
+        return DOMAIN_MODELS_ERROR_MALLOC_FAILED;
+    }
+
+    self->started = true;
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+dom_models_error_t pres_task_event_stream_stop(
+    pres_task_event_stream_t* self
+) {
+    if (!self) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+    if (!self->started) {
+        self->task_handle    = NULL;
+        self->stop_requested = false;
+        close_clients(self);
+        return DOMAIN_MODELS_ERROR_OK;
+    }
+
+    self->stop_requested = true;
+
+    if (self->task_handle) {
+        /* The task may hold lock or sit in a send, let it finish the pass and exit */
+        xTaskNotifyGive(self->task_handle);
+
+        TickType_t waited_ticks = 0;
+        TickType_t max_ticks    = pdMS_TO_TICKS(PRES_TASK_EVENT_STREAM_DEFAULT_STOP_TIMEOUT_MS);
+        while (self->task_handle && waited_ticks < max_ticks) {
+            vTaskDelay(1);
+            waited_ticks++;
+        }
+
+        if (self->task_handle) {
+            TaskHandle_t task_handle = self->task_handle;
+            self->task_handle        = NULL;
+            vTaskDelete(task_handle);
+        }
+    }
+
+    self->started        = false;
+    self->stop_requested = false;
+    close_clients(self);
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+dom_models_error_t pres_task_event_stream_get_stats(
+    pres_task_event_stream_t*       self,
+    pres_task_event_stream_stats_t* out
+) {
+    if (!self || !out) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    xSemaphoreTake(self->lock, portMAX_DELAY);
+    *out = self->stats;
+    xSemaphoreGive(self->lock);
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+dom_models_error_t pres_task_event_stream_subscribe(
+    pres_task_event_stream_t* self,
+    httpd_req_t*              req
+) {
+    if (!self || !req) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    dom_models_error_t err = DOMAIN_MODELS_ERROR_BAD_STATE;
+
+    xSemaphoreTake(self->lock, portMAX_DELAY);
+    for (size_t i = 0; self->started && i < self->cfg.client_max; i++) {
+        pres_task_event_stream_client_t* client = &self->clients[i];
+        if (client->req) {
+            continue;
+        }
+
+        /* The first message tells the client to load state through the GET routes */
+        client->req          = req;
+        client->last_send_ms = 0;
+        pres_task_event_stream_ring_reset(&client->ring);
+        client->ring.overrun = true;
+
+        self->stats.subscribed_cnt++;
+        self->stats.client_cnt++;
+        err = DOMAIN_MODELS_ERROR_OK;
+        break;
+    }
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        self->stats.rejected_cnt++;
+    }
+    TaskHandle_t task_handle = self->task_handle;
+    xSemaphoreGive(self->lock);
+
+    if (err == DOMAIN_MODELS_ERROR_OK && task_handle) {
+        xTaskNotifyGive(task_handle);
+    }
+
+    return err;
+}
+
+void pres_task_event_stream_publish(
+    pres_task_event_stream_t*             self,
+    const pres_task_event_stream_event_t* event
+) {
+    if (!self || !event) {
+        return;
+    }
+
+    xSemaphoreTake(self->lock, portMAX_DELAY);
+    for (size_t i = 0; i < self->cfg.client_max; i++) {
+        pres_task_event_stream_client_t* client = &self->clients[i];
+        if (!client->req) {
+            continue;
+        }
+
+        bool overrun = client->ring.overrun;
+        pres_task_event_stream_ring_push(&client->ring, event);
+        if (!overrun && client->ring.overrun) {
+            self->stats.overrun_cnt++;
+        }
+    }
+    self->stats.published_cnt++;
+    bool         notify      = self->stats.client_cnt > 0;
+    TaskHandle_t task_handle = self->task_handle;
+    xSemaphoreGive(self->lock);
+
+    if (notify && task_handle) {
+        xTaskNotifyGive(task_handle);
+    }
+}
+
+void pres_task_event_stream_on_wifi_event(
+    void*                          cb_ctx,
+    const dom_models_wifi_event_t* event
+) {
+    pres_task_event_stream_event_t stream_event;
+    if (pres_task_event_stream_from_wifi_event(event, &stream_event)) {
+        pres_task_event_stream_publish(cb_ctx, &stream_event);
+    }
+}
+
+void pres_task_event_stream_on_ethernet_event(
+    void*                              cb_ctx,
+    const dom_models_ethernet_event_t* event
+) {
+    pres_task_event_stream_event_t stream_event;
+    if (pres_task_event_stream_from_ethernet_event(event, &stream_event)) {
+        pres_task_event_stream_publish(cb_ctx, &stream_event);
+    }
+}
+
+/* Task Function Implementations */
+
+static void task_impl(void* arg) {
+    pres_task_event_stream_t* self = (pres_task_event_stream_t*)arg;
+    if (!self) {
+        vTaskDelete(NULL);
+        return;
+    }
+
+    while (!self->stop_requested) {
+        /* Publishers wake the task, the timeout drives sampling and keepalives */
+        (void)ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(self->cfg.tick_ms));
+        if (self->stop_requested) {
+            break;
+        }
+
+        sample_sources(self);
+
+        int64_t now_ms = esp_timer_get_time() / 1000;
+        for (size_t i = 0; i < self->cfg.client_max; i++) {
+            flush_client(self, i, now_ms);
+        }
+    }
+
+    self->task_handle = NULL;
+
+    vTaskDelete(NULL);
+}
+
+/* Helper Function Implementations */
+
+static void sample_sources(pres_task_event_stream_t* self) {
+    pres_task_event_stream_sampled_t* sampled = &self->sampled;
+    pres_task_event_stream_event_t    event;
+
+    if (self->cfg.settings_etag) {
+        uint32_t generation = pres_http_etag_generation(self->cfg.settings_etag);
+        if (sampled->settings_seen && generation != sampled->settings_generation) {
+            memset(&event, 0, sizeof(event));
+            event.type = PRES_TASK_EVENT_STREAM_EVENT_SETTINGS;
+            pres_task_event_stream_publish(self, &event);
+        }
+        sampled->settings_seen       = true;
+        sampled->settings_generation = generation;
+    }
+
+    dom_usecases_ota_t*       ota        = self->cfg.ota;
+    dom_usecases_ota_status_t ota_status = {0};
+    if (ota && ota->get_status && ota->get_status(ota, &ota_status) == DOMAIN_MODELS_ERROR_OK) {
+        uint32_t written_size = (uint32_t)ota_status.written_size;
+        if (ota_status.updating != sampled->ota_updating || (ota_status.updating && written_size != sampled->ota_written_size)) {
+            memset(&event, 0, sizeof(event));
+            event.type         = PRES_TASK_EVENT_STREAM_EVENT_OTA;
+            event.up           = ota_status.updating;
+            event.written_size = written_size;
+            event.total_size   = (uint32_t)ota_status.total_size;
+            pres_task_event_stream_publish(self, &event);
+        }
+        sampled->ota_updating     = ota_status.updating;
+        sampled->ota_written_size = written_size;
+    }
+}
+
+static void flush_client(pres_task_event_stream_t* self, size_t index, int64_t now_ms) {
+    pres_task_event_stream_client_t* client = &self->clients[index];
+
+    while (true) {
+        uint32_t sent = 0;
+        size_t   len  = 0;
+
+        xSemaphoreTake(self->lock, portMAX_DELAY);
+        httpd_req_t* req = client->req;
+        if (req) {
+            len = drain_locked(self, client, &sent);
+        }
+        xSemaphoreGive(self->lock);
+
+        if (!req) {
+            return;
+        }
+        if (len == 0) {
+            if (now_ms - client->last_send_ms < (int64_t)self->cfg.keepalive_ms) {
+                return;
+            }
+
+            /* Comment lines keep proxies and dead peer detection going */
+            len = strlen(KEEPALIVE);
+            memcpy(self->scratch, KEEPALIVE, len);
+        }
+
+        if (httpd_resp_send_chunk(req, self->scratch, (ssize_t)len) != ESP_OK) {
+            drop_client(self, index, req);
+            return;
+        }
+        client->last_send_ms = now_ms;
+
+        if (sent == 0) {
+            return;
+        }
+
+        xSemaphoreTake(self->lock, portMAX_DELAY);
+        self->stats.sent_cnt += sent;
+        xSemaphoreGive(self->lock);
+    }
+}
+
+static size_t drain_locked(pres_task_event_stream_t* self, pres_task_event_stream_client_t* client, uint32_t* sent) {
+    char*  buf     = self->scratch;
+    size_t buf_len = sizeof(self->scratch);
+    size_t len     = 0;
+
+    /* Queued events are stale once some were lost, a resync replaces them */
+    if (client->ring.overrun) {
+        pres_task_event_stream_ring_reset(&client->ring);
+
+        int written = snprintf(buf, buf_len, "retry: %u\n", (unsigned int)self->cfg.retry_ms);
+        if (written > 0 && (size_t)written < buf_len) {
+            len = (size_t)written;
+        }
+
+        pres_task_event_stream_event_t resync = {.type = PRES_TASK_EVENT_STREAM_EVENT_RESYNC};
+        len += pres_task_event_stream_format_event(buf + len, buf_len - len, &resync);
+        *sent = 1;
+
+        return len;
+    }
+
+    pres_task_event_stream_event_t event;
+    while (buf_len - len >= EVENT_MAX_LEN && pres_task_event_stream_ring_pop(&client->ring, &event)) {
+        len += pres_task_event_stream_format_event(buf + len, buf_len - len, &event);
+        (*sent)++;
+    }
+
+    return len;
+}
+
+static void drop_client(pres_task_event_stream_t* self, size_t index, httpd_req_t* req) {
+    xSemaphoreTake(self->lock, portMAX_DELAY);
+    pres_task_event_stream_client_t* client = &self->clients[index];
+    if (client->req == req) {
+        client->req = NULL;
+        pres_task_event_stream_ring_reset(&client->ring);
+        self->stats.client_cnt--;
+        self->stats.dropped_cnt++;
+    }
+    xSemaphoreGive(self->lock);
+
+    (void)httpd_req_async_handler_complete(req);
+}
+
+static void close_clients(pres_task_event_stream_t* self) {
+    for (size_t i = 0; i < PRES_TASK_EVENT_STREAM_CLIENT_MAX; i++) {
+        xSemaphoreTake(self->lock, portMAX_DELAY);
+        httpd_req_t* req     = self->clients[i].req;
+        self->clients[i].req = NULL;
+        pres_task_event_stream_ring_reset(&self->clients[i].ring);
+        if (req) {
+            self->stats.client_cnt--;
+        }
+        xSemaphoreGive(self->lock);
+
+        if (req) {
+            (void)httpd_resp_send_chunk(req, NULL, 0);
+            (void)httpd_req_async_handler_complete(req);
+        }
+    }
+}
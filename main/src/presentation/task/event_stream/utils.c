@@ -0,0 +1,262 @@
+#include "presentation/task/event_stream/utils.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "domain/models/error.h"
+#include "domain/models/ethernet.h"
+#include "domain/models/wifi.h"
+#include "presentation/task/event_stream/types.h"
+
+dom_models_error_t pres_task_event_stream_validate_cfg(
+    const pres_task_event_stream_cfg_t* cfg
+) {
+    if (!cfg || cfg->client_max > PRES_TASK_EVENT_STREAM_CLIENT_MAX) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+void pres_task_event_stream_normalize_cfg(
+    pres_task_event_stream_cfg_t*       out,
+    const pres_task_event_stream_cfg_t* cfg
+) {
+    if (!out) {
+        return;
+    }
+
+    memset(out, 0, sizeof(pres_task_event_stream_cfg_t));
+    if (!cfg) {
+        return;
+    }
+
+    memcpy(out, cfg, sizeof(pres_task_event_stream_cfg_t));
+
+    if (!out->task_name || out->task_name[0] == '\0') {
+        out->task_name = PRES_TASK_EVENT_STREAM_DEFAULT_TASK_NAME;
+    }
+    if (out->stack_size == 0) {
+        out->stack_size = PRES_TASK_EVENT_STREAM_DEFAULT_STACK_SIZE;
+    }
+    if (out->priority == 0) {
+        out->priority = PRES_TASK_EVENT_STREAM_DEFAULT_PRIORITY;
+    }
+    if (out->client_max == 0) {
+        out->client_max = PRES_TASK_EVENT_STREAM_DEFAULT_CLIENT_MAX;
+    }
+    if (out->tick_ms == 0) {
+        out->tick_ms = PRES_TASK_EVENT_STREAM_DEFAULT_TICK_MS;
+    }
+    if (out->keepalive_ms == 0) {
+        out->keepalive_ms = PRES_TASK_EVENT_STREAM_DEFAULT_KEEPALIVE_MS;
+    }
+    if (out->retry_ms == 0) {
+        out->retry_ms = PRES_TASK_EVENT_STREAM_DEFAULT_RETRY_MS;
+    }
+}
+
+void pres_task_event_stream_ring_reset(
+    pres_task_event_stream_ring_t* ring
+) {
+    if (!ring) {
+        return;
+    }
+
+    ring->head    = 0;
+    ring->count   = 0;
+    ring->overrun = false;
+}
+
+void pres_task_event_stream_ring_push(
+    pres_task_event_stream_ring_t*        ring,
+    const pres_task_event_stream_event_t* event
+) {
+    if (!ring || !event) {
+        return;
+    }
+
+    if (ring->count == PRES_TASK_EVENT_STREAM_RING_LEN) {
+        ring->head    = (uint8_t)((ring->head + 1) % PRES_TASK_EVENT_STREAM_RING_LEN);
+        ring->count   = (uint8_t)(ring->count - 1);
+        ring->overrun = true;
+    }
+
+    size_t tail        = (ring->head + ring->count) % PRES_TASK_EVENT_STREAM_RING_LEN;
+    ring->events[tail] = *event;
+    ring->count        = (uint8_t)(ring->count + 1);
+}
+
+bool pres_task_event_stream_ring_pop(
+    pres_task_event_stream_ring_t*  ring,
+    pres_task_event_stream_event_t* out
+) {
+    if (!ring || !out || ring->count == 0) {
+        return false;
+    }
+
+    *out        = ring->events[ring->head];
+    ring->head  = (uint8_t)((ring->head + 1) % PRES_TASK_EVENT_STREAM_RING_LEN);
+    ring->count = (uint8_t)(ring->count - 1);
+
+    return true;
+}
+
+bool pres_task_event_stream_from_wifi_event(
+    const dom_models_wifi_event_t*  event,
+    pres_task_event_stream_event_t* out
+) {
+    if (!event || !out) {
+        return false;
+    }
+
+    memset(out, 0, sizeof(pres_task_event_stream_event_t));
+    out->status = event->driver_status;
+
+    switch (event->type) {
+        case DOM_MODELS_WIFI_EVENT_STA_CONNECTED:
+        case DOM_MODELS_WIFI_EVENT_STA_DISCONNECTED:
+            out->type = PRES_TASK_EVENT_STREAM_EVENT_WIFI_STA_LINK;
+            out->up   = event->type == DOM_MODELS_WIFI_EVENT_STA_CONNECTED;
+            return true;
+
+        case DOM_MODELS_WIFI_EVENT_STA_GOT_IP:
+        case DOM_MODELS_WIFI_EVENT_STA_LOST_IP:
+            out->type = PRES_TASK_EVENT_STREAM_EVENT_WIFI_STA_IP;
+            out->up   = event->type == DOM_MODELS_WIFI_EVENT_STA_GOT_IP;
+            return true;
+
+        case DOM_MODELS_WIFI_EVENT_AP_STARTED:
+        case DOM_MODELS_WIFI_EVENT_AP_STOPPED:
+            out->type = PRES_TASK_EVENT_STREAM_EVENT_WIFI_AP;
+            out->up   = event->type == DOM_MODELS_WIFI_EVENT_AP_STARTED;
+            return true;
+
+        case DOM_MODELS_WIFI_EVENT_SCAN_DONE:
+            out->type = PRES_TASK_EVENT_STREAM_EVENT_WIFI_SCAN_DONE;
+            out->up   = event->driver_status == 0;
+            return true;
+
+        case DOM_MODELS_WIFI_EVENT_UNKNOWN:
+        default:
+            return false;
+    }
+}
+
+bool pres_task_event_stream_from_ethernet_event(
+    const dom_models_ethernet_event_t* event,
+    pres_task_event_stream_event_t*    out
+) {
+    if (!event || !out) {
+        return false;
+    }
+
+    memset(out, 0, sizeof(pres_task_event_stream_event_t));
+    out->status = event->driver_status;
+
+    switch (event->type) {
+        case DOM_MODELS_ETHERNET_EVENT_LINK_UP:
+        case DOM_MODELS_ETHERNET_EVENT_LINK_DOWN:
+            out->type = PRES_TASK_EVENT_STREAM_EVENT_ETHERNET_LINK;
+            out->up   = event->type == DOM_MODELS_ETHERNET_EVENT_LINK_UP;
+            return true;
+
+        case DOM_MODELS_ETHERNET_EVENT_GOT_IP:
+        case DOM_MODELS_ETHERNET_EVENT_LOST_IP:
+            out->type = PRES_TASK_EVENT_STREAM_EVENT_ETHERNET_IP;
+            out->up   = event->type == DOM_MODELS_ETHERNET_EVENT_GOT_IP;
+            return true;
+
+        case DOM_MODELS_ETHERNET_EVENT_STARTED:
+        case DOM_MODELS_ETHERNET_EVENT_STOPPED:
+        case DOM_MODELS_ETHERNET_EVENT_UNKNOWN:
+        default:
+            return false;
+    }
+}
+
+const char* pres_task_event_stream_event_name(
+    pres_task_event_stream_event_type_t type
+) {
+    switch (type) {
+        case PRES_TASK_EVENT_STREAM_EVENT_RESYNC:
+            return "resync";
+        case PRES_TASK_EVENT_STREAM_EVENT_WIFI_STA_LINK:
+            return "wifi.sta";
+        case PRES_TASK_EVENT_STREAM_EVENT_WIFI_STA_IP:
+            return "wifi.ip";
+        case PRES_TASK_EVENT_STREAM_EVENT_WIFI_AP:
+            return "wifi.ap";
+        case PRES_TASK_EVENT_STREAM_EVENT_WIFI_SCAN_DONE:
+            return "wifi.scan";
+        case PRES_TASK_EVENT_STREAM_EVENT_ETHERNET_LINK:
+            return "ethernet.link";
+        case PRES_TASK_EVENT_STREAM_EVENT_ETHERNET_IP:
+            return "ethernet.ip";
+        case PRES_TASK_EVENT_STREAM_EVENT_SETTINGS:
+            return "settings";
+        case PRES_TASK_EVENT_STREAM_EVENT_OTA:
+            return "ota";
+        default:
+            return "unknown";
+    }
+}
+
+size_t pres_task_event_stream_format_event(
+    char*                                 buf,
+    size_t                                buf_len,
+    const pres_task_event_stream_event_t* event
+) {
+    if (!buf || buf_len == 0 || !event) {
+        return 0;
+    }
+
+    const char* up      = event->up ? "true" : "false";
+    int         written = 0;
+
+    switch (event->type) {
+        case PRES_TASK_EVENT_STREAM_EVENT_WIFI_STA_LINK:
+            if (event->up) {
+                written = snprintf(buf, buf_len, "event: %s\ndata: {\"up\":true}\n\n", pres_task_event_stream_event_name(event->type));
+            } else {
+                written = snprintf(buf, buf_len, "event: %s\ndata: {\"up\":false,\"reason\":%" PRIu32 "}\n\n", pres_task_event_stream_event_name(event->type), event->status);
+            }
+            break;
+
+        case PRES_TASK_EVENT_STREAM_EVENT_WIFI_STA_IP:
+        case PRES_TASK_EVENT_STREAM_EVENT_WIFI_AP:
+        case PRES_TASK_EVENT_STREAM_EVENT_ETHERNET_LINK:
+        case PRES_TASK_EVENT_STREAM_EVENT_ETHERNET_IP:
+            written = snprintf(buf, buf_len, "event: %s\ndata: {\"up\":%s}\n\n", pres_task_event_stream_event_name(event->type), up);
+            break;
+
+        case PRES_TASK_EVENT_STREAM_EVENT_WIFI_SCAN_DONE:
+            written = snprintf(buf, buf_len, "event: %s\ndata: {\"ok\":%s,\"status\":%" PRIu32 "}\n\n", pres_task_event_stream_event_name(event->type), up, event->status);
+            break;
+
+        case PRES_TASK_EVENT_STREAM_EVENT_OTA:
+            written = snprintf(
+                buf,
+                buf_len,
+                "event: %s\ndata: {\"updating\":%s,\"written\":%" PRIu32 ",\"total\":%" PRIu32 "}\n\n",
+                pres_task_event_stream_event_name(event->type),
+                up,
+                event->written_size,
+                event->total_size
+            );
+            break;
+
+        case PRES_TASK_EVENT_STREAM_EVENT_RESYNC:
+        case PRES_TASK_EVENT_STREAM_EVENT_SETTINGS:
+        default:
+            written = snprintf(buf, buf_len, "event: %s\ndata: {}\n\n", pres_task_event_stream_event_name(event->type));
+            break;
+    }
+
+    if (written <= 0 || (size_t)written >= buf_len) {
+        return 0;
+    }
+
+    return (size_t)written;
+}
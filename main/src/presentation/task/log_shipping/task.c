@@ -0,0 +1,391 @@
+#include "presentation/task/log_shipping/task.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <sys/time.h>
+
+#include "domain/models/error.h"
+#include "domain/models/logger.h"
+#include "domain/models/messaging.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"  // IWYU pragma: keep
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "presentation/task/log_shipping/types.h"
+#include "presentation/task/log_shipping/utils.h"
+
+/* Helper Function Prototypes */
+
+static void       log_callback(void* cb_ctx, const char* msg, size_t msg_len);
+static void       record_callback(void* cb_ctx, const dom_models_logger_record_t* record);
+static bool       append_locked(pres_task_log_shipping_t* self, dom_models_logger_level_t level, const char* msg, size_t msg_len);
+static void       notify_task(pres_task_log_shipping_t* self, bool notify);
+static bool       batch_full(const pres_task_log_shipping_t* self, const pres_task_log_shipping_batch_t* batch);
+static TickType_t next_wait_ticks(pres_task_log_shipping_t* self);
+static void       flush_batch(pres_task_log_shipping_t* self, bool force);
+static void       free_buffers(pres_task_log_shipping_t* self);
+
+/* Task Function Prototypes */
+
+static void task_impl(void* arg);
+
+/* Constructor and Destructor */
+
+pres_task_log_shipping_t* pres_task_log_shipping_new(
+    const pres_task_log_shipping_cfg_t* cfg
+) {
+    dom_models_error_t err = pres_task_log_shipping_validate_cfg(cfg);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return NULL;
+    }
+
+    pres_task_log_shipping_t* self = (pres_task_log_shipping_t*)calloc(1, sizeof(pres_task_log_shipping_t));
+    if (!self) {
+        return NULL;
+    }
+
+    pres_task_log_shipping_normalize_cfg(&self->cfg, cfg);
+
+    /* Records only come from loggers that keep the call unformatted, the rest ship text */
+    bool binary = self->cfg.binary && self->cfg.logger->add_record_callback && self->cfg.logger->remove_record_callback;
+    if (binary) {
+        self->frame_buf = (uint8_t*)malloc(self->cfg.line_max_len);
+        if (!self->frame_buf) {
+            free(self);
+            return NULL;
+        }
+    }
+
+    for (size_t i = 0; i < 2; i++) {
+        pres_task_log_shipping_batch_t* batch = &self->batches[i];
+
+        batch->binary   = binary;
+        batch->head_len = binary ? PRES_TASK_LOG_SHIPPING_BINARY_HEAD_LEN : 0;
+        batch->buf_size = batch->head_len + self->cfg.batch_max_bytes + self->cfg.line_max_len + 1;
+        batch->buf      = (char*)malloc(batch->buf_size);
+        batch->records  = (pres_task_log_shipping_record_t*)calloc(self->cfg.batch_max_cnt, sizeof(pres_task_log_shipping_record_t));
+        if (!batch->buf || !batch->records) {
+            free_buffers(self);
+            free(self);
+            return NULL;
+        }
+
+        pres_task_log_shipping_batch_clear(batch);
+    }
+
+    self->lock = xSemaphoreCreateMutex();
+    if (!self->lock) {
+        free_buffers(self);
+        free(self);
+        return NULL;
+    }
+
+    return self;
+}
+
+void pres_task_log_shipping_delete(
+    pres_task_log_shipping_t* self
+) {
+    if (!self) {
+        return;
+    }
+
+    (void)pres_task_log_shipping_stop(self);
+    free_buffers(self);
+    vSemaphoreDelete(self->lock);
+    free(self);
+}
+
+/* Public Function Implementations */
+
+dom_models_error_t pres_task_log_shipping_start(
+    pres_task_log_shipping_t* self
+) {
+    if (!self) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+    if (self->started) {
+        return DOMAIN_MODELS_ERROR_OK;
+    }
+
+    self->stop_requested = false;
+
+    BaseType_t result = xTaskCreate(
+        task_impl,
+        self->cfg.task_name,
+        self->cfg.stack_size,
+        self,
+        self->cfg.priority,
+        &self->task_handle
+    );
+    if (result != pdPASS) {
+        self->task_handle    = NULL;
+        self->stop_requested = false;
+        return DOMAIN_MODELS_ERROR_MALLOC_FAILED;
+    }
+
+    if (self->frame_buf) {
+        self->cfg.logger->add_record_callback(self->cfg.logger, self, record_callback);
+    } else {
+        self->cfg.logger->add_callback(self->cfg.logger, self, log_callback);
+    }
+    self->callback_added = true;
+    self->started        = true;
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+dom_models_error_t pres_task_log_shipping_stop(
+    pres_task_log_shipping_t* self
+) {
+    if (!self) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    if (self->callback_added) {
+        if (self->frame_buf) {
+            self->cfg.logger->remove_record_callback(self->cfg.logger, record_callback);
+        } else {
+            self->cfg.logger->remove_callback(self->cfg.logger, log_callback);
+        }
+        self->callback_added = false;
+    }
+
+    if (!self->started) {
+        self->task_handle    = NULL;
+        self->stop_requested = false;
+        return DOMAIN_MODELS_ERROR_OK;
+    }
+
+    self->stop_requested = true;
+
+    if (self->task_handle) {
+        xTaskNotifyGive(self->task_handle);
+
+        TickType_t waited_ticks = 0;
+        TickType_t max_ticks    = pdMS_TO_TICKS(PRES_TASK_LOG_SHIPPING_DEFAULT_STOP_TIMEOUT_MS);
+        while (self->task_handle && waited_ticks < max_ticks) {
+            vTaskDelay(1);
+            waited_ticks++;
+        }
+
+        if (self->task_handle) {
+            TaskHandle_t task_handle = self->task_handle;
+            self->task_handle        = NULL;
+            vTaskDelete(task_handle);
+        }
+    }
+
+    self->started        = false;
+    self->stop_requested = false;
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+dom_models_error_t pres_task_log_shipping_get_stats(
+    pres_task_log_shipping_t*       self,
+    pres_task_log_shipping_stats_t* out
+) {
+    if (!self || !out) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    xSemaphoreTake(self->lock, portMAX_DELAY);
+    *out = self->stats;
+    xSemaphoreGive(self->lock);
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+/* Task Function Implementations */
+
+static void task_impl(void* arg) {
+    pres_task_log_shipping_t* self = (pres_task_log_shipping_t*)arg;
+    if (!self) {
+        vTaskDelete(NULL);
+        return;
+    }
+
+    while (!self->stop_requested) {
+        (void)ulTaskNotifyTake(pdTRUE, next_wait_ticks(self));
+        flush_batch(self, self->stop_requested);
+    }
+
+    self->task_handle = NULL;
+
+    vTaskDelete(NULL);
+}
+
+/* Helper Function Implementations */
+
+static void log_callback(void* cb_ctx, const char* msg, size_t msg_len) {
+    pres_task_log_shipping_t* self = (pres_task_log_shipping_t*)cb_ctx;
+    if (!self || !msg || msg_len == 0) {
+        return;
+    }
+
+    dom_models_logger_level_t level = pres_task_log_shipping_parse_level(msg, msg_len);
+    if (level == DOMAIN_MODELS_LOGGER_LEVEL_NONE || level > self->cfg.level) {
+        return;
+    }
+    if (msg_len > self->cfg.line_max_len) {
+        msg_len = self->cfg.line_max_len;
+    }
+
+    xSemaphoreTake(self->lock, portMAX_DELAY);
+    bool notify = append_locked(self, level, msg, msg_len);
+    xSemaphoreGive(self->lock);
+
+    notify_task(self, notify);
+}
+
+static void record_callback(void* cb_ctx, const dom_models_logger_record_t* record) {
+    pres_task_log_shipping_t* self = (pres_task_log_shipping_t*)cb_ctx;
+    if (!self || !record) {
+        return;
+    }
+    if (record->level == DOMAIN_MODELS_LOGGER_LEVEL_NONE || record->level > self->cfg.level) {
+        return;
+    }
+
+    xSemaphoreTake(self->lock, portMAX_DELAY);
+
+    bool   notify    = false;
+    size_t frame_len = pres_task_log_shipping_encode_record(self->frame_buf, self->cfg.line_max_len, record);
+    if (frame_len > 0) {
+        notify = append_locked(self, record->level, (const char*)self->frame_buf, frame_len);
+    } else {
+        self->stats.dropped_cnt++;
+    }
+
+    xSemaphoreGive(self->lock);
+
+    notify_task(self, notify);
+}
+
+static bool append_locked(pres_task_log_shipping_t* self, dom_models_logger_level_t level, const char* msg, size_t msg_len) {
+    pres_task_log_shipping_batch_t* batch       = &self->batches[self->fill_idx];
+    bool                            was_full    = batch_full(self, batch);
+    size_t                          evicted_cnt = 0;
+    bool                            appended    = pres_task_log_shipping_batch_append(
+        batch,
+        self->cfg.batch_max_cnt,
+        level,
+        msg,
+        msg_len,
+        &evicted_cnt
+    );
+
+    self->stats.dropped_cnt += (uint32_t)evicted_cnt + (appended ? 0 : 1);
+    if (appended && batch->record_cnt == 1) {
+        batch->first_us = esp_timer_get_time();
+    }
+
+    return (appended && batch->record_cnt == 1) || (!was_full && batch_full(self, batch));
+}
+
+static void notify_task(pres_task_log_shipping_t* self, bool notify) {
+    TaskHandle_t task_handle = self->task_handle;
+    if (notify && task_handle) {
+        xTaskNotifyGive(task_handle);
+    }
+}
+
+static bool batch_full(const pres_task_log_shipping_t* self, const pres_task_log_shipping_batch_t* batch) {
+    return batch->record_cnt >= self->cfg.batch_max_cnt || batch->buf_len >= self->cfg.batch_max_bytes;
+}
+
+static TickType_t next_wait_ticks(pres_task_log_shipping_t* self) {
+    TickType_t wait_ticks = portMAX_DELAY;
+
+    xSemaphoreTake(self->lock, portMAX_DELAY);
+
+    const pres_task_log_shipping_batch_t* batch = &self->batches[self->fill_idx];
+    if (batch->record_cnt > 0) {
+        int64_t age_ms  = (esp_timer_get_time() - batch->first_us) / 1000;
+        int64_t left_ms = (int64_t)self->cfg.max_latency_ms - age_ms;
+
+        /* A due batch that could not be published is retried once per latency window */
+        if (left_ms <= 0 || batch_full(self, batch)) {
+            left_ms = self->cfg.max_latency_ms;
+        }
+
+        wait_ticks = pdMS_TO_TICKS((uint32_t)left_ms);
+        if (wait_ticks == 0) {
+            wait_ticks = 1;
+        }
+    }
+
+    xSemaphoreGive(self->lock);
+
+    return wait_ticks;
+}
+
+static void flush_batch(pres_task_log_shipping_t* self, bool force) {
+    bool               connected = false;
+    dom_models_error_t err       = self->cfg.publish->is_connected(self->cfg.publish, &connected);
+    if (err != DOMAIN_MODELS_ERROR_OK || !connected) {
+        return;
+    }
+
+    xSemaphoreTake(self->lock, portMAX_DELAY);
+
+    pres_task_log_shipping_batch_t* batch = &self->batches[self->fill_idx];
+
+    int64_t age_us = esp_timer_get_time() - batch->first_us;
+    bool    due    = force || batch_full(self, batch) || age_us >= (int64_t)self->cfg.max_latency_ms * 1000;
+    if (batch->record_cnt == 0 || !due) {
+        xSemaphoreGive(self->lock);
+        return;
+    }
+
+    self->fill_idx ^= 1;
+
+    xSemaphoreGive(self->lock);
+
+    if (batch->binary) {
+        struct timeval now;
+        gettimeofday(&now, NULL);
+        pres_task_log_shipping_encode_head(
+            (uint8_t*)batch->buf,
+            batch->head_len,
+            esp_timer_get_time(),
+            (int64_t)now.tv_sec * 1000 + now.tv_usec / 1000
+        );
+    }
+
+    /* Text drops the last line's '\n', frames have no terminator */
+    dom_models_messaging_log_batch_t log_batch = {
+        .payload     = batch->buf,
+        .payload_len = batch->binary ? batch->buf_len : batch->buf_len - 1,
+        .record_cnt  = batch->record_cnt,
+        .binary      = batch->binary,
+    };
+    err = self->cfg.publish->send_log_batch(self->cfg.publish, &log_batch);
+
+    xSemaphoreTake(self->lock, portMAX_DELAY);
+
+    if (err == DOMAIN_MODELS_ERROR_OK) {
+        self->stats.publish_cnt++;
+        self->stats.shipped_cnt += (uint32_t)batch->record_cnt;
+    } else {
+        self->stats.failed_cnt++;
+        self->stats.dropped_cnt += (uint32_t)batch->record_cnt;
+    }
+
+    xSemaphoreGive(self->lock);
+
+    pres_task_log_shipping_batch_clear(batch);
+}
+
+static void free_buffers(pres_task_log_shipping_t* self) {
+    free(self->frame_buf);
+    self->frame_buf = NULL;
+
+    for (size_t i = 0; i < 2; i++) {
+        free(self->batches[i].buf);
+        free(self->batches[i].records);
+        self->batches[i].buf     = NULL;
+        self->batches[i].records = NULL;
+    }
+}
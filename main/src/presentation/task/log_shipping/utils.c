@@ -0,0 +1,276 @@
+#include "presentation/task/log_shipping/utils.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "domain/models/error.h"
+#include "domain/models/logger.h"
+#include "presentation/task/log_shipping/types.h"
+
+/* Helper Function Prototypes */
+
+static size_t find_victim(const pres_task_log_shipping_batch_t* batch);
+static void   remove_record(pres_task_log_shipping_batch_t* batch, size_t idx);
+static size_t term_len(const pres_task_log_shipping_batch_t* batch);
+
+dom_models_error_t pres_task_log_shipping_validate_cfg(
+    const pres_task_log_shipping_cfg_t* cfg
+) {
+    if (!cfg ||
+        !cfg->logger ||
+        !cfg->logger->add_callback ||
+        !cfg->logger->remove_callback ||
+        !cfg->publish ||
+        !cfg->publish->send_log_batch ||
+        !cfg->publish->is_connected) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+void pres_task_log_shipping_normalize_cfg(
+    pres_task_log_shipping_cfg_t*       out,
+    const pres_task_log_shipping_cfg_t* cfg
+) {
+    if (!out) {
+        return;
+    }
+
+    memset(out, 0, sizeof(pres_task_log_shipping_cfg_t));
+    if (!cfg) {
+        return;
+    }
+
+    memcpy(out, cfg, sizeof(pres_task_log_shipping_cfg_t));
+
+    if (out->level == DOMAIN_MODELS_LOGGER_LEVEL_NONE) {
+        out->level = DOMAIN_MODELS_LOGGER_LEVEL_INFO;
+    }
+    if (!out->task_name || out->task_name[0] == '\0') {
+        out->task_name = PRES_TASK_LOG_SHIPPING_DEFAULT_TASK_NAME;
+    }
+    if (out->stack_size == 0) {
+        out->stack_size = PRES_TASK_LOG_SHIPPING_DEFAULT_STACK_SIZE;
+    }
+    if (out->priority == 0) {
+        out->priority = PRES_TASK_LOG_SHIPPING_DEFAULT_PRIORITY;
+    }
+    if (out->batch_max_bytes == 0) {
+        out->batch_max_bytes = PRES_TASK_LOG_SHIPPING_DEFAULT_BATCH_MAX_BYTES;
+    }
+    if (out->batch_max_cnt == 0) {
+        out->batch_max_cnt = PRES_TASK_LOG_SHIPPING_DEFAULT_BATCH_MAX_CNT;
+    }
+    if (out->line_max_len == 0) {
+        out->line_max_len = PRES_TASK_LOG_SHIPPING_DEFAULT_LINE_MAX_LEN;
+    }
+    if (out->max_latency_ms == 0) {
+        out->max_latency_ms = PRES_TASK_LOG_SHIPPING_DEFAULT_MAX_LATENCY_MS;
+    }
+}
+
+dom_models_logger_level_t pres_task_log_shipping_parse_level(
+    const char* msg,
+    size_t      msg_len
+) {
+    if (!msg || msg_len == 0) {
+        return DOMAIN_MODELS_LOGGER_LEVEL_NONE;
+    }
+
+    const char* open = memchr(msg, '[', msg_len);
+    if (!open) {
+        return DOMAIN_MODELS_LOGGER_LEVEL_DEBUG;
+    }
+
+    const char* name     = open + 1;
+    size_t      left_len = msg_len - (size_t)(name - msg);
+    const char* close    = memchr(name, ']', left_len);
+    if (!close) {
+        return DOMAIN_MODELS_LOGGER_LEVEL_DEBUG;
+    }
+
+    size_t name_len = (size_t)(close - name);
+    for (int level = DOMAIN_MODELS_LOGGER_LEVEL_ERROR; level <= DOMAIN_MODELS_LOGGER_LEVEL_DEBUG; level++) {
+        const char* level_str = dom_models_logger_level_str((dom_models_logger_level_t)level);
+        if (strlen(level_str) == name_len && memcmp(level_str, name, name_len) == 0) {
+            return (dom_models_logger_level_t)level;
+        }
+    }
+
+    return DOMAIN_MODELS_LOGGER_LEVEL_DEBUG;
+}
+
+bool pres_task_log_shipping_batch_append(
+    pres_task_log_shipping_batch_t* batch,
+    size_t                          record_max_cnt,
+    dom_models_logger_level_t       level,
+    const char*                     msg,
+    size_t                          msg_len,
+    size_t*                         evicted_cnt
+) {
+    if (!batch || !batch->buf || !batch->records || batch->buf_size < batch->head_len + 2 || record_max_cnt == 0 || !msg) {
+        return false;
+    }
+
+    size_t entry_max_len = batch->buf_size - batch->head_len - term_len(batch);
+    if (msg_len > entry_max_len) {
+        /* A cut frame would not decode, only text is shortened */
+        if (batch->binary) {
+            return false;
+        }
+        msg_len = entry_max_len;
+    }
+
+    while (batch->record_cnt >= record_max_cnt || batch->buf_len + msg_len + term_len(batch) > batch->buf_size) {
+        if (batch->record_cnt == 0) {
+            return false;
+        }
+
+        size_t victim = find_victim(batch);
+        if (batch->records[victim].level < level) {
+            return false;
+        }
+
+        remove_record(batch, victim);
+        if (evicted_cnt) {
+            (*evicted_cnt)++;
+        }
+    }
+
+    pres_task_log_shipping_record_t* record = &batch->records[batch->record_cnt];
+
+    record->level  = level;
+    record->offset = batch->buf_len;
+    record->len    = msg_len;
+
+    memcpy(batch->buf + batch->buf_len, msg, msg_len);
+    if (!batch->binary) {
+        batch->buf[batch->buf_len + msg_len] = '\n';
+    }
+    batch->buf_len += msg_len + term_len(batch);
+    batch->record_cnt++;
+
+    return true;
+}
+
+size_t pres_task_log_shipping_encode_head(
+    uint8_t* buf,
+    size_t   buf_size,
+    int64_t  uptime_us,
+    int64_t  unix_ms
+) {
+    if (!buf || buf_size < PRES_TASK_LOG_SHIPPING_BINARY_HEAD_LEN) {
+        return 0;
+    }
+
+    const uint8_t sizes[] = {
+        sizeof(int),
+        sizeof(long),
+        sizeof(long long),
+        sizeof(size_t),
+        sizeof(intmax_t),
+        sizeof(ptrdiff_t),
+        sizeof(void*),
+        sizeof(double),
+        sizeof(long double),
+    };
+    size_t len = 0;
+
+    memcpy(buf + len, PRES_TASK_LOG_SHIPPING_BINARY_MAGIC, 4);
+    len += 4;
+    buf[len++] = PRES_TASK_LOG_SHIPPING_BINARY_VERSION;
+    memcpy(buf + len, sizes, sizeof(sizes));
+    len += sizeof(sizes);
+    memcpy(buf + len, &uptime_us, sizeof(uptime_us));
+    len += sizeof(uptime_us);
+    memcpy(buf + len, &unix_ms, sizeof(unix_ms));
+    len += sizeof(unix_ms);
+
+    return len;
+}
+
+size_t pres_task_log_shipping_encode_record(
+    uint8_t*                          buf,
+    size_t                            buf_size,
+    const dom_models_logger_record_t* record
+) {
+    if (!buf || !record || buf_size < PRES_TASK_LOG_SHIPPING_BINARY_FRAME_LEN) {
+        return 0;
+    }
+
+    size_t args_len = record->args ? record->args_len : 0;
+    size_t args_max = buf_size - PRES_TASK_LOG_SHIPPING_BINARY_FRAME_LEN;
+    if (args_max > UINT16_MAX - (PRES_TASK_LOG_SHIPPING_BINARY_FRAME_LEN - sizeof(uint16_t))) {
+        args_max = UINT16_MAX - (PRES_TASK_LOG_SHIPPING_BINARY_FRAME_LEN - sizeof(uint16_t));
+    }
+    if (args_len > args_max) {
+        args_len = args_max;
+    }
+
+    uint16_t body_len = (uint16_t)(PRES_TASK_LOG_SHIPPING_BINARY_FRAME_LEN - sizeof(uint16_t) + args_len);
+    uint8_t  level    = (uint8_t)record->level;
+    size_t   len      = 0;
+
+    memcpy(buf + len, &body_len, sizeof(body_len));
+    len += sizeof(body_len);
+    buf[len++] = level;
+    memcpy(buf + len, &record->tag, sizeof(record->tag));
+    len += sizeof(record->tag);
+    memcpy(buf + len, &record->format, sizeof(record->format));
+    len += sizeof(record->format);
+    memcpy(buf + len, &record->timestamp_us, sizeof(record->timestamp_us));
+    len += sizeof(record->timestamp_us);
+    if (args_len > 0) {
+        memcpy(buf + len, record->args, args_len);
+        len += args_len;
+    }
+
+    return len;
+}
+
+void pres_task_log_shipping_batch_clear(
+    pres_task_log_shipping_batch_t* batch
+) {
+    if (!batch) {
+        return;
+    }
+
+    batch->buf_len    = batch->head_len;
+    batch->record_cnt = 0;
+    batch->first_us   = 0;
+}
+
+/* Helper Function Implementations */
+
+static size_t find_victim(const pres_task_log_shipping_batch_t* batch) {
+    size_t victim = 0;
+
+    for (size_t i = 1; i < batch->record_cnt; i++) {
+        if (batch->records[i].level > batch->records[victim].level) {
+            victim = i;
+        }
+    }
+
+    return victim;
+}
+
+static void remove_record(pres_task_log_shipping_batch_t* batch, size_t idx) {
+    size_t offset    = batch->records[idx].offset;
+    size_t entry_len = batch->records[idx].len + term_len(batch);
+    size_t tail_len  = batch->buf_len - offset - entry_len;
+
+    memmove(batch->buf + offset, batch->buf + offset + entry_len, tail_len);
+    batch->buf_len -= entry_len;
+
+    for (size_t i = idx + 1; i < batch->record_cnt; i++) {
+        batch->records[i - 1] = batch->records[i];
+        batch->records[i - 1].offset -= entry_len;
+    }
+
+    batch->record_cnt--;
+}
+
+static size_t term_len(const pres_task_log_shipping_batch_t* batch) {
+    return batch->binary ? 0 : 1;
+}
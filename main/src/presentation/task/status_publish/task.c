@@ -0,0 +1,201 @@
+#include "presentation/task/status_publish/task.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "domain/models/error.h"
+#include "domain/models/messaging.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"  // IWYU pragma: keep
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "presentation/task/status_publish/types.h"
+#include "presentation/task/status_publish/utils.h"
+
+/* Task Function Prototypes */
+
+static void task_impl(void* arg);
+
+/* Helper Function Prototypes */
+
+static void sample_once(pres_task_status_publish_t* self);
+
+/* Constructor and Destructor */
+
+pres_task_status_publish_t* pres_task_status_publish_new(
+    const pres_task_status_publish_cfg_t* cfg
+) {
+    dom_models_error_t err = pres_task_status_publish_validate_cfg(cfg);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return NULL;
+    }
+
+    pres_task_status_publish_t* self = (pres_task_status_publish_t*)calloc(1, sizeof(pres_task_status_publish_t));
+    if (!self) {
+        return NULL;
+    }
+
+    pres_task_status_publish_normalize_cfg(&self->cfg, cfg);
+
+    self->lock = xSemaphoreCreateMutex();
+    if (!self->lock) {
+        free(self);
+        return NULL;
+    }
+
+    return self;
+}
+
+void pres_task_status_publish_delete(
+    pres_task_status_publish_t* self
+) {
+    if (!self) {
+        return;
+    }
+
+    (void)pres_task_status_publish_stop(self);
+    vSemaphoreDelete(self->lock);
+    free(self);
+}
+
+/* Public Function Implementations */
+
+dom_models_error_t pres_task_status_publish_start(
+    pres_task_status_publish_t* self
+) {
+    if (!self) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+    if (self->started) {
+        return DOMAIN_MODELS_ERROR_OK;
+    }
+
+    self->stop_requested = false;
+
+    BaseType_t result = xTaskCreate(
+        task_impl,
+        self->cfg.task_name,
+        self->cfg.stack_size,
+        self,
+        self->cfg.priority,
+        &self->task_handle
+    );
+    if (result != pdPASS) {
+        self->task_handle    = NULL;
+        self->stop_requested = false;
+        return DOMAIN_MODELS_ERROR_MALLOC_FAILED;
+    }
+
+    self->started = true;
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+dom_models_error_t pres_task_status_publish_stop(
+    pres_task_status_publish_t* self
+) {
+    if (!self) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+    if (!self->started) {
+        self->task_handle    = NULL;
+        self->stop_requested = false;
+        return DOMAIN_MODELS_ERROR_OK;
+    }
+
+    self->stop_requested = true;
+
+    if (self->task_handle) {
+        /* The task may be inside send_status holding the outbox lock, let it return and exit */
+        xTaskNotifyGive(self->task_handle);
+
+        TickType_t waited_ticks = 0;
+        TickType_t max_ticks    = pdMS_TO_TICKS(PRES_TASK_STATUS_PUBLISH_DEFAULT_STOP_TIMEOUT_MS);
+        while (self->task_handle && waited_ticks < max_ticks) {
+            vTaskDelay(1);
+            waited_ticks++;
+        }
+
+        if (self->task_handle) {
+            TaskHandle_t task_handle = self->task_handle;
+            self->task_handle        = NULL;
+            vTaskDelete(task_handle);
+        }
+    }
+
+    self->started        = false;
+    self->stop_requested = false;
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+dom_models_error_t pres_task_status_publish_get_stats(
+    pres_task_status_publish_t*       self,
+    pres_task_status_publish_stats_t* out
+) {
+    if (!self || !out) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    xSemaphoreTake(self->lock, portMAX_DELAY);
+    *out = self->stats;
+    xSemaphoreGive(self->lock);
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+/* Task Function Implementations */
+
+static void task_impl(void* arg) {
+    pres_task_status_publish_t* self = (pres_task_status_publish_t*)arg;
+    if (!self) {
+        vTaskDelete(NULL);
+        return;
+    }
+
+    while (!self->stop_requested) {
+        sample_once(self);
+        (void)ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(self->cfg.sample_interval_ms));
+    }
+
+    self->task_handle = NULL;
+
+    vTaskDelete(NULL);
+}
+
+/* Helper Function Implementations */
+
+static void sample_once(pres_task_status_publish_t* self) {
+    dom_models_messaging_status_t sample;
+    pres_task_status_publish_collect(self, &sample);
+
+    int64_t                             now_ms   = esp_timer_get_time() / 1000;
+    pres_task_status_publish_decision_t decision = pres_task_status_publish_delta_evaluate(
+        &self->delta,
+        &sample,
+        now_ms,
+        self->cfg.debounce_ms,
+        self->cfg.heartbeat_ms
+    );
+
+    dom_models_error_t err = DOMAIN_MODELS_ERROR_OK;
+    if (decision != PRES_TASK_STATUS_PUBLISH_DECISION_SKIP) {
+        err = self->cfg.publish->send_status(self->cfg.publish, &sample);
+        if (err == DOMAIN_MODELS_ERROR_OK) {
+            pres_task_status_publish_delta_commit(&self->delta, &sample, now_ms);
+        }
+    }
+
+    xSemaphoreTake(self->lock, portMAX_DELAY);
+    self->stats.sample_cnt++;
+    if (decision == PRES_TASK_STATUS_PUBLISH_DECISION_SKIP) {
+        self->stats.saved_cnt++;
+    } else if (err != DOMAIN_MODELS_ERROR_OK) {
+        self->stats.failed_cnt++;
+    } else if (decision == PRES_TASK_STATUS_PUBLISH_DECISION_CHANGE) {
+        self->stats.change_publish_cnt++;
+    } else {
+        self->stats.heartbeat_publish_cnt++;
+    }
+    xSemaphoreGive(self->lock);
+}
@@ -0,0 +1,186 @@
+#include "presentation/task/status_publish/utils.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "domain/models/error.h"
+#include "presentation/task/status_publish/types.h"
+
+#define RSSI_EXCELLENT_MIN (-55)
+#define RSSI_GOOD_MIN      (-67)
+#define RSSI_FAIR_MIN      (-75)
+
+dom_models_error_t pres_task_status_publish_validate_cfg(
+    const pres_task_status_publish_cfg_t* cfg
+) {
+    if (!cfg || !cfg->publish || !cfg->publish->send_status) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+void pres_task_status_publish_normalize_cfg(
+    pres_task_status_publish_cfg_t*       out,
+    const pres_task_status_publish_cfg_t* cfg
+) {
+    if (!out) {
+        return;
+    }
+
+    memset(out, 0, sizeof(pres_task_status_publish_cfg_t));
+    if (!cfg) {
+        return;
+    }
+
+    memcpy(out, cfg, sizeof(pres_task_status_publish_cfg_t));
+
+    if (!out->task_name || out->task_name[0] == '\0') {
+        out->task_name = PRES_TASK_STATUS_PUBLISH_DEFAULT_TASK_NAME;
+    }
+    if (out->stack_size == 0) {
+        out->stack_size = PRES_TASK_STATUS_PUBLISH_DEFAULT_STACK_SIZE;
+    }
+    if (out->priority == 0) {
+        out->priority = PRES_TASK_STATUS_PUBLISH_DEFAULT_PRIORITY;
+    }
+    if (out->sample_interval_ms == 0) {
+        out->sample_interval_ms = PRES_TASK_STATUS_PUBLISH_DEFAULT_SAMPLE_INTERVAL_MS;
+    }
+    if (out->heartbeat_ms == 0) {
+        out->heartbeat_ms = PRES_TASK_STATUS_PUBLISH_DEFAULT_HEARTBEAT_MS;
+    }
+}
+
+uint8_t pres_task_status_publish_rssi_bucket(
+    bool   connected,
+    int8_t rssi
+) {
+    if (!connected) {
+        return 0;
+    }
+    if (rssi >= RSSI_EXCELLENT_MIN) {
+        return 4;
+    }
+    if (rssi >= RSSI_GOOD_MIN) {
+        return 3;
+    }
+    if (rssi >= RSSI_FAIR_MIN) {
+        return 2;
+    }
+
+    return 1;
+}
+
+void pres_task_status_publish_collect(
+    pres_task_status_publish_t*    self,
+    dom_models_messaging_status_t* out
+) {
+    if (!self || !out) {
+        return;
+    }
+
+    memset(out, 0, sizeof(dom_models_messaging_status_t));
+    strncpy(out->status, PRES_TASK_STATUS_PUBLISH_DEFAULT_STATUS, sizeof(out->status) - 1);
+
+    const dom_models_network_interface_t* ip_source = NULL;
+
+    dom_usecases_wifiman_t* wifiman = self->cfg.wifiman;
+    if (wifiman && wifiman->get_status &&
+        wifiman->get_status(wifiman, &self->wifiman_status) == DOMAIN_MODELS_ERROR_OK) {
+        const dom_models_wifi_status_t* wifi = &self->wifiman_status.wifi;
+
+        out->wifi_connected = wifi->connected;
+        out->rssi_bucket    = pres_task_status_publish_rssi_bucket(
+            wifi->connected && wifi->connected_ap_available,
+            wifi->connected_ap.rssi
+        );
+        if (wifi->connected && self->wifiman_status.sta_netif_available) {
+            ip_source = &self->wifiman_status.sta_netif;
+        }
+    }
+
+    dom_usecases_netif_t* netif = self->cfg.netif;
+    if (netif && netif->get_ethernet &&
+        netif->get_ethernet(netif, &self->ethernet) == DOMAIN_MODELS_ERROR_OK) {
+        out->ethernet_connected = self->ethernet.is_up;
+        if (self->ethernet.is_up && (!ip_source || self->ethernet.is_default)) {
+            ip_source = &self->ethernet;
+        }
+    }
+
+    if (ip_source && ip_source->ipv4.available) {
+        const uint8_t* ip = ip_source->ipv4.ip;
+        snprintf(out->ip, sizeof(out->ip), "%u.%u.%u.%u", ip[0], ip[1], ip[2], ip[3]);
+    }
+
+    dom_usecases_ota_t*       ota        = self->cfg.ota;
+    dom_usecases_ota_status_t ota_status = {0};
+    if (ota && ota->get_status && ota->get_status(ota, &ota_status) == DOMAIN_MODELS_ERROR_OK) {
+        out->ota_updating = ota_status.updating;
+    }
+}
+
+bool pres_task_status_publish_status_equal(
+    const dom_models_messaging_status_t* a,
+    const dom_models_messaging_status_t* b
+) {
+    if (!a || !b) {
+        return false;
+    }
+
+    return a->wifi_connected == b->wifi_connected &&
+           a->ethernet_connected == b->ethernet_connected &&
+           a->rssi_bucket == b->rssi_bucket &&
+           a->ota_updating == b->ota_updating &&
+           strncmp(a->status, b->status, sizeof(a->status)) == 0 &&
+           strncmp(a->ip, b->ip, sizeof(a->ip)) == 0;
+}
+
+pres_task_status_publish_decision_t pres_task_status_publish_delta_evaluate(
+    pres_task_status_publish_delta_t*    delta,
+    const dom_models_messaging_status_t* sample,
+    int64_t                              now_ms,
+    uint32_t                             debounce_ms,
+    uint32_t                             heartbeat_ms
+) {
+    if (!delta || !sample) {
+        return PRES_TASK_STATUS_PUBLISH_DECISION_SKIP;
+    }
+    if (!delta->published) {
+        return PRES_TASK_STATUS_PUBLISH_DECISION_CHANGE;
+    }
+
+    if (!pres_task_status_publish_status_equal(&delta->last, sample)) {
+        if (!delta->pending) {
+            delta->pending          = true;
+            delta->pending_since_ms = now_ms;
+        }
+
+        return now_ms - delta->pending_since_ms >= (int64_t)debounce_ms
+                   ? PRES_TASK_STATUS_PUBLISH_DECISION_CHANGE
+                   : PRES_TASK_STATUS_PUBLISH_DECISION_SKIP;
+    }
+
+    /* Flapped back to the published state inside the window */
+    delta->pending = false;
+
+    return now_ms - delta->last_publish_ms >= (int64_t)heartbeat_ms
+               ? PRES_TASK_STATUS_PUBLISH_DECISION_HEARTBEAT
+               : PRES_TASK_STATUS_PUBLISH_DECISION_SKIP;
+}
+
+void pres_task_status_publish_delta_commit(
+    pres_task_status_publish_delta_t*    delta,
+    const dom_models_messaging_status_t* sample,
+    int64_t                              now_ms
+) {
+    if (!delta || !sample) {
+        return;
+    }
+
+    memcpy(&delta->last, sample, sizeof(dom_models_messaging_status_t));
+    delta->published       = true;
+    delta->last_publish_ms = now_ms;
+    delta->pending         = false;
+}
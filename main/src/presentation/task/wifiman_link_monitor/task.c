@@ -0,0 +1,135 @@
+#include "presentation/task/wifiman_link_monitor/task.h"
+
+#include <stdlib.h>
+
+#include "domain/models/error.h"
+#include "freertos/FreeRTOS.h"  // IWYU pragma: keep
+#include "freertos/task.h"
+#include "presentation/task/wifiman_link_monitor/types.h"
+#include "presentation/task/wifiman_link_monitor/utils.h"
+
+/* Task Function Prototypes */
+
+static void task_impl(void* arg);
+
+/* Constructor and Destructor */
+
+pres_task_wifiman_link_monitor_t* pres_task_wifiman_link_monitor_new(
+    const pres_task_wifiman_link_monitor_cfg_t* cfg
+) {
+    dom_models_error_t err = pres_task_wifiman_link_monitor_validate_cfg(cfg);
+    if (err != DOMAIN_MODELS_ERROR_OK) {
+        return NULL;
+    }
+
+    pres_task_wifiman_link_monitor_t* self = (pres_task_wifiman_link_monitor_t*)calloc(1, sizeof(pres_task_wifiman_link_monitor_t));
+    if (!self) {
+        return NULL;
+    }
+
+    pres_task_wifiman_link_monitor_normalize_cfg(&self->cfg, cfg);
+
+    return self;
+}
+
+void pres_task_wifiman_link_monitor_delete(
+    pres_task_wifiman_link_monitor_t* self
+) {
+    if (!self) {
+        return;
+    }
+
+    (void)pres_task_wifiman_link_monitor_stop(self);
+    free(self);
+}
+
+/* Public Function Implementations */
+
+dom_models_error_t pres_task_wifiman_link_monitor_start(
+    pres_task_wifiman_link_monitor_t* self
+) {
+    if (!self) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+    if (self->started) {
+        return DOMAIN_MODELS_ERROR_OK;
+    }
+
+    self->stop_requested = false;
+
+    BaseType_t result = xTaskCreate(
+        task_impl,
+        self->cfg.task_name,
+        self->cfg.stack_size,
+        self,
+        self->cfg.priority,
+        &self->task_handle
+    );
+    if (result != pdPASS) {
+        self->task_handle    = NULL;
+        self->stop_requested = false;
+        return DOMAIN_MODELS_ERROR_MALLOC_FAILED;
+    }
+
+    self->started = true;
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+dom_models_error_t pres_task_wifiman_link_monitor_stop(
+    pres_task_wifiman_link_monitor_t* self
+) {
+    if (!self) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+    if (!self->started) {
+        self->task_handle    = NULL;
+        self->stop_requested = false;
+        return DOMAIN_MODELS_ERROR_OK;
+    }
+
+    self->stop_requested = true;
+
+    if (self->task_handle) {
+        /* The task may be inside monitor_link holding the wifiman lock mid-roam, let it return and exit */
+        xTaskNotifyGive(self->task_handle);
+
+        TickType_t waited_ticks = 0;
+        TickType_t max_ticks    = pdMS_TO_TICKS(PRES_TASK_WIFIMAN_LINK_MONITOR_DEFAULT_STOP_TIMEOUT_MS);
+        while (self->task_handle && waited_ticks < max_ticks) {
+            vTaskDelay(1);
+            waited_ticks++;
+        }
+
+        if (self->task_handle) {
+            TaskHandle_t task_handle = self->task_handle;
+            self->task_handle        = NULL;
+            vTaskDelete(task_handle);
+        }
+    }
+
+    self->started        = false;
+    self->stop_requested = false;
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+/* Task Function Implementations */
+
+static void task_impl(void* arg) {
+    pres_task_wifiman_link_monitor_t* self = (pres_task_wifiman_link_monitor_t*)arg;
+    if (!self) {
+        vTaskDelete(NULL);
+        return;
+    }
+
+    /* Wifiman logs its own failures, a failed sample is simply taken again next period */
+    while (!self->stop_requested) {
+        (void)self->cfg.wifiman->monitor_link(self->cfg.wifiman);
+        (void)ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(self->cfg.sample_interval_ms));
+    }
+
+    self->task_handle = NULL;
+
+    vTaskDelete(NULL);
+}
@@ -0,0 +1,45 @@
+#include "presentation/task/wifiman_link_monitor/utils.h"
+
+#include <string.h>
+
+#include "domain/models/error.h"
+#include "presentation/task/wifiman_link_monitor/types.h"
+
+dom_models_error_t pres_task_wifiman_link_monitor_validate_cfg(
+    const pres_task_wifiman_link_monitor_cfg_t* cfg
+) {
+    if (!cfg || !cfg->wifiman || !cfg->wifiman->monitor_link) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+void pres_task_wifiman_link_monitor_normalize_cfg(
+    pres_task_wifiman_link_monitor_cfg_t*       out,
+    const pres_task_wifiman_link_monitor_cfg_t* cfg
+) {
+    if (!out) {
+        return;
+    }
+
+    memset(out, 0, sizeof(pres_task_wifiman_link_monitor_cfg_t));
+    if (!cfg) {
+        return;
+    }
+
+    memcpy(out, cfg, sizeof(pres_task_wifiman_link_monitor_cfg_t));
+
+    if (!out->task_name || out->task_name[0] == '\0') {
+        out->task_name = PRES_TASK_WIFIMAN_LINK_MONITOR_DEFAULT_TASK_NAME;
+    }
+    if (out->stack_size == 0) {
+        out->stack_size = PRES_TASK_WIFIMAN_LINK_MONITOR_DEFAULT_STACK_SIZE;
+    }
+    if (out->priority == 0) {
+        out->priority = PRES_TASK_WIFIMAN_LINK_MONITOR_DEFAULT_PRIORITY;
+    }
+    if (out->sample_interval_ms == 0) {
+        out->sample_interval_ms = PRES_TASK_WIFIMAN_LINK_MONITOR_DEFAULT_SAMPLE_INTERVAL_MS;
+    }
+}
@@ -0,0 +1,121 @@
+#include "presentation/task/wifiman_sta_reconnect/backoff.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Helper Function Prototypes */
+
+static uint32_t delay_ms(
+    pres_task_wifiman_sta_reconnect_backoff_t*           backoff,
+    const pres_task_wifiman_sta_reconnect_backoff_cfg_t* cfg,
+    uint32_t                                             attempt_cnt
+);
+static uint32_t next_rand(pres_task_wifiman_sta_reconnect_backoff_t* backoff);
+
+/* Public Function Implementations */
+
+void pres_task_wifiman_sta_reconnect_backoff_init(
+    pres_task_wifiman_sta_reconnect_backoff_t* backoff,
+    uint32_t                                   seed
+) {
+    if (!backoff) {
+        return;
+    }
+
+    backoff->pending     = false;
+    backoff->attempt_cnt = 0;
+    backoff->due_ms      = 0;
+    /* Xorshift never leaves the all zero state */
+    backoff->rng = seed != 0 ? seed : 0x9e3779b9u;
+}
+
+void pres_task_wifiman_sta_reconnect_backoff_on_disconnected(
+    pres_task_wifiman_sta_reconnect_backoff_t*           backoff,
+    const pres_task_wifiman_sta_reconnect_backoff_cfg_t* cfg,
+    int64_t                                              now_ms
+) {
+    if (!backoff || !cfg || backoff->pending) {
+        return;
+    }
+
+    backoff->pending     = true;
+    backoff->attempt_cnt = 0;
+    backoff->due_ms      = now_ms + delay_ms(backoff, cfg, 0);
+}
+
+void pres_task_wifiman_sta_reconnect_backoff_on_connected(
+    pres_task_wifiman_sta_reconnect_backoff_t* backoff
+) {
+    if (!backoff) {
+        return;
+    }
+
+    backoff->pending     = false;
+    backoff->attempt_cnt = 0;
+    backoff->due_ms      = 0;
+}
+
+void pres_task_wifiman_sta_reconnect_backoff_on_attempt(
+    pres_task_wifiman_sta_reconnect_backoff_t*           backoff,
+    const pres_task_wifiman_sta_reconnect_backoff_cfg_t* cfg,
+    int64_t                                              now_ms
+) {
+    if (!backoff || !cfg) {
+        return;
+    }
+
+    if (backoff->attempt_cnt < UINT32_MAX) {
+        backoff->attempt_cnt++;
+    }
+    backoff->pending = true;
+    backoff->due_ms  = now_ms + delay_ms(backoff, cfg, backoff->attempt_cnt);
+}
+
+int64_t pres_task_wifiman_sta_reconnect_backoff_wait_ms(
+    const pres_task_wifiman_sta_reconnect_backoff_t* backoff,
+    int64_t                                          now_ms
+) {
+    if (!backoff || !backoff->pending) {
+        return -1;
+    }
+    if (backoff->due_ms <= now_ms) {
+        return 0;
+    }
+
+    return backoff->due_ms - now_ms;
+}
+
+/* Helper Function Implementations */
+
+static uint32_t delay_ms(
+    pres_task_wifiman_sta_reconnect_backoff_t*           backoff,
+    const pres_task_wifiman_sta_reconnect_backoff_cfg_t* cfg,
+    uint32_t                                             attempt_cnt
+) {
+    uint64_t delay = cfg->base_ms;
+    for (uint32_t i = 0; i < attempt_cnt && delay < cfg->max_ms; i++) {
+        delay <<= 1;
+    }
+    if (delay > cfg->max_ms) {
+        delay = cfg->max_ms;
+    }
+
+    /* Jitter only shortens the delay, so max_ms stays a hard cap */
+    uint32_t pct  = cfg->jitter_pct > 100 ? 100 : cfg->jitter_pct;
+    uint64_t span = delay * pct / 100;
+    if (span == 0) {
+        return (uint32_t)delay;
+    }
+
+    return (uint32_t)(delay - span + next_rand(backoff) % (span + 1));
+}
+
+static uint32_t next_rand(pres_task_wifiman_sta_reconnect_backoff_t* backoff) {
+    uint32_t x = backoff->rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    backoff->rng = x;
+
+    return x;
+}
@@ -1,13 +1,22 @@
 #include "presentation/task/wifiman_sta_reconnect/task.h"
 
+#include <stdint.h>
 #include <stdlib.h>
 
 #include "domain/models/error.h"
+#include "domain/models/wifi.h"
+#include "esp_random.h"
 #include "freertos/FreeRTOS.h"  // IWYU pragma: keep
 #include "freertos/task.h"
+#include "presentation/task/wifiman_sta_reconnect/backoff.h"
 #include "presentation/task/wifiman_sta_reconnect/types.h"
 #include "presentation/task/wifiman_sta_reconnect/utils.h"
 
+/* Helper Function Prototypes */
+
+static int64_t uptime_ms(pres_task_wifiman_sta_reconnect_t* self);
+static void attempt(pres_task_wifiman_sta_reconnect_t* self, int64_t now_ms);
+
 /* Task Function Prototypes */
 
 static void task_impl(void* arg);
@@ -29,6 +38,10 @@ pres_task_wifiman_sta_reconnect_t* pres_task_wifiman_sta_reconnect_new(
 
     pres_task_wifiman_sta_reconnect_normalize_cfg(&self->cfg, cfg);
 
+    self->backoff_cfg.base_ms    = self->cfg.backoff_base_ms;
+    self->backoff_cfg.max_ms     = self->cfg.backoff_max_ms;
+    self->backoff_cfg.jitter_pct = self->cfg.jitter_pct;
+
     return self;
 }
 
@@ -57,6 +70,9 @@ dom_models_error_t pres_task_wifiman_sta_reconnect_start(
 
     self->stop_requested = false;
 
+    /* Seeded per device so a fleet dropped by one AP does not retry in step */
+    pres_task_wifiman_sta_reconnect_backoff_init(&self->backoff, esp_random());
+
     BaseType_t result = xTaskCreate(
         task_impl,
         self->cfg.task_name,
@@ -91,19 +107,79 @@ dom_models_error_t pres_task_wifiman_sta_reconnect_stop(
     self->stop_requested = true;
 
     if (self->task_handle) {
-        TaskHandle_t task_handle = self->task_handle;
-        self->task_handle        = NULL;
-        self->started            = false;
-        vTaskDelete(task_handle);
-    } else {
-        self->started = false;
+        /* The task may be inside try_reconnect holding the wifiman lock, let it return and exit */
+        (void)xTaskNotify(self->task_handle, PRES_TASK_WIFIMAN_STA_RECONNECT_NOTIFY_STOP, eSetBits);
+
+        TickType_t waited_ticks = 0;
+        TickType_t max_ticks    = pdMS_TO_TICKS(PRES_TASK_WIFIMAN_STA_RECONNECT_DEFAULT_STOP_TIMEOUT_MS);
+        while (self->task_handle && waited_ticks < max_ticks) {
+            vTaskDelay(1);
+            waited_ticks++;
+        }
+
+        if (self->task_handle) {
+            TaskHandle_t task_handle = self->task_handle;
+            self->task_handle        = NULL;
+            vTaskDelete(task_handle);
+        }
     }
 
+    self->started        = false;
     self->stop_requested = false;
 
     return DOMAIN_MODELS_ERROR_OK;
 }
 
+void pres_task_wifiman_sta_reconnect_on_wifi_event(
+    void*                          cb_ctx,
+    const dom_models_wifi_event_t* event
+) {
+    pres_task_wifiman_sta_reconnect_t* self = (pres_task_wifiman_sta_reconnect_t*)cb_ctx;
+    if (!self || !event) {
+        return;
+    }
+
+    uint32_t bits = 0;
+    switch (event->type) {
+        case DOM_MODELS_WIFI_EVENT_STA_CONNECTED:
+            bits = PRES_TASK_WIFIMAN_STA_RECONNECT_NOTIFY_CONNECTED;
+            break;
+        case DOM_MODELS_WIFI_EVENT_STA_DISCONNECTED:
+            bits = PRES_TASK_WIFIMAN_STA_RECONNECT_NOTIFY_DISCONNECTED;
+            break;
+        default:
+            return;
+    }
+
+    TaskHandle_t task_handle = self->task_handle;
+    if (task_handle) {
+        (void)xTaskNotify(task_handle, bits, eSetBits);
+    }
+}
+
+/* Helper Function Implementations */
+
+static int64_t uptime_ms(pres_task_wifiman_sta_reconnect_t* self) {
+    int64_t now_ms = 0;
+    if (self->cfg.clock->get_uptime_ms(self->cfg.clock, &now_ms) != DOMAIN_MODELS_ERROR_OK) {
+        now_ms = (int64_t)xTaskGetTickCount() * portTICK_PERIOD_MS;
+    }
+
+    return now_ms;
+}
+
+static void attempt(pres_task_wifiman_sta_reconnect_t* self, int64_t now_ms) {
+    bool               attempted = false;
+    dom_models_error_t err       = self->cfg.wifiman->try_reconnect(self->cfg.wifiman, &attempted);
+    if (err == DOMAIN_MODELS_ERROR_OK && !attempted) {
+        /* Connected, disabled or nothing stored, sleep until the next DISCONNECTED notification */
+        pres_task_wifiman_sta_reconnect_backoff_on_connected(&self->backoff);
+        return;
+    }
+
+    pres_task_wifiman_sta_reconnect_backoff_on_attempt(&self->backoff, &self->backoff_cfg, now_ms);
+}
+
 /* Task Function Implementations */
 
 static void task_impl(void* arg) {
@@ -113,19 +189,39 @@ static void task_impl(void* arg) {
         return;
     }
 
+    /* The link may have dropped before the callback was registered, so look once */
+    pres_task_wifiman_sta_reconnect_backoff_on_disconnected(&self->backoff, &self->backoff_cfg, uptime_ms(self));
+
     while (!self->stop_requested) {
-        bool               needed = false;
-        dom_models_error_t err    = self->cfg.wifiman->need_reconnect(self->cfg.wifiman, &needed);
-        if (err == DOMAIN_MODELS_ERROR_OK && needed) {
-            bool attempted = false;
-            (void)self->cfg.wifiman->try_reconnect(self->cfg.wifiman, &attempted);
+        int64_t    wait_ms = pres_task_wifiman_sta_reconnect_backoff_wait_ms(&self->backoff, uptime_ms(self));
+        TickType_t ticks   = portMAX_DELAY;
+        if (wait_ms >= 0) {
+            ticks = pdMS_TO_TICKS(wait_ms);
+            if (ticks == 0 && wait_ms > 0) {
+                ticks = 1;
+            }
+        }
+
+        uint32_t bits = 0;
+        (void)xTaskNotifyWait(0, UINT32_MAX, &bits, ticks);
+        if (self->stop_requested) {
+            break;
         }
 
-        vTaskDelay(pdMS_TO_TICKS(self->cfg.interval_ms));
+        int64_t now_ms = uptime_ms(self);
+        if (bits & PRES_TASK_WIFIMAN_STA_RECONNECT_NOTIFY_CONNECTED) {
+            pres_task_wifiman_sta_reconnect_backoff_on_connected(&self->backoff);
+        }
+        if (bits & PRES_TASK_WIFIMAN_STA_RECONNECT_NOTIFY_DISCONNECTED) {
+            pres_task_wifiman_sta_reconnect_backoff_on_disconnected(&self->backoff, &self->backoff_cfg, now_ms);
+        }
+
+        if (pres_task_wifiman_sta_reconnect_backoff_wait_ms(&self->backoff, now_ms) == 0) {
+            attempt(self, now_ms);
+        }
     }
 
     self->task_handle = NULL;
-    self->started     = false;
 
     vTaskDelete(NULL);
 }
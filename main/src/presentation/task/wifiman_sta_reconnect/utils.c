@@ -11,7 +11,9 @@ dom_models_error_t pres_task_wifiman_sta_reconnect_validate_cfg(
     if (!cfg ||
         !cfg->wifiman ||
         !cfg->wifiman->need_reconnect ||
-        !cfg->wifiman->try_reconnect) {
+        !cfg->wifiman->try_reconnect ||
+        !cfg->clock ||
+        !cfg->clock->get_uptime_ms) {
         return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
     }
 
@@ -42,7 +44,16 @@ void pres_task_wifiman_sta_reconnect_normalize_cfg(
     if (out->priority == 0) {
         out->priority = PRES_TASK_WIFIMAN_STA_RECONNECT_DEFAULT_PRIORITY;
     }
-    if (out->interval_ms == 0) {
-        out->interval_ms = PRES_TASK_WIFIMAN_STA_RECONNECT_DEFAULT_INTERVAL_MS;
+    if (out->backoff_base_ms == 0) {
+        out->backoff_base_ms = PRES_TASK_WIFIMAN_STA_RECONNECT_DEFAULT_BACKOFF_BASE_MS;
+    }
+    if (out->backoff_max_ms == 0) {
+        out->backoff_max_ms = PRES_TASK_WIFIMAN_STA_RECONNECT_DEFAULT_BACKOFF_MAX_MS;
+    }
+    if (out->backoff_max_ms < out->backoff_base_ms) {
+        out->backoff_max_ms = out->backoff_base_ms;
+    }
+    if (out->jitter_pct > 100) {
+        out->jitter_pct = 100;
     }
 }
@@ -0,0 +1,563 @@
+#include "utils/json/reader.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define NUMBER_MAX_LEN 63
+
+typedef enum {
+    EXPECT_VALUE,
+    EXPECT_VALUE_OR_END,
+    EXPECT_KEY,
+    EXPECT_KEY_OR_END,
+    EXPECT_COLON,
+    EXPECT_COMMA_OR_END,
+} expect_t;
+
+/* Helper Function Prototypes */
+
+static size_t skip_whitespace(const char* json, size_t json_len, size_t pos);
+static bool push_token(utils_json_reader_t* r, utils_json_reader_type_t type, size_t start, size_t end, bool escaped);
+static bool close_container(utils_json_reader_t* r, int open[2], size_t* depth, size_t* pos);
+static bool scan_string(const char* json, size_t json_len, size_t pos, size_t* end, bool* escaped);
+static bool scan_number(const char* json, size_t json_len, size_t pos, size_t* end, double* value);
+static bool number_char(char c);
+static uint32_t read_hex4(const char* s);
+static size_t next_sequence(const char* s, const char* end, unsigned char utf8[4], size_t* utf8_len);
+static bool key_equals(const utils_json_reader_t* r, const utils_json_reader_token_t* token, const char* key);
+static const utils_json_reader_token_t* token_at(const utils_json_reader_t* r, int token);
+
+void utils_json_reader_reset(utils_json_reader_t* r) {
+    if (!r) {
+        return;
+    }
+
+    r->json      = NULL;
+    r->json_len  = 0;
+    r->token_cnt = 0;
+}
+
+bool utils_json_reader_parse(
+    utils_json_reader_t* r,
+    const char*          json,
+    size_t               json_len
+) {
+    if (!r) {
+        return false;
+    }
+
+    utils_json_reader_reset(r);
+    if (!json || json_len == 0 || json_len > UINT16_MAX) {
+        return false;
+    }
+
+    r->json     = json;
+    r->json_len = json_len;
+
+    /* One bit per open container, set for objects */
+    uint32_t is_object = 0;
+    int      open[2]   = {UTILS_JSON_READER_NONE, UTILS_JSON_READER_NONE};
+    size_t   depth     = 0;
+    expect_t expect    = EXPECT_VALUE;
+    size_t   pos       = 0;
+
+    if (json_len > 4 && memcmp(json, "\xEF\xBB\xBF", 3) == 0) {
+        pos = 3;
+    }
+
+    while (true) {
+        pos = skip_whitespace(json, json_len, pos);
+        if (pos >= json_len) {
+            break;
+        }
+
+        char c         = json[pos];
+        bool in_object = depth > 0 && (is_object & (1u << (depth - 1)));
+        bool keep      = depth == 0 || (depth == 1 && in_object);
+
+        if (expect == EXPECT_KEY_OR_END || expect == EXPECT_VALUE_OR_END) {
+            if (c == (in_object ? '}' : ']')) {
+                if (close_container(r, open, &depth, &pos)) {
+                    return true;
+                }
+                expect = EXPECT_COMMA_OR_END;
+                continue;
+            }
+            expect = expect == EXPECT_KEY_OR_END ? EXPECT_KEY : EXPECT_VALUE;
+        }
+
+        if (expect == EXPECT_KEY) {
+            size_t end     = 0;
+            bool   escaped = false;
+            if (c != '"' || !scan_string(json, json_len, pos, &end, &escaped)) {
+                break;
+            }
+            if (depth == 1 && !push_token(r, UTILS_JSON_READER_TYPE_STRING, pos + 1, end, escaped)) {
+                break;
+            }
+
+            pos    = end + 1;
+            expect = EXPECT_COLON;
+            continue;
+        }
+
+        if (expect == EXPECT_COLON) {
+            if (c != ':') {
+                break;
+            }
+
+            pos++;
+            expect = EXPECT_VALUE;
+            continue;
+        }
+
+        if (expect == EXPECT_COMMA_OR_END) {
+            if (c == ',') {
+                pos++;
+                expect = in_object ? EXPECT_KEY : EXPECT_VALUE;
+                continue;
+            }
+            if (c == (in_object ? '}' : ']')) {
+                if (close_container(r, open, &depth, &pos)) {
+                    return true;
+                }
+                continue;
+            }
+            break;
+        }
+
+        /* EXPECT_VALUE */
+        if (c == '{' || c == '[') {
+            if (depth >= UTILS_JSON_READER_DEPTH_MAX) {
+                break;
+            }
+            if (keep) {
+                if (!push_token(r, c == '{' ? UTILS_JSON_READER_TYPE_OBJECT : UTILS_JSON_READER_TYPE_ARRAY, pos, pos, false)) {
+                    break;
+                }
+                open[depth] = (int)r->token_cnt - 1;
+            }
+            if (c == '{') {
+                is_object |= 1u << depth;
+            } else {
+                is_object &= ~(1u << depth);
+            }
+
+            depth++;
+            pos++;
+            expect = c == '{' ? EXPECT_KEY_OR_END : EXPECT_VALUE_OR_END;
+            continue;
+        }
+
+        utils_json_reader_type_t type    = UTILS_JSON_READER_TYPE_UNDEFINED;
+        size_t                   start   = pos;
+        size_t                   end     = pos;
+        bool                     escaped = false;
+        double                   number  = 0.0;
+
+        if (json_len - pos >= 4 && memcmp(json + pos, "null", 4) == 0) {
+            type = UTILS_JSON_READER_TYPE_NULL;
+            end  = pos + 4;
+        } else if (json_len - pos >= 5 && memcmp(json + pos, "false", 5) == 0) {
+            type = UTILS_JSON_READER_TYPE_BOOL;
+            end  = pos + 5;
+        } else if (json_len - pos >= 4 && memcmp(json + pos, "true", 4) == 0) {
+            type = UTILS_JSON_READER_TYPE_BOOL;
+            end  = pos + 4;
+        } else if (c == '"') {
+            if (!scan_string(json, json_len, pos, &end, &escaped)) {
+                break;
+            }
+            type  = UTILS_JSON_READER_TYPE_STRING;
+            start = pos + 1;
+        } else if (c == '-' || (c >= '0' && c <= '9')) {
+            if (!scan_number(json, json_len, pos, &end, &number)) {
+                break;
+            }
+            type = UTILS_JSON_READER_TYPE_NUMBER;
+        } else {
+            break;
+        }
+
+        if (keep && !push_token(r, type, start, end, escaped)) {
+            break;
+        }
+
+        pos = type == UTILS_JSON_READER_TYPE_STRING ? end + 1 : end;
+        if (depth == 0) {
+            return true;
+        }
+        expect = EXPECT_COMMA_OR_END;
+    }
+
+    utils_json_reader_reset(r);
+
+    return false;
+}
+
+bool utils_json_reader_empty(const utils_json_reader_t* r) {
+    return !r || r->token_cnt == 0;
+}
+
+bool utils_json_reader_is_object(const utils_json_reader_t* r) {
+    return utils_json_reader_type(r, 0) == UTILS_JSON_READER_TYPE_OBJECT;
+}
+
+int utils_json_reader_find(
+    const utils_json_reader_t* r,
+    const char*                key
+) {
+    if (!key || !utils_json_reader_is_object(r)) {
+        return UTILS_JSON_READER_NONE;
+    }
+
+    for (size_t i = 1; i + 1 < r->token_cnt; i += 2) {
+        if (key_equals(r, &r->tokens[i], key)) {
+            return (int)(i + 1);
+        }
+    }
+
+    return UTILS_JSON_READER_NONE;
+}
+
+utils_json_reader_type_t utils_json_reader_type(
+    const utils_json_reader_t* r,
+    int                        token
+) {
+    const utils_json_reader_token_t* entry = token_at(r, token);
+
+    return entry ? (utils_json_reader_type_t)entry->type : UTILS_JSON_READER_TYPE_UNDEFINED;
+}
+
+bool utils_json_reader_get_string(
+    const utils_json_reader_t* r,
+    int                        token,
+    char*                      out,
+    size_t                     out_size
+) {
+    const utils_json_reader_token_t* entry = token_at(r, token);
+    if (!entry || entry->type != UTILS_JSON_READER_TYPE_STRING || !out || out_size == 0) {
+        return false;
+    }
+
+    const char* s   = r->json + entry->start;
+    const char* end = r->json + entry->end;
+
+    if (!entry->escaped) {
+        const char* nul = memchr(s, '\0', (size_t)(end - s));
+        size_t      len = (size_t)((nul ? nul : end) - s);
+        if (len >= out_size) {
+            return false;
+        }
+
+        memcpy(out, s, len);
+        out[len] = '\0';
+
+        return true;
+    }
+
+    size_t len = 0;
+    while (s < end) {
+        unsigned char utf8[4];
+        size_t        utf8_len = 0;
+        s += next_sequence(s, end, utf8, &utf8_len);
+
+        for (size_t i = 0; i < utf8_len; i++) {
+            if (utf8[i] == '\0') {
+                out[len] = '\0';
+                return true;
+            }
+            if (len + 1 >= out_size) {
+                return false;
+            }
+            out[len++] = (char)utf8[i];
+        }
+    }
+    out[len] = '\0';
+
+    return true;
+}
+
+bool utils_json_reader_get_number(
+    const utils_json_reader_t* r,
+    int                        token,
+    double*                    out
+) {
+    const utils_json_reader_token_t* entry = token_at(r, token);
+    if (!entry || entry->type != UTILS_JSON_READER_TYPE_NUMBER || !out) {
+        return false;
+    }
+
+    size_t end = 0;
+
+    return scan_number(r->json, entry->end, entry->start, &end, out);
+}
+
+bool utils_json_reader_get_bool(
+    const utils_json_reader_t* r,
+    int                        token,
+    bool*                      out
+) {
+    const utils_json_reader_token_t* entry = token_at(r, token);
+    if (!entry || entry->type != UTILS_JSON_READER_TYPE_BOOL || !out) {
+        return false;
+    }
+
+    *out = r->json[entry->start] == 't';
+
+    return true;
+}
+
+/* Helper Function Implementations */
+
+static size_t skip_whitespace(const char* json, size_t json_len, size_t pos) {
+    while (pos < json_len && (unsigned char)json[pos] <= 0x20) {
+        pos++;
+    }
+
+    return pos;
+}
+
+static bool push_token(utils_json_reader_t* r, utils_json_reader_type_t type, size_t start, size_t end, bool escaped) {
+    if (r->token_cnt >= UTILS_JSON_READER_TOKEN_MAX_CNT) {
+        return false;
+    }
+
+    utils_json_reader_token_t* token = &r->tokens[r->token_cnt++];
+    token->type                      = (uint8_t)type;
+    token->escaped                   = escaped;
+    token->start                     = (uint16_t)start;
+    token->end                       = (uint16_t)end;
+
+    return true;
+}
+
+/* Returns true once the root container is closed */
+static bool close_container(utils_json_reader_t* r, int open[2], size_t* depth, size_t* pos) {
+    (*pos)++;
+    (*depth)--;
+    if (*depth <= 1 && open[*depth] != UTILS_JSON_READER_NONE) {
+        r->tokens[open[*depth]].end = (uint16_t)*pos;
+        open[*depth]                = UTILS_JSON_READER_NONE;
+    }
+
+    return *depth == 0;
+}
+
+static bool scan_string(const char* json, size_t json_len, size_t pos, size_t* end, bool* escaped) {
+    size_t i = pos + 1;
+    while (i < json_len && json[i] != '"') {
+        if (json[i] == '\\') {
+            if (i + 1 >= json_len) {
+                return false;
+            }
+            i++;
+        }
+        i++;
+    }
+    if (i >= json_len) {
+        return false;
+    }
+
+    const char* s     = json + pos + 1;
+    const char* s_end = json + i;
+    *escaped          = false;
+    while (s < s_end) {
+        if (*s != '\\') {
+            s++;
+            continue;
+        }
+
+        unsigned char utf8[4];
+        size_t        utf8_len = 0;
+        size_t        seq_len  = next_sequence(s, s_end, utf8, &utf8_len);
+        if (seq_len == 0) {
+            return false;
+        }
+
+        s += seq_len;
+        *escaped = true;
+    }
+
+    *end = i;
+
+    return true;
+}
+
+static bool scan_number(const char* json, size_t json_len, size_t pos, size_t* end, double* value) {
+    char   number[NUMBER_MAX_LEN + 1];
+    size_t len = 0;
+    while (len < NUMBER_MAX_LEN && pos + len < json_len && number_char(json[pos + len])) {
+        number[len] = json[pos + len];
+        len++;
+    }
+    number[len] = '\0';
+
+    char*  after  = NULL;
+    double parsed = strtod(number, &after);
+    if (after == number) {
+        return false;
+    }
+
+    *end   = pos + (size_t)(after - number);
+    *value = parsed;
+
+    return true;
+}
+
+static bool number_char(char c) {
+    return (c >= '0' && c <= '9') || c == '+' || c == '-' || c == 'e' || c == 'E' || c == '.';
+}
+
+static uint32_t read_hex4(const char* s) {
+    uint32_t value = 0;
+    for (size_t i = 0; i < 4; i++) {
+        char c = s[i];
+        value <<= 4;
+        if (c >= '0' && c <= '9') {
+            value |= (uint32_t)(c - '0');
+        } else if (c >= 'a' && c <= 'f') {
+            value |= (uint32_t)(c - 'a' + 10);
+        } else if (c >= 'A' && c <= 'F') {
+            value |= (uint32_t)(c - 'A' + 10);
+        } else {
+            /* cJSON reads a malformed \u escape as U+0000 */
+            return 0;
+        }
+    }
+
+    return value;
+}
+
+/* Decodes one byte or escape into UTF-8, returns the bytes consumed or 0 if malformed */
+static size_t next_sequence(const char* s, const char* end, unsigned char utf8[4], size_t* utf8_len) {
+    if (*s != '\\') {
+        utf8[0]   = (unsigned char)*s;
+        *utf8_len = 1;
+        return 1;
+    }
+    if (end - s < 2) {
+        /*
+         * Only a \u escape that swallowed a backslash leaves one here.
+         * cJSON then reads the closing quote as the escaped byte.
+         */
+        utf8[0]   = '"';
+        *utf8_len = 1;
+        return 2;
+    }
+
+    switch (s[1]) {
+        case 'b':
+            utf8[0] = '\b';
+            break;
+        case 'f':
+            utf8[0] = '\f';
+            break;
+        case 'n':
+            utf8[0] = '\n';
+            break;
+        case 'r':
+            utf8[0] = '\r';
+            break;
+        case 't':
+            utf8[0] = '\t';
+            break;
+        case '"':
+        case '\\':
+        case '/':
+            utf8[0] = (unsigned char)s[1];
+            break;
+        case 'u': {
+            if (end - s < 6) {
+                return 0;
+            }
+
+            size_t   seq_len = 6;
+            uint32_t code    = read_hex4(s + 2);
+            if (code >= 0xDC00 && code <= 0xDFFF) {
+                return 0;
+            }
+            if (code >= 0xD800 && code <= 0xDBFF) {
+                if (end - s < 12 || s[6] != '\\' || s[7] != 'u') {
+                    return 0;
+                }
+                uint32_t low = read_hex4(s + 8);
+                if (low < 0xDC00 || low > 0xDFFF) {
+                    return 0;
+                }
+                code    = 0x10000 + (((code & 0x3FF) << 10) | (low & 0x3FF));
+                seq_len = 12;
+            }
+
+            if (code < 0x80) {
+                utf8[0]   = (unsigned char)code;
+                *utf8_len = 1;
+            } else if (code < 0x800) {
+                utf8[0]   = (unsigned char)(0xC0 | (code >> 6));
+                utf8[1]   = (unsigned char)(0x80 | (code & 0x3F));
+                *utf8_len = 2;
+            } else if (code < 0x10000) {
+                utf8[0]   = (unsigned char)(0xE0 | (code >> 12));
+                utf8[1]   = (unsigned char)(0x80 | ((code >> 6) & 0x3F));
+                utf8[2]   = (unsigned char)(0x80 | (code & 0x3F));
+                *utf8_len = 3;
+            } else {
+                utf8[0]   = (unsigned char)(0xF0 | (code >> 18));
+                utf8[1]   = (unsigned char)(0x80 | ((code >> 12) & 0x3F));
+                utf8[2]   = (unsigned char)(0x80 | ((code >> 6) & 0x3F));
+                utf8[3]   = (unsigned char)(0x80 | (code & 0x3F));
+                *utf8_len = 4;
+            }
+
+            return seq_len;
+        }
+        default:
+            return 0;
+    }
+
+    *utf8_len = 1;
+
+    return 2;
+}
+
+static bool key_equals(const utils_json_reader_t* r, const utils_json_reader_token_t* token, const char* key) {
+    const char* s   = r->json + token->start;
+    const char* end = r->json + token->end;
+
+    if (!token->escaped) {
+        size_t key_len = strlen(key);
+        size_t len     = (size_t)(end - s);
+        if (len < key_len || memcmp(s, key, key_len) != 0) {
+            return false;
+        }
+        /* A raw NUL ends the decoded key early */
+        return len == key_len || s[key_len] == '\0';
+    }
+
+    size_t k = 0;
+    while (s < end) {
+        unsigned char utf8[4];
+        size_t        utf8_len = 0;
+        s += next_sequence(s, end, utf8, &utf8_len);
+
+        for (size_t i = 0; i < utf8_len; i++) {
+            if (utf8[i] == '\0') {
+                return key[k] == '\0';
+            }
+            if ((unsigned char)key[k] != utf8[i]) {
+                return false;
+            }
+            k++;
+        }
+    }
+
+    return key[k] == '\0';
+}
+
+static const utils_json_reader_token_t* token_at(const utils_json_reader_t* r, int token) {
+    if (!r || token < 0 || (size_t)token >= r->token_cnt) {
+        return NULL;
+    }
+
+    return &r->tokens[token];
+}
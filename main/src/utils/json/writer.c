@@ -0,0 +1,368 @@
+#include "utils/json/writer.h"
+
+#include <string.h>
+
+/* Helper Function Prototypes */
+
+static bool put_raw(utils_json_writer_t* w, const char* data, size_t data_len);
+static bool flush_buf(utils_json_writer_t* w);
+static bool put_char(utils_json_writer_t* w, char c);
+static bool put_separator(utils_json_writer_t* w);
+static bool put_escaped(utils_json_writer_t* w, const char* value, size_t value_len);
+static bool put_uint_digits(utils_json_writer_t* w, uint64_t value);
+
+void utils_json_writer_init(
+    utils_json_writer_t* w,
+    char*                buf,
+    size_t               buf_size
+) {
+    if (!w) {
+        return;
+    }
+
+    w->buf         = buf;
+    w->buf_size    = buf_size;
+    w->len         = 0;
+    w->need_comma  = false;
+    w->overflow    = !buf || buf_size == 0;
+    w->flush       = NULL;
+    w->flush_ctx   = NULL;
+    w->flushed_len = 0;
+
+    if (!w->overflow) {
+        w->buf[0] = '\0';
+    }
+}
+
+void utils_json_writer_init_stream(
+    utils_json_writer_t*      w,
+    char*                     buf,
+    size_t                    buf_size,
+    utils_json_writer_flush_t flush,
+    void*                     flush_ctx
+) {
+    utils_json_writer_init(w, buf, buf_size);
+    if (!w) {
+        return;
+    }
+
+    w->flush     = flush;
+    w->flush_ctx = flush_ctx;
+    w->overflow  = w->overflow || !flush;
+}
+
+bool utils_json_writer_object_begin(utils_json_writer_t* w) {
+    if (!put_separator(w) || !put_char(w, '{')) {
+        return false;
+    }
+
+    w->need_comma = false;
+
+    return true;
+}
+
+bool utils_json_writer_object_end(utils_json_writer_t* w) {
+    if (!put_char(w, '}')) {
+        return false;
+    }
+
+    w->need_comma = true;
+
+    return true;
+}
+
+bool utils_json_writer_array_begin(utils_json_writer_t* w) {
+    if (!put_separator(w) || !put_char(w, '[')) {
+        return false;
+    }
+
+    w->need_comma = false;
+
+    return true;
+}
+
+bool utils_json_writer_array_end(utils_json_writer_t* w) {
+    if (!put_char(w, ']')) {
+        return false;
+    }
+
+    w->need_comma = true;
+
+    return true;
+}
+
+bool utils_json_writer_key(
+    utils_json_writer_t* w,
+    const char*          key
+) {
+    if (!key || !put_separator(w)) {
+        return false;
+    }
+    if (!put_escaped(w, key, strlen(key)) || !put_char(w, ':')) {
+        return false;
+    }
+
+    w->need_comma = false;
+
+    return true;
+}
+
+bool utils_json_writer_string(
+    utils_json_writer_t* w,
+    const char*          value
+) {
+    return utils_json_writer_string_len(w, value, value ? strlen(value) : 0);
+}
+
+bool utils_json_writer_string_len(
+    utils_json_writer_t* w,
+    const char*          value,
+    size_t               value_len
+) {
+    if (!put_separator(w) || !put_escaped(w, value ? value : "", value ? value_len : 0)) {
+        return false;
+    }
+
+    w->need_comma = true;
+
+    return true;
+}
+
+bool utils_json_writer_int(
+    utils_json_writer_t* w,
+    int64_t              value
+) {
+    if (!put_separator(w)) {
+        return false;
+    }
+
+    uint64_t magnitude = (uint64_t)value;
+    if (value < 0) {
+        if (!put_char(w, '-')) {
+            return false;
+        }
+        magnitude = 0 - magnitude;
+    }
+
+    if (!put_uint_digits(w, magnitude)) {
+        return false;
+    }
+
+    w->need_comma = true;
+
+    return true;
+}
+
+bool utils_json_writer_uint(
+    utils_json_writer_t* w,
+    uint64_t             value
+) {
+    if (!put_separator(w) || !put_uint_digits(w, value)) {
+        return false;
+    }
+
+    w->need_comma = true;
+
+    return true;
+}
+
+bool utils_json_writer_bool(
+    utils_json_writer_t* w,
+    bool                 value
+) {
+    if (!put_separator(w) || !(value ? put_raw(w, "true", 4) : put_raw(w, "false", 5))) {
+        return false;
+    }
+
+    w->need_comma = true;
+
+    return true;
+}
+
+bool utils_json_writer_null(utils_json_writer_t* w) {
+    if (!put_separator(w) || !put_raw(w, "null", 4)) {
+        return false;
+    }
+
+    w->need_comma = true;
+
+    return true;
+}
+
+bool utils_json_writer_kv_string(
+    utils_json_writer_t* w,
+    const char*          key,
+    const char*          value
+) {
+    return utils_json_writer_key(w, key) && utils_json_writer_string(w, value);
+}
+
+bool utils_json_writer_kv_int(
+    utils_json_writer_t* w,
+    const char*          key,
+    int64_t              value
+) {
+    return utils_json_writer_key(w, key) && utils_json_writer_int(w, value);
+}
+
+bool utils_json_writer_kv_uint(
+    utils_json_writer_t* w,
+    const char*          key,
+    uint64_t             value
+) {
+    return utils_json_writer_key(w, key) && utils_json_writer_uint(w, value);
+}
+
+bool utils_json_writer_kv_bool(
+    utils_json_writer_t* w,
+    const char*          key,
+    bool                 value
+) {
+    return utils_json_writer_key(w, key) && utils_json_writer_bool(w, value);
+}
+
+size_t utils_json_writer_finish(utils_json_writer_t* w) {
+    if (!w || w->overflow) {
+        return 0;
+    }
+
+    if (w->flush) {
+        return flush_buf(w) ? w->flushed_len : 0;
+    }
+
+    w->buf[w->len] = '\0';
+
+    return w->len;
+}
+
+/* Helper Function Implementations */
+
+static bool put_raw(utils_json_writer_t* w, const char* data, size_t data_len) {
+    if (!w || w->overflow) {
+        return false;
+    }
+
+    /* One byte is always kept for the terminating NUL */
+    if (data_len >= w->buf_size - w->len) {
+        if (!w->flush || !flush_buf(w)) {
+            w->overflow = true;
+            return false;
+        }
+
+        /* Runs longer than the scratch buffer bypass it */
+        if (data_len >= w->buf_size) {
+            if (!w->flush(w->flush_ctx, data, data_len)) {
+                w->overflow = true;
+                return false;
+            }
+            w->flushed_len += data_len;
+            return true;
+        }
+    }
+
+    memcpy(w->buf + w->len, data, data_len);
+    w->len += data_len;
+
+    return true;
+}
+
+static bool flush_buf(utils_json_writer_t* w) {
+    if (w->len == 0) {
+        return true;
+    }
+    if (!w->flush(w->flush_ctx, w->buf, w->len)) {
+        w->overflow = true;
+        return false;
+    }
+
+    w->flushed_len += w->len;
+    w->len          = 0;
+
+    return true;
+}
+
+static bool put_char(utils_json_writer_t* w, char c) {
+    return put_raw(w, &c, 1);
+}
+
+static bool put_separator(utils_json_writer_t* w) {
+    if (!w || w->overflow) {
+        return false;
+    }
+
+    return w->need_comma ? put_char(w, ',') : true;
+}
+
+static bool put_escaped(utils_json_writer_t* w, const char* value, size_t value_len) {
+    static const char hex_digits[] = "0123456789abcdef";
+
+    if (!put_char(w, '"')) {
+        return false;
+    }
+
+    size_t run_start = 0;
+    for (size_t i = 0; i < value_len; i++) {
+        unsigned char c = (unsigned char)value[i];
+        if (c >= 0x20 && c != '"' && c != '\\') {
+            continue;
+        }
+
+        if (!put_raw(w, value + run_start, i - run_start)) {
+            return false;
+        }
+        run_start = i + 1;
+
+        char   esc[6]  = {'\\', 0, 0, 0, 0, 0};
+        size_t esc_len = 2;
+        switch (c) {
+            case '"':
+                esc[1] = '"';
+                break;
+            case '\\':
+                esc[1] = '\\';
+                break;
+            case '\b':
+                esc[1] = 'b';
+                break;
+            case '\f':
+                esc[1] = 'f';
+                break;
+            case '\n':
+                esc[1] = 'n';
+                break;
+            case '\r':
+                esc[1] = 'r';
+                break;
+            case '\t':
+                esc[1] = 't';
+                break;
+            default:
+                esc[1]  = 'u';
+                esc[2]  = '0';
+                esc[3]  = '0';
+                esc[4]  = hex_digits[c >> 4];
+                esc[5]  = hex_digits[c & 0x0F];
+                esc_len = 6;
+                break;
+        }
+
+        if (!put_raw(w, esc, esc_len)) {
+            return false;
+        }
+    }
+
+    return put_raw(w, value + run_start, value_len - run_start) && put_char(w, '"');
+}
+
+static bool put_uint_digits(utils_json_writer_t* w, uint64_t value) {
+    char   digits[20];
+    size_t digit_cnt = 0;
+
+    do {
+        digits[sizeof(digits) - 1 - digit_cnt] = (char)('0' + (value % 10));
+        value /= 10;
+        digit_cnt++;
+    } while (value > 0);
+
+    return put_raw(w, digits + sizeof(digits) - digit_cnt, digit_cnt);
+}
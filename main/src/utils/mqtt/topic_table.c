@@ -0,0 +1,106 @@
+#include "utils/mqtt/topic_table.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/* Helper Function Prototypes */
+
+static bool cstr_available(const char* value);
+
+bool utils_mqtt_topic_table_init(
+    utils_mqtt_topic_table_t* table,
+    const char*               root,
+    const char*               device_id
+) {
+    if (!table || !cstr_available(root) || !cstr_available(device_id)) {
+        return false;
+    }
+
+    memset(table, 0, sizeof(*table));
+
+    int written = snprintf(table->prefix.str, sizeof(table->prefix.str), "/%s/%s/", root, device_id);
+    if (written <= 0 || (size_t)written >= sizeof(table->prefix.str)) {
+        table->prefix.str[0] = '\0';
+        return false;
+    }
+
+    table->prefix.len = (uint16_t)written;
+
+    return true;
+}
+
+int utils_mqtt_topic_table_add(
+    utils_mqtt_topic_table_t* table,
+    const char*               suffix
+) {
+    if (!table || table->prefix.len == 0 || !cstr_available(suffix)) {
+        return -1;
+    }
+
+    size_t suffix_len = strlen(suffix);
+
+    int existing = -1;
+    for (size_t i = 0; i < table->cnt; i++) {
+        const utils_mqtt_topic_t* topic = &table->topics[i];
+        if (topic->len == table->prefix.len + suffix_len &&
+            memcmp(topic->str + table->prefix.len, suffix, suffix_len) == 0) {
+            existing = (int)i;
+            break;
+        }
+    }
+    if (existing >= 0) {
+        return existing;
+    }
+
+    if (table->cnt >= UTILS_MQTT_TOPIC_TABLE_MAX_CNT ||
+        table->prefix.len + suffix_len >= UTILS_MQTT_TOPIC_TABLE_TOPIC_MAX_LEN) {
+        return -1;
+    }
+
+    utils_mqtt_topic_t* topic = &table->topics[table->cnt];
+    memcpy(topic->str, table->prefix.str, table->prefix.len);
+    memcpy(topic->str + table->prefix.len, suffix, suffix_len + 1);
+    topic->len = (uint16_t)(table->prefix.len + suffix_len);
+
+    return (int)table->cnt++;
+}
+
+const utils_mqtt_topic_t* utils_mqtt_topic_table_get(
+    const utils_mqtt_topic_table_t* table,
+    int                             id
+) {
+    if (!table || id < 0 || (size_t)id >= table->cnt) {
+        return NULL;
+    }
+
+    return &table->topics[id];
+}
+
+int utils_mqtt_topic_table_find(
+    const utils_mqtt_topic_table_t* table,
+    const char*                     topic,
+    size_t                          topic_len
+) {
+    if (!table || !topic || topic_len <= table->prefix.len) {
+        return -1;
+    }
+    if (memcmp(topic, table->prefix.str, table->prefix.len) != 0) {
+        return -1;
+    }
+
+    for (size_t i = 0; i < table->cnt; i++) {
+        const utils_mqtt_topic_t* entry = &table->topics[i];
+        if (entry->len == topic_len &&
+            memcmp(entry->str + table->prefix.len, topic + table->prefix.len, topic_len - table->prefix.len) == 0) {
+            return (int)i;
+        }
+    }
+
+    return -1;
+}
+
+/* Helper Function Implementations */
+
+static bool cstr_available(const char* value) {
+    return value && value[0] != '\0';
+}
@@ -0,0 +1,92 @@
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Minimal check macros for the host tests. A failed check is reported and
+ * counted, the test keeps running, and main returns HOST_TEST_RESULT().
+ */
+static int host_test_fail_cnt;
+
+#define HOST_TEST_CHECK(cond)                                                        \
+    do {                                                                             \
+        if (!(cond)) {                                                               \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            host_test_fail_cnt++;                                                    \
+        }                                                                            \
+    } while (0)
+
+#define HOST_TEST_CHECK_EQ_INT(actual, expected)                                                                          \
+    do {                                                                                                                  \
+        long long host_test_a = (long long)(actual);                                                                      \
+        long long host_test_e = (long long)(expected);                                                                    \
+        if (host_test_a != host_test_e) {                                                                                 \
+            fprintf(stderr, "%s:%d: %s == %lld, expected %lld\n", __FILE__, __LINE__, #actual, host_test_a, host_test_e); \
+            host_test_fail_cnt++;                                                                                         \
+        }                                                                                                                 \
+    } while (0)
+
+#define HOST_TEST_CHECK_EQ_STR(actual, expected)                                                                                                                                     \
+    do {                                                                                                                                                                             \
+        const char* host_test_a = (actual);                                                                                                                                          \
+        const char* host_test_e = (expected);                                                                                                                                        \
+        if (!host_test_a || !host_test_e || strcmp(host_test_a, host_test_e) != 0) {                                                                                                 \
+            fprintf(stderr, "%s:%d: %s\n  actual:   %s\n  expected: %s\n", __FILE__, __LINE__, #actual, host_test_a ? host_test_a : "(null)", host_test_e ? host_test_e : "(null)"); \
+            host_test_fail_cnt++;                                                                                                                                                    \
+        }                                                                                                                                                                            \
+    } while (0)
+
+#define HOST_TEST_RUN(test_func)                                                                 \
+    do {                                                                                         \
+        int host_test_before = host_test_fail_cnt;                                               \
+        test_func();                                                                             \
+        printf("%s %s\n", host_test_fail_cnt == host_test_before ? "PASS" : "FAIL", #test_func); \
+    } while (0)
+
+#define HOST_TEST_RESULT() (host_test_fail_cnt == 0 ? 0 : 1)
+
+static inline int64_t host_test_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/* Points stdout at /dev/null so the loggers under test do not flood ctest output */
+static int host_test_stdout_fd = -1;
+
+static inline void host_test_stdout_silence(void) {
+    fflush(stdout);
+    host_test_stdout_fd = dup(STDOUT_FILENO);
+    int null_fd         = open("/dev/null", O_WRONLY);
+    dup2(null_fd, STDOUT_FILENO);
+    close(null_fd);
+}
+
+static inline void host_test_stdout_restore(void) {
+    fflush(stdout);
+    dup2(host_test_stdout_fd, STDOUT_FILENO);
+    close(host_test_stdout_fd);
+    host_test_stdout_fd = -1;
+}
+
+static inline void host_test_sleep_us(long us) {
+    struct timespec ts = {.tv_sec = us / 1000000, .tv_nsec = (us % 1000000) * 1000};
+    nanosleep(&ts, NULL);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_TEST_H */
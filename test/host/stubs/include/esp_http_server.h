@@ -0,0 +1,133 @@
+#ifndef HOST_STUBS_ESP_HTTP_SERVER_H
+#define HOST_STUBS_ESP_HTTP_SERVER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <sys/types.h>
+
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define HTTPD_RESP_USE_STRLEN  -1
+#define HTTPD_SOCK_ERR_FAIL    -1
+#define HTTPD_SOCK_ERR_TIMEOUT -3
+
+#define ESP_ERR_HTTPD_BASE           0xb000
+#define ESP_ERR_HTTPD_HANDLERS_FULL  (ESP_ERR_HTTPD_BASE + 1)
+#define ESP_ERR_HTTPD_HANDLER_EXISTS (ESP_ERR_HTTPD_BASE + 2)
+#define ESP_ERR_HTTPD_RESP_HDR       (ESP_ERR_HTTPD_BASE + 4)
+#define ESP_ERR_HTTPD_RESULT_TRUNC   (ESP_ERR_HTTPD_BASE + 5)
+
+#define HOST_STUBS_HTTPD_URI_MAX 8
+#define HOST_STUBS_HTTPD_HDR_MAX 8
+
+typedef void* httpd_handle_t;
+
+typedef enum {
+    HTTP_DELETE = 0,
+    HTTP_GET    = 1,
+    HTTP_HEAD   = 2,
+    HTTP_POST   = 3,
+    HTTP_PUT    = 4,
+    HTTP_PATCH  = 28,
+} httpd_method_t;
+
+/*
+ * The fields the firmware reads, followed by the request body, query,
+ * headers and socket the stub serves from. Headers are name and value
+ * pairs ending with a NULL name, a host_sockfd of 0 means no socket.
+ * Responses go to the shared capture below.
+ */
+typedef struct httpd_req {
+    httpd_handle_t handle;
+    int            method;
+    const char     uri[64];
+    size_t         content_len;
+    void*          user_ctx;
+
+    const char*        host_body;
+    size_t             host_body_off;
+    const char*        host_query;
+    const char* const* host_headers;
+    int                host_sockfd;
+} httpd_req_t;
+
+typedef struct httpd_uri {
+    const char*    uri;
+    httpd_method_t method;
+    esp_err_t      (*handler)(httpd_req_t* r);
+    void*          user_ctx;
+} httpd_uri_t;
+
+/* What an httpd_handle_t points at, tests fill global_user_ctx themselves */
+typedef struct {
+    void*       global_user_ctx;
+    httpd_uri_t uris[HOST_STUBS_HTTPD_URI_MAX];
+    size_t      uri_cnt;
+} host_stubs_httpd_server_t;
+
+void* httpd_get_global_user_ctx(httpd_handle_t handle);
+
+esp_err_t httpd_register_uri_handler(httpd_handle_t handle, const httpd_uri_t* uri_handler);
+
+esp_err_t httpd_unregister_uri_handler(httpd_handle_t handle, const char* uri, httpd_method_t method);
+
+int httpd_req_to_sockfd(httpd_req_t* r);
+
+size_t httpd_req_get_hdr_value_len(httpd_req_t* r, const char* field);
+
+esp_err_t httpd_req_get_hdr_value_str(httpd_req_t* r, const char* field, char* val, size_t val_size);
+
+int httpd_req_recv(httpd_req_t* r, char* buf, size_t buf_len);
+
+size_t httpd_req_get_url_query_len(httpd_req_t* r);
+
+esp_err_t httpd_req_get_url_query_str(httpd_req_t* r, char* buf, size_t buf_len);
+
+esp_err_t httpd_query_key_value(const char* qry, const char* key, char* val, size_t val_size);
+
+esp_err_t httpd_resp_set_type(httpd_req_t* r, const char* type);
+
+esp_err_t httpd_resp_set_status(httpd_req_t* r, const char* status);
+
+esp_err_t httpd_resp_set_hdr(httpd_req_t* r, const char* field, const char* value);
+
+esp_err_t httpd_resp_send(httpd_req_t* r, const char* buf, ssize_t buf_len);
+
+/* A NULL or zero-length chunk terminates the response */
+esp_err_t httpd_resp_send_chunk(httpd_req_t* r, const char* buf, ssize_t buf_len);
+
+typedef struct {
+    char name[32];
+    char value[64];
+} host_stubs_httpd_header_t;
+
+typedef struct {
+    char                      type[64];
+    char                      status[32];
+    host_stubs_httpd_header_t headers[HOST_STUBS_HTTPD_HDR_MAX];
+    size_t                    header_cnt;
+    char   body[32768];
+    size_t body_len;
+    size_t chunk_cnt;
+    size_t chunk_max_len;
+    bool   finished;
+    size_t fail_after_chunk_cnt;
+} host_stubs_httpd_response_t;
+
+/* Clears the capture, fail_after_chunk_cnt > 0 makes later chunks fail */
+void host_stubs_httpd_response_reset(size_t fail_after_chunk_cnt);
+
+const host_stubs_httpd_response_t* host_stubs_httpd_response(void);
+
+/* Value of the response header set last under that name, NULL when none was */
+const char* host_stubs_httpd_response_header(const char* name);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_STUBS_ESP_HTTP_SERVER_H */
@@ -0,0 +1,16 @@
+#ifndef HOST_STUBS_ESP_RANDOM_H
+#define HOST_STUBS_ESP_RANDOM_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+uint32_t esp_random(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_STUBS_ESP_RANDOM_H */
@@ -0,0 +1,17 @@
+#ifndef HOST_STUBS_ESP_SYSTEM_H
+#define HOST_STUBS_ESP_SYSTEM_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Fixed, so heap deltas measured on the host are always 0 */
+uint32_t esp_get_free_heap_size(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_STUBS_ESP_SYSTEM_H */
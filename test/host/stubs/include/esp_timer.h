@@ -0,0 +1,19 @@
+#ifndef HOST_STUBS_ESP_TIMER_H
+#define HOST_STUBS_ESP_TIMER_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Monotonic host time plus the offset added by host_stubs_clock_advance_us() */
+int64_t esp_timer_get_time(void);
+
+void host_stubs_clock_advance_us(int64_t delta_us);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_STUBS_ESP_TIMER_H */
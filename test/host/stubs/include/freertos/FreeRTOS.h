@@ -0,0 +1,30 @@
+#ifndef HOST_STUBS_FREERTOS_FREERTOS_H
+#define HOST_STUBS_FREERTOS_FREERTOS_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Host build of the FreeRTOS subset the firmware uses, one tick per millisecond */
+#define configTICK_RATE_HZ 1000
+
+typedef long          BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t      TickType_t;
+
+#define pdFALSE ((BaseType_t)0)
+#define pdTRUE  ((BaseType_t)1)
+#define pdFAIL  pdFALSE
+#define pdPASS  pdTRUE
+
+#define portMAX_DELAY      ((TickType_t)0xffffffffUL)
+#define portTICK_PERIOD_MS ((TickType_t)(1000 / configTICK_RATE_HZ))
+#define pdMS_TO_TICKS(ms)  ((TickType_t)(((uint64_t)(ms) * configTICK_RATE_HZ) / 1000))
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_STUBS_FREERTOS_FREERTOS_H */
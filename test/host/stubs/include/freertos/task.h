@@ -0,0 +1,45 @@
+#ifndef HOST_STUBS_FREERTOS_TASK_H
+#define HOST_STUBS_FREERTOS_TASK_H
+
+#include <stdint.h>
+
+#include "freertos/FreeRTOS.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct host_stubs_task_t* TaskHandle_t;
+typedef void (*TaskFunction_t)(void* arg);
+
+typedef enum {
+    eNoAction = 0,
+    eSetBits,
+    eIncrement,
+    eSetValueWithOverwrite,
+    eSetValueWithoutOverwrite,
+} eNotifyAction;
+
+/* Tasks run as detached pthreads, priority and stack size are ignored */
+BaseType_t xTaskCreate(
+    TaskFunction_t task_func,
+    const char*    name,
+    uint32_t       stack_size,
+    void*          arg,
+    UBaseType_t    priority,
+    TaskHandle_t*  out_handle
+);
+void       vTaskDelete(TaskHandle_t task);
+void       vTaskDelay(TickType_t ticks);
+TickType_t xTaskGetTickCount(void);
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+uint32_t   ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks);
+BaseType_t xTaskNotify(TaskHandle_t task, uint32_t value, eNotifyAction action);
+BaseType_t xTaskNotifyWait(uint32_t clear_on_entry, uint32_t clear_on_exit, uint32_t* out_value, TickType_t ticks);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_STUBS_FREERTOS_TASK_H */
@@ -0,0 +1,37 @@
+#ifndef HOST_STUBS_MQTT_CLIENT_H
+#define HOST_STUBS_MQTT_CLIENT_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct esp_mqtt_client* esp_mqtt_client_handle_t;
+
+/* Records the call and returns the next message id, see host_stubs_mqtt_last_publish() */
+int esp_mqtt_client_publish(
+    esp_mqtt_client_handle_t client,
+    const char*              topic,
+    const char*              data,
+    int                      len,
+    int                      qos,
+    int                      retain
+);
+
+typedef struct {
+    char   topic[128];
+    char   data[4096];
+    int    data_len;
+    int    qos;
+    int    retain;
+    size_t publish_cnt;
+} host_stubs_mqtt_publish_t;
+
+const host_stubs_mqtt_publish_t* host_stubs_mqtt_last_publish(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_STUBS_MQTT_CLIENT_H */
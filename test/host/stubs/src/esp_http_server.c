@@ -0,0 +1,243 @@
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+
+#include "esp_http_server.h"
+
+static host_stubs_httpd_response_t response;
+
+static const char* find_header(httpd_req_t* r, const char* field) {
+    if (!r || !r->host_headers || !field) {
+        return NULL;
+    }
+
+    for (const char* const* pair = r->host_headers; pair[0]; pair += 2) {
+        if (strcasecmp(pair[0], field) == 0) {
+            return pair[1];
+        }
+    }
+
+    return NULL;
+}
+
+void* httpd_get_global_user_ctx(httpd_handle_t handle) {
+    return handle ? ((host_stubs_httpd_server_t*)handle)->global_user_ctx : NULL;
+}
+
+esp_err_t httpd_register_uri_handler(httpd_handle_t handle, const httpd_uri_t* uri_handler) {
+    host_stubs_httpd_server_t* server = (host_stubs_httpd_server_t*)handle;
+    if (!server || !uri_handler || !uri_handler->uri) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    for (size_t i = 0; i < server->uri_cnt; i++) {
+        if (server->uris[i].method == uri_handler->method && strcmp(server->uris[i].uri, uri_handler->uri) == 0) {
+            return ESP_ERR_HTTPD_HANDLER_EXISTS;
+        }
+    }
+    if (server->uri_cnt >= HOST_STUBS_HTTPD_URI_MAX) {
+        return ESP_ERR_HTTPD_HANDLERS_FULL;
+    }
+
+    server->uris[server->uri_cnt++] = *uri_handler;
+
+    return ESP_OK;
+}
+
+esp_err_t httpd_unregister_uri_handler(httpd_handle_t handle, const char* uri, httpd_method_t method) {
+    host_stubs_httpd_server_t* server = (host_stubs_httpd_server_t*)handle;
+    if (!server || !uri) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    for (size_t i = 0; i < server->uri_cnt; i++) {
+        if (server->uris[i].method == method && strcmp(server->uris[i].uri, uri) == 0) {
+            server->uris[i] = server->uris[--server->uri_cnt];
+            return ESP_OK;
+        }
+    }
+
+    return ESP_ERR_NOT_FOUND;
+}
+
+int httpd_req_to_sockfd(httpd_req_t* r) {
+    return r && r->host_sockfd > 0 ? r->host_sockfd : -1;
+}
+
+size_t httpd_req_get_hdr_value_len(httpd_req_t* r, const char* field) {
+    const char* value = find_header(r, field);
+
+    return value ? strlen(value) : 0;
+}
+
+esp_err_t httpd_req_get_hdr_value_str(httpd_req_t* r, const char* field, char* val, size_t val_size) {
+    const char* value = find_header(r, field);
+    if (!value) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    if (!val || val_size == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    snprintf(val, val_size, "%s", value);
+
+    return strlen(value) < val_size ? ESP_OK : ESP_ERR_HTTPD_RESULT_TRUNC;
+}
+
+int httpd_req_recv(httpd_req_t* r, char* buf, size_t buf_len) {
+    if (!r || !buf || !r->host_body) {
+        return HTTPD_SOCK_ERR_FAIL;
+    }
+
+    size_t left = r->content_len - r->host_body_off;
+    size_t len  = buf_len < left ? buf_len : left;
+    memcpy(buf, r->host_body + r->host_body_off, len);
+    r->host_body_off += len;
+
+    return (int)len;
+}
+
+size_t httpd_req_get_url_query_len(httpd_req_t* r) {
+    return r && r->host_query ? strlen(r->host_query) : 0;
+}
+
+esp_err_t httpd_req_get_url_query_str(httpd_req_t* r, char* buf, size_t buf_len) {
+    if (!r || !buf || !r->host_query) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    if (strlen(r->host_query) >= buf_len) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    snprintf(buf, buf_len, "%s", r->host_query);
+
+    return ESP_OK;
+}
+
+esp_err_t httpd_query_key_value(const char* qry, const char* key, char* val, size_t val_size) {
+    if (!qry || !key || !val || val_size == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    size_t key_len = strlen(key);
+    for (const char* pair = qry; pair && *pair != '\0';) {
+        const char* end = strchr(pair, '&');
+        size_t      len = end ? (size_t)(end - pair) : strlen(pair);
+
+        if (len > key_len && strncmp(pair, key, key_len) == 0 && pair[key_len] == '=') {
+            size_t value_len = len - key_len - 1;
+            size_t copy_len  = value_len < val_size ? value_len : val_size - 1;
+            memcpy(val, pair + key_len + 1, copy_len);
+            val[copy_len] = '\0';
+
+            return value_len < val_size ? ESP_OK : ESP_ERR_INVALID_SIZE;
+        }
+
+        pair = end ? end + 1 : NULL;
+    }
+
+    return ESP_ERR_NOT_FOUND;
+}
+
+esp_err_t httpd_resp_set_type(httpd_req_t* r, const char* type) {
+    if (!r || !type) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    snprintf(response.type, sizeof(response.type), "%s", type);
+
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_set_status(httpd_req_t* r, const char* status) {
+    if (!r || !status) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    snprintf(response.status, sizeof(response.status), "%s", status);
+
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_set_hdr(httpd_req_t* r, const char* field, const char* value) {
+    if (!r || !field || !value) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (response.header_cnt >= HOST_STUBS_HTTPD_HDR_MAX) {
+        return ESP_ERR_HTTPD_RESP_HDR;
+    }
+
+    host_stubs_httpd_header_t* header = &response.headers[response.header_cnt++];
+    snprintf(header->name, sizeof(header->name), "%s", field);
+    snprintf(header->value, sizeof(header->value), "%s", value);
+
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_send(httpd_req_t* r, const char* buf, ssize_t buf_len) {
+    if (!r) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (buf_len == HTTPD_RESP_USE_STRLEN) {
+        buf_len = buf ? (ssize_t)strlen(buf) : 0;
+    }
+
+    /* An empty body is a lone terminating chunk */
+    if (buf && buf_len > 0) {
+        esp_err_t err = httpd_resp_send_chunk(r, buf, buf_len);
+        if (err != ESP_OK) {
+            return err;
+        }
+    }
+
+    return httpd_resp_send_chunk(r, NULL, 0);
+}
+
+esp_err_t httpd_resp_send_chunk(httpd_req_t* r, const char* buf, ssize_t buf_len) {
+    if (!r || response.finished) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!buf || buf_len == 0) {
+        response.finished = true;
+        return ESP_OK;
+    }
+    if (buf_len == HTTPD_RESP_USE_STRLEN) {
+        buf_len = (ssize_t)strlen(buf);
+    }
+    if (response.fail_after_chunk_cnt > 0 && response.chunk_cnt >= response.fail_after_chunk_cnt) {
+        return ESP_FAIL;
+    }
+    if (response.body_len + (size_t)buf_len >= sizeof(response.body)) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    memcpy(response.body + response.body_len, buf, (size_t)buf_len);
+    response.body_len += (size_t)buf_len;
+    response.body[response.body_len] = '\0';
+    response.chunk_cnt++;
+    if ((size_t)buf_len > response.chunk_max_len) {
+        response.chunk_max_len = (size_t)buf_len;
+    }
+
+    return ESP_OK;
+}
+
+void host_stubs_httpd_response_reset(size_t fail_after_chunk_cnt) {
+    memset(&response, 0, sizeof(response));
+    response.fail_after_chunk_cnt = fail_after_chunk_cnt;
+}
+
+const host_stubs_httpd_response_t* host_stubs_httpd_response(void) {
+    return &response;
+}
+
+const char* host_stubs_httpd_response_header(const char* name) {
+    const char* value = NULL;
+    for (size_t i = 0; name && i < response.header_cnt; i++) {
+        if (strcasecmp(response.headers[i].name, name) == 0) {
+            value = response.headers[i].value;
+        }
+    }
+
+    return value;
+}
@@ -0,0 +1,14 @@
+#include <stdint.h>
+
+#include "esp_random.h"
+
+/* Fixed sequence so jittered schedules repeat from run to run */
+uint32_t esp_random(void) {
+    static uint32_t state = 0x2545f491u;
+
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+
+    return state;
+}
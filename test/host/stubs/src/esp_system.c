@@ -0,0 +1,7 @@
+#include <stdint.h>
+
+#include "esp_system.h"
+
+uint32_t esp_get_free_heap_size(void) {
+    return 128 * 1024;
+}
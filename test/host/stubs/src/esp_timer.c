@@ -0,0 +1,18 @@
+#include <stdatomic.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "esp_timer.h"
+
+static atomic_int_least64_t offset_us;
+
+int64_t esp_timer_get_time(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000 + atomic_load(&offset_us);
+}
+
+void host_stubs_clock_advance_us(int64_t delta_us) {
+    atomic_fetch_add(&offset_us, delta_us);
+}
@@ -0,0 +1,333 @@
+#include <errno.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+/*
+ * Each task owns one notification slot guarded by its own mutex, which is
+ * enough for the give/take and set-bits/wait patterns the firmware uses.
+ * Threads that were not created through xTaskCreate (the test main) get a
+ * slot on first use.
+ */
+struct host_stubs_task_t {
+    pthread_t       thread;
+    pthread_mutex_t mutex;
+    pthread_cond_t  cond;
+    uint32_t        value;
+    bool            pending;
+    TaskFunction_t  task_func;
+    void*           arg;
+};
+
+struct host_stubs_semaphore_t {
+    pthread_mutex_t mutex;
+};
+
+/* Helper Function Prototypes */
+
+static TaskHandle_t    task_alloc(void);
+static TaskHandle_t    task_current(void);
+static void*           task_trampoline(void* arg);
+static struct timespec deadline_from_ticks(TickType_t ticks);
+static int             wait_task(TaskHandle_t task, TickType_t ticks, const struct timespec* deadline);
+static void            signal_task(TaskHandle_t task);
+
+static _Thread_local TaskHandle_t current_task;
+
+/* Task Function Implementations */
+
+BaseType_t xTaskCreate(
+    TaskFunction_t task_func,
+    const char*    name,
+    uint32_t       stack_size,
+    void*          arg,
+    UBaseType_t    priority,
+    TaskHandle_t*  out_handle
+) {
+    (void)name;
+    (void)stack_size;
+    (void)priority;
+
+    TaskHandle_t task = task_alloc();
+    if (!task) {
+        return pdFAIL;
+    }
+
+    task->task_func = task_func;
+    task->arg       = arg;
+
+    /* FreeRTOS stores the handle before the task can run */
+    if (out_handle) {
+        *out_handle = task;
+    }
+
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    int err = pthread_create(&task->thread, &attr, task_trampoline, task);
+    pthread_attr_destroy(&attr);
+    if (err != 0) {
+        if (out_handle) {
+            *out_handle = NULL;
+        }
+        free(task);
+        return pdFAIL;
+    }
+
+    return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t task) {
+    if (!task || task == current_task) {
+        pthread_exit(NULL);
+    }
+
+    /* Only reached by force-deletes after a stop timeout */
+    pthread_cancel(task->thread);
+}
+
+void vTaskDelay(TickType_t ticks) {
+    struct timespec ts = {
+        .tv_sec  = (time_t)(ticks / configTICK_RATE_HZ),
+        .tv_nsec = (long)(ticks % configTICK_RATE_HZ) * (1000000000L / configTICK_RATE_HZ),
+    };
+    while (nanosleep(&ts, &ts) != 0 && errno == EINTR) {
+    }
+}
+
+TickType_t xTaskGetTickCount(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (TickType_t)((uint64_t)ts.tv_sec * configTICK_RATE_HZ + (uint64_t)ts.tv_nsec / (1000000000L / configTICK_RATE_HZ));
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+    return xTaskNotify(task, 0, eIncrement);
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks) {
+    TaskHandle_t    task     = task_current();
+    struct timespec deadline = deadline_from_ticks(ticks);
+
+    pthread_mutex_lock(&task->mutex);
+    while (task->value == 0 && wait_task(task, ticks, &deadline) == 0) {
+    }
+    uint32_t value = task->value;
+    if (value > 0) {
+        task->value = clear_on_exit ? 0 : value - 1;
+    }
+    task->pending = false;
+    pthread_mutex_unlock(&task->mutex);
+
+    return value;
+}
+
+BaseType_t xTaskNotify(TaskHandle_t task, uint32_t value, eNotifyAction action) {
+    if (!task) {
+        return pdFAIL;
+    }
+
+    BaseType_t result = pdPASS;
+
+    pthread_mutex_lock(&task->mutex);
+    switch (action) {
+        case eSetBits:
+            task->value |= value;
+            break;
+        case eIncrement:
+            task->value++;
+            break;
+        case eSetValueWithOverwrite:
+            task->value = value;
+            break;
+        case eSetValueWithoutOverwrite:
+            if (task->pending) {
+                result = pdFAIL;
+            } else {
+                task->value = value;
+            }
+            break;
+        case eNoAction:
+        default:
+            break;
+    }
+    if (result == pdPASS) {
+        task->pending = true;
+        signal_task(task);
+    }
+    pthread_mutex_unlock(&task->mutex);
+
+    return result;
+}
+
+BaseType_t xTaskNotifyWait(uint32_t clear_on_entry, uint32_t clear_on_exit, uint32_t* out_value, TickType_t ticks) {
+    TaskHandle_t    task     = task_current();
+    struct timespec deadline = deadline_from_ticks(ticks);
+
+    pthread_mutex_lock(&task->mutex);
+    if (!task->pending) {
+        task->value &= ~clear_on_entry;
+    }
+    while (!task->pending && wait_task(task, ticks, &deadline) == 0) {
+    }
+    if (out_value) {
+        *out_value = task->value;
+    }
+    BaseType_t result = task->pending ? pdTRUE : pdFALSE;
+    if (task->pending) {
+        task->value &= ~clear_on_exit;
+        task->pending = false;
+    }
+    pthread_mutex_unlock(&task->mutex);
+
+    return result;
+}
+
+/* Semaphore Function Implementations */
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void) {
+    SemaphoreHandle_t sem = (SemaphoreHandle_t)calloc(1, sizeof(*sem));
+    if (!sem) {
+        return NULL;
+    }
+
+    pthread_mutex_init(&sem->mutex, NULL);
+
+    return sem;
+}
+
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex(void) {
+    SemaphoreHandle_t sem = (SemaphoreHandle_t)calloc(1, sizeof(*sem));
+    if (!sem) {
+        return NULL;
+    }
+
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&sem->mutex, &attr);
+    pthread_mutexattr_destroy(&attr);
+
+    return sem;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t sem) {
+    if (!sem) {
+        return;
+    }
+
+    pthread_mutex_destroy(&sem->mutex);
+    free(sem);
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks) {
+    if (!sem) {
+        return pdFALSE;
+    }
+    if (ticks == portMAX_DELAY) {
+        return pthread_mutex_lock(&sem->mutex) == 0 ? pdTRUE : pdFALSE;
+    }
+
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += (time_t)(ticks / configTICK_RATE_HZ);
+    deadline.tv_nsec += (long)(ticks % configTICK_RATE_HZ) * (1000000000L / configTICK_RATE_HZ);
+    if (deadline.tv_nsec >= 1000000000L) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000L;
+    }
+
+    return pthread_mutex_timedlock(&sem->mutex, &deadline) == 0 ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem) {
+    if (!sem) {
+        return pdFALSE;
+    }
+
+    return pthread_mutex_unlock(&sem->mutex) == 0 ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t sem, TickType_t ticks) {
+    return xSemaphoreTake(sem, ticks);
+}
+
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t sem) {
+    return xSemaphoreGive(sem);
+}
+
+/* Helper Function Implementations */
+
+static TaskHandle_t task_alloc(void) {
+    TaskHandle_t task = (TaskHandle_t)calloc(1, sizeof(*task));
+    if (!task) {
+        return NULL;
+    }
+
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&task->cond, &attr);
+    pthread_condattr_destroy(&attr);
+    pthread_mutex_init(&task->mutex, NULL);
+
+    return task;
+}
+
+static TaskHandle_t task_current(void) {
+    if (!current_task) {
+        current_task         = task_alloc();
+        current_task->thread = pthread_self();
+    }
+
+    return current_task;
+}
+
+static void* task_trampoline(void* arg) {
+    TaskHandle_t task = (TaskHandle_t)arg;
+    current_task      = task;
+
+    task->task_func(task->arg);
+
+    return NULL;
+}
+
+static struct timespec deadline_from_ticks(TickType_t ticks) {
+    struct timespec deadline;
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    if (ticks == portMAX_DELAY) {
+        return deadline;
+    }
+
+    deadline.tv_sec += (time_t)(ticks / configTICK_RATE_HZ);
+    deadline.tv_nsec += (long)(ticks % configTICK_RATE_HZ) * (1000000000L / configTICK_RATE_HZ);
+    if (deadline.tv_nsec >= 1000000000L) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000L;
+    }
+
+    return deadline;
+}
+
+/* Returns non-zero once the deadline passed, wakeups before it return 0 */
+static int wait_task(TaskHandle_t task, TickType_t ticks, const struct timespec* deadline) {
+    if (ticks == 0) {
+        return ETIMEDOUT;
+    }
+    if (ticks == portMAX_DELAY) {
+        return pthread_cond_wait(&task->cond, &task->mutex);
+    }
+
+    return pthread_cond_timedwait(&task->cond, &task->mutex, deadline);
+}
+
+static void signal_task(TaskHandle_t task) {
+    pthread_cond_broadcast(&task->cond);
+}
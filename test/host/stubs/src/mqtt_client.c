@@ -0,0 +1,38 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "mqtt_client.h"
+
+static host_stubs_mqtt_publish_t last_publish;
+
+int esp_mqtt_client_publish(
+    esp_mqtt_client_handle_t client,
+    const char*              topic,
+    const char*              data,
+    int                      len,
+    int                      qos,
+    int                      retain
+) {
+    if (!client || !topic) {
+        return -1;
+    }
+    if (len == 0 && data) {
+        len = (int)strlen(data);
+    }
+
+    size_t copy_len = (size_t)len < sizeof(last_publish.data) ? (size_t)len : sizeof(last_publish.data) - 1;
+
+    snprintf(last_publish.topic, sizeof(last_publish.topic), "%s", topic);
+    memcpy(last_publish.data, data, copy_len);
+    last_publish.data[copy_len] = '\0';
+    last_publish.data_len       = len;
+    last_publish.qos            = qos;
+    last_publish.retain         = retain;
+    last_publish.publish_cnt++;
+
+    return (int)last_publish.publish_cnt;
+}
+
+const host_stubs_mqtt_publish_t* host_stubs_mqtt_last_publish(void) {
+    return &last_publish;
+}
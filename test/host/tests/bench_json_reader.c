@@ -0,0 +1,132 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "domain/models/error.h"
+#include "domain/models/wifi.h"
+#include "domain/usecases/settings.h"
+#include "host_test.h"
+#include "presentation/http/dto/settings.h"
+#include "presentation/http/dto/wifiman.h"
+#include "utils/json/reader.h"
+
+#ifdef HOST_TEST_HAVE_CJSON
+#include "cJSON.h"
+#endif
+
+/*
+ * Time per request body for the reader + DTO parse, and for the cJSON
+ * parse + member lookups + delete it replaced when cJSON is available.
+ */
+#define DOC_CNT 200000
+
+typedef struct {
+    const char* name;
+    const char* json;
+    const char* keys[9];
+} body_t;
+
+static const body_t bodies[] = {
+    {
+        .name = "sta_credential",
+        .json = "{\"ssid\":\"haya-office\",\"password\":\"correct horse battery staple\"}",
+        .keys = {"ssid", "password"},
+    },
+    {
+        .name = "scan_config",
+        .json = "{\"ssid\":\"haya-office\",\"bssid\":\"a4:cf:12:3e:90:01\",\"channel\":6,\"passive\":false,\"timeout_ms\":3000,\"max_age_ms\":10000}",
+        .keys = {"ssid", "bssid", "channel", "passive", "timeout_ms", "max_age_ms"},
+    },
+    {
+        .name = "preloaded_update",
+        .json = "{\"wifi_ap_ssid\":\"haya-setup\",\"wifi_ap_pass\":\"haya-setup-pass\",\"mqtt_proto\":\"mqtts\","
+                "\"mqtt_host\":\"broker.local\",\"mqtt_port\":\"8883\",\"mqtt_user\":\"device-0042\","
+                "\"mqtt_pass\":\"s3cr3t\\\"pass\",\"system_restart_after_ms\":5000}",
+        .keys = {"wifi_ap_ssid", "wifi_ap_pass", "mqtt_proto", "mqtt_host", "mqtt_port", "mqtt_user", "mqtt_pass", "system_restart_after_ms"},
+    },
+};
+
+static volatile int sink;
+
+/* Helpers */
+
+static void report(const char* name, const char* body, int64_t elapsed_ns) {
+    printf("%-8s %-18s %8.1f ns/doc\n", name, body, (double)elapsed_ns / DOC_CNT);
+}
+
+static dom_models_error_t reader_parse(size_t body, const char* json, size_t json_len) {
+    utils_json_reader_t r;
+    if (!utils_json_reader_parse(&r, json, json_len)) {
+        return DOMAIN_MODELS_ERROR_BAD_ARGUMENT;
+    }
+
+    switch (body) {
+        case 0: {
+            dom_models_wifi_sta_credential_t out;
+            return pres_http_dto_wifiman_parse_sta_credential(&r, &out);
+        }
+        case 1: {
+            dom_models_wifi_scan_config_t out;
+            return pres_http_dto_wifiman_parse_scan_config(&r, &out);
+        }
+        default: {
+            dom_usecases_settings_preloaded_update_t out;
+            return pres_http_dto_settings_parse_preloaded_update(&r, &out);
+        }
+    }
+}
+
+#ifdef HOST_TEST_HAVE_CJSON
+static int cjson_parse(const body_t* body, size_t json_len) {
+    cJSON* root = cJSON_ParseWithLength(body->json, json_len);
+    int    hits = 0;
+    for (size_t i = 0; root && body->keys[i]; i++) {
+        hits += cJSON_GetObjectItemCaseSensitive(root, body->keys[i]) != NULL;
+    }
+    cJSON_Delete(root);
+
+    return hits;
+}
+#endif
+
+/* Tests */
+
+static void bench_bodies(void) {
+    for (size_t b = 0; b < sizeof(bodies) / sizeof(bodies[0]); b++) {
+        const body_t* body     = &bodies[b];
+        size_t        json_len = strlen(body->json);
+
+        HOST_TEST_CHECK_EQ_INT(reader_parse(b, body->json, json_len), DOMAIN_MODELS_ERROR_OK);
+
+        int64_t start_ns = host_test_now_ns();
+        for (int i = 0; i < DOC_CNT; i++) {
+            sink = reader_parse(b, body->json, json_len);
+        }
+        report("reader", body->name, host_test_now_ns() - start_ns);
+
+#ifdef HOST_TEST_HAVE_CJSON
+        size_t key_cnt = 0;
+        while (body->keys[key_cnt]) {
+            key_cnt++;
+        }
+        HOST_TEST_CHECK_EQ_INT(cjson_parse(body, json_len), key_cnt);
+
+        start_ns = host_test_now_ns();
+        for (int i = 0; i < DOC_CNT; i++) {
+            sink = cjson_parse(body, json_len);
+        }
+        report("cJSON", body->name, host_test_now_ns() - start_ns);
+#endif
+    }
+
+#ifndef HOST_TEST_HAVE_CJSON
+    printf("cJSON baseline skipped (built without cJSON)\n");
+#endif
+}
+
+int main(void) {
+    HOST_TEST_RUN(bench_bodies);
+
+    return HOST_TEST_RESULT();
+}
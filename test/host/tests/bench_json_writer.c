@@ -0,0 +1,116 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "domain/models/messaging.h"
+#include "host_test.h"
+#include "infrastructure/messaging/publish/esp_mqtt_impl_types.h"
+#include "infrastructure/messaging/publish/esp_mqtt_impl_utils.h"
+
+#ifdef HOST_TEST_HAVE_CJSON
+#include "cJSON.h"
+#endif
+
+/*
+ * Time per status and log payload for the writer, and for the cJSON tree
+ * build + print + delete it replaced when cJSON is available. Both sides
+ * must produce the same bytes.
+ */
+#define DOC_CNT 200000
+
+static const dom_models_messaging_status_t status = {
+    .status             = "online",
+    .wifi_connected     = true,
+    .ethernet_connected = false,
+    .ip                 = "192.168.100.200",
+    .rssi_bucket        = 3,
+    .ota_updating       = false,
+};
+
+static const dom_models_messaging_log_t log_line = {
+    .message = "12/03/2026 10:22:31.417 [WARN] [mqtt] reconnect to \"broker.local\" failed\terr=0x7002\nretrying in 4000 ms",
+};
+
+static volatile size_t sink_len;
+
+/* Helpers */
+
+static void report(const char* name, int64_t elapsed_ns) {
+    printf("%-16s %8.1f ns/doc\n", name, (double)elapsed_ns / DOC_CNT);
+}
+
+#ifdef HOST_TEST_HAVE_CJSON
+static size_t cjson_status(char* out, size_t out_size) {
+    cJSON* root = cJSON_CreateObject();
+    cJSON_AddStringToObject(root, "status", status.status);
+    cJSON_AddBoolToObject(root, "wifi_connected", status.wifi_connected);
+    cJSON_AddBoolToObject(root, "ethernet_connected", status.ethernet_connected);
+    cJSON_AddStringToObject(root, "ip", status.ip);
+    cJSON_AddNumberToObject(root, "rssi_bucket", status.rssi_bucket);
+    cJSON_AddBoolToObject(root, "ota_updating", status.ota_updating);
+
+    bool ok = cJSON_PrintPreallocated(root, out, (int)out_size, false);
+    cJSON_Delete(root);
+
+    return ok ? strlen(out) : 0;
+}
+
+static size_t cjson_log(char* out, size_t out_size) {
+    cJSON* root = cJSON_CreateObject();
+    cJSON_AddStringToObject(root, "message", log_line.message);
+
+    bool ok = cJSON_PrintPreallocated(root, out, (int)out_size, false);
+    cJSON_Delete(root);
+
+    return ok ? strlen(out) : 0;
+}
+#endif
+
+/* Tests */
+
+static void bench_payloads(void) {
+    char out[INF_MESSAGING_PUBLISH_ESP_MQTT_IMPL_JSON_MAX_LEN];
+
+    int64_t start_ns = host_test_now_ns();
+    for (int i = 0; i < DOC_CNT; i++) {
+        sink_len = inf_messaging_publish_esp_mqtt_impl_build_status_json(&status, out, sizeof(out));
+    }
+    report("writer status", host_test_now_ns() - start_ns);
+    HOST_TEST_CHECK(sink_len > 0);
+
+    start_ns = host_test_now_ns();
+    for (int i = 0; i < DOC_CNT; i++) {
+        sink_len = inf_messaging_publish_esp_mqtt_impl_build_log_json(&log_line, out, sizeof(out));
+    }
+    report("writer log", host_test_now_ns() - start_ns);
+    HOST_TEST_CHECK(sink_len > 0);
+
+#ifdef HOST_TEST_HAVE_CJSON
+    char expected[INF_MESSAGING_PUBLISH_ESP_MQTT_IMPL_JSON_MAX_LEN];
+
+    start_ns = host_test_now_ns();
+    for (int i = 0; i < DOC_CNT; i++) {
+        sink_len = cjson_status(expected, sizeof(expected));
+    }
+    report("cJSON status", host_test_now_ns() - start_ns);
+    inf_messaging_publish_esp_mqtt_impl_build_status_json(&status, out, sizeof(out));
+    HOST_TEST_CHECK_EQ_STR(out, expected);
+
+    start_ns = host_test_now_ns();
+    for (int i = 0; i < DOC_CNT; i++) {
+        sink_len = cjson_log(expected, sizeof(expected));
+    }
+    report("cJSON log", host_test_now_ns() - start_ns);
+    inf_messaging_publish_esp_mqtt_impl_build_log_json(&log_line, out, sizeof(out));
+    HOST_TEST_CHECK_EQ_STR(out, expected);
+#else
+    printf("cJSON baseline skipped (built without cJSON)\n");
+#endif
+}
+
+int main(void) {
+    HOST_TEST_RUN(bench_payloads);
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,136 @@
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "domain/contracts/logger/leveled.h"
+#include "domain/models/logger.h"
+#include "host_test.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAS_TSC 1
+#else
+#define BENCH_HAS_TSC 0
+#endif
+
+/*
+ * Built with DOM_CONTRACTS_LOGGER_LEVELED_MIN_LEVEL=INFO (see CMakeLists.txt)
+ * so DEBUG calls are compiled out, while INFO calls are suppressed at
+ * runtime by a WARN logger. The unfiltered indirect call into a backend
+ * that discards the line is the baseline.
+ */
+#define CALL_CNT 10000000
+
+static unsigned long backend_call_cnt;
+static unsigned long arg_eval_cnt;
+
+/* Helpers */
+
+__attribute__((noinline)) static void backend_log(
+    dom_contracts_logger_leveled_t* self,
+    const char*                     tag,
+    const char*                     format,
+    ...
+) {
+    (void)self;
+    (void)tag;
+    (void)format;
+
+    backend_call_cnt++;
+}
+
+__attribute__((noinline)) static int expensive_arg(int value) {
+    arg_eval_cnt++;
+
+    return value * 3;
+}
+
+static uint64_t cycles_now(void) {
+#if BENCH_HAS_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+static void report(const char* name, int64_t elapsed_ns, uint64_t elapsed_cycles) {
+    printf(
+        "%-20s %6.2f ns/call %6.2f cycles/call\n",
+        name,
+        (double)elapsed_ns / CALL_CNT,
+        (double)elapsed_cycles / CALL_CNT
+    );
+}
+
+/* Tests */
+
+static void bench_suppressed_calls(void) {
+    dom_contracts_logger_leveled_t logger = {
+        .level = DOMAIN_MODELS_LOGGER_LEVEL_WARN,
+        .error = backend_log,
+        .warn  = backend_log,
+        .info  = backend_log,
+        .debug = backend_log,
+    };
+    dom_contracts_logger_leveled_t* volatile logger_ref = &logger;
+
+    HOST_TEST_CHECK_EQ_INT(DOM_CONTRACTS_LOGGER_LEVELED_MIN_LEVEL, DOMAIN_MODELS_LOGGER_LEVEL_INFO);
+
+    int64_t  start_ns     = host_test_now_ns();
+    uint64_t start_cycles = cycles_now();
+    for (int i = 0; i < CALL_CNT; i++) {
+        DOM_CONTRACTS_LOGGER_LEVELED_DEBUG(logger_ref, "bench", "value=%d", expensive_arg(i));
+    }
+    report("compiled out", host_test_now_ns() - start_ns, cycles_now() - start_cycles);
+
+    start_ns     = host_test_now_ns();
+    start_cycles = cycles_now();
+    for (int i = 0; i < CALL_CNT; i++) {
+        DOM_CONTRACTS_LOGGER_LEVELED_INFO(logger_ref, "bench", "value=%d", expensive_arg(i));
+    }
+    report("runtime suppressed", host_test_now_ns() - start_ns, cycles_now() - start_cycles);
+
+    HOST_TEST_CHECK_EQ_INT(backend_call_cnt, 0);
+    HOST_TEST_CHECK_EQ_INT(arg_eval_cnt, 0);
+
+    start_ns     = host_test_now_ns();
+    start_cycles = cycles_now();
+    for (int i = 0; i < CALL_CNT; i++) {
+        dom_contracts_logger_leveled_t* self = logger_ref;
+        self->info(self, "bench", "value=%d", expensive_arg(i));
+    }
+    report("backend call", host_test_now_ns() - start_ns, cycles_now() - start_cycles);
+
+    HOST_TEST_CHECK_EQ_INT(backend_call_cnt, CALL_CNT);
+    HOST_TEST_CHECK_EQ_INT(arg_eval_cnt, CALL_CNT);
+}
+
+static void test_enabled_levels_reach_backend(void) {
+    dom_contracts_logger_leveled_t logger = {
+        .level = DOMAIN_MODELS_LOGGER_LEVEL_DEBUG,
+        .error = backend_log,
+        .warn  = backend_log,
+        .info  = backend_log,
+        .debug = backend_log,
+    };
+
+    backend_call_cnt = 0;
+    DOM_CONTRACTS_LOGGER_LEVELED_ERROR(&logger, "test", "error");
+    DOM_CONTRACTS_LOGGER_LEVELED_WARN(&logger, "test", "warn");
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(&logger, "test", "info");
+    DOM_CONTRACTS_LOGGER_LEVELED_DEBUG(&logger, "test", "debug");
+    HOST_TEST_CHECK_EQ_INT(backend_call_cnt, 3);
+
+    logger.level     = DOMAIN_MODELS_LOGGER_LEVEL_NONE;
+    backend_call_cnt = 0;
+    DOM_CONTRACTS_LOGGER_LEVELED_ERROR(&logger, "test", "error");
+    DOM_CONTRACTS_LOGGER_LEVELED_ERROR((dom_contracts_logger_leveled_t*)NULL, "test", "error");
+    HOST_TEST_CHECK_EQ_INT(backend_call_cnt, 0);
+}
+
+int main(void) {
+    HOST_TEST_RUN(bench_suppressed_calls);
+    HOST_TEST_RUN(test_enabled_levels_reach_backend);
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,215 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "esp_http_server.h"
+#include "esp_timer.h"
+#include "host_test.h"
+#include "presentation/http/admission.h"
+
+#define READ      PRES_HTTP_ADMISSION_CLASS_READ
+#define EXPENSIVE PRES_HTTP_ADMISSION_CLASS_EXPENSIVE
+
+/*
+ * Server side ends of loopback connections from two client addresses, so
+ * getpeername tells the clients apart the way it does on the device.
+ */
+static int listener = -1;
+static int client_a = -1;
+static int client_b = -1;
+static int peers[2] = {-1, -1};
+
+/* Helpers */
+
+static int accept_from(const char* addr) {
+    struct sockaddr_in local = {.sin_family = AF_INET};
+    socklen_t          len   = sizeof(local);
+    getsockname(listener, (struct sockaddr*)&local, &len);
+
+    struct sockaddr_in bind_addr = {.sin_family = AF_INET};
+    inet_pton(AF_INET, addr, &bind_addr.sin_addr);
+
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0 || bind(fd, (struct sockaddr*)&bind_addr, sizeof(bind_addr)) != 0 ||
+        connect(fd, (struct sockaddr*)&local, sizeof(local)) != 0) {
+        return -1;
+    }
+    if (client_a < 0) {
+        client_a = fd;
+    } else {
+        client_b = fd;
+    }
+
+    return accept(listener, NULL, NULL);
+}
+
+static bool open_peers(void) {
+    struct sockaddr_in local = {.sin_family = AF_INET};
+    inet_pton(AF_INET, "127.0.0.1", &local.sin_addr);
+
+    listener = socket(AF_INET, SOCK_STREAM, 0);
+    if (listener < 0 || bind(listener, (struct sockaddr*)&local, sizeof(local)) != 0 || listen(listener, 2) != 0) {
+        return false;
+    }
+
+    peers[0] = accept_from("127.0.0.2");
+    peers[1] = accept_from("127.0.0.3");
+
+    return peers[0] > 0 && peers[1] > 0;
+}
+
+static void close_peers(void) {
+    int fds[] = {peers[0], peers[1], client_a, client_b, listener};
+    for (size_t i = 0; i < sizeof(fds) / sizeof(fds[0]); i++) {
+        if (fds[i] >= 0) {
+            close(fds[i]);
+        }
+    }
+}
+
+static pres_http_admission_t* new_admission(pres_http_admission_limit_t client, pres_http_admission_limit_t shared) {
+    pres_http_admission_config_t config = {0};
+    config.client[READ]                 = client;
+    config.shared[READ]                 = shared;
+    config.client[EXPENSIVE]            = client;
+    config.shared[EXPENSIVE]            = shared;
+
+    return pres_http_admission_new(&config);
+}
+
+static bool admit(pres_http_admission_t* admission, int peer, pres_http_admission_class_t cls, uint32_t* retry_after_s) {
+    httpd_req_t req = {.host_sockfd = peer};
+    *retry_after_s  = 0;
+
+    return pres_http_admission_admit(admission, &req, cls, retry_after_s);
+}
+
+static void advance_ms(int64_t ms) {
+    host_stubs_clock_advance_us(ms * 1000);
+}
+
+/* Tests */
+
+static void test_burst_then_refill(void) {
+    pres_http_admission_t* admission = new_admission((pres_http_admission_limit_t){.burst = 2, .per_min = 6}, (pres_http_admission_limit_t){0});
+    uint32_t               retry_s   = 0;
+
+    HOST_TEST_CHECK(admit(admission, peers[0], READ, &retry_s));
+    HOST_TEST_CHECK(admit(admission, peers[0], READ, &retry_s));
+    HOST_TEST_CHECK(!admit(admission, peers[0], READ, &retry_s));
+    HOST_TEST_CHECK_EQ_INT(retry_s, 10);
+
+    /* Half a token per five seconds, the remainder carries over */
+    advance_ms(5000);
+    HOST_TEST_CHECK(!admit(admission, peers[0], READ, &retry_s));
+    HOST_TEST_CHECK_EQ_INT(retry_s, 5);
+    advance_ms(5000);
+    HOST_TEST_CHECK(admit(admission, peers[0], READ, &retry_s));
+    HOST_TEST_CHECK(!admit(admission, peers[0], READ, &retry_s));
+
+    /* A long idle stretch refills no more than the burst */
+    advance_ms(3600 * 1000);
+    HOST_TEST_CHECK(admit(admission, peers[0], READ, &retry_s));
+    HOST_TEST_CHECK(admit(admission, peers[0], READ, &retry_s));
+    HOST_TEST_CHECK(!admit(admission, peers[0], READ, &retry_s));
+
+    pres_http_admission_delete(admission);
+}
+
+static void test_retry_after_rounds_up(void) {
+    uint32_t retry_s = 0;
+
+    /* 8571.4 ms per token */
+    pres_http_admission_t* admission = new_admission((pres_http_admission_limit_t){.burst = 1, .per_min = 7}, (pres_http_admission_limit_t){0});
+    HOST_TEST_CHECK(admit(admission, peers[0], READ, &retry_s));
+    HOST_TEST_CHECK(!admit(admission, peers[0], READ, &retry_s));
+    HOST_TEST_CHECK_EQ_INT(retry_s, 9);
+
+    /* Whatever is left of the last second still counts as one */
+    advance_ms(8400);
+    HOST_TEST_CHECK(!admit(admission, peers[0], READ, &retry_s));
+    HOST_TEST_CHECK_EQ_INT(retry_s, 1);
+    pres_http_admission_delete(admission);
+
+    /* Exactly a second is not rounded up to two */
+    admission = new_admission((pres_http_admission_limit_t){.burst = 1, .per_min = 60}, (pres_http_admission_limit_t){0});
+    HOST_TEST_CHECK(admit(admission, peers[0], READ, &retry_s));
+    HOST_TEST_CHECK(!admit(admission, peers[0], READ, &retry_s));
+    HOST_TEST_CHECK_EQ_INT(retry_s, 1);
+    pres_http_admission_delete(admission);
+}
+
+static void test_clients_have_own_buckets(void) {
+    pres_http_admission_t* admission = new_admission((pres_http_admission_limit_t){.burst = 1, .per_min = 6}, (pres_http_admission_limit_t){0});
+    uint32_t               retry_s   = 0;
+
+    HOST_TEST_CHECK(admit(admission, peers[0], READ, &retry_s));
+    HOST_TEST_CHECK(!admit(admission, peers[0], READ, &retry_s));
+    HOST_TEST_CHECK(admit(admission, peers[1], READ, &retry_s));
+
+    /* Classes do not share tokens either */
+    HOST_TEST_CHECK(admit(admission, peers[0], EXPENSIVE, &retry_s));
+
+    /* Without a readable address every request lands on the same entry */
+    HOST_TEST_CHECK(admit(admission, 0, READ, &retry_s));
+    HOST_TEST_CHECK(!admit(admission, 0, READ, &retry_s));
+
+    pres_http_admission_delete(admission);
+}
+
+static void test_shared_bucket_caps_all_clients(void) {
+    pres_http_admission_t* admission = new_admission((pres_http_admission_limit_t){.burst = 1, .per_min = 1}, (pres_http_admission_limit_t){.burst = 1, .per_min = 6});
+    uint32_t               retry_s   = 0;
+
+    HOST_TEST_CHECK(admit(admission, peers[0], EXPENSIVE, &retry_s));
+    HOST_TEST_CHECK(!admit(admission, peers[1], EXPENSIVE, &retry_s));
+    HOST_TEST_CHECK_EQ_INT(retry_s, 10);
+
+    /* The refusal took nothing from the second client, once the shared bucket refills it gets in */
+    advance_ms(10000);
+    HOST_TEST_CHECK(admit(admission, peers[1], EXPENSIVE, &retry_s));
+
+    /* Refused on both, the longer wait is reported */
+    HOST_TEST_CHECK(!admit(admission, peers[1], EXPENSIVE, &retry_s));
+    HOST_TEST_CHECK_EQ_INT(retry_s, 60);
+
+    pres_http_admission_delete(admission);
+}
+
+static void test_zero_rate_never_limits(void) {
+    pres_http_admission_t* admission = new_admission((pres_http_admission_limit_t){.burst = 1, .per_min = 0}, (pres_http_admission_limit_t){0});
+    uint32_t               retry_s   = 0;
+
+    bool all_admitted = true;
+    for (int i = 0; i < 1000; i++) {
+        all_admitted &= admit(admission, peers[0], READ, &retry_s);
+    }
+    HOST_TEST_CHECK(all_admitted);
+    HOST_TEST_CHECK(pres_http_admission_admit(NULL, NULL, READ, NULL));
+
+    pres_http_admission_delete(admission);
+}
+
+int main(void) {
+    if (!open_peers()) {
+        fprintf(stderr, "loopback sockets unavailable\n");
+        close_peers();
+        return 1;
+    }
+
+    HOST_TEST_RUN(test_burst_then_refill);
+    HOST_TEST_RUN(test_retry_after_rounds_up);
+    HOST_TEST_RUN(test_clients_have_own_buckets);
+    HOST_TEST_RUN(test_shared_bucket_caps_all_clients);
+    HOST_TEST_RUN(test_zero_rate_never_limits);
+
+    close_peers();
+
+    return HOST_TEST_RESULT();
+}
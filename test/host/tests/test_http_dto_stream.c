@@ -0,0 +1,205 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "domain/models/error.h"
+#include "domain/models/network.h"
+#include "esp_err.h"
+#include "esp_http_server.h"
+#include "host_test.h"
+#include "presentation/http/dto/common.h"
+#include "presentation/http/dto/netif.h"
+#include "presentation/http/metrics.h"
+#include "utils/json/reader.h"
+#include "utils/json/writer.h"
+
+#define DOC_MAX_LEN 32768
+
+static dom_models_network_t network;
+static size_t               sent_len;
+
+/* Fakes for the metrics hooks, the router they hang off is not built here */
+
+esp_err_t pres_http_metrics_set_status(httpd_req_t* req, const char* status) {
+    return httpd_resp_set_status(req, status);
+}
+
+void pres_http_metrics_count_sent(httpd_req_t* req, size_t len) {
+    (void)req;
+    sent_len += len;
+}
+
+/* Helpers */
+
+/* The largest model the netif DTO can be handed */
+static void fill_network(void) {
+    memset(&network, 0, sizeof(network));
+    network.total_count = DOM_MODELS_NETWORK_MAX_INTERFACES;
+    network.count       = DOM_MODELS_NETWORK_MAX_INTERFACES;
+
+    for (size_t i = 0; i < DOM_MODELS_NETWORK_MAX_INTERFACES; i++) {
+        dom_models_network_interface_t* itf = &network.interfaces[i];
+
+        snprintf(itf->if_key, sizeof(itf->if_key), "IF_KEY_%zu", i);
+        snprintf(itf->desc, sizeof(itf->desc), "iface \"%zu\"\\\t", i);
+        itf->hostname_available = true;
+        snprintf(itf->hostname, sizeof(itf->hostname), "haya-%zu", i);
+        itf->type          = (dom_models_network_interface_type_t)(i % 7);
+        itf->flags         = 0x1ff;
+        itf->is_default    = i == 0;
+        itf->is_up         = true;
+        itf->mac_available = true;
+        itf->mac[5]        = (uint8_t)i;
+        itf->mtu_available = true;
+        itf->mtu           = 1500;
+
+        itf->ipv4.available     = true;
+        itf->ipv4.ip[0]         = 192;
+        itf->ipv4.ip[3]         = (uint8_t)i;
+        itf->dns[0].available   = true;
+        itf->dns[0].addr.family = DOM_MODELS_NETWORK_IP_FAMILY_IPV4;
+
+        itf->ipv6_count           = DOM_MODELS_NETWORK_IPV6_MAX;
+        itf->preferred_ipv6_count = DOM_MODELS_NETWORK_IPV6_MAX;
+        for (size_t j = 0; j < DOM_MODELS_NETWORK_IPV6_MAX; j++) {
+            itf->ipv6[j].available         = true;
+            itf->ipv6[j].addr[0]           = 0xfe;
+            itf->ipv6[j].addr[15]          = (uint8_t)j;
+            itf->preferred_ipv6[j]         = itf->ipv6[j];
+            itf->preferred_ipv6[j].addr[0] = 0x20;
+        }
+    }
+}
+
+static size_t write_one_shot(char* out, size_t out_size) {
+    utils_json_writer_t w;
+    utils_json_writer_init(&w, out, out_size);
+    pres_http_dto_netif_write_network(&w, &network);
+
+    return utils_json_writer_finish(&w);
+}
+
+/* Tests */
+
+static void test_stream_matches_one_shot(void) {
+    static char expected[DOC_MAX_LEN];
+    size_t      expected_len = write_one_shot(expected, sizeof(expected));
+    HOST_TEST_CHECK(expected_len > PRES_HTTP_DTO_COMMON_STREAM_SCRATCH_LEN * 4);
+
+    httpd_req_t                   req = {0};
+    pres_http_dto_common_stream_t stream;
+
+    host_stubs_httpd_response_reset(0);
+    sent_len = 0;
+
+    utils_json_writer_t* w = pres_http_dto_common_stream_begin(&stream, &req);
+    HOST_TEST_CHECK(w != NULL);
+    if (!w) {
+        return;
+    }
+    HOST_TEST_CHECK(pres_http_dto_netif_write_network(w, &network));
+    HOST_TEST_CHECK_EQ_INT(pres_http_dto_common_stream_end(&stream), ESP_OK);
+
+    const host_stubs_httpd_response_t* resp = host_stubs_httpd_response();
+    printf("%zu bytes in %zu chunks from a %d byte scratch\n", resp->body_len, resp->chunk_cnt, PRES_HTTP_DTO_COMMON_STREAM_SCRATCH_LEN);
+
+    HOST_TEST_CHECK(resp->finished);
+    HOST_TEST_CHECK_EQ_STR(resp->type, "application/json");
+    HOST_TEST_CHECK_EQ_INT(resp->body_len, expected_len);
+    HOST_TEST_CHECK_EQ_STR(resp->body, expected);
+    HOST_TEST_CHECK(resp->chunk_cnt > 1);
+    HOST_TEST_CHECK(resp->chunk_max_len <= PRES_HTTP_DTO_COMMON_STREAM_SCRATCH_LEN);
+    HOST_TEST_CHECK_EQ_INT(sent_len, expected_len);
+}
+
+static void test_failed_chunk_cuts_response_short(void) {
+    httpd_req_t                   req = {0};
+    pres_http_dto_common_stream_t stream;
+
+    host_stubs_httpd_response_reset(2);
+
+    utils_json_writer_t* w = pres_http_dto_common_stream_begin(&stream, &req);
+    HOST_TEST_CHECK(w != NULL);
+    if (!w) {
+        return;
+    }
+    HOST_TEST_CHECK(!pres_http_dto_netif_write_network(w, &network));
+    HOST_TEST_CHECK_EQ_INT(pres_http_dto_common_stream_end(&stream), ESP_FAIL);
+
+    const host_stubs_httpd_response_t* resp = host_stubs_httpd_response();
+    HOST_TEST_CHECK(resp->finished);
+    HOST_TEST_CHECK_EQ_INT(resp->chunk_cnt, 2);
+}
+
+static void test_domain_error_body(void) {
+    httpd_req_t req = {0};
+
+    host_stubs_httpd_response_reset(0);
+    HOST_TEST_CHECK_EQ_INT(pres_http_dto_common_send_domain_error(&req, DOMAIN_MODELS_ERROR_NOT_FOUND), ESP_OK);
+
+    const host_stubs_httpd_response_t* resp = host_stubs_httpd_response();
+    HOST_TEST_CHECK_EQ_STR(resp->status, "404 Not Found");
+    HOST_TEST_CHECK(strncmp(resp->body, "{\"error\":\"", 10) == 0);
+    HOST_TEST_CHECK(resp->finished);
+}
+
+static void test_recv_json(void) {
+    static const char                  body_json[] = "{\"ssid\":\"home\",\"channel\":6}";
+    static pres_http_dto_common_body_t body;
+    httpd_req_t                        req = {
+        .content_len = sizeof(body_json) - 1,
+        .host_body   = body_json,
+    };
+
+    HOST_TEST_CHECK_EQ_INT(pres_http_dto_common_recv_json(&req, &body), DOMAIN_MODELS_ERROR_OK);
+    HOST_TEST_CHECK(utils_json_reader_is_object(&body.reader));
+
+    httpd_req_t empty = {0};
+    HOST_TEST_CHECK_EQ_INT(pres_http_dto_common_recv_json(&empty, &body), DOMAIN_MODELS_ERROR_OK);
+    HOST_TEST_CHECK(utils_json_reader_empty(&body.reader));
+
+    httpd_req_t oversized = {
+        .content_len = PRES_HTTP_DTO_COMMON_MAX_BODY_LEN + 1,
+        .host_body   = body_json,
+    };
+    HOST_TEST_CHECK_EQ_INT(pres_http_dto_common_recv_json(&oversized, &body), DOMAIN_MODELS_ERROR_BAD_ARGUMENT);
+
+    static const char broken_json[] = "{\"ssid\":";
+    httpd_req_t       broken        = {
+        .content_len = sizeof(broken_json) - 1,
+        .host_body   = broken_json,
+    };
+    HOST_TEST_CHECK_EQ_INT(pres_http_dto_common_recv_json(&broken, &body), DOMAIN_MODELS_ERROR_BAD_ARGUMENT);
+}
+
+static void test_query_u32(void) {
+    httpd_req_t req   = {.host_query = "offset=16&limit=4294967295&bad=1x&big=4294967296"};
+    uint32_t    value = 7;
+
+    HOST_TEST_CHECK_EQ_INT(pres_http_dto_common_query_u32(&req, "offset", &value), DOMAIN_MODELS_ERROR_OK);
+    HOST_TEST_CHECK_EQ_INT(value, 16);
+    HOST_TEST_CHECK_EQ_INT(pres_http_dto_common_query_u32(&req, "limit", &value), DOMAIN_MODELS_ERROR_OK);
+    HOST_TEST_CHECK_EQ_INT(value, UINT32_MAX);
+
+    /* A missing key leaves the default in place */
+    value = 7;
+    HOST_TEST_CHECK_EQ_INT(pres_http_dto_common_query_u32(&req, "page", &value), DOMAIN_MODELS_ERROR_OK);
+    HOST_TEST_CHECK_EQ_INT(value, 7);
+
+    HOST_TEST_CHECK_EQ_INT(pres_http_dto_common_query_u32(&req, "bad", &value), DOMAIN_MODELS_ERROR_BAD_ARGUMENT);
+    HOST_TEST_CHECK_EQ_INT(pres_http_dto_common_query_u32(&req, "big", &value), DOMAIN_MODELS_ERROR_BAD_ARGUMENT);
+    HOST_TEST_CHECK_EQ_INT(value, 7);
+}
+
+int main(void) {
+    fill_network();
+
+    HOST_TEST_RUN(test_stream_matches_one_shot);
+    HOST_TEST_RUN(test_failed_chunk_cuts_response_short);
+    HOST_TEST_RUN(test_domain_error_body);
+    HOST_TEST_RUN(test_recv_json);
+    HOST_TEST_RUN(test_query_u32);
+
+    return HOST_TEST_RESULT();
+}
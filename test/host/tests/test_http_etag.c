@@ -0,0 +1,202 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "domain/models/wifi.h"
+#include "esp_err.h"
+#include "esp_http_server.h"
+#include "esp_timer.h"
+#include "host_test.h"
+#include "presentation/http/etag.h"
+#include "presentation/http/metrics.h"
+
+#define TAG "\"0badf00d-1-0\""
+
+/* Fake for the metrics hook, the router it hangs off is not built here */
+
+esp_err_t pres_http_metrics_set_status(httpd_req_t* req, const char* status) {
+    return httpd_resp_set_status(req, status);
+}
+
+/* Helpers */
+
+static bool requested(const char* if_none_match, const char* tag) {
+    const char* headers[] = {"If-None-Match", if_none_match, NULL};
+    httpd_req_t req       = {.host_headers = if_none_match ? headers : NULL};
+
+    return pres_http_etag_requested(&req, tag);
+}
+
+static bool match(const pres_http_etag_t* etag, const char* if_none_match, char out[PRES_HTTP_ETAG_MAX_LEN]) {
+    const char* headers[] = {"If-None-Match", if_none_match, NULL};
+    httpd_req_t req       = {.host_headers = if_none_match ? headers : NULL};
+
+    return pres_http_etag_match(&req, etag, out);
+}
+
+/* Tests */
+
+static void test_single_tag(void) {
+    HOST_TEST_CHECK(requested(TAG, TAG));
+    HOST_TEST_CHECK(!requested(NULL, TAG));
+    HOST_TEST_CHECK(!requested("", TAG));
+    HOST_TEST_CHECK(!requested(TAG, ""));
+    HOST_TEST_CHECK(!requested(TAG, NULL));
+}
+
+static void test_tag_in_list(void) {
+    HOST_TEST_CHECK(requested("\"a\", " TAG, TAG));
+    HOST_TEST_CHECK(requested("\"a\"," TAG ",\"b\"", TAG));
+    HOST_TEST_CHECK(requested("\t\"a\" ,\t" TAG, TAG));
+    HOST_TEST_CHECK(requested(", ," TAG ",", TAG));
+    HOST_TEST_CHECK(!requested("\"a\", \"b\"", TAG));
+}
+
+static void test_weak_prefix_is_ignored(void) {
+    HOST_TEST_CHECK(requested("W/" TAG, TAG));
+    HOST_TEST_CHECK(requested("\"a\", W/" TAG, TAG));
+    HOST_TEST_CHECK(!requested("w/" TAG, TAG));
+}
+
+static void test_wildcard_matches_anything(void) {
+    HOST_TEST_CHECK(requested("*", TAG));
+    HOST_TEST_CHECK(requested("\"a\", *", TAG));
+}
+
+static void test_only_whole_entries_match(void) {
+    HOST_TEST_CHECK(!requested("\"0badf00d-1-0\"\"", "\"0badf00d-1\""));
+    HOST_TEST_CHECK(!requested("\"0badf00d-1-01\"", TAG));
+    HOST_TEST_CHECK(!requested("\"badf00d-1-0\"", TAG));
+    HOST_TEST_CHECK(!requested("0badf00d-1-0", TAG));
+}
+
+static void test_malformed_entries(void) {
+    /* An unterminated quote ends the list, nothing after it is trusted */
+    HOST_TEST_CHECK(!requested("\"a, " TAG, TAG));
+    HOST_TEST_CHECK(!requested(TAG "\"", "\"x\""));
+
+    /* An unquoted entry is skipped up to the next comma */
+    HOST_TEST_CHECK(requested("bogus, " TAG, TAG));
+    HOST_TEST_CHECK(requested("bogus\"q\"x, " TAG, TAG));
+    HOST_TEST_CHECK(!requested("bogus" TAG, TAG));
+}
+
+static void test_long_list_is_not_matched(void) {
+    char list[PRES_HTTP_ETAG_IF_NONE_MATCH_MAX_LEN + 16];
+    memset(list, ' ', sizeof(list));
+    snprintf(&list[sizeof(list) - sizeof(TAG)], sizeof(TAG), "%s", TAG);
+
+    /* Lists that do not fit the buffer only cost a full response */
+    HOST_TEST_CHECK(!requested(list, TAG));
+    HOST_TEST_CHECK(requested(&list[sizeof(list) - PRES_HTTP_ETAG_IF_NONE_MATCH_MAX_LEN], TAG));
+}
+
+static void test_match_formats_current_tag(void) {
+    pres_http_etag_t etag;
+    pres_http_etag_init(&etag, 0);
+
+    char expected[PRES_HTTP_ETAG_MAX_LEN];
+    snprintf(expected, sizeof(expected), "\"%08" PRIx32 "-0-0\"", etag.boot_id);
+
+    char tag[PRES_HTTP_ETAG_MAX_LEN];
+    HOST_TEST_CHECK(!match(&etag, NULL, tag));
+    HOST_TEST_CHECK_EQ_STR(tag, expected);
+    HOST_TEST_CHECK(match(&etag, expected, tag));
+
+    HOST_TEST_CHECK(!match(NULL, expected, tag));
+    HOST_TEST_CHECK_EQ_STR(tag, "");
+}
+
+static void test_bump_invalidates_tag(void) {
+    pres_http_etag_t etag;
+    pres_http_etag_init(&etag, 0);
+
+    char before[PRES_HTTP_ETAG_MAX_LEN];
+    char after[PRES_HTTP_ETAG_MAX_LEN];
+    match(&etag, NULL, before);
+
+    pres_http_etag_bump(&etag);
+    HOST_TEST_CHECK(!match(&etag, before, after));
+    HOST_TEST_CHECK(strcmp(before, after) != 0);
+    HOST_TEST_CHECK_EQ_INT(pres_http_etag_generation(&etag), 1);
+
+    dom_models_wifi_event_t event = {0};
+    pres_http_etag_on_wifi_event(&etag, &event);
+    HOST_TEST_CHECK(!match(&etag, after, before));
+    HOST_TEST_CHECK_EQ_INT(pres_http_etag_generation(&etag), 2);
+}
+
+static void test_boot_id_separates_boots(void) {
+    pres_http_etag_t first;
+    pres_http_etag_t second;
+    pres_http_etag_init(&first, 0);
+    pres_http_etag_init(&second, 0);
+
+    char first_tag[PRES_HTTP_ETAG_MAX_LEN];
+    char second_tag[PRES_HTTP_ETAG_MAX_LEN];
+    match(&first, NULL, first_tag);
+    HOST_TEST_CHECK(!match(&second, first_tag, second_tag));
+}
+
+static void test_revalidate_window_rolls_over(void) {
+    pres_http_etag_t drifting;
+    pres_http_etag_t fixed;
+    pres_http_etag_init(&drifting, 1000);
+    pres_http_etag_init(&fixed, 0);
+
+    /* Start just past a window boundary so the checks below do not straddle one */
+    int64_t into_ms = (esp_timer_get_time() / 1000) % 1000;
+    host_stubs_clock_advance_us((1000 - into_ms + 10) * 1000);
+
+    char drifting_tag[PRES_HTTP_ETAG_MAX_LEN];
+    char fixed_tag[PRES_HTTP_ETAG_MAX_LEN];
+    char tag[PRES_HTTP_ETAG_MAX_LEN];
+    match(&drifting, NULL, drifting_tag);
+    match(&fixed, NULL, fixed_tag);
+
+    host_stubs_clock_advance_us(500 * 1000);
+    HOST_TEST_CHECK(match(&drifting, drifting_tag, tag));
+
+    host_stubs_clock_advance_us(500 * 1000);
+    HOST_TEST_CHECK(!match(&drifting, drifting_tag, tag));
+    HOST_TEST_CHECK(match(&fixed, fixed_tag, tag));
+
+    host_stubs_clock_advance_us(3600 * 1000000LL);
+    HOST_TEST_CHECK(match(&fixed, fixed_tag, tag));
+}
+
+static void test_not_modified_response(void) {
+    httpd_req_t req = {0};
+    host_stubs_httpd_response_reset(0);
+
+    HOST_TEST_CHECK_EQ_INT(pres_http_etag_send_not_modified(&req, TAG), ESP_OK);
+
+    const host_stubs_httpd_response_t* resp = host_stubs_httpd_response();
+    HOST_TEST_CHECK_EQ_STR(resp->status, "304 Not Modified");
+    HOST_TEST_CHECK_EQ_STR(host_stubs_httpd_response_header("ETag"), TAG);
+    HOST_TEST_CHECK_EQ_STR(host_stubs_httpd_response_header("Cache-Control"), "no-cache");
+    HOST_TEST_CHECK_EQ_INT(resp->body_len, 0);
+    HOST_TEST_CHECK(resp->finished);
+
+    host_stubs_httpd_response_reset(0);
+    pres_http_etag_set_header(&req, "");
+    HOST_TEST_CHECK(host_stubs_httpd_response_header("ETag") == NULL);
+}
+
+int main(void) {
+    HOST_TEST_RUN(test_single_tag);
+    HOST_TEST_RUN(test_tag_in_list);
+    HOST_TEST_RUN(test_weak_prefix_is_ignored);
+    HOST_TEST_RUN(test_wildcard_matches_anything);
+    HOST_TEST_RUN(test_only_whole_entries_match);
+    HOST_TEST_RUN(test_malformed_entries);
+    HOST_TEST_RUN(test_long_list_is_not_matched);
+    HOST_TEST_RUN(test_match_formats_current_tag);
+    HOST_TEST_RUN(test_bump_invalidates_tag);
+    HOST_TEST_RUN(test_boot_id_separates_boots);
+    HOST_TEST_RUN(test_revalidate_window_rolls_over);
+    HOST_TEST_RUN(test_not_modified_response);
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,257 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "esp_err.h"
+#include "esp_http_server.h"
+#include "host_test.h"
+#include "presentation/http/admission.h"
+#include "presentation/http/metrics.h"
+#include "presentation/http/router.h"
+
+#define COLLIDING_CNT 3
+
+typedef struct {
+    const char* name;
+    uint32_t    call_cnt;
+    const void* seen_ctx;
+} route_ctx_t;
+
+static host_stubs_httpd_server_t server;
+
+/* Helpers */
+
+static esp_err_t route_handler(httpd_req_t* req) {
+    route_ctx_t* ctx = (route_ctx_t*)req->user_ctx;
+    ctx->call_cnt++;
+    ctx->seen_ctx = req->user_ctx;
+
+    return httpd_resp_send(req, ctx->name, HTTPD_RESP_USE_STRLEN);
+}
+
+static esp_err_t add(pres_http_router_t* router, const char* uri, httpd_method_t method, route_ctx_t* ctx) {
+    httpd_uri_t route = {
+        .uri      = uri,
+        .method   = method,
+        .handler  = route_handler,
+        .user_ctx = ctx,
+    };
+
+    return pres_http_router_add(router, &route, PRES_HTTP_ADMISSION_CLASS_READ);
+}
+
+/* Runs the request through the wildcard handler registered for its method, as the server would */
+static esp_err_t serve(httpd_method_t method, const char* uri) {
+    for (size_t i = 0; i < server.uri_cnt; i++) {
+        if (server.uris[i].method != method) {
+            continue;
+        }
+
+        httpd_req_t req = {
+            .handle   = &server,
+            .method   = method,
+            .user_ctx = server.uris[i].user_ctx,
+        };
+        snprintf((char*)req.uri, sizeof(req.uri), "%s", uri);
+        host_stubs_httpd_response_reset(0);
+
+        return server.uris[i].handler(&req);
+    }
+
+    return ESP_ERR_NOT_FOUND;
+}
+
+/* Same FNV-1a over path and method as the router, to pick URIs that share a home slot */
+static size_t home_slot(httpd_method_t method, const char* path) {
+    uint32_t hash = 2166136261u;
+    for (const char* c = path; *c != '\0'; c++) {
+        hash ^= (uint8_t)*c;
+        hash *= 16777619u;
+    }
+    hash ^= (uint32_t)method;
+    hash *= 16777619u;
+
+    return hash & (PRES_HTTP_ROUTER_SLOT_CNT - 1);
+}
+
+static size_t slot_of(const pres_http_router_t* router, const pres_http_router_slot_t* slot) {
+    return (size_t)(slot - router->slots);
+}
+
+static pres_http_router_t* new_registered(pres_http_metrics_t* metrics) {
+    memset(&server, 0, sizeof(server));
+
+    pres_http_router_t* router = pres_http_router_new(metrics, NULL);
+    HOST_TEST_CHECK(router != NULL);
+    server.global_user_ctx = router;
+    HOST_TEST_CHECK_EQ_INT(pres_http_router_register(&server, router), ESP_OK);
+    HOST_TEST_CHECK_EQ_INT(server.uri_cnt, PRES_HTTP_ROUTER_HANDLER_CNT);
+
+    return router;
+}
+
+/* Tests */
+
+static void test_dispatches_to_route(void) {
+    pres_http_router_t* router = new_registered(NULL);
+    route_ctx_t         status = {.name = "status"};
+    route_ctx_t         scan   = {.name = "scan"};
+
+    HOST_TEST_CHECK_EQ_INT(add(router, "/api/wifi/status", HTTP_GET, &status), ESP_OK);
+    HOST_TEST_CHECK_EQ_INT(add(router, "/api/wifi/scan", HTTP_POST, &scan), ESP_OK);
+
+    HOST_TEST_CHECK_EQ_INT(serve(HTTP_GET, "/api/wifi/status?verbose=1"), ESP_OK);
+    HOST_TEST_CHECK_EQ_STR(host_stubs_httpd_response()->body, "status");
+    HOST_TEST_CHECK_EQ_INT(status.call_cnt, 1);
+    HOST_TEST_CHECK(status.seen_ctx == &status);
+
+    HOST_TEST_CHECK_EQ_INT(serve(HTTP_POST, "/api/wifi/scan"), ESP_OK);
+    HOST_TEST_CHECK_EQ_STR(host_stubs_httpd_response()->body, "scan");
+    HOST_TEST_CHECK_EQ_INT(scan.call_cnt, 1);
+
+    HOST_TEST_CHECK_EQ_INT(pres_http_router_unregister(&server), ESP_OK);
+    HOST_TEST_CHECK_EQ_INT(server.uri_cnt, 0);
+    pres_http_router_delete(router);
+}
+
+static void test_unknown_path_is_404(void) {
+    pres_http_router_t* router = new_registered(NULL);
+    route_ctx_t         status = {.name = "status"};
+    add(router, "/api/wifi/status", HTTP_GET, &status);
+
+    HOST_TEST_CHECK_EQ_INT(serve(HTTP_GET, "/api/wifi/statu"), ESP_OK);
+    HOST_TEST_CHECK_EQ_STR(host_stubs_httpd_response()->status, "404 Not Found");
+    HOST_TEST_CHECK_EQ_STR(host_stubs_httpd_response()->body, "{\"error\":\"NOT_FOUND\"}");
+
+    HOST_TEST_CHECK_EQ_INT(serve(HTTP_GET, "/api/wifi/status/"), ESP_OK);
+    HOST_TEST_CHECK_EQ_STR(host_stubs_httpd_response()->status, "404 Not Found");
+    HOST_TEST_CHECK_EQ_INT(status.call_cnt, 0);
+
+    pres_http_router_delete(router);
+}
+
+static void test_other_method_is_405(void) {
+    pres_http_router_t* router = new_registered(NULL);
+    route_ctx_t         scan   = {.name = "scan"};
+    add(router, "/api/wifi/scan", HTTP_POST, &scan);
+
+    HOST_TEST_CHECK_EQ_INT(serve(HTTP_GET, "/api/wifi/scan?x=1"), ESP_OK);
+    HOST_TEST_CHECK_EQ_STR(host_stubs_httpd_response()->status, "405 Method Not Allowed");
+    HOST_TEST_CHECK_EQ_STR(host_stubs_httpd_response()->body, "{\"error\":\"METHOD_NOT_ALLOWED\"}");
+
+    HOST_TEST_CHECK_EQ_INT(serve(HTTP_DELETE, "/api/wifi/scan"), ESP_OK);
+    HOST_TEST_CHECK_EQ_STR(host_stubs_httpd_response()->status, "405 Method Not Allowed");
+    HOST_TEST_CHECK_EQ_INT(scan.call_cnt, 0);
+
+    /* Once the only method is gone the path is unknown altogether */
+    HOST_TEST_CHECK_EQ_INT(pres_http_router_remove(router, "/api/wifi/scan", HTTP_POST), ESP_OK);
+    HOST_TEST_CHECK_EQ_INT(serve(HTTP_GET, "/api/wifi/scan"), ESP_OK);
+    HOST_TEST_CHECK_EQ_STR(host_stubs_httpd_response()->status, "404 Not Found");
+
+    pres_http_router_delete(router);
+}
+
+static void test_add_rejects_bad_routes(void) {
+    pres_http_router_t* router = pres_http_router_new(NULL, NULL);
+    route_ctx_t         ctx    = {.name = "route"};
+
+    HOST_TEST_CHECK_EQ_INT(add(router, "/wifi/status", HTTP_GET, &ctx), ESP_ERR_INVALID_ARG);
+    HOST_TEST_CHECK_EQ_INT(add(router, "/api/wifi/status", HTTP_GET, &ctx), ESP_OK);
+    HOST_TEST_CHECK_EQ_INT(add(router, "/api/wifi/status", HTTP_GET, &ctx), ESP_ERR_HTTPD_HANDLER_EXISTS);
+    HOST_TEST_CHECK_EQ_INT(add(router, "/api/wifi/status", HTTP_PUT, &ctx), ESP_OK);
+    HOST_TEST_CHECK_EQ_INT(pres_http_router_remove(router, "/api/wifi/other", HTTP_GET), ESP_ERR_NOT_FOUND);
+
+    static char uris[PRES_HTTP_ROUTER_ROUTE_MAX][24];
+    for (size_t i = router->route_cnt; i < PRES_HTTP_ROUTER_ROUTE_MAX; i++) {
+        snprintf(uris[i], sizeof(uris[i]), "/api/route/%zu", i);
+        HOST_TEST_CHECK_EQ_INT(add(router, uris[i], HTTP_GET, &ctx), ESP_OK);
+    }
+    HOST_TEST_CHECK_EQ_INT(add(router, "/api/one/more", HTTP_GET, &ctx), ESP_ERR_NO_MEM);
+
+    /* Every route of a full table is still reachable */
+    for (size_t i = 2; i < PRES_HTTP_ROUTER_ROUTE_MAX; i++) {
+        HOST_TEST_CHECK(pres_http_router_find(router, HTTP_GET, uris[i]) != NULL);
+    }
+
+    pres_http_router_delete(router);
+}
+
+static void test_removed_slot_keeps_probe_chain(void) {
+    static char uris[COLLIDING_CNT][24];
+    size_t      found = 0;
+    size_t      home  = 0;
+    for (size_t i = 0; found < COLLIDING_CNT && i < 100000; i++) {
+        char uri[24];
+        snprintf(uri, sizeof(uri), "/api/c/%zu", i);
+        if (found == 0) {
+            home = home_slot(HTTP_GET, uri);
+        } else if (home_slot(HTTP_GET, uri) != home) {
+            continue;
+        }
+        snprintf(uris[found++], sizeof(uris[0]), "%s", uri);
+    }
+    HOST_TEST_CHECK_EQ_INT(found, COLLIDING_CNT);
+
+    pres_http_router_t* router = pres_http_router_new(NULL, NULL);
+    route_ctx_t         ctx    = {.name = "route"};
+    for (size_t i = 0; i < COLLIDING_CNT; i++) {
+        HOST_TEST_CHECK_EQ_INT(add(router, uris[i], HTTP_GET, &ctx), ESP_OK);
+    }
+
+    const pres_http_router_slot_t* first = pres_http_router_find(router, HTTP_GET, uris[0]);
+    const pres_http_router_slot_t* last  = pres_http_router_find(router, HTTP_GET, uris[2]);
+    HOST_TEST_CHECK(first && slot_of(router, first) == home);
+    HOST_TEST_CHECK(last && slot_of(router, last) == ((home + 2) & (PRES_HTTP_ROUTER_SLOT_CNT - 1)));
+
+    /* The routes behind a removed slot are still found past it */
+    HOST_TEST_CHECK_EQ_INT(pres_http_router_remove(router, uris[0], HTTP_GET), ESP_OK);
+    HOST_TEST_CHECK_EQ_INT(router->slots[home].state, PRES_HTTP_ROUTER_SLOT_REMOVED);
+    HOST_TEST_CHECK(pres_http_router_find(router, HTTP_GET, uris[0]) == NULL);
+    HOST_TEST_CHECK(pres_http_router_find(router, HTTP_GET, uris[1]) != NULL);
+    HOST_TEST_CHECK(pres_http_router_find(router, HTTP_GET, uris[2]) == last);
+
+    HOST_TEST_CHECK_EQ_INT(pres_http_router_remove(router, uris[1], HTTP_GET), ESP_OK);
+    HOST_TEST_CHECK(pres_http_router_find(router, HTTP_GET, uris[2]) == last);
+    HOST_TEST_CHECK_EQ_INT(router->route_cnt, 1);
+
+    /* Adding again reuses the first removed slot of the chain */
+    HOST_TEST_CHECK_EQ_INT(add(router, uris[1], HTTP_GET, &ctx), ESP_OK);
+    const pres_http_router_slot_t* readded = pres_http_router_find(router, HTTP_GET, uris[1]);
+    HOST_TEST_CHECK(readded && slot_of(router, readded) == home);
+    HOST_TEST_CHECK(pres_http_router_find(router, HTTP_GET, uris[2]) == last);
+    HOST_TEST_CHECK_EQ_INT(add(router, uris[2], HTTP_GET, &ctx), ESP_ERR_HTTPD_HANDLER_EXISTS);
+
+    pres_http_router_delete(router);
+}
+
+static void test_routed_request_is_counted(void) {
+    pres_http_metrics_t* metrics = pres_http_metrics_new();
+    pres_http_router_t*  router  = new_registered(metrics);
+    route_ctx_t          status  = {.name = "status"};
+    add(router, "/api/wifi/status", HTTP_GET, &status);
+
+    HOST_TEST_CHECK_EQ_INT(pres_http_metrics_route_cnt(metrics), 1);
+    serve(HTTP_GET, "/api/wifi/status");
+    serve(HTTP_GET, "/api/wifi/status");
+    serve(HTTP_GET, "/api/wifi/unknown");
+
+    const pres_http_metrics_route_t* route = &metrics->routes[0];
+    HOST_TEST_CHECK_EQ_INT(route->request_cnt, 2);
+    HOST_TEST_CHECK_EQ_INT(route->status_cnt[1], 2);
+    HOST_TEST_CHECK(metrics->active == NULL);
+
+    pres_http_router_delete(router);
+    pres_http_metrics_delete(metrics);
+}
+
+int main(void) {
+    HOST_TEST_RUN(test_dispatches_to_route);
+    HOST_TEST_RUN(test_unknown_path_is_404);
+    HOST_TEST_RUN(test_other_method_is_405);
+    HOST_TEST_RUN(test_add_rejects_bad_routes);
+    HOST_TEST_RUN(test_removed_slot_keeps_probe_chain);
+    HOST_TEST_RUN(test_routed_request_is_counted);
+
+    return HOST_TEST_RESULT();
+}
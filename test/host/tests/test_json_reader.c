@@ -0,0 +1,477 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "host_test.h"
+#include "utils/json/reader.h"
+
+#ifdef HOST_TEST_HAVE_CJSON
+#include "cJSON.h"
+#endif
+
+#define FUZZ_DOC_CNT 100000
+#define DOC_MAX_LEN  2048
+
+typedef struct {
+    const char* json;
+    bool        accepted;
+} golden_t;
+
+/* Helpers */
+
+static bool parse(utils_json_reader_t* r, const char* json) {
+    return utils_json_reader_parse(r, json, strlen(json));
+}
+
+static void nested_arrays(char* out, size_t depth) {
+    memset(out, '[', depth);
+    memset(out + depth, ']', depth);
+    out[2 * depth] = '\0';
+}
+
+/* Nested values do not take tokens, only the root members do */
+static void object_with_members(char* out, size_t out_size, size_t member_cnt) {
+    size_t len = (size_t)snprintf(out, out_size, "{");
+    for (size_t i = 0; i < member_cnt; i++) {
+        len += (size_t)snprintf(out + len, out_size - len, "%s\"k%zu\":{\"n\":[%zu]}", i == 0 ? "" : ",", i, i);
+    }
+    snprintf(out + len, out_size - len, "}");
+}
+
+/* Tests */
+
+static void test_golden_acceptance(void) {
+    /* Acceptance follows cJSON_ParseWithLength, leniencies included */
+    static const golden_t cases[] = {
+        {"{}", true},
+        {"[]", true},
+        {" \t\r\n{\"a\":1}", true},
+        {"\x01\x1f{\"a\":1}", true},
+        {"\xEF\xBB\xBF{\"a\":1}", true},
+        {"1", true},
+        {"-0.5e3", true},
+        {"\"s\"", true},
+        {"null", true},
+        {"{\"a\":[1,{\"b\":[]}],\"c\":null,\"d\":\"\"}", true},
+        {"{\"a\":1} trailing bytes", true},
+        {"nullx", true},
+        {"{\"a\":01}", true},
+        {"{\"a\":1.}", true},
+        {"{\"a\":\"raw\x01\x7f\xff\"}", true},
+        {"{\"a\":\"\\u00zz\"}", true},
+        {"", false},
+        {"   ", false},
+        {"{", false},
+        {"{\"a\"}", false},
+        {"{\"a\":}", false},
+        {"{\"a\":1,}", false},
+        {"[1,]", false},
+        {"[,1]", false},
+        {"{a:1}", false},
+        {"'a'", false},
+        {"tru", false},
+        {"{\"a\":+1}", false},
+        {"{\"a\":-}", false},
+        {"\"abc", false},
+        {"\"\\x\"", false},
+        {"\"\\ud800\"", false},
+        {"\"\\ud800\\u0041\"", false},
+        {"\"\\udc00\"", false},
+        {"\"\\u12\"", false},
+        {"\"\\", false},
+        {"{\"a\":1]", false},
+        {"[1}", false},
+        {"[[]", false},
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        utils_json_reader_t r;
+        bool                accepted = parse(&r, cases[i].json);
+        if (accepted != cases[i].accepted) {
+            fprintf(stderr, "case %zu: %s\n", i, cases[i].json);
+        }
+        HOST_TEST_CHECK_EQ_INT(accepted, cases[i].accepted);
+        HOST_TEST_CHECK_EQ_INT(utils_json_reader_empty(&r), !accepted);
+    }
+}
+
+static void test_limits(void) {
+    char                doc[2 * UTILS_JSON_READER_DEPTH_MAX + 3];
+    utils_json_reader_t r;
+
+    nested_arrays(doc, UTILS_JSON_READER_DEPTH_MAX);
+    HOST_TEST_CHECK(parse(&r, doc));
+    nested_arrays(doc, UTILS_JSON_READER_DEPTH_MAX + 1);
+    HOST_TEST_CHECK(!parse(&r, doc));
+
+    /* Root plus one key and one value token per member */
+    size_t member_max = (UTILS_JSON_READER_TOKEN_MAX_CNT - 1) / 2;
+    char   members[512];
+
+    object_with_members(members, sizeof(members), member_max);
+    HOST_TEST_CHECK(parse(&r, members));
+    HOST_TEST_CHECK_EQ_INT(r.token_cnt, 1 + 2 * member_max);
+    object_with_members(members, sizeof(members), member_max + 1);
+    HOST_TEST_CHECK(!parse(&r, members));
+}
+
+static void test_string_decoding(void) {
+    utils_json_reader_t r;
+    char                out[64];
+
+    HOST_TEST_CHECK(parse(&r, "{\"s\":\"a\\n\\t\\\"\\\\\\/\\u00e9\\u20ac\\ud83d\\ude00\",\"k\\u0065y\":true,\"z\":\"x\\u0000y\",\"bad\":\"x\\u00zzy\"}"));
+
+    int token = utils_json_reader_find(&r, "s");
+    HOST_TEST_CHECK(utils_json_reader_get_string(&r, token, out, sizeof(out)));
+    HOST_TEST_CHECK_EQ_STR(out, "a\n\t\"\\/\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80");
+
+    /* Too small for the decoded bytes plus NUL */
+    HOST_TEST_CHECK(!utils_json_reader_get_string(&r, token, out, strlen("a\n\t\"\\/\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80")));
+
+    /* Keys are compared decoded */
+    bool flag = false;
+    HOST_TEST_CHECK(utils_json_reader_get_bool(&r, utils_json_reader_find(&r, "key"), &flag));
+    HOST_TEST_CHECK(flag);
+
+    /* An escaped NUL, and a malformed \u read as one, end the string */
+    HOST_TEST_CHECK(utils_json_reader_get_string(&r, utils_json_reader_find(&r, "z"), out, sizeof(out)));
+    HOST_TEST_CHECK_EQ_STR(out, "x");
+    HOST_TEST_CHECK(utils_json_reader_get_string(&r, utils_json_reader_find(&r, "bad"), out, sizeof(out)));
+    HOST_TEST_CHECK_EQ_STR(out, "x");
+
+    /* So does a raw NUL inside a body with an explicit length */
+    static const char raw[] = "{\"s\":\"ab\0cd\"}";
+    HOST_TEST_CHECK(utils_json_reader_parse(&r, raw, sizeof(raw) - 1));
+    HOST_TEST_CHECK(utils_json_reader_get_string(&r, utils_json_reader_find(&r, "s"), out, sizeof(out)));
+    HOST_TEST_CHECK_EQ_STR(out, "ab");
+}
+
+static void test_members(void) {
+    utils_json_reader_t r;
+    double              number = 0.0;
+    bool                flag   = true;
+
+    HOST_TEST_CHECK(parse(&r, "{\"a\":1,\"a\":2,\"n\":-12.5e-1,\"b\":false,\"arr\":[1,{\"x\":2}],\"o\":{},\"z\":null}"));
+    HOST_TEST_CHECK(utils_json_reader_is_object(&r));
+
+    /* The first duplicate wins, as with cJSON_GetObjectItem */
+    HOST_TEST_CHECK(utils_json_reader_get_number(&r, utils_json_reader_find(&r, "a"), &number));
+    HOST_TEST_CHECK(number == 1.0);
+    HOST_TEST_CHECK(utils_json_reader_get_number(&r, utils_json_reader_find(&r, "n"), &number));
+    HOST_TEST_CHECK(number == -1.25);
+    HOST_TEST_CHECK(utils_json_reader_get_bool(&r, utils_json_reader_find(&r, "b"), &flag));
+    HOST_TEST_CHECK(!flag);
+
+    HOST_TEST_CHECK_EQ_INT(utils_json_reader_type(&r, utils_json_reader_find(&r, "arr")), UTILS_JSON_READER_TYPE_ARRAY);
+    HOST_TEST_CHECK_EQ_INT(utils_json_reader_type(&r, utils_json_reader_find(&r, "o")), UTILS_JSON_READER_TYPE_OBJECT);
+    HOST_TEST_CHECK_EQ_INT(utils_json_reader_type(&r, utils_json_reader_find(&r, "z")), UTILS_JSON_READER_TYPE_NULL);
+
+    /* Nested members are validated but not kept */
+    HOST_TEST_CHECK_EQ_INT(utils_json_reader_find(&r, "x"), UTILS_JSON_READER_NONE);
+    HOST_TEST_CHECK_EQ_INT(utils_json_reader_find(&r, "missing"), UTILS_JSON_READER_NONE);
+
+    /* Wrong type getters fail */
+    HOST_TEST_CHECK(!utils_json_reader_get_bool(&r, utils_json_reader_find(&r, "a"), &flag));
+    HOST_TEST_CHECK(!utils_json_reader_get_number(&r, utils_json_reader_find(&r, "b"), &number));
+
+    HOST_TEST_CHECK(parse(&r, "[1,2]"));
+    HOST_TEST_CHECK(!utils_json_reader_is_object(&r));
+    HOST_TEST_CHECK_EQ_INT(utils_json_reader_find(&r, "a"), UTILS_JSON_READER_NONE);
+}
+
+#ifdef HOST_TEST_HAVE_CJSON
+typedef struct {
+    char   data[DOC_MAX_LEN];
+    size_t len;
+} doc_t;
+
+static uint32_t rng_state = 0x2545f491u;
+
+static uint32_t rng_next(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+
+    return rng_state;
+}
+
+static void doc_append(doc_t* doc, const char* data, size_t data_len) {
+    if (doc->len + data_len >= sizeof(doc->data)) {
+        return;
+    }
+
+    memcpy(doc->data + doc->len, data, data_len);
+    doc->len += data_len;
+}
+
+static void doc_puts(doc_t* doc, const char* s) {
+    doc_append(doc, s, strlen(s));
+}
+
+/* Whitespace includes the control bytes and NUL cJSON also skips */
+static void gen_whitespace(doc_t* doc) {
+    static const char ws[] = " \t\n\r\x01\x1f";
+
+    if (rng_next() % 4 == 0) {
+        char c = rng_next() % 16 == 0 ? '\0' : ws[rng_next() % (sizeof(ws) - 1)];
+        doc_append(doc, &c, 1);
+    }
+}
+
+static void gen_string(doc_t* doc) {
+    static const char* const pieces[] = {
+        "a", "key", "ssid", "\\n", "\\\"", "\\\\", "\\/", "\\b", "\\f", "\\r", "\\t",
+        "\\u0041", "\\u00e9", "\\u20AC", "\\u0000", "\\ud83d\\ude00", "\\ud800", "\\udc00",
+        "\\ud800\\u0041", "\\u12zz", "\\x", "\x01", "\x7f", "\xc3\xa9", "\xff", " ",
+    };
+
+    doc_puts(doc, "\"");
+    size_t piece_cnt = rng_next() % 5;
+    for (size_t i = 0; i < piece_cnt; i++) {
+        /* Mostly plain text, so most documents stay valid */
+        size_t pick = rng_next() % 4 == 0 ? rng_next() % (sizeof(pieces) / sizeof(pieces[0])) : rng_next() % 3;
+        doc_puts(doc, pieces[pick]);
+    }
+    doc_puts(doc, "\"");
+}
+
+static void gen_number(doc_t* doc) {
+    static const char* const numbers[] = {
+        "0", "-0", "1", "-1", "42", "007", "3.25", "-0.5", "1e3", "1E-3", "2.5e+2",
+        "1.", "-", "1e", "9007199254740993", "1e999", "-1e-999", "123456789012345678901234567890",
+    };
+
+    doc_puts(doc, numbers[rng_next() % (sizeof(numbers) / sizeof(numbers[0]))]);
+}
+
+static void gen_value(doc_t* doc, int depth) {
+    gen_whitespace(doc);
+
+    switch (rng_next() % (depth < 4 ? 7 : 5)) {
+        case 0:
+        case 1:
+            gen_string(doc);
+            break;
+        case 2:
+            gen_number(doc);
+            break;
+        case 3: {
+            static const char* const literals[] = {"true", "false", "null"};
+            doc_puts(doc, literals[rng_next() % 3]);
+            break;
+        }
+        case 4:
+            gen_string(doc);
+            break;
+        case 5: {
+            doc_puts(doc, "[");
+            size_t cnt = rng_next() % 5;
+            for (size_t i = 0; i < cnt; i++) {
+                if (i > 0) {
+                    doc_puts(doc, ",");
+                }
+                gen_value(doc, depth + 1);
+            }
+            gen_whitespace(doc);
+            doc_puts(doc, "]");
+            break;
+        }
+        default: {
+            doc_puts(doc, "{");
+            size_t cnt = rng_next() % 6;
+            for (size_t i = 0; i < cnt; i++) {
+                if (i > 0) {
+                    doc_puts(doc, ",");
+                }
+                gen_whitespace(doc);
+                gen_string(doc);
+                gen_whitespace(doc);
+                doc_puts(doc, ":");
+                gen_value(doc, depth + 1);
+            }
+            gen_whitespace(doc);
+            doc_puts(doc, "}");
+            break;
+        }
+    }
+
+    gen_whitespace(doc);
+}
+
+static void gen_document(doc_t* doc) {
+    doc->len = 0;
+
+    /* Request bodies are objects, the other roots are for coverage */
+    if (rng_next() % 8 == 0) {
+        gen_value(doc, 0);
+    } else {
+        doc_puts(doc, "{");
+        size_t cnt = rng_next() % 8;
+        for (size_t i = 0; i < cnt; i++) {
+            if (i > 0) {
+                doc_puts(doc, ",");
+            }
+            gen_string(doc);
+            doc_puts(doc, ":");
+            gen_value(doc, 1);
+        }
+        doc_puts(doc, "}");
+    }
+
+    /* Byte-level mutations for the rejection paths */
+    static const char alphabet[] = "{}[]\":,\\.-+eE0 1tfnu\x01";
+    size_t            mutation_cnt = rng_next() % 2 == 0 ? 0 : 1 + rng_next() % 3;
+    for (size_t i = 0; i < mutation_cnt && doc->len > 0; i++) {
+        size_t pos = rng_next() % doc->len;
+        switch (rng_next() % 4) {
+            case 0:
+                doc->data[pos] = alphabet[rng_next() % (sizeof(alphabet) - 1)];
+                break;
+            case 1:
+                memmove(doc->data + pos, doc->data + pos + 1, doc->len - pos - 1);
+                doc->len--;
+                break;
+            case 2:
+                if (doc->len + 1 < sizeof(doc->data)) {
+                    memmove(doc->data + pos + 1, doc->data + pos, doc->len - pos);
+                    doc->data[pos] = alphabet[rng_next() % (sizeof(alphabet) - 1)];
+                    doc->len++;
+                }
+                break;
+            default:
+                doc->len = pos;
+                break;
+        }
+    }
+}
+
+static utils_json_reader_type_t cjson_type(const cJSON* item) {
+    if (cJSON_IsObject(item)) {
+        return UTILS_JSON_READER_TYPE_OBJECT;
+    }
+    if (cJSON_IsArray(item)) {
+        return UTILS_JSON_READER_TYPE_ARRAY;
+    }
+    if (cJSON_IsString(item)) {
+        return UTILS_JSON_READER_TYPE_STRING;
+    }
+    if (cJSON_IsNumber(item)) {
+        return UTILS_JSON_READER_TYPE_NUMBER;
+    }
+    if (cJSON_IsBool(item)) {
+        return UTILS_JSON_READER_TYPE_BOOL;
+    }
+    if (cJSON_IsNull(item)) {
+        return UTILS_JSON_READER_TYPE_NULL;
+    }
+
+    return UTILS_JSON_READER_TYPE_UNDEFINED;
+}
+
+/* Same type and same decoded value as the cJSON item */
+static bool token_matches(const utils_json_reader_t* r, int token, const cJSON* item) {
+    static char out[DOC_MAX_LEN];
+    double      number = 0.0;
+    bool        flag   = false;
+
+    if (utils_json_reader_type(r, token) != cjson_type(item)) {
+        return false;
+    }
+
+    switch (cjson_type(item)) {
+        case UTILS_JSON_READER_TYPE_STRING:
+            return utils_json_reader_get_string(r, token, out, sizeof(out)) && strcmp(out, item->valuestring) == 0;
+        case UTILS_JSON_READER_TYPE_NUMBER:
+            return utils_json_reader_get_number(r, token, &number) && number == item->valuedouble;
+        case UTILS_JSON_READER_TYPE_BOOL:
+            return utils_json_reader_get_bool(r, token, &flag) && flag == (bool)cJSON_IsTrue(item);
+        default:
+            return true;
+    }
+}
+
+static bool documents_match(const utils_json_reader_t* r, const cJSON* root) {
+    if (!token_matches(r, 0, root)) {
+        return false;
+    }
+    if (!cJSON_IsObject(root)) {
+        return true;
+    }
+    if (r->token_cnt != 1 + 2 * (size_t)cJSON_GetArraySize(root)) {
+        return false;
+    }
+
+    for (const cJSON* member = root->child; member; member = member->next) {
+        const cJSON* first = cJSON_GetObjectItemCaseSensitive(root, member->string);
+        if (!token_matches(r, utils_json_reader_find(r, member->string), first)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/* The reader keeps at most this many root members, cJSON has no such limit */
+static bool over_reader_limits(const cJSON* root) {
+    size_t member_max = cJSON_IsObject(root) ? (UTILS_JSON_READER_TOKEN_MAX_CNT - 1) / 2 : UTILS_JSON_READER_TOKEN_MAX_CNT - 1;
+
+    return (cJSON_IsObject(root) || cJSON_IsArray(root)) && (size_t)cJSON_GetArraySize(root) > member_max;
+}
+
+static void report_mismatch(const doc_t* doc, bool reader_ok, bool cjson_ok) {
+    fprintf(stderr, "mismatch (reader %d, cJSON %d) on %zu bytes:", reader_ok, cjson_ok, doc->len);
+    for (size_t i = 0; i < doc->len; i++) {
+        unsigned char c = (unsigned char)doc->data[i];
+        fprintf(stderr, c >= 0x20 && c < 0x7f ? "%c" : "\\x%02x", c);
+    }
+    fprintf(stderr, "\n");
+}
+
+static void test_random_documents_match_cjson(void) {
+    static doc_t doc;
+    size_t       accepted_cnt = 0;
+    size_t       excused_cnt  = 0;
+    size_t       mismatch_cnt = 0;
+
+    for (int i = 0; i < FUZZ_DOC_CNT; i++) {
+        gen_document(&doc);
+
+        utils_json_reader_t r;
+        bool                reader_ok = utils_json_reader_parse(&r, doc.data, doc.len);
+        cJSON*              root      = cJSON_ParseWithLength(doc.data, doc.len);
+
+        bool match = reader_ok == (root != NULL);
+        if (!reader_ok && root && over_reader_limits(root)) {
+            match = true;
+            excused_cnt++;
+        } else if (reader_ok && root) {
+            match = documents_match(&r, root);
+            accepted_cnt++;
+        }
+
+        if (!match && mismatch_cnt++ < 5) {
+            report_mismatch(&doc, reader_ok, root != NULL);
+        }
+        cJSON_Delete(root);
+    }
+
+    printf("%d documents, %zu accepted by both, %zu over reader limits\n", FUZZ_DOC_CNT, accepted_cnt, excused_cnt);
+    HOST_TEST_CHECK_EQ_INT(mismatch_cnt, 0);
+    HOST_TEST_CHECK(accepted_cnt > FUZZ_DOC_CNT / 10);
+}
+#endif
+
+int main(void) {
+    HOST_TEST_RUN(test_golden_acceptance);
+    HOST_TEST_RUN(test_limits);
+    HOST_TEST_RUN(test_string_decoding);
+    HOST_TEST_RUN(test_members);
+#ifdef HOST_TEST_HAVE_CJSON
+    HOST_TEST_RUN(test_random_documents_match_cjson);
+#else
+    printf("SKIP test_random_documents_match_cjson (built without cJSON)\n");
+#endif
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,274 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "domain/models/messaging.h"
+#include "host_test.h"
+#include "infrastructure/messaging/publish/esp_mqtt_impl_types.h"
+#include "infrastructure/messaging/publish/esp_mqtt_impl_utils.h"
+#include "utils/json/writer.h"
+
+#ifdef HOST_TEST_HAVE_CJSON
+#include "cJSON.h"
+#endif
+
+#define FUZZ_DOC_CNT 5000
+#define DOC_MAX_LEN  8192
+
+typedef struct {
+    char   data[DOC_MAX_LEN];
+    size_t len;
+} capture_t;
+
+/* Helpers */
+
+static bool capture_flush(void* flush_ctx, const char* data, size_t data_len) {
+    capture_t* capture = (capture_t*)flush_ctx;
+    if (capture->len + data_len >= sizeof(capture->data)) {
+        return false;
+    }
+
+    memcpy(capture->data + capture->len, data, data_len);
+    capture->len += data_len;
+    capture->data[capture->len] = '\0';
+
+    return true;
+}
+
+static void write_sample(utils_json_writer_t* w) {
+    utils_json_writer_object_begin(w);
+    utils_json_writer_kv_string(w, "name", "line\nbreak \"quoted\" \\ tab\t");
+    utils_json_writer_kv_int(w, "min", INT64_MIN);
+    utils_json_writer_kv_uint(w, "max", UINT64_MAX);
+    utils_json_writer_kv_bool(w, "ok", true);
+    utils_json_writer_key(w, "items");
+    utils_json_writer_array_begin(w);
+    for (int i = 0; i < 20; i++) {
+        utils_json_writer_object_begin(w);
+        utils_json_writer_kv_int(w, "id", i - 10);
+        utils_json_writer_kv_string(w, "tag", "\x01\x02 ctl");
+        utils_json_writer_object_end(w);
+    }
+    utils_json_writer_null(w);
+    utils_json_writer_array_end(w);
+    utils_json_writer_object_end(w);
+}
+
+/* Tests */
+
+static void test_escaping_matches_cjson_output(void) {
+    char                out[256];
+    utils_json_writer_t w;
+
+    utils_json_writer_init(&w, out, sizeof(out));
+    utils_json_writer_string(&w, "q\" b\\ s/ t\t n\n r\r b\b f\f c\x01\x1f d\x7f u\xc3\xa9");
+    size_t len = utils_json_writer_finish(&w);
+
+    HOST_TEST_CHECK_EQ_STR(out, "\"q\\\" b\\\\ s/ t\\t n\\n r\\r b\\b f\\f c\\u0001\\u001f d\x7f u\xc3\xa9\"");
+    HOST_TEST_CHECK_EQ_INT(len, strlen(out));
+}
+
+static void test_numbers_and_literals(void) {
+    char                out[256];
+    utils_json_writer_t w;
+
+    utils_json_writer_init(&w, out, sizeof(out));
+    utils_json_writer_array_begin(&w);
+    utils_json_writer_int(&w, INT64_MIN);
+    utils_json_writer_int(&w, 0);
+    utils_json_writer_int(&w, -1);
+    utils_json_writer_uint(&w, UINT64_MAX);
+    utils_json_writer_bool(&w, false);
+    utils_json_writer_null(&w);
+    utils_json_writer_array_end(&w);
+    utils_json_writer_finish(&w);
+
+    HOST_TEST_CHECK_EQ_STR(out, "[-9223372036854775808,0,-1,18446744073709551615,false,null]");
+}
+
+static void test_status_payload(void) {
+    char                          out[INF_MESSAGING_PUBLISH_ESP_MQTT_IMPL_JSON_MAX_LEN];
+    dom_models_messaging_status_t status = {
+        .status             = "online",
+        .wifi_connected     = true,
+        .ethernet_connected = false,
+        .ip                 = "192.168.1.20",
+        .rssi_bucket        = 3,
+        .ota_updating       = false,
+    };
+
+    size_t len = inf_messaging_publish_esp_mqtt_impl_build_status_json(&status, out, sizeof(out));
+
+    HOST_TEST_CHECK_EQ_STR(out, "{\"status\":\"online\",\"wifi_connected\":true,\"ethernet_connected\":false,\"ip\":\"192.168.1.20\",\"rssi_bucket\":3,\"ota_updating\":false}");
+    HOST_TEST_CHECK_EQ_INT(len, strlen(out));
+}
+
+static void test_fully_escaped_log_fits_payload_buffer(void) {
+    char                       out[INF_MESSAGING_PUBLISH_ESP_MQTT_IMPL_JSON_MAX_LEN];
+    dom_models_messaging_log_t log;
+
+    memset(log.message, '\x01', sizeof(log.message) - 1);
+    log.message[sizeof(log.message) - 1] = '\0';
+
+    size_t expected_len = strlen("{\"message\":\"\"}") + UTILS_JSON_WRITER_ESCAPE_MAX_LEN * (sizeof(log.message) - 1);
+    size_t len          = inf_messaging_publish_esp_mqtt_impl_build_log_json(&log, out, sizeof(out));
+    HOST_TEST_CHECK_EQ_INT(len, expected_len);
+    HOST_TEST_CHECK(strncmp(out, "{\"message\":\"\\u0001\\u0001", 24) == 0);
+
+    /* One byte short of the NUL latches the overflow */
+    len = inf_messaging_publish_esp_mqtt_impl_build_log_json(&log, out, expected_len);
+    HOST_TEST_CHECK_EQ_INT(len, 0);
+}
+
+static void test_overflow_latches(void) {
+    char                out[8];
+    utils_json_writer_t w;
+
+    utils_json_writer_init(&w, out, sizeof(out));
+    HOST_TEST_CHECK(utils_json_writer_object_begin(&w));
+    HOST_TEST_CHECK(!utils_json_writer_kv_string(&w, "key", "value"));
+    HOST_TEST_CHECK(!utils_json_writer_object_end(&w));
+    HOST_TEST_CHECK_EQ_INT(utils_json_writer_finish(&w), 0);
+}
+
+static void test_stream_matches_one_shot(void) {
+    static char         expected[DOC_MAX_LEN];
+    utils_json_writer_t w;
+
+    utils_json_writer_init(&w, expected, sizeof(expected));
+    write_sample(&w);
+    size_t expected_len = utils_json_writer_finish(&w);
+    HOST_TEST_CHECK(expected_len > 0);
+
+    for (size_t scratch_size = 1; scratch_size <= 64; scratch_size++) {
+        char      scratch[64];
+        capture_t capture = {.len = 0};
+
+        utils_json_writer_init_stream(&w, scratch, scratch_size, capture_flush, &capture);
+        write_sample(&w);
+        size_t len = utils_json_writer_finish(&w);
+
+        HOST_TEST_CHECK_EQ_INT(len, expected_len);
+        HOST_TEST_CHECK_EQ_STR(capture.data, expected);
+    }
+}
+
+#ifdef HOST_TEST_HAVE_CJSON
+static uint32_t rng_state = 0x9e3779b9u;
+
+static uint32_t rng_next(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+
+    return rng_state;
+}
+
+/* Random NUL-free bytes, biased towards the characters that need escaping */
+static void random_string(char* out, size_t max_len) {
+    static const char specials[] = "\"\\/\b\f\n\r\t\x01\x1f\x7f";
+
+    size_t len = rng_next() % max_len;
+    for (size_t i = 0; i < len; i++) {
+        uint32_t pick = rng_next() % 4;
+        if (pick == 0) {
+            out[i] = specials[rng_next() % (sizeof(specials) - 1)];
+        } else if (pick == 1) {
+            out[i] = (char)(1 + rng_next() % 255);
+        } else {
+            out[i] = (char)('a' + rng_next() % 26);
+        }
+    }
+    out[len] = '\0';
+}
+
+/* Builds the same random object with the writer and with cJSON */
+static void fuzz_object(utils_json_writer_t* w, cJSON* obj, int depth) {
+    char key[24];
+    char value[48];
+
+    int field_cnt = (int)(rng_next() % 6);
+    for (int i = 0; i < field_cnt; i++) {
+        random_string(key, sizeof(key));
+        utils_json_writer_key(w, key);
+
+        switch (rng_next() % (depth < 2 ? 5 : 4)) {
+            case 0: {
+                random_string(value, sizeof(value));
+                utils_json_writer_string(w, value);
+                cJSON_AddItemToObject(obj, key, cJSON_CreateString(value));
+                break;
+            }
+            case 1: {
+                int32_t number = (int32_t)rng_next();
+                utils_json_writer_int(w, number);
+                cJSON_AddItemToObject(obj, key, cJSON_CreateNumber(number));
+                break;
+            }
+            case 2: {
+                bool flag = rng_next() & 1;
+                utils_json_writer_bool(w, flag);
+                cJSON_AddItemToObject(obj, key, cJSON_CreateBool(flag));
+                break;
+            }
+            case 3:
+                utils_json_writer_null(w);
+                cJSON_AddItemToObject(obj, key, cJSON_CreateNull());
+                break;
+            default: {
+                cJSON* child = cJSON_CreateObject();
+                utils_json_writer_object_begin(w);
+                fuzz_object(w, child, depth + 1);
+                utils_json_writer_object_end(w);
+                cJSON_AddItemToObject(obj, key, child);
+                break;
+            }
+        }
+    }
+}
+
+static void test_random_documents_match_cjson(void) {
+    static char out[DOC_MAX_LEN];
+    int         mismatch_cnt = 0;
+
+    for (int doc = 0; doc < FUZZ_DOC_CNT; doc++) {
+        utils_json_writer_t w;
+        cJSON*              root = cJSON_CreateObject();
+
+        utils_json_writer_init(&w, out, sizeof(out));
+        utils_json_writer_object_begin(&w);
+        fuzz_object(&w, root, 0);
+        utils_json_writer_object_end(&w);
+        size_t len = utils_json_writer_finish(&w);
+
+        char* expected = cJSON_PrintUnformatted(root);
+        if (!expected || len != strlen(expected) || strcmp(out, expected) != 0) {
+            if (mismatch_cnt++ == 0) {
+                HOST_TEST_CHECK_EQ_STR(out, expected);
+            }
+        }
+        cJSON_free(expected);
+        cJSON_Delete(root);
+    }
+
+    HOST_TEST_CHECK_EQ_INT(mismatch_cnt, 0);
+}
+#endif
+
+int main(void) {
+    HOST_TEST_RUN(test_escaping_matches_cjson_output);
+    HOST_TEST_RUN(test_numbers_and_literals);
+    HOST_TEST_RUN(test_status_payload);
+    HOST_TEST_RUN(test_fully_escaped_log_fits_payload_buffer);
+    HOST_TEST_RUN(test_overflow_latches);
+    HOST_TEST_RUN(test_stream_matches_one_shot);
+#ifdef HOST_TEST_HAVE_CJSON
+    HOST_TEST_RUN(test_random_documents_match_cjson);
+#else
+    printf("SKIP test_random_documents_match_cjson (built without cJSON)\n");
+#endif
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,115 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "domain/usecases/wifiman.h"
+#include "host_test.h"
+#include "presentation/task/wifiman_link_monitor/task.h"
+#include "presentation/task/wifiman_link_monitor/types.h"
+
+#define SAMPLE_INTERVAL_MS 60000
+#define ROAM_MS            100
+
+/* A wifiman whose monitor_link takes ROAM_MS, as a disconnect and reconnect would */
+typedef struct {
+    volatile bool     sampling;
+    volatile uint32_t sample_cnt;
+    long              sample_us;
+} slow_wifiman_t;
+
+/* Helpers */
+
+static dom_models_error_t slow_monitor_link(dom_usecases_wifiman_t* self) {
+    slow_wifiman_t* ctx = (slow_wifiman_t*)self->ctx;
+
+    ctx->sampling = true;
+    host_test_sleep_us(ctx->sample_us);
+    ctx->sample_cnt++;
+    ctx->sampling = false;
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+static int64_t stop_ms(pres_task_wifiman_link_monitor_t* task) {
+    int64_t start_ns = host_test_now_ns();
+    HOST_TEST_CHECK_EQ_INT(pres_task_wifiman_link_monitor_stop(task), DOMAIN_MODELS_ERROR_OK);
+
+    return (host_test_now_ns() - start_ns) / 1000000;
+}
+
+/* Tests */
+
+static void test_stop_waits_for_sample_in_flight(void) {
+    slow_wifiman_t         wifiman_ctx = {.sample_us = ROAM_MS * 1000};
+    dom_usecases_wifiman_t wifiman     = {
+        .ctx          = &wifiman_ctx,
+        .monitor_link = slow_monitor_link,
+    };
+    pres_task_wifiman_link_monitor_cfg_t cfg = {
+        .wifiman            = &wifiman,
+        .sample_interval_ms = SAMPLE_INTERVAL_MS,
+    };
+
+    pres_task_wifiman_link_monitor_t* task  = pres_task_wifiman_link_monitor_new(&cfg);
+    bool                              ready = task && pres_task_wifiman_link_monitor_start(task) == DOMAIN_MODELS_ERROR_OK;
+    HOST_TEST_CHECK(ready);
+    if (!ready) {
+        pres_task_wifiman_link_monitor_delete(task);
+        return;
+    }
+
+    for (int waited_ms = 0; waited_ms < 1000 && !wifiman_ctx.sampling; waited_ms++) {
+        host_test_sleep_us(1000);
+    }
+    HOST_TEST_CHECK(wifiman_ctx.sampling);
+
+    /* Stopping mid-roam lets monitor_link return and release the wifiman lock */
+    int64_t elapsed_ms = stop_ms(task);
+
+    HOST_TEST_CHECK(!wifiman_ctx.sampling);
+    HOST_TEST_CHECK_EQ_INT(wifiman_ctx.sample_cnt, 1);
+    HOST_TEST_CHECK(task->task_handle == NULL);
+    HOST_TEST_CHECK(elapsed_ms < PRES_TASK_WIFIMAN_LINK_MONITOR_DEFAULT_STOP_TIMEOUT_MS);
+
+    pres_task_wifiman_link_monitor_delete(task);
+}
+
+static void test_stop_wakes_sleeping_task(void) {
+    slow_wifiman_t         wifiman_ctx = {0};
+    dom_usecases_wifiman_t wifiman     = {
+        .ctx          = &wifiman_ctx,
+        .monitor_link = slow_monitor_link,
+    };
+    pres_task_wifiman_link_monitor_cfg_t cfg = {
+        .wifiman            = &wifiman,
+        .sample_interval_ms = SAMPLE_INTERVAL_MS,
+    };
+
+    pres_task_wifiman_link_monitor_t* task  = pres_task_wifiman_link_monitor_new(&cfg);
+    bool                              ready = task && pres_task_wifiman_link_monitor_start(task) == DOMAIN_MODELS_ERROR_OK;
+    HOST_TEST_CHECK(ready);
+    if (!ready) {
+        pres_task_wifiman_link_monitor_delete(task);
+        return;
+    }
+
+    for (int waited_ms = 0; waited_ms < 1000 && wifiman_ctx.sample_cnt == 0; waited_ms++) {
+        host_test_sleep_us(1000);
+    }
+    HOST_TEST_CHECK_EQ_INT(wifiman_ctx.sample_cnt, 1);
+
+    /* The task sleeps out a minute long interval, stop must not wait for it */
+    int64_t elapsed_ms = stop_ms(task);
+
+    HOST_TEST_CHECK(task->task_handle == NULL);
+    HOST_TEST_CHECK(elapsed_ms < 100);
+
+    pres_task_wifiman_link_monitor_delete(task);
+}
+
+int main(void) {
+    HOST_TEST_RUN(test_stop_waits_for_sample_in_flight);
+    HOST_TEST_RUN(test_stop_wakes_sleeping_task);
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+"""Decode a binary batch shipped by test_log_shipping with tools/log_decode.py.
+
+The test binary dumps the payload of its binary batch together with the
+lines the ring logger's own decoder makes of it. The tag and format
+pointers in the payload are addresses in that binary, so it is also the
+ELF the decoder is given.
+
+    test_log_decode.py <tools/log_decode.py> <test_log_shipping>
+"""
+
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+# Wall time prefix, the only part that depends on when the test ran
+STAMP_RE = re.compile(r"^\d\d/\d\d/\d{4} \d\d:\d\d:\d\d\.\d{3} ")
+
+
+def main(decoder, test_binary):
+    with tempfile.TemporaryDirectory() as dump_dir:
+        subprocess.run([test_binary, dump_dir], check=True, stdout=subprocess.DEVNULL)
+
+        with open(os.path.join(dump_dir, "expected.txt")) as expected_file:
+            expected = expected_file.read().splitlines()
+
+        result = subprocess.run(
+            [sys.executable, decoder, "--elf", test_binary, os.path.join(dump_dir, "payload.bin")],
+            check=True,
+            capture_output=True,
+            text=True,
+        )
+
+        with open(os.path.join(dump_dir, "payload.bin"), "rb") as payload_file:
+            hex_line = f"logs/bin {payload_file.read().hex()}\n"
+        piped = subprocess.run(
+            [sys.executable, decoder, "--elf", test_binary],
+            input=hex_line,
+            check=True,
+            capture_output=True,
+            text=True,
+        )
+
+    failed = 0
+    lines = result.stdout.splitlines()
+    for line in lines:
+        if not STAMP_RE.match(line):
+            print(f"FAIL no time prefix: {line!r}")
+            failed += 1
+    decoded = [STAMP_RE.sub("", line) for line in lines]
+
+    if decoded != expected:
+        print("FAIL decoded lines differ")
+        for got, want in zip(decoded, expected):
+            if got != want:
+                print(f"  got  {got!r}\n  want {want!r}")
+        if len(decoded) != len(expected):
+            print(f"  got {len(decoded)} lines, want {len(expected)}")
+        failed += 1
+    if not expected:
+        print("FAIL nothing was dumped")
+        failed += 1
+    if piped.stdout != result.stdout:
+        print("FAIL hex input decodes differently")
+        failed += 1
+
+    print(f"{'FAIL' if failed else 'PASS'} {len(decoded)} lines decoded")
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 3:
+        sys.exit(f"usage: {sys.argv[0]} <log_decode.py> <test_log_shipping>")
+    sys.exit(main(sys.argv[1], sys.argv[2]))
@@ -0,0 +1,357 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "domain/contracts/logger/leveled.h"
+#include "domain/contracts/messaging/publish.h"
+#include "host_test.h"
+#include "infrastructure/logger/leveled/ring_impl.h"
+#include "infrastructure/logger/leveled/ring_impl_utils.h"
+#include "infrastructure/logger/leveled/stdio_impl.h"
+#include "infrastructure/messaging/publish/stub_impl.h"
+#include "infrastructure/messaging/publish/stub_impl_types.h"
+#include "presentation/task/log_shipping/task.h"
+
+/*
+ * The stdio logger runs callbacks in the caller, so every line reaches the
+ * shipping task synchronously. Bursts are sized to one batch and the test
+ * waits for each publish, so nothing is evicted by a busy publisher.
+ */
+#define BATCH_MAX_CNT  16
+#define MAX_LATENCY_MS 50
+#define BURST_CNT      10
+
+/* Passed by pointer so the frames can be checked against it */
+static const char ship_tag[] = "ship";
+
+typedef struct {
+    dom_contracts_logger_leveled_t*        logger;
+    dom_contracts_messaging_publish_t*     publish;
+    inf_messaging_publish_stub_impl_ctx_t* publish_ctx;
+    pres_task_log_shipping_t*              shipping;
+    bool                                   ring;
+} fixture_t;
+
+/* Where test_log_decode.py wants the binary payload and the lines it should decode to */
+static const char* dump_dir;
+
+/* Helpers */
+
+static bool fixture_start(fixture_t* fx, bool binary);
+
+static bool fixture_setup(fixture_t* fx) {
+    memset(fx, 0, sizeof(*fx));
+
+    inf_logger_leveled_stdio_impl_cfg_t logger_cfg = INF_LOGGER_LEVELED_STDIO_IMPL_CFG_DEFAULT();
+    logger_cfg.level                               = DOMAIN_MODELS_LOGGER_LEVEL_DEBUG;
+    logger_cfg.cb_max_cnt                          = 1;
+    fx->logger                                     = inf_logger_leveled_stdio_impl_new(&logger_cfg);
+
+    return fixture_start(fx, false);
+}
+
+/* Ring logger in deferred mode, the only one that hands out records */
+static bool fixture_setup_ring(fixture_t* fx, bool binary) {
+    memset(fx, 0, sizeof(*fx));
+
+    inf_logger_leveled_ring_impl_cfg_t logger_cfg = INF_LOGGER_LEVELED_RING_IMPL_CFG_DEFAULT();
+    logger_cfg.level                              = DOMAIN_MODELS_LOGGER_LEVEL_DEBUG;
+    logger_cfg.cb_max_cnt                         = 1;
+    logger_cfg.deferred_format                    = true;
+    fx->logger                                    = inf_logger_leveled_ring_impl_new(&logger_cfg);
+    fx->ring                                      = true;
+
+    return fixture_start(fx, binary);
+}
+
+static bool fixture_start(fixture_t* fx, bool binary) {
+    inf_messaging_publish_stub_impl_cfg_t publish_cfg = INF_MESSAGING_PUBLISH_STUB_IMPL_CFG_DEFAULT();
+    fx->publish                                       = inf_messaging_publish_stub_impl_new(&publish_cfg);
+    if (!fx->logger || !fx->publish) {
+        return false;
+    }
+    fx->publish_ctx = (inf_messaging_publish_stub_impl_ctx_t*)fx->publish->ctx;
+
+    pres_task_log_shipping_cfg_t cfg = {
+        .logger         = fx->logger,
+        .publish        = fx->publish,
+        .level          = DOMAIN_MODELS_LOGGER_LEVEL_INFO,
+        .batch_max_cnt  = BATCH_MAX_CNT,
+        .max_latency_ms = MAX_LATENCY_MS,
+        .binary         = binary,
+    };
+    fx->shipping = pres_task_log_shipping_new(&cfg);
+
+    return fx->shipping && pres_task_log_shipping_start(fx->shipping) == DOMAIN_MODELS_ERROR_OK;
+}
+
+static void fixture_teardown(fixture_t* fx) {
+    pres_task_log_shipping_delete(fx->shipping);
+    inf_messaging_publish_stub_impl_delete(fx->publish);
+    if (fx->ring) {
+        inf_logger_leveled_ring_impl_delete(fx->logger);
+    } else {
+        inf_logger_leveled_stdio_impl_delete(fx->logger);
+    }
+}
+
+static pres_task_log_shipping_stats_t wait_shipped(fixture_t* fx, uint32_t shipped_cnt, long timeout_ms) {
+    pres_task_log_shipping_stats_t stats = {0};
+
+    for (long waited_ms = 0; waited_ms <= timeout_ms; waited_ms++) {
+        pres_task_log_shipping_get_stats(fx->shipping, &stats);
+        if (stats.shipped_cnt >= shipped_cnt) {
+            break;
+        }
+        host_test_sleep_us(1000);
+    }
+
+    return stats;
+}
+
+/* Logs one batch through the ring logger and returns the published payload length */
+static size_t ship_ring_batch(fixture_t* fx) {
+    host_test_stdout_silence();
+    for (int i = 0; i < BATCH_MAX_CNT; i++) {
+        DOM_CONTRACTS_LOGGER_LEVELED_INFO(fx->logger, ship_tag, "line %d of %d from %s", i, BATCH_MAX_CNT, i % 2 ? "sensor" : "wifi");
+    }
+    DOM_CONTRACTS_LOGGER_LEVELED_DEBUG(fx->logger, ship_tag, "filtered by level");
+    pres_task_log_shipping_stats_t stats = wait_shipped(fx, BATCH_MAX_CNT, 1000);
+    host_test_stdout_restore();
+
+    pres_task_log_shipping_stop(fx->shipping);
+    HOST_TEST_CHECK_EQ_INT(stats.shipped_cnt, BATCH_MAX_CNT);
+    HOST_TEST_CHECK_EQ_INT(stats.dropped_cnt, 0);
+    HOST_TEST_CHECK_EQ_INT(fx->publish_ctx->log_batch_record_cnt, BATCH_MAX_CNT);
+
+    return fx->publish_ctx->log_batch_len;
+}
+
+static void dump_payload(const uint8_t* payload, size_t payload_len, const char* expected) {
+    char  path[512];
+    FILE* file;
+
+    snprintf(path, sizeof(path), "%s/payload.bin", dump_dir);
+    file = fopen(path, "wb");
+    HOST_TEST_CHECK(file != NULL);
+    if (file) {
+        fwrite(payload, 1, payload_len, file);
+        fclose(file);
+    }
+
+    snprintf(path, sizeof(path), "%s/expected.txt", dump_dir);
+    file = fopen(path, "w");
+    HOST_TEST_CHECK(file != NULL);
+    if (file) {
+        fputs(expected, file);
+        fclose(file);
+    }
+}
+
+/* Tests */
+
+static void test_full_batches_publish_once_per_batch(void) {
+    fixture_t fx;
+    bool      ready = fixture_setup(&fx);
+    HOST_TEST_CHECK(ready);
+    if (!ready) {
+        return;
+    }
+
+    host_test_stdout_silence();
+    for (int burst = 0; burst < BURST_CNT; burst++) {
+        for (int i = 0; i < BATCH_MAX_CNT; i++) {
+            DOM_CONTRACTS_LOGGER_LEVELED_INFO(fx.logger, "ship", "burst %d line %d", burst, i);
+        }
+        (void)wait_shipped(&fx, (uint32_t)((burst + 1) * BATCH_MAX_CNT), 1000);
+    }
+    host_test_stdout_restore();
+
+    pres_task_log_shipping_stats_t stats = {0};
+    pres_task_log_shipping_get_stats(fx.shipping, &stats);
+    pres_task_log_shipping_stop(fx.shipping);
+
+    size_t line_cnt    = BURST_CNT * BATCH_MAX_CNT;
+    size_t publish_cnt = fx.publish_ctx->log_batch_publish_cnt;
+    printf("%zu lines in %zu publishes, %.1f lines per publish\n", line_cnt, publish_cnt, publish_cnt ? (double)line_cnt / publish_cnt : 0.0);
+
+    HOST_TEST_CHECK_EQ_INT(stats.shipped_cnt, line_cnt);
+    HOST_TEST_CHECK_EQ_INT(stats.dropped_cnt, 0);
+    HOST_TEST_CHECK_EQ_INT(stats.publish_cnt, BURST_CNT);
+    HOST_TEST_CHECK_EQ_INT(publish_cnt, BURST_CNT);
+    HOST_TEST_CHECK_EQ_INT(fx.publish_ctx->log_batch_record_total_cnt, line_cnt);
+    HOST_TEST_CHECK_EQ_INT(fx.publish_ctx->log_batch_record_cnt, BATCH_MAX_CNT);
+
+    fixture_teardown(&fx);
+}
+
+static void test_partial_batch_ships_after_max_latency(void) {
+    fixture_t fx;
+    bool      ready = fixture_setup(&fx);
+    HOST_TEST_CHECK(ready);
+    if (!ready) {
+        return;
+    }
+
+    host_test_stdout_silence();
+    int64_t start_ns = host_test_now_ns();
+    DOM_CONTRACTS_LOGGER_LEVELED_WARN(fx.logger, "ship", "one");
+    DOM_CONTRACTS_LOGGER_LEVELED_INFO(fx.logger, "ship", "two");
+    DOM_CONTRACTS_LOGGER_LEVELED_DEBUG(fx.logger, "ship", "filtered by level");
+    DOM_CONTRACTS_LOGGER_LEVELED_ERROR(fx.logger, "ship", "three");
+    pres_task_log_shipping_stats_t stats      = wait_shipped(&fx, 3, MAX_LATENCY_MS * 20);
+    int64_t                        elapsed_ms = (host_test_now_ns() - start_ns) / 1000000;
+    host_test_stdout_restore();
+
+    pres_task_log_shipping_stop(fx.shipping);
+
+    HOST_TEST_CHECK_EQ_INT(stats.shipped_cnt, 3);
+    HOST_TEST_CHECK_EQ_INT(stats.publish_cnt, 1);
+    HOST_TEST_CHECK(elapsed_ms >= MAX_LATENCY_MS - 1);
+    HOST_TEST_CHECK_EQ_INT(fx.publish_ctx->log_batch_record_cnt, 3);
+    HOST_TEST_CHECK(strstr(fx.publish_ctx->log_batch, "one\n") != NULL);
+    HOST_TEST_CHECK(strstr(fx.publish_ctx->log_batch, "filtered") == NULL);
+
+    fixture_teardown(&fx);
+}
+
+static void test_disconnected_batch_waits_for_broker(void) {
+    fixture_t fx;
+    bool      ready = fixture_setup(&fx);
+    HOST_TEST_CHECK(ready);
+    if (!ready) {
+        return;
+    }
+    fx.publish_ctx->connected = false;
+
+    host_test_stdout_silence();
+    for (int i = 0; i < 4; i++) {
+        DOM_CONTRACTS_LOGGER_LEVELED_INFO(fx.logger, "ship", "offline %d", i);
+    }
+    host_test_sleep_us(MAX_LATENCY_MS * 3 * 1000);
+
+    pres_task_log_shipping_stats_t stats = {0};
+    pres_task_log_shipping_get_stats(fx.shipping, &stats);
+    HOST_TEST_CHECK_EQ_INT(stats.publish_cnt, 0);
+
+    fx.publish_ctx->connected = true;
+    stats                     = wait_shipped(&fx, 4, MAX_LATENCY_MS * 20);
+    host_test_stdout_restore();
+
+    pres_task_log_shipping_stop(fx.shipping);
+
+    HOST_TEST_CHECK_EQ_INT(stats.shipped_cnt, 4);
+    HOST_TEST_CHECK_EQ_INT(stats.publish_cnt, 1);
+    HOST_TEST_CHECK_EQ_INT(stats.failed_cnt, 0);
+
+    fixture_teardown(&fx);
+}
+
+static void test_binary_frames_decode_to_text(void) {
+    fixture_t fx;
+    bool      ready = fixture_setup_ring(&fx, true);
+    HOST_TEST_CHECK(ready);
+    if (!ready) {
+        return;
+    }
+
+    size_t         payload_len = ship_ring_batch(&fx);
+    const uint8_t* payload     = (const uint8_t*)fx.publish_ctx->log_batch;
+    HOST_TEST_CHECK(fx.publish_ctx->log_batch_binary);
+    HOST_TEST_CHECK(payload_len > PRES_TASK_LOG_SHIPPING_BINARY_HEAD_LEN);
+    HOST_TEST_CHECK(memcmp(payload, PRES_TASK_LOG_SHIPPING_BINARY_MAGIC, 4) == 0);
+    HOST_TEST_CHECK_EQ_INT(payload[4], PRES_TASK_LOG_SHIPPING_BINARY_VERSION);
+    HOST_TEST_CHECK_EQ_INT(payload[11], sizeof(void*));
+
+    /* Pointers in the frames are this process's own, so the ring's decoder can read them back */
+    static char expected[BATCH_MAX_CNT * 128];
+    size_t      expected_len = 0;
+    size_t      offset       = PRES_TASK_LOG_SHIPPING_BINARY_HEAD_LEN;
+    size_t      frame_cnt    = 0;
+
+    while (offset + PRES_TASK_LOG_SHIPPING_BINARY_FRAME_LEN <= payload_len) {
+        uint16_t                   body_len;
+        dom_models_logger_record_t record = {0};
+        size_t                     cursor = offset;
+
+        memcpy(&body_len, payload + cursor, sizeof(body_len));
+        cursor += sizeof(body_len);
+        record.level = (dom_models_logger_level_t)payload[cursor++];
+        memcpy(&record.tag, payload + cursor, sizeof(record.tag));
+        cursor += sizeof(record.tag);
+        memcpy(&record.format, payload + cursor, sizeof(record.format));
+        cursor += sizeof(record.format);
+        memcpy(&record.timestamp_us, payload + cursor, sizeof(record.timestamp_us));
+        cursor += sizeof(record.timestamp_us);
+        record.args     = payload + cursor;
+        record.args_len = offset + sizeof(body_len) + body_len - cursor;
+
+        char body[128];
+        char want[128];
+        inf_logger_leveled_ring_impl_decode_args(body, sizeof(body), record.format, record.args, record.args_len);
+        snprintf(want, sizeof(want), "line %zu of %d from %s", frame_cnt, BATCH_MAX_CNT, frame_cnt % 2 ? "sensor" : "wifi");
+        HOST_TEST_CHECK_EQ_STR(body, want);
+        HOST_TEST_CHECK_EQ_INT(record.level, DOMAIN_MODELS_LOGGER_LEVEL_INFO);
+        HOST_TEST_CHECK(record.tag == ship_tag);
+
+        expected_len += (size_t)snprintf(expected + expected_len, sizeof(expected) - expected_len, "[INFO] [%s] %s\n", ship_tag, body);
+        offset += sizeof(body_len) + body_len;
+        frame_cnt++;
+    }
+    HOST_TEST_CHECK_EQ_INT(offset, payload_len);
+    HOST_TEST_CHECK_EQ_INT(frame_cnt, BATCH_MAX_CNT);
+
+    if (dump_dir) {
+        dump_payload(payload, payload_len, expected);
+    }
+
+    fixture_teardown(&fx);
+}
+
+static void test_binary_batch_is_smaller_than_text(void) {
+    fixture_t fx;
+    size_t    text_len   = 0;
+    size_t    binary_len = 0;
+
+    /* Same logger and lines both times, only the shipping mode differs */
+    for (int binary = 0; binary < 2; binary++) {
+        bool ready = fixture_setup_ring(&fx, binary);
+        HOST_TEST_CHECK(ready);
+        if (!ready) {
+            return;
+        }
+
+        size_t payload_len = ship_ring_batch(&fx);
+        HOST_TEST_CHECK_EQ_INT(fx.publish_ctx->log_batch_binary, binary);
+        if (binary) {
+            binary_len = payload_len;
+        } else {
+            text_len = payload_len;
+        }
+
+        fixture_teardown(&fx);
+    }
+
+    printf(
+        "%d records: text %zu bytes, binary %zu bytes (%zu byte frame head with %zu byte pointers)\n",
+        BATCH_MAX_CNT,
+        text_len,
+        binary_len,
+        PRES_TASK_LOG_SHIPPING_BINARY_FRAME_LEN,
+        sizeof(void*)
+    );
+    HOST_TEST_CHECK(binary_len < text_len);
+}
+
+int main(int argc, char** argv) {
+    dump_dir = argc > 1 ? argv[1] : NULL;
+
+    HOST_TEST_RUN(test_full_batches_publish_once_per_batch);
+    HOST_TEST_RUN(test_partial_batch_ships_after_max_latency);
+    HOST_TEST_RUN(test_disconnected_batch_waits_for_broker);
+    HOST_TEST_RUN(test_binary_frames_decode_to_text);
+    HOST_TEST_RUN(test_binary_batch_is_smaller_than_text);
+
+    return HOST_TEST_RESULT();
+}
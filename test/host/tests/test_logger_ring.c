@@ -0,0 +1,214 @@
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "domain/contracts/logger/leveled.h"
+#include "host_test.h"
+#include "infrastructure/logger/leveled/ring_impl.h"
+#include "infrastructure/logger/leveled/stdio_impl.h"
+
+/*
+ * The sink callback stands in for the UART: it sleeps SINK_DELAY_US per
+ * line, or blocks on the gate. The stdio logger pays that cost in the
+ * caller, the ring logger only in its drain task.
+ */
+#define SINK_DELAY_US 2000
+#define CALL_CNT      32
+#define SLOT_CNT      8
+
+typedef struct {
+    atomic_bool gated;
+    atomic_bool entered;
+    atomic_uint line_cnt;
+} sink_t;
+
+/* Helpers */
+
+static void sink_cb(void* cb_ctx, const char* msg, size_t msg_len) {
+    (void)msg;
+    (void)msg_len;
+
+    sink_t* sink = (sink_t*)cb_ctx;
+    atomic_store(&sink->entered, true);
+    while (atomic_load(&sink->gated)) {
+        host_test_sleep_us(100);
+    }
+    host_test_sleep_us(SINK_DELAY_US);
+    atomic_fetch_add(&sink->line_cnt, 1);
+}
+
+static void capture_cb(void* cb_ctx, const char* msg, size_t msg_len) {
+    char* out = (char*)cb_ctx;
+
+    snprintf(out, 128, "%.*s", (int)msg_len, msg);
+}
+
+static int cmp_i64(const void* a, const void* b) {
+    int64_t lhs = *(const int64_t*)a;
+    int64_t rhs = *(const int64_t*)b;
+
+    return (lhs > rhs) - (lhs < rhs);
+}
+
+/* Median latency of CALL_CNT info() calls, in nanoseconds */
+static int64_t measure_info_p50_ns(dom_contracts_logger_leveled_t* logger) {
+    int64_t samples[CALL_CNT];
+
+    for (int i = 0; i < CALL_CNT; i++) {
+        int64_t start_ns = host_test_now_ns();
+        logger->info(logger, "bench", "sample %d value=%u", i, (unsigned int)(i * 31));
+        samples[i] = host_test_now_ns() - start_ns;
+    }
+    qsort(samples, CALL_CNT, sizeof(samples[0]), cmp_i64);
+
+    return samples[CALL_CNT / 2];
+}
+
+static void wait_drained(dom_contracts_logger_leveled_t* logger) {
+    inf_logger_leveled_ring_impl_stats_t stats = {0};
+
+    for (int i = 0; i < 5000; i++) {
+        inf_logger_leveled_ring_impl_get_stats(logger, &stats);
+        if (stats.pending_cnt == 0) {
+            return;
+        }
+        host_test_sleep_us(1000);
+    }
+}
+
+/* Tests */
+
+static void test_info_latency_does_not_include_sink(void) {
+    sink_t stdio_sink = {0};
+    sink_t ring_sink  = {0};
+
+    inf_logger_leveled_stdio_impl_cfg_t stdio_cfg = INF_LOGGER_LEVELED_STDIO_IMPL_CFG_DEFAULT();
+    stdio_cfg.cb_max_cnt                          = 1;
+    inf_logger_leveled_ring_impl_cfg_t ring_cfg   = INF_LOGGER_LEVELED_RING_IMPL_CFG_DEFAULT();
+    ring_cfg.cb_max_cnt                           = 1;
+    ring_cfg.slot_cnt                             = CALL_CNT * 2;
+
+    dom_contracts_logger_leveled_t* stdio_logger = inf_logger_leveled_stdio_impl_new(&stdio_cfg);
+    dom_contracts_logger_leveled_t* ring_logger  = inf_logger_leveled_ring_impl_new(&ring_cfg);
+    HOST_TEST_CHECK(stdio_logger && ring_logger);
+    if (!stdio_logger || !ring_logger) {
+        return;
+    }
+    stdio_logger->add_callback(stdio_logger, &stdio_sink, sink_cb);
+    ring_logger->add_callback(ring_logger, &ring_sink, sink_cb);
+
+    host_test_stdout_silence();
+    int64_t stdio_p50_ns = measure_info_p50_ns(stdio_logger);
+    int64_t ring_p50_ns  = measure_info_p50_ns(ring_logger);
+    wait_drained(ring_logger);
+    host_test_stdout_restore();
+
+    printf("info() p50: stdio %" PRId64 " ns, ring %" PRId64 " ns (sink %d us/line)\n", stdio_p50_ns, ring_p50_ns, SINK_DELAY_US);
+
+    HOST_TEST_CHECK(stdio_p50_ns >= (int64_t)SINK_DELAY_US * 1000);
+    HOST_TEST_CHECK(ring_p50_ns < (int64_t)SINK_DELAY_US * 1000 / 4);
+    HOST_TEST_CHECK_EQ_INT(atomic_load(&ring_sink.line_cnt), CALL_CNT);
+
+    inf_logger_leveled_ring_impl_stats_t stats = {0};
+    inf_logger_leveled_ring_impl_get_stats(ring_logger, &stats);
+    HOST_TEST_CHECK_EQ_INT(stats.written_cnt, CALL_CNT);
+    HOST_TEST_CHECK_EQ_INT(stats.dropped_cnt, 0);
+
+    inf_logger_leveled_ring_impl_delete(ring_logger);
+    inf_logger_leveled_stdio_impl_delete(stdio_logger);
+}
+
+static void test_full_ring_drops_instead_of_blocking(void) {
+    sink_t sink = {0};
+    atomic_store(&sink.gated, true);
+
+    inf_logger_leveled_ring_impl_cfg_t cfg = INF_LOGGER_LEVELED_RING_IMPL_CFG_DEFAULT();
+    cfg.cb_max_cnt                         = 1;
+    cfg.slot_cnt                           = SLOT_CNT;
+
+    dom_contracts_logger_leveled_t* logger = inf_logger_leveled_ring_impl_new(&cfg);
+    HOST_TEST_CHECK(logger != NULL);
+    if (!logger) {
+        return;
+    }
+    logger->add_callback(logger, &sink, sink_cb);
+
+    host_test_stdout_silence();
+
+    /* The drain task holds the first slot while the sink is stuck */
+    logger->info(logger, "test", "first");
+    for (int i = 0; i < 5000 && !atomic_load(&sink.entered); i++) {
+        host_test_sleep_us(1000);
+    }
+    HOST_TEST_CHECK(atomic_load(&sink.entered));
+
+    int64_t max_ns = 0;
+    for (int i = 0; i < SLOT_CNT * 2; i++) {
+        int64_t start_ns = host_test_now_ns();
+        logger->info(logger, "test", "line %d", i);
+        int64_t elapsed_ns = host_test_now_ns() - start_ns;
+        if (elapsed_ns > max_ns) {
+            max_ns = elapsed_ns;
+        }
+    }
+
+    inf_logger_leveled_ring_impl_stats_t stats = {0};
+    inf_logger_leveled_ring_impl_get_stats(logger, &stats);
+    HOST_TEST_CHECK_EQ_INT(stats.slot_cnt, SLOT_CNT);
+    HOST_TEST_CHECK_EQ_INT(stats.pending_cnt, SLOT_CNT);
+    HOST_TEST_CHECK_EQ_INT(stats.high_water_cnt, SLOT_CNT);
+    HOST_TEST_CHECK_EQ_INT(stats.dropped_cnt, SLOT_CNT + 1);
+    HOST_TEST_CHECK(max_ns < (int64_t)SINK_DELAY_US * 1000);
+
+    atomic_store(&sink.gated, false);
+    wait_drained(logger);
+    host_test_stdout_restore();
+
+    inf_logger_leveled_ring_impl_get_stats(logger, &stats);
+    HOST_TEST_CHECK_EQ_INT(stats.written_cnt, SLOT_CNT);
+    HOST_TEST_CHECK_EQ_INT(atomic_load(&sink.line_cnt), SLOT_CNT);
+
+    inf_logger_leveled_ring_impl_delete(logger);
+}
+
+static void test_deferred_format_matches_eager(void) {
+    char lines[2][128] = {{0}};
+
+    inf_logger_leveled_ring_impl_cfg_t cfg = INF_LOGGER_LEVELED_RING_IMPL_CFG_DEFAULT();
+    cfg.cb_max_cnt                         = 1;
+
+    for (int deferred = 0; deferred <= 1; deferred++) {
+        cfg.deferred_format = deferred;
+
+        dom_contracts_logger_leveled_t* logger = inf_logger_leveled_ring_impl_new(&cfg);
+        HOST_TEST_CHECK(logger != NULL);
+        if (!logger) {
+            return;
+        }
+        logger->add_callback(logger, lines[deferred], capture_cb);
+
+        host_test_stdout_silence();
+        logger->info(logger, "tag", "s=%s d=%d u=%u x=%lx", "text", -7, 42u, 0xbeefUL);
+        wait_drained(logger);
+        host_test_stdout_restore();
+
+        inf_logger_leveled_ring_impl_delete(logger);
+    }
+
+    /* The timestamps differ, everything from the level on must match */
+    const char* eager    = strstr(lines[0], "[INFO]");
+    const char* deferred = strstr(lines[1], "[INFO]");
+    HOST_TEST_CHECK_EQ_STR(eager, "[INFO] [tag] s=text d=-7 u=42 x=beef");
+    HOST_TEST_CHECK_EQ_STR(deferred, eager);
+}
+
+int main(void) {
+    HOST_TEST_RUN(test_info_latency_does_not_include_sink);
+    HOST_TEST_RUN(test_full_ring_drops_instead_of_blocking);
+    HOST_TEST_RUN(test_deferred_format_matches_eager);
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,257 @@
+#include <dirent.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "domain/contracts/messaging/publish.h"
+#include "domain/models/messaging.h"
+#include "host_test.h"
+#include "infrastructure/messaging/publish/outbox_impl.h"
+#include "infrastructure/messaging/publish/outbox_impl_types.h"
+#include "infrastructure/messaging/publish/stub_impl.h"
+#include "infrastructure/messaging/publish/stub_impl_types.h"
+
+/*
+ * The outbox runs on a temporary host directory in place of LittleFS. The
+ * replay interval is long enough that only replay_now() triggers a burst,
+ * so every burst, and every cursor save, happens where the test asks.
+ */
+#define REPLAY_INTERVAL_MS 60000
+#define REPLAY_BURST_CNT   4
+#define RECORD_CNT         10
+
+typedef struct {
+    char                                   dir_path[64];
+    dom_contracts_messaging_publish_t*     inner;
+    inf_messaging_publish_stub_impl_ctx_t* inner_ctx;
+    dom_contracts_messaging_publish_t*     outbox;
+} fixture_t;
+
+/* Helpers */
+
+static bool outbox_open(fixture_t* fx) {
+    inf_messaging_publish_outbox_impl_cfg_t cfg = INF_MESSAGING_PUBLISH_OUTBOX_IMPL_CFG_DEFAULT();
+    cfg.inner                                   = fx->inner;
+    cfg.dir_path                                = fx->dir_path;
+    cfg.replay_interval_ms                      = REPLAY_INTERVAL_MS;
+    cfg.replay_burst_cnt                        = REPLAY_BURST_CNT;
+
+    fx->outbox = inf_messaging_publish_outbox_impl_new(&cfg);
+
+    return fx->outbox != NULL;
+}
+
+static bool fixture_setup(fixture_t* fx) {
+    memset(fx, 0, sizeof(*fx));
+    snprintf(fx->dir_path, sizeof(fx->dir_path), "/tmp/haya_outbox_XXXXXX");
+    if (!mkdtemp(fx->dir_path)) {
+        return false;
+    }
+
+    inf_messaging_publish_stub_impl_cfg_t inner_cfg = INF_MESSAGING_PUBLISH_STUB_IMPL_CFG_DEFAULT();
+    inner_cfg.connected                             = false;
+    fx->inner                                       = inf_messaging_publish_stub_impl_new(&inner_cfg);
+    if (!fx->inner) {
+        return false;
+    }
+    fx->inner_ctx = (inf_messaging_publish_stub_impl_ctx_t*)fx->inner->ctx;
+
+    return true;
+}
+
+static void fixture_teardown(fixture_t* fx) {
+    inf_messaging_publish_outbox_impl_delete(fx->outbox);
+    inf_messaging_publish_stub_impl_delete(fx->inner);
+
+    DIR* dir = opendir(fx->dir_path);
+    if (dir) {
+        struct dirent* entry = NULL;
+        while ((entry = readdir(dir)) != NULL) {
+            char path[sizeof(fx->dir_path) + 256];
+            snprintf(path, sizeof(path), "%s/%s", fx->dir_path, entry->d_name);
+            unlink(path);
+        }
+        closedir(dir);
+    }
+    rmdir(fx->dir_path);
+}
+
+static bool file_exists(const fixture_t* fx, const char* name) {
+    char path[sizeof(fx->dir_path) + 256];
+    snprintf(path, sizeof(path), "%s/%s", fx->dir_path, name);
+
+    return access(path, F_OK) == 0;
+}
+
+static void write_file(const fixture_t* fx, const char* name, const void* data, size_t data_len) {
+    char path[sizeof(fx->dir_path) + 256];
+    snprintf(path, sizeof(path), "%s/%s", fx->dir_path, name);
+
+    FILE* file = fopen(path, "wb");
+    if (file) {
+        fwrite(data, data_len, 1, file);
+        fclose(file);
+    }
+}
+
+static void send_logs(fixture_t* fx, int first, int cnt) {
+    for (int i = first; i < first + cnt; i++) {
+        dom_models_messaging_log_t log = {0};
+        snprintf(log.message, sizeof(log.message), "log %d", i);
+        HOST_TEST_CHECK_EQ_INT(fx->outbox->send_log(fx->outbox, &log), DOMAIN_MODELS_ERROR_OK);
+    }
+}
+
+static inf_messaging_publish_outbox_impl_stats_t replay_until(fixture_t* fx, uint32_t replayed_cnt) {
+    inf_messaging_publish_outbox_impl_stats_t stats = {0};
+
+    for (int waited_ms = 0; waited_ms < 2000; waited_ms++) {
+        inf_messaging_publish_outbox_impl_get_stats(fx->outbox, &stats);
+        if (stats.replayed_cnt >= replayed_cnt) {
+            break;
+        }
+        if (waited_ms % 50 == 0) {
+            inf_messaging_publish_outbox_impl_replay_now(fx->outbox);
+        }
+        host_test_sleep_us(1000);
+    }
+
+    return stats;
+}
+
+/* Tests */
+
+static void test_stores_while_disconnected_and_replays_in_order(void) {
+    fixture_t fx;
+    bool      ready = fixture_setup(&fx) && outbox_open(&fx);
+    HOST_TEST_CHECK(ready);
+    if (!ready) {
+        return;
+    }
+
+    send_logs(&fx, 0, RECORD_CNT);
+
+    inf_messaging_publish_outbox_impl_stats_t stats = {0};
+    inf_messaging_publish_outbox_impl_get_stats(fx.outbox, &stats);
+    HOST_TEST_CHECK_EQ_INT(stats.stored_cnt, RECORD_CNT);
+    HOST_TEST_CHECK_EQ_INT(stats.pending_segment_cnt, 1);
+    HOST_TEST_CHECK_EQ_INT(fx.inner_ctx->log_publish_cnt, 0);
+
+    fx.inner_ctx->connected = true;
+    stats                   = replay_until(&fx, RECORD_CNT);
+    HOST_TEST_CHECK_EQ_INT(stats.replayed_cnt, RECORD_CNT);
+    HOST_TEST_CHECK_EQ_INT(stats.pending_segment_cnt, 0);
+    HOST_TEST_CHECK_EQ_INT(fx.inner_ctx->log_publish_cnt, RECORD_CNT);
+    HOST_TEST_CHECK_EQ_STR(fx.inner_ctx->log.message, "log 9");
+
+    /* Drained, so new messages go straight through */
+    send_logs(&fx, RECORD_CNT, 1);
+    HOST_TEST_CHECK_EQ_INT(fx.inner_ctx->log_publish_cnt, RECORD_CNT + 1);
+
+    fixture_teardown(&fx);
+}
+
+static void test_cursor_survives_restart(void) {
+    fixture_t fx;
+    bool      ready = fixture_setup(&fx) && outbox_open(&fx);
+    HOST_TEST_CHECK(ready);
+    if (!ready) {
+        return;
+    }
+
+    send_logs(&fx, 0, RECORD_CNT);
+
+    /* One burst, then wait for its cursor save before the "reboot" */
+    fx.inner_ctx->connected = true;
+    inf_messaging_publish_outbox_impl_replay_now(fx.outbox);
+    for (int waited_ms = 0; waited_ms < 2000 && !file_exists(&fx, INF_MESSAGING_PUBLISH_OUTBOX_IMPL_CURSOR_NAME); waited_ms++) {
+        host_test_sleep_us(1000);
+    }
+    inf_messaging_publish_outbox_impl_stats_t stats = {0};
+    inf_messaging_publish_outbox_impl_get_stats(fx.outbox, &stats);
+    HOST_TEST_CHECK(file_exists(&fx, INF_MESSAGING_PUBLISH_OUTBOX_IMPL_CURSOR_NAME));
+    HOST_TEST_CHECK_EQ_INT(stats.replayed_cnt, REPLAY_BURST_CNT);
+    HOST_TEST_CHECK_EQ_INT(fx.inner_ctx->log_publish_cnt, REPLAY_BURST_CNT);
+
+    inf_messaging_publish_outbox_impl_delete(fx.outbox);
+    fx.outbox = NULL;
+    HOST_TEST_CHECK(outbox_open(&fx));
+
+    stats = replay_until(&fx, RECORD_CNT - REPLAY_BURST_CNT);
+    HOST_TEST_CHECK_EQ_INT(stats.replayed_cnt, RECORD_CNT - REPLAY_BURST_CNT);
+    HOST_TEST_CHECK_EQ_INT(fx.inner_ctx->log_publish_cnt, RECORD_CNT);
+    HOST_TEST_CHECK_EQ_STR(fx.inner_ctx->log.message, "log 9");
+
+    /* An empty outbox starts over at segment 0 and must not keep the cursor */
+    inf_messaging_publish_outbox_impl_delete(fx.outbox);
+    fx.outbox = NULL;
+    HOST_TEST_CHECK(outbox_open(&fx));
+    HOST_TEST_CHECK(!file_exists(&fx, INF_MESSAGING_PUBLISH_OUTBOX_IMPL_CURSOR_NAME));
+
+    fixture_teardown(&fx);
+}
+
+static void test_other_format_is_dropped(void) {
+    fixture_t fx;
+    bool      ready = fixture_setup(&fx);
+    HOST_TEST_CHECK(ready);
+    if (!ready) {
+        return;
+    }
+
+    /* A status record written by a firmware with an older struct layout */
+    struct {
+        inf_messaging_publish_outbox_impl_record_header_t header;
+        dom_models_messaging_status_t                     status;
+    } old_record = {
+        .header = {
+            .magic = (uint16_t)(INF_MESSAGING_PUBLISH_OUTBOX_IMPL_RECORD_MAGIC - 1),
+            .kind  = INF_MESSAGING_PUBLISH_OUTBOX_IMPL_KIND_STATUS,
+            .len   = sizeof(dom_models_messaging_status_t),
+        },
+        .status = {.status = "online"},
+    };
+    inf_messaging_publish_outbox_impl_cursor_t old_cursor = {
+        .magic  = (uint16_t)(INF_MESSAGING_PUBLISH_OUTBOX_IMPL_CURSOR_MAGIC - 1),
+        .seq    = 0,
+        .offset = sizeof(old_record),
+    };
+    write_file(&fx, "00000000.seg", &old_record, sizeof(old_record));
+    write_file(&fx, INF_MESSAGING_PUBLISH_OUTBOX_IMPL_CURSOR_NAME, &old_cursor, sizeof(old_cursor));
+
+    ready = outbox_open(&fx);
+    HOST_TEST_CHECK(ready);
+    if (!ready) {
+        fixture_teardown(&fx);
+        return;
+    }
+
+    /* The old cursor is ignored, so the old record is read, rejected and dropped */
+    fx.inner_ctx->connected = true;
+    inf_messaging_publish_outbox_impl_stats_t stats = {0};
+    for (int waited_ms = 0; waited_ms < 2000 && file_exists(&fx, "00000000.seg"); waited_ms++) {
+        if (waited_ms % 50 == 0) {
+            inf_messaging_publish_outbox_impl_replay_now(fx.outbox);
+        }
+        host_test_sleep_us(1000);
+    }
+    inf_messaging_publish_outbox_impl_get_stats(fx.outbox, &stats);
+
+    HOST_TEST_CHECK(!file_exists(&fx, "00000000.seg"));
+    HOST_TEST_CHECK_EQ_INT(stats.replayed_cnt, 0);
+    HOST_TEST_CHECK_EQ_INT(stats.pending_segment_cnt, 0);
+    HOST_TEST_CHECK_EQ_INT(fx.inner_ctx->status_publish_cnt, 0);
+
+    fixture_teardown(&fx);
+}
+
+int main(void) {
+    HOST_TEST_RUN(test_stores_while_disconnected_and_replays_in_order);
+    HOST_TEST_RUN(test_cursor_survives_restart);
+    HOST_TEST_RUN(test_other_format_is_dropped);
+
+    return HOST_TEST_RESULT();
+}
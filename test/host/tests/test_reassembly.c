@@ -0,0 +1,226 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "domain/models/error.h"
+#include "host_test.h"
+#include "presentation/mqtt/reassembly.h"
+#include "presentation/mqtt/router.h"
+
+/*
+ * Fragments are cut the way esp-mqtt delivers a publish larger than its
+ * 4096 byte receive buffer: the first one at offset 0, the rest at
+ * current_data_offset, all with the same msg_id and total_data_len.
+ */
+#define CLIENT_BUFFER_LEN 4096
+#define PAYLOAD_LEN       6000
+
+static char payload[PRES_MQTT_REASSEMBLY_SLOT_LEN];
+
+/* Helpers */
+
+static void fill_payload(void) {
+    for (size_t i = 0; i < sizeof(payload); i++) {
+        payload[i] = (char)('a' + i % 26);
+    }
+}
+
+static pres_mqtt_router_route_t make_route(size_t max_len) {
+    pres_mqtt_router_route_t route = {
+        .qos     = 1,
+        .max_len = max_len,
+    };
+    snprintf(route.filter.str, sizeof(route.filter.str), "ota/update");
+    route.filter.len = (uint16_t)strlen(route.filter.str);
+
+    return route;
+}
+
+static pres_mqtt_reassembly_chunk_t make_chunk(int msg_id, size_t offset, size_t data_len, size_t total_len, int64_t received_ms) {
+    pres_mqtt_reassembly_chunk_t chunk = {
+        .msg_id      = msg_id,
+        .data        = payload + offset,
+        .data_len    = data_len,
+        .offset      = offset,
+        .total_len   = total_len,
+        .received_ms = received_ms,
+    };
+
+    return chunk;
+}
+
+static dom_models_error_t begin(pres_mqtt_reassembly_t* reassembly, const pres_mqtt_router_route_t* route, int msg_id, size_t total_len, int64_t received_ms, bool* evicted) {
+    pres_mqtt_reassembly_chunk_t chunk = make_chunk(msg_id, 0, CLIENT_BUFFER_LEN, total_len, received_ms);
+
+    return pres_mqtt_reassembly_begin(reassembly, &chunk, route, "ota/update", strlen("ota/update"), evicted);
+}
+
+/* Feeds every fragment after the first, returns the slot once complete */
+static pres_mqtt_reassembly_slot_t* append_rest(pres_mqtt_reassembly_t* reassembly, int msg_id, size_t total_len) {
+    pres_mqtt_reassembly_slot_t* complete = NULL;
+
+    for (size_t offset = CLIENT_BUFFER_LEN; offset < total_len; offset += CLIENT_BUFFER_LEN) {
+        size_t                       data_len = total_len - offset < CLIENT_BUFFER_LEN ? total_len - offset : CLIENT_BUFFER_LEN;
+        pres_mqtt_reassembly_chunk_t chunk    = make_chunk(msg_id, offset, data_len, total_len, 0);
+        HOST_TEST_CHECK(complete == NULL);
+        HOST_TEST_CHECK_EQ_INT(pres_mqtt_reassembly_append(reassembly, &chunk, &complete), DOMAIN_MODELS_ERROR_OK);
+    }
+
+    return complete;
+}
+
+/* Tests */
+
+static void test_fragments_reassemble_in_place(void) {
+    static pres_mqtt_reassembly_t reassembly;
+    pres_mqtt_router_route_t      route   = make_route(PRES_MQTT_REASSEMBLY_SLOT_LEN);
+    bool                          evicted = true;
+
+    pres_mqtt_reassembly_reset(&reassembly);
+    HOST_TEST_CHECK_EQ_INT(begin(&reassembly, &route, 7, PAYLOAD_LEN, 100, &evicted), DOMAIN_MODELS_ERROR_OK);
+    HOST_TEST_CHECK(!evicted);
+
+    pres_mqtt_reassembly_slot_t* slot = append_rest(&reassembly, 7, PAYLOAD_LEN);
+    HOST_TEST_CHECK(slot != NULL);
+    if (!slot) {
+        return;
+    }
+
+    /* Handlers get the slot buffer itself, no copy out of the pool */
+    HOST_TEST_CHECK(slot >= &reassembly.slots[0] && slot < &reassembly.slots[PRES_MQTT_REASSEMBLY_SLOT_CNT]);
+    HOST_TEST_CHECK(slot->route == &route);
+    HOST_TEST_CHECK_EQ_STR(slot->suffix.str, "ota/update");
+    HOST_TEST_CHECK_EQ_INT(slot->total_len, PAYLOAD_LEN);
+    HOST_TEST_CHECK(memcmp(slot->buf, payload, PAYLOAD_LEN) == 0);
+
+    pres_mqtt_reassembly_release(slot);
+    HOST_TEST_CHECK(!slot->used);
+}
+
+static void test_interleaved_msg_ids_stay_apart(void) {
+    static pres_mqtt_reassembly_t reassembly;
+    pres_mqtt_router_route_t      route   = make_route(PRES_MQTT_REASSEMBLY_SLOT_LEN);
+    bool                          evicted = false;
+
+    pres_mqtt_reassembly_reset(&reassembly);
+    HOST_TEST_CHECK_EQ_INT(begin(&reassembly, &route, 1, PAYLOAD_LEN, 100, &evicted), DOMAIN_MODELS_ERROR_OK);
+    HOST_TEST_CHECK_EQ_INT(begin(&reassembly, &route, 2, PRES_MQTT_REASSEMBLY_SLOT_LEN, 101, &evicted), DOMAIN_MODELS_ERROR_OK);
+    HOST_TEST_CHECK(!evicted);
+
+    pres_mqtt_reassembly_slot_t* second = append_rest(&reassembly, 2, PRES_MQTT_REASSEMBLY_SLOT_LEN);
+    pres_mqtt_reassembly_slot_t* first  = append_rest(&reassembly, 1, PAYLOAD_LEN);
+    HOST_TEST_CHECK(first != NULL && second != NULL && first != second);
+    if (!first || !second) {
+        return;
+    }
+
+    HOST_TEST_CHECK_EQ_INT(first->msg_id, 1);
+    HOST_TEST_CHECK_EQ_INT(second->msg_id, 2);
+    HOST_TEST_CHECK(memcmp(first->buf, payload, PAYLOAD_LEN) == 0);
+    HOST_TEST_CHECK(memcmp(second->buf, payload, PRES_MQTT_REASSEMBLY_SLOT_LEN) == 0);
+
+    pres_mqtt_reassembly_release(first);
+    pres_mqtt_reassembly_release(second);
+}
+
+static void test_oversized_payload_is_not_admitted(void) {
+    static pres_mqtt_reassembly_t reassembly;
+    pres_mqtt_router_route_t      route    = make_route(PAYLOAD_LEN - 1);
+    pres_mqtt_router_route_t      big      = make_route(PRES_MQTT_REASSEMBLY_SLOT_LEN * 2);
+    pres_mqtt_reassembly_slot_t*  complete = NULL;
+    bool                          evicted  = false;
+
+    pres_mqtt_reassembly_reset(&reassembly);
+
+    /* Over the route limit, then over the slot size of an unbounded route */
+    HOST_TEST_CHECK_EQ_INT(begin(&reassembly, &route, 3, PAYLOAD_LEN, 100, &evicted), DOMAIN_MODELS_ERROR_BAD_ARGUMENT);
+    HOST_TEST_CHECK_EQ_INT(begin(&reassembly, &big, 4, PRES_MQTT_REASSEMBLY_SLOT_LEN + 1, 100, &evicted), DOMAIN_MODELS_ERROR_BAD_ARGUMENT);
+
+    /* Their tails have no slot to land in */
+    pres_mqtt_reassembly_chunk_t chunk = make_chunk(3, CLIENT_BUFFER_LEN, PAYLOAD_LEN - CLIENT_BUFFER_LEN, PAYLOAD_LEN, 0);
+    HOST_TEST_CHECK_EQ_INT(pres_mqtt_reassembly_append(&reassembly, &chunk, &complete), DOMAIN_MODELS_ERROR_NOT_FOUND);
+    HOST_TEST_CHECK(complete == NULL);
+    for (size_t i = 0; i < PRES_MQTT_REASSEMBLY_SLOT_CNT; i++) {
+        HOST_TEST_CHECK(!reassembly.slots[i].used);
+    }
+}
+
+static void test_out_of_order_fragment_drops_payload(void) {
+    static pres_mqtt_reassembly_t reassembly;
+    pres_mqtt_router_route_t      route    = make_route(PRES_MQTT_REASSEMBLY_SLOT_LEN);
+    pres_mqtt_reassembly_slot_t*  complete = NULL;
+    bool                          evicted  = false;
+
+    pres_mqtt_reassembly_reset(&reassembly);
+    HOST_TEST_CHECK_EQ_INT(begin(&reassembly, &route, 5, PRES_MQTT_REASSEMBLY_SLOT_LEN, 100, &evicted), DOMAIN_MODELS_ERROR_OK);
+
+    /* The middle fragment was lost, the tail must not be glued on */
+    pres_mqtt_reassembly_chunk_t tail = make_chunk(5, PRES_MQTT_REASSEMBLY_SLOT_LEN - 1, 1, PRES_MQTT_REASSEMBLY_SLOT_LEN, 0);
+    HOST_TEST_CHECK_EQ_INT(pres_mqtt_reassembly_append(&reassembly, &tail, &complete), DOMAIN_MODELS_ERROR_BAD_STATE);
+    HOST_TEST_CHECK(complete == NULL);
+
+    pres_mqtt_reassembly_chunk_t middle = make_chunk(5, CLIENT_BUFFER_LEN, CLIENT_BUFFER_LEN, PRES_MQTT_REASSEMBLY_SLOT_LEN, 0);
+    HOST_TEST_CHECK_EQ_INT(pres_mqtt_reassembly_append(&reassembly, &middle, &complete), DOMAIN_MODELS_ERROR_NOT_FOUND);
+}
+
+static void test_busy_pool_evicts_oldest(void) {
+    static pres_mqtt_reassembly_t reassembly;
+    pres_mqtt_router_route_t      route    = make_route(PRES_MQTT_REASSEMBLY_SLOT_LEN);
+    pres_mqtt_reassembly_slot_t*  complete = NULL;
+    bool                          evicted  = false;
+
+    pres_mqtt_reassembly_reset(&reassembly);
+    for (int i = 0; i < PRES_MQTT_REASSEMBLY_SLOT_CNT; i++) {
+        HOST_TEST_CHECK_EQ_INT(begin(&reassembly, &route, 10 + i, PAYLOAD_LEN, 200 - i, &evicted), DOMAIN_MODELS_ERROR_OK);
+        HOST_TEST_CHECK(!evicted);
+    }
+
+    /* A restarted msg_id reuses its own slot instead of evicting */
+    HOST_TEST_CHECK_EQ_INT(begin(&reassembly, &route, 10, PAYLOAD_LEN, 300, &evicted), DOMAIN_MODELS_ERROR_OK);
+    HOST_TEST_CHECK(!evicted);
+
+    /* The pool is full, the publish started longest ago gives way */
+    int oldest_msg_id = 10 + PRES_MQTT_REASSEMBLY_SLOT_CNT - 1;
+    HOST_TEST_CHECK_EQ_INT(begin(&reassembly, &route, 99, PAYLOAD_LEN, 400, &evicted), DOMAIN_MODELS_ERROR_OK);
+    HOST_TEST_CHECK(evicted);
+
+    pres_mqtt_reassembly_chunk_t chunk = make_chunk(oldest_msg_id, CLIENT_BUFFER_LEN, PAYLOAD_LEN - CLIENT_BUFFER_LEN, PAYLOAD_LEN, 0);
+    HOST_TEST_CHECK_EQ_INT(pres_mqtt_reassembly_append(&reassembly, &chunk, &complete), DOMAIN_MODELS_ERROR_NOT_FOUND);
+
+    complete = append_rest(&reassembly, 99, PAYLOAD_LEN);
+    HOST_TEST_CHECK(complete != NULL && complete->msg_id == 99);
+    pres_mqtt_reassembly_release(complete);
+
+    complete = append_rest(&reassembly, 10, PAYLOAD_LEN);
+    HOST_TEST_CHECK(complete != NULL && complete->msg_id == 10);
+    pres_mqtt_reassembly_release(complete);
+}
+
+static void test_reset_drops_partial_payloads(void) {
+    static pres_mqtt_reassembly_t reassembly;
+    pres_mqtt_router_route_t      route    = make_route(PRES_MQTT_REASSEMBLY_SLOT_LEN);
+    pres_mqtt_reassembly_slot_t*  complete = NULL;
+    bool                          evicted  = false;
+
+    pres_mqtt_reassembly_reset(&reassembly);
+    HOST_TEST_CHECK_EQ_INT(begin(&reassembly, &route, 20, PAYLOAD_LEN, 100, &evicted), DOMAIN_MODELS_ERROR_OK);
+    pres_mqtt_reassembly_reset(&reassembly);
+
+    pres_mqtt_reassembly_chunk_t chunk = make_chunk(20, CLIENT_BUFFER_LEN, PAYLOAD_LEN - CLIENT_BUFFER_LEN, PAYLOAD_LEN, 0);
+    HOST_TEST_CHECK_EQ_INT(pres_mqtt_reassembly_append(&reassembly, &chunk, &complete), DOMAIN_MODELS_ERROR_NOT_FOUND);
+    HOST_TEST_CHECK(complete == NULL);
+}
+
+int main(void) {
+    fill_payload();
+
+    HOST_TEST_RUN(test_fragments_reassemble_in_place);
+    HOST_TEST_RUN(test_interleaved_msg_ids_stay_apart);
+    HOST_TEST_RUN(test_oversized_payload_is_not_admitted);
+    HOST_TEST_RUN(test_out_of_order_fragment_drops_payload);
+    HOST_TEST_RUN(test_busy_pool_evicts_oldest);
+    HOST_TEST_RUN(test_reset_drops_partial_payloads);
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,397 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "domain/contracts/device/wifi.h"
+#include "domain/contracts/system/clock.h"
+#include "domain/models/wifi.h"
+#include "domain/usecases/wifiman.h"
+#include "host_test.h"
+#include "infrastructure/device/wifi/stub_impl.h"
+#include "presentation/task/wifiman_sta_reconnect/backoff.h"
+#include "presentation/task/wifiman_sta_reconnect/task.h"
+#include "presentation/task/wifiman_sta_reconnect/types.h"
+
+#define BASE_MS 1000
+#define MAX_MS  60000
+
+/*
+ * Stands in for the wifiman use case on top of the wifi stub. An attempt
+ * only connects once the AP is back, as the driver would.
+ */
+typedef struct {
+    dom_contracts_device_wifi_t* wifi;
+    volatile bool                ap_up;
+    volatile bool                connected;
+    volatile bool                disabled;
+    volatile bool                attempting;
+    volatile uint32_t            call_cnt;
+    volatile uint32_t            attempt_cnt;
+    long                         attempt_us;
+} fake_wifiman_t;
+
+static fake_wifiman_t               fake;
+static dom_usecases_wifiman_t       fake_usecase;
+static dom_contracts_system_clock_t fake_clock;
+
+/* The clock the task reads, moved only by the test */
+static volatile int64_t fake_now_ms;
+
+/* Helpers */
+
+static pres_task_wifiman_sta_reconnect_backoff_cfg_t backoff_cfg(uint8_t jitter_pct) {
+    pres_task_wifiman_sta_reconnect_backoff_cfg_t cfg = {
+        .base_ms    = BASE_MS,
+        .max_ms     = MAX_MS,
+        .jitter_pct = jitter_pct,
+    };
+
+    return cfg;
+}
+
+static dom_models_error_t fake_get_uptime_ms(dom_contracts_system_clock_t* self, int64_t* out) {
+    (void)self;
+    *out = fake_now_ms;
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+static dom_models_error_t fake_need_reconnect(dom_usecases_wifiman_t* self, bool* out) {
+    fake_wifiman_t* ctx = (fake_wifiman_t*)self->ctx;
+    *out                = !ctx->connected && !ctx->disabled;
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+static dom_models_error_t fake_try_reconnect(dom_usecases_wifiman_t* self, bool* attempted) {
+    fake_wifiman_t* ctx = (fake_wifiman_t*)self->ctx;
+    ctx->call_cnt++;
+    *attempted = !ctx->connected && !ctx->disabled;
+    if (!*attempted) {
+        return DOMAIN_MODELS_ERROR_OK;
+    }
+
+    ctx->attempting = true;
+    host_test_sleep_us(ctx->attempt_us);
+    ctx->attempt_cnt++;
+
+    dom_models_error_t err = DOMAIN_MODELS_ERROR_OK;
+    if (ctx->ap_up) {
+        dom_models_wifi_sta_connect_config_t config = {.ssid = "haya-office"};
+        err                                         = ctx->wifi->connect_sta(ctx->wifi, &config);
+    }
+    ctx->attempting = false;
+
+    return err;
+}
+
+/* Mirrors the wifiman bookkeeping, then hands the event to the task */
+static void on_wifi_event(void* cb_ctx, const dom_models_wifi_event_t* event) {
+    pres_task_wifiman_sta_reconnect_t* task = (pres_task_wifiman_sta_reconnect_t*)cb_ctx;
+    fake_wifiman_t*                    ctx  = (fake_wifiman_t*)task->cfg.wifiman->ctx;
+
+    if (event->type == DOM_MODELS_WIFI_EVENT_STA_CONNECTED) {
+        ctx->connected = true;
+    } else if (event->type == DOM_MODELS_WIFI_EVENT_STA_DISCONNECTED) {
+        ctx->connected = false;
+    }
+    pres_task_wifiman_sta_reconnect_on_wifi_event(cb_ctx, event);
+}
+
+/* Lets the task handle what it was woken for and settle back into its wait */
+static void settle(void) {
+    host_test_sleep_us(20000);
+}
+
+static void wait_for_attempts(const fake_wifiman_t* ctx, uint32_t attempt_cnt) {
+    for (int waited_ms = 0; waited_ms < 1000 && ctx->attempt_cnt < attempt_cnt; waited_ms++) {
+        host_test_sleep_us(1000);
+    }
+    settle();
+}
+
+/* Moves the clock, then wakes the task the way a repeated driver event does */
+static void advance_and_kick(fake_wifiman_t* ctx, int64_t now_ms) {
+    fake_now_ms = now_ms;
+    (void)ctx->wifi->disconnect_sta(ctx->wifi);
+}
+
+/* A task on the wifi stub with the link down at uptime 0 */
+static pres_task_wifiman_sta_reconnect_t* start_task(long attempt_us) {
+    inf_device_wifi_stub_impl_cfg_t       wifi_cfg = INF_DEVICE_WIFI_STUB_IMPL_CFG_DEFAULT();
+    pres_task_wifiman_sta_reconnect_cfg_t cfg      = {
+        .wifiman         = &fake_usecase,
+        .clock           = &fake_clock,
+        .backoff_base_ms = BASE_MS,
+        .backoff_max_ms  = MAX_MS,
+        .jitter_pct      = 50,
+    };
+
+    memset(&fake, 0, sizeof(fake));
+    fake.attempt_us             = attempt_us;
+    fake_usecase.ctx            = &fake;
+    fake_usecase.need_reconnect = fake_need_reconnect;
+    fake_usecase.try_reconnect  = fake_try_reconnect;
+    fake_clock.get_uptime_ms    = fake_get_uptime_ms;
+    fake_now_ms                 = 0;
+
+    fake.wifi = inf_device_wifi_stub_impl_new(&wifi_cfg);
+    if (!fake.wifi || inf_device_wifi_stub_impl_init(fake.wifi) != DOMAIN_MODELS_ERROR_OK) {
+        inf_device_wifi_stub_impl_delete(fake.wifi);
+        return NULL;
+    }
+
+    pres_task_wifiman_sta_reconnect_t* task  = pres_task_wifiman_sta_reconnect_new(&cfg);
+    bool                               ready = task != NULL;
+    ready = ready && fake.wifi->add_event_callback(fake.wifi, task, on_wifi_event) == DOMAIN_MODELS_ERROR_OK;
+    ready = ready && pres_task_wifiman_sta_reconnect_start(task) == DOMAIN_MODELS_ERROR_OK;
+    if (!ready) {
+        pres_task_wifiman_sta_reconnect_delete(task);
+        inf_device_wifi_stub_impl_delete(fake.wifi);
+        return NULL;
+    }
+
+    return task;
+}
+
+static void delete_task(pres_task_wifiman_sta_reconnect_t* task) {
+    (void)fake.wifi->remove_event_callback(fake.wifi, on_wifi_event);
+    pres_task_wifiman_sta_reconnect_delete(task);
+    inf_device_wifi_stub_impl_delete(fake.wifi);
+}
+
+/* Tests */
+
+static void test_idle_until_disconnected(void) {
+    pres_task_wifiman_sta_reconnect_backoff_t     backoff;
+    pres_task_wifiman_sta_reconnect_backoff_cfg_t cfg = backoff_cfg(50);
+
+    pres_task_wifiman_sta_reconnect_backoff_init(&backoff, 1);
+    HOST_TEST_CHECK_EQ_INT(pres_task_wifiman_sta_reconnect_backoff_wait_ms(&backoff, 0), -1);
+
+    pres_task_wifiman_sta_reconnect_backoff_on_disconnected(&backoff, &cfg, 5000);
+    int64_t wait_ms = pres_task_wifiman_sta_reconnect_backoff_wait_ms(&backoff, 5000);
+    HOST_TEST_CHECK(wait_ms >= BASE_MS / 2 && wait_ms <= BASE_MS);
+    HOST_TEST_CHECK_EQ_INT(pres_task_wifiman_sta_reconnect_backoff_wait_ms(&backoff, 5000 + wait_ms), 0);
+    HOST_TEST_CHECK_EQ_INT(pres_task_wifiman_sta_reconnect_backoff_wait_ms(&backoff, 5000 + wait_ms + 1), 0);
+}
+
+static void test_delay_doubles_up_to_cap(void) {
+    pres_task_wifiman_sta_reconnect_backoff_t     backoff;
+    pres_task_wifiman_sta_reconnect_backoff_cfg_t cfg    = backoff_cfg(0);
+    int64_t                                       now_ms = 0;
+
+    pres_task_wifiman_sta_reconnect_backoff_init(&backoff, 1);
+    pres_task_wifiman_sta_reconnect_backoff_on_disconnected(&backoff, &cfg, now_ms);
+    HOST_TEST_CHECK_EQ_INT(pres_task_wifiman_sta_reconnect_backoff_wait_ms(&backoff, now_ms), BASE_MS);
+
+    int64_t expected_ms = BASE_MS;
+    for (int i = 0; i < 10; i++) {
+        now_ms += pres_task_wifiman_sta_reconnect_backoff_wait_ms(&backoff, now_ms);
+        pres_task_wifiman_sta_reconnect_backoff_on_attempt(&backoff, &cfg, now_ms);
+
+        expected_ms = expected_ms * 2 > MAX_MS ? MAX_MS : expected_ms * 2;
+        HOST_TEST_CHECK_EQ_INT(pres_task_wifiman_sta_reconnect_backoff_wait_ms(&backoff, now_ms), expected_ms);
+    }
+    HOST_TEST_CHECK_EQ_INT(backoff.attempt_cnt, 10);
+}
+
+static void test_jitter_stays_under_delay(void) {
+    pres_task_wifiman_sta_reconnect_backoff_t     backoff;
+    pres_task_wifiman_sta_reconnect_backoff_cfg_t cfg    = backoff_cfg(50);
+    int64_t                                       min_ms = INT64_MAX;
+    int64_t                                       max_ms = 0;
+
+    pres_task_wifiman_sta_reconnect_backoff_init(&backoff, 0x2545f491u);
+    for (int i = 0; i < 1000; i++) {
+        /* Attempt 3 is due after 8000 ms, shortened by up to half */
+        backoff.attempt_cnt = 2;
+        pres_task_wifiman_sta_reconnect_backoff_on_attempt(&backoff, &cfg, 0);
+
+        int64_t wait_ms = pres_task_wifiman_sta_reconnect_backoff_wait_ms(&backoff, 0);
+        min_ms          = wait_ms < min_ms ? wait_ms : min_ms;
+        max_ms          = wait_ms > max_ms ? wait_ms : max_ms;
+    }
+
+    HOST_TEST_CHECK(min_ms >= 4000 && min_ms < 4400);
+    HOST_TEST_CHECK(max_ms <= 8000 && max_ms > 7600);
+}
+
+static void test_seeds_spread_fleet(void) {
+    pres_task_wifiman_sta_reconnect_backoff_cfg_t cfg      = backoff_cfg(50);
+    int64_t                                       first_ms = -1;
+    bool                                          spread   = false;
+
+    /* One AP reboot drops every device at the same uptime */
+    for (uint32_t seed = 1; seed <= 100; seed++) {
+        pres_task_wifiman_sta_reconnect_backoff_t backoff;
+        pres_task_wifiman_sta_reconnect_backoff_init(&backoff, seed * 0x9e3779b9u);
+        pres_task_wifiman_sta_reconnect_backoff_on_disconnected(&backoff, &cfg, 0);
+
+        int64_t wait_ms = pres_task_wifiman_sta_reconnect_backoff_wait_ms(&backoff, 0);
+        if (first_ms < 0) {
+            first_ms = wait_ms;
+        }
+        spread = spread || wait_ms != first_ms;
+    }
+
+    HOST_TEST_CHECK(spread);
+}
+
+static void test_repeated_disconnect_keeps_schedule(void) {
+    pres_task_wifiman_sta_reconnect_backoff_t     backoff;
+    pres_task_wifiman_sta_reconnect_backoff_cfg_t cfg = backoff_cfg(0);
+
+    pres_task_wifiman_sta_reconnect_backoff_init(&backoff, 1);
+    pres_task_wifiman_sta_reconnect_backoff_on_disconnected(&backoff, &cfg, 0);
+    pres_task_wifiman_sta_reconnect_backoff_on_attempt(&backoff, &cfg, BASE_MS);
+    pres_task_wifiman_sta_reconnect_backoff_on_attempt(&backoff, &cfg, 3 * BASE_MS);
+
+    pres_task_wifiman_sta_reconnect_backoff_on_disconnected(&backoff, &cfg, 4 * BASE_MS);
+    HOST_TEST_CHECK_EQ_INT(backoff.attempt_cnt, 2);
+    HOST_TEST_CHECK_EQ_INT(pres_task_wifiman_sta_reconnect_backoff_wait_ms(&backoff, 4 * BASE_MS), 3 * BASE_MS);
+}
+
+static void test_connected_resets_schedule(void) {
+    pres_task_wifiman_sta_reconnect_backoff_t     backoff;
+    pres_task_wifiman_sta_reconnect_backoff_cfg_t cfg = backoff_cfg(0);
+
+    pres_task_wifiman_sta_reconnect_backoff_init(&backoff, 1);
+    pres_task_wifiman_sta_reconnect_backoff_on_disconnected(&backoff, &cfg, 0);
+    for (int i = 0; i < 5; i++) {
+        pres_task_wifiman_sta_reconnect_backoff_on_attempt(&backoff, &cfg, 0);
+    }
+
+    pres_task_wifiman_sta_reconnect_backoff_on_connected(&backoff);
+    HOST_TEST_CHECK_EQ_INT(pres_task_wifiman_sta_reconnect_backoff_wait_ms(&backoff, 0), -1);
+
+    /* The next drop starts over from base_ms */
+    pres_task_wifiman_sta_reconnect_backoff_on_disconnected(&backoff, &cfg, 100000);
+    HOST_TEST_CHECK_EQ_INT(pres_task_wifiman_sta_reconnect_backoff_wait_ms(&backoff, 100000), BASE_MS);
+}
+
+static void test_task_reconnects_on_wifi_events(void) {
+    pres_task_wifiman_sta_reconnect_t* task = start_task(0);
+    HOST_TEST_CHECK(task != NULL);
+    if (!task) {
+        return;
+    }
+    /* Connected, the task sleeps without polling */
+    dom_models_wifi_sta_connect_config_t config = {.ssid = "haya-office"};
+    (void)fake.wifi->connect_sta(fake.wifi, &config);
+    settle();
+    HOST_TEST_CHECK_EQ_INT(fake.attempt_cnt, 0);
+    HOST_TEST_CHECK(!task->backoff.pending);
+
+    /* The AP reboots, the first attempt is due within base_ms */
+    advance_and_kick(&fake, 10000);
+    settle();
+    HOST_TEST_CHECK_EQ_INT(fake.attempt_cnt, 0);
+
+    advance_and_kick(&fake, 10000 + BASE_MS);
+    wait_for_attempts(&fake, 1);
+    HOST_TEST_CHECK_EQ_INT(fake.attempt_cnt, 1);
+
+    /* The second attempt is due 1000 to 2000 ms after the first */
+    advance_and_kick(&fake, 10000 + 2 * BASE_MS - 1);
+    settle();
+    HOST_TEST_CHECK_EQ_INT(fake.attempt_cnt, 1);
+
+    advance_and_kick(&fake, 10000 + 3 * BASE_MS);
+    wait_for_attempts(&fake, 2);
+    HOST_TEST_CHECK_EQ_INT(fake.attempt_cnt, 2);
+
+    /* The AP is back, the next attempt connects and the task goes idle */
+    fake.ap_up = true;
+    advance_and_kick(&fake, 10000 + 7 * BASE_MS);
+    wait_for_attempts(&fake, 3);
+    HOST_TEST_CHECK_EQ_INT(fake.attempt_cnt, 3);
+    HOST_TEST_CHECK(fake.connected);
+    HOST_TEST_CHECK(!task->backoff.pending);
+
+    fake_now_ms = 10000 + 10 * MAX_MS;
+    settle();
+    HOST_TEST_CHECK_EQ_INT(fake.attempt_cnt, 3);
+
+    HOST_TEST_CHECK_EQ_INT(pres_task_wifiman_sta_reconnect_stop(task), DOMAIN_MODELS_ERROR_OK);
+    delete_task(task);
+}
+
+static void test_task_parks_when_nothing_to_attempt(void) {
+    pres_task_wifiman_sta_reconnect_t* task = start_task(0);
+    HOST_TEST_CHECK(task != NULL);
+    if (!task) {
+        return;
+    }
+
+    /* Provisioning, auto reconnect is off and the link is down */
+    fake.disabled = true;
+    settle();
+    advance_and_kick(&fake, BASE_MS);
+    settle();
+    HOST_TEST_CHECK_EQ_INT(fake.call_cnt, 1);
+    HOST_TEST_CHECK_EQ_INT(fake.attempt_cnt, 0);
+    HOST_TEST_CHECK(!task->backoff.pending);
+
+    /* Parked, time passing alone never calls try_reconnect again */
+    fake_now_ms = BASE_MS + 10 * MAX_MS;
+    settle();
+    HOST_TEST_CHECK_EQ_INT(fake.call_cnt, 1);
+
+    /* The next DISCONNECTED notification restarts the schedule */
+    fake.disabled = false;
+    advance_and_kick(&fake, fake_now_ms);
+    settle();
+    HOST_TEST_CHECK(task->backoff.pending);
+    advance_and_kick(&fake, fake_now_ms + BASE_MS);
+    wait_for_attempts(&fake, 1);
+    HOST_TEST_CHECK_EQ_INT(fake.call_cnt, 2);
+    HOST_TEST_CHECK_EQ_INT(fake.attempt_cnt, 1);
+
+    HOST_TEST_CHECK_EQ_INT(pres_task_wifiman_sta_reconnect_stop(task), DOMAIN_MODELS_ERROR_OK);
+    delete_task(task);
+}
+
+static void test_stop_waits_for_attempt_in_flight(void) {
+    pres_task_wifiman_sta_reconnect_t* task = start_task(100000);
+    HOST_TEST_CHECK(task != NULL);
+    if (!task) {
+        return;
+    }
+
+    /* The task schedules its first look from uptime 0 before the clock moves */
+    settle();
+    advance_and_kick(&fake, BASE_MS);
+    for (int waited_ms = 0; waited_ms < 1000 && !fake.attempting; waited_ms++) {
+        host_test_sleep_us(1000);
+    }
+    HOST_TEST_CHECK(fake.attempting);
+
+    /* Stopping mid-attempt lets try_reconnect return before the task exits */
+    int64_t start_ns = host_test_now_ns();
+    HOST_TEST_CHECK_EQ_INT(pres_task_wifiman_sta_reconnect_stop(task), DOMAIN_MODELS_ERROR_OK);
+    int64_t elapsed_ms = (host_test_now_ns() - start_ns) / 1000000;
+
+    HOST_TEST_CHECK(!fake.attempting);
+    HOST_TEST_CHECK_EQ_INT(fake.attempt_cnt, 1);
+    HOST_TEST_CHECK(task->task_handle == NULL);
+    HOST_TEST_CHECK(elapsed_ms < PRES_TASK_WIFIMAN_STA_RECONNECT_DEFAULT_STOP_TIMEOUT_MS);
+
+    delete_task(task);
+}
+
+
+int main(void) {
+    HOST_TEST_RUN(test_idle_until_disconnected);
+    HOST_TEST_RUN(test_delay_doubles_up_to_cap);
+    HOST_TEST_RUN(test_jitter_stays_under_delay);
+    HOST_TEST_RUN(test_seeds_spread_fleet);
+    HOST_TEST_RUN(test_repeated_disconnect_keeps_schedule);
+    HOST_TEST_RUN(test_connected_resets_schedule);
+    HOST_TEST_RUN(test_task_reconnects_on_wifi_events);
+    HOST_TEST_RUN(test_task_parks_when_nothing_to_attempt);
+    HOST_TEST_RUN(test_stop_waits_for_attempt_in_flight);
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,180 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "domain/contracts/messaging/publish.h"
+#include "domain/models/messaging.h"
+#include "host_test.h"
+#include "presentation/task/status_publish/task.h"
+#include "presentation/task/status_publish/types.h"
+#include "presentation/task/status_publish/utils.h"
+
+#define DEBOUNCE_MS  2000
+#define HEARTBEAT_MS 300000
+#define SEND_MS      100
+
+/* A backend whose send_status takes SEND_MS, as a slow broker would */
+typedef struct {
+    volatile bool     sending;
+    volatile uint32_t sent_cnt;
+} slow_publish_t;
+
+/* Helpers */
+
+static dom_models_messaging_status_t make_status(bool wifi_connected, uint8_t rssi_bucket, const char* ip) {
+    dom_models_messaging_status_t status = {
+        .wifi_connected = wifi_connected,
+        .rssi_bucket    = rssi_bucket,
+    };
+    snprintf(status.status, sizeof(status.status), "%s", PRES_TASK_STATUS_PUBLISH_DEFAULT_STATUS);
+    snprintf(status.ip, sizeof(status.ip), "%s", ip);
+
+    return status;
+}
+
+static pres_task_status_publish_decision_t evaluate(pres_task_status_publish_delta_t* delta, const dom_models_messaging_status_t* sample, int64_t now_ms) {
+    return pres_task_status_publish_delta_evaluate(delta, sample, now_ms, DEBOUNCE_MS, HEARTBEAT_MS);
+}
+
+static dom_models_error_t slow_send_status(dom_contracts_messaging_publish_t* self, const dom_models_messaging_status_t* status) {
+    slow_publish_t* ctx = (slow_publish_t*)self->ctx;
+    (void)status;
+
+    ctx->sending = true;
+    host_test_sleep_us(SEND_MS * 1000);
+    ctx->sent_cnt++;
+    ctx->sending = false;
+
+    return DOMAIN_MODELS_ERROR_OK;
+}
+
+/* Tests */
+
+static void test_first_sample_publishes(void) {
+    pres_task_status_publish_delta_t delta  = {0};
+    dom_models_messaging_status_t    sample = make_status(true, 3, "10.0.0.2");
+
+    HOST_TEST_CHECK_EQ_INT(evaluate(&delta, &sample, 0), PRES_TASK_STATUS_PUBLISH_DECISION_CHANGE);
+    pres_task_status_publish_delta_commit(&delta, &sample, 0);
+    HOST_TEST_CHECK_EQ_INT(evaluate(&delta, &sample, 1000), PRES_TASK_STATUS_PUBLISH_DECISION_SKIP);
+}
+
+static void test_change_waits_for_debounce(void) {
+    pres_task_status_publish_delta_t delta     = {0};
+    dom_models_messaging_status_t    published = make_status(true, 3, "10.0.0.2");
+    dom_models_messaging_status_t    weaker    = make_status(true, 2, "10.0.0.2");
+    dom_models_messaging_status_t    weakest   = make_status(true, 1, "10.0.0.2");
+
+    pres_task_status_publish_delta_commit(&delta, &published, 0);
+
+    HOST_TEST_CHECK_EQ_INT(evaluate(&delta, &weaker, 1000), PRES_TASK_STATUS_PUBLISH_DECISION_SKIP);
+    HOST_TEST_CHECK_EQ_INT(evaluate(&delta, &weakest, 2000), PRES_TASK_STATUS_PUBLISH_DECISION_SKIP);
+
+    /* The window opened at the first change, later changes do not extend it */
+    HOST_TEST_CHECK_EQ_INT(evaluate(&delta, &weakest, 1000 + DEBOUNCE_MS), PRES_TASK_STATUS_PUBLISH_DECISION_CHANGE);
+    pres_task_status_publish_delta_commit(&delta, &weakest, 1000 + DEBOUNCE_MS);
+    HOST_TEST_CHECK(!delta.pending);
+    HOST_TEST_CHECK_EQ_INT(delta.last.rssi_bucket, 1);
+}
+
+static void test_flap_back_closes_window(void) {
+    pres_task_status_publish_delta_t delta        = {0};
+    dom_models_messaging_status_t    published    = make_status(true, 3, "10.0.0.2");
+    dom_models_messaging_status_t    disconnected = make_status(false, 0, "");
+
+    pres_task_status_publish_delta_commit(&delta, &published, 0);
+
+    HOST_TEST_CHECK_EQ_INT(evaluate(&delta, &disconnected, 1000), PRES_TASK_STATUS_PUBLISH_DECISION_SKIP);
+    HOST_TEST_CHECK_EQ_INT(evaluate(&delta, &published, 1500), PRES_TASK_STATUS_PUBLISH_DECISION_SKIP);
+    HOST_TEST_CHECK(!delta.pending);
+
+    /* A new drop opens a fresh window instead of reusing the old start */
+    HOST_TEST_CHECK_EQ_INT(evaluate(&delta, &disconnected, 3500), PRES_TASK_STATUS_PUBLISH_DECISION_SKIP);
+    HOST_TEST_CHECK_EQ_INT(evaluate(&delta, &disconnected, 3500 + DEBOUNCE_MS), PRES_TASK_STATUS_PUBLISH_DECISION_CHANGE);
+}
+
+static void test_unchanged_status_sends_heartbeat(void) {
+    pres_task_status_publish_delta_t delta     = {0};
+    dom_models_messaging_status_t    published = make_status(true, 3, "10.0.0.2");
+
+    pres_task_status_publish_delta_commit(&delta, &published, 0);
+
+    HOST_TEST_CHECK_EQ_INT(evaluate(&delta, &published, HEARTBEAT_MS - 1), PRES_TASK_STATUS_PUBLISH_DECISION_SKIP);
+    HOST_TEST_CHECK_EQ_INT(evaluate(&delta, &published, HEARTBEAT_MS), PRES_TASK_STATUS_PUBLISH_DECISION_HEARTBEAT);
+}
+
+static void test_failed_publish_is_retried(void) {
+    pres_task_status_publish_delta_t delta     = {0};
+    dom_models_messaging_status_t    published = make_status(true, 3, "10.0.0.2");
+    dom_models_messaging_status_t    changed   = make_status(true, 3, "10.0.0.9");
+
+    pres_task_status_publish_delta_commit(&delta, &published, 0);
+    HOST_TEST_CHECK_EQ_INT(evaluate(&delta, &changed, 1000), PRES_TASK_STATUS_PUBLISH_DECISION_SKIP);
+    HOST_TEST_CHECK_EQ_INT(evaluate(&delta, &changed, 1000 + DEBOUNCE_MS), PRES_TASK_STATUS_PUBLISH_DECISION_CHANGE);
+
+    /* Nothing committed, so the next sample still owes the broker a change */
+    HOST_TEST_CHECK_EQ_INT(evaluate(&delta, &changed, 2000 + DEBOUNCE_MS), PRES_TASK_STATUS_PUBLISH_DECISION_CHANGE);
+}
+
+static void test_rssi_buckets(void) {
+    HOST_TEST_CHECK_EQ_INT(pres_task_status_publish_rssi_bucket(false, -40), 0);
+    HOST_TEST_CHECK_EQ_INT(pres_task_status_publish_rssi_bucket(true, -55), 4);
+    HOST_TEST_CHECK_EQ_INT(pres_task_status_publish_rssi_bucket(true, -56), 3);
+    HOST_TEST_CHECK_EQ_INT(pres_task_status_publish_rssi_bucket(true, -67), 3);
+    HOST_TEST_CHECK_EQ_INT(pres_task_status_publish_rssi_bucket(true, -75), 2);
+    HOST_TEST_CHECK_EQ_INT(pres_task_status_publish_rssi_bucket(true, -90), 1);
+}
+
+static void test_stop_waits_for_send_in_flight(void) {
+    slow_publish_t                    publish_ctx = {0};
+    dom_contracts_messaging_publish_t publish     = {
+        .ctx         = &publish_ctx,
+        .send_status = slow_send_status,
+    };
+    pres_task_status_publish_cfg_t cfg = {
+        .publish            = &publish,
+        .sample_interval_ms = 60000,
+    };
+
+    pres_task_status_publish_t* task  = pres_task_status_publish_new(&cfg);
+    bool                        ready = task && pres_task_status_publish_start(task) == DOMAIN_MODELS_ERROR_OK;
+    HOST_TEST_CHECK(ready);
+    if (!ready) {
+        pres_task_status_publish_delete(task);
+        return;
+    }
+
+    for (int waited_ms = 0; waited_ms < 1000 && !publish_ctx.sending; waited_ms++) {
+        host_test_sleep_us(1000);
+    }
+    HOST_TEST_CHECK(publish_ctx.sending);
+
+    /* Stopping mid-send lets the task finish and record the publish */
+    int64_t start_ns = host_test_now_ns();
+    HOST_TEST_CHECK_EQ_INT(pres_task_status_publish_stop(task), DOMAIN_MODELS_ERROR_OK);
+    int64_t elapsed_ms = (host_test_now_ns() - start_ns) / 1000000;
+
+    HOST_TEST_CHECK(!publish_ctx.sending);
+    HOST_TEST_CHECK_EQ_INT(publish_ctx.sent_cnt, 1);
+    HOST_TEST_CHECK(elapsed_ms < PRES_TASK_STATUS_PUBLISH_DEFAULT_STOP_TIMEOUT_MS);
+
+    pres_task_status_publish_stats_t stats = {0};
+    HOST_TEST_CHECK_EQ_INT(pres_task_status_publish_get_stats(task, &stats), DOMAIN_MODELS_ERROR_OK);
+    HOST_TEST_CHECK_EQ_INT(stats.sample_cnt, 1);
+    HOST_TEST_CHECK_EQ_INT(stats.change_publish_cnt, 1);
+
+    pres_task_status_publish_delete(task);
+}
+
+int main(void) {
+    HOST_TEST_RUN(test_first_sample_publishes);
+    HOST_TEST_RUN(test_change_waits_for_debounce);
+    HOST_TEST_RUN(test_flap_back_closes_window);
+    HOST_TEST_RUN(test_unchanged_status_sends_heartbeat);
+    HOST_TEST_RUN(test_failed_publish_is_retried);
+    HOST_TEST_RUN(test_rssi_buckets);
+    HOST_TEST_RUN(test_stop_waits_for_send_in_flight);
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,247 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "application/wifiman/impl.h"
+#include "domain/contracts/device/wifi.h"
+#include "domain/contracts/repository/wifi.h"
+#include "domain/models/wifi.h"
+#include "domain/usecases/wifiman.h"
+#include "host_test.h"
+#include "infrastructure/device/wifi/stub_impl.h"
+#include "infrastructure/logger/leveled/stdio_impl.h"
+#include "infrastructure/network/interface/stub_impl.h"
+#include "infrastructure/repository/preloaded/stub_impl.h"
+#include "infrastructure/repository/wifi/stub_impl.h"
+
+#define SSID     "home"
+#define PASSWORD "password123"
+
+/* Where the stored network was joined before, the stub driver itself answers on channel 1 */
+static const uint8_t last_bssid[DOM_MODELS_WIFI_MAC_LEN] = {0x02, 0x00, 0x00, 0x00, 0x20, 0x0b};
+
+#define LAST_CHANNEL   11
+#define LAST_AUTH_MODE DOM_MODELS_WIFI_AUTH_WPA3_PSK
+
+/*
+ * Sits in front of the stub driver's connect_sta. Each attempt's config is
+ * kept. A failing attempt is accepted without joining so that the test can
+ * deliver the disconnect the driver reports after a timed out probe, a
+ * refused one returns an error the way a rejected config does.
+ */
+typedef struct {
+    dom_models_error_t (*connect_sta)(
+        dom_contracts_device_wifi_t*                self,
+        const dom_models_wifi_sta_connect_config_t* config
+    );
+    dom_models_wifi_sta_connect_config_t last_config;
+    uint32_t                             attempt_cnt;
+    bool                                 fail_next;
+    bool                                 refuse_next;
+} connect_spy_t;
+
+static connect_spy_t spy;
+
+static dom_contracts_logger_leveled_t*       logger;
+static dom_contracts_device_wifi_t*          wifi;
+static dom_contracts_repository_wifi_t*      wifi_repository;
+static dom_contracts_repository_preloaded_t* preloaded_repository;
+static dom_contracts_network_interface_t*    network_interface;
+static dom_usecases_wifiman_t*               wifiman;
+
+/* Helpers */
+
+static dom_models_error_t spy_connect_sta(dom_contracts_device_wifi_t* self, const dom_models_wifi_sta_connect_config_t* config) {
+    memcpy(&spy.last_config, config, sizeof(dom_models_wifi_sta_connect_config_t));
+    spy.attempt_cnt++;
+
+    if (spy.fail_next) {
+        spy.fail_next = false;
+        return DOMAIN_MODELS_ERROR_OK;
+    }
+    if (spy.refuse_next) {
+        spy.refuse_next = false;
+        return DOMAIN_MODELS_ERROR_FAILURE;
+    }
+
+    return spy.connect_sta(self, config);
+}
+
+static bool setup(void) {
+    inf_logger_leveled_stdio_impl_cfg_t logger_cfg = INF_LOGGER_LEVELED_STDIO_IMPL_CFG_DEFAULT();
+    logger_cfg.level                               = DOMAIN_MODELS_LOGGER_LEVEL_NONE;
+    logger                                         = inf_logger_leveled_stdio_impl_new(&logger_cfg);
+
+    inf_device_wifi_stub_impl_cfg_t wifi_cfg = INF_DEVICE_WIFI_STUB_IMPL_CFG_DEFAULT();
+    wifi                                     = inf_device_wifi_stub_impl_new(&wifi_cfg);
+    if (!wifi || inf_device_wifi_stub_impl_init(wifi) != DOMAIN_MODELS_ERROR_OK) {
+        return false;
+    }
+    spy.connect_sta   = wifi->connect_sta;
+    wifi->connect_sta = spy_connect_sta;
+
+    inf_repository_wifi_stub_impl_cfg_t repository_cfg = {.credential_available = true};
+    snprintf(repository_cfg.credential.ssid, sizeof(repository_cfg.credential.ssid), "%s", SSID);
+    snprintf(repository_cfg.credential.password, sizeof(repository_cfg.credential.password), "%s", PASSWORD);
+    wifi_repository = inf_repository_wifi_stub_impl_new(&repository_cfg);
+
+    inf_repository_preloaded_stub_impl_cfg_t preloaded_cfg = INF_REPOSITORY_PRELOADED_STUB_IMPL_CFG_DEFAULT();
+    preloaded_repository                                   = inf_repository_preloaded_stub_impl_new(&preloaded_cfg);
+
+    inf_network_interface_stub_impl_cfg_t network_cfg = INF_NETWORK_INTERFACE_STUB_IMPL_CFG_DEFAULT();
+    network_interface                                 = inf_network_interface_stub_impl_new(&network_cfg);
+    if (!logger || !wifi_repository || !preloaded_repository || !network_interface) {
+        return false;
+    }
+
+    /* Left behind by an earlier boot */
+    dom_models_wifi_sta_last_ap_t last_ap = {
+        .channel   = LAST_CHANNEL,
+        .auth_mode = LAST_AUTH_MODE,
+    };
+    snprintf(last_ap.ssid, sizeof(last_ap.ssid), "%s", SSID);
+    memcpy(last_ap.bssid, last_bssid, DOM_MODELS_WIFI_MAC_LEN);
+    if (wifi_repository->set_sta_last_ap(wifi_repository, &last_ap) != DOMAIN_MODELS_ERROR_OK) {
+        return false;
+    }
+
+    app_wifiman_impl_cfg_t wifiman_cfg = {
+        .logger                 = logger,
+        .wifi                   = wifi,
+        .wifi_repository        = wifi_repository,
+        .preloaded_repository   = preloaded_repository,
+        .network_interface      = network_interface,
+        .ap_auto_manage_enabled = true,
+    };
+    wifiman = app_wifiman_impl_new(&wifiman_cfg);
+
+    return wifiman && wifiman->start(wifiman) == DOMAIN_MODELS_ERROR_OK;
+}
+
+static void teardown(void) {
+    if (wifiman) {
+        wifiman->stop(wifiman);
+    }
+    app_wifiman_impl_delete(wifiman);
+    inf_network_interface_stub_impl_delete(network_interface);
+    inf_repository_preloaded_stub_impl_delete(preloaded_repository);
+    inf_repository_wifi_stub_impl_delete(wifi_repository);
+    if (wifi) {
+        inf_device_wifi_stub_impl_deinit(wifi);
+    }
+    inf_device_wifi_stub_impl_delete(wifi);
+    inf_logger_leveled_stdio_impl_delete(logger);
+}
+
+static bool connected(void) {
+    dom_models_wifi_status_t status;
+
+    return wifi->get_status(wifi, &status) == DOMAIN_MODELS_ERROR_OK && status.connected;
+}
+
+/* Reconnect attempt as the reconnect task makes it, the stub driver reports the connection before the call returns */
+static int64_t reconnect_ns(void) {
+    bool    attempted = false;
+    int64_t start_ns  = host_test_now_ns();
+
+    HOST_TEST_CHECK_EQ_INT(wifiman->try_reconnect(wifiman, &attempted), DOMAIN_MODELS_ERROR_OK);
+    HOST_TEST_CHECK(attempted);
+
+    return host_test_now_ns() - start_ns;
+}
+
+static void check_directed(const dom_models_wifi_sta_connect_config_t* config, const uint8_t* bssid, uint8_t channel, dom_models_wifi_auth_mode_t auth_mode) {
+    HOST_TEST_CHECK_EQ_STR(config->ssid, SSID);
+    HOST_TEST_CHECK(config->bssid_set);
+    HOST_TEST_CHECK(memcmp(config->bssid, bssid, DOM_MODELS_WIFI_MAC_LEN) == 0);
+    HOST_TEST_CHECK(config->channel_set);
+    HOST_TEST_CHECK_EQ_INT(config->channel, channel);
+    HOST_TEST_CHECK(config->auth_mode_set);
+    HOST_TEST_CHECK_EQ_INT(config->auth_mode, auth_mode);
+}
+
+/* Tests */
+
+static void test_directed_then_full_scan(void) {
+    /* Joined once through the stored record, then the link drops */
+    reconnect_ns();
+    HOST_TEST_CHECK(connected());
+    check_directed(&spy.last_config, last_bssid, LAST_CHANNEL, LAST_AUTH_MODE);
+
+    wifi->disconnect_sta(wifi);
+    HOST_TEST_CHECK(!connected());
+
+    /* First attempt after the drop goes to the stored AP on its one channel */
+    spy.fail_next       = true;
+    int64_t directed_ns = reconnect_ns();
+    check_directed(&spy.last_config, last_bssid, LAST_CHANNEL, LAST_AUTH_MODE);
+
+    /* The AP does not answer there, the driver gives up with a disconnect */
+    wifi->disconnect_sta(wifi);
+    HOST_TEST_CHECK(!connected());
+
+    /* The next attempt leaves BSSID, channel and auth mode to the scan */
+    uint32_t attempt_cnt = spy.attempt_cnt;
+    int64_t  full_ns     = reconnect_ns();
+    HOST_TEST_CHECK_EQ_INT(spy.attempt_cnt, attempt_cnt + 1);
+    HOST_TEST_CHECK_EQ_STR(spy.last_config.ssid, SSID);
+    HOST_TEST_CHECK(!spy.last_config.bssid_set);
+    HOST_TEST_CHECK(!spy.last_config.channel_set);
+    HOST_TEST_CHECK(!spy.last_config.auth_mode_set);
+    HOST_TEST_CHECK(connected());
+
+    printf("reconnect: directed %lld ns, full scan %lld ns (wifiman and stub driver, no radio)\n", (long long)directed_ns, (long long)full_ns);
+}
+
+static void test_moved_ap_is_recorded(void) {
+    /* The full scan above found the AP on the stub driver's channel */
+    dom_models_wifi_status_t status;
+    HOST_TEST_CHECK_EQ_INT(wifi->get_status(wifi, &status), DOMAIN_MODELS_ERROR_OK);
+
+    dom_models_wifi_sta_last_ap_t last_ap;
+    HOST_TEST_CHECK_EQ_INT(wifi_repository->get_sta_last_ap(wifi_repository, &last_ap), DOMAIN_MODELS_ERROR_OK);
+    HOST_TEST_CHECK_EQ_STR(last_ap.ssid, SSID);
+    HOST_TEST_CHECK(memcmp(last_ap.bssid, status.connected_ap.bssid, DOM_MODELS_WIFI_MAC_LEN) == 0);
+    HOST_TEST_CHECK_EQ_INT(last_ap.channel, status.connected_ap.primary_channel);
+    HOST_TEST_CHECK_EQ_INT(last_ap.auth_mode, status.connected_ap.auth_mode);
+
+    /* Success ends the fallback, the next drop is directed again at the new record */
+    wifi->disconnect_sta(wifi);
+    int64_t directed_ns = reconnect_ns();
+    check_directed(&spy.last_config, last_ap.bssid, last_ap.channel, last_ap.auth_mode);
+    HOST_TEST_CHECK(connected());
+
+    printf("reconnect: directed to the moved AP %lld ns\n", (long long)directed_ns);
+}
+
+static void test_failed_connect_call_falls_back(void) {
+    wifi->disconnect_sta(wifi);
+
+    /* A driver that refuses the directed config outright counts as a failed attempt as well */
+    spy.refuse_next = true;
+    bool attempted  = false;
+    HOST_TEST_CHECK_EQ_INT(wifiman->try_reconnect(wifiman, &attempted), DOMAIN_MODELS_ERROR_FAILURE);
+    HOST_TEST_CHECK(spy.last_config.bssid_set);
+    HOST_TEST_CHECK(!connected());
+
+    reconnect_ns();
+    HOST_TEST_CHECK(!spy.last_config.bssid_set);
+    HOST_TEST_CHECK(connected());
+}
+
+int main(void) {
+    if (!setup()) {
+        fprintf(stderr, "wifiman setup failed\n");
+        teardown();
+        return 1;
+    }
+
+    HOST_TEST_RUN(test_directed_then_full_scan);
+    HOST_TEST_RUN(test_moved_ap_is_recorded);
+    HOST_TEST_RUN(test_failed_connect_call_falls_back);
+
+    teardown();
+
+    return HOST_TEST_RESULT();
+}
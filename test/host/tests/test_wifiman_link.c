@@ -0,0 +1,177 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "application/wifiman/impl_types.h"
+#include "application/wifiman/impl_utils.h"
+#include "domain/models/wifi.h"
+#include "domain/usecases/wifiman.h"
+#include "host_test.h"
+
+#define RSSI_LOW  -75
+#define RSSI_HIGH -65
+
+static const uint8_t bssid_a[DOM_MODELS_WIFI_MAC_LEN] = {0x02, 0, 0, 0, 0, 0x0a};
+static const uint8_t bssid_b[DOM_MODELS_WIFI_MAC_LEN] = {0x02, 0, 0, 0, 0, 0x0b};
+
+/* Helpers */
+
+static app_wifiman_impl_cfg_t cfg_with_shift(uint8_t ewma_shift) {
+    app_wifiman_impl_cfg_t cfg = {
+        .roam_rssi_low   = RSSI_LOW,
+        .roam_rssi_high  = RSSI_HIGH,
+        .roam_ewma_shift = ewma_shift,
+    };
+
+    return cfg;
+}
+
+static void sample(app_wifiman_impl_link_monitor_t* link, const app_wifiman_impl_cfg_t* cfg, const uint8_t* bssid, int8_t rssi) {
+    dom_models_wifi_ap_record_t ap = {
+        .primary_channel = 6,
+        .rssi            = rssi,
+    };
+    memcpy(ap.bssid, bssid, DOM_MODELS_WIFI_MAC_LEN);
+
+    app_wifiman_impl_link_sample(link, cfg, &ap);
+}
+
+/* Tests */
+
+static void test_first_sample_seeds_average(void) {
+    app_wifiman_impl_link_monitor_t link = {0};
+    app_wifiman_impl_cfg_t          cfg  = cfg_with_shift(2);
+
+    sample(&link, &cfg, bssid_a, -50);
+
+    HOST_TEST_CHECK(link.stats.tracking);
+    HOST_TEST_CHECK_EQ_INT(link.rssi_avg_q4, -50 * 16);
+    HOST_TEST_CHECK_EQ_INT(link.stats.rssi_avg, -50);
+    HOST_TEST_CHECK_EQ_INT(link.stats.sample_cnt, 1);
+    HOST_TEST_CHECK_EQ_INT(link.stats.bssid_count, 1);
+}
+
+static void test_average_moves_by_fraction(void) {
+    app_wifiman_impl_link_monitor_t link = {0};
+    app_wifiman_impl_cfg_t          cfg  = cfg_with_shift(2);
+
+    sample(&link, &cfg, bssid_a, -50);
+
+    /* A quarter of the 20 dB step, kept in sixteenths */
+    sample(&link, &cfg, bssid_a, -70);
+    HOST_TEST_CHECK_EQ_INT(link.rssi_avg_q4, -880);
+    HOST_TEST_CHECK_EQ_INT(link.stats.rssi_avg, -55);
+
+    /* -58.75 dB rounds half away from zero */
+    sample(&link, &cfg, bssid_a, -70);
+    HOST_TEST_CHECK_EQ_INT(link.rssi_avg_q4, -940);
+    HOST_TEST_CHECK_EQ_INT(link.stats.rssi_avg, -59);
+
+    for (int i = 0; i < 40; i++) {
+        sample(&link, &cfg, bssid_a, -70);
+    }
+    HOST_TEST_CHECK_EQ_INT(link.stats.rssi_avg, -70);
+}
+
+static void test_single_dip_is_smoothed_out(void) {
+    app_wifiman_impl_link_monitor_t link = {0};
+    app_wifiman_impl_cfg_t          cfg  = cfg_with_shift(3);
+
+    sample(&link, &cfg, bssid_a, -60);
+    sample(&link, &cfg, bssid_a, -90);
+
+    HOST_TEST_CHECK_EQ_INT(link.stats.rssi_avg, -64);
+    HOST_TEST_CHECK(!link.stats.weak);
+    HOST_TEST_CHECK_EQ_INT(link.weak_run, 0);
+}
+
+static void test_weak_has_hysteresis(void) {
+    app_wifiman_impl_link_monitor_t link = {0};
+    app_wifiman_impl_cfg_t          cfg  = cfg_with_shift(0);
+
+    /* With a shift of 0 the average is the sample, which isolates the thresholds */
+    static const struct {
+        int8_t   rssi;
+        bool     weak;
+        uint32_t weak_run;
+    } steps[] = {
+        {-70, false, 0},
+        {RSSI_LOW, false, 0},
+        {RSSI_LOW - 1, true, 1},
+        {-70, true, 2},
+        {RSSI_HIGH - 1, true, 3},
+        {RSSI_HIGH, false, 0},
+        {-74, false, 0},
+        {RSSI_LOW, false, 0},
+        {-80, true, 1},
+    };
+
+    for (size_t i = 0; i < sizeof(steps) / sizeof(steps[0]); i++) {
+        sample(&link, &cfg, bssid_a, steps[i].rssi);
+        HOST_TEST_CHECK_EQ_INT(link.stats.weak, steps[i].weak);
+        HOST_TEST_CHECK_EQ_INT(link.weak_run, steps[i].weak_run);
+    }
+
+    HOST_TEST_CHECK_EQ_INT(link.stats.bssids[0].weak_cnt, 4);
+    HOST_TEST_CHECK_EQ_INT(link.stats.bssids[0].rssi_min, -80);
+    HOST_TEST_CHECK_EQ_INT(link.stats.bssids[0].rssi_max, RSSI_HIGH);
+    HOST_TEST_CHECK_EQ_INT(link.stats.bssids[0].rssi_last, -80);
+    HOST_TEST_CHECK_EQ_INT(link.stats.bssids[0].sample_cnt, sizeof(steps) / sizeof(steps[0]));
+}
+
+static void test_new_bssid_restarts_average(void) {
+    app_wifiman_impl_link_monitor_t link = {0};
+    app_wifiman_impl_cfg_t          cfg  = cfg_with_shift(0);
+
+    sample(&link, &cfg, bssid_a, -80);
+    HOST_TEST_CHECK(link.stats.weak);
+
+    /* The AP roamed to starts from its own sample and is not weak yet */
+    cfg.roam_ewma_shift = 3;
+    sample(&link, &cfg, bssid_b, -60);
+    HOST_TEST_CHECK_EQ_INT(link.stats.rssi_avg, -60);
+    HOST_TEST_CHECK(!link.stats.weak);
+    HOST_TEST_CHECK_EQ_INT(link.weak_run, 0);
+    HOST_TEST_CHECK_EQ_INT(link.stats.bssid_count, 2);
+    HOST_TEST_CHECK(memcmp(link.stats.bssids[0].bssid, bssid_b, DOM_MODELS_WIFI_MAC_LEN) == 0);
+    HOST_TEST_CHECK(memcmp(link.stats.bssids[1].bssid, bssid_a, DOM_MODELS_WIFI_MAC_LEN) == 0);
+
+    /* Going back moves the old entry to the front and keeps its history */
+    sample(&link, &cfg, bssid_a, -62);
+    HOST_TEST_CHECK_EQ_INT(link.stats.rssi_avg, -62);
+    HOST_TEST_CHECK_EQ_INT(link.stats.bssid_count, 2);
+    HOST_TEST_CHECK(memcmp(link.stats.bssids[0].bssid, bssid_a, DOM_MODELS_WIFI_MAC_LEN) == 0);
+    HOST_TEST_CHECK_EQ_INT(link.stats.bssids[0].sample_cnt, 2);
+    HOST_TEST_CHECK_EQ_INT(link.stats.bssids[0].weak_cnt, 1);
+}
+
+static void test_disconnect_ends_tracking(void) {
+    app_wifiman_impl_link_monitor_t link = {0};
+    app_wifiman_impl_cfg_t          cfg  = cfg_with_shift(0);
+
+    sample(&link, &cfg, bssid_a, -80);
+    HOST_TEST_CHECK(link.stats.weak);
+
+    app_wifiman_impl_link_sample(&link, &cfg, NULL);
+    HOST_TEST_CHECK(!link.stats.tracking);
+    HOST_TEST_CHECK(!link.stats.weak);
+    HOST_TEST_CHECK_EQ_INT(link.weak_run, 0);
+
+    /* Rejoining the same AP starts a new average instead of continuing the old one */
+    cfg.roam_ewma_shift = 3;
+    sample(&link, &cfg, bssid_a, -50);
+    HOST_TEST_CHECK(link.stats.tracking);
+    HOST_TEST_CHECK_EQ_INT(link.stats.rssi_avg, -50);
+}
+
+int main(void) {
+    HOST_TEST_RUN(test_first_sample_seeds_average);
+    HOST_TEST_RUN(test_average_moves_by_fraction);
+    HOST_TEST_RUN(test_single_dip_is_smoothed_out);
+    HOST_TEST_RUN(test_weak_has_hysteresis);
+    HOST_TEST_RUN(test_new_bssid_restarts_average);
+    HOST_TEST_RUN(test_disconnect_ends_tracking);
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,240 @@
+#!/usr/bin/env python3
+"""Decode binary log batches published on <prefix>/logs/bin.
+
+The device ships log calls unformatted: each frame carries the tag and
+format string as pointers into the firmware image plus the raw argument
+bytes, see presentation/task/log_shipping/types.h for the layout. The
+pointers are looked up in the allocated sections of the firmware ELF, so
+the ELF must be the exact build the device runs. Lines come out the way
+the device prints them, with the wall time in UTC worked out from the
+batch header.
+
+Payloads are read from the files given, or from stdin as one hex payload
+per line, which is what `mosquitto_sub -t '<prefix>/logs/bin' -F %x`
+prints.
+"""
+
+import argparse
+import re
+import struct
+import sys
+import time
+
+MAGIC = b"HLOG"
+VERSION = 1
+HEAD_FORMAT = "<4sB9Bqq"
+HEAD_LEN = struct.calcsize(HEAD_FORMAT)
+
+LEVELS = {1: "ERROR", 2: "WARN", 3: "INFO", 4: "DEBUG"}
+
+SPEC_RE = re.compile(
+    r"%(?P<flags>[-+ #0]*)(?P<width>\*|\d*)(?:\.(?P<precision>\*|\d*))?"
+    r"(?P<length>hh|h|ll|l|z|j|t|L)?(?P<conv>.?)",
+    re.DOTALL,
+)
+
+SHF_ALLOC = 0x2
+SHT_NOBITS = 8
+
+
+class Elf:
+    """Maps addresses to the NUL-terminated strings stored there."""
+
+    def __init__(self, path):
+        with open(path, "rb") as elf:
+            self.data = elf.read()
+        if self.data[:4] != b"\x7fELF" or self.data[5] != 1:
+            raise ValueError(f"{path}: not a little-endian ELF")
+
+        if self.data[4] == 2:
+            shoff, shentsize, shnum = struct.unpack_from("<Q10xHH", self.data, 0x28)
+            section_format = "<4xIQQQQ"
+        else:
+            shoff, shentsize, shnum = struct.unpack_from("<I10xHH", self.data, 0x20)
+            section_format = "<4xIIIII"
+
+        self.sections = []
+        for i in range(shnum):
+            sh_type, flags, addr, offset, size = struct.unpack_from(section_format, self.data, shoff + i * shentsize)
+            if flags & SHF_ALLOC and sh_type != SHT_NOBITS and addr and size:
+                self.sections.append((addr, offset, size))
+
+    def string(self, addr):
+        if addr == 0:
+            return ""
+        for start, offset, size in self.sections:
+            if start <= addr < start + size:
+                begin = offset + addr - start
+                end = self.data.find(b"\0", begin, offset + size)
+                if end < 0:
+                    end = offset + size
+                return self.data[begin:end].decode("utf-8", "replace")
+        return f"<0x{addr:x}>"
+
+
+class Args:
+    """Reads the argument bytes in the order the format consumes them."""
+
+    def __init__(self, data, sizes):
+        self.data = data
+        self.offset = 0
+        self.sizes = sizes
+
+    def integer(self, size, signed):
+        if self.offset + size > len(self.data):
+            raise EOFError
+        value = int.from_bytes(self.data[self.offset : self.offset + size], "little", signed=signed)
+        self.offset += size
+        return value
+
+    def double(self, size):
+        if self.offset + size > len(self.data):
+            raise EOFError
+        raw = self.data[self.offset : self.offset + size]
+        self.offset += size
+        if size == 8:
+            return struct.unpack("<d", raw)[0]
+        if size == 4:
+            return struct.unpack("<f", raw)[0]
+        # x87 extended precision, the 64-bit mantissa carries the integer bit
+        mantissa, exponent = struct.unpack_from("<QH", raw)
+        sign = -1.0 if exponent & 0x8000 else 1.0
+        exponent &= 0x7FFF
+        return sign * mantissa * 2.0 ** (exponent - 16383 - 63) if exponent else 0.0
+
+    def string(self):
+        end = self.data.find(b"\0", self.offset)
+        if end < 0:
+            raise EOFError
+        value = self.data[self.offset : end].decode("utf-8", "replace")
+        self.offset = end + 1
+        return value
+
+
+def int_size(sizes, length):
+    return {"l": sizes["long"], "ll": sizes["long long"], "z": sizes["size_t"], "j": sizes["intmax_t"], "t": sizes["ptrdiff_t"]}.get(length, sizes["int"])
+
+
+def format_spec(match, args):
+    flags, width, precision, length, conv = match.group("flags", "width", "precision", "length", "conv")
+
+    if conv in ("%", ""):
+        return "%"
+    if conv == "n" or (conv == "s" and length == "l"):
+        return ""
+
+    if width == "*":
+        width = str(args.integer(args.sizes["int"], True))
+    if precision == "*":
+        precision = str(args.integer(args.sizes["int"], True))
+    spec = "%" + flags + (width or "") + ("." + precision if precision is not None else "")
+
+    if conv in "dic":
+        value = args.integer(int_size(args.sizes, length), True)
+        if length == "hh" or conv == "c":
+            value = (value + 0x80) % 0x100 - 0x80
+        elif length == "h":
+            value = (value + 0x8000) % 0x10000 - 0x8000
+        return (spec + conv) % (value & 0xFF if conv == "c" else value)
+    if conv in "uoxX":
+        size = int_size(args.sizes, length)
+        value = args.integer(size, False)
+        if length == "hh":
+            value &= 0xFF
+        elif length == "h":
+            value &= 0xFFFF
+        if conv == "o" and "#" in flags:
+            return (spec.replace("#", "") + "s") % ("0" + format(value, "o") if value else "0")
+        return (spec + ("d" if conv == "u" else conv)) % value
+    if conv in "fFeEgGaA":
+        value = args.double(args.sizes["long double"] if length == "L" else args.sizes["double"])
+        if conv in "aA":
+            text = value.hex()
+            return (spec.replace("#", "") + "s") % (text.upper() if conv == "A" else text)
+        return (spec + conv) % value
+    if conv == "p":
+        return (spec.replace("#", "") + "s") % f"0x{args.integer(args.sizes['void*'], False):x}"
+    if conv == "s":
+        return (spec + "s") % args.string()
+
+    # Unknown conversions consume nothing and print a bare '%', as on the device
+    return "%"
+
+
+def format_message(fmt, args):
+    out = []
+    cursor = 0
+    for match in SPEC_RE.finditer(fmt):
+        out.append(fmt[cursor : match.start()])
+        cursor = match.end()
+        try:
+            out.append(format_spec(match, args))
+        except EOFError:
+            # The device cut the args to fit, like its own decoder stop here
+            return "".join(out)
+    out.append(fmt[cursor:])
+    return "".join(out)
+
+
+def decode(payload, elf):
+    if len(payload) < HEAD_LEN or payload[:4] != MAGIC:
+        raise ValueError("not a binary log batch")
+
+    head = struct.unpack_from(HEAD_FORMAT, payload)
+    if head[1] != VERSION:
+        raise ValueError(f"unsupported batch version {head[1]}")
+
+    names = ("int", "long", "long long", "size_t", "intmax_t", "ptrdiff_t", "void*", "double", "long double")
+    sizes = dict(zip(names, head[2:11]))
+    uptime_us, unix_ms = head[11], head[12]
+    pointer = {4: "<I", 8: "<Q"}[sizes["void*"]]
+
+    lines = []
+    offset = HEAD_LEN
+    while offset + 2 <= len(payload):
+        (body_len,) = struct.unpack_from("<H", payload, offset)
+        body = payload[offset + 2 : offset + 2 + body_len]
+        offset += 2 + body_len
+        if len(body) < 1 + 2 * sizes["void*"] + 8:
+            break
+
+        level = body[0]
+        tag = elf.string(struct.unpack_from(pointer, body, 1)[0])
+        fmt = elf.string(struct.unpack_from(pointer, body, 1 + sizes["void*"])[0])
+        (timestamp_us,) = struct.unpack_from("<q", body, 1 + 2 * sizes["void*"])
+        args = Args(body[1 + 2 * sizes["void*"] + 8 :], sizes)
+
+        # Same prefix as the device, placed by the record's age at publish
+        wall_ms = unix_ms - max(uptime_us - timestamp_us, 0) // 1000
+        stamp = time.strftime("%d/%m/%Y %H:%M:%S", time.gmtime(wall_ms // 1000))
+        lines.append(f"{stamp}.{wall_ms % 1000:03d} [{LEVELS.get(level, 'NONE')}] [{tag}] {format_message(fmt, args)}")
+
+    return lines
+
+
+def payloads(paths):
+    if paths:
+        for path in paths:
+            with open(path, "rb") as payload:
+                yield payload.read()
+        return
+
+    for line in sys.stdin:
+        fields = line.split()
+        if fields:
+            yield bytes.fromhex(fields[-1])
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--elf", required=True, help="firmware ELF the device runs")
+    parser.add_argument("payloads", nargs="*", help="binary payload files, hex lines on stdin when omitted")
+    options = parser.parse_args()
+
+    elf = Elf(options.elf)
+    for payload in payloads(options.payloads):
+        try:
+            for line in decode(payload, elf):
+                print(line)
+        except ValueError as err:
+            print(f"skipped payload: {err}", file=sys.stderr)
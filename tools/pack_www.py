@@ -0,0 +1,55 @@
+#!/usr/bin/env python3
+"""Pack the web UI for the storage partition image.
+
+Every file under the source directory is written to the output directory
+as <name>.gz, compressed at level 9 with a zeroed mtime so the image only
+changes when a file does. Files that do not shrink, like images and fonts
+that are compressed already, are copied as they are. The device serves the
+.gz with Content-Encoding: gzip and never inflates anything itself.
+"""
+
+import gzip
+import os
+import shutil
+import sys
+
+
+def pack(src_dir, out_dir):
+    if os.path.isdir(out_dir):
+        shutil.rmtree(out_dir)
+
+    raw_total = 0
+    packed_total = 0
+
+    for root, dirs, files in os.walk(src_dir):
+        dirs[:] = sorted(d for d in dirs if not d.startswith("."))
+        for name in sorted(files):
+            if name.startswith("."):
+                continue
+
+            src_path = os.path.join(root, name)
+            out_path = os.path.join(out_dir, os.path.relpath(src_path, src_dir))
+            os.makedirs(os.path.dirname(out_path), exist_ok=True)
+
+            with open(src_path, "rb") as src:
+                raw = src.read()
+            packed = gzip.compress(raw, compresslevel=9, mtime=0)
+
+            if len(packed) < len(raw):
+                out_path += ".gz"
+            else:
+                packed = raw
+
+            with open(out_path, "wb") as out:
+                out.write(packed)
+
+            raw_total += len(raw)
+            packed_total += len(packed)
+
+    print(f"web UI packed: {raw_total} -> {packed_total} bytes")
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 3:
+        sys.exit(f"usage: {sys.argv[0]} <src_dir> <out_dir>")
+    pack(sys.argv[1], sys.argv[2])